@@ -20,6 +20,7 @@
 #include <fstream>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 
 #include "mantaio.h"
 #include "grid.h"
@@ -35,6 +36,10 @@
 #  include "openvdb/tools/Dense.h"
 #endif
 
+#if TBB == 1
+#  include <tbb/parallel_for.h>
+#endif
+
 #define POSITION_NAME "P"
 #define FLAG_NAME "U"
 
@@ -432,14 +437,23 @@ int writeObjectsVDB(const string &filename,
     openvdb::tools::copyFromDense(dense, *vdbClipGrid, clip);
   }
 
+  // Converting the objects into vdb grids is independent for every object, so only collect the
+  // conversions here and run them in parallel afterwards. Options are then set in object order.
+  struct GridExport {
+    std::function<openvdb::GridBase::Ptr()> exportFn;
+    PbClass *object;
+    openvdb::GridClass gClass;
+    float voxelSize;
+  };
+  std::vector<GridExport> gridExports;
+
   for (std::vector<PbClass *>::iterator iter = objects->begin(); iter != objects->end(); ++iter) {
     openvdb::GridClass gClass = openvdb::GRID_UNKNOWN;
-    openvdb::GridBase::Ptr vdbGrid;
+    std::function<openvdb::GridBase::Ptr()> exportFn;
 
     PbClass *object = dynamic_cast<PbClass *>(*iter);
     const Real dx = object->getParent()->getDx();
     const Real voxelSize = worldSize * dx;
-    const string objectName = object->getName();
 
     if (GridBase *mantaGrid = dynamic_cast<GridBase *>(*iter)) {
 
@@ -451,8 +465,9 @@ int writeObjectsVDB(const string &filename,
                     "writeObjectsVDB: Clip grid and exported grid must have the same size "
                         << clipGrid->getSize() << " vs " << mantaGrid->getSize());
         }
-        vdbGrid = exportVDB<int, openvdb::Int32Grid>(mantaIntGrid, clip, vdbClipGrid);
-        gridsVDB.push_back(vdbGrid);
+        exportFn = [=]() -> openvdb::GridBase::Ptr {
+          return exportVDB<int, openvdb::Int32Grid>(mantaIntGrid, clip, vdbClipGrid);
+        };
       }
       else if (mantaGrid->getType() & GridBase::TypeReal) {
         debMsg("Writing real grid '" << mantaGrid->getName() << "' to vdb file " << filename, 1);
@@ -466,8 +481,9 @@ int writeObjectsVDB(const string &filename,
                     "writeObjectsVDB: Clip grid and exported grid must have the same size "
                         << clipGrid->getSize() << " vs " << mantaGrid->getSize());
         }
-        vdbGrid = exportVDB<Real, openvdb::FloatGrid>(mantaRealGrid, clip, tmpClipGrid);
-        gridsVDB.push_back(vdbGrid);
+        exportFn = [=]() -> openvdb::GridBase::Ptr {
+          return exportVDB<Real, openvdb::FloatGrid>(mantaRealGrid, clip, tmpClipGrid);
+        };
       }
       else if (mantaGrid->getType() & GridBase::TypeVec3) {
         debMsg("Writing vec3 grid '" << mantaGrid->getName() << "' to vdb file " << filename, 1);
@@ -479,8 +495,9 @@ int writeObjectsVDB(const string &filename,
                     "writeObjectsVDB: Clip grid and exported grid must have the same size "
                         << clipGrid->getSize() << " vs " << mantaGrid->getSize());
         }
-        vdbGrid = exportVDB<Vec3, openvdb::Vec3SGrid>(mantaVec3Grid, clip, vdbClipGrid);
-        gridsVDB.push_back(vdbGrid);
+        exportFn = [=]() -> openvdb::GridBase::Ptr {
+          return exportVDB<Vec3, openvdb::Vec3SGrid>(mantaVec3Grid, clip, vdbClipGrid);
+        };
       }
       else {
         errMsg("writeObjectsVDB: unknown grid type");
@@ -491,8 +508,10 @@ int writeObjectsVDB(const string &filename,
       debMsg("Writing particle system '" << mantaPP->getName()
                                          << "' (and buffered pData) to vdb file " << filename,
              1);
-      vdbGrid = exportVDB(mantaPP, pdbBuffer, skipDeletedParts, voxelSize, precision);
-      gridsVDB.push_back(vdbGrid);
+      // The particle system takes the particle data that has been buffered up to this point.
+      exportFn = [=, pdbs = pdbBuffer]() mutable -> openvdb::GridBase::Ptr {
+        return exportVDB(mantaPP, pdbs, skipDeletedParts, voxelSize, precision);
+      };
       pdbBuffer.clear();
     }
     // Particle data will only be saved if there is a particle system too.
@@ -506,18 +525,42 @@ int writeObjectsVDB(const string &filename,
       return 0;
     }
 
+    if (exportFn) {
+      gridExports.push_back({exportFn, object, gClass, float(voxelSize)});
+    }
+  }
+
+  gridsVDB.resize(gridExports.size());
+#  if TBB == 1
+  tbb::parallel_for(size_t(0), gridExports.size(), [&](const size_t i) {
+    gridsVDB[i] = gridExports[i].exportFn();
+  });
+#  else
+  for (size_t i = 0; i < gridExports.size(); i++) {
+    gridsVDB[i] = gridExports[i].exportFn();
+  }
+#  endif
+
+  for (size_t i = 0; i < gridExports.size(); i++) {
+    const GridExport &gridExport = gridExports[i];
+    openvdb::GridBase::Ptr vdbGrid = gridsVDB[i];
+
     // Set additional grid attributes, e.g. name, grid class, compression level, etc.
     if (vdbGrid) {
-      setGridOptions<openvdb::GridBase>(vdbGrid, objectName, gClass, voxelSize, precision);
+      setGridOptions<openvdb::GridBase>(vdbGrid,
+                                        gridExport.object->getName(),
+                                        gridExport.gClass,
+                                        gridExport.voxelSize,
+                                        precision);
 
       // Optional metadata: Save additional simulation information per vdb object
       if (meta) {
-        const Vec3i size = object->getParent()->getGridSize();
+        const Vec3i size = gridExport.object->getParent()->getGridSize();
         // The (dense) resolution of this grid
         vdbGrid->insertMeta(META_BASE_RES,
                             openvdb::Vec3IMetadata(openvdb::Vec3i(size.x, size.y, size.z)));
         // Length of one voxel side
-        vdbGrid->insertMeta(META_VOXEL_SIZE, openvdb::FloatMetadata(voxelSize));
+        vdbGrid->insertMeta(META_VOXEL_SIZE, openvdb::FloatMetadata(gridExport.voxelSize));
       }
     }
   }
@@ -9,6 +9,7 @@
 #include "scene/integrator.h"
 #include "scene/scene.h"
 #include "session/buffers.h"
+#include "session/merge.h"
 #include "session/session.h"
 
 #include "util/args.h"
@@ -41,6 +42,7 @@ struct Options {
   unique_ptr<Session> session;
   Scene *scene;
   string filepath;
+  vector<string> filepaths;
   int width, height;
   SceneParams scene_params;
   SessionParams session_params;
@@ -48,6 +50,7 @@ struct Options {
   bool show_help, interactive, pause;
   string output_filepath;
   string output_pass;
+  string merge_filepath;
 } options;
 
 static void session_print(const string &str)
@@ -139,8 +142,19 @@ static void session_init()
 #endif
 
   if (!options.output_filepath.empty()) {
-    options.session->set_output_driver(make_unique<OIIOOutputDriver>(
-        options.output_filepath, options.output_pass, session_print));
+    unique_ptr<OIIOOutputDriver> output_driver = make_unique<OIIOOutputDriver>(
+        options.output_filepath, options.output_pass, session_print);
+
+    /* Write the number of samples of a subset, so that renders of multiple subsets can be
+     * merged afterwards. */
+    const SessionParams &params = options.session_params;
+    if (params.use_sample_subset) {
+      const int subset_end = min(params.sample_subset_offset + params.sample_subset_length,
+                                 params.samples);
+      output_driver->set_samples(max(subset_end - params.sample_subset_offset, 0));
+    }
+
+    options.session->set_output_driver(std::move(output_driver));
   }
 
   if (options.session_params.background && !options.quiet) {
@@ -373,6 +387,21 @@ static void parse_string(OIIO::cspan<const char *> argv, std::string *s)
   *s = argv[1];
 }
 
+/* Merge images rendered with different sample subsets, for example by multiple machines. */
+static bool images_merge()
+{
+  ImageMerger merger;
+  merger.input = options.filepaths;
+  merger.output = options.merge_filepath;
+
+  if (!merger.run()) {
+    fprintf(stderr, "%s\n", merger.error.c_str());
+    return false;
+  }
+
+  return true;
+}
+
 static void options_parse(const int argc, const char **argv)
 {
   options.width = 1024;
@@ -408,8 +437,8 @@ static void options_parse(const int argc, const char **argv)
   bool version = false;
   string log_level;
 
-  ap.usage("cycles [options] file.xml");
-  ap.arg("filename").hidden().action([&](auto argv) { options.filepath = argv[0]; });
+  ap.usage("cycles [options] file.xml\n       cycles --merge OUTPUT file.exr [file.exr ...]");
+  ap.arg("filename").hidden().action([&](auto argv) { options.filepaths.push_back(argv[0]); });
   ap.arg("--device %s:DEVICE").help("Devices to use: " + device_names).action([&](auto argv) {
     parse_string(argv, &devicename);
   });
@@ -424,6 +453,17 @@ static void options_parse(const int argc, const char **argv)
   ap.arg("--samples %d:SAMPLES").help("Number of samples to render").action([&](auto argv) {
     parse_int(argv, &options.session_params.samples);
   });
+  ap.arg("--sample-subset %d:OFFSET %d:LENGTH")
+      .help("Only render the given range of samples, to be merged with renders of other subsets")
+      .action([&](auto argv) {
+        assert(argv.size() == 3);
+        options.session_params.use_sample_subset = true;
+        options.session_params.sample_subset_offset = atoi(argv[1]);
+        options.session_params.sample_subset_length = atoi(argv[2]);
+      });
+  ap.arg("--merge %s:OUTPUT")
+      .help("Merge multilayer EXR images rendered with different sample subsets into OUTPUT")
+      .action([&](auto argv) { parse_string(argv, &options.merge_filepath); });
   ap.arg("--output %s:OUTPUT").help("File path to write output image").action([&](auto argv) {
     parse_string(argv, &options.output_filepath);
   });
@@ -457,6 +497,10 @@ static void options_parse(const int argc, const char **argv)
     log_level_set(log_level);
   }
 
+  if (!options.filepaths.empty()) {
+    options.filepath = options.filepaths.front();
+  }
+
   if (list) {
     const vector<DeviceInfo> devices = Device::available_devices();
     printf("Devices:\n");
@@ -478,6 +522,9 @@ static void options_parse(const int argc, const char **argv)
     ap.print_help();
     exit(EXIT_SUCCESS);
   }
+  else if (!options.merge_filepath.empty()) {
+    exit(images_merge() ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
 
   options.session_params.use_profiling = profile;
 
@@ -523,6 +570,16 @@ static void options_parse(const int argc, const char **argv)
     exit(EXIT_FAILURE);
   }
 #endif
+  else if (options.session_params.use_sample_subset &&
+           (options.session_params.sample_subset_offset < 0 ||
+            options.session_params.sample_subset_length < 1))
+  {
+    fprintf(stderr,
+            "Invalid sample subset: %d %d\n",
+            options.session_params.sample_subset_offset,
+            options.session_params.sample_subset_length);
+    exit(EXIT_FAILURE);
+  }
   else if (options.session_params.samples < 0) {
     fprintf(stderr, "Invalid number of samples: %d\n", options.session_params.samples);
     exit(EXIT_FAILURE);
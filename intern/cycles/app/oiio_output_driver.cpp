@@ -22,6 +22,11 @@ OIIOOutputDriver::OIIOOutputDriver(const string_view filepath,
 
 OIIOOutputDriver::~OIIOOutputDriver() = default;
 
+void OIIOOutputDriver::set_samples(const int samples)
+{
+  samples_ = samples;
+}
+
 void OIIOOutputDriver::write_render_tile(const Tile &tile)
 {
   /* Only write the full buffer, no intermediate tiles. */
@@ -40,7 +45,12 @@ void OIIOOutputDriver::write_render_tile(const Tile &tile)
   const int width = tile.size.x;
   const int height = tile.size.y;
 
-  const ImageSpec spec(width, height, 4, TypeDesc::FLOAT);
+  ImageSpec spec(width, height, 4, TypeDesc::FLOAT);
+  if (samples_ > 0) {
+    /* Same metadata as written by Blender, used by the image merger to weight the images. */
+    const string layer = tile.layer.empty() ? string("RenderLayer") : tile.layer;
+    spec.attribute("cycles." + layer + ".samples", string_printf("%d", samples_));
+  }
   if (!image_output->open(filepath_, spec)) {
     log_("Failed to create image file");
     return;
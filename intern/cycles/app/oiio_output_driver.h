@@ -17,12 +17,17 @@ class OIIOOutputDriver : public OutputDriver {
   OIIOOutputDriver(const string_view filepath, const string_view pass, LogFunction log);
   ~OIIOOutputDriver() override;
 
+  /* Number of samples rendered, written to the image metadata so that images rendered with
+   * different sample subsets can be merged. Only written when not zero. */
+  void set_samples(const int samples);
+
   void write_render_tile(const Tile &tile) override;
 
  protected:
   string filepath_;
   string pass_;
   LogFunction log_;
+  int samples_ = 0;
 };
 
 CCL_NAMESPACE_END
@@ -13,6 +13,10 @@ def _configure_argument_parser():
     parser.add_argument("--cycles-print-stats",
                         help="Print rendering statistics to stderr",
                         action='store_true')
+    parser.add_argument("--cycles-stats-json",
+                        help="Append rendering statistics of every frame to this file, as one JSON object per line",
+                        metavar="FILE",
+                        default=None)
     parser.add_argument("--cycles-device",
                         help="Set the device to use for Cycles, overriding user preferences and the scene setting."
                              "Valid options are 'CPU', 'CUDA', 'OPTIX', 'HIP', 'ONEAPI', or 'METAL'."
@@ -35,6 +39,10 @@ def _parse_command_line():
         import _cycles
         _cycles.enable_print_stats()
 
+    if args.cycles_stats_json:
+        import _cycles
+        _cycles.set_stats_json_filepath(args.cycles_stats_json)
+
     if args.cycles_device:
         import _cycles
         if not _cycles.set_device_override(args.cycles_device):
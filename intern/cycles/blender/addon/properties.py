@@ -1061,6 +1061,21 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         max=8192,
     )
 
+    use_texture_cache: BoolProperty(
+        name="Texture Cache",
+        description="Load image textures from tiled and mipmapped .tx files on demand, generating them next to "
+        "the original image when missing. Only used by Open Shading Language on the CPU",
+        default=False,
+    )
+    texture_cache_size: IntProperty(
+        name="Texture Cache Size",
+        default=16384,
+        description="Maximum memory in megabytes used for texture tiles loaded from the texture cache",
+        min=64,
+        max=1048576,
+        subtype='UNSIGNED',
+    )
+
     # Various fine-tuning debug flags
 
     def _devices_update_callback(self, context):
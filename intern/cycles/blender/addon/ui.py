@@ -877,6 +877,14 @@ class CYCLES_RENDER_PT_performance_memory(CyclesButtonsPanel, Panel):
 
         layout.prop(cscene, "tile_size")
 
+        col = layout.column(heading="Texture Cache")
+        col.active = cscene.shading_system
+        row = col.row(align=True)
+        row.prop(cscene, "use_texture_cache", text="")
+        sub = row.row()
+        sub.active = cscene.use_texture_cache
+        sub.prop(cscene, "texture_cache_size", text="Size")
+
 
 class CYCLES_RENDER_PT_performance_acceleration_structure(CyclesButtonsPanel, Panel):
     bl_label = "Acceleration Structure"
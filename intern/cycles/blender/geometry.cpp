@@ -15,6 +15,8 @@
 
 #include "util/task.h"
 
+#include "BKE_attribute_storage.hh"
+#include "BKE_curves.hh"
 #include "BKE_material.hh"
 #include "DNA_material_types.h"
 
@@ -80,6 +82,48 @@ array<Node *> BlenderSync::find_used_shaders(blender::Object &b_ob)
   return used_shaders;
 }
 
+/* Geometry nodes can output many Curves data-blocks that reference the same implicitly shared
+ * arrays, for example when a groom is copied for every instance reference. Use the first of those
+ * data-blocks as key for all of them, so that curve keys and BVH are only created once. */
+blender::ID *BlenderSync::find_shared_curves_key(blender::ID *b_curves_id,
+                                                  const array<Node *> &used_shaders)
+{
+  const blender::bke::CurvesGeometry &curves =
+      blender::id_cast<const blender::Curves *>(b_curves_id)->geometry.wrap();
+  if (curves.is_empty() || curves.runtime->curve_offsets_sharing_info == nullptr ||
+      curves.point_data.totlayer != 0)
+  {
+    return b_curves_id;
+  }
+
+  string key;
+  auto add_pointer = [&key](const void *pointer) {
+    key.append(reinterpret_cast<const char *>(&pointer), sizeof(pointer));
+  };
+
+  add_pointer(curves.runtime->curve_offsets_sharing_info);
+  add_pointer(curves.runtime->custom_knots_sharing_info);
+  for (Node *node : used_shaders) {
+    add_pointer(node);
+  }
+
+  const blender::bke::AttributeStorage &storage = curves.attribute_storage.wrap();
+  for (const int i : blender::IndexRange(storage.count())) {
+    const blender::bke::Attribute &attribute = storage.at_index(i);
+    const void *sharing_info = std::visit(
+        [](const auto &data) -> const void * { return data.sharing_info.get(); },
+        attribute.data());
+    if (sharing_info == nullptr) {
+      return b_curves_id;
+    }
+    key += attribute.name();
+    key.push_back('\0');
+    add_pointer(sharing_info);
+  }
+
+  return shared_curves_keys.emplace(key, b_curves_id).first->second;
+}
+
 Geometry *BlenderSync::sync_geometry(BObjectInfo &b_ob_info,
                                      bool object_updated,
                                      bool use_particle_hair,
@@ -87,15 +131,19 @@ Geometry *BlenderSync::sync_geometry(BObjectInfo &b_ob_info,
 {
   /* Test if we can instance or if the object is modified. */
   const Geometry::Type geom_type = determine_geom_type(b_ob_info, use_particle_hair);
-  blender::ID *const b_key_id = (b_ob_info.is_real_object_data() &&
-                                 BKE_object_is_modified(*b_ob_info.real_object)) ?
-                                    &b_ob_info.real_object->id :
-                                    b_ob_info.object_data;
-  const GeometryKey key(b_key_id, geom_type);
+  blender::ID *b_key_id = (b_ob_info.is_real_object_data() &&
+                           BKE_object_is_modified(*b_ob_info.real_object)) ?
+                              &b_ob_info.real_object->id :
+                              b_ob_info.object_data;
 
   /* Find shader indices. */
   array<Node *> used_shaders = find_used_shaders(*b_ob_info.iter_object);
 
+  if (geom_type == Geometry::HAIR && !use_particle_hair && !b_ob_info.is_real_object_data()) {
+    b_key_id = find_shared_curves_key(b_key_id, used_shaders);
+  }
+  const GeometryKey key(b_key_id, geom_type);
+
   /* Ensure we only sync instanced geometry once. */
   Geometry *geom = geometry_map.find(key);
   if (geom) {
@@ -15,6 +15,7 @@
 #include "scene/bake.h"
 #include "scene/camera.h"
 #include "scene/film.h"
+#include "scene/geometry.h"
 #include "scene/integrator.h"
 #include "scene/light.h"
 #include "scene/mesh.h"
@@ -44,6 +45,7 @@ CCL_NAMESPACE_BEGIN
 DeviceTypeMask BlenderSession::device_override = DEVICE_MASK_ALL;
 bool BlenderSession::headless = false;
 bool BlenderSession::print_render_stats = false;
+string BlenderSession::stats_json_filepath;
 
 BlenderSession::BlenderSession(blender::RenderEngine &b_engine,
                                blender::UserDef &b_userpref,
@@ -335,6 +337,23 @@ void BlenderSession::stamp_view_layer_metadata(Scene *scene, const string &view_
                                time_human_readable_from_seconds(total_time - render_time).c_str());
 }
 
+/* Report how much data from the previous frame is reused when rendering with persistent data. */
+static void log_persistent_data_reuse(Scene *scene,
+                                      const size_t mem_reused,
+                                      const double sync_time)
+{
+  int num_geometry_reused = 0;
+  for (const Geometry *geom : scene->geometry) {
+    if (!geom->is_modified()) {
+      ++num_geometry_reused;
+    }
+  }
+
+  LOG_INFO << "Persistent data reused " << num_geometry_reused << " of " << scene->geometry.size()
+           << " geometries and " << string_human_readable_size(mem_reused)
+           << " of device memory, synchronized in " << sync_time << " seconds.";
+}
+
 void BlenderSession::render(blender::Depsgraph &b_depsgraph_)
 {
   b_depsgraph = &b_depsgraph_;
@@ -392,6 +411,10 @@ void BlenderSession::render(blender::Depsgraph &b_depsgraph_)
       sync->tag_update();
     }
 
+    /* Device memory still in use at this point was kept from the previous frame. */
+    const size_t mem_reused = session->stats.mem_used;
+    const double sync_start_time = time_dt();
+
     /* update scene */
     sync->sync_camera(*b_render, width, height, b_rview_name.c_str());
     sync->sync_data(*b_render,
@@ -404,6 +427,10 @@ void BlenderSession::render(blender::Depsgraph &b_depsgraph_)
                     &python_thread_state,
                     session_params.denoise_device);
 
+    if ((b_render->mode & blender::R_PERSISTENT_DATA) && view_index == 0) {
+      log_persistent_data_reuse(scene, mem_reused, time_dt() - sync_start_time);
+    }
+
     /* At the moment we only free if we are not doing multi-view
      * (or if we are rendering the last view). See #58142/D4239 for discussion.
      */
@@ -443,17 +470,24 @@ void BlenderSession::render(blender::Depsgraph &b_depsgraph_)
     session->reset(effective_session_params, buffer_params);
 
     /* render */
-    if ((b_engine.flag & blender::RE_ENGINE_PREVIEW) == 0 && background && print_render_stats) {
+    const bool collect_render_stats = (b_engine.flag & blender::RE_ENGINE_PREVIEW) == 0 &&
+                                      background && need_render_stats();
+    if (collect_render_stats) {
       scene->enable_update_stats();
     }
 
     session->start();
     session->wait();
 
-    if ((b_engine.flag & blender::RE_ENGINE_PREVIEW) == 0 && background && print_render_stats) {
+    if (collect_render_stats) {
       RenderStats stats;
       session->collect_statistics(&stats);
-      printf("Render statistics:\n%s\n", stats.full_report().c_str());
+      if (print_render_stats) {
+        printf("Render statistics:\n%s\n", stats.full_report().c_str());
+      }
+      if (!stats_json_filepath.empty()) {
+        write_render_stats_json(stats);
+      }
     }
 
     if (session->progress.get_cancel()) {
@@ -479,6 +513,34 @@ void BlenderSession::render(blender::Depsgraph &b_depsgraph_)
   LOG_INFO << "Render time (without synchronization): " << render_time;
 }
 
+void BlenderSession::write_render_stats_json(RenderStats &stats)
+{
+  double total_time;
+  double render_time;
+  session->progress.get_time(total_time, render_time);
+
+  string json = "{";
+  json += string_printf("\"frame\": %d", b_scene->r.cfra);
+  json += ", \"view_layer\": " + string_json_quote(b_rlay_name);
+  json += ", \"view\": " + string_json_quote(b_rview_name);
+  json += string_printf(", \"total_time\": %f, \"render_time\": %f", total_time, render_time);
+  json += string_printf(", \"samples\": %d", session->progress.get_current_sample());
+  json += string_printf(", \"memory_peak\": %zu", session->stats.mem_peak);
+  json += ", \"render\": " + stats.json_report();
+  if (scene->update_stats) {
+    json += ", \"update\": " + scene->update_stats->json_report();
+  }
+  json += "}\n";
+
+  FILE *file = path_fopen(stats_json_filepath, "a");
+  if (file == nullptr) {
+    LOG_ERROR << "Failed to open render statistics file " << stats_json_filepath;
+    return;
+  }
+  fwrite(json.data(), 1, json.size(), file);
+  fclose(file);
+}
+
 void BlenderSession::render_frame_finish()
 {
   /* Processing of all layers and views is done. Clear the strings so that we can communicate
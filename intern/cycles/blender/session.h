@@ -132,9 +132,21 @@ class BlenderSession {
 
   static bool print_render_stats;
 
+  /* File to append render statistics of every frame to, as one JSON object per line. */
+  static string stats_json_filepath;
+
+  /* Whether render statistics are gathered for final renders. */
+  static bool need_render_stats()
+  {
+    return print_render_stats || !stats_json_filepath.empty();
+  }
+
  protected:
   void stamp_view_layer_metadata(Scene *scene, const string &view_layer_name);
 
+  /* Append render statistics of the current view to the statistics file. */
+  void write_render_stats_json(RenderStats &stats);
+
   /* Check whether session error happened.
    * If so, it is reported to the render engine and true is returned.
    * Otherwise false is returned. */
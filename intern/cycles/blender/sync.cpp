@@ -322,6 +322,7 @@ void BlenderSync::sync_data(blender::RenderData &b_render,
   sync_images();
 
   geometry_synced.clear(); /* use for objects and motion sync */
+  shared_curves_keys.clear();
 
   if (scene->need_motion() == Scene::MOTION_NONE || scene->need_motion() == Scene::MOTION_PASS ||
       scene->camera->get_motion_position() == MOTION_POSITION_CENTER)
@@ -331,6 +332,7 @@ void BlenderSync::sync_data(blender::RenderData &b_render,
   sync_motion(b_render, b_depsgraph, b_screen, b_v3d, b_rv3d, width, height, python_thread_state);
 
   geometry_synced.clear();
+  shared_curves_keys.clear();
 
   /* Shader sync done at the end, since object sync uses it.
    * false = don't delete unused shaders, not supported. */
@@ -951,6 +953,9 @@ SceneParams BlenderSync::get_scene_params(blender::Scene &b_scene,
     params.texture_limit = 0;
   }
 
+  params.use_texture_cache = RNA_boolean_get(&cscene, "use_texture_cache");
+  params.texture_cache_size = RNA_int_get(&cscene, "texture_cache_size");
+
   params.bvh_layout = DebugFlags().cpu.bvh_layout;
 
   params.background = background;
@@ -1062,7 +1067,7 @@ SessionParams BlenderSync::get_session_params(blender::RenderEngine &b_engine,
   /* Profiling. */
   params.use_profiling = params.device.has_profiling &&
                          (b_engine.flag & blender::RE_ENGINE_PREVIEW) == 0 && background &&
-                         BlenderSession::print_render_stats;
+                         BlenderSession::need_render_stats();
 
   if (background) {
     params.use_auto_tile = true;
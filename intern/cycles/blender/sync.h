@@ -209,6 +209,9 @@ class BlenderSync {
                           bool use_particle_hair,
                           TaskPool *task_pool);
 
+  blender::ID *find_shared_curves_key(blender::ID *b_curves_id,
+                                     const array<Node *> &used_shaders);
+
   void sync_geometry_motion(BObjectInfo &b_ob_info,
                             Object *object,
                             const float motion_time,
@@ -257,6 +260,8 @@ class BlenderSync {
   set<Geometry *> geometry_motion_attribute_synced;
   /** Remember which geometries come from which objects to be able to sync them after changes. */
   map<void *, set<blender::ID *>> instance_geometries_by_object;
+  /** Curves data-blocks with identical shared data, to sync that data only once. */
+  map<string, blender::ID *> shared_curves_keys;
   set<float> motion_times;
   void *world_map;
   bool world_recalc;
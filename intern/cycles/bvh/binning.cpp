@@ -13,10 +13,15 @@
 
 #include "util/algorithm.h"
 #include "util/boundbox.h"
+#include "util/tbb.h"
 #include "util/types.h"
 
 CCL_NAMESPACE_BEGIN
 
+/* Ranges smaller than this are binned on the calling thread. */
+static const size_t BVH_BINNING_THRESHOLD = 65536;
+static const size_t BVH_BINNING_GRAIN_SIZE = 16384;
+
 /* SSE replacements */
 
 __forceinline void prefetch_L1(const void * /*ptr*/) {}
@@ -79,75 +84,33 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
   num_bins = min(size_t(MAX_BINS), size_t(4.0f + 0.05f * size()));
   scale = safe_divide(make_float3((float)num_bins), cent_bounds_.size());
 
-  /* initialize binning counter and bounds */
-  BoundBox bin_bounds[MAX_BINS][4]; /* bounds for every bin in every dimension */
-  int4 bin_count[MAX_BINS];         /* number of primitives mapped to bin */
+  /* map geometry to bins */
+  Bins bins;
+  bins_clear(bins);
 
-  for (size_t i = 0; i < num_bins; i++) {
-    bin_count[i] = make_int4(0);
-    bin_bounds[i][0] = bin_bounds[i][1] = bin_bounds[i][2] = BoundBox::empty;
+  if (size() < BVH_BINNING_THRESHOLD) {
+    bins_fill(prims, start(), end(), bins);
   }
-
-  /* map geometry to bins, unrolled once */
-  {
-    int64_t i;
-
-    for (i = 0; i < int64_t(size()) - 1; i += 2) {
-      prefetch_L2(&prims[start() + i + 8]);
-
-      /* map even and odd primitive to bin */
-      const BVHReference &prim0 = prims[start() + i + 0];
-      const BVHReference &prim1 = prims[start() + i + 1];
-
-      const BoundBox bounds0 = get_prim_bounds(prim0);
-      const BoundBox bounds1 = get_prim_bounds(prim1);
-
-      const int4 bin0 = get_bin(bounds0);
-      const int4 bin1 = get_bin(bounds1);
-
-      /* increase bounds for bins for even primitive */
-      const int b00 = (int)extract<0>(bin0);
-      bin_count[b00][0]++;
-      bin_bounds[b00][0].grow(bounds0);
-      const int b01 = (int)extract<1>(bin0);
-      bin_count[b01][1]++;
-      bin_bounds[b01][1].grow(bounds0);
-      const int b02 = (int)extract<2>(bin0);
-      bin_count[b02][2]++;
-      bin_bounds[b02][2].grow(bounds0);
-
-      /* increase bounds of bins for odd primitive */
-      const int b10 = (int)extract<0>(bin1);
-      bin_count[b10][0]++;
-      bin_bounds[b10][0].grow(bounds1);
-      const int b11 = (int)extract<1>(bin1);
-      bin_count[b11][1]++;
-      bin_bounds[b11][1].grow(bounds1);
-      const int b12 = (int)extract<2>(bin1);
-      bin_count[b12][2]++;
-      bin_bounds[b12][2].grow(bounds1);
-    }
-
-    /* for uneven number of primitives */
-    if (i < int64_t(size())) {
-      /* map primitive to bin */
-      const BVHReference &prim0 = prims[start() + i];
-      const BoundBox bounds0 = get_prim_bounds(prim0);
-      const int4 bin0 = get_bin(bounds0);
-
-      /* increase bounds of bins */
-      const int b00 = (int)extract<0>(bin0);
-      bin_count[b00][0]++;
-      bin_bounds[b00][0].grow(bounds0);
-      const int b01 = (int)extract<1>(bin0);
-      bin_count[b01][1]++;
-      bin_bounds[b01][1].grow(bounds0);
-      const int b02 = (int)extract<2>(bin0);
-      bin_count[b02][2]++;
-      bin_bounds[b02][2].grow(bounds0);
-    }
+  else {
+    /* Mostly happens for the top levels of the tree, which are built before
+     * the subtrees are distributed over threads. Merging bins is independent
+     * of the order, so the result matches the single threaded binning. */
+    bins = parallel_reduce(
+        blocked_range<size_t>(start(), end(), BVH_BINNING_GRAIN_SIZE),
+        bins,
+        [&](const blocked_range<size_t> &r, Bins local_bins) {
+          bins_fill(prims, r.begin(), r.end(), local_bins);
+          return local_bins;
+        },
+        [&](Bins a, const Bins &b) {
+          bins_merge(a, b);
+          return a;
+        });
   }
 
+  BoundBox(*bin_bounds)[4] = bins.bounds;
+  const int4 *bin_count = bins.count;
+
   /* sweep from right to left and compute parallel prefix of merged bounds */
   float4 r_area[MAX_BINS];  /* area of bounds of primitives on the right */
   float4 r_count[MAX_BINS]; /* number of primitives on the right */
@@ -209,6 +172,91 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
   leafSAH = bounds_.half_area() * blocks(size());
 }
 
+void BVHObjectBinning::bins_clear(Bins &bins) const
+{
+  for (size_t i = 0; i < num_bins; i++) {
+    bins.count[i] = make_int4(0);
+    bins.bounds[i][0] = bins.bounds[i][1] = bins.bounds[i][2] = BoundBox::empty;
+  }
+}
+
+void BVHObjectBinning::bins_merge(Bins &bins, const Bins &other) const
+{
+  for (size_t i = 0; i < num_bins; i++) {
+    bins.count[i] = bins.count[i] + other.count[i];
+    bins.bounds[i][0].grow(other.bounds[i][0]);
+    bins.bounds[i][1].grow(other.bounds[i][1]);
+    bins.bounds[i][2].grow(other.bounds[i][2]);
+  }
+}
+
+void BVHObjectBinning::bins_fill(const BVHReference *prims,
+                                 const size_t begin,
+                                 const size_t end,
+                                 Bins &bins) const
+{
+  BoundBox(*bin_bounds)[4] = bins.bounds;
+  int4 *bin_count = bins.count;
+
+  /* map geometry to bins, unrolled once */
+  int64_t i;
+
+  for (i = int64_t(begin); i < int64_t(end) - 1; i += 2) {
+    prefetch_L2(&prims[i + 8]);
+
+    /* map even and odd primitive to bin */
+    const BVHReference &prim0 = prims[i + 0];
+    const BVHReference &prim1 = prims[i + 1];
+
+    const BoundBox bounds0 = get_prim_bounds(prim0);
+    const BoundBox bounds1 = get_prim_bounds(prim1);
+
+    const int4 bin0 = get_bin(bounds0);
+    const int4 bin1 = get_bin(bounds1);
+
+    /* increase bounds for bins for even primitive */
+    const int b00 = (int)extract<0>(bin0);
+    bin_count[b00][0]++;
+    bin_bounds[b00][0].grow(bounds0);
+    const int b01 = (int)extract<1>(bin0);
+    bin_count[b01][1]++;
+    bin_bounds[b01][1].grow(bounds0);
+    const int b02 = (int)extract<2>(bin0);
+    bin_count[b02][2]++;
+    bin_bounds[b02][2].grow(bounds0);
+
+    /* increase bounds of bins for odd primitive */
+    const int b10 = (int)extract<0>(bin1);
+    bin_count[b10][0]++;
+    bin_bounds[b10][0].grow(bounds1);
+    const int b11 = (int)extract<1>(bin1);
+    bin_count[b11][1]++;
+    bin_bounds[b11][1].grow(bounds1);
+    const int b12 = (int)extract<2>(bin1);
+    bin_count[b12][2]++;
+    bin_bounds[b12][2].grow(bounds1);
+  }
+
+  /* for uneven number of primitives */
+  if (i < int64_t(end)) {
+    /* map primitive to bin */
+    const BVHReference &prim0 = prims[i];
+    const BoundBox bounds0 = get_prim_bounds(prim0);
+    const int4 bin0 = get_bin(bounds0);
+
+    /* increase bounds of bins */
+    const int b00 = (int)extract<0>(bin0);
+    bin_count[b00][0]++;
+    bin_bounds[b00][0].grow(bounds0);
+    const int b01 = (int)extract<1>(bin0);
+    bin_count[b01][1]++;
+    bin_bounds[b01][1].grow(bounds0);
+    const int b02 = (int)extract<2>(bin0);
+    bin_count[b02][2]++;
+    bin_bounds[b02][2].grow(bounds0);
+  }
+}
+
 void BVHObjectBinning::split(BVHReference *prims,
                              BVHObjectBinning &left_o,
                              BVHObjectBinning &right_o) const
@@ -16,12 +16,12 @@ CCL_NAMESPACE_BEGIN
 
 class BVHBuild;
 
-/* Single threaded object binner. Finds the split with the best SAH heuristic
- * by testing for each dimension multiple partitionings for regular spaced
- * partition locations. A partitioning for a partition location is computed,
- * by putting primitives whose centroid is on the left and right of the split
- * location to different sets. The SAH is evaluated by computing the number of
- * blocks occupied by the primitives in the partitions. */
+/* Object binner. Finds the split with the best SAH heuristic by testing for
+ * each dimension multiple partitionings for regular spaced partition locations.
+ * A partitioning for a partition location is computed, by putting primitives
+ * whose centroid is on the left and right of the split location to different
+ * sets. The SAH is evaluated by computing the number of blocks occupied by the
+ * primitives in the partitions. Large ranges are binned multithreaded. */
 
 class BVHObjectBinning : public BVHRange {
  public:
@@ -58,6 +58,19 @@ class BVHObjectBinning : public BVHRange {
   enum { MAX_BINS = 32 };
   enum { LOG_BLOCK_SIZE = 2 };
 
+  /* Number of primitives mapped to every bin, and their bounds, for every dimension. */
+  struct Bins {
+    BoundBox bounds[MAX_BINS][4];
+    int4 count[MAX_BINS];
+  };
+
+  void bins_clear(Bins &bins) const;
+  void bins_merge(Bins &bins, const Bins &other) const;
+  void bins_fill(const BVHReference *prims,
+                 const size_t begin,
+                 const size_t end,
+                 Bins &bins) const;
+
   /* computes the bin numbers for each dimension for a box. */
   __forceinline int4 get_bin(const BoundBox &box) const
   {
@@ -136,6 +136,14 @@ void BVHEmbree::build(Progress &progress,
                                                         RTC_BUILD_QUALITY_MEDIUM);
   rtcSetSceneBuildQuality(scene, build_quality);
 
+  object_attachments.clear();
+  if (params.top_level) {
+    object_attachments.reserve(objects.size());
+    for (const Object *ob : objects) {
+      object_attachments.push_back(object_attachment(ob));
+    }
+  }
+
   int i = 0;
   for (Object *ob : objects) {
     if (params.top_level) {
@@ -244,6 +252,19 @@ void BVHEmbree::add_object(Object *ob, const int i)
 }
 
 void BVHEmbree::add_instance(Object *ob, const int i)
+{
+  RTCGeometry geom_id = rtcNewGeometry(rtc_device, RTC_GEOMETRY_TYPE_INSTANCE);
+  set_instance(geom_id, ob);
+
+  rtcSetGeometryMask(geom_id, ob->visibility_for_tracing());
+  rtcSetGeometryEnableFilterFunctionFromArguments(geom_id, true);
+
+  rtcCommitGeometry(geom_id);
+  rtcAttachGeometryByID(scene, geom_id, i * 2);
+  rtcReleaseGeometry(geom_id);
+}
+
+void BVHEmbree::set_instance(RTCGeometry geom_id, const Object *ob)
 {
   BVHEmbree *instance_bvh = static_cast<BVHEmbree *>(ob->get_geometry()->bvh.get());
   assert(instance_bvh != nullptr);
@@ -252,7 +273,6 @@ void BVHEmbree::add_instance(Object *ob, const int i)
   const size_t num_motion_steps = min(num_object_motion_steps, (size_t)RTC_MAX_TIME_STEP_COUNT);
   assert(num_object_motion_steps <= RTC_MAX_TIME_STEP_COUNT);
 
-  RTCGeometry geom_id = rtcNewGeometry(rtc_device, RTC_GEOMETRY_TYPE_INSTANCE);
   rtcSetGeometryInstancedScene(geom_id, instance_bvh->scene);
   rtcSetGeometryTimeStepCount(geom_id, num_motion_steps);
 
@@ -285,13 +305,6 @@ void BVHEmbree::add_instance(Object *ob, const int i)
                          (void *)instance_bvh->scene
 #  endif
   );
-
-  rtcSetGeometryMask(geom_id, ob->visibility_for_tracing());
-  rtcSetGeometryEnableFilterFunctionFromArguments(geom_id, true);
-
-  rtcCommitGeometry(geom_id);
-  rtcAttachGeometryByID(scene, geom_id, i * 2);
-  rtcReleaseGeometry(geom_id);
 }
 
 void BVHEmbree::add_triangles(const Object *ob, const Mesh *mesh, const int i)
@@ -750,6 +763,34 @@ void BVHEmbree::add_curves(const Object *ob, const Hair *hair, const int i)
   rtcReleaseGeometry(geom_id);
 }
 
+BVHEmbree::ObjectAttachment BVHEmbree::object_attachment(const Object *ob)
+{
+  if (!ob->is_traceable()) {
+    return OBJECT_ATTACHMENT_NONE;
+  }
+  return ob->get_geometry()->is_instanced() ? OBJECT_ATTACHMENT_INSTANCE :
+                                              OBJECT_ATTACHMENT_GEOMETRY;
+}
+
+bool BVHEmbree::can_refit() const
+{
+  if (scene == nullptr) {
+    return false;
+  }
+  if (!params.top_level) {
+    return true;
+  }
+  if (objects.size() != object_attachments.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < objects.size(); i++) {
+    if (object_attachment(objects[i]) != object_attachments[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void BVHEmbree::refit(Progress &progress)
 {
   progress.set_substatus("Refitting BVH nodes");
@@ -757,7 +798,13 @@ void BVHEmbree::refit(Progress &progress)
   /* Update all vertex buffers, then tell Embree to rebuild/-fit the BVHs. */
   unsigned geom_id = 0;
   for (Object *ob : objects) {
-    if (!params.top_level || (ob->is_traceable() && !ob->get_geometry()->is_instanced())) {
+    if (params.top_level && ob->is_traceable() && ob->get_geometry()->is_instanced()) {
+      /* The instanced BVH might have been refit, and the object transform changed. */
+      RTCGeometry geom = rtcGetGeometry(scene, geom_id);
+      set_instance(geom, ob);
+      rtcCommitGeometry(geom);
+    }
+    else if (!params.top_level || ob->is_traceable()) {
       Geometry *geom = ob->get_geometry();
 
       if (geom->is_mesh() || geom->is_volume()) {
@@ -765,6 +812,8 @@ void BVHEmbree::refit(Progress &progress)
         if (mesh->num_triangles() > 0) {
           RTCGeometry geom = rtcGetGeometry(scene, geom_id);
           set_tri_vertex_buffer(geom, mesh, true);
+          /* Topology is unchanged, so refitting the existing BVH is enough. */
+          rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
           rtcSetGeometryUserData(geom, (void *)mesh->prim_offset);
           rtcCommitGeometry(geom);
         }
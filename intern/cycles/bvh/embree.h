@@ -27,6 +27,9 @@ class BVHEmbree : public BVH {
              RTCDevice rtc_device,
              const bool rtc_device_is_sycl_ = false);
   void refit(Progress &progress);
+  /* Whether the same objects are attached to the scene as in the last build, so that the BVH
+   * can be refit instead of rebuilt. */
+  bool can_refit() const;
 
 #  if defined(WITH_EMBREE_GPU) && RTC_VERSION >= 40302
   RTCError offload_scenes_to_gpu(const vector<RTCScene> &scenes);
@@ -49,6 +52,7 @@ class BVHEmbree : public BVH {
   void add_triangles(const Object *ob, const Mesh *mesh, const int i);
 
  private:
+  void set_instance(RTCGeometry geom_id, const Object *ob);
   void set_tri_vertex_buffer(RTCGeometry geom_id, const Mesh *mesh, const bool update);
   void set_curve_vertex_buffer(RTCGeometry geom_id, const Hair *hair, const bool update);
   void set_point_vertex_buffer(RTCGeometry geom_id,
@@ -58,6 +62,15 @@ class BVHEmbree : public BVH {
   RTCDevice rtc_device;
   bool rtc_device_is_sycl;
   enum RTCBuildQuality build_quality;
+
+  /* How every object was attached to the top level scene in the last build. */
+  enum ObjectAttachment : uint8_t {
+    OBJECT_ATTACHMENT_NONE,
+    OBJECT_ATTACHMENT_GEOMETRY,
+    OBJECT_ATTACHMENT_INSTANCE,
+  };
+  static ObjectAttachment object_attachment(const Object *ob);
+  vector<ObjectAttachment> object_attachments;
 };
 
 CCL_NAMESPACE_END
@@ -16,9 +16,13 @@
 #include "scene/pointcloud.h"
 
 #include "util/algorithm.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
+/* Ranges smaller than this are chopped into spatial bins on the calling thread. */
+static const int BVH_SPATIAL_BINNING_THRESHOLD = 16384;
+
 /* Object Split */
 
 BVHObjectSplit::BVHObjectSplit(BVHBuild *builder,
@@ -155,46 +159,53 @@ BVHSpatialSplit::BVHSpatialSplit(const BVHBuild &builder,
   float3 binSize = (range_bounds.max - origin) * (1.0f / (float)BVHParams::NUM_SPATIAL_BINS);
   const float3 invBinSize = safe_divide(make_float3(1.0f), binSize);
 
-  for (int dim = 0; dim < 3; dim++) {
+  /* chop references into bins, every dimension is binned independently. */
+  auto bin_references = [&](const int dim) {
+    BVHSpatialBin *bins = storage_->bins[dim];
     for (int i = 0; i < BVHParams::NUM_SPATIAL_BINS; i++) {
-      BVHSpatialBin &bin = storage_->bins[dim][i];
-
-      bin.bounds = BoundBox::empty;
-      bin.enter = 0;
-      bin.exit = 0;
+      bins[i].bounds = BoundBox::empty;
+      bins[i].enter = 0;
+      bins[i].exit = 0;
     }
-  }
-
-  /* chop references into bins. */
-  for (unsigned int refIdx = range.start(); refIdx < range.end(); refIdx++) {
-    const BVHReference &ref = references_->at(refIdx);
-    const BoundBox prim_bounds = get_prim_bounds(ref);
-    const float3 firstBinf = (prim_bounds.min - origin) * invBinSize;
-    const float3 lastBinf = (prim_bounds.max - origin) * invBinSize;
-    int3 firstBin = make_int3((int)firstBinf.x, (int)firstBinf.y, (int)firstBinf.z);
-    int3 lastBin = make_int3((int)lastBinf.x, (int)lastBinf.y, (int)lastBinf.z);
 
-    firstBin = clamp(firstBin, 0, BVHParams::NUM_SPATIAL_BINS - 1);
-    lastBin = clamp(lastBin, firstBin, BVHParams::NUM_SPATIAL_BINS - 1);
+    for (unsigned int refIdx = range.start(); refIdx < range.end(); refIdx++) {
+      const BVHReference &ref = references_->at(refIdx);
+      const BoundBox prim_bounds = get_prim_bounds(ref);
+      const int firstBin = clamp(int((prim_bounds.min[dim] - origin[dim]) * invBinSize[dim]),
+                                 0,
+                                 BVHParams::NUM_SPATIAL_BINS - 1);
+      const int lastBin = clamp(int((prim_bounds.max[dim] - origin[dim]) * invBinSize[dim]),
+                                firstBin,
+                                BVHParams::NUM_SPATIAL_BINS - 1);
 
-    for (int dim = 0; dim < 3; dim++) {
-      BVHReference currRef(
-          get_prim_bounds(ref), ref.prim_index(), ref.prim_object(), ref.prim_type());
+      BVHReference currRef(prim_bounds, ref.prim_index(), ref.prim_object(), ref.prim_type());
 
-      for (int i = firstBin[dim]; i < lastBin[dim]; i++) {
+      for (int i = firstBin; i < lastBin; i++) {
         BVHReference leftRef;
         BVHReference rightRef;
 
         split_reference(
             builder, leftRef, rightRef, currRef, dim, origin[dim] + binSize[dim] * (float)(i + 1));
-        storage_->bins[dim][i].bounds.grow(leftRef.bounds());
+        bins[i].bounds.grow(leftRef.bounds());
         currRef = rightRef;
       }
 
-      storage_->bins[dim][lastBin[dim]].bounds.grow(currRef.bounds());
-      storage_->bins[dim][firstBin[dim]].enter++;
-      storage_->bins[dim][lastBin[dim]].exit++;
+      bins[lastBin].bounds.grow(currRef.bounds());
+      bins[firstBin].enter++;
+      bins[lastBin].exit++;
     }
+  };
+
+  if (range.size() < BVH_SPATIAL_BINNING_THRESHOLD) {
+    for (int dim = 0; dim < 3; dim++) {
+      bin_references(dim);
+    }
+  }
+  else {
+    /* Large ranges mostly happen at the top levels of the tree, before subtrees are distributed
+     * over threads. Isolate the work, so that waiting for it does not pick up other build tasks
+     * that use the spatial storage of this thread. */
+    tbb::this_task_arena::isolate([&] { parallel_for(0, 3, bin_references); });
   }
 
   /* select best split plane. */
@@ -790,11 +790,20 @@ void PathTrace::rebalance(const RenderWork &render_work)
   const double start_time = time_dt();
 
   if (LOG_IS_ON(LOG_LEVEL_DEBUG)) {
+    /* Utilization is the fraction of time a device was busy while the slowest device was still
+     * rendering, idle devices indicate that the balance is not optimal. */
+    double max_time_spent = 0.0;
+    for (const WorkBalanceInfo &balance_info : work_balance_infos_) {
+      max_time_spent = max(max_time_spent, balance_info.time_spent);
+    }
+
     LOG_DEBUG << "Perform rebalance work.";
-    LOG_DEBUG << "Per-device path tracing time (seconds):";
+    LOG_DEBUG << "Per-device path tracing time (seconds) and utilization:";
     for (int i = 0; i < num_works; ++i) {
-      LOG_DEBUG << path_trace_works_[i]->get_device()->info.description << ": "
-                << work_balance_infos_[i].time_spent;
+      const double time_spent = work_balance_infos_[i].time_spent;
+      LOG_DEBUG << path_trace_works_[i]->get_device()->info.description << ": " << time_spent
+                << ", " << (max_time_spent > 0.0 ? time_spent / max_time_spent * 100.0 : 100.0)
+                << "%";
     }
   }
 
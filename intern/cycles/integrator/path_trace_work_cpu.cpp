@@ -4,6 +4,8 @@
 
 #include "integrator/path_trace_work_cpu.h"
 
+#include <algorithm>
+
 #include "device/cpu/kernel.h"
 #include "device/device.h"
 
@@ -67,7 +69,6 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 {
   const int64_t image_width = effective_buffer_params_.width;
   const int64_t image_height = effective_buffer_params_.height;
-  const int64_t total_pixels_num = image_width * image_height;
 
   if (device_->profiler.active()) {
     for (ThreadKernelGlobalsCPU &kernel_globals : kernel_thread_globals_) {
@@ -75,21 +76,30 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
     }
   }
 
+  /* Pixels are scheduled in small square blocks, so that paths traced one after another by a
+   * thread start from neighbouring pixels and tend to visit the same BVH nodes, shaders and
+   * textures, which stay in the CPU caches. */
+  const int64_t blocks_x = divide_up(image_width, CPU_WORK_BLOCK_SIZE);
+  const int64_t blocks_y = divide_up(image_height, CPU_WORK_BLOCK_SIZE);
+  const int64_t total_blocks_num = blocks_x * blocks_y;
+
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
+    parallel_for(int64_t(0), total_blocks_num, [&](int64_t work_index) {
       if (is_cancel_requested()) {
         return;
       }
 
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
+      const int block_y = work_index / blocks_x;
+      const int block_x = work_index - block_y * blocks_x;
+      const int x = block_x * CPU_WORK_BLOCK_SIZE;
+      const int y = block_y * CPU_WORK_BLOCK_SIZE;
 
       KernelWorkTile work_tile;
       work_tile.x = effective_buffer_params_.full_x + x;
       work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
+      work_tile.w = min(CPU_WORK_BLOCK_SIZE, int(image_width - x));
+      work_tile.h = min(CPU_WORK_BLOCK_SIZE, int(image_height - y));
       work_tile.start_sample = start_sample;
       work_tile.sample_offset = sample_offset;
       work_tile.num_samples = 1;
@@ -126,66 +136,91 @@ void PathTraceWorkCPU::render_samples_full_pipeline(ThreadKernelGlobalsCPU *kern
     path_state_init_queues(shadow_catcher_state);
   }
 
+  /* Pixels of the block which still need samples. A pixel is done once it is converged or has no
+   * more bake data, and it is then skipped for the remaining samples. */
+  const int pixels_num = work_tile.w * work_tile.h;
+  DCHECK_LE(pixels_num, CPU_WORK_BLOCK_SIZE * CPU_WORK_BLOCK_SIZE);
+  bool pixel_active[CPU_WORK_BLOCK_SIZE * CPU_WORK_BLOCK_SIZE];
+  std::fill_n(pixel_active, pixels_num, true);
+  int active_pixels_num = pixels_num;
+
   KernelWorkTile sample_work_tile = work_tile;
+  sample_work_tile.w = 1;
+  sample_work_tile.h = 1;
   float *render_buffer = buffers_->buffer.data();
 
   fast_timer render_timer;
 
-  for (int sample = 0; sample < samples_num; ++sample) {
-    if (is_cancel_requested()) {
-      break;
-    }
+  /* Samples are interleaved between the pixels of the block, so that consecutive paths use the
+   * same sample index and are more coherent than all samples of a single pixel. */
+  for (int sample = 0; sample < samples_num && active_pixels_num; ++sample) {
+    for (int pixel = 0; pixel < pixels_num; ++pixel) {
+      if (!pixel_active[pixel]) {
+        continue;
+      }
 
-    if (has_bake) {
-      if (!kernels_.integrator_init_from_bake(
-              kernel_globals, state, &sample_work_tile, render_buffer))
-      {
-        break;
+      if (is_cancel_requested()) {
+        return;
       }
-    }
-    else {
-      if (!kernels_.integrator_init_from_camera(
-              kernel_globals, state, &sample_work_tile, render_buffer))
-      {
-        break;
+
+      sample_work_tile.x = work_tile.x + pixel % work_tile.w;
+      sample_work_tile.y = work_tile.y + pixel / work_tile.w;
+      sample_work_tile.start_sample = work_tile.start_sample + sample;
+
+      if (has_bake) {
+        if (!kernels_.integrator_init_from_bake(
+                kernel_globals, state, &sample_work_tile, render_buffer))
+        {
+          pixel_active[pixel] = false;
+          --active_pixels_num;
+          continue;
+        }
+      }
+      else {
+        if (!kernels_.integrator_init_from_camera(
+                kernel_globals, state, &sample_work_tile, render_buffer))
+        {
+          pixel_active[pixel] = false;
+          --active_pixels_num;
+          continue;
+        }
       }
-    }
 
 #if defined(WITH_PATH_GUIDING)
-    if (kernel_globals->data.integrator.train_guiding) {
-      assert(kernel_globals->opgl_path_segment_storage);
-      assert(kernel_globals->opgl_path_segment_storage->GetNumSegments() == 0);
+      if (kernel_globals->data.integrator.train_guiding) {
+        assert(kernel_globals->opgl_path_segment_storage);
+        assert(kernel_globals->opgl_path_segment_storage->GetNumSegments() == 0);
 
-      kernels_.integrator_megakernel(kernel_globals, state, render_buffer);
+        kernels_.integrator_megakernel(kernel_globals, state, render_buffer);
 
-      /* Push the generated sample data to the global sample data storage. */
-      guiding_push_sample_data_to_global_storage(kernel_globals, state, render_buffer);
+        /* Push the generated sample data to the global sample data storage. */
+        guiding_push_sample_data_to_global_storage(kernel_globals, state, render_buffer);
 
-      /* No training for shadow catcher paths. */
-      if (shadow_catcher_state) {
-        kernel_globals->data.integrator.train_guiding = false;
-        kernels_.integrator_megakernel(kernel_globals, shadow_catcher_state, render_buffer);
-        kernel_globals->data.integrator.train_guiding = true;
+        /* No training for shadow catcher paths. */
+        if (shadow_catcher_state) {
+          kernel_globals->data.integrator.train_guiding = false;
+          kernels_.integrator_megakernel(kernel_globals, shadow_catcher_state, render_buffer);
+          kernel_globals->data.integrator.train_guiding = true;
+        }
       }
-    }
-    else
+      else
 #endif
-    {
-      kernels_.integrator_megakernel(kernel_globals, state, render_buffer);
-      if (shadow_catcher_state) {
-        kernels_.integrator_megakernel(kernel_globals, shadow_catcher_state, render_buffer);
+      {
+        kernels_.integrator_megakernel(kernel_globals, state, render_buffer);
+        if (shadow_catcher_state) {
+          kernels_.integrator_megakernel(kernel_globals, shadow_catcher_state, render_buffer);
+        }
       }
-    }
 
-    if (kernel_globals->data.film.pass_render_time != PASS_UNUSED) {
-      uint64_t time;
-      if (render_timer.lap(time)) {
-        ccl_global float *buffer = render_buffer + (uint64_t)state->path.render_pixel_index *
-                                                       kernel_globals->data.film.pass_stride;
-        *(buffer + kernel_globals->data.film.pass_render_time) += float(time);
+      if (kernel_globals->data.film.pass_render_time != PASS_UNUSED) {
+        uint64_t time;
+        if (render_timer.lap(time)) {
+          ccl_global float *buffer = render_buffer + (uint64_t)state->path.render_pixel_index *
+                                                         kernel_globals->data.film.pass_stride;
+          *(buffer + kernel_globals->data.film.pass_render_time) += float(time);
+        }
       }
     }
-    ++sample_work_tile.start_sample;
   }
 }
 
@@ -70,7 +70,11 @@ class PathTraceWorkCPU : public PathTraceWork {
 #endif
 
  protected:
-  /* Core path tracing routine. Renders given work time on the given queue. */
+  /* Size in pixels of the square blocks of pixels rendered by a single task. */
+  static constexpr int CPU_WORK_BLOCK_SIZE = 4;
+
+  /* Core path tracing routine. Renders all samples of the given block of pixels, interleaving
+   * the samples between the pixels. */
   void render_samples_full_pipeline(ThreadKernelGlobalsCPU *kernel_globals,
                                     const KernelWorkTile &work_tile,
                                     const int samples_num);
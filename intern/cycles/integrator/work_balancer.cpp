@@ -27,46 +27,62 @@ void work_balance_do_initial(vector<WorkBalanceInfo> &work_balance_infos)
   }
 }
 
-static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_infos)
-{
-  double total_time = 0;
-  for (const WorkBalanceInfo &info : work_balance_infos) {
-    total_time += info.time_spent;
-  }
-  return total_time;
-}
-
-/* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+/* The balance is based on the throughput of the devices: the amount of work that a device
+ * performed per unit of time since the last rebalance. Giving every device a share of the work
+ * proportional to its throughput makes all devices finish at the same time, without waiting for
+ * the slowest one.
+ *
+ * The throughput is smoothed with an exponential moving average, so that noise in the timing of a
+ * single measurement does not cause the work to be redistributed back and forth, while changes
+ * in the speed of a device (like a GPU which lowers its clock when getting hot) are followed. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
+  /* Weight of the latest measurement in the moving average of the throughput. */
+  static const double kThroughputAverageFactor = 0.5;
+
   const int num_infos = work_balance_infos.size();
 
-  const double total_time = calculate_total_time(work_balance_infos);
-  const double time_average = total_time / num_infos;
+  /* All works render the same number of samples, so a relative throughput of the devices is
+   * known from the fraction of the image they rendered and the time this took. */
+  double total_throughput = 0;
+  vector<double> throughputs;
+  throughputs.reserve(num_infos);
+
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    if (info.time_spent <= 0.0) {
+      /* No statistics for a device yet, keep the balance as-is. */
+      return false;
+    }
+    const double throughput = info.weight / info.time_spent;
+    throughputs.push_back(throughput);
+    total_throughput += throughput;
+  }
 
   double total_weight = 0;
   vector<double> new_weights;
   new_weights.reserve(num_infos);
 
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
+  for (int i = 0; i < num_infos; ++i) {
+    WorkBalanceInfo &info = work_balance_infos[i];
+    const double throughput_fraction = throughputs[i] / total_throughput;
+    if (info.throughput_fraction == 0.0) {
+      info.throughput_fraction = throughput_fraction;
+    }
+    else {
+      info.throughput_fraction = mix(
+          info.throughput_fraction, throughput_fraction, kThroughputAverageFactor);
+    }
+    new_weights.push_back(info.throughput_fraction);
+    total_weight += info.throughput_fraction;
+  }
 
+  const double total_weight_inv = 1.0 / total_weight;
   bool has_big_difference = false;
 
-  for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = mix(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
-    new_weights.push_back(new_weight);
-    total_weight += new_weight;
-
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+  for (int i = 0; i < num_infos; ++i) {
+    new_weights[i] *= total_weight_inv;
+    if (std::fabs(1.0 - new_weights[i] / work_balance_infos[i].weight) > 0.02) {
       has_big_difference = true;
     }
   }
@@ -75,10 +91,9 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
     return false;
   }
 
-  const double total_weight_inv = 1.0 / total_weight;
   for (int i = 0; i < num_infos; ++i) {
     WorkBalanceInfo &info = work_balance_infos[i];
-    info.weight = new_weights[i] * total_weight_inv;
+    info.weight = new_weights[i];
     info.time_spent = 0;
   }
 
@@ -18,12 +18,17 @@ struct WorkBalanceInfo {
   /* Normalized weight, which is ready to be used for work balancing (like calculating fraction of
    * the big tile which is to be rendered on the device). */
   double weight = 1.0;
+
+  /* Moving average of the fraction of the total throughput of all devices which this device
+   * provides. Zero until the first rebalance. */
+  double throughput_fraction = 0.0;
 };
 
 /* Balance work for an initial render integration, before any statistics is known. */
 void work_balance_do_initial(vector<WorkBalanceInfo> &work_balance_infos);
 
-/* Rebalance work after statistics has been accumulated.
+/* Rebalance work after statistics has been accumulated, so that all devices are expected to
+ * finish their work at the same time based on their measured throughput.
  * Returns true if the balancing did change. */
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos);
 
@@ -4,18 +4,13 @@
 
 #pragma once
 
+#include "kernel/svm/math_util.h"
 #include "kernel/svm/util.h"
 
 CCL_NAMESPACE_BEGIN
 
 /* Map Range Node */
 
-ccl_device_inline float smootherstep(const float edge0, const float edge1, float x)
-{
-  x = clamp(safe_divide((x - edge0), (edge1 - edge0)), 0.0f, 1.0f);
-  return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f);
-}
-
 ccl_device_noinline int svm_node_map_range(KernelGlobals kg,
                                            ccl_private float *stack,
                                            const uint value_stack_offset,
@@ -48,36 +43,8 @@ ccl_device_noinline int svm_node_map_range(KernelGlobals kg,
   const float to_max = stack_load_float_default(stack, to_max_stack_offset, defaults.w);
   const float steps = stack_load_float_default(stack, steps_stack_offset, defaults2.x);
 
-  float result;
-
-  if (from_max != from_min) {
-    float factor = value;
-    switch (type_stack_offset) {
-      default:
-      case NODE_MAP_RANGE_LINEAR:
-        factor = (value - from_min) / (from_max - from_min);
-        break;
-      case NODE_MAP_RANGE_STEPPED: {
-        factor = (value - from_min) / (from_max - from_min);
-        factor = (steps > 0.0f) ? floorf(factor * (steps + 1.0f)) / steps : 0.0f;
-        break;
-      }
-      case NODE_MAP_RANGE_SMOOTHSTEP: {
-        factor = (from_min > from_max) ? 1.0f - smoothstep(from_max, from_min, factor) :
-                                         smoothstep(from_min, from_max, factor);
-        break;
-      }
-      case NODE_MAP_RANGE_SMOOTHERSTEP: {
-        factor = (from_min > from_max) ? 1.0f - smootherstep(from_max, from_min, factor) :
-                                         smootherstep(from_min, from_max, factor);
-        break;
-      }
-    }
-    result = to_min + factor * (to_max - to_min);
-  }
-  else {
-    result = 0.0f;
-  }
+  const float result = svm_map_range(
+      (NodeMapRangeType)type_stack_offset, value, from_min, from_max, to_min, to_max, steps);
   stack_store_float(stack, result_stack_offset, result);
   return offset;
 }
@@ -278,4 +278,47 @@ ccl_device float3 svm_math_wavelength_color_xyz(const float lambda_nm)
   return color;
 }
 
+ccl_device_inline float smootherstep(const float edge0, const float edge1, float x)
+{
+  x = clamp(safe_divide((x - edge0), (edge1 - edge0)), 0.0f, 1.0f);
+  return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f);
+}
+
+ccl_device float svm_map_range(const NodeMapRangeType type,
+                               const float value,
+                               const float from_min,
+                               const float from_max,
+                               const float to_min,
+                               const float to_max,
+                               const float steps)
+{
+  if (from_max == from_min) {
+    return 0.0f;
+  }
+
+  float factor = value;
+  switch (type) {
+    default:
+    case NODE_MAP_RANGE_LINEAR:
+      factor = (value - from_min) / (from_max - from_min);
+      break;
+    case NODE_MAP_RANGE_STEPPED: {
+      factor = (value - from_min) / (from_max - from_min);
+      factor = (steps > 0.0f) ? floorf(factor * (steps + 1.0f)) / steps : 0.0f;
+      break;
+    }
+    case NODE_MAP_RANGE_SMOOTHSTEP: {
+      factor = (from_min > from_max) ? 1.0f - smoothstep(from_max, from_min, factor) :
+                                       smoothstep(from_min, from_max, factor);
+      break;
+    }
+    case NODE_MAP_RANGE_SMOOTHERSTEP: {
+      factor = (from_min > from_max) ? 1.0f - smootherstep(from_max, from_min, factor) :
+                                       smootherstep(from_min, from_max, factor);
+      break;
+    }
+  }
+  return to_min + factor * (to_max - to_min);
+}
+
 CCL_NAMESPACE_END
@@ -500,6 +500,44 @@ void ConstantFolder::fold_math(NodeMathType type) const
   }
 }
 
+void ConstantFolder::fold_map_range(NodeMapRangeType type) const
+{
+  ShaderInput *value_in = node->input("Value");
+  ShaderInput *from_min_in = node->input("From Min");
+  ShaderInput *from_max_in = node->input("From Max");
+  ShaderInput *to_min_in = node->input("To Min");
+  ShaderInput *to_max_in = node->input("To Max");
+
+  if (from_min_in->link || from_max_in->link) {
+    return;
+  }
+
+  const float from_min = node->get_float(from_min_in->socket_type);
+  const float from_max = node->get_float(from_max_in->socket_type);
+
+  /* An empty source range always maps to zero. */
+  if (from_min == from_max) {
+    make_zero();
+    return;
+  }
+
+  if (type != NODE_MAP_RANGE_LINEAR || to_min_in->link || to_max_in->link) {
+    return;
+  }
+
+  const float to_min = node->get_float(to_min_in->socket_type);
+  const float to_max = node->get_float(to_max_in->socket_type);
+
+  /* Mapping a range onto itself is the identity. */
+  if (from_min == to_min && from_max == to_max) {
+    try_bypass_or_make_constant(value_in);
+  }
+  /* Mapping onto an empty range is a constant. */
+  else if (to_min == to_max) {
+    make_constant(to_min);
+  }
+}
+
 void ConstantFolder::fold_vector_math(NodeVectorMathType type) const
 {
   ShaderInput *vector1_in = node->input("Vector1");
@@ -57,6 +57,7 @@ class ConstantFolder {
   void fold_math(NodeMathType type) const;
   void fold_vector_math(NodeVectorMathType type) const;
   void fold_mapping(NodeMappingType type) const;
+  void fold_map_range(NodeMapRangeType type) const;
 };
 
 CCL_NAMESPACE_END
@@ -481,6 +481,14 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
       else if (mesh->is_modified()) {
         device_update_flags |= DEVICE_MESH_DATA_MODIFIED;
       }
+
+      if (mesh->is_modified()) {
+        const bool use_device_vertex_normals = mesh->need_device_vertex_normals();
+        if (mesh->use_device_vertex_normals != use_device_vertex_normals) {
+          mesh->use_device_vertex_normals = use_device_vertex_normals;
+          device_update_flags |= ATTRS_NEED_REALLOC;
+        }
+      }
     }
 
     if (geom->is_pointcloud()) {
@@ -472,6 +472,11 @@ void GeometryManager::device_update_attributes(Device *device,
       switch (attr.std) {
         case ATTR_STD_VERTEX_NORMAL:
         case ATTR_STD_MOTION_VERTEX_NORMAL:
+          /* Shaders can still request vertex normals explicitly. */
+          if (!geom->is_mesh() || static_cast<Mesh *>(geom)->use_device_vertex_normals) {
+            geom_attributes[i].add(attr.std);
+          }
+          break;
         case ATTR_STD_CORNER_NORMAL:
         case ATTR_STD_MOTION_CORNER_NORMAL:
         case ATTR_STD_SHADOW_TRANSPARENCY:
@@ -115,9 +115,15 @@ void GeometryManager::device_update_bvh(Device *device,
 
   LOG_INFO << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
+  /* The scene BVH is freed when the topology of any geometry changes, so for Embree an existing
+   * BVH only needs to be refit when geometry was deformed or objects were moved. The device
+   * still falls back to a full build when objects were attached differently. */
+  const bool can_refit_embree = bparams.bvh_layout == BVHLayout::BVH_LAYOUT_EMBREE &&
+                                (update_flags & VISIBILITY_MODIFIED) == 0 &&
+                                scene->need_motion() != Scene::MOTION_BLUR;
   const bool can_refit = scene->bvh != nullptr && scene->params.bvh_type == BVH_TYPE_DYNAMIC &&
                          (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
-                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL);
+                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL || can_refit_embree);
 
   BVH *bvh = scene->bvh.get();
   if (bvh == nullptr) {
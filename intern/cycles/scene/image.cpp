@@ -797,8 +797,9 @@ void ImageManager::collect_statistics(RenderStats *stats)
       /* Image may have been freed due to lack of users. */
       continue;
     }
-    stats->image.textures.add_entry(
-        NamedSizeEntry(image->loader->name(), image->mem->memory_size()));
+    NamedSizeStats &image_stats = is_nanovdb_type(image->metadata.type) ? stats->image.volumes :
+                                                                            stats->image.textures;
+    image_stats.add_entry(NamedSizeEntry(image->loader->name(), image->mem->memory_size()));
   }
 }
 
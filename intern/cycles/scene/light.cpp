@@ -235,6 +235,8 @@ LightManager::LightManager()
   last_background_resolution = 0;
 }
 
+LightManager::~LightManager() = default;
+
 bool LightManager::has_background_light(Scene *scene)
 {
   for (Object *object : scene->objects) {
@@ -623,6 +625,8 @@ static void light_tree_leaf_emitters_copy_and_flatten(LightTreeFlatten &flatten,
            */
           std::swap(instance_node->type, reference_node->type);
           std::swap(instance_node->variant_type, reference_node->variant_type);
+          /* Keep the tree valid for flattening it again after a refit. */
+          reference_node->get_instance().reference = instance_node;
         }
         instance_node->type &= ~LIGHT_TREE_INSTANCE;
       }
@@ -637,7 +641,7 @@ static void light_tree_leaf_emitters_copy_and_flatten(LightTreeFlatten &flatten,
         kinstance_node.instance.reference = map_it->second;
       }
       else {
-        flatten.instances[reference_node] = kemitter.mesh.node_id;
+        flatten.instances[instance_node] = kemitter.mesh.node_id;
       }
     }
     kemitter.bit_trail = node.bit_trail;
@@ -828,49 +832,78 @@ void LightManager::device_update_tree(Device * /*unused*/,
   KernelIntegrator *kintegrator = &dscene->data.integrator;
 
   if (!kintegrator->use_light_tree) {
+    light_tree.reset();
+    light_tree_lights.clear();
     return;
   }
 
   /* Update light tree. */
   progress.set_status("Updating Lights", "Computing tree");
 
-  /* TODO: For now, we'll start with a smaller number of max lights in a node.
-   * More benchmarking is needed to determine what number works best. */
-  LightTree light_tree(scene, dscene, progress, 8);
-  LightTreeNode *root = light_tree.build(scene, dscene);
+  vector<std::pair<const Light *, LightType>> enabled_lights;
+  for (const Object *object : scene->objects) {
+    if (object->get_geometry()->is_light()) {
+      const Light *light = static_cast<const Light *>(object->get_geometry());
+      if (light->is_enabled) {
+        enabled_lights.emplace_back(light, light->get_light_type());
+      }
+    }
+  }
+
+  /* When only settings of the same lights changed, the emissive meshes and the structure of the
+   * tree are still valid, and only the measures of the lights need to be updated. Specialized
+   * light linking trees store node indices of the previous flattening, so those are rebuilt. */
+  const bool can_refit = light_tree && (update_flags & ~LIGHT_MODIFIED) == 0 &&
+                         light_tree->light_link_receiver_used == 1 &&
+                         light_tree_lights == enabled_lights;
+
+  LightTreeNode *root;
+  if (can_refit) {
+    light_tree->refit_lights(scene, dscene);
+    root = light_tree->get_root();
+  }
+  else {
+    /* TODO: For now, we'll start with a smaller number of max lights in a node.
+     * More benchmarking is needed to determine what number works best. */
+    light_tree = make_unique<LightTree>(scene, dscene, progress, 8);
+    light_tree_lights = std::move(enabled_lights);
+    root = light_tree->build(scene, dscene);
+  }
   if (progress.get_cancel()) {
+    light_tree.reset();
+    light_tree_lights.clear();
     return;
   }
 
   /* Create arguments for recursive tree flatten. */
   LightTreeFlatten flatten;
   flatten.scene = scene;
-  flatten.emitters = light_tree.get_emitters();
+  flatten.emitters = light_tree->get_emitters();
   flatten.object_lookup_offset = dscene->object_lookup_offset.data();
   /* We want to create separate arrays corresponding to triangles and lights,
    * which will be used to index back into the light tree for PDF calculations. */
   flatten.light_array = dscene->light_to_tree.alloc(kintegrator->num_lights);
   flatten.mesh_array = dscene->object_to_tree.alloc(scene->objects.size());
-  flatten.triangle_array = dscene->triangle_to_tree.alloc(light_tree.num_triangles);
+  flatten.triangle_array = dscene->triangle_to_tree.alloc(light_tree->num_triangles);
 
   /* Allocate emitters */
-  const size_t num_emitters = light_tree.num_emitters();
+  const size_t num_emitters = light_tree->num_emitters();
   KernelLightTreeEmitter *kemitters = dscene->light_tree_emitters.alloc(num_emitters);
 
   /* Update integrator state. */
   kintegrator->use_direct_light = num_emitters > 0;
 
   /* Test if light linking is used. */
-  const bool use_light_linking = root && (light_tree.light_link_receiver_used != 1);
+  const bool use_light_linking = root && (light_tree->light_link_receiver_used != 1);
   KernelLightLinkSet *klight_link_sets = dscene->data.light_link_sets;
   memset(klight_link_sets, 0, sizeof(dscene->data.light_link_sets));
 
-  LOG_INFO << "Use light tree with " << num_emitters << " emitters and " << light_tree.num_nodes
+  LOG_INFO << "Use light tree with " << num_emitters << " emitters and " << light_tree->num_nodes
            << " nodes.";
 
   if (!use_light_linking) {
     /* Regular light tree without linking. */
-    KernelLightTreeNode *knodes = dscene->light_tree_nodes.alloc(light_tree.num_nodes);
+    KernelLightTreeNode *knodes = dscene->light_tree_nodes.alloc(light_tree->num_nodes);
 
     if (root) {
       int next_node_index = 0;
@@ -886,7 +919,7 @@ void LightManager::device_update_tree(Device * /*unused*/,
     if (root) {
       /* Reserve enough size of all instance subtrees, then shrink back to
        * actual number of nodes used. */
-      light_link_nodes.resize(light_tree.num_nodes);
+      light_link_nodes.resize(light_tree->num_nodes);
       light_tree_emitters_copy_and_flatten(
           flatten, root, light_link_nodes.data(), kemitters, next_node_index);
       light_link_nodes.resize(next_node_index);
@@ -895,7 +928,7 @@ void LightManager::device_update_tree(Device * /*unused*/,
     /* Specialized light trees for linking. */
     for (uint64_t tree_index = 0; tree_index < LIGHT_LINK_SET_MAX; tree_index++) {
       const uint64_t tree_mask = uint64_t(1) << tree_index;
-      if (!(light_tree.light_link_receiver_used & tree_mask)) {
+      if (!(light_tree->light_link_receiver_used & tree_mask)) {
         continue;
       }
 
@@ -912,7 +945,7 @@ void LightManager::device_update_tree(Device * /*unused*/,
     memcpy(knodes, light_link_nodes.data(), light_link_nodes.size() * sizeof(*knodes));
 
     LOG_INFO << "Specialized light tree for light linking, with "
-             << light_link_nodes.size() - light_tree.num_nodes << " additional nodes.";
+             << light_link_nodes.size() - light_tree->num_nodes << " additional nodes.";
   }
 
   /* Copy arrays to device. */
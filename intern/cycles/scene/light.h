@@ -20,6 +20,7 @@ CCL_NAMESPACE_BEGIN
 
 class Device;
 class DeviceScene;
+class LightTree;
 class Object;
 class Progress;
 class Scene;
@@ -104,6 +105,7 @@ class LightManager {
   bool need_update_background;
 
   LightManager();
+  ~LightManager();
 
   /* IES texture management */
   int add_ies(const string &content);
@@ -151,6 +153,11 @@ class LightManager {
   bool last_background_enabled;
   int last_background_resolution;
 
+  /* Light tree of the last update, kept so it can be refit when only light settings change. */
+  unique_ptr<LightTree> light_tree;
+  /* Enabled lights and their type when the light tree was built. */
+  vector<std::pair<const Light *, LightType>> light_tree_lights;
+
   uint32_t update_flags;
 };
 
@@ -8,6 +8,7 @@
 
 #include "util/math_fast.h"
 #include "util/progress.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -453,6 +454,47 @@ LightTreeNode *LightTree::build(Scene *scene, DeviceScene *dscene)
   return root_.get();
 }
 
+void LightTree::refit_lights(Scene *scene, DeviceScene *dscene)
+{
+  if (!root_) {
+    return;
+  }
+
+  uint *object_offsets = dscene->object_lookup_offset.alloc(scene->objects.size());
+  for (LightTreeEmitter &emitter : emitters_) {
+    if (emitter.is_mesh()) {
+      Mesh *mesh = static_cast<Mesh *>(scene->objects[emitter.object_id]->get_geometry());
+      object_offsets[emitter.object_id] = offset_map_[mesh];
+    }
+    else if (emitter.is_light()) {
+      emitter.measure = LightTreeEmitter(scene, emitter.light_id, emitter.object_id).measure;
+    }
+  }
+
+  refit_node(root_.get());
+}
+
+void LightTree::refit_node(LightTreeNode *node)
+{
+  /* Subtrees of mesh lights are only reachable through their emitter, so they are not visited
+   * here. Their measure does not change as long as the mesh does not. */
+  if (node->is_leaf() || node->is_distant()) {
+    const LightTreeNode::Leaf &leaf = node->get_leaf();
+    node->measure.reset();
+    for (int i = 0; i < leaf.num_emitters; i++) {
+      node->measure.add(emitters_[leaf.first_emitter_index + i].measure);
+    }
+  }
+  else {
+    assert(node->is_inner());
+    LightTreeNode *left_node = node->get_inner().children[left].get();
+    LightTreeNode *right_node = node->get_inner().children[right].get();
+    refit_node(left_node);
+    refit_node(right_node);
+    node->measure = left_node->measure + right_node->measure;
+  }
+}
+
 void LightTree::recursive_build(const Child child,
                                 LightTreeNode *inner,
                                 const int start,
@@ -517,6 +559,9 @@ void LightTree::recursive_build(const Child child,
   }
 }
 
+/* Buckets for each of the three dimensions. */
+using LightTreeBuckets = std::array<std::array<LightTreeBucket, LightTreeBucket::num_buckets>, 3>;
+
 bool LightTree::should_split(LightTreeEmitter *emitters,
                              const int start,
                              int &middle,
@@ -537,48 +582,92 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
 
   middle = (start + end) / 2;
 
+  const bool use_parallel = num_emitters > MIN_EMITTERS_PER_THREAD;
+  const blocked_range<int> range(start, end, MIN_EMITTERS_PER_THREAD);
+
   BoundBox centroid_bbox = BoundBox::empty;
-  for (int i = start; i < end; i++) {
-    centroid_bbox.grow((emitters + i)->centroid);
+  if (use_parallel) {
+    centroid_bbox = parallel_reduce(
+        range,
+        BoundBox::empty,
+        [emitters](const blocked_range<int> &r, BoundBox bbox) {
+          for (int i = r.begin(); i != r.end(); i++) {
+            bbox.grow(emitters[i].centroid);
+          }
+          return bbox;
+        },
+        [](BoundBox a, const BoundBox &b) {
+          a.grow(b);
+          return a;
+        });
+  }
+  else {
+    for (int i = start; i < end; i++) {
+      centroid_bbox.grow((emitters + i)->centroid);
+    }
   }
 
   const float3 extent = centroid_bbox.size();
   const float max_extent = max4(extent.x, extent.y, extent.z, 0.0f);
 
-  /* Check each dimension to find the minimum splitting cost. */
-  float total_cost = 0.0f;
-  float min_cost = FLT_MAX;
+  /* Fill in the buckets of all dimensions in a single pass over the emitters, where the centroid
+   * box is split into equal partitions. In the degenerate case where the centroid bounding box is
+   * 0 along a dimension, everything goes into the same bucket. */
+  float3 inv_extent;
   for (int dim = 0; dim < 3; dim++) {
-    std::array<LightTreeBucket, LightTreeBucket::num_buckets> buckets;
-    float inv_extent;
-
-    if (centroid_bbox.size()[dim] == 0.0f) {
-      /* If the centroid bounding box is 0 along a given dimension and the node measure is
-       * already computed, skip it. */
-      if (dim != 0) {
-        continue;
-      }
+    inv_extent[dim] = (extent[dim] == 0.0f) ? 0.0f : 1.0f / extent[dim];
+  }
 
-      /* Degenerate case, everything in the same bucket. */
-      inv_extent = FLT_MAX;
-      for (int i = start; i < end; i++) {
-        buckets[0].add(emitters[i]);
+  auto fill_buckets = [&](const int range_start, const int range_end, LightTreeBuckets &buckets) {
+    for (int i = range_start; i < range_end; i++) {
+      const LightTreeEmitter &emitter = emitters[i];
+      for (int dim = 0; dim < 3; dim++) {
+        /* Dimensions with zero extent are skipped below, except the first one which is needed
+         * for the node measure. */
+        if (dim != 0 && inv_extent[dim] == 0.0f) {
+          continue;
+        }
+        int bucket_idx = LightTreeBucket::num_buckets *
+                         (emitter.centroid[dim] - centroid_bbox.min[dim]) * inv_extent[dim];
+        bucket_idx = clamp(bucket_idx, 0, LightTreeBucket::num_buckets - 1);
+        buckets[dim][bucket_idx].add(emitter);
       }
     }
-    else {
-      /* Fill in buckets with emitters. */
-      inv_extent = 1 / (centroid_bbox.size()[dim]);
-      for (int i = start; i < end; i++) {
-        const LightTreeEmitter *emitter = emitters + i;
+  };
+
+  LightTreeBuckets dim_buckets;
+  if (use_parallel) {
+    /* Deterministic reduction, so that the light tree does not depend on thread scheduling. */
+    dim_buckets = tbb::parallel_deterministic_reduce(
+        range,
+        LightTreeBuckets(),
+        [&](const blocked_range<int> &r, LightTreeBuckets buckets) {
+          fill_buckets(r.begin(), r.end(), buckets);
+          return buckets;
+        },
+        [](LightTreeBuckets a, const LightTreeBuckets &b) {
+          for (int dim = 0; dim < 3; dim++) {
+            for (int i = 0; i < LightTreeBucket::num_buckets; i++) {
+              a[dim][i] = a[dim][i] + b[dim][i];
+            }
+          }
+          return a;
+        });
+  }
+  else {
+    fill_buckets(start, end, dim_buckets);
+  }
 
-        /* Place emitter into the appropriate bucket, where the centroid box is split into equal
-         * partitions. */
-        int bucket_idx = LightTreeBucket::num_buckets *
-                         (emitter->centroid[dim] - centroid_bbox.min[dim]) * inv_extent;
-        bucket_idx = clamp(bucket_idx, 0, LightTreeBucket::num_buckets - 1);
+  /* Check each dimension to find the minimum splitting cost. */
+  float total_cost = 0.0f;
+  float min_cost = FLT_MAX;
+  for (int dim = 0; dim < 3; dim++) {
+    const std::array<LightTreeBucket, LightTreeBucket::num_buckets> &buckets = dim_buckets[dim];
 
-        buckets[bucket_idx].add(*emitter);
-      }
+    /* If the centroid bounding box is 0 along a given dimension and the node measure is already
+     * computed, skip it. */
+    if (dim != 0 && extent[dim] == 0.0f) {
+      continue;
     }
 
     /* Precompute the left bucket measure cumulatively. */
@@ -599,7 +688,7 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
       }
 
       /* If the centroid bounding box is 0 along a given dimension, skip it. */
-      if (centroid_bbox.size()[dim] == 0.0f) {
+      if (extent[dim] == 0.0f) {
         continue;
       }
 
@@ -617,7 +706,7 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
     }
 
     /* Calculate the cost of splitting at each point between partitions. */
-    const float regularization = max_extent * inv_extent;
+    const float regularization = max_extent * inv_extent[dim];
     for (int split = 0; split < LightTreeBucket::num_buckets - 1; split++) {
       const float left_cost = left_buckets[split].measure.calculate();
       const float right_cost = right_buckets[split].measure.calculate();
@@ -348,13 +348,15 @@ struct LightTreeNode {
     type = LIGHT_TREE_INSTANCE;
   }
 
+  /* Follows references until the node that holds the subtree. Flattening the tree can move the
+   * subtree to another instance, which then becomes the reference. */
   LightTreeNode *get_reference()
   {
-    assert(is_instance());
-    if (type == LIGHT_TREE_INSTANCE) {
-      return get_instance().reference;
+    LightTreeNode *node = this;
+    while (node->type == LIGHT_TREE_INSTANCE) {
+      node = node->get_instance().reference;
     }
-    return this;
+    return node;
   }
 
   __forceinline bool is_instance() const
@@ -417,6 +419,16 @@ class LightTree {
   /* Returns a pointer to the root node. */
   LightTreeNode *build(Scene *scene, DeviceScene *dscene);
 
+  /* Update the measure of the light objects and the top level nodes of an already built tree,
+   * keeping its structure and the subtrees of mesh lights. Only valid when the same lights are
+   * enabled and no geometry or object changed since the tree was built. */
+  void refit_lights(Scene *scene, DeviceScene *dscene);
+
+  LightTreeNode *get_root() const
+  {
+    return root_.get();
+  }
+
   /* NOTE: Always use this function to create a new node so the number of nodes is in sync. */
   unique_ptr<LightTreeNode> create_node(const LightTreeMeasure &measure, const uint &bit_trial)
   {
@@ -461,6 +473,9 @@ class LightTree {
 
   /* Add all the emissive triangles of a mesh to the light tree. */
   void add_mesh(Scene *scene, Mesh *mesh, const int object_id);
+
+  /* Recompute the measure of a top level node from its emitters. */
+  void refit_node(LightTreeNode *node);
 };
 
 CCL_NAMESPACE_END
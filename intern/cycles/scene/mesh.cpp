@@ -346,6 +346,8 @@ Mesh::Mesh(const NodeType *node_type, Type geom_type_)
   face_offset = 0;
   corner_offset = 0;
 
+  use_device_vertex_normals = true;
+
   num_subd_added_verts = 0;
   num_subd_faces = 0;
 
@@ -921,6 +923,25 @@ void Mesh::update_tangents(Scene *scene, bool undisplaced)
   }
 }
 
+bool Mesh::need_device_vertex_normals() const
+{
+  /* Displacement evaluates with smooth normals, and subdivision surfaces might get their smooth
+   * flags from the subdivision faces only after tessellation. */
+  if (subdivision_type != SUBDIVISION_NONE || has_true_displacement()) {
+    return true;
+  }
+
+  /* Flat shaded triangles only use the geometric normal, so for meshes without any smooth
+   * triangles the vertex normals don't have to take up device memory. */
+  for (const bool tri_smooth : smooth) {
+    if (tri_smooth) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void Mesh::pack_shaders(Scene *scene, uint *tri_shader)
 {
   uint shader_id = 0;
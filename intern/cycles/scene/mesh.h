@@ -179,6 +179,11 @@ class Mesh : public Geometry {
   size_t face_offset;
   size_t corner_offset;
 
+  /* Vertex normals are only needed on the device for smooth shaded triangles and displacement,
+   * see #need_device_vertex_normals. Cached so the triangles only have to be checked when the
+   * mesh is modified. */
+  bool use_device_vertex_normals;
+
  private:
   size_t num_subd_added_verts;
   size_t num_subd_faces;
@@ -222,6 +227,8 @@ class Mesh : public Geometry {
 
   void get_uv_tiles(ustring map, unordered_set<int> &tiles) override;
 
+  bool need_device_vertex_normals() const;
+
   void pack_shaders(Scene *scene, uint *shader);
   void pack_verts(packed_float3 *tri_verts, packed_uint3 *tri_vindex);
 
@@ -1050,7 +1050,8 @@ void ObjectManager::device_update_geom_offsets(Device * /*unused*/,
                                  .offset;
       }
       assert(normal_attr_offset != ATTR_STD_NOT_FOUND ||
-             static_cast<Mesh *>(geom)->num_triangles() == 0);
+             static_cast<Mesh *>(geom)->num_triangles() == 0 ||
+             !static_cast<Mesh *>(geom)->use_device_vertex_normals);
     }
     if (kobject.normal_attr_offset != normal_attr_offset) {
       kobject.normal_attr_offset = normal_attr_offset;
@@ -20,6 +20,7 @@
 #  include "kernel/osl/services.h"
 
 #  include "util/aligned_malloc.h"
+#  include "util/image_maketx.h"
 #  include "util/log.h"
 #  include "util/md5.h"
 #  include "util/path.h"
@@ -140,7 +141,11 @@ void OSLManager::device_update_pre(Device *device, Scene *scene)
     });
 
     if (device->info.type == DEVICE_CPU) {
-      scene->image_manager->set_osl_texture_system((void *)get_texture_system());
+      OSL::TextureSystem *texture_system = get_texture_system();
+      if (scene->params.use_texture_cache) {
+        texture_system->attribute("max_memory_MB", float(scene->params.texture_cache_size));
+      }
+      scene->image_manager->set_osl_texture_system((void *)texture_system);
     }
   }
 }
@@ -1583,6 +1588,30 @@ void OSLCompiler::parameter_texture(const char *name, ustring filename, ustring
   parameter(name, filename);
 }
 
+ustring OSLCompiler::texture_cache_filepath(ustring filepath,
+                                            ustring colorspace,
+                                            const ImageAlphaType alpha_type,
+                                            const ImageFormatType format_type)
+{
+  /* UDIM and UVTILE tiles are resolved at render time, so they can't be looked up here. */
+  if (!scene->params.use_texture_cache || !path_is_file(filepath.string())) {
+    return ustring();
+  }
+
+  string tx_filepath;
+  if (!resolve_tx(filepath.string(), "", colorspace, alpha_type, format_type, tx_filepath)) {
+    if (tx_filepath.empty() ||
+        !make_tx(filepath.string(), tx_filepath, colorspace, alpha_type, format_type))
+    {
+      LOG_WARNING << "Failed to create texture cache file for " << filepath
+                  << ", using the image file instead";
+      return ustring();
+    }
+  }
+
+  return ustring(tx_filepath);
+}
+
 void OSLCompiler::parameter_texture(const char *name, const ImageHandle &handle)
 {
   /* Texture loaded through SVM image texture system. We generate a unique
@@ -1661,6 +1690,14 @@ void OSLCompiler::parameter_texture(const char * /*name*/,
 
 void OSLCompiler::parameter_texture(const char * /*name*/, const ImageHandle & /*handle*/) {}
 
+ustring OSLCompiler::texture_cache_filepath(ustring /*filepath*/,
+                                            ustring /*colorspace*/,
+                                            const ImageAlphaType /*alpha_type*/,
+                                            const ImageFormatType /*format_type*/)
+{
+  return ustring();
+}
+
 void OSLCompiler::parameter_texture_ies(const char * /*name*/, int /*svm_slot*/) {}
 
 #endif /* WITH_OSL */
@@ -175,6 +175,13 @@ class OSLCompiler {
   void parameter_attribute(const char *name, ustring s);
 
   void parameter_texture(const char *name, ustring filename, ustring colorspace);
+  /* Path of a tiled and mip-mapped .tx file to load through the OpenImageIO texture cache
+   * instead of the image file, generated when it does not exist yet. Empty when the scene does
+   * not use the texture cache or the file could not be generated. */
+  ustring texture_cache_filepath(ustring filepath,
+                                 ustring colorspace,
+                                 const ImageAlphaType alpha_type,
+                                 const ImageFormatType format_type);
   void parameter_texture(const char *name, const ImageHandle &handle);
   void parameter_texture_ies(const char *name, const int svm_slot);
 
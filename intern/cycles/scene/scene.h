@@ -72,6 +72,10 @@ class SceneParams {
   int hair_subdivisions;
   CurveShapeType hair_shape;
   int texture_limit;
+  /* Load image textures on demand through the OpenImageIO texture cache with tiled and
+   * mip-mapped .tx files, with the cache size in megabytes. Only used with OSL on the CPU. */
+  bool use_texture_cache;
+  int texture_cache_size;
 
   bool background;
 
@@ -87,6 +91,8 @@ class SceneParams {
     hair_subdivisions = 3;
     hair_shape = CURVE_RIBBON;
     texture_limit = 0;
+    use_texture_cache = false;
+    texture_cache_size = 16384;
     background = true;
   }
 
@@ -99,7 +105,9 @@ class SceneParams {
              use_bvh_unaligned_nodes == params.use_bvh_unaligned_nodes &&
              num_bvh_time_steps == params.num_bvh_time_steps &&
              hair_subdivisions == params.hair_subdivisions && hair_shape == params.hair_shape &&
-             texture_limit == params.texture_limit);
+             texture_limit == params.texture_limit &&
+             use_texture_cache == params.use_texture_cache &&
+             texture_cache_size == params.texture_cache_size);
   }
 
   int curve_subdivisions()
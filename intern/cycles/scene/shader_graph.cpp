@@ -800,6 +800,8 @@ void ShaderGraph::clean(Scene *scene)
 {
   /* Graph simplification */
 
+  const size_t num_nodes_before = nodes.size();
+
   /* NOTE: Remove proxy nodes was already done. */
   constant_fold(scene);
   simplify_settings(scene);
@@ -846,6 +848,9 @@ void ShaderGraph::clean(Scene *scene)
   }
 
   nodes = std::move(newnodes);
+
+  LOG_DEBUG << "Simplified shader graph from " << num_nodes_before << " to " << nodes.size()
+            << " nodes.";
 }
 
 void ShaderGraph::expand()
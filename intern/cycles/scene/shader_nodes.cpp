@@ -466,8 +466,16 @@ void ImageTextureNode::compile(OSLCompiler &compiler)
   const ustring known_colorspace = metadata.colorspace;
 
   if (handle.svm_slot() == -1) {
-    compiler.parameter_texture(
-        "filename", filename, compress_as_srgb ? u_colorspace_scene_linear : known_colorspace);
+    /* Texture cache files are already converted to scene linear. */
+    const ustring tx_filepath = compiler.texture_cache_filepath(
+        filename, known_colorspace, alpha_type, IMAGE_FORMAT_PLAIN);
+    if (!tx_filepath.empty()) {
+      compiler.parameter_texture("filename", tx_filepath, u_colorspace_scene_linear);
+    }
+    else {
+      compiler.parameter_texture(
+          "filename", filename, compress_as_srgb ? u_colorspace_scene_linear : known_colorspace);
+    }
   }
   else {
     compiler.parameter_texture("filename", handle);
@@ -618,8 +626,19 @@ void EnvironmentTextureNode::compile(OSLCompiler &compiler)
   const ustring known_colorspace = metadata.colorspace;
 
   if (handle.svm_slot() == -1) {
-    compiler.parameter_texture(
-        "filename", filename, compress_as_srgb ? u_colorspace_scene_linear : known_colorspace);
+    /* Texture cache files are already converted to scene linear. */
+    const ImageFormatType format_type = (projection == NODE_ENVIRONMENT_EQUIRECTANGULAR) ?
+                                            IMAGE_FORMAT_EQUIANGULAR :
+                                            IMAGE_FORMAT_PLAIN;
+    const ustring tx_filepath = compiler.texture_cache_filepath(
+        filename, known_colorspace, alpha_type, format_type);
+    if (!tx_filepath.empty()) {
+      compiler.parameter_texture("filename", tx_filepath, u_colorspace_scene_linear);
+    }
+    else {
+      compiler.parameter_texture(
+          "filename", filename, compress_as_srgb ? u_colorspace_scene_linear : known_colorspace);
+    }
   }
   else {
     compiler.parameter_texture("filename", handle);
@@ -2269,6 +2288,17 @@ bool BsdfBaseNode::has_bump()
 
 BsdfNode::BsdfNode(const NodeType *node_type) : BsdfBaseNode(node_type) {}
 
+void BsdfNode::constant_fold(const ConstantFolder &folder)
+{
+  /* The color is the weight of the closure, a black closure has no contribution. Nodes that use
+   * their color differently don't have a "Color" input. */
+  ShaderInput *color_in = input("Color");
+
+  if (color_in && !color_in->link && color == zero_float3()) {
+    folder.discard();
+  }
+}
+
 void BsdfNode::compile(SVMCompiler &compiler,
                        ShaderInput *bsdf_y,
                        ShaderInput *bsdf_z,
@@ -6452,6 +6482,17 @@ void MapRangeNode::expand(ShaderGraph *graph)
   }
 }
 
+void MapRangeNode::constant_fold(const ConstantFolder &folder)
+{
+  if (folder.all_inputs_constant()) {
+    folder.make_constant(
+        svm_map_range(range_type, value, from_min, from_max, to_min, to_max, steps));
+  }
+  else {
+    folder.fold_map_range(range_type);
+  }
+}
+
 bool MapRangeNode::is_linear_operation()
 {
   if (range_type != NODE_MAP_RANGE_LINEAR) {
@@ -477,6 +477,8 @@ class BsdfNode : public BsdfBaseNode {
   explicit BsdfNode(const NodeType *node_type);
   SHADER_NODE_BASE_CLASS(BsdfNode)
 
+  void constant_fold(const ConstantFolder &folder) override;
+
   void compile(SVMCompiler &compiler,
                ShaderInput *bsdf_y,
                ShaderInput *bsdf_z,
@@ -1430,6 +1432,7 @@ class MapRangeNode : public ShaderNode {
  public:
   SHADER_NODE_CLASS(MapRangeNode)
   void expand(ShaderGraph *graph) override;
+  void constant_fold(const ConstantFolder &folder) override;
   bool is_linear_operation() override;
 
   NODE_SOCKET_API(float, value)
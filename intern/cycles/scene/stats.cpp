@@ -79,6 +79,19 @@ string NamedSizeStats::full_report(const int indent_level)
   return result;
 }
 
+string NamedSizeStats::json_report() const
+{
+  string result = string_printf("{\"total_size\": %zu, \"entries\": {", total_size);
+  for (size_t i = 0; i < entries.size(); i++) {
+    result += string_printf("%s%s: %zu",
+                            (i == 0) ? "" : ", ",
+                            string_json_quote(entries[i].name).c_str(),
+                            entries[i].size);
+  }
+  result += "}}";
+  return result;
+}
+
 string NamedTimeStats::full_report(const int indent_level)
 {
   const string indent(indent_level * kIndentNumSpaces, ' ');
@@ -93,6 +106,19 @@ string NamedTimeStats::full_report(const int indent_level)
   return result;
 }
 
+string NamedTimeStats::json_report() const
+{
+  string result = string_printf("{\"total_time\": %f, \"entries\": {", total_time);
+  for (size_t i = 0; i < entries.size(); i++) {
+    result += string_printf("%s%s: %f",
+                            (i == 0) ? "" : ", ",
+                            string_json_quote(entries[i].name).c_str(),
+                            entries[i].time);
+  }
+  result += "}}";
+  return result;
+}
+
 /* Named time sample statistics. */
 
 NamedNestedSampleStats::NamedNestedSampleStats() : self_samples(0), sum_samples(0) {}
@@ -146,6 +172,25 @@ string NamedNestedSampleStats::full_report(const int indent_level, uint64_t tota
   return result;
 }
 
+string NamedNestedSampleStats::json_report()
+{
+  update_sum();
+
+  string result = string_printf("{\"name\": %s, \"total_time\": %.3f, \"self_time\": %.3f",
+                                string_json_quote(name).c_str(),
+                                sum_samples * 0.001,
+                                self_samples * 0.001);
+  if (!entries.empty()) {
+    result += ", \"entries\": [";
+    for (size_t i = 0; i < entries.size(); i++) {
+      result += ((i == 0) ? "" : ", ") + entries[i].json_report();
+    }
+    result += "]";
+  }
+  result += "}";
+  return result;
+}
+
 /* Named sample count pairs. */
 
 NamedSampleCountPair::NamedSampleCountPair(const ustring &name,
@@ -201,6 +246,23 @@ string NamedSampleCountStats::full_report(const int indent_level)
   return result;
 }
 
+string NamedSampleCountStats::json_report() const
+{
+  string result = "{";
+  bool first = true;
+  for (entry_map::const_reference entry : entries) {
+    const NamedSampleCountPair &pair = entry.second;
+    result += string_printf("%s%s: {\"time\": %.3f, \"hits\": %llu}",
+                            first ? "" : ", ",
+                            string_json_quote(pair.name.string()).c_str(),
+                            pair.samples * 0.001,
+                            (unsigned long long)pair.hits);
+    first = false;
+  }
+  result += "}";
+  return result;
+}
+
 /* Mesh statistics. */
 
 MeshStats::MeshStats() = default;
@@ -222,6 +284,7 @@ string ImageStats::full_report(const int indent_level)
   const string indent(indent_level * kIndentNumSpaces, ' ');
   string result;
   result += indent + "Textures:\n" + textures.full_report(indent_level + 1);
+  result += indent + "Volumes:\n" + volumes.full_report(indent_level + 1);
   return result;
 }
 
@@ -287,6 +350,21 @@ void RenderStats::collect_profiling(Scene *scene, Profiler &prof)
   }
 }
 
+string RenderStats::json_report()
+{
+  string result = "{";
+  result += "\"mesh\": {\"geometry\": " + mesh.geometry.json_report() + "}";
+  result += ", \"image\": {\"textures\": " + image.textures.json_report() +
+            ", \"volumes\": " + image.volumes.json_report() + "}";
+  if (has_profiling) {
+    result += ", \"kernel\": " + kernel.json_report();
+    result += ", \"shaders\": " + shaders.json_report();
+    result += ", \"objects\": " + objects.json_report();
+  }
+  result += "}";
+  return result;
+}
+
 string RenderStats::full_report()
 {
   string result;
@@ -310,6 +388,11 @@ string UpdateTimeStats::full_report(const int indent_level)
   return times.full_report(indent_level + 1);
 }
 
+string UpdateTimeStats::json_report() const
+{
+  return times.json_report();
+}
+
 SceneUpdateStats::SceneUpdateStats() = default;
 
 string SceneUpdateStats::full_report()
@@ -333,6 +416,28 @@ string SceneUpdateStats::full_report()
   return result;
 }
 
+string SceneUpdateStats::json_report() const
+{
+  string result = "{";
+  result += "\"scene\": " + scene.json_report();
+  result += ", \"geometry\": " + geometry.json_report();
+  result += ", \"light\": " + light.json_report();
+  result += ", \"object\": " + object.json_report();
+  result += ", \"image\": " + image.json_report();
+  result += ", \"background\": " + background.json_report();
+  result += ", \"bake\": " + bake.json_report();
+  result += ", \"camera\": " + camera.json_report();
+  result += ", \"film\": " + film.json_report();
+  result += ", \"integrator\": " + integrator.json_report();
+  result += ", \"osl\": " + osl.json_report();
+  result += ", \"particles\": " + particles.json_report();
+  result += ", \"svm\": " + svm.json_report();
+  result += ", \"tables\": " + tables.json_report();
+  result += ", \"procedurals\": " + procedurals.json_report();
+  result += "}";
+  return result;
+}
+
 void SceneUpdateStats::clear()
 {
   geometry.times.clear();
@@ -50,6 +50,9 @@ class NamedSizeStats {
   /* Generate full human-readable report. */
   string full_report(const int indent_level = 0);
 
+  /* Generate report as a JSON object. */
+  string json_report() const;
+
   /* Total size of all entries. */
   size_t total_size;
 
@@ -73,6 +76,9 @@ class NamedTimeStats {
   /* Generate full human-readable report. */
   string full_report(const int indent_level = 0);
 
+  /* Generate report as a JSON object. */
+  string json_report() const;
+
   /* Total time of all entries. */
   double total_time;
 
@@ -99,6 +105,7 @@ class NamedNestedSampleStats {
   void update_sum();
 
   string full_report(const int indent_level = 0, const uint64_t total_samples = 0);
+  string json_report();
 
   string name;
 
@@ -127,6 +134,7 @@ class NamedSampleCountStats {
   NamedSampleCountStats();
 
   string full_report(const int indent_level = 0);
+  string json_report() const;
   void add(const ustring &name, const uint64_t samples, const uint64_t hits);
 
   using entry_map = unordered_map<ustring, NamedSampleCountPair>;
@@ -157,6 +165,9 @@ class ImageStats {
   string full_report(const int indent_level = 0);
 
   NamedSizeStats textures;
+  /* NanoVDB volume grids, reported separately since their size depends on the sparse topology
+   * and precision rather than the resolution. */
+  NamedSizeStats volumes;
 };
 
 /* Render process statistics. */
@@ -167,6 +178,9 @@ class RenderStats {
   /* Return full report as string. */
   string full_report();
 
+  /* Return report as a JSON object, for processing by other tools. */
+  string json_report();
+
   /* Collect kernel sampling information from Stats. */
   void collect_profiling(Scene *scene, Profiler &prof);
 
@@ -184,6 +198,9 @@ class UpdateTimeStats {
   /* Generate full human-readable report. */
   string full_report(const int indent_level = 0);
 
+  /* Generate report as a JSON object. */
+  string json_report() const;
+
   NamedTimeStats times;
 };
 
@@ -208,6 +225,7 @@ class SceneUpdateStats {
   UpdateTimeStats procedurals;
 
   string full_report();
+  string json_report() const;
 
   void clear();
 };
@@ -0,0 +1,71 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+
+#include "integrator/work_balancer.h"
+
+CCL_NAMESPACE_BEGIN
+
+TEST(work_balance, Initial)
+{
+  vector<WorkBalanceInfo> infos(4);
+  work_balance_do_initial(infos);
+
+  for (const WorkBalanceInfo &info : infos) {
+    EXPECT_DOUBLE_EQ(info.weight, 0.25);
+  }
+}
+
+TEST(work_balance, RebalanceFromThroughput)
+{
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+
+  /* The first device is three times faster than the second one. */
+  infos[0].time_spent = 1.0;
+  infos[1].time_spent = 3.0;
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.75, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.25, 1e-6);
+  EXPECT_EQ(infos[0].time_spent, 0.0);
+  EXPECT_EQ(infos[1].time_spent, 0.0);
+
+  /* Devices now finish at the same time, nothing to change. */
+  infos[0].time_spent = 2.0;
+  infos[1].time_spent = 2.0;
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.75, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.25, 1e-6);
+}
+
+TEST(work_balance, RebalanceAveragesThroughput)
+{
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+
+  infos[0].time_spent = 1.0;
+  infos[1].time_spent = 3.0;
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+
+  /* The second device became as fast as the first one: move half-way to the new balance. */
+  infos[0].time_spent = 0.75;
+  infos[1].time_spent = 0.25;
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.625, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.375, 1e-6);
+}
+
+TEST(work_balance, RebalanceWithoutStatistics)
+{
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+
+  infos[0].time_spent = 1.0;
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_DOUBLE_EQ(infos[0].weight, 0.5);
+  EXPECT_DOUBLE_EQ(infos[1].weight, 0.5);
+}
+
+CCL_NAMESPACE_END
@@ -392,6 +392,27 @@ TEST_F(RenderGraph, constant_fold_shader_mix)
   log.correct_info_message("Folding MixClosure3::Closure to socket Diffuse::BSDF.");
 }
 
+/*
+ * Tests:
+ *  - Folding of BSDF nodes with a black color to nothing.
+ *  - Folding of Add Closure after one of its inputs was discarded.
+ */
+TEST_F(RenderGraph, constant_fold_bsdf_black)
+{
+  builder.add_node(ShaderNodeBuilder<DiffuseBsdfNode>(graph, "Diffuse"))
+      .add_node(ShaderNodeBuilder<GlossyBsdfNode>(graph, "Glossy").set("Color", zero_float3()))
+      .add_node(ShaderNodeBuilder<AddClosureNode>(graph, "AddClosure"))
+      .add_connection("Diffuse::BSDF", "AddClosure::Closure1")
+      .add_connection("Glossy::BSDF", "AddClosure::Closure2")
+      .output_closure("AddClosure::Closure");
+
+  graph.finalize(scene.get());
+
+  log.correct_info_message("Discarding closure Glossy.");
+  log.correct_info_message("Folding AddClosure::Closure to socket Diffuse::BSDF.");
+  log.invalid_info_message("Discarding closure Diffuse.");
+}
+
 /*
  * Tests:
  *  - Folding of Invert with all constant inputs.
@@ -1024,6 +1045,55 @@ TEST_F(RenderGraph, constant_fold_math_clamp)
   log.correct_info_message("Folding clamp::Result to constant (1).");
 }
 
+/*
+ * Tests: Map Range with all constant inputs.
+ */
+TEST_F(RenderGraph, constant_fold_map_range)
+{
+  builder
+      .add_node(ShaderNodeBuilder<MapRangeNode>(graph, "MapRange")
+                    .set_param("range_type", NODE_MAP_RANGE_LINEAR)
+                    .set("Value", 0.5f)
+                    .set("To Min", 2.0f)
+                    .set("To Max", 4.0f))
+      .output_value("MapRange::Result");
+
+  graph.finalize(scene.get());
+
+  log.correct_info_message("Folding MapRange::Result to constant (3).");
+}
+
+/*
+ * Tests: partial folding of Map Range.
+ *  - Mapping a range onto itself.
+ *  - Mapping from an empty range.
+ */
+TEST_F(RenderGraph, constant_fold_part_map_range)
+{
+  builder.add_attribute("Attribute")
+      .add_node(ShaderNodeBuilder<MapRangeNode>(graph, "MapRange_Same")
+                    .set_param("range_type", NODE_MAP_RANGE_LINEAR)
+                    .set("From Min", 0.2f)
+                    .set("To Min", 0.2f))
+      .add_connection("Attribute::Fac", "MapRange_Same::Value")
+      .add_node(ShaderNodeBuilder<MapRangeNode>(graph, "MapRange_Empty")
+                    .set_param("range_type", NODE_MAP_RANGE_SMOOTHSTEP)
+                    .set("From Min", 1.0f))
+      .add_connection("Attribute::Fac", "MapRange_Empty::Value")
+      .add_node(ShaderNodeBuilder<MathNode>(graph, "Out")
+                    .set_param("math_type", NODE_MATH_ADD)
+                    .set_param("use_clamp", false))
+      .add_connection("MapRange_Same::Result", "Out::Value1")
+      .add_connection("MapRange_Empty::Result", "Out::Value2")
+      .output_value("Out::Value");
+
+  graph.finalize(scene.get());
+
+  log.correct_info_message("Folding MapRange_Same::Result to socket Attribute::Fac.");
+  log.correct_info_message("Folding MapRange_Empty::Result to constant (0).");
+  log.correct_info_message("Folding Out::Value to socket Attribute::Fac.");
+}
+
 /*
  * Graph for testing partial folds of Math with one constant argument.
  * Includes 2 tests: constant on each side.
@@ -320,4 +320,16 @@ TEST(string_endswith, basic)
   EXPECT_FALSE(string_endswith("Hello", "WorldHello"));
 }
 
+/* ******** Tests for string_json_quote() ******** */
+
+TEST(string_json_quote, basic)
+{
+  EXPECT_EQ(string_json_quote(""), "\"\"");
+  EXPECT_EQ(string_json_quote("Hello"), "\"Hello\"");
+  EXPECT_EQ(string_json_quote("Say \"Hi\""), "\"Say \\\"Hi\\\"\"");
+  EXPECT_EQ(string_json_quote("C:\\Path"), "\"C:\\\\Path\"");
+  EXPECT_EQ(string_json_quote("Line\nTab\t"), "\"Line\\nTab\\t\"");
+  EXPECT_EQ(string_json_quote("\x01"), "\"\\u0001\"");
+}
+
 CCL_NAMESPACE_END
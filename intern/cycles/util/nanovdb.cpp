@@ -9,8 +9,6 @@
 #  include "util/log.h"
 #  include "util/openvdb.h"
 
-#  include <openvdb/tools/Activate.h>
-
 #  include <nanovdb/util/ForEach.h>
 
 #  if NANOVDB_MAJOR_VERSION_NUMBER > 32 || \
@@ -158,8 +156,8 @@ struct NanoToOpenVDBMaskOp {
   }
 };
 
-template<typename OpType>
-bool nanovdb_grid_type_operation(const nanovdb::GridHandle<> &handle, OpType &&op)
+template<typename HandleType, typename OpType>
+bool nanovdb_grid_type_operation(HandleType &handle, OpType &&op)
 {
   const int n = 0;
 
@@ -190,6 +188,74 @@ openvdb::MaskGrid::Ptr nanovdb_to_openvdb_mask(const nanovdb::GridHandle<> &hand
   return op.mask_grid;
 }
 
+/* Deactivate voxels and tiles with values within the clipping threshold, the same as
+ * openvdb::tools::deactivate would on the OpenVDB grid. Values are kept as they are, so this only
+ * affects the topology used for the volume bounds. Doing this on the converted grid avoids a deep
+ * copy of the full resolution OpenVDB grid, which doubled peak memory usage for large grids. */
+
+template<typename ValueT> static bool is_clipped(const ValueT &value, const float clipping)
+{
+  if constexpr (std::is_same_v<ValueT, float>) {
+    return std::fabs(value) <= clipping;
+  }
+  else {
+    for (int i = 0; i < ValueT::SIZE; i++) {
+      if (std::fabs(value[i]) > clipping) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+template<typename NodeT>
+static void deactivate_clipped_nodes(NodeT *nodes, const uint32_t nodes_num, const float clipping)
+{
+  auto kernel = [&](const auto &r) {
+    for (auto i = r.begin(); i != r.end(); ++i) {
+      auto *data = nodes[i].data();
+      for (uint32_t n = 0; n < NodeT::SIZE; n++) {
+        if constexpr (NodeT::LEVEL > 0) {
+          if (data->mChildMask.isOn(n)) {
+            continue;
+          }
+        }
+        if (data->mValueMask.isOn(n) && is_clipped(data->getValue(n), clipping)) {
+          data->mValueMask.setOff(n);
+        }
+      }
+    }
+  };
+
+#  if NANOVDB_MAJOR_VERSION_NUMBER > 32 || \
+      (NANOVDB_MAJOR_VERSION_NUMBER == 32 && NANOVDB_MINOR_VERSION_NUMBER >= 7)
+  nanovdb::util::forEach(0, nodes_num, 1, kernel);
+#  else
+  nanovdb::forEach(0, nodes_num, 1, kernel);
+#  endif
+}
+
+struct DeactivateClippedOp {
+  float clipping = 0.0f;
+
+  template<typename NanoBuildT> bool operator()(nanovdb::NanoGrid<NanoBuildT> &grid)
+  {
+    auto &tree = grid.tree();
+    deactivate_clipped_nodes(tree.template getFirstNode<0>(), tree.nodeCount(0), clipping);
+    deactivate_clipped_nodes(tree.template getFirstNode<1>(), tree.nodeCount(1), clipping);
+    deactivate_clipped_nodes(tree.template getFirstNode<2>(), tree.nodeCount(2), clipping);
+
+    auto *root_data = tree.root().data();
+    for (uint32_t i = 0; i < root_data->mTableSize; ++i) {
+      auto *tile = root_data->tile(i);
+      if (!tile->isChild() && tile->state && is_clipped(tile->value, clipping)) {
+        tile->state = false;
+      }
+    }
+    return true;
+  }
+};
+
 /* Convert OpenVDB to NanoVDB grid. */
 
 struct ToNanoOp {
@@ -219,57 +285,53 @@ struct ToNanoOp {
 #    endif
 
       if constexpr (std::is_same_v<GridType, openvdb::FloatGrid>) {
-        typename GridType::ConstPtr floatgrid = apply_clipping<GridType>(grid);
         if (precision == 0) {
-          nanogrid = createNanoGrid<openvdb::FloatGrid, nanovdb::FpN>(*floatgrid,
-                                                                      StatsMode::Disable);
+          nanogrid = createNanoGrid<openvdb::FloatGrid, nanovdb::FpN>(*grid, StatsMode::Disable);
         }
         else if (precision == 16) {
-          nanogrid = createNanoGrid<openvdb::FloatGrid, nanovdb::Fp16>(*floatgrid,
-                                                                       StatsMode::Disable);
+          nanogrid = createNanoGrid<openvdb::FloatGrid, nanovdb::Fp16>(*grid, StatsMode::Disable);
         }
         else {
-          nanogrid = createNanoGrid<openvdb::FloatGrid, float>(*floatgrid, StatsMode::Disable);
+          nanogrid = createNanoGrid<openvdb::FloatGrid, float>(*grid, StatsMode::Disable);
         }
       }
       else if constexpr (std::is_same_v<GridType, openvdb::Vec3fGrid>) {
         /* Enable stats for velocity grid. Weak, but there seems to be no simple iterator over all
          * values in the grid? */
-        typename GridType::ConstPtr floatgrid = apply_clipping<GridType>(grid);
-        nanogrid = createNanoGrid<openvdb::Vec3fGrid, nanovdb::Vec3f>(*floatgrid,
-                                                                      StatsMode::MinMax);
+        nanogrid = createNanoGrid<openvdb::Vec3fGrid, nanovdb::Vec3f>(*grid, StatsMode::MinMax);
       }
       else if constexpr (std::is_same_v<GridType, openvdb::Vec4fGrid>) {
-        typename GridType::ConstPtr floatgrid = apply_clipping<GridType>(grid);
-        nanogrid = createNanoGrid<openvdb::Vec4fGrid, nanovdb::Vec4f>(*floatgrid,
-                                                                      StatsMode::Disable);
+        nanogrid = createNanoGrid<openvdb::Vec4fGrid, nanovdb::Vec4f>(*grid, StatsMode::Disable);
       }
 #  else
       /* OpenVDB 10. */
       if constexpr (std::is_same_v<GridType, openvdb::FloatGrid>) {
-        typename GridType::ConstPtr floatgrid = apply_clipping<GridType>(grid);
         if (precision == 0) {
           nanogrid = nanovdb::openToNanoVDB<nanovdb::HostBuffer, openvdb::FloatTree, nanovdb::FpN>(
-              *floatgrid);
+              *grid);
         }
         else if (precision == 16) {
           nanogrid =
               nanovdb::openToNanoVDB<nanovdb::HostBuffer, openvdb::FloatTree, nanovdb::Fp16>(
-                  *floatgrid);
+                  *grid);
         }
         else {
-          nanogrid = nanovdb::openToNanoVDB(*floatgrid);
+          nanogrid = nanovdb::openToNanoVDB(*grid);
         }
       }
       else if constexpr (std::is_same_v<FloatGridType, openvdb::Vec3fGrid>) {
-        typename GridType::ConstPtr floatgrid = apply_clipping<GridType>(grid);
-        nanogrid = nanovdb::openToNanoVDB(*floatgrid);
+        nanogrid = nanovdb::openToNanoVDB(*grid);
       }
       else if constexpr (std::is_same_v<FloatGridType, openvdb::Vec4fGrid>) {
-        typename GridType::ConstPtr floatgrid = apply_clipping<GridType>(grid);
-        nanogrid = nanovdb::openToNanoVDB(*floatgrid);
+        nanogrid = nanovdb::openToNanoVDB(*grid);
       }
 #  endif
+
+      if (nanogrid && clipping != 0.0f) {
+        DeactivateClippedOp deactivate_op;
+        deactivate_op.clipping = clipping;
+        nanovdb_grid_type_operation(nanogrid, deactivate_op);
+      }
     }
     catch (const std::exception &e) {
       LOG_ERROR << "Error converting OpenVDB to NanoVDB grid: " << e.what();
@@ -279,20 +341,6 @@ struct ToNanoOp {
     }
     return true;
   }
-
-  template<typename GridT>
-  typename GridT::ConstPtr apply_clipping(const typename GridT::ConstPtr &grid) const
-  {
-    if (clipping == 0.0f) {
-      return grid;
-    }
-
-    /* TODO: Ideally would apply clipping during createNanoGrid, this seems slow. */
-    typename GridT::Ptr newgrid = grid->deepCopy();
-    openvdb::tools::deactivate(
-        *newgrid, typename GridT::ValueType(0.0f), typename GridT::ValueType(clipping));
-    return newgrid;
-  }
 };
 
 nanovdb::GridHandle<> openvdb_to_nanovdb(const openvdb::GridBase::ConstPtr &grid,
@@ -318,4 +318,35 @@ string string_human_readable_number(size_t num)
   return p;
 }
 
+string string_json_quote(const string &s)
+{
+  string result = "\"";
+  for (const char c : s) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          result += string_printf("\\u%04x", (unsigned int)c);
+        }
+        else {
+          result += c;
+        }
+        break;
+    }
+  }
+  result += "\"";
+  return result;
+}
+
 CCL_NAMESPACE_END
@@ -68,4 +68,7 @@ string string_human_readable_size(const size_t size);
 /* Make a string from a unit-less quantity in human readable form. */
 string string_human_readable_number(const size_t num);
 
+/* Quote and escape a string for use in JSON. */
+string string_json_quote(const string &s);
+
 CCL_NAMESPACE_END
@@ -233,6 +233,40 @@ extern void (*MEM_reset_peak_memory)();
 /** Get the peak memory usage in bytes, including `mmap` allocations. */
 extern size_t (*MEM_get_peak_memory)() ATTR_WARN_UNUSED_RESULT;
 
+/**
+ * Memory categories allow finding out which part of the program uses how much memory, in a way
+ * that is cheap enough to always be enabled. The category is set per thread, and every block
+ * allocated by that thread is tagged with it. The block is counted for that category until it's
+ * freed, even when it's freed on a different thread.
+ *
+ * Only the lockfree allocator keeps track of categories. Nested work done by other threads, e.g.
+ * in parallel loops, uses the category of the thread that is doing the work, so the numbers are
+ * approximate.
+ */
+#define MEM_MEMORY_CATEGORIES_MAX 32
+/** The category of allocations that are not tagged. */
+#define MEM_MEMORY_CATEGORY_NONE 0
+
+/**
+ * Register a memory category with the given static name and return its identifier. Registering an
+ * existing name returns the same identifier. #MEM_MEMORY_CATEGORY_NONE is returned when the
+ * maximum number of categories has been reached. This is thread-safe.
+ */
+int MEM_memory_category_register(const char *name);
+/** Number of memory categories including #MEM_MEMORY_CATEGORY_NONE. */
+int MEM_memory_categories_num();
+const char *MEM_memory_category_name(int category);
+/**
+ * Set the memory category for allocations done by the calling thread, returning the previous
+ * category. See #MEM_MemoryCategoryScope to set the category for a scope.
+ */
+int MEM_memory_category_set(int category);
+/**
+ * Memory in use by blocks of the given category in bytes. For #MEM_MEMORY_CATEGORY_NONE this is
+ * all the memory that isn't in any other category.
+ */
+size_t MEM_memory_category_in_use(int category);
+
 /** Overhead for lockfree allocator (use to avoid slop-space). */
 #define MEM_SIZE_OVERHEAD sizeof(size_t)
 #define MEM_SIZE_OPTIMAL(size) ((size) - MEM_SIZE_OVERHEAD)
@@ -671,6 +705,28 @@ template<typename T, typename... Args> T &MEM_construct_leak_detection_data(Args
   return *data;
 }
 
+/**
+ * Sets the memory category of the calling thread for the lifetime of the scope, see
+ * #MEM_memory_category_set.
+ */
+class MEM_MemoryCategoryScope {
+  int previous_category_;
+
+ public:
+  explicit MEM_MemoryCategoryScope(const int category)
+      : previous_category_(MEM_memory_category_set(category))
+  {
+  }
+
+  ~MEM_MemoryCategoryScope()
+  {
+    MEM_memory_category_set(previous_category_);
+  }
+
+  MEM_MemoryCategoryScope(const MEM_MemoryCategoryScope &) = delete;
+  MEM_MemoryCategoryScope &operator=(const MEM_MemoryCategoryScope &) = delete;
+};
+
 #endif /* __cplusplus */
 
 #endif /* __MEM_GUARDEDALLOC_H__ */
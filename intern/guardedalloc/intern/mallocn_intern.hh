@@ -89,8 +89,14 @@ extern bool leak_detector_has_run;
 extern char free_after_leak_detection_message[];
 
 void memory_usage_init(void);
-void memory_usage_block_alloc(size_t size);
-void memory_usage_block_free(size_t size);
+/**
+ * Count an allocated or freed block. Blocks with a category other than
+ * #MEM_MEMORY_CATEGORY_NONE are counted for that category as well.
+ */
+void memory_usage_block_alloc(size_t size, int category = MEM_MEMORY_CATEGORY_NONE);
+void memory_usage_block_free(size_t size, int category = MEM_MEMORY_CATEGORY_NONE);
+/** The memory category set for the calling thread, see #MEM_memory_category_set. */
+int memory_usage_category_get(void);
 size_t memory_usage_block_num(void);
 size_t memory_usage_current(void);
 /**
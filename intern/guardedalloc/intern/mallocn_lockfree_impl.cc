@@ -75,7 +75,17 @@ enum {
 #define MEMHEAD_IS_ALIGNED(memhead) ((memhead)->len & size_t(MEMHEAD_FLAG_ALIGN))
 #define MEMHEAD_HAS_NONTRIVIAL_DESTRUCTOR(memhead) \
   ((memhead)->len & size_t(MEMHEAD_FLAG_NONTRIVIAL_DESTRUCTOR))
-#define MEMHEAD_LEN(memhead) ((memhead)->len & ~size_t(MEMHEAD_FLAG_MASK))
+/**
+ * The memory category of the block (see #MEM_memory_category_set) is stored in the highest bits
+ * of the `len` member, which are never used by actual allocation sizes.
+ */
+#define MEMHEAD_CATEGORY_SHIFT 56
+static_assert(sizeof(size_t) == 8, "Memory categories require 64-bit sizes");
+static_assert(MEM_MEMORY_CATEGORIES_MAX <= 256, "Memory categories don't fit into MemHead");
+#define MEMHEAD_CATEGORY_BITS(category) (size_t(category) << MEMHEAD_CATEGORY_SHIFT)
+#define MEMHEAD_CATEGORY(memhead) int((memhead)->len >> MEMHEAD_CATEGORY_SHIFT)
+#define MEMHEAD_LEN(memhead) \
+  ((memhead)->len & ~size_t(MEMHEAD_FLAG_MASK) & ~MEMHEAD_CATEGORY_BITS(0xff))
 
 #ifdef __GNUC__
 __attribute__((format(printf, 1, 0)))
@@ -134,6 +144,195 @@ report_error_on_address(const void *vmemh, const char *message, ...)
   MEM_trigger_error_on_memory_block(address, size);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Thread Cache
+ *
+ * Freed small blocks are kept in per-thread bins, so that allocating a block of a similar size
+ * again doesn't have to go through the system allocator. That is contended when many threads do
+ * small allocations at the same time, like during depsgraph and geometry nodes evaluation.
+ *
+ * Small blocks are always allocated with the full size of their size class, so that a cached
+ * block can be reused for any size in the same class. Blocks are cached by the thread that frees
+ * them, which doesn't have to be the thread that allocated them. Cached blocks are not part of
+ * the memory usage counters.
+ *
+ * Disabled when using valgrind or ASAN, so that they can track every allocation and free.
+ * \{ */
+
+#if !defined(WITH_MEM_VALGRIND) && !defined(WITH_ASAN)
+#  define USE_THREAD_CACHE
+#endif
+
+#ifdef USE_THREAD_CACHE
+
+namespace {
+
+/** Blocks up to this size are cached, in size classes that are a multiple of 16 bytes. */
+constexpr size_t thread_cache_max_len = 256;
+constexpr size_t thread_cache_class_len = 16;
+constexpr size_t thread_cache_classes_num = thread_cache_max_len / thread_cache_class_len;
+/** Limits the memory kept by every thread to about 300 KiB. */
+constexpr int thread_cache_bin_capacity = 64;
+
+struct ThreadCacheBin {
+  /** Pointers to the start of the system allocations. */
+  void *blocks[thread_cache_bin_capacity];
+  int blocks_num = 0;
+};
+
+struct ThreadCache {
+  /** Blocks with #MemHead. */
+  ThreadCacheBin bins[thread_cache_classes_num];
+  /** Blocks with #MemHeadAligned and #ALIGNED_MALLOC_MINIMUM_ALIGNMENT. */
+  ThreadCacheBin aligned_bins[thread_cache_classes_num];
+  /**
+   * The cache is destructed when its thread exits, blocks that are freed after that (e.g. by
+   * destructors of static variables on the main thread) go back to the system directly.
+   */
+  bool destructed = false;
+
+  ~ThreadCache()
+  {
+    for (ThreadCacheBin &bin : this->bins) {
+      for (int i = 0; i < bin.blocks_num; i++) {
+        free(bin.blocks[i]);
+      }
+      bin.blocks_num = 0;
+    }
+    for (ThreadCacheBin &bin : this->aligned_bins) {
+      for (int i = 0; i < bin.blocks_num; i++) {
+        aligned_free(bin.blocks[i]);
+      }
+      bin.blocks_num = 0;
+    }
+    this->destructed = true;
+  }
+};
+
+}  // namespace
+
+static ThreadCache *thread_cache_get()
+{
+  static thread_local ThreadCache cache;
+  return UNLIKELY(cache.destructed) ? nullptr : &cache;
+}
+
+static size_t thread_cache_class(const size_t len)
+{
+  return len == 0 ? 0 : (len - 1) / thread_cache_class_len;
+}
+
+static size_t thread_cache_class_len_max(const size_t class_index)
+{
+  return (class_index + 1) * thread_cache_class_len;
+}
+
+static void *thread_cache_pop(ThreadCacheBin *bins, const size_t len)
+{
+  ThreadCacheBin &bin = bins[thread_cache_class(len)];
+  if (bin.blocks_num == 0) {
+    return nullptr;
+  }
+  bin.blocks_num--;
+  return bin.blocks[bin.blocks_num];
+}
+
+static bool thread_cache_push(ThreadCacheBin *bins, const size_t len, void *block)
+{
+  ThreadCacheBin &bin = bins[thread_cache_class(len)];
+  if (bin.blocks_num == thread_cache_bin_capacity) {
+    return false;
+  }
+  bin.blocks[bin.blocks_num] = block;
+  bin.blocks_num++;
+  return true;
+}
+
+#endif /* USE_THREAD_CACHE */
+
+/**
+ * Allocate the memory for a block with #MemHead and the given length, which may be taken from
+ * the thread cache.
+ */
+static MemHead *mem_block_alloc(const size_t len, const bool zeroed)
+{
+  size_t alloc_len = len;
+#ifdef USE_THREAD_CACHE
+  if (len <= thread_cache_max_len) {
+    if (ThreadCache *cache = thread_cache_get()) {
+      if (MemHead *memh = static_cast<MemHead *>(thread_cache_pop(cache->bins, len))) {
+        if (zeroed) {
+          memset(memh + 1, 0, len);
+        }
+        return memh;
+      }
+    }
+    alloc_len = thread_cache_class_len_max(thread_cache_class(len));
+  }
+#endif
+  if (zeroed) {
+    return static_cast<MemHead *>(calloc(1, alloc_len + sizeof(MemHead)));
+  }
+  return static_cast<MemHead *>(malloc(alloc_len + sizeof(MemHead)));
+}
+
+static void mem_block_free(MemHead *memh, const size_t len)
+{
+#ifdef USE_THREAD_CACHE
+  if (len <= thread_cache_max_len) {
+    if (ThreadCache *cache = thread_cache_get()) {
+      if (thread_cache_push(cache->bins, len, memh)) {
+        return;
+      }
+    }
+  }
+#else
+  (void)len;
+#endif
+  free(memh);
+}
+
+/**
+ * Allocate the memory for a block with #MemHeadAligned and the given length and alignment. The
+ * returned pointer is the start of the allocation, before the padding.
+ */
+static void *mem_block_alloc_aligned(const size_t len, const size_t alignment)
+{
+  size_t alloc_len = len;
+#ifdef USE_THREAD_CACHE
+  if (len <= thread_cache_max_len && alignment == ALIGNED_MALLOC_MINIMUM_ALIGNMENT) {
+    if (ThreadCache *cache = thread_cache_get()) {
+      if (void *block = thread_cache_pop(cache->aligned_bins, len)) {
+        return block;
+      }
+    }
+    alloc_len = thread_cache_class_len_max(thread_cache_class(len));
+  }
+#endif
+  return aligned_malloc(alloc_len + MEMHEAD_ALIGN_PADDING(alignment) + sizeof(MemHeadAligned),
+                        alignment);
+}
+
+static void mem_block_free_aligned(MemHeadAligned *memh, const size_t len)
+{
+  void *block = MEMHEAD_REAL_PTR(memh);
+#ifdef USE_THREAD_CACHE
+  if (len <= thread_cache_max_len && size_t(memh->alignment) == ALIGNED_MALLOC_MINIMUM_ALIGNMENT)
+  {
+    if (ThreadCache *cache = thread_cache_get()) {
+      if (thread_cache_push(cache->aligned_bins, len, block)) {
+        return;
+      }
+    }
+  }
+#else
+  (void)len;
+#endif
+  aligned_free(block);
+}
+
+/** \} */
+
 size_t MEM_lockfree_allocN_len(const void *vmemh)
 {
   if (LIKELY(vmemh)) {
@@ -163,17 +362,16 @@ void MEM_lockfree_freeN(void *vmemh, DestructorType destructor_type)
                             "CPP-style MEM_new or new\n");
   }
 
-  memory_usage_block_free(len);
+  memory_usage_block_free(len, MEMHEAD_CATEGORY(memh));
 
   if (UNLIKELY(malloc_debug_memset && len)) {
     memset(memh + 1, 255, len);
   }
   if (UNLIKELY(MEMHEAD_IS_ALIGNED(memh))) {
-    MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
-    aligned_free(MEMHEAD_REAL_PTR(memh_aligned));
+    mem_block_free_aligned(MEMHEAD_ALIGNED_FROM_PTR(vmemh), len);
   }
   else {
-    free(memh);
+    mem_block_free(memh, len);
   }
 }
 
@@ -302,11 +500,12 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
 
   len = SIZET_ALIGN_4(len);
 
-  memh = (MemHead *)calloc(1, len + sizeof(MemHead));
+  memh = mem_block_alloc(len, true);
 
   if (LIKELY(memh)) {
-    memh->len = len;
-    memory_usage_block_alloc(len);
+    const int category = memory_usage_category_get();
+    memh->len = len | MEMHEAD_CATEGORY_BITS(category);
+    memory_usage_block_alloc(len, category);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -344,7 +543,7 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 #endif
   len = SIZET_ALIGN_4(len);
 
-  memh = (MemHead *)malloc(len + sizeof(MemHead));
+  memh = mem_block_alloc(len, false);
 
   if (LIKELY(memh)) {
 
@@ -362,8 +561,9 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 #endif /* WITH_MEM_VALGRIND */
     }
 
-    memh->len = len;
-    memory_usage_block_alloc(len);
+    const int category = memory_usage_category_get();
+    memh->len = len | MEMHEAD_CATEGORY_BITS(category);
+    memory_usage_block_alloc(len, category);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -422,8 +622,7 @@ void *MEM_lockfree_mallocN_aligned(size_t len,
 #endif
   len = SIZET_ALIGN_4(len);
 
-  MemHeadAligned *memh = (MemHeadAligned *)aligned_malloc(
-      len + extra_padding + sizeof(MemHeadAligned), alignment);
+  MemHeadAligned *memh = (MemHeadAligned *)mem_block_alloc_aligned(len, alignment);
 
   if (LIKELY(memh)) {
     /* We keep padding in the beginning of MemHead,
@@ -446,12 +645,14 @@ void *MEM_lockfree_mallocN_aligned(size_t len,
 #endif /* WITH_MEM_VALGRIND */
     }
 
+    const int category = memory_usage_category_get();
     memh->len = len | size_t(MEMHEAD_FLAG_ALIGN) |
                 size_t(destructor_type == DestructorType::NonTrivial ?
                            MEMHEAD_FLAG_NONTRIVIAL_DESTRUCTOR :
-                           0);
+                           0) |
+                MEMHEAD_CATEGORY_BITS(category);
     memh->alignment = short(alignment);
-    memory_usage_block_alloc(len);
+    memory_usage_block_alloc(len, category);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -54,6 +55,11 @@ struct alignas(128) Local {
    * accurate, but it's still good enough for practical purposes.
    */
   std::atomic<int64_t> mem_in_use_during_peak_update = 0;
+  /**
+   * Number of bytes per memory category, see #MEM_memory_category_set. Can be negative and is
+   * atomic for the same reason as above. The value for #MEM_MEMORY_CATEGORY_NONE is not used.
+   */
+  std::atomic<int64_t> category_mem_in_use[MEM_MEMORY_CATEGORIES_MAX] = {};
 
   Local();
   ~Local();
@@ -90,10 +96,21 @@ struct Global {
    * Number of blocks that are not tracked by #Local, for the same reason as above.
    */
   std::atomic<int64_t> blocks_num_outside_locals = 0;
+  /**
+   * Number of bytes per memory category that are not tracked by #Local, for the same reason as
+   * above.
+   */
+  std::atomic<int64_t> category_mem_in_use_outside_locals[MEM_MEMORY_CATEGORIES_MAX] = {};
   /**
    * Peak memory usage since the last reset.
    */
   std::atomic<size_t> peak = 0;
+
+  /** Protects the registration of new memory categories. */
+  std::mutex categories_mutex;
+  /** Names of the registered memory categories, the first one is #MEM_MEMORY_CATEGORY_NONE. */
+  std::atomic<const char *> category_names[MEM_MEMORY_CATEGORIES_MAX] = {"Other"};
+  std::atomic<int> categories_num = 1;
 };
 
 }  // namespace
@@ -103,6 +120,11 @@ struct Global {
  * false indicating that global counters should be used for correctness.
  */
 static std::atomic<bool> use_local_counters = true;
+/**
+ * The memory category of allocations on the current thread. This is trivially destructible, so
+ * that it can still be accessed while the program exits.
+ */
+static thread_local int current_category = MEM_MEMORY_CATEGORY_NONE;
 /**
  * When a thread allocated this amount of memory, the peak memory usage is updated. An alternative
  * would be to update the global peak memory after every allocation, but that would cause much more
@@ -152,6 +174,10 @@ Local::~Local()
   /* Don't forget the memory counts stored locally. */
   this->global->blocks_num_outside_locals.fetch_add(this->blocks_num, std::memory_order_relaxed);
   this->global->mem_in_use_outside_locals.fetch_add(this->mem_in_use, std::memory_order_relaxed);
+  for (int category = 0; category < MEM_MEMORY_CATEGORIES_MAX; category++) {
+    this->global->category_mem_in_use_outside_locals[category].fetch_add(
+        this->category_mem_in_use[category], std::memory_order_relaxed);
+  }
 
   if (this->is_main) {
     /* The main thread started shutting down. Use global counters from now on to avoid accessing
@@ -185,7 +211,7 @@ void memory_usage_init()
   get_local_data();
 }
 
-void memory_usage_block_alloc(const size_t size)
+void memory_usage_block_alloc(const size_t size, const int category)
 {
   if (LIKELY(use_local_counters.load(std::memory_order_relaxed))) {
     Local &local = get_local_data();
@@ -195,6 +221,9 @@ void memory_usage_block_alloc(const size_t size)
      * time, which is very rare compared to doing allocations. */
     local.blocks_num.fetch_add(1, std::memory_order_relaxed);
     local.mem_in_use.fetch_add(int64_t(size), std::memory_order_relaxed);
+    if (category != MEM_MEMORY_CATEGORY_NONE) {
+      local.category_mem_in_use[category].fetch_add(int64_t(size), std::memory_order_relaxed);
+    }
 
     /* If a certain amount of new memory has been allocated, update the peak. */
     if (local.mem_in_use - local.mem_in_use_during_peak_update > peak_update_threshold) {
@@ -206,10 +235,14 @@ void memory_usage_block_alloc(const size_t size)
     /* Increase global memory counts. */
     global.blocks_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
     global.mem_in_use_outside_locals.fetch_add(int64_t(size), std::memory_order_relaxed);
+    if (category != MEM_MEMORY_CATEGORY_NONE) {
+      global.category_mem_in_use_outside_locals[category].fetch_add(int64_t(size),
+                                                                    std::memory_order_relaxed);
+    }
   }
 }
 
-void memory_usage_block_free(const size_t size)
+void memory_usage_block_free(const size_t size, const int category)
 {
   if (LIKELY(use_local_counters)) {
     /* Decrease local memory counts. See comment in #memory_usage_block_alloc for details regarding
@@ -217,12 +250,19 @@ void memory_usage_block_free(const size_t size)
     Local &local = get_local_data();
     local.mem_in_use.fetch_sub(int64_t(size), std::memory_order_relaxed);
     local.blocks_num.fetch_sub(1, std::memory_order_relaxed);
+    if (category != MEM_MEMORY_CATEGORY_NONE) {
+      local.category_mem_in_use[category].fetch_sub(int64_t(size), std::memory_order_relaxed);
+    }
   }
   else {
     Global &global = get_global();
     /* Decrease global memory counts. */
     global.blocks_num_outside_locals.fetch_sub(1, std::memory_order_relaxed);
     global.mem_in_use_outside_locals.fetch_sub(int64_t(size), std::memory_order_relaxed);
+    if (category != MEM_MEMORY_CATEGORY_NONE) {
+      global.category_mem_in_use_outside_locals[category].fetch_sub(int64_t(size),
+                                                                    std::memory_order_relaxed);
+    }
   }
 }
 
@@ -264,3 +304,67 @@ void memory_usage_peak_reset()
   Global &global = get_global();
   global.peak = memory_usage_current();
 }
+
+int memory_usage_category_get()
+{
+  return current_category;
+}
+
+int MEM_memory_category_register(const char *name)
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.categories_mutex};
+  const int categories_num = global.categories_num.load(std::memory_order_relaxed);
+  for (int category = 0; category < categories_num; category++) {
+    if (strcmp(global.category_names[category], name) == 0) {
+      return category;
+    }
+  }
+  if (categories_num == MEM_MEMORY_CATEGORIES_MAX) {
+    return MEM_MEMORY_CATEGORY_NONE;
+  }
+  global.category_names[categories_num].store(name, std::memory_order_relaxed);
+  global.categories_num.store(categories_num + 1, std::memory_order_release);
+  return categories_num;
+}
+
+int MEM_memory_categories_num()
+{
+  return get_global().categories_num.load(std::memory_order_acquire);
+}
+
+const char *MEM_memory_category_name(const int category)
+{
+  assert(category >= 0 && category < MEM_memory_categories_num());
+  return get_global().category_names[category].load(std::memory_order_relaxed);
+}
+
+int MEM_memory_category_set(const int category)
+{
+  assert(category >= 0 && category < MEM_MEMORY_CATEGORIES_MAX);
+  const int previous_category = current_category;
+  current_category = category;
+  return previous_category;
+}
+
+size_t MEM_memory_category_in_use(const int category)
+{
+  if (category == MEM_MEMORY_CATEGORY_NONE) {
+    int64_t mem_in_use = int64_t(memory_usage_current());
+    for (int other = 1; other < MEM_memory_categories_num(); other++) {
+      mem_in_use -= int64_t(MEM_memory_category_in_use(other));
+    }
+    return size_t(std::max<int64_t>(mem_in_use, 0));
+  }
+
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  int64_t mem_in_use = global.category_mem_in_use_outside_locals[category];
+  for (const Local *local : global.locals) {
+    mem_in_use += local->category_mem_in_use[category];
+  }
+  /* Can be negative temporarily because the counters of different threads are not read at the
+   * same time. */
+  return size_t(std::max<int64_t>(mem_in_use, 0));
+}
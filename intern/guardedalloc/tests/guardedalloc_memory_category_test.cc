@@ -0,0 +1,47 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <thread>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+#include "guardedalloc_test_base.h"
+
+TEST_F(LockFreeAllocatorTest, MemoryCategoryRegister)
+{
+  const int category = MEM_memory_category_register("Test Register");
+  EXPECT_NE(category, MEM_MEMORY_CATEGORY_NONE);
+  EXPECT_EQ(MEM_memory_category_register("Test Register"), category);
+  EXPECT_STREQ(MEM_memory_category_name(category), "Test Register");
+  EXPECT_LT(category, MEM_memory_categories_num());
+}
+
+TEST_F(LockFreeAllocatorTest, MemoryCategoryInUse)
+{
+  const int category = MEM_memory_category_register("Test In Use");
+  const size_t mem_in_use = MEM_memory_category_in_use(category);
+
+  void *untagged = MEM_new_uninitialized(100, __func__);
+  void *tagged;
+  int *tagged_aligned;
+  {
+    const MEM_MemoryCategoryScope scope(category);
+    tagged = MEM_new_zeroed(1000, __func__);
+    tagged_aligned = MEM_new<int>(__func__, 5);
+  }
+  EXPECT_EQ(MEM_memory_category_in_use(category), mem_in_use + 1000 + sizeof(int));
+  /* The category is not part of the length. */
+  EXPECT_EQ(MEM_allocN_len(tagged), 1000);
+
+  /* Freeing on another thread still decreases the memory of the category. */
+  std::thread thread([&]() {
+    MEM_delete_void(tagged);
+    MEM_delete(tagged_aligned);
+  });
+  thread.join();
+  EXPECT_EQ(MEM_memory_category_in_use(category), mem_in_use);
+
+  MEM_delete_void(untagged);
+}
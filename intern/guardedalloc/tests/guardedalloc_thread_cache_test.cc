@@ -0,0 +1,98 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing/testing.h"
+
+#include "BLI_timeit.hh"
+
+#include "MEM_guardedalloc.h"
+#include "guardedalloc_test_base.h"
+
+namespace {
+
+/* Allocate and free blocks of all small sizes a few times, so that freed blocks get reused. */
+void AllocateSmallBlocks(const int iterations)
+{
+  std::vector<void *> blocks;
+  for (int iteration = 0; iteration < iterations; iteration++) {
+    for (size_t size = 0; size <= 300; size++) {
+      blocks.push_back(MEM_new_uninitialized(size, __func__));
+      blocks.push_back(MEM_new_uninitialized_aligned(size, 8, __func__));
+    }
+    for (void *block : blocks) {
+      MEM_delete_void(block);
+    }
+    blocks.clear();
+  }
+}
+
+}  // namespace
+
+TEST_F(LockFreeAllocatorTest, ThreadCacheZeroedReuse)
+{
+  for (size_t size = 1; size <= 300; size++) {
+    char *data = static_cast<char *>(MEM_new_uninitialized(size, __func__));
+    memset(data, 255, size);
+    MEM_delete(data);
+
+    /* The block can come from the cache and must still be zeroed. */
+    data = static_cast<char *>(MEM_new_zeroed(size, __func__));
+    for (size_t i = 0; i < size; i++) {
+      EXPECT_EQ(data[i], 0);
+    }
+    MEM_delete(data);
+  }
+}
+
+TEST_F(LockFreeAllocatorTest, ThreadCacheMemoryUsage)
+{
+  const size_t blocks_num = MEM_get_memory_blocks_in_use();
+  const size_t mem_in_use = MEM_get_memory_in_use();
+  AllocateSmallBlocks(3);
+  /* Cached blocks are not counted as used memory. */
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_num);
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_in_use);
+}
+
+TEST_F(LockFreeAllocatorTest, ThreadCacheFreeOnOtherThread)
+{
+  const size_t blocks_num = MEM_get_memory_blocks_in_use();
+  std::vector<int *> blocks;
+  for (int i = 0; i < 1000; i++) {
+    int *value = MEM_new<int>(__func__, i);
+    blocks.push_back(value);
+  }
+  std::thread thread([&]() {
+    for (int i = 0; i < 1000; i++) {
+      EXPECT_EQ(*blocks[i], i);
+      MEM_delete(blocks[i]);
+    }
+    /* Blocks that were freed on another thread can be reused by this thread. */
+    AllocateSmallBlocks(1);
+  });
+  thread.join();
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_num);
+}
+
+/* Measures allocating and freeing many small blocks on multiple threads at once, like during
+ * depsgraph evaluation. Disabled by default because of its run-time. */
+TEST_F(LockFreeAllocatorTest, DISABLED_ThreadCacheBenchmark)
+{
+  for (const int threads_num : {1, 4, 16}) {
+    blender::timeit::ScopedTimer timer("Small allocations on " + std::to_string(threads_num) +
+                                       " threads");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threads_num; i++) {
+      threads.emplace_back([]() { AllocateSmallBlocks(1000); });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+  }
+}
@@ -1244,24 +1244,35 @@ bool BruteTranslationOnlyInitialize(const FloatImage& image1,
   int w = pattern.cols();
   int h = pattern.rows();
 
+  // The mask is non-negative, so mask * |pattern - search| equals
+  // |mask * pattern - mask * search|. Premultiplying the pattern once means
+  // the search block only has to be masked once per shift, which is also what
+  // the normalization needs.
+  const FloatArray masked_pattern = mask * pattern;
+  FloatArray masked_search(h, w);
+
   for (int r = 0; r < (image2.Height() - h); ++r) {
     for (int c = 0; c < (image2.Width() - w); ++c) {
-      // Compute the weighted sum of absolute differences, Eigen style. Note
-      // that the block from the search image is never stored in a variable, to
-      // avoid copying overhead and permit inlining.
-      double sad;
+      // Note that the block from the search image is never stored in a
+      // variable, to avoid copying overhead and permit inlining.
+      masked_search = mask * search.block(r, c, h, w);
+      float inverse_search_mean = 1.0f;
       if (use_normalized_intensities) {
         // TODO(keir): It's really dumb to recompute the search mean for every
         // shift. A smarter implementation would use summed area tables
         // instead, reducing the mean calculation to an O(1) operation.
-        double inverse_search_mean =
-            mask_sum / ((mask * search.block(r, c, h, w)).sum());
-        sad = (mask *
-               (pattern - (search.block(r, c, h, w) * inverse_search_mean)))
-                  .abs()
-                  .sum();
-      } else {
-        sad = (mask * (pattern - search.block(r, c, h, w))).abs().sum();
+        inverse_search_mean = mask_sum / masked_search.sum();
+      }
+
+      // Accumulate the weighted sum of absolute differences row by row, so
+      // that shifts which are already worse than the best one can be rejected
+      // early. Rows are contiguous, so each of them is vectorized by Eigen.
+      double sad = 0.0;
+      for (int i = 0; i < h && sad < best_sad; ++i) {
+        sad += (masked_pattern.row(i) -
+                masked_search.row(i) * inverse_search_mean)
+                   .abs()
+                   .sum();
       }
       if (sad < best_sad) {
         best_r = r;
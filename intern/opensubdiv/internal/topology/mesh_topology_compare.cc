@@ -6,15 +6,39 @@
 
 #include "internal/topology/mesh_topology.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstring>
 #include <opensubdiv/sdc/crease.h>
 #include <vector>
 
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
 #include "opensubdiv_converter_capi.hh"
 
 namespace blender::opensubdiv {
 
+// Check whether the predicate holds for all elements. The elements are checked in parallel, and
+// the check stops early once any element does not match.
+template<typename Predicate>
+static bool allOfParallel(const int num_elements, const Predicate &predicate)
+{
+  std::atomic<bool> all_match = true;
+  threading::parallel_for(IndexRange(num_elements), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      if (!all_match.load(std::memory_order_relaxed)) {
+        return;
+      }
+      if (!predicate(int(i))) {
+        all_match.store(false, std::memory_order_relaxed);
+        return;
+      }
+    }
+  });
+  return all_match;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Quick preliminary checks.
 
@@ -78,22 +102,18 @@ static bool isEqualGeometryFace(const MeshTopology &mesh_topology,
     return false;
   }
 
-  std::vector<int> vertices_of_face;
-  for (int face_index = 0; face_index < num_requested_faces; ++face_index) {
-    int num_face_vertices = converter->faces[face_index].size();
+  return allOfParallel(num_requested_faces, [&](const int face_index) {
+    const int num_face_vertices = converter->faces[face_index].size();
     if (mesh_topology.getNumFaceVertices(face_index) != num_face_vertices) {
       return false;
     }
 
-    vertices_of_face.resize(num_face_vertices);
+    Vector<int, 16> vertices_of_face(num_face_vertices);
     converter->getFaceVertices(converter, face_index, vertices_of_face.data());
 
-    if (!mesh_topology.isFaceVertexIndicesEqual(face_index, vertices_of_face)) {
-      return false;
-    }
-  }
-
-  return true;
+    return mesh_topology.isFaceVertexIndicesEqual(
+        face_index, num_face_vertices, vertices_of_face.data());
+  });
 }
 
 // Geometry comparison entry point.
@@ -137,16 +157,11 @@ static bool isEqualVertexTags(const MeshTopology &mesh_topology,
                               const OpenSubdiv_Converter *converter)
 {
   const int num_vertices = mesh_topology.getNumVertices();
-  for (int vertex_index = 0; vertex_index < num_vertices; ++vertex_index) {
+  return allOfParallel(num_vertices, [&](const int vertex_index) {
     const float current_sharpness = mesh_topology.getVertexSharpness(vertex_index);
     const float requested_sharpness = getEffectiveVertexSharpness(converter, vertex_index);
-
-    if (current_sharpness != requested_sharpness) {
-      return false;
-    }
-  }
-
-  return true;
+    return current_sharpness == requested_sharpness;
+  });
 }
 
 // Edges.
@@ -165,7 +180,7 @@ static bool isEqualEdgeTags(const MeshTopology &mesh_topology,
                             const OpenSubdiv_Converter *converter)
 {
   const int num_edges = mesh_topology.getNumEdges();
-  for (int edge_index = 0; edge_index < num_edges; ++edge_index) {
+  return allOfParallel(num_edges, [&](const int edge_index) {
     const float current_sharpness = mesh_topology.getEdgeSharpness(edge_index);
     const float requested_sharpness = getEffectiveEdgeSharpness(converter, edge_index);
 
@@ -174,19 +189,14 @@ static bool isEqualEdgeTags(const MeshTopology &mesh_topology,
     }
 
     if (current_sharpness < 1e-6f) {
-      continue;
+      return true;
     }
 
     int requested_edge_vertices[2];
     converter->getEdgeVertices(converter, edge_index, requested_edge_vertices);
-    if (!mesh_topology.isEdgeEqual(
-            edge_index, requested_edge_vertices[0], requested_edge_vertices[1]))
-    {
-      return false;
-    }
-  }
-
-  return true;
+    return mesh_topology.isEdgeEqual(
+        edge_index, requested_edge_vertices[0], requested_edge_vertices[1]);
+  });
 }
 
 // Tags comparison entry point.
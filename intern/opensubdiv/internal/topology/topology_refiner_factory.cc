@@ -13,6 +13,8 @@
 
 #include <opensubdiv/far/topologyRefinerFactory.h>
 
+#include "BLI_task.hh"
+
 #include "internal/base/type_convert.h"
 #include "internal/topology/mesh_topology.h"
 
@@ -113,13 +115,19 @@ inline bool TopologyRefinerFactory<TopologyRefinerData>::assignComponentTopology
   const blender::OffsetIndices<int> src_faces = converter->faces;
 
   // Vertices of face.
-  for (const int face_index : src_faces.index_range()) {
-    IndexArray dst_face_verts = getBaseFaceVertices(refiner, face_index);
-    converter->getFaceVertices(converter, face_index, &dst_face_verts[0]);
-
-    base_mesh_topology->setFaceVertexIndices(
-        face_index, dst_face_verts.size(), &dst_face_verts[0]);
-  }
+  //
+  // NOTE: The storage for all faces is allocated already when resizing the topology, so the faces
+  // can be filled in parallel.
+  blender::threading::parallel_for(
+      src_faces.index_range(), 4096, [&](const blender::IndexRange range) {
+        for (const int face_index : range) {
+          IndexArray dst_face_verts = getBaseFaceVertices(refiner, face_index);
+          converter->getFaceVertices(converter, face_index, &dst_face_verts[0]);
+
+          base_mesh_topology->setFaceVertexIndices(
+              face_index, dst_face_verts.size(), &dst_face_verts[0]);
+        }
+      });
 
   // If converter does not provide full topology, we are done.
   //
@@ -274,13 +282,16 @@ inline bool TopologyRefinerFactory<TopologyRefinerData>::assignFaceVaryingTopolo
     const int channel = createBaseFVarChannel(refiner, num_uvs);
     // TODO(sergey): Need to check whether converter changed the winding of
     // face to match OpenSubdiv's expectations.
-    for (int face_index = 0; face_index < num_faces; ++face_index) {
-      Far::IndexArray dst_face_uvs = getBaseFaceFVarValues(refiner, face_index, channel);
-      for (int corner = 0; corner < dst_face_uvs.size(); ++corner) {
-        const int uv_index = converter->getFaceCornerUVIndex(converter, face_index, corner);
-        dst_face_uvs[corner] = uv_index;
-      }
-    }
+    blender::threading::parallel_for(
+        blender::IndexRange(num_faces), 4096, [&](const blender::IndexRange range) {
+          for (const int face_index : range) {
+            Far::IndexArray dst_face_uvs = getBaseFaceFVarValues(refiner, face_index, channel);
+            for (int corner = 0; corner < dst_face_uvs.size(); ++corner) {
+              const int uv_index = converter->getFaceCornerUVIndex(converter, face_index, corner);
+              dst_face_uvs[corner] = uv_index;
+            }
+          }
+        });
     converter->finishUVLayer(converter);
   }
   return true;
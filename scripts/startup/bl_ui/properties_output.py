@@ -323,6 +323,7 @@ class RENDER_PT_output(RenderOutputButtonsPanel, Panel):
             col = layout.column(heading="Image Sequence")
             col.prop(rd, "use_overwrite")
             col.prop(rd, "use_placeholder")
+            col.prop(rd, "use_save_background")
 
 
 class RENDER_PT_output_views(RenderOutputButtonsPanel, Panel):
@@ -447,6 +447,7 @@ class SCENE_PT_eevee_light_probes(SceneButtonsPanel, Panel):
         row = col.row(align=True)
         row.operator("object.lightprobe_cache_bake", text="Bake All Light Probe Volumes").subset = 'ALL'
         row.operator("object.lightprobe_cache_free", text="", icon='TRASH').subset = 'ALL'
+        col.operator("object.lightprobe_cache_bake", text="Bake Modified Light Probe Volumes").subset = 'DIRTY'
 
 
 class SCENE_PT_animation(SceneButtonsPanel, PropertiesAnimationMixin, PropertyPanel, Panel):
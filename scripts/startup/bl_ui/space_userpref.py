@@ -843,6 +843,7 @@ class USERPREF_PT_system_memory(SystemPanel, CenterAlignMixIn, Panel):
         col = layout.column()
         col.prop(system, "texture_time_out", text="Texture Time Out")
         col.prop(system, "texture_collection_rate", text="Garbage Collection Rate")
+        col.prop(system, "texture_memory_limit", text="Memory Limit")
 
         layout.separator()
 
@@ -871,6 +872,16 @@ class USERPREF_PT_system_video_sequencer(SystemPanel, CenterAlignMixIn, Panel):
         layout.separator()
 
         layout.prop(system, "sequencer_proxy_setup")
+        layout.prop(system, "sequencer_proxy_build_jobs")
+        layout.prop(system, "use_sequencer_hardware_decoding")
+
+        layout.separator()
+
+        layout.prop(system, "use_sequencer_disk_cache")
+        col = layout.column()
+        col.active = system.use_sequencer_disk_cache
+        col.prop(system, "sequencer_disk_cache_size_limit")
+        col.prop(system, "sequencer_disk_cache_compression", text="Compression")
 
 
 # -----------------------------------------------------------------------------
@@ -3009,6 +3020,11 @@ class USERPREF_PT_developer_tools(Panel):
                 ({"property": "override_auto_resync"}, ("blender/blender/issues/83811", "#83811")),
                 ({"property": "use_all_linked_data_direct"}, None),
                 ({"property": "use_recompute_usercount_on_save_debug"}, None),
+                ({"property": "use_parallel_blend_write"}, None),
+                ({"property": "use_async_autosave"}, None),
+                ({"property": "use_depsgraph_critical_path_scheduling"}, None),
+                ({"property": "use_geometry_nodes_result_cache"}, None),
+                ({"property": "use_sculpt_undo_paging"}, None),
                 ({"property": "use_cycles_debug"}, None),
                 ({"property": "show_asset_debug_info"}, None),
                 ({"property": "use_asset_indexing"}, None),
@@ -139,6 +139,13 @@ class EvaluationResult {
   }
 };
 
+class EvaluationCache;
+
+/**
+ * Free the cache that the evaluation stores on evaluated data-blocks, see #EvaluationCache.
+ */
+void evaluation_cache_free(EvaluationCache *cache);
+
 /**
  * Evaluate the given action for the given slot and animated ID.
  *
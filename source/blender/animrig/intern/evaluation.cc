@@ -6,11 +6,14 @@
 
 #include "BKE_animsys.h"
 #include "BKE_fcurve.hh"
+#include "BKE_lib_id.hh"
 
 #include "BLI_map.hh"
 #include "BLI_math_base.hh"
 #include "BLI_task.hh"
 
+#include "DNA_ID.h"
+
 #include "CLG_log.h"
 
 #include "evaluation_internal.hh"
@@ -144,6 +147,64 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+void evaluation_cache_free(EvaluationCache *cache)
+{
+  MEM_delete(cache);
+}
+
+/**
+ * Get the cached paths of the FCurves of the given channelbag, or an empty span when the animated
+ * data-block is not an evaluated copy.
+ */
+static MutableSpan<EvaluationCache::FCurvePath> cached_fcurve_paths_ensure(
+    PointerRNA &animated_id_ptr, const Channelbag &channelbag)
+{
+  ID *animated_id = animated_id_ptr.owner_id;
+  if (!animated_id || !animated_id->runtime || !(animated_id->tag & ID_TAG_COPIED_ON_EVAL)) {
+    return {};
+  }
+  EvaluationCache *&cache = animated_id->runtime->anim_eval_cache;
+  if (!cache) {
+    cache = MEM_new<EvaluationCache>(__func__);
+  }
+  Array<EvaluationCache::FCurvePath> &paths = cache->channelbags.lookup_or_add_default(
+      &channelbag);
+  if (paths.size() != channelbag.fcurves().size()) {
+    paths.reinitialize(channelbag.fcurves().size());
+  }
+  return paths;
+}
+
+/**
+ * Resolve the RNA path of the FCurve, reusing and updating the cached result when available.
+ */
+static bool fcurve_path_resolve(PointerRNA &animated_id_ptr,
+                                const FCurve &fcu,
+                                EvaluationCache::FCurvePath *cached_path,
+                                PathResolvedRNA &r_anim_rna)
+{
+  if (cached_path && cached_path->fcurve == &fcu && cached_path->array_index == fcu.array_index &&
+      cached_path->rna_path == fcu.rna_path)
+  {
+    r_anim_rna = cached_path->resolved_rna;
+    return true;
+  }
+  const bool resolved = BKE_animsys_rna_path_resolve(
+      &animated_id_ptr, fcu.rna_path, fcu.array_index, &r_anim_rna);
+  if (cached_path) {
+    if (resolved && r_anim_rna.ptr.owner_id == animated_id_ptr.owner_id) {
+      cached_path->fcurve = &fcu;
+      cached_path->rna_path = fcu.rna_path;
+      cached_path->array_index = fcu.array_index;
+      cached_path->resolved_rna = r_anim_rna;
+    }
+    else {
+      cached_path->fcurve = nullptr;
+    }
+  }
+  return resolved;
+}
+
 static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
                                                StripKeyframeData &strip_data,
                                                const slot_handle_t slot_handle,
@@ -160,6 +221,8 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
   Array<bool> valid(fcurves.size(), false);
   Array<float> results(fcurves.size());
   Array<PathResolvedRNA> resolved_rna(fcurves.size());
+  const MutableSpan<EvaluationCache::FCurvePath> cached_paths = cached_fcurve_paths_ensure(
+      animated_id_ptr, *channelbag_for_slot);
 
   threading::parallel_for(fcurves.index_range(), 512, [&](const IndexRange range) {
     for (const int i : range) {
@@ -170,9 +233,9 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
       /* Resolve the RNA path to skip unresolvable properties. It's faster to do that in a thread
        * and store the result for later. */
       PathResolvedRNA &anim_rna = resolved_rna[i];
-      if (!BKE_animsys_rna_path_resolve(
-              &animated_id_ptr, fcu->rna_path, fcu->array_index, &anim_rna))
-      {
+      EvaluationCache::FCurvePath *cached_path = cached_paths.is_empty() ? nullptr :
+                                                                           &cached_paths[i];
+      if (!fcurve_path_resolve(animated_id_ptr, *fcu, cached_path, anim_rna)) {
         continue;
       }
       BLI_assert(fcu->driver == nullptr);
@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <string>
+
+#include "BLI_array.hh"
+#include "BLI_map.hh"
+
 #include "ANIM_evaluation.hh"
 struct Action;
 struct Layer;
@@ -11,6 +16,37 @@ namespace blender {
 
 struct AnimationEvalContext;
 struct PointerRNA;
+namespace animrig {
+
+/**
+ * Cache of the resolved RNA paths of the FCurves animating an evaluated data-block, so that the
+ * paths don't have to be resolved again on every evaluation of the animation.
+ *
+ * The structure of evaluated data-blocks only changes when they are copied from the original
+ * again, which frees this cache as part of the #ID runtime data. Changes to the evaluated Action
+ * are detected by comparing the cached FCurve identifiers with the current ones. Paths that
+ * resolve into another data-block are not cached, as that data-block can be updated
+ * independently.
+ *
+ * \note This is NOT thread-safe, it relies on a data-block only being animated by one thread at a
+ * time.
+ */
+class EvaluationCache {
+ public:
+  struct FCurvePath {
+    /** The FCurve of which the path was resolved, null when nothing is cached. */
+    const FCurve *fcurve = nullptr;
+    std::string rna_path;
+    int array_index = 0;
+    PathResolvedRNA resolved_rna;
+  };
+
+  /** The cached paths for every FCurve of a channelbag, in the order of the FCurves. */
+  Map<const Channelbag *, Array<FCurvePath>> channelbags;
+};
+
+}  // namespace animrig
+
 namespace animrig::internal {
 
 /**
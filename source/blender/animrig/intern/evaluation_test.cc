@@ -286,6 +286,39 @@ TEST_F(AnimationEvaluationTest, strip_boundaries__overlapping_edge)
   EXPECT_TRUE(test_evaluate_layer_no_result("location", 0, 19.001f));
 }
 
+TEST_F(AnimationEvaluationTest, evaluation_cache)
+{
+  Strip &strip = layer->strip_add(*action, Strip::Type::Keyframe);
+  StripKeyframeData &strip_data = strip.data<StripKeyframeData>(*action);
+  strip_data.keyframe_insert(bmain, *slot, {"location", 0}, {1.0f, 47.1f}, settings);
+  strip_data.keyframe_insert(bmain, *slot, {"location", 0}, {5.0f, 47.5f}, settings);
+
+  /* Only evaluated copies cache their resolved paths. */
+  EXPECT_TRUE(test_evaluate_layer("location", 0, {3.0f, 47.3f}));
+  EXPECT_EQ(nullptr, cube->id.runtime->anim_eval_cache);
+
+  cube->id.tag |= ID_TAG_COPIED_ON_EVAL;
+  EXPECT_TRUE(test_evaluate_layer("location", 0, {3.0f, 47.3f}));
+  ASSERT_NE(nullptr, cube->id.runtime->anim_eval_cache);
+  Channelbag *channelbag = strip_data.channelbag_for_slot(*slot);
+  const Array<EvaluationCache::FCurvePath> *cached_paths =
+      cube->id.runtime->anim_eval_cache->channelbags.lookup_ptr(channelbag);
+  ASSERT_NE(nullptr, cached_paths);
+  ASSERT_EQ(1, cached_paths->size());
+  EXPECT_EQ(channelbag->fcurve(0), (*cached_paths)[0].fcurve);
+  EXPECT_EQ(cube, (*cached_paths)[0].resolved_rna.ptr.data);
+  EXPECT_TRUE(test_evaluate_layer("location", 0, {5.0f, 47.5f}));
+
+  /* Changing the FCurve should not use the stale cached path. */
+  FCurve *fcurve = channelbag->fcurve(0);
+  fcurve->array_index = 2;
+  EXPECT_TRUE(test_evaluate_layer("location", 2, {3.0f, 47.3f}));
+  EXPECT_TRUE(test_evaluate_layer_no_result("location", 0, 3.0f));
+  EXPECT_EQ(2, (*cached_paths)[0].array_index);
+
+  cube->id.tag &= ~ID_TAG_COPIED_ON_EVAL;
+}
+
 class AccessibleEvaluationResult : public EvaluationResult {
  public:
   EvaluationMap &get_map()
@@ -149,6 +149,11 @@ void blf_glyph_cache_release(FontBLF *font)
 
 GlyphCacheBLF::~GlyphCacheBLF()
 {
+  /* Pending glyphs may still use the texture of this cache. */
+  if (g_batch.glyph_cache == this) {
+    blf_batch_draw();
+    g_batch.glyph_cache = nullptr;
+  }
   this->glyphs.clear();
   if (this->texture) {
     GPU_texture_free(this->texture);
@@ -102,7 +102,7 @@ inline ft_pix ft_pix_from_float(float v)
 
 /** \} */
 
-#define BLF_BATCH_DRAW_LEN_MAX 128 /* in glyph */
+#define BLF_BATCH_DRAW_LEN_MAX 1024 /* in glyph */
 
 /** Number of characters in #KerningCacheBLF.table. */
 #define KERNING_CACHE_TABLE_SIZE 128
@@ -111,8 +111,6 @@ inline ft_pix ft_pix_from_float(float v)
 #define KERNING_ENTRY_UNSET INT_MAX
 
 struct BatchBLF {
-  /** Can only batch glyph from the same font. */
-  FontBLF *font;
   gpu::Batch *batch;
   gpu::StorageBuf *glyph_buf;
   int glyph_len;
@@ -10,14 +10,17 @@
 
 #include <optional>
 
+#include "BLI_array.hh"
 #include "BLI_bounds_types.hh"
 #include "BLI_function_ref.hh"
+#include "BLI_implicit_sharing_ptr.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_set.hh"
 
 #include "DNA_armature_types.h"
 #include "DNA_listBase.h"
+#include "DNA_meshdata_types.h"
 
 namespace blender {
 
@@ -655,6 +658,24 @@ void BKE_armature_deform_coords_with_curves(const Object &ob_arm,
                                             int deformflag,
                                             StringRefNull defgrp_name);
 
+/**
+ * The vertex group weights of a mesh stored contiguously, so that deforming doesn't have to follow
+ * the separately allocated weight arrays of every vertex. Owned by the caller (e.g. the modifier)
+ * to be reused between evaluations, it is rebuilt when the weights of the mesh changed.
+ */
+struct ArmatureDeformWeightsCache {
+  /** The vertex group layer the weights were copied from and its version at that time. */
+  WeakImplicitSharingPtr sharing_info;
+  int64_t version = -1;
+  /** Offsets into #weights for every vertex. */
+  Array<int> offsets;
+  Array<MDeformWeight> weights;
+};
+
+/**
+ * \param weights_cache: Optional cache of the weights of the mesh, used instead of reading the
+ * weights of every vertex from the #MDeformVert array.
+ */
 void BKE_armature_deform_coords_with_mesh(const Object &ob_arm,
                                           const Object &ob_target,
                                           MutableSpan<float3> vert_coords,
@@ -662,7 +683,8 @@ void BKE_armature_deform_coords_with_mesh(const Object &ob_arm,
                                           std::optional<MutableSpan<float3x3>> vert_deform_mats,
                                           int deformflag,
                                           StringRefNull defgrp_name,
-                                          const Mesh *me_target);
+                                          const Mesh *me_target,
+                                          ArmatureDeformWeightsCache *weights_cache = nullptr);
 
 void BKE_armature_deform_coords_with_editmesh(
     const Object &ob_arm,
@@ -15,6 +15,10 @@
 
 #include "BKE_bake_items.hh"
 
+namespace blender {
+struct BLI_mmap_file;
+}
+
 namespace blender::bke::bake {
 
 /**
@@ -162,13 +166,25 @@ class BlobReadSharing : NonCopyable, NonMovable {
 };
 
 /**
- * A specific #BlobReader that reads from disk.
+ * A specific #BlobReader that reads from disk. Blob files are memory mapped when possible, so that
+ * multiple threads can read from the same file at the same time without seeking a shared stream.
  */
 class DiskBlobReader : public BlobReader {
  private:
+  struct BlobFile : NonCopyable, NonMovable {
+    int file = -1;
+    BLI_mmap_file *mmap_file = nullptr;
+    /** Fallback used when the file can't be memory mapped. */
+    std::unique_ptr<fstream> stream;
+
+    ~BlobFile();
+  };
+
   const std::string blobs_dir_;
   mutable Mutex mutex_;
-  mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
+  mutable Map<std::string, std::unique_ptr<BlobFile>> open_blob_files_;
+
+  static std::unique_ptr<BlobFile> open_blob_file(const char *blob_path);
 
  public:
   DiskBlobReader(std::string blobs_dir);
@@ -445,6 +445,11 @@ class CurvesGeometry : public blender::CurvesGeometry {
 
   /** Call after deforming the position attribute. */
   void tag_positions_changed();
+  /**
+   * Call after deforming the positions of the given curves only. The evaluated positions of the
+   * other curves are kept in that case, when the cache exists already.
+   */
+  void tag_positions_changed(const IndexMask &changed_curves);
   /**
    * Call after any operation that changes the topology
    * (number of points, evaluated points, or the total count).
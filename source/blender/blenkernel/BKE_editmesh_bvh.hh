@@ -41,6 +41,12 @@ BMBVHTree *BKE_bmbvh_new(struct BMesh *bm,
                          bool cos_cage_free);
 void BKE_bmbvh_free(BMBVHTree *tree);
 struct BVHTree *BKE_bmbvh_tree_get(BMBVHTree *tree);
+/**
+ * Refit the bounds of the tree after the vertex (or cage) coordinates it was created from have
+ * been modified in place. This is much cheaper than creating a new tree, but the topology, the
+ * tessellation and the filtered faces must be unchanged, otherwise a new tree has to be created.
+ */
+void BKE_bmbvh_update_positions(BMBVHTree *tree);
 
 struct BMFace *BKE_bmbvh_ray_cast(const BMBVHTree *tree,
                                   const float co[3],
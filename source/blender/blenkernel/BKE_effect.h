@@ -129,6 +129,12 @@ void BKE_effectors_apply(ListBaseT<EffectorCache> *effectors,
                          float *force,
                          float *wind_force,
                          float *impulse);
+/**
+ * Reset the random number generators of the effectors to the state they were created with. This
+ * allows applying the same effectors to multiple independent points with the same result as
+ * creating the effectors for each point separately.
+ */
+void BKE_effectors_reset_random(ListBaseT<EffectorCache> *effectors);
 void BKE_effectors_free(ListBaseT<EffectorCache> *lb);
 
 void pd_point_from_particle(struct ParticleSimulationData *sim,
@@ -7,8 +7,10 @@
 #include <string>
 
 #include "BLI_array.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_mutex.hh"
 #include "BLI_span.hh"
 
 #include "DNA_key_types.h"
@@ -29,6 +31,24 @@ struct Mesh;
 struct Nurb;
 struct Object;
 
+namespace bke {
+
+struct KeyBlockRuntime {
+  /**
+   * The elements of a relative key that differ from its reference key, so that blending the key
+   * can skip all other elements. Corrective shapes typically only move a small part of the
+   * geometry. Only computed for evaluated keys, whose data doesn't change.
+   */
+  IndexMaskMemory changed_elements_memory;
+  IndexMask changed_elements;
+  /** The data that #changed_elements was computed for. */
+  const void *changed_elements_data = nullptr;
+  const void *changed_elements_reference_data = nullptr;
+  Mutex changed_elements_mutex;
+};
+
+}  // namespace bke
+
 void BKE_key_free_nolib(Key *key);
 Key *BKE_key_add(Main *bmain, ID *id);
 /**
@@ -55,6 +55,10 @@ struct PointerRNA;
 struct PropertyRNA;
 struct bContext;
 
+namespace animrig {
+class EvaluationCache;
+}
+
 namespace bke::id {
 
 /** Status used and counters created during id-remapping. */
@@ -91,6 +95,13 @@ struct ID_Runtime {
    * freed and the pointer set to `nullptr`.
    */
   ID_Readfile_Data *readfile_data = nullptr;
+
+  /**
+   * Resolved RNA paths of the layered Action animating this data-block, only used on data-blocks
+   * that are copied-on-eval by the depsgraph. Freed together with the rest of the runtime data,
+   * which also happens when the evaluated copy is updated from the original.
+   */
+  animrig::EvaluationCache *anim_eval_cache = nullptr;
 };
 
 }  // namespace bke::id
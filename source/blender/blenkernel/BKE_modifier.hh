@@ -9,6 +9,7 @@
 #include "BLI_compiler_attrs.h"
 #include "BLI_enum_flags.hh"
 #include "BLI_function_ref.hh"
+#include "BLI_linear_allocator.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_span.hh"
 
@@ -182,6 +183,13 @@ struct ModifierEvalContext {
   Depsgraph *depsgraph;
   Object *object;
   ModifierApplyFlag flag;
+  /**
+   * Scratch memory that is only freed after the whole modifier stack has been evaluated. Using
+   * it for temporary data avoids allocating and freeing it separately for every modifier. It is
+   * not thread-safe, so it must only be used by the thread evaluating the modifier. Null when the
+   * modifier isn't evaluated as part of an object's modifier stack.
+   */
+  LinearAllocator<> *scratch_allocator = nullptr;
 };
 
 struct ModifierTypeInfo {
@@ -63,6 +63,7 @@ namespace blender {
 #define PTCACHE_READ_OLD 3
 
 /* Structs */
+struct BLI_mmap_file;
 struct BlendDataReader;
 struct BlendWriter;
 struct ClothModifierData;
@@ -95,6 +96,12 @@ struct PTCacheData {
 
 struct PTCacheFile {
   FILE *fp;
+  /**
+   * Files opened for reading are memory mapped if possible, the reads then copy from or decompress
+   * the mapping directly at #mmap_offset, instead of going through #fp.
+   */
+  BLI_mmap_file *mmap_file;
+  size_t mmap_offset;
 
   int frame, old_format;
   unsigned int totpoint, type;
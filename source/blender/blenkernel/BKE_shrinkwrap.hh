@@ -113,8 +113,25 @@ bool BKE_shrinkwrap_init_tree(
  */
 void BKE_shrinkwrap_free_tree(ShrinkwrapTreeData *data);
 
+/**
+ * Data kept by the shrink-wrap modifier between evaluations.
+ */
+struct ShrinkwrapRuntime {
+  /** The shrink type #nearest_index was computed for. */
+  short shrink_type = -1;
+  /**
+   * The target element (vertex or triangle) found for every vertex in the previous evaluation,
+   * or -1. Used to start the nearest search of the next evaluation with a tight bound, which
+   * avoids most of the tree traversal when the vertices only moved a little. Since the previous
+   * element is only used as first candidate, the result doesn't depend on it.
+   */
+  Array<int> nearest_index;
+};
+
 /**
  * Main shrink-wrap function (implementation of the shrink-wrap modifier).
+ *
+ * \param runtime: Optional data to reuse the results of the previous evaluation.
  */
 void shrinkwrapModifier_deform(ShrinkwrapModifierData *smd,
                                const ModifierEvalContext *ctx,
@@ -124,7 +141,8 @@ void shrinkwrapModifier_deform(ShrinkwrapModifierData *smd,
                                const MDeformVert *dvert,
                                int defgrp_index,
                                float (*vertexCos)[3],
-                               int numVerts);
+                               int numVerts,
+                               ShrinkwrapRuntime *runtime);
 
 struct ShrinkwrapParams {
   /** Shrink target. */
@@ -25,6 +25,8 @@ class TopologyRefinerImpl;
 
 namespace bke::subdiv {
 
+struct SourceMeshState;
+
 enum VtxBoundaryInterpolation {
   /** Do not interpolate boundaries. */
   SUBDIV_VTX_BOUNDARY_NONE,
@@ -193,6 +195,11 @@ struct Subdiv {
   Displacement *displacement_evaluator;
   /** Statistics for debugging. */
   SubdivStats stats;
+  /**
+   * The mesh data the topology refiner was last created or validated with, when it was created
+   * from a mesh. Allows reusing the refiner without a full topology comparison.
+   */
+  SourceMeshState *source_mesh_state = nullptr;
 
   /** Cached values, are not supposed to be accessed directly. */
   struct {
@@ -22,6 +22,7 @@
 #include "BLI_math_quaternion.hh"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
+#include "BLI_offset_indices.hh"
 #include "BLI_task.h"
 #include "BLI_task.hh"
 
@@ -361,6 +362,7 @@ template<typename MixerT>
 static void armature_vert_task_with_mixer(const ArmatureDeformParams &params,
                                           const int i,
                                           const MDeformVert *dvert,
+                                          const Span<MDeformWeight> dweights,
                                           MixerT &mixer)
 {
   const bool full_deform = params.vert_deform_mats.has_value();
@@ -393,10 +395,9 @@ static void armature_vert_task_with_mixer(const ArmatureDeformParams &params,
   float contrib = 0.0f;
   bool deformed = false;
   /* Apply vertex group deformation if enabled. */
-  if (params.use_dverts && dvert) {
+  if (params.use_dverts) {
     /* Range of valid def_nr in MDeformWeight. */
     const IndexRange def_nr_range = params.pose_channel_by_vertex_group.index_range();
-    const Span<MDeformWeight> dweights(dvert->dw, dvert->totweight);
     for (const auto &dw : dweights) {
       const bPoseChannel *pchan = def_nr_range.contains(dw.def_nr) ?
                                       params.pose_channel_by_vertex_group[dw.def_nr] :
@@ -463,27 +464,28 @@ static void armature_vert_task_with_mixer(const ArmatureDeformParams &params,
 static void armature_vert_task_with_dvert(const ArmatureDeformParams &deform_params,
                                           const int i,
                                           const MDeformVert *dvert,
+                                          const Span<MDeformWeight> dweights,
                                           const bool use_quaternion)
 {
   const bool full_deform = deform_params.vert_deform_mats.has_value();
   if (use_quaternion) {
     if (full_deform) {
       bke::BoneDeformDualQuaternionMixer<true> mixer;
-      armature_vert_task_with_mixer(deform_params, i, dvert, mixer);
+      armature_vert_task_with_mixer(deform_params, i, dvert, dweights, mixer);
     }
     else {
       bke::BoneDeformDualQuaternionMixer<false> mixer;
-      armature_vert_task_with_mixer(deform_params, i, dvert, mixer);
+      armature_vert_task_with_mixer(deform_params, i, dvert, dweights, mixer);
     }
   }
   else {
     if (full_deform) {
       bke::BoneDeformLinearMixer<true> mixer;
-      armature_vert_task_with_mixer(deform_params, i, dvert, mixer);
+      armature_vert_task_with_mixer(deform_params, i, dvert, dweights, mixer);
     }
     else {
       bke::BoneDeformLinearMixer<false> mixer;
-      armature_vert_task_with_mixer(deform_params, i, dvert, mixer);
+      armature_vert_task_with_mixer(deform_params, i, dvert, dweights, mixer);
     }
   }
 }
@@ -497,7 +499,8 @@ static void armature_deform_coords(const Object &ob_arm,
                                    const std::optional<Span<float3>> vert_coords_prev,
                                    StringRefNull defgrp_name,
                                    const std::optional<Span<MDeformVert>> dverts,
-                                   const Mesh *me_target)
+                                   const Mesh *me_target,
+                                   const ArmatureDeformWeightsCache *weights_cache = nullptr)
 {
   ArmatureDeformParams deform_params = get_armature_deform_params(ob_arm,
                                                                   ob_target,
@@ -526,9 +529,62 @@ static void armature_deform_coords(const Object &ob_arm,
         }
       }
 
-      armature_vert_task_with_dvert(deform_params, i, dvert, use_quaternion);
+      Span<MDeformWeight> dweights;
+      if (weights_cache) {
+        dweights = weights_cache->weights.as_span().slice(
+            OffsetIndices<int>(weights_cache->offsets)[i]);
+      }
+      else if (dvert) {
+        dweights = {dvert->dw, dvert->totweight};
+      }
+
+      armature_vert_task_with_dvert(deform_params, i, dvert, dweights, use_quaternion);
+    }
+  });
+}
+
+/**
+ * Get the weights of the mesh from the cache, copying them into it first if the weights changed
+ * since the cache was built. Returns null if the weights can't be tracked.
+ */
+static const ArmatureDeformWeightsCache *weights_cache_ensure(ArmatureDeformWeightsCache &cache,
+                                                              const Mesh &mesh)
+{
+  const int layer_index = CustomData_get_layer_index(&mesh.vert_data, CD_MDEFORMVERT);
+  if (layer_index == -1) {
+    return nullptr;
+  }
+  const ImplicitSharingInfo *sharing_info = mesh.vert_data.layers[layer_index].sharing_info;
+  if (sharing_info == nullptr) {
+    return nullptr;
+  }
+  if (cache.sharing_info == sharing_info && cache.version == sharing_info->version() &&
+      cache.offsets.size() == mesh.verts_num + 1)
+  {
+    return &cache;
+  }
+
+  const Span<MDeformVert> dverts = mesh.deform_verts();
+  cache.offsets.reinitialize(dverts.size() + 1);
+  threading::parallel_for(dverts.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      cache.offsets[i] = dverts[i].totweight;
     }
   });
+  const OffsetIndices<int> offsets = offset_indices::accumulate_counts_to_offsets(cache.offsets);
+  cache.weights.reinitialize(offsets.total_size());
+  threading::parallel_for(dverts.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      cache.weights.as_mutable_span()
+          .slice(offsets[i])
+          .copy_from({dverts[i].dw, dverts[i].totweight});
+    }
+  });
+
+  sharing_info->add_weak_user();
+  cache.sharing_info = WeakImplicitSharingPtr(sharing_info);
+  cache.version = sharing_info->version();
+  return &cache;
 }
 
 struct ArmatureEditMeshUserdata {
@@ -548,8 +604,10 @@ static void armature_vert_task_editmesh(void *__restrict userdata,
   const MDeformVert *dvert = use_dvert ? static_cast<const MDeformVert *>(
                                              BM_ELEM_CD_GET_VOID_P(v, data.cd_dvert_offset)) :
                                          nullptr;
+  const Span<MDeformWeight> dweights = dvert ? Span<MDeformWeight>(dvert->dw, dvert->totweight) :
+                                              Span<MDeformWeight>();
   armature_vert_task_with_dvert(
-      data.deform_params, BM_elem_index_get(v), dvert, data.use_quaternion);
+      data.deform_params, BM_elem_index_get(v), dvert, dweights, data.use_quaternion);
 }
 
 static void armature_deform_editmesh(const Object &ob_arm,
@@ -650,7 +708,8 @@ void BKE_armature_deform_coords_with_mesh(const Object &ob_arm,
                                           std::optional<MutableSpan<float3x3>> vert_deform_mats,
                                           int deformflag,
                                           StringRefNull defgrp_name,
-                                          const Mesh *me_target)
+                                          const Mesh *me_target,
+                                          ArmatureDeformWeightsCache *weights_cache)
 {
   if (!bke::verify_armature_deform_valid(ob_arm)) {
     return;
@@ -689,6 +748,11 @@ void BKE_armature_deform_coords_with_mesh(const Object &ob_arm,
     dverts_opt = dverts;
   }
 
+  const ArmatureDeformWeightsCache *weights = nullptr;
+  if (weights_cache && me_target && !dverts.is_empty() && (deformflag & ARM_DEF_VGROUP)) {
+    weights = bke::weights_cache_ensure(*weights_cache, *me_target);
+  }
+
   bke::armature_deform_coords(ob_arm,
                               ob_target,
                               defbase,
@@ -698,7 +762,8 @@ void BKE_armature_deform_coords_with_mesh(const Object &ob_arm,
                               vert_coords_prev,
                               defgrp_name,
                               dverts_opt,
-                              me_target);
+                              me_target,
+                              weights);
 }
 
 void BKE_armature_deform_coords_with_editmesh(
@@ -446,7 +446,8 @@ class ArmatureDeformTestBase {
                  const OutputValueTest output,
                  const WeightingTest weighting,
                  const MaskingTest masking,
-                 const VertexWeightSource dvert_source)
+                 const VertexWeightSource dvert_source,
+                 const bool use_weights_cache = false)
   {
     Object *ob_arm = this->create_test_armature_object();
     Object *ob_target = this->create_test_mesh_object();
@@ -466,6 +467,21 @@ class ArmatureDeformTestBase {
 
     const int deform_flag = get_deform_flag(interpolation, weighting);
     const char *defgrp_name = get_defgrp_name(masking);
+    ArmatureDeformWeightsCache weights_cache;
+    if (use_weights_cache) {
+      /* Fill the cache with a separate deformation first, so that the cached weights are reused
+       * for the deformation that is tested. */
+      Array<float3> positions_copy(vert_positions.as_span());
+      BKE_armature_deform_coords_with_mesh(*ob_arm,
+                                           *ob_target,
+                                           positions_copy,
+                                           std::nullopt,
+                                           std::nullopt,
+                                           deform_flag,
+                                           defgrp_name,
+                                           mesh_target,
+                                           &weights_cache);
+    }
     BKE_armature_deform_coords_with_mesh(*ob_arm,
                                          *ob_target,
                                          vert_positions,
@@ -473,7 +489,8 @@ class ArmatureDeformTestBase {
                                          deform_mats_opt,
                                          deform_flag,
                                          defgrp_name,
-                                         mesh_target);
+                                         mesh_target,
+                                         use_weights_cache ? &weights_cache : nullptr);
 
     EXPECT_EQ_SPAN(expected_positions(TargetDataType::Mesh, weighting, masking),
                    vert_positions.as_span());
@@ -802,7 +819,9 @@ TEST_F(ArmatureDeformTest, MeshDeform)
           for (VertexWeightSource dvert_source :
                {VertexWeightSource::TargetObject, VertexWeightSource::SeparateMesh})
           {
-            mesh_test(ipol, output, weight, mask, dvert_source);
+            for (const bool use_weights_cache : {false, true}) {
+              mesh_test(ipol, output, weight, mask, dvert_source, use_weights_cache);
+            }
           }
         }
       }
@@ -17,6 +17,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_mmap.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string_utf8.h"
 
@@ -28,9 +29,15 @@
 
 #include "NOD_geometry_nodes_list.hh"
 
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <sstream>
 #include <xxhash.h>
+#ifndef WIN32
+#  include <unistd.h>
+#else
+#  include <io.h>
+#endif
 
 #ifdef WITH_OPENVDB
 #  include <openvdb/io/Stream.h>
@@ -95,6 +102,29 @@ bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::is
 
 DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blobs_dir)) {}
 
+DiskBlobReader::BlobFile::~BlobFile()
+{
+  if (mmap_file) {
+    BLI_mmap_free(mmap_file);
+  }
+  if (file != -1) {
+    close(file);
+  }
+}
+
+std::unique_ptr<DiskBlobReader::BlobFile> DiskBlobReader::open_blob_file(const char *blob_path)
+{
+  auto blob_file = std::make_unique<BlobFile>();
+  blob_file->file = BLI_open(blob_path, O_BINARY | O_RDONLY, 0);
+  if (blob_file->file != -1) {
+    blob_file->mmap_file = BLI_mmap_open(blob_file->file);
+  }
+  if (!blob_file->mmap_file) {
+    blob_file->stream = std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
+  }
+  return blob_file;
+}
+
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
   if (slice.range.is_empty()) {
@@ -104,16 +134,22 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   char blob_path[FILE_MAX];
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
-  std::lock_guard lock{mutex_};
-  std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
-    return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
-  });
-  blob_file->seekg(slice.range.start());
-  blob_file->read(static_cast<char *>(r_data), slice.range.size());
-  if (blob_file->gcount() != slice.range.size()) {
-    return false;
+  const BlobFile *blob_file;
+  {
+    std::lock_guard lock{mutex_};
+    blob_file = open_blob_files_
+                    .lookup_or_add_cb_as(blob_path, [&]() { return open_blob_file(blob_path); })
+                    .get();
+
+    if (!blob_file->mmap_file) {
+      blob_file->stream->seekg(slice.range.start());
+      blob_file->stream->read(static_cast<char *>(r_data), slice.range.size());
+      return blob_file->stream->gcount() == slice.range.size();
+    }
   }
-  return true;
+
+  /* The mapping stays valid until the reader is destructed, so copying doesn't need the lock. */
+  return BLI_mmap_read(blob_file->mmap_file, r_data, slice.range.start(), slice.range.size());
 }
 
 DiskBlobWriter::DiskBlobWriter(std::string blob_dir, std::string base_name)
@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <functional>
 
 #include "MEM_guardedalloc.h"
 
@@ -19,7 +20,9 @@
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
+#include "BLI_span.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "BKE_cloth.hh"
 #include "BKE_collection.hh"
@@ -55,6 +58,31 @@ struct SelfColDetectData {
   bool collided;
 };
 
+/**
+ * Impulses of a single collision pair. They are computed for all pairs in parallel and then
+ * accumulated on the vertices in the order of the pairs, which keeps the result deterministic.
+ * Only the `a` impulses are used for collisions with objects.
+ */
+struct CollPairImpulse {
+  float a[3][3];
+  float b[3][3];
+  bool active;
+};
+
+struct ColResponseData {
+  ClothModifierData *clmd;
+  CollisionModifierData *collmd;
+  Object *collob;
+  CollPair *collisions;
+  CollPairImpulse *impulses;
+  float time_multiplier;
+  float min_distance;
+  bool is_hair;
+};
+
+/* Below this number of collision pairs the impulses are computed on the calling thread. */
+#define COLLISION_RESPONSE_THREADING_THRESHOLD 256
+
 /***********************************
  * Collision modifier code start
  ***********************************/
@@ -642,298 +670,389 @@ static void cloth_collision_impulse_vert(const float clamp_sq,
   vert->impulse_count++;
 }
 
-static int cloth_collision_response_static(ClothModifierData *clmd,
-                                           CollisionModifierData *collmd,
-                                           Object *collob,
-                                           CollPair *collpair,
-                                           uint collision_count,
-                                           const float dt)
+/**
+ * Computes the impulses of the collision pair with the given index without applying them, so that
+ * the pairs can be processed in parallel. Returns false if the pair doesn't need an impulse.
+ */
+static bool cloth_collision_impulse_calc(const ColResponseData *data,
+                                         const int index,
+                                         float r_impulse[3][3])
 {
-  int result = 0;
-  Cloth *cloth = clmd->clothObject;
-  const float clamp_sq = square_f(clmd->coll_parms->clamp * dt);
-  const float time_multiplier = 1.0f / (clmd->sim_parms->dt * clmd->sim_parms->timescale);
-  const float epsilon2 = BLI_bvhtree_get_epsilon(collmd->bvhtree);
-  const float min_distance = (clmd->coll_parms->epsilon + epsilon2) * (8.0f / 9.0f);
+  const Cloth *cloth = data->clmd->clothObject;
+  const CollPair &collpair = data->collisions[index];
+  float v1[3], v2[3], relativeVelocity[3];
 
-  const bool is_hair = (clmd->hairdata != nullptr);
-  for (int i = 0; i < collision_count; i++, collpair++) {
-    float i1[3], i2[3], i3[3];
-    float v1[3], v2[3], relativeVelocity[3];
-    zero_v3(i1);
-    zero_v3(i2);
-    zero_v3(i3);
+  /* Compute barycentric coordinates and relative "velocity" for both collision points. */
+  float w1 = collpair.aw1, w2 = collpair.aw2, w3 = collpair.aw3;
+  float u1 = collpair.bw1, u2 = collpair.bw2, u3 = collpair.bw3;
 
-    /* Only handle static collisions here. */
-    if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
-      continue;
-    }
+  if (data->is_hair) {
+    interp_v3_v3v3(v1, cloth->verts[collpair.ap1].tv, cloth->verts[collpair.ap2].tv, w2);
+  }
+  else {
+    collision_interpolateOnTriangle(v1,
+                                    cloth->verts[collpair.ap1].tv,
+                                    cloth->verts[collpair.ap2].tv,
+                                    cloth->verts[collpair.ap3].tv,
+                                    w1,
+                                    w2,
+                                    w3);
+  }
 
-    /* Compute barycentric coordinates and relative "velocity" for both collision points. */
-    float w1 = collpair->aw1, w2 = collpair->aw2, w3 = collpair->aw3;
-    float u1 = collpair->bw1, u2 = collpair->bw2, u3 = collpair->bw3;
+  collision_interpolateOnTriangle(v2,
+                                  data->collmd->current_v[collpair.bp1],
+                                  data->collmd->current_v[collpair.bp2],
+                                  data->collmd->current_v[collpair.bp3],
+                                  u1,
+                                  u2,
+                                  u3);
 
-    if (is_hair) {
-      interp_v3_v3v3(v1, cloth->verts[collpair->ap1].tv, cloth->verts[collpair->ap2].tv, w2);
-    }
-    else {
-      collision_interpolateOnTriangle(v1,
-                                      cloth->verts[collpair->ap1].tv,
-                                      cloth->verts[collpair->ap2].tv,
-                                      cloth->verts[collpair->ap3].tv,
-                                      w1,
-                                      w2,
-                                      w3);
-    }
+  sub_v3_v3v3(relativeVelocity, v2, v1);
 
-    collision_interpolateOnTriangle(v2,
-                                    collmd->current_v[collpair->bp1],
-                                    collmd->current_v[collpair->bp2],
-                                    collmd->current_v[collpair->bp3],
-                                    u1,
-                                    u2,
-                                    u3);
-
-    sub_v3_v3v3(relativeVelocity, v2, v1);
-
-    /* Calculate the normal component of the relative velocity
-     * (actually only the magnitude - the direction is stored in 'normal'). */
-    const float magrelVel = dot_v3v3(relativeVelocity, collpair->normal);
-    const float d = min_distance - collpair->distance;
-
-    /* If magrelVel < 0 the edges are approaching each other. */
-    if (magrelVel > 0.0f) {
-      /* Calculate Impulse magnitude to stop all motion in normal direction. */
-      float magtangent = 0, repulse = 0;
-      double impulse = 0.0;
-      float vrel_t_pre[3];
-      float temp[3];
-
-      /* Calculate tangential velocity. */
-      copy_v3_v3(temp, collpair->normal);
-      mul_v3_fl(temp, magrelVel);
-      sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
-
-      /* Decrease in magnitude of relative tangential velocity due to coulomb friction
-       * in original formula "magrelVel" should be the
-       * "change of relative velocity in normal direction". */
-      magtangent = min_ff(collob->pd->pdef_cfrict * 0.01f * magrelVel, len_v3(vrel_t_pre));
-
-      /* Apply friction impulse. */
-      if (magtangent > ALMOST_ZERO) {
-        normalize_v3(vrel_t_pre);
-
-        impulse = magtangent / 1.5;
-
-        VECADDMUL(i1, vrel_t_pre, double(w1) * impulse);
-        VECADDMUL(i2, vrel_t_pre, double(w2) * impulse);
-
-        if (!is_hair) {
-          VECADDMUL(i3, vrel_t_pre, double(w3) * impulse);
-        }
-      }
+  /* Calculate the normal component of the relative velocity
+   * (actually only the magnitude - the direction is stored in 'normal'). */
+  const float magrelVel = dot_v3v3(relativeVelocity, collpair.normal);
+  const float d = data->min_distance - collpair.distance;
 
-      /* Apply velocity stopping impulse. */
-      impulse = magrelVel / 1.5f;
+  /* If magrelVel < 0 the edges are approaching each other. */
+  if (magrelVel > 0.0f) {
+    /* Calculate Impulse magnitude to stop all motion in normal direction. */
+    float magtangent = 0, repulse = 0;
+    double impulse = 0.0;
+    float vrel_t_pre[3];
+    float temp[3];
 
-      VECADDMUL(i1, collpair->normal, double(w1) * impulse);
-      VECADDMUL(i2, collpair->normal, double(w2) * impulse);
-      if (!is_hair) {
-        VECADDMUL(i3, collpair->normal, double(w3) * impulse);
-      }
+    /* Calculate tangential velocity. */
+    copy_v3_v3(temp, collpair.normal);
+    mul_v3_fl(temp, magrelVel);
+    sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
 
-      if ((magrelVel < 0.1f * d * time_multiplier) && (d > ALMOST_ZERO)) {
-        repulse = std::min(d / time_multiplier, 0.1f * d * time_multiplier - magrelVel);
+    /* Decrease in magnitude of relative tangential velocity due to coulomb friction
+     * in original formula "magrelVel" should be the
+     * "change of relative velocity in normal direction". */
+    magtangent = min_ff(data->collob->pd->pdef_cfrict * 0.01f * magrelVel, len_v3(vrel_t_pre));
 
-        /* Stay on the safe side and clamp repulse. */
-        if (impulse > ALMOST_ZERO) {
-          repulse = min_ff(repulse, 5.0f * impulse);
-        }
+    /* Apply friction impulse. */
+    if (magtangent > ALMOST_ZERO) {
+      normalize_v3(vrel_t_pre);
 
-        repulse = max_ff(impulse, repulse);
+      impulse = magtangent / 1.5;
 
-        impulse = repulse / 1.5f;
+      VECADDMUL(r_impulse[0], vrel_t_pre, double(w1) * impulse);
+      VECADDMUL(r_impulse[1], vrel_t_pre, double(w2) * impulse);
 
-        VECADDMUL(i1, collpair->normal, impulse);
-        VECADDMUL(i2, collpair->normal, impulse);
-        if (!is_hair) {
-          VECADDMUL(i3, collpair->normal, impulse);
-        }
+      if (!data->is_hair) {
+        VECADDMUL(r_impulse[2], vrel_t_pre, double(w3) * impulse);
       }
+    }
 
-      result = 1;
+    /* Apply velocity stopping impulse. */
+    impulse = magrelVel / 1.5f;
+
+    VECADDMUL(r_impulse[0], collpair.normal, double(w1) * impulse);
+    VECADDMUL(r_impulse[1], collpair.normal, double(w2) * impulse);
+    if (!data->is_hair) {
+      VECADDMUL(r_impulse[2], collpair.normal, double(w3) * impulse);
     }
-    else if (d > ALMOST_ZERO) {
+
+    if ((magrelVel < 0.1f * d * data->time_multiplier) && (d > ALMOST_ZERO)) {
+      repulse = std::min(d / data->time_multiplier, 0.1f * d * data->time_multiplier - magrelVel);
+
       /* Stay on the safe side and clamp repulse. */
-      float repulse = d / time_multiplier;
-      float impulse = repulse / 4.5f;
+      if (impulse > ALMOST_ZERO) {
+        repulse = min_ff(repulse, 5.0f * impulse);
+      }
 
-      VECADDMUL(i1, collpair->normal, w1 * impulse);
-      VECADDMUL(i2, collpair->normal, w2 * impulse);
+      repulse = max_ff(impulse, repulse);
 
-      if (!is_hair) {
-        VECADDMUL(i3, collpair->normal, w3 * impulse);
+      impulse = repulse / 1.5f;
+
+      VECADDMUL(r_impulse[0], collpair.normal, impulse);
+      VECADDMUL(r_impulse[1], collpair.normal, impulse);
+      if (!data->is_hair) {
+        VECADDMUL(r_impulse[2], collpair.normal, impulse);
       }
+    }
+
+    return true;
+  }
+  else if (d > ALMOST_ZERO) {
+    /* Stay on the safe side and clamp repulse. */
+    float repulse = d / data->time_multiplier;
+    float impulse = repulse / 4.5f;
+
+    VECADDMUL(r_impulse[0], collpair.normal, w1 * impulse);
+    VECADDMUL(r_impulse[1], collpair.normal, w2 * impulse);
+
+    if (!data->is_hair) {
+      VECADDMUL(r_impulse[2], collpair.normal, w3 * impulse);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+static void cloth_collision_impulse_calc_cb(void *__restrict userdata,
+                                            const int index,
+                                            const TaskParallelTLS *__restrict /*tls*/)
+{
+  const ColResponseData *data = static_cast<const ColResponseData *>(userdata);
+  CollPairImpulse &impulse = data->impulses[index];
+  memset(&impulse, 0, sizeof(impulse));
 
+  /* Only handle static collisions here. */
+  if (data->collisions[index].flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
+    return;
+  }
+  impulse.active = cloth_collision_impulse_calc(data, index, impulse.a);
+}
+
+static int cloth_collision_response_static(ClothModifierData *clmd,
+                                           CollisionModifierData *collmd,
+                                           Object *collob,
+                                           CollPair *collpair,
+                                           uint collision_count,
+                                           const float dt)
+{
+  int result = 0;
+  Cloth *cloth = clmd->clothObject;
+  const float clamp_sq = square_f(clmd->coll_parms->clamp * dt);
+  const float epsilon2 = BLI_bvhtree_get_epsilon(collmd->bvhtree);
+  const bool is_hair = (clmd->hairdata != nullptr);
+
+  ColResponseData data{};
+  data.clmd = clmd;
+  data.collmd = collmd;
+  data.collob = collob;
+  data.collisions = collpair;
+  data.impulses = MEM_new_array_uninitialized<CollPairImpulse>(collision_count, __func__);
+  data.time_multiplier = 1.0f / (clmd->sim_parms->dt * clmd->sim_parms->timescale);
+  data.min_distance = (clmd->coll_parms->epsilon + epsilon2) * (8.0f / 9.0f);
+  data.is_hair = is_hair;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (collision_count > COLLISION_RESPONSE_THREADING_THRESHOLD);
+  BLI_task_parallel_range(0, collision_count, &data, cloth_collision_impulse_calc_cb, &settings);
+
+  /* Accumulate the impulses in the order of the pairs, once a pair has an impulse all following
+   * pairs are counted on their vertices as well, even if their impulse is zero. */
+  for (int i = 0; i < collision_count; i++, collpair++) {
+    if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
+      continue;
+    }
+
+    const CollPairImpulse &impulse = data.impulses[i];
+    if (impulse.active) {
       result = 1;
     }
 
     if (result) {
-      cloth_collision_impulse_vert(clamp_sq, i1, &cloth->verts[collpair->ap1]);
-      cloth_collision_impulse_vert(clamp_sq, i2, &cloth->verts[collpair->ap2]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.a[0], &cloth->verts[collpair->ap1]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.a[1], &cloth->verts[collpair->ap2]);
       if (!is_hair) {
-        cloth_collision_impulse_vert(clamp_sq, i3, &cloth->verts[collpair->ap3]);
+        cloth_collision_impulse_vert(clamp_sq, impulse.a[2], &cloth->verts[collpair->ap3]);
       }
     }
   }
 
+  MEM_delete(data.impulses);
+
   return result;
 }
 
-static int cloth_selfcollision_response_static(ClothModifierData *clmd,
-                                               CollPair *collpair,
-                                               uint collision_count,
-                                               const float dt)
+/**
+ * Computes the impulses of the self collision pair with the given index without applying them,
+ * see #cloth_collision_impulse_calc.
+ */
+static bool cloth_selfcollision_impulse_calc(const ColResponseData *data,
+                                             const int index,
+                                             float r_impulse_a[3][3],
+                                             float r_impulse_b[3][3])
 {
-  int result = 0;
-  Cloth *cloth = clmd->clothObject;
-  const float clamp_sq = square_f(clmd->coll_parms->self_clamp * dt);
-  const float time_multiplier = 1.0f / (clmd->sim_parms->dt * clmd->sim_parms->timescale);
-  const float min_distance = (2.0f * clmd->coll_parms->selfepsilon) * (8.0f / 9.0f);
+  const Cloth *cloth = data->clmd->clothObject;
+  const CollPair &collpair = data->collisions[index];
+  float v1[3], v2[3], relativeVelocity[3];
+
+  /* Retrieve barycentric coordinates for both collision points. */
+  float w1 = collpair.aw1, w2 = collpair.aw2, w3 = collpair.aw3;
+  float u1 = collpair.bw1, u2 = collpair.bw2, u3 = collpair.bw3;
+
+  /* Calculate relative "velocity". */
+  collision_interpolateOnTriangle(v1,
+                                  cloth->verts[collpair.ap1].tv,
+                                  cloth->verts[collpair.ap2].tv,
+                                  cloth->verts[collpair.ap3].tv,
+                                  w1,
+                                  w2,
+                                  w3);
+
+  collision_interpolateOnTriangle(v2,
+                                  cloth->verts[collpair.bp1].tv,
+                                  cloth->verts[collpair.bp2].tv,
+                                  cloth->verts[collpair.bp3].tv,
+                                  u1,
+                                  u2,
+                                  u3);
 
-  for (int i = 0; i < collision_count; i++, collpair++) {
-    float ia[3][3] = {{0.0f}};
-    float ib[3][3] = {{0.0f}};
-    float v1[3], v2[3], relativeVelocity[3];
+  sub_v3_v3v3(relativeVelocity, v2, v1);
 
-    /* Only handle static collisions here. */
-    if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
-      continue;
-    }
+  /* Calculate the normal component of the relative velocity
+   * (actually only the magnitude - the direction is stored in 'normal'). */
+  const float magrelVel = dot_v3v3(relativeVelocity, collpair.normal);
+  const float d = data->min_distance - collpair.distance;
 
-    /* Retrieve barycentric coordinates for both collision points. */
-    float w1 = collpair->aw1, w2 = collpair->aw2, w3 = collpair->aw3;
-    float u1 = collpair->bw1, u2 = collpair->bw2, u3 = collpair->bw3;
+  /* TODO: Impulses should be weighed by mass as this is self col,
+   * this has to be done after mass distribution is implemented. */
 
-    /* Calculate relative "velocity". */
-    collision_interpolateOnTriangle(v1,
-                                    cloth->verts[collpair->ap1].tv,
-                                    cloth->verts[collpair->ap2].tv,
-                                    cloth->verts[collpair->ap3].tv,
-                                    w1,
-                                    w2,
-                                    w3);
+  /* If magrelVel < 0 the edges are approaching each other. */
+  if (magrelVel > 0.0f) {
+    /* Calculate Impulse magnitude to stop all motion in normal direction. */
+    float magtangent = 0, repulse = 0;
+    double impulse = 0.0;
+    float vrel_t_pre[3];
+    float temp[3];
 
-    collision_interpolateOnTriangle(v2,
-                                    cloth->verts[collpair->bp1].tv,
-                                    cloth->verts[collpair->bp2].tv,
-                                    cloth->verts[collpair->bp3].tv,
-                                    u1,
-                                    u2,
-                                    u3);
-
-    sub_v3_v3v3(relativeVelocity, v2, v1);
-
-    /* Calculate the normal component of the relative velocity
-     * (actually only the magnitude - the direction is stored in 'normal'). */
-    const float magrelVel = dot_v3v3(relativeVelocity, collpair->normal);
-    const float d = min_distance - collpair->distance;
-
-    /* TODO: Impulses should be weighed by mass as this is self col,
-     * this has to be done after mass distribution is implemented. */
-
-    /* If magrelVel < 0 the edges are approaching each other. */
-    if (magrelVel > 0.0f) {
-      /* Calculate Impulse magnitude to stop all motion in normal direction. */
-      float magtangent = 0, repulse = 0;
-      double impulse = 0.0;
-      float vrel_t_pre[3];
-      float temp[3];
-
-      /* Calculate tangential velocity. */
-      copy_v3_v3(temp, collpair->normal);
-      mul_v3_fl(temp, magrelVel);
-      sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
-
-      /* Decrease in magnitude of relative tangential velocity due to coulomb friction
-       * in original formula "magrelVel" should be the
-       * "change of relative velocity in normal direction". */
-      magtangent = min_ff(clmd->coll_parms->self_friction * 0.01f * magrelVel, len_v3(vrel_t_pre));
-
-      /* Apply friction impulse. */
-      if (magtangent > ALMOST_ZERO) {
-        normalize_v3(vrel_t_pre);
-
-        impulse = magtangent / 1.5;
-
-        VECADDMUL(ia[0], vrel_t_pre, double(w1) * impulse);
-        VECADDMUL(ia[1], vrel_t_pre, double(w2) * impulse);
-        VECADDMUL(ia[2], vrel_t_pre, double(w3) * impulse);
-
-        VECADDMUL(ib[0], vrel_t_pre, double(u1) * -impulse);
-        VECADDMUL(ib[1], vrel_t_pre, double(u2) * -impulse);
-        VECADDMUL(ib[2], vrel_t_pre, double(u3) * -impulse);
-      }
+    /* Calculate tangential velocity. */
+    copy_v3_v3(temp, collpair.normal);
+    mul_v3_fl(temp, magrelVel);
+    sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
 
-      /* Apply velocity stopping impulse. */
-      impulse = magrelVel / 3.0f;
+    /* Decrease in magnitude of relative tangential velocity due to coulomb friction
+     * in original formula "magrelVel" should be the
+     * "change of relative velocity in normal direction". */
+    magtangent = min_ff(data->clmd->coll_parms->self_friction * 0.01f * magrelVel,
+                        len_v3(vrel_t_pre));
 
-      VECADDMUL(ia[0], collpair->normal, double(w1) * impulse);
-      VECADDMUL(ia[1], collpair->normal, double(w2) * impulse);
-      VECADDMUL(ia[2], collpair->normal, double(w3) * impulse);
+    /* Apply friction impulse. */
+    if (magtangent > ALMOST_ZERO) {
+      normalize_v3(vrel_t_pre);
 
-      VECADDMUL(ib[0], collpair->normal, double(u1) * -impulse);
-      VECADDMUL(ib[1], collpair->normal, double(u2) * -impulse);
-      VECADDMUL(ib[2], collpair->normal, double(u3) * -impulse);
+      impulse = magtangent / 1.5;
 
-      if ((magrelVel < 0.1f * d * time_multiplier) && (d > ALMOST_ZERO)) {
-        repulse = std::min(d / time_multiplier, 0.1f * d * time_multiplier - magrelVel);
+      VECADDMUL(r_impulse_a[0], vrel_t_pre, double(w1) * impulse);
+      VECADDMUL(r_impulse_a[1], vrel_t_pre, double(w2) * impulse);
+      VECADDMUL(r_impulse_a[2], vrel_t_pre, double(w3) * impulse);
 
-        if (impulse > ALMOST_ZERO) {
-          repulse = min_ff(repulse, 5.0 * impulse);
-        }
+      VECADDMUL(r_impulse_b[0], vrel_t_pre, double(u1) * -impulse);
+      VECADDMUL(r_impulse_b[1], vrel_t_pre, double(u2) * -impulse);
+      VECADDMUL(r_impulse_b[2], vrel_t_pre, double(u3) * -impulse);
+    }
+
+    /* Apply velocity stopping impulse. */
+    impulse = magrelVel / 3.0f;
+
+    VECADDMUL(r_impulse_a[0], collpair.normal, double(w1) * impulse);
+    VECADDMUL(r_impulse_a[1], collpair.normal, double(w2) * impulse);
+    VECADDMUL(r_impulse_a[2], collpair.normal, double(w3) * impulse);
 
-        repulse = max_ff(impulse, repulse);
-        impulse = repulse / 1.5f;
+    VECADDMUL(r_impulse_b[0], collpair.normal, double(u1) * -impulse);
+    VECADDMUL(r_impulse_b[1], collpair.normal, double(u2) * -impulse);
+    VECADDMUL(r_impulse_b[2], collpair.normal, double(u3) * -impulse);
 
-        VECADDMUL(ia[0], collpair->normal, double(w1) * impulse);
-        VECADDMUL(ia[1], collpair->normal, double(w2) * impulse);
-        VECADDMUL(ia[2], collpair->normal, double(w3) * impulse);
+    if ((magrelVel < 0.1f * d * data->time_multiplier) && (d > ALMOST_ZERO)) {
+      repulse = std::min(d / data->time_multiplier, 0.1f * d * data->time_multiplier - magrelVel);
 
-        VECADDMUL(ib[0], collpair->normal, double(u1) * -impulse);
-        VECADDMUL(ib[1], collpair->normal, double(u2) * -impulse);
-        VECADDMUL(ib[2], collpair->normal, double(u3) * -impulse);
+      if (impulse > ALMOST_ZERO) {
+        repulse = min_ff(repulse, 5.0 * impulse);
       }
 
-      result = 1;
+      repulse = max_ff(impulse, repulse);
+      impulse = repulse / 1.5f;
+
+      VECADDMUL(r_impulse_a[0], collpair.normal, double(w1) * impulse);
+      VECADDMUL(r_impulse_a[1], collpair.normal, double(w2) * impulse);
+      VECADDMUL(r_impulse_a[2], collpair.normal, double(w3) * impulse);
+
+      VECADDMUL(r_impulse_b[0], collpair.normal, double(u1) * -impulse);
+      VECADDMUL(r_impulse_b[1], collpair.normal, double(u2) * -impulse);
+      VECADDMUL(r_impulse_b[2], collpair.normal, double(u3) * -impulse);
     }
-    else if (d > ALMOST_ZERO) {
-      /* Stay on the safe side and clamp repulse. */
-      float repulse = d * 1.0f / time_multiplier;
-      float impulse = repulse / 9.0f;
 
-      VECADDMUL(ia[0], collpair->normal, w1 * impulse);
-      VECADDMUL(ia[1], collpair->normal, w2 * impulse);
-      VECADDMUL(ia[2], collpair->normal, w3 * impulse);
+    return true;
+  }
+  else if (d > ALMOST_ZERO) {
+    /* Stay on the safe side and clamp repulse. */
+    float repulse = d * 1.0f / data->time_multiplier;
+    float impulse = repulse / 9.0f;
+
+    VECADDMUL(r_impulse_a[0], collpair.normal, w1 * impulse);
+    VECADDMUL(r_impulse_a[1], collpair.normal, w2 * impulse);
+    VECADDMUL(r_impulse_a[2], collpair.normal, w3 * impulse);
+
+    VECADDMUL(r_impulse_b[0], collpair.normal, u1 * -impulse);
+    VECADDMUL(r_impulse_b[1], collpair.normal, u2 * -impulse);
+    VECADDMUL(r_impulse_b[2], collpair.normal, u3 * -impulse);
+
+    return true;
+  }
+
+  return false;
+}
+
+static void cloth_selfcollision_impulse_calc_cb(void *__restrict userdata,
+                                                const int index,
+                                                const TaskParallelTLS *__restrict /*tls*/)
+{
+  const ColResponseData *data = static_cast<const ColResponseData *>(userdata);
+  CollPairImpulse &impulse = data->impulses[index];
+  memset(&impulse, 0, sizeof(impulse));
+
+  /* Only handle static collisions here. */
+  if (data->collisions[index].flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
+    return;
+  }
+  impulse.active = cloth_selfcollision_impulse_calc(data, index, impulse.a, impulse.b);
+}
+
+static int cloth_selfcollision_response_static(ClothModifierData *clmd,
+                                               CollPair *collpair,
+                                               uint collision_count,
+                                               const float dt)
+{
+  int result = 0;
+  Cloth *cloth = clmd->clothObject;
+  const float clamp_sq = square_f(clmd->coll_parms->self_clamp * dt);
 
-      VECADDMUL(ib[0], collpair->normal, u1 * -impulse);
-      VECADDMUL(ib[1], collpair->normal, u2 * -impulse);
-      VECADDMUL(ib[2], collpair->normal, u3 * -impulse);
+  ColResponseData data{};
+  data.clmd = clmd;
+  data.collisions = collpair;
+  data.impulses = MEM_new_array_uninitialized<CollPairImpulse>(collision_count, __func__);
+  data.time_multiplier = 1.0f / (clmd->sim_parms->dt * clmd->sim_parms->timescale);
+  data.min_distance = (2.0f * clmd->coll_parms->selfepsilon) * (8.0f / 9.0f);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (collision_count > COLLISION_RESPONSE_THREADING_THRESHOLD);
+  BLI_task_parallel_range(
+      0, collision_count, &data, cloth_selfcollision_impulse_calc_cb, &settings);
+
+  /* Accumulate in the order of the pairs, see #cloth_collision_response_static. */
+  for (int i = 0; i < collision_count; i++, collpair++) {
+    if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
+      continue;
+    }
 
+    const CollPairImpulse &impulse = data.impulses[i];
+    if (impulse.active) {
       result = 1;
     }
 
     if (result) {
-      cloth_collision_impulse_vert(clamp_sq, ia[0], &cloth->verts[collpair->ap1]);
-      cloth_collision_impulse_vert(clamp_sq, ia[1], &cloth->verts[collpair->ap2]);
-      cloth_collision_impulse_vert(clamp_sq, ia[2], &cloth->verts[collpair->ap3]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.a[0], &cloth->verts[collpair->ap1]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.a[1], &cloth->verts[collpair->ap2]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.a[2], &cloth->verts[collpair->ap3]);
 
-      cloth_collision_impulse_vert(clamp_sq, ib[0], &cloth->verts[collpair->bp1]);
-      cloth_collision_impulse_vert(clamp_sq, ib[1], &cloth->verts[collpair->bp2]);
-      cloth_collision_impulse_vert(clamp_sq, ib[2], &cloth->verts[collpair->bp3]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.b[0], &cloth->verts[collpair->bp1]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.b[1], &cloth->verts[collpair->bp2]);
+      cloth_collision_impulse_vert(clamp_sq, impulse.b[2], &cloth->verts[collpair->bp3]);
     }
   }
 
+  MEM_delete(data.impulses);
+
   return result;
 }
 
@@ -1425,6 +1544,32 @@ static bool cloth_bvh_selfcollisions_nearcheck(ClothModifierData *clmd,
   return data.collided;
 }
 
+/**
+ * Add the accumulated impulses to the "velocities" of the vertices (just `xnew = xold + v`; no
+ * `dt` in `v`) and reset them. Returns the number of vertices that received an impulse.
+ */
+static int cloth_collision_impulses_apply(Cloth *cloth)
+{
+  MutableSpan<ClothVertex> verts(cloth->verts, cloth->mvert_num);
+  return threading::parallel_reduce(
+      verts.index_range(),
+      1024,
+      0,
+      [&](const IndexRange range, int count) {
+        for (ClothVertex &vert : verts.slice(range)) {
+          if (vert.impulse_count) {
+            add_v3_v3(vert.tv, vert.impulse);
+            add_v3_v3(vert.dcvel, vert.impulse);
+            zero_v3(vert.impulse);
+            vert.impulse_count = 0;
+            count++;
+          }
+        }
+        return count;
+      },
+      std::plus<int>());
+}
+
 static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
                                            Object **collobjs,
                                            CollPair **collisions,
@@ -1433,16 +1578,10 @@ static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
                                            const float dt)
 {
   Cloth *cloth = clmd->clothObject;
-  int i = 0, j = 0, mvert_num = 0;
-  ClothVertex *verts = nullptr;
+  int i = 0, j = 0;
   int ret = 0;
   int result = 0;
 
-  mvert_num = clmd->clothObject->mvert_num;
-  verts = cloth->verts;
-
-  result = 1;
-
   for (j = 0; j < 2; j++) {
     result = 0;
 
@@ -1459,17 +1598,7 @@ static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
 
     /* Apply impulses in parallel. */
     if (result) {
-      for (i = 0; i < mvert_num; i++) {
-        /* Calculate "velocities" (just `xnew = xold + v`; no `dt` in `v`). */
-        if (verts[i].impulse_count) {
-          add_v3_v3(verts[i].tv, verts[i].impulse);
-          add_v3_v3(verts[i].dcvel, verts[i].impulse);
-          zero_v3(verts[i].impulse);
-          verts[i].impulse_count = 0;
-
-          ret++;
-        }
-      }
+      ret += cloth_collision_impulses_apply(cloth);
     }
     else {
       break;
@@ -1484,14 +1613,10 @@ static int cloth_bvh_selfcollisions_resolve(ClothModifierData *clmd,
                                             const float dt)
 {
   Cloth *cloth = clmd->clothObject;
-  int i = 0, j = 0, mvert_num = 0;
-  ClothVertex *verts = nullptr;
+  int j = 0;
   int ret = 0;
   int result = 0;
 
-  mvert_num = clmd->clothObject->mvert_num;
-  verts = cloth->verts;
-
   for (j = 0; j < 2; j++) {
     result = 0;
 
@@ -1499,17 +1624,7 @@ static int cloth_bvh_selfcollisions_resolve(ClothModifierData *clmd,
 
     /* Apply impulses in parallel. */
     if (result) {
-      for (i = 0; i < mvert_num; i++) {
-        if (verts[i].impulse_count) {
-          // VECADDMUL ( verts[i].tv, verts[i].impulse, 1.0f / verts[i].impulse_count );
-          add_v3_v3(verts[i].tv, verts[i].impulse);
-          add_v3_v3(verts[i].dcvel, verts[i].impulse);
-          zero_v3(verts[i].impulse);
-          verts[i].impulse_count = 0;
-
-          ret++;
-        }
-      }
+      ret += cloth_collision_impulses_apply(cloth);
     }
 
     if (!result) {
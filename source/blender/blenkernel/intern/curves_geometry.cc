@@ -823,6 +823,86 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
   });
 }
 
+/**
+ * Evaluate the positions of the selected curves. The evaluated offsets and the NURBS basis cache
+ * have to be computed already.
+ */
+static void evaluate_positions(const CurvesGeometry &curves,
+                               const IndexMask &curves_mask,
+                               MutableSpan<float3> evaluated_positions)
+{
+  const CurvesGeometryRuntime &runtime = *curves.runtime;
+  const OffsetIndices<int> points_by_curve = curves.points_by_curve();
+  const OffsetIndices<int> evaluated_points_by_curve = curves.evaluated_points_by_curve();
+  const Span<float3> positions = curves.positions();
+
+  auto evaluate_catmull = [&](const IndexMask &selection) {
+    const VArray<bool> cyclic = curves.cyclic();
+    const VArray<int> resolution = curves.resolution();
+    selection.foreach_index(
+        [&](const int curve_index) {
+          const IndexRange points = points_by_curve[curve_index];
+          const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+          curves::catmull_rom::interpolate_to_evaluated(
+              positions.slice(points),
+              cyclic[curve_index],
+              resolution[curve_index],
+              evaluated_positions.slice(evaluated_points));
+        },
+        exec_mode::grain_size(128));
+  };
+  auto evaluate_poly = [&](const IndexMask &selection) {
+    array_utils::copy_group_to_group(
+        points_by_curve, evaluated_points_by_curve, selection, positions, evaluated_positions);
+  };
+  auto evaluate_bezier = [&](const IndexMask &selection) {
+    const std::optional<Span<float3>> handle_positions_left = curves.handle_positions_left();
+    const std::optional<Span<float3>> handle_positions_right = curves.handle_positions_right();
+    if (!handle_positions_left || !handle_positions_right) {
+      curves::fill_points(evaluated_points_by_curve, selection, float3(0), evaluated_positions);
+      return;
+    }
+    const Span<int> all_bezier_offsets = runtime.evaluated_offsets_cache.data().all_bezier_offsets;
+    selection.foreach_index(
+        [&](const int curve_index) {
+          const IndexRange points = points_by_curve[curve_index];
+          const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+          const IndexRange offsets = curves::per_curve_point_offsets_range(points, curve_index);
+          curves::bezier::calculate_evaluated_positions(
+              positions.slice(points),
+              handle_positions_left->slice(points),
+              handle_positions_right->slice(points),
+              all_bezier_offsets.slice(offsets),
+              evaluated_positions.slice(evaluated_points));
+        },
+        exec_mode::grain_size(128));
+  };
+  auto evaluate_nurbs = [&](const IndexMask &selection) {
+    const VArray<int8_t> nurbs_orders = curves.nurbs_orders();
+    const std::optional<Span<float>> nurbs_weights = curves.nurbs_weights();
+    const Span<curves::nurbs::BasisCache> nurbs_basis_cache = runtime.nurbs_basis_cache.data();
+    selection.foreach_index(
+        [&](const int curve_index) {
+          const IndexRange points = points_by_curve[curve_index];
+          const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+          curves::nurbs::interpolate_to_evaluated(nurbs_basis_cache[curve_index],
+                                                  nurbs_orders[curve_index],
+                                                  nurbs_weights ? nurbs_weights->slice(points) :
+                                                                  Span<float>(),
+                                                  positions.slice(points),
+                                                  evaluated_positions.slice(evaluated_points));
+        },
+        exec_mode::grain_size(128));
+  };
+  curves::foreach_curve_by_type(curves.curve_types(),
+                                curves.curve_type_counts(),
+                                curves_mask,
+                                evaluate_catmull,
+                                evaluate_poly,
+                                evaluate_bezier,
+                                evaluate_nurbs);
+}
+
 Span<float3> CurvesGeometry::evaluated_positions() const
 {
   const CurvesGeometryRuntime &runtime = *this->runtime;
@@ -834,79 +914,7 @@ Span<float3> CurvesGeometry::evaluated_positions() const
   this->ensure_nurbs_basis_cache();
   runtime.evaluated_position_cache.ensure([&](Vector<float3> &r_data) {
     r_data.resize(this->evaluated_points_num());
-    MutableSpan<float3> evaluated_positions = r_data;
-
-    const OffsetIndices<int> points_by_curve = this->points_by_curve();
-    const OffsetIndices<int> evaluated_points_by_curve = this->evaluated_points_by_curve();
-    const Span<float3> positions = this->positions();
-
-    auto evaluate_catmull = [&](const IndexMask &selection) {
-      const VArray<bool> cyclic = this->cyclic();
-      const VArray<int> resolution = this->resolution();
-      selection.foreach_index(
-          [&](const int curve_index) {
-            const IndexRange points = points_by_curve[curve_index];
-            const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-            curves::catmull_rom::interpolate_to_evaluated(
-                positions.slice(points),
-                cyclic[curve_index],
-                resolution[curve_index],
-                evaluated_positions.slice(evaluated_points));
-          },
-          exec_mode::grain_size(128));
-    };
-    auto evaluate_poly = [&](const IndexMask &selection) {
-      array_utils::copy_group_to_group(
-          points_by_curve, evaluated_points_by_curve, selection, positions, evaluated_positions);
-    };
-    auto evaluate_bezier = [&](const IndexMask &selection) {
-      const std::optional<Span<float3>> handle_positions_left = this->handle_positions_left();
-      const std::optional<Span<float3>> handle_positions_right = this->handle_positions_right();
-      if (!handle_positions_left || !handle_positions_right) {
-        curves::fill_points(evaluated_points_by_curve, selection, float3(0), evaluated_positions);
-        return;
-      }
-      const Span<int> all_bezier_offsets =
-          runtime.evaluated_offsets_cache.data().all_bezier_offsets;
-      selection.foreach_index(
-          [&](const int curve_index) {
-            const IndexRange points = points_by_curve[curve_index];
-            const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-            const IndexRange offsets = curves::per_curve_point_offsets_range(points, curve_index);
-            curves::bezier::calculate_evaluated_positions(
-                positions.slice(points),
-                handle_positions_left->slice(points),
-                handle_positions_right->slice(points),
-                all_bezier_offsets.slice(offsets),
-                evaluated_positions.slice(evaluated_points));
-          },
-          exec_mode::grain_size(128));
-    };
-    auto evaluate_nurbs = [&](const IndexMask &selection) {
-      this->ensure_nurbs_basis_cache();
-      const VArray<int8_t> nurbs_orders = this->nurbs_orders();
-      const std::optional<Span<float>> nurbs_weights = this->nurbs_weights();
-      const Span<curves::nurbs::BasisCache> nurbs_basis_cache = runtime.nurbs_basis_cache.data();
-      selection.foreach_index(
-          [&](const int curve_index) {
-            const IndexRange points = points_by_curve[curve_index];
-            const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-            curves::nurbs::interpolate_to_evaluated(nurbs_basis_cache[curve_index],
-                                                    nurbs_orders[curve_index],
-                                                    nurbs_weights ? nurbs_weights->slice(points) :
-                                                                    Span<float>(),
-                                                    positions.slice(points),
-                                                    evaluated_positions.slice(evaluated_points));
-          },
-          exec_mode::grain_size(128));
-    };
-    curves::foreach_curve_by_type(this->curve_types(),
-                                  this->curve_type_counts(),
-                                  this->curves_range(),
-                                  evaluate_catmull,
-                                  evaluate_poly,
-                                  evaluate_bezier,
-                                  evaluate_nurbs);
+    evaluate_positions(*this, this->curves_range(), r_data);
   });
   return runtime.evaluated_position_cache.data();
 }
@@ -1246,6 +1254,31 @@ void CurvesGeometry::tag_positions_changed()
   this->runtime->bounds_cache.tag_dirty();
   this->runtime->bounds_with_radius_cache.tag_dirty();
 }
+void CurvesGeometry::tag_positions_changed(const IndexMask &changed_curves)
+{
+  if (changed_curves.is_empty()) {
+    return;
+  }
+  CurvesGeometryRuntime &runtime = *this->runtime;
+  /* Only update the evaluated positions of the changed curves if that is likely to be cheaper than
+   * evaluating all curves again lazily, which is the same heuristic as for Grease Pencil. */
+  if (changed_curves.size() > this->curves_num() / 2 ||
+      !runtime.evaluated_position_cache.is_cached() || this->is_single_type(CURVE_TYPE_POLY))
+  {
+    this->tag_positions_changed();
+    return;
+  }
+  this->evaluated_points_by_curve();
+  this->ensure_nurbs_basis_cache();
+  runtime.evaluated_position_cache.update([&](Vector<float3> &r_data) {
+    evaluate_positions(*this, changed_curves, r_data);
+  });
+  runtime.evaluated_tangent_cache.tag_dirty();
+  runtime.evaluated_normal_cache.tag_dirty();
+  runtime.evaluated_length_cache.tag_dirty();
+  runtime.bounds_cache.tag_dirty();
+  runtime.bounds_with_radius_cache.tag_dirty();
+}
 void CurvesGeometry::tag_topology_changed()
 {
   this->runtime->custom_knot_offsets_cache.tag_dirty();
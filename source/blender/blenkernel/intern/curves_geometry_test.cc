@@ -280,6 +280,37 @@ TEST(curves_geometry, CatmullRomTwoPointCyclic)
   EXPECT_EQ(curves.evaluated_points_num(), 24);
 }
 
+TEST(curves_geometry, PartialPositionUpdate)
+{
+  CurvesGeometry curves = create_basic_curves(40, 4);
+  curves.fill_curve_types(CURVE_TYPE_CATMULL_ROM);
+  curves.resolution_for_write().fill(4);
+  curves.update_curve_types();
+
+  const Array<float3> evaluated_positions_orig(curves.evaluated_positions());
+
+  const IndexRange changed_points = curves.points_by_curve()[1];
+  for (float3 &position : curves.positions_for_write().slice(changed_points)) {
+    position.z += 1.0f;
+  }
+  curves.tag_positions_changed(IndexMask(IndexRange(1, 1)));
+  const Array<float3> evaluated_positions_partial(curves.evaluated_positions());
+
+  curves.tag_positions_changed();
+  const Span<float3> evaluated_positions = curves.evaluated_positions();
+  ASSERT_EQ(evaluated_positions_partial.size(), evaluated_positions.size());
+  for (const int i : evaluated_positions.index_range()) {
+    EXPECT_V3_NEAR(evaluated_positions_partial[i], evaluated_positions[i], EPSILON_FLT32);
+  }
+
+  /* Only the evaluated points of the changed curve have moved. */
+  const IndexRange changed_evaluated_points = curves.evaluated_points_by_curve()[1];
+  for (const int i : evaluated_positions.index_range()) {
+    const float z_offset = changed_evaluated_points.contains(i) ? 1.0f : 0.0f;
+    EXPECT_NEAR(evaluated_positions[i].z, evaluated_positions_orig[i].z + z_offset, 1e-5f);
+  }
+}
+
 TEST(curves_geometry, BezierPositionEvaluation)
 {
   CurvesGeometry curves(2, 1);
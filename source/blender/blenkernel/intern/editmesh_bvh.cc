@@ -11,6 +11,8 @@
 #include "BLI_kdopbvh.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_editmesh.hh"
 
@@ -29,6 +31,12 @@ struct BMBVHTree {
   bool cos_cage_free = false;
 
   int flag = 0;
+
+  /**
+   * Index into #looptris of every leaf in the order they were inserted into the tree.
+   * Only stored when faces were filtered, otherwise the leaf and triangle indices are the same.
+   */
+  Vector<int> leaf_tris;
 };
 
 BMBVHTree *BKE_bmbvh_new_from_editmesh(BMEditMesh *em,
@@ -96,6 +104,9 @@ BMBVHTree *BKE_bmbvh_new_ex(BMesh *bm,
   }
 
   bmtree->tree = BLI_bvhtree_new(tottri, epsilon, 8, 8);
+  if (test_fn) {
+    bmtree->leaf_tris.reserve(tottri);
+  }
 
   f_test_prev = nullptr;
   test_fn_ret = false;
@@ -112,6 +123,7 @@ BMBVHTree *BKE_bmbvh_new_ex(BMesh *bm,
       if (!test_fn_ret) {
         continue;
       }
+      bmtree->leaf_tris.append(i);
     }
 
     if (cos_cage) {
@@ -182,6 +194,36 @@ BVHTree *BKE_bmbvh_tree_get(BMBVHTree *bmtree)
   return bmtree->tree;
 }
 
+void BKE_bmbvh_update_positions(BMBVHTree *bmtree)
+{
+  const Span<std::array<BMLoop *, 3>> looptris = bmtree->looptris;
+  const Span<int> leaf_tris = bmtree->leaf_tris;
+  const float3 *cos_cage = bmtree->cos_cage;
+  BVHTree *tree = bmtree->tree;
+
+  /* Leaves are independent, only the branches have to be updated serially afterwards. */
+  const int leaves_num = BLI_bvhtree_get_len(tree);
+  threading::parallel_for(IndexRange(leaves_num), 1024, [&](const IndexRange range) {
+    for (const int leaf : range) {
+      const int i = leaf_tris.is_empty() ? leaf : leaf_tris[leaf];
+      float cos[3][3];
+      if (cos_cage) {
+        copy_v3_v3(cos[0], cos_cage[BM_elem_index_get(looptris[i][0]->v)]);
+        copy_v3_v3(cos[1], cos_cage[BM_elem_index_get(looptris[i][1]->v)]);
+        copy_v3_v3(cos[2], cos_cage[BM_elem_index_get(looptris[i][2]->v)]);
+      }
+      else {
+        copy_v3_v3(cos[0], looptris[i][0]->v->co);
+        copy_v3_v3(cos[1], looptris[i][1]->v->co);
+        copy_v3_v3(cos[2], looptris[i][2]->v->co);
+      }
+      BLI_bvhtree_update_node(tree, leaf, reinterpret_cast<float *>(cos), nullptr, 3);
+    }
+  });
+
+  BLI_bvhtree_update_tree(tree);
+}
+
 /* -------------------------------------------------------------------- */
 /* Utility BMesh cast/intersect functions */
 
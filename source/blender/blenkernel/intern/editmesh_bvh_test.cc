@@ -0,0 +1,73 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "BKE_editmesh_bvh.hh"
+
+#include "BLI_array.hh"
+
+#include "bmesh.hh"
+
+#include "testing/testing.h"
+
+namespace blender::bke::tests {
+
+/**
+ * Create a BMesh with two separate triangles, the first one being hidden, so that the leaf indices
+ * of a tree that skips hidden faces don't match the triangle indices.
+ */
+static BMesh *create_two_triangles()
+{
+  BMeshCreateParams create_params{};
+  BMesh *bm = BM_mesh_create(&bm_mesh_allocsize_default, &create_params);
+  for (const float x : {0.0f, 10.0f}) {
+    BMVert *verts[3] = {
+        BM_vert_create(bm, float3(x, 0.0f, 0.0f), nullptr, BM_CREATE_NOP),
+        BM_vert_create(bm, float3(x + 1.0f, 0.0f, 0.0f), nullptr, BM_CREATE_NOP),
+        BM_vert_create(bm, float3(x, 1.0f, 0.0f), nullptr, BM_CREATE_NOP),
+    };
+    BMFace *face = BM_face_create_verts(bm, verts, 3, nullptr, BM_CREATE_NOP, true);
+    if (x == 0.0f) {
+      BM_elem_flag_enable(face, BM_ELEM_HIDDEN);
+    }
+  }
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_FACE);
+  return bm;
+}
+
+static bool ray_cast_down(const BMBVHTree *bmtree, const float3 &co)
+{
+  const float3 dir(0.0f, 0.0f, -1.0f);
+  float dist = FLT_MAX;
+  return BKE_bmbvh_ray_cast(bmtree, co, dir, 0.0f, &dist, nullptr, nullptr) != nullptr;
+}
+
+TEST(editmesh_bvh, UpdatePositions)
+{
+  BMesh *bm = create_two_triangles();
+  Array<std::array<BMLoop *, 3>> looptris(bm->totface);
+  BM_mesh_calc_tessellation(bm, looptris);
+
+  BMBVHTree *bmtree = BKE_bmbvh_new(bm, looptris, BMBVH_RESPECT_HIDDEN, nullptr, false);
+  EXPECT_FALSE(ray_cast_down(bmtree, float3(0.25f, 0.25f, 1.0f)));
+  EXPECT_TRUE(ray_cast_down(bmtree, float3(10.25f, 0.25f, 1.0f)));
+  EXPECT_FALSE(ray_cast_down(bmtree, float3(15.25f, 0.25f, 1.0f)));
+
+  /* Move the visible triangle, the hidden one must still be skipped. */
+  BMIter iter;
+  BMVert *v;
+  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
+    if (v->co[0] > 5.0f) {
+      v->co[0] += 5.0f;
+    }
+  }
+  BKE_bmbvh_update_positions(bmtree);
+  EXPECT_FALSE(ray_cast_down(bmtree, float3(0.25f, 0.25f, 1.0f)));
+  EXPECT_FALSE(ray_cast_down(bmtree, float3(10.25f, 0.25f, 1.0f)));
+  EXPECT_TRUE(ray_cast_down(bmtree, float3(15.25f, 0.25f, 1.0f)));
+
+  BKE_bmbvh_free(bmtree);
+  BM_mesh_free(bm);
+}
+
+}  // namespace blender::bke::tests
@@ -129,12 +129,19 @@ void BKE_partdeflect_free(PartDeflect *pd)
 
 /******************** EFFECTOR RELATIONS ***********************/
 
-static void precalculate_effector(Depsgraph *depsgraph, EffectorCache *eff)
+static uint effector_random_seed(Depsgraph *depsgraph, const EffectorCache *eff)
 {
   float ctime = DEG_get_ctime(depsgraph);
   uint cfra = uint(ctime >= 0 ? ctime : -ctime);
 
-  eff->rng = BLI_rng_new(eff->pd->seed + cfra);
+  return eff->pd->seed + cfra;
+}
+
+static void precalculate_effector(Depsgraph *depsgraph, EffectorCache *eff)
+{
+  float ctime = DEG_get_ctime(depsgraph);
+
+  eff->rng = BLI_rng_new(effector_random_seed(depsgraph, eff));
 
   if (eff->pd->forcefield == PFIELD_GUIDE && eff->ob->type == OB_CURVES_LEGACY) {
     Curve *cu = id_cast<Curve *>(eff->ob->data);
@@ -363,6 +370,18 @@ ListBaseT<EffectorCache> *BKE_effectors_create(Depsgraph *depsgraph,
   return effectors;
 }
 
+void BKE_effectors_reset_random(ListBaseT<EffectorCache> *effectors)
+{
+  if (effectors == nullptr) {
+    return;
+  }
+  for (EffectorCache &eff : *effectors) {
+    if (eff.rng) {
+      BLI_rng_seed(eff.rng, effector_random_seed(eff.depsgraph, &eff));
+    }
+  }
+}
+
 void BKE_effectors_free(ListBaseT<EffectorCache> *lb)
 {
   if (lb) {
@@ -1198,6 +1198,13 @@ static bool driver_compile_simple_expr(ChannelDriver *driver)
   if (atomic_cas_ptr(reinterpret_cast<void **>(&driver->expr_simple), nullptr, expr) != nullptr) {
     BLI_expr_pylike_free(expr);
   }
+  else if (!BLI_expr_pylike_is_valid(expr) && driver->expression[0] != '\0') {
+    /* Report once per compilation, to help finding drivers that could be simplified. */
+    CLOG_DEBUG(&LOG,
+               "Driver expression is not supported by the simple expression evaluator, "
+               "using Python: '%s'",
+               driver->expression);
+  }
 
   return true;
 }
@@ -1136,7 +1136,7 @@ void Drawing::tag_positions_changed(const IndexMask &changed_curves)
   }
   /* Positions needs to be tagged first, because the triangle cache updates just after need the
    * positions to be up-to-date. */
-  this->strokes_for_write().tag_positions_changed();
+  this->strokes_for_write().tag_positions_changed(changed_curves);
   this->runtime->curve_plane_normals_cache.update([&](Vector<float3> &normals) {
     const CurvesGeometry &curves = this->strokes();
     update_curve_plane_normal_cache(
@@ -1207,7 +1207,7 @@ void Drawing::tag_topology_changed(const IndexMask &changed_curves)
   }
   /* Positions needs to be tagged first, because the triangle cache updates just after need the
    * positions to be up-to-date. */
-  this->strokes_for_write().tag_positions_changed();
+  this->strokes_for_write().tag_positions_changed(changed_curves);
   this->runtime->curve_plane_normals_cache.update([&](Vector<float3> &normals) {
     const CurvesGeometry &curves = this->strokes();
     update_curve_plane_normal_cache(
@@ -16,6 +16,7 @@
 #include "BLI_rect.h"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "DNA_image_types.h"
 #include "DNA_userdef_types.h"
@@ -35,6 +36,8 @@
 
 #include "CLG_log.h"
 
+#include <algorithm>
+
 namespace blender {
 
 static CLG_LogRef LOG = {"gpu.texture"};
@@ -630,11 +633,69 @@ void BKE_image_free_anim_gputextures(Main *bmain)
   }
 }
 
+static size_t image_gpu_memory_size(const Image &ima)
+{
+  size_t size = 0;
+  for (int i = 0; i < TEXTARGET_COUNT; i++) {
+    for (int eye = 0; eye < 2; eye++) {
+      if (const gpu::Texture *texture = ima.runtime->gputexture[i][eye]) {
+        size += GPU_texture_memory_size_get(texture);
+      }
+    }
+  }
+  return size;
+}
+
+/**
+ * Free the GPU textures of the least recently used images until all image textures fit inside
+ * the memory limit of the preferences. Images that were used in the last second are kept, so the
+ * limit can be exceeded when all those textures are needed to draw the scene, instead of freeing
+ * and recreating them on every redraw.
+ */
+static void image_free_gputextures_over_limit(Main *bmain, const int ctime)
+{
+  if (U.texmemlimit == 0) {
+    return;
+  }
+  const size_t memory_limit = size_t(U.texmemlimit) * 1024 * 1024;
+
+  size_t memory_used = 0;
+  Vector<std::pair<Image *, size_t>> candidates;
+  for (Image &ima : bmain->images) {
+    const size_t size = image_gpu_memory_size(ima);
+    if (size == 0) {
+      continue;
+    }
+    memory_used += size;
+    if ((ima.flag & IMA_NOCOLLECT) == 0 && ima.runtime->lastused < ctime) {
+      candidates.append({&ima, size});
+    }
+  }
+  if (memory_used <= memory_limit) {
+    return;
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) {
+    return a.first->runtime->lastused < b.first->runtime->lastused;
+  });
+  for (const auto &[ima, size] : candidates) {
+    if (memory_used <= memory_limit) {
+      break;
+    }
+    BKE_image_free_gputextures(ima);
+    memory_used -= size;
+  }
+}
+
 void BKE_image_free_old_gputextures(Main *bmain)
 {
   static int lasttime = 0;
   int ctime = int(BLI_time_now_seconds());
 
+  if (!G.is_rendering) {
+    image_free_gputextures_over_limit(bmain, ctime);
+  }
+
   /*
    * Run garbage collector once for every collecting period of time
    * if textimeout is 0, that's the option to NOT run the collector
@@ -78,6 +78,7 @@ static void shapekey_copy_data(Main * /*bmain*/,
     if (kb_dst->data) {
       kb_dst->data = MEM_dupalloc_void(kb_dst->data);
     }
+    kb_dst->runtime = MEM_new<bke::KeyBlockRuntime>(__func__);
     if (kb_src == key_src->refkey) {
       key_dst->refkey = kb_dst;
     }
@@ -91,6 +92,7 @@ static void shapekey_free_data(ID *id)
     if (kb->data) {
       MEM_delete_void(kb->data);
     }
+    MEM_delete(kb->runtime);
     MEM_delete(kb);
   }
 }
@@ -125,6 +127,7 @@ static void shapekey_blend_write(BlendWriter *writer, ID *id, const void *id_add
   /* Direct data. */
   for (KeyBlock &kb : key->block) {
     KeyBlock tmp_kb = kb;
+    tmp_kb.runtime = nullptr;
     /* Do not store actual geometry data in case this is a library override ID. */
     if (ID_IS_OVERRIDE_LIBRARY(key) && !is_undo) {
       tmp_kb.totelem = 0;
@@ -151,6 +154,7 @@ static void shapekey_blend_read_data(BlendDataReader *reader, ID *id)
 
   for (KeyBlock &kb : key->block) {
     BLO_read_data_address(reader, &kb.data);
+    kb.runtime = nullptr;
 
     /* NOTE: This is endianness-sensitive. */
     /* Keyblock data would need specific endian switching depending of the exact type of data it
@@ -216,6 +220,7 @@ void BKE_key_free_nolib(Key *key)
     if (kb->data) {
       MEM_delete_void(kb->data);
     }
+    MEM_delete(kb->runtime);
     MEM_delete(kb);
   }
 }
@@ -665,6 +670,43 @@ static void copy_key_float3_weighted(const int vertex_count,
   }
 }
 
+/**
+ * Get the elements of a relative key that differ from its reference key, see
+ * #bke::KeyBlockRuntime::changed_elements. All elements are returned when the data of the key can
+ * change without its runtime data being freed.
+ */
+static IndexMask keyblock_changed_elements_get(const Key &key,
+                                               KeyBlock &kb,
+                                               const float *data,
+                                               const float *reference_data,
+                                               const int vertex_count)
+{
+  const IndexRange all_elements(vertex_count);
+  if (!kb.runtime || !(key.id.tag & ID_TAG_COPIED_ON_EVAL) || data != kb.data) {
+    return all_elements;
+  }
+  bke::KeyBlockRuntime &runtime = *kb.runtime;
+  std::scoped_lock lock(runtime.changed_elements_mutex);
+  if (runtime.changed_elements_data == nullptr) {
+    const Span<float3> positions(reinterpret_cast<const float3 *>(data), vertex_count);
+    const Span<float3> reference_positions(reinterpret_cast<const float3 *>(reference_data),
+                                           vertex_count);
+    runtime.changed_elements = IndexMask::from_predicate(
+        all_elements,
+        runtime.changed_elements_memory,
+        [&](const int64_t i) { return positions[i] != reference_positions[i]; },
+        exec_mode::grain_size(4096));
+    runtime.changed_elements_data = data;
+    runtime.changed_elements_reference_data = reference_data;
+  }
+  else if (runtime.changed_elements_data != data ||
+           runtime.changed_elements_reference_data != reference_data)
+  {
+    return all_elements;
+  }
+  return runtime.changed_elements;
+}
+
 /**
  * Shapekey evaluation for data of 3 floats (Vector3).
  *
@@ -715,14 +757,16 @@ static void key_evaluate_relative_float3(Key *key,
     /* For meshes, use the original values instead of the bmesh values to
      * maintain a constant offset. */
     const float *reffrom = static_cast<float *>(reference_kb->data);
-    threading::parallel_for(IndexRange(vertex_count), 1024, [&](const IndexRange range) {
-      for (const int i : range) {
-        const float weight = weights ? (weights[i] * kb.curval) : kb.curval;
-        /* Each vertex has 3 floats. */
-        const int vector_index = i * 3;
-        add_weighted_vector(vector_index, weight, reffrom, from, target_data);
-      }
-    });
+    const IndexMask changed_elements = keyblock_changed_elements_get(
+        *key, kb, from, reffrom, vertex_count);
+    changed_elements.foreach_index(
+        [&](const int64_t i) {
+          const float weight = weights ? (weights[i] * kb.curval) : kb.curval;
+          /* Each vertex has 3 floats. */
+          const int vector_index = i * 3;
+          add_weighted_vector(vector_index, weight, reffrom, from, target_data);
+        },
+        exec_mode::grain_size(1024));
 
     if (freefrom) {
       MEM_delete(freefrom);
@@ -151,6 +151,48 @@ TEST_F(ShapekeyTest, mesh_key_evaluation_relative)
   MEM_delete(ob_eval);
 }
 
+/* Test that evaluated relative keys only blend the vertices that differ from the reference. */
+TEST_F(ShapekeyTest, mesh_key_evaluation_relative_changed_elements)
+{
+  Key *key = BKE_key_add(bmain, &mesh->id);
+  mesh->key = key;
+  key->type = KEY_RELATIVE;
+  KeyBlock *base = BKE_keyblock_add(key, "base");
+  BKE_keyblock_convert_from_mesh(mesh, key, base);
+
+  KeyBlock *key1 = BKE_keyblock_add(key, "one");
+  BKE_keyblock_convert_from_mesh(mesh, key, key1);
+  float3 *key1_data = reinterpret_cast<float3 *>(key1->data);
+  key1_data[2] = {2, 2, 2};
+
+  /* Pretend the key is an evaluated copy, only for those the changed elements are cached. */
+  key->id.tag |= ID_TAG_COPIED_ON_EVAL;
+  key1->runtime = MEM_new<KeyBlockRuntime>(__func__);
+
+  int totelem = 0;
+  key1->curval = 1.0;
+  float3 *ob_eval = reinterpret_cast<float3 *>(BKE_key_evaluate_object(ob, &totelem));
+  ASSERT_NE(ob_eval, nullptr);
+  Array<float3> expected = {
+      {0, 0, 0},
+      {1, 0, 0},
+      {2, 2, 2},
+      {0, 1, 0},
+  };
+  EXPECT_EQ_ARRAY(&expected[0], ob_eval, 4);
+  MEM_delete(ob_eval);
+  EXPECT_EQ(key1->runtime->changed_elements.size(), 1);
+  EXPECT_EQ(key1->runtime->changed_elements.first(), 2);
+
+  key1->curval = 0.5;
+  ob_eval = reinterpret_cast<float3 *>(BKE_key_evaluate_object(ob, &totelem));
+  expected[2] = {1.5f, 1.5f, 1};
+  EXPECT_EQ_ARRAY(&expected[0], ob_eval, 4);
+  MEM_delete(ob_eval);
+
+  key->id.tag &= ~ID_TAG_COPIED_ON_EVAL;
+}
+
 TEST_F(ShapekeyTest, mesh_key_evaluation_absolute)
 {
   Key *key = BKE_key_add(bmain, &mesh->id);
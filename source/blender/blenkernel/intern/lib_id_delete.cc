@@ -35,6 +35,8 @@
 
 #include "BLO_readfile.hh"
 
+#include "ANIM_evaluation.hh"
+
 #include "lib_intern.hh"
 
 #include "DEG_depsgraph.hh"
@@ -100,6 +102,7 @@ void BKE_libblock_free_runtime_data(ID *id)
      * replaced by assets are deleted. This means that the regular "delete this ID" flow (aka this
      * code here) also needs to free this data. */
     BLO_readfile_id_runtime_data_free(*id);
+    animrig::evaluation_cache_free(id->runtime->anim_eval_cache);
 
     MEM_SAFE_DELETE(id->runtime);
   }
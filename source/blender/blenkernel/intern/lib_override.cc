@@ -837,6 +837,33 @@ struct LibOverrideGroupTagData {
     return is_missing;
   }
 
+  /**
+   * When set, all entries of `Main.relations` tagged as processed by the recursive tagging
+   * functions are also stored in `processed_relations_entries`, so that their tags can be cleared
+   * without looping over all relations entries (see #processed_relations_entries_clear). This
+   * matters when tagging is done for many small hierarchies in a row, as during resync.
+   */
+  bool do_store_processed_relations_entries;
+  Vector<MainIDRelationsEntry *> processed_relations_entries;
+
+  void relations_entry_tag_processed(MainIDRelationsEntry *entry,
+                                     const eMainIDRelationsEntryTags processed_tag)
+  {
+    entry->tags |= processed_tag;
+    if (do_store_processed_relations_entries) {
+      processed_relations_entries.append(entry);
+    }
+  }
+  /** Equivalent to clearing #MAINIDRELATIONS_ENTRY_TAGS_PROCESSED from all relations entries. */
+  void processed_relations_entries_clear()
+  {
+    BLI_assert(do_store_processed_relations_entries);
+    for (MainIDRelationsEntry *entry : processed_relations_entries) {
+      entry->tags &= ~MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+    }
+    processed_relations_entries.clear();
+  }
+
   /* Mapping linked objects to all their instantiating collections (as a linked list).
    * Avoids calling #BKE_collection_object_find over and over, this function is very expansive. */
   GHash *linked_object_to_instantiating_collections;
@@ -845,6 +872,8 @@ struct LibOverrideGroupTagData {
   void clear()
   {
     linked_ids_hierarchy_default_override.clear();
+    processed_relations_entries.clear_and_shrink();
+    do_store_processed_relations_entries = false;
     BLI_ghash_free(linked_object_to_instantiating_collections, nullptr, nullptr);
     BLI_memarena_free(mem_arena);
 
@@ -981,7 +1010,7 @@ static void lib_override_hierarchy_dependencies_recursive_tag_from(LibOverrideGr
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_FROM;
+  data->relations_entry_tag_processed(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_FROM);
 
   for (MainIDRelationsEntryItem *from_id_entry = entry->from_ids; from_id_entry != nullptr;
        from_id_entry = from_id_entry->next)
@@ -1023,7 +1052,7 @@ static bool lib_override_hierarchy_dependencies_recursive_tag(LibOverrideGroupTa
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_TO;
+  data->relations_entry_tag_processed(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_TO);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != nullptr;
        to_id_entry = to_id_entry->next)
@@ -1071,7 +1100,7 @@ static void lib_override_linked_group_tag_recursive(LibOverrideGroupTagData *dat
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  data->relations_entry_tag_processed(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != nullptr;
        to_id_entry = to_id_entry->next)
@@ -1339,7 +1368,7 @@ static void lib_override_overrides_group_tag_recursive(LibOverrideGroupTagData *
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  data->relations_entry_tag_processed(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != nullptr;
        to_id_entry = to_id_entry->next)
@@ -3478,6 +3507,9 @@ static bool lib_override_library_main_resync_on_library_indirect_level(
   data.missing_tag = ID_TAG_MISSING;
   data.is_override = false;
   data.is_resync = true;
+  /* Each hierarchy only processes a small part of all IDs, clearing the processed tags on all
+   * relations entries after each of them would make this loop quadratic. */
+  data.do_store_processed_relations_entries = true;
   lib_override_group_tag_data_object_to_collection_init(&data);
   ID *id;
   FOREACH_MAIN_ID_BEGIN (bmain, id) {
@@ -3492,9 +3524,9 @@ static bool lib_override_library_main_resync_on_library_indirect_level(
 
     data.root_set(id->override_library->reference);
     lib_override_linked_group_tag(&data);
-    BKE_main_relations_tag_set(bmain, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED, false);
+    data.processed_relations_entries_clear();
     lib_override_hierarchy_dependencies_recursive_tag(&data);
-    BKE_main_relations_tag_set(bmain, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED, false);
+    data.processed_relations_entries_clear();
   }
   FOREACH_MAIN_ID_END;
   data.clear();
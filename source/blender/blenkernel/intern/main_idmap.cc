@@ -7,9 +7,9 @@
 
 #include "MEM_guardedalloc.h"
 
-#include "BLI_ghash.h"
+#include "BLI_listbase.h"
 #include "BLI_map.hh"
-#include "BLI_mempool.h"
+#include "BLI_string_ref.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_ID.h"
@@ -34,20 +34,31 @@ namespace blender {
  * This doesn't account for adding/removing data-blocks,
  * and should only be used when performing many lookups.
  *
- * \note GHash's are initialized on demand,
+ * \note Name maps are initialized on demand,
  * since its likely some types will never have lookups run on them,
  * so its a waste to create and never use.
  * \{ */
 
 struct IDNameLib_Key {
   /** `ID.name + 2`: without the ID type prefix, since each id type gets its own 'map'. */
-  const char *name;
+  StringRefNull name;
   /** `ID.lib`: */
   const Library *lib;
+
+  uint64_t hash() const
+  {
+    return get_default_hash(name, lib);
+  }
+
+  friend bool operator==(const IDNameLib_Key &a, const IDNameLib_Key &b)
+  {
+    return a.lib == b.lib && a.name == b.name;
+  }
 };
 
 struct IDNameLib_TypeMap {
-  GHash *map;
+  /** The keys reference the names stored in the IDs, so no separate allocations are needed. */
+  Map<IDNameLib_Key, ID *> *map;
   short id_type;
 };
 
@@ -60,18 +71,16 @@ struct IDNameLib_Map {
   Main *bmain;
   Set<const ID *> *valid_id_pointers;
   int idmap_types;
-
-  /* For storage of keys for the #TypeMap #GHash, avoids many single allocations. */
-  BLI_mempool *type_maps_keys_pool;
 };
 
 static IDNameLib_TypeMap *main_idmap_from_idcode(IDNameLib_Map *id_map, short id_type)
 {
   if (id_map->idmap_types & MAIN_IDMAP_TYPE_NAME) {
-    for (int i = 0; i < INDEX_ID_MAX; i++) {
-      if (id_map->type_maps[i].id_type == id_type) {
-        return &id_map->type_maps[i];
-      }
+    /* The type maps are stored in the order of the ID type indices. */
+    const int index = BKE_idtype_idcode_to_index(id_type);
+    if (index >= 0 && index < INDEX_ID_MAX) {
+      BLI_assert(id_map->type_maps[index].id_type == id_type);
+      return &id_map->type_maps[index];
     }
   }
   return nullptr;
@@ -94,7 +103,6 @@ IDNameLib_Map *BKE_main_idmap_create(Main *bmain,
     BLI_assert(type_map->id_type != 0);
   }
   BLI_assert(index == INDEX_ID_MAX);
-  id_map->type_maps_keys_pool = nullptr;
 
   if (idmap_types & MAIN_IDMAP_TYPE_UID) {
     ID *id;
@@ -130,13 +138,7 @@ void BKE_main_idmap_insert_id(IDNameLib_Map *id_map, ID *id)
 
     /* No need to do anything if map has not been lazily created yet. */
     if (LIKELY(type_map != nullptr) && type_map->map != nullptr) {
-      BLI_assert(id_map->type_maps_keys_pool != nullptr);
-
-      IDNameLib_Key *key = static_cast<IDNameLib_Key *>(
-          BLI_mempool_alloc(id_map->type_maps_keys_pool));
-      key->name = id->name + 2;
-      key->lib = id->lib;
-      BLI_ghash_insert(type_map->map, key, id);
+      type_map->map->add_overwrite({id->name + 2, id->lib}, id);
     }
   }
 
@@ -155,12 +157,7 @@ void BKE_main_idmap_remove_id(IDNameLib_Map *id_map, const ID *id)
 
     /* No need to do anything if map has not been lazily created yet. */
     if (LIKELY(type_map != nullptr) && type_map->map != nullptr) {
-      BLI_assert(id_map->type_maps_keys_pool != nullptr);
-
-      /* NOTE: We cannot free the key from the MemPool here, would need new API from GHash to also
-       * retrieve key pointer. Not a big deal for now */
-      IDNameLib_Key key{id->name + 2, id->lib};
-      BLI_ghash_remove(type_map->map, &key, nullptr, nullptr);
+      type_map->map->remove({id->name + 2, id->lib});
     }
   }
 
@@ -176,23 +173,6 @@ Main *BKE_main_idmap_main_get(IDNameLib_Map *id_map)
   return id_map->bmain;
 }
 
-static uint idkey_hash(const void *ptr)
-{
-  const IDNameLib_Key *idkey = static_cast<const IDNameLib_Key *>(ptr);
-  uint key = BLI_ghashutil_strhash(idkey->name);
-  if (idkey->lib) {
-    key ^= BLI_ghashutil_ptrhash(idkey->lib);
-  }
-  return key;
-}
-
-static bool idkey_cmp(const void *a, const void *b)
-{
-  const IDNameLib_Key *idkey_a = static_cast<const IDNameLib_Key *>(a);
-  const IDNameLib_Key *idkey_b = static_cast<const IDNameLib_Key *>(b);
-  return !STREQ(idkey_a->name, idkey_b->name) || (idkey_a->lib != idkey_b->lib);
-}
-
 ID *BKE_main_idmap_lookup_name(IDNameLib_Map *id_map,
                                short id_type,
                                const char *name,
@@ -206,24 +186,15 @@ ID *BKE_main_idmap_lookup_name(IDNameLib_Map *id_map,
 
   /* Lazy init. */
   if (type_map->map == nullptr) {
-    if (id_map->type_maps_keys_pool == nullptr) {
-      id_map->type_maps_keys_pool = BLI_mempool_create(
-          sizeof(IDNameLib_Key), 1024, 1024, BLI_MEMPOOL_NOP);
-    }
-
-    GHash *map = type_map->map = BLI_ghash_new(idkey_hash, idkey_cmp, __func__);
+    type_map->map = MEM_new<Map<IDNameLib_Key, ID *>>(__func__);
     ListBaseT<ID> *lb = which_libbase(id_map->bmain, id_type);
+    type_map->map->reserve(BLI_listbase_count(lb));
     for (ID *id = static_cast<ID *>(lb->first); id; id = static_cast<ID *>(id->next)) {
-      IDNameLib_Key *key = static_cast<IDNameLib_Key *>(
-          BLI_mempool_alloc(id_map->type_maps_keys_pool));
-      key->name = id->name + 2;
-      key->lib = id->lib;
-      BLI_ghash_insert(map, key, id);
+      type_map->map->add_overwrite({id->name + 2, id->lib}, id);
     }
   }
 
-  const IDNameLib_Key key_lookup = {name, lib};
-  return static_cast<ID *>(BLI_ghash_lookup(type_map->map, &key_lookup));
+  return type_map->map->lookup_default({name, lib}, nullptr);
 }
 
 ID *BKE_main_idmap_lookup_id(IDNameLib_Map *id_map, const ID *id)
@@ -253,7 +224,7 @@ void BKE_main_idmap_clear(IDNameLib_Map &id_map)
   if (id_map.idmap_types & MAIN_IDMAP_TYPE_NAME) {
     for (IDNameLib_TypeMap &type_map : id_map.type_maps) {
       if (type_map.map) {
-        BLI_ghash_clear(type_map.map, nullptr, nullptr);
+        type_map.map->clear();
       }
     }
   }
@@ -270,22 +241,13 @@ void BKE_main_idmap_destroy(IDNameLib_Map *id_map)
 {
   if (id_map->idmap_types & MAIN_IDMAP_TYPE_NAME) {
     for (IDNameLib_TypeMap &type_map : id_map->type_maps) {
-      if (type_map.map) {
-        BLI_ghash_free(type_map.map, nullptr, nullptr);
-        type_map.map = nullptr;
-      }
-    }
-    if (id_map->type_maps_keys_pool != nullptr) {
-      BLI_mempool_destroy(id_map->type_maps_keys_pool);
-      id_map->type_maps_keys_pool = nullptr;
+      MEM_SAFE_DELETE(type_map.map);
     }
   }
   if (id_map->idmap_types & MAIN_IDMAP_TYPE_UID) {
     MEM_delete(id_map->uid_map);
   }
 
-  BLI_assert(id_map->type_maps_keys_pool == nullptr);
-
   MEM_delete(id_map->valid_id_pointers);
   MEM_delete(id_map);
 }
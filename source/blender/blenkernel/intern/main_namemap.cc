@@ -66,7 +66,7 @@ struct UniqueName_Value {
    *
    * For global maps, this is a much more common case, as duplicates of ID names across libraries
    * are fairly common. */
-  std::optional<Map<int, int>> numbers_multi_usages = std::nullopt;
+  std::unique_ptr<Map<int, int>> numbers_multi_usages = nullptr;
 
   void mark_used(const int number)
   {
@@ -76,8 +76,8 @@ struct UniqueName_Value {
         this->mask.resize(number + 1);
       }
       if (this->mask[number]) {
-        if (!this->numbers_multi_usages.has_value()) {
-          this->numbers_multi_usages.emplace();
+        if (!this->numbers_multi_usages) {
+          this->numbers_multi_usages = std::make_unique<Map<int, int>>();
         }
         int &multi_usages_num = this->numbers_multi_usages->lookup_or_add(number, 1);
         BLI_assert(multi_usages_num >= 1);
@@ -105,7 +105,7 @@ struct UniqueName_Value {
                      "Trying to unregister a number suffix higher than current size of the bit "
                      "vector, should never happen.");
 
-      if (this->numbers_multi_usages.has_value() && this->numbers_multi_usages->contains(number)) {
+      if (this->numbers_multi_usages && this->numbers_multi_usages->contains(number)) {
         int &multi_usages_num = this->numbers_multi_usages->lookup(number);
         BLI_assert(multi_usages_num > 1);
         multi_usages_num--;
@@ -171,8 +171,9 @@ struct UniqueName_TypeMap {
    * For global maps, a same name can be used by several IDs from different libraries. */
   Map<std::string, int> full_names;
   /* For each base name (i.e. without numeric suffix), track the
-   * numeric suffixes that are in use. */
-  Map<std::string, std::unique_ptr<UniqueName_Value>> base_name_to_num_suffix;
+   * numeric suffixes that are in use. The values are stored inline, to avoid a separate
+   * allocation for every base name. */
+  Map<std::string, UniqueName_Value> base_name_to_num_suffix;
 };
 
 struct UniqueName_Map {
@@ -233,9 +234,9 @@ struct UniqueName_Map {
       const std::string name_base = BLI_string_split_name_number(BKE_id_name(*id), '.', number);
 
       /* Get and update the entry for this base name. */
-      std::unique_ptr<UniqueName_Value> &val = type_map.base_name_to_num_suffix.lookup_or_add_as(
-          name_base, std::make_unique<UniqueName_Value>(UniqueName_Value{}));
-      val->mark_used(number);
+      UniqueName_Value &val = type_map.base_name_to_num_suffix.lookup_or_add_default_as(
+          name_base);
+      val.mark_used(number);
     }
     FOREACH_MAIN_ID_END;
   }
@@ -253,9 +254,9 @@ struct UniqueName_Map {
       /* By definition adding to global map is always successful. */
       int &count = type_map.full_names.lookup_or_add_as(name_full, 0);
       if (!count) {
-        std::unique_ptr<UniqueName_Value> &val = type_map.base_name_to_num_suffix.lookup_or_add_as(
-            name_base, std::make_unique<UniqueName_Value>(UniqueName_Value{}));
-        val->mark_used(number);
+        UniqueName_Value &val = type_map.base_name_to_num_suffix.lookup_or_add_default_as(
+            name_base);
+        val.mark_used(number);
       }
       count++;
       return;
@@ -267,9 +268,8 @@ struct UniqueName_Map {
       return;
     }
 
-    std::unique_ptr<UniqueName_Value> &val = type_map.base_name_to_num_suffix.lookup_or_add_as(
-        name_base, std::make_unique<UniqueName_Value>(UniqueName_Value{}));
-    val->mark_used(number);
+    UniqueName_Value &val = type_map.base_name_to_num_suffix.lookup_or_add_default_as(name_base);
+    val.mark_used(number);
   }
   void add_name(const short id_type, StringRef name_full, StringRef name_base, const int number)
   {
@@ -306,14 +306,13 @@ struct UniqueName_Map {
 
     int number = 0;
     const std::string name_base = BLI_string_split_name_number(name_full, '.', number);
-    std::unique_ptr<UniqueName_Value> *val = type_map.base_name_to_num_suffix.lookup_ptr(
-        name_base);
+    UniqueName_Value *val = type_map.base_name_to_num_suffix.lookup_ptr(name_base);
     if (val == nullptr) {
       BLI_assert_unreachable();
       return;
     }
-    val->get()->mark_unused(number);
-    if (!val->get()->max_value_in_use) {
+    val->mark_unused(number);
+    if (!val->max_value_in_use) {
       /* This was the only base name usage, remove the whole key. */
       type_map.base_name_to_num_suffix.remove(name_base);
     }
@@ -472,9 +471,8 @@ static bool id_name_final_build(UniqueName_TypeMap &type_map,
     BLI_str_utf8_invalid_strip(base_name_modified, r_name_final.size() - 1);
 
     r_name_final = base_name_modified;
-    std::unique_ptr<UniqueName_Value> *val = type_map.base_name_to_num_suffix.lookup_ptr(
-        r_name_final);
-    if (!val || val->get()->max_value_in_use.value_or(0) < MAX_NUMBER) {
+    const UniqueName_Value *val = type_map.base_name_to_num_suffix.lookup_ptr(r_name_final);
+    if (!val || val->max_value_in_use.value_or(0) < MAX_NUMBER) {
       return false;
     }
   }
@@ -484,9 +482,8 @@ static bool id_name_final_build(UniqueName_TypeMap &type_map,
   const StringRef new_base_name = r_name_final;
   r_name_final = fmt::format("{}_{:03}", r_name_final, suffix);
   while (r_name_final.size() < MAX_ID_NAME - 2 - 12) {
-    std::unique_ptr<UniqueName_Value> *val = type_map.base_name_to_num_suffix.lookup_ptr(
-        r_name_final);
-    if (!val || val->get()->max_value_in_use.value_or(0) < MAX_NUMBER) {
+    const UniqueName_Value *val = type_map.base_name_to_num_suffix.lookup_ptr(r_name_final);
+    if (!val || val->max_value_in_use.value_or(0) < MAX_NUMBER) {
       return false;
     }
     suffix++;
@@ -505,9 +502,8 @@ static bool id_name_final_build(UniqueName_TypeMap &type_map,
   BLI_assert(new_base_name.size() <= 8);
   while (true) {
     r_name_final = fmt::format("{}_{}", new_base_name, uint32_t(get_default_hash(r_name_final)));
-    std::unique_ptr<UniqueName_Value> *val = type_map.base_name_to_num_suffix.lookup_ptr(
-        r_name_final);
-    if (!val || val->get()->max_value_in_use.value_or(0) < MAX_NUMBER) {
+    const UniqueName_Value *val = type_map.base_name_to_num_suffix.lookup_ptr(r_name_final);
+    if (!val || val->max_value_in_use.value_or(0) < MAX_NUMBER) {
       return false;
     }
   }
@@ -533,8 +529,7 @@ static bool namemap_get_name(Main &bmain,
     /* Get the name and number parts ("name.number"). */
     int number = 0;
     const std::string name_base = BLI_string_split_name_number(r_name_full, '.', number);
-    std::unique_ptr<UniqueName_Value> &val = type_map.base_name_to_num_suffix.lookup_or_add_as(
-        name_base, std::make_unique<UniqueName_Value>(UniqueName_Value{}));
+    UniqueName_Value &val = type_map.base_name_to_num_suffix.lookup_or_add_default_as(name_base);
 
     /* If the full original name is unused, and its number suffix is unused, or is above the max
      * managed value, the name can be used directly.
@@ -559,7 +554,7 @@ static bool namemap_get_name(Main &bmain,
     /* The base name and current number suffix are already used.
      * Request the lowest available valid number suffix (will return #NO_AVAILABLE_NUMBER if none
      * are available for the current base name). */
-    const int number_to_use = val->get_smallest_unused();
+    const int number_to_use = val.get_smallest_unused();
 
     /* Try to build final name from the current base name and the number.
      * Note that this will fail if the suffix number is #NO_AVAILABLE_NUMBER, or if the base name
@@ -6,6 +6,8 @@
  * \ingroup bke
  */
 
+#include <atomic>
+
 #include "BLI_array_utils.hh"
 #include "BLI_math_base.h"
 #include "BLI_ordered_edge.hh"
@@ -185,18 +187,31 @@ static IndexMask mask_first_distinct_edges(const Span<int2> edges,
   }
 
   constexpr int no_original_edge = std::numeric_limits<int>::max();
-  Array<int> map_edge_to_first_original(edge_offsets.total_size());
-  map_edge_to_first_original.as_mutable_span().fill(no_original_edge);
-
-  /* TODO: Lock-free parallel version? BLI' "atomic::min<T>(T&, T);" ? */
-  edges_to_check.foreach_index_optimized<int>([&](const int edge_i) {
-    const OrderedEdge edge = edges[edge_i];
-    const int map_i = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
-    const int edge_index = edge_maps[map_i].index_of(edge);
-
-    int &original_edge = map_edge_to_first_original[edge_offsets[map_i][edge_index]];
-    original_edge = math::min(original_edge, edge_i);
-  });
+  Array<std::atomic<int>> map_edge_to_first_original(edge_offsets.total_size());
+  threading::parallel_for(
+      map_edge_to_first_original.index_range(), 4096, [&](const IndexRange range) {
+        for (const int i : range) {
+          map_edge_to_first_original[i].store(no_original_edge, std::memory_order_relaxed);
+        }
+      });
+
+  /* Duplicate edges can be processed by different threads, so the smallest index is found with an
+   * atomic compare-and-swap loop. The result doesn't depend on the order of the updates. */
+  edges_to_check.foreach_index_optimized<int>(
+      [&](const int edge_i) {
+        const OrderedEdge edge = edges[edge_i];
+        const int map_i = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
+        const int edge_index = edge_maps[map_i].index_of(edge);
+
+        std::atomic<int> &original_edge =
+            map_edge_to_first_original[edge_offsets[map_i][edge_index]];
+        int current = original_edge.load(std::memory_order_relaxed);
+        while (edge_i < current &&
+               !original_edge.compare_exchange_weak(current, edge_i, std::memory_order_relaxed))
+        {
+        }
+      },
+      exec_mode::grain_size(4096));
 
   /* Note: #map_edge_to_first_original might still contains #no_original_edge if edges was both non
    * distinct and not full set. */
@@ -205,7 +220,8 @@ static IndexMask mask_first_distinct_edges(const Span<int2> edges,
     const OrderedEdge edge = edges[srd_edge_i];
     const int map_i = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
     const int edge_index = edge_maps[map_i].index_of(edge);
-    return map_edge_to_first_original[edge_offsets[map_i][edge_index]] == srd_edge_i;
+    return map_edge_to_first_original[edge_offsets[map_i][edge_index]].load(
+               std::memory_order_relaxed) == srd_edge_i;
   });
 }
 
@@ -415,22 +431,27 @@ void mesh_calc_edges(Mesh &mesh,
         /* TODO: Check if mask is range. */
         edge_map_to_result_index.reinitialize(result_edges_num);
         edge_map_to_result_index.as_mutable_span().fill(1);
-        src_to_dst_mask.foreach_index([&](const int original_edge_i) {
-          const OrderedEdge edge = original_edges[original_edge_i];
-          const int edge_map = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
-          const int edge_index = edge_maps[edge_map].index_of(edge);
-          edge_map_to_result_index[edge_offsets[edge_map][edge_index]] = 0;
-        });
+        /* The mask only contains one edge per distinct edge, so the writes don't overlap. */
+        src_to_dst_mask.foreach_index(
+            [&](const int original_edge_i) {
+              const OrderedEdge edge = original_edges[original_edge_i];
+              const int edge_map = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
+              const int edge_index = edge_maps[edge_map].index_of(edge);
+              edge_map_to_result_index[edge_offsets[edge_map][edge_index]] = 0;
+            },
+            exec_mode::grain_size(1024));
 
         offset_indices::accumulate_counts_to_offsets(edge_map_to_result_index.as_mutable_span(),
                                                      old_corner_edges_num);
 
-        src_to_dst_mask.foreach_index([&](const int original_edge_i, const int dst_edge_i) {
-          const OrderedEdge edge = original_edges[original_edge_i];
-          const int edge_map = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
-          const int edge_index = edge_maps[edge_map].index_of(edge);
-          edge_map_to_result_index[edge_offsets[edge_map][edge_index]] = dst_edge_i;
-        });
+        src_to_dst_mask.foreach_index(
+            [&](const int original_edge_i, const int dst_edge_i) {
+              const OrderedEdge edge = original_edges[original_edge_i];
+              const int edge_map = calc_edges::edge_to_hash_map_i(edge, parallel_mask);
+              const int edge_index = edge_maps[edge_map].index_of(edge);
+              edge_map_to_result_index[edge_offsets[edge_map][edge_index]] = dst_edge_i;
+            },
+            exec_mode::grain_size(1024));
 
         array_utils::gather(
             original_edges, src_to_dst_mask, edge_verts.take_front(old_corner_edges_num));
@@ -0,0 +1,147 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "CLG_log.h"
+
+#include "BLI_ordered_edge.hh"
+#include "BLI_set.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.hh"
+
+#include "DNA_mesh_types.h"
+
+namespace blender::bke::tests {
+
+class MeshCalcEdgesTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    BKE_idtype_init();
+  }
+
+  static void TearDownTestSuite()
+  {
+    CLG_exit();
+  }
+};
+
+/** Create a grid of `size` by `size` quads with uninitialized edges. */
+static Mesh *create_grid_mesh(const int size, const int edges_num = 0)
+{
+  const int verts_x = size + 1;
+  Mesh *mesh = BKE_mesh_new_nomain(verts_x * verts_x, edges_num, size * size, size * size * 4);
+  MutableSpan<float3> positions = mesh->vert_positions_for_write();
+  MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
+  MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
+  threading::parallel_for(IndexRange(verts_x), 64, [&](const IndexRange range) {
+    for (const int y : range) {
+      for (const int x : IndexRange(verts_x)) {
+        positions[y * verts_x + x] = float3(x, y, 0.0f);
+      }
+    }
+  });
+  threading::parallel_for(IndexRange(size), 64, [&](const IndexRange range) {
+    for (const int y : range) {
+      for (const int x : IndexRange(size)) {
+        const int face = y * size + x;
+        const int vert = y * verts_x + x;
+        face_offsets[face] = face * 4;
+        corner_verts[face * 4 + 0] = vert;
+        corner_verts[face * 4 + 1] = vert + 1;
+        corner_verts[face * 4 + 2] = vert + verts_x + 1;
+        corner_verts[face * 4 + 3] = vert + verts_x;
+      }
+    }
+  });
+  return mesh;
+}
+
+static int grid_edges_num(const int size)
+{
+  return 2 * size * (size + 1);
+}
+
+static void expect_valid_corner_edges(const Mesh &mesh)
+{
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int2> edges = mesh.edges();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const Span<int> corner_edges = mesh.corner_edges();
+  for (const int face : faces.index_range()) {
+    for (const int corner : faces[face]) {
+      const int vert_next = corner_verts[mesh::face_corner_next(faces[face], corner)];
+      EXPECT_EQ(OrderedEdge(edges[corner_edges[corner]]),
+                OrderedEdge(corner_verts[corner], vert_next));
+    }
+  }
+}
+
+TEST_F(MeshCalcEdgesTest, Grid)
+{
+  /* Large enough to use multiple hash maps. */
+  const int size = 40;
+  Mesh *mesh = create_grid_mesh(size);
+  mesh_calc_edges(*mesh, false, false);
+  EXPECT_EQ(mesh->edges_num, grid_edges_num(size));
+
+  Set<OrderedEdge> unique_edges;
+  for (const int2 edge : mesh->edges()) {
+    EXPECT_TRUE(unique_edges.add(edge));
+  }
+  expect_valid_corner_edges(*mesh);
+
+  BKE_id_free(nullptr, mesh);
+}
+
+TEST_F(MeshCalcEdgesTest, KeepDuplicateExistingEdges)
+{
+  const int size = 40;
+  Mesh *mesh = create_grid_mesh(size);
+  mesh_calc_edges(*mesh, false, false);
+  const Array<int2> original_edges(mesh->edges());
+
+  /* Add every edge a second time with flipped vertices, only the first ones should be kept. */
+  Mesh *duplicate = create_grid_mesh(size, original_edges.size() * 2);
+  MutableSpan<int2> edges = duplicate->edges_for_write();
+  for (const int i : original_edges.index_range()) {
+    edges[i] = original_edges[i];
+    edges[original_edges.size() + i] = int2(original_edges[i].y, original_edges[i].x);
+  }
+
+  mesh_calc_edges(*duplicate, true, false);
+  EXPECT_EQ(duplicate->edges_num, original_edges.size());
+  EXPECT_EQ(duplicate->edges(), original_edges.as_span());
+  expect_valid_corner_edges(*duplicate);
+
+  BKE_id_free(nullptr, duplicate);
+  BKE_id_free(nullptr, mesh);
+}
+
+/* Measures the time it takes to calculate the edges of large meshes, like after importing or
+ * remeshing. Disabled by default because of its run-time. */
+TEST_F(MeshCalcEdgesTest, DISABLED_Benchmark)
+{
+  for (const int size : {100, 1000, 3163, 7071}) {
+    Mesh *mesh = create_grid_mesh(size);
+    std::cout << mesh->faces_num << " faces:\n";
+    {
+      SCOPED_TIMER("  Calculate edges");
+      mesh_calc_edges(*mesh, false, false);
+    }
+    {
+      SCOPED_TIMER("  Calculate edges, keep existing");
+      mesh_calc_edges(*mesh, true, false);
+    }
+    BKE_id_free(nullptr, mesh);
+  }
+}
+
+}  // namespace blender::bke::tests
@@ -325,8 +325,11 @@ static void mesh_calc_modifiers(Depsgraph &depsgraph,
   /* Modifier evaluation contexts for different types of modifiers. */
   ModifierApplyFlag apply_render = use_render ? MOD_APPLY_RENDER : ModifierApplyFlag(0);
   ModifierApplyFlag apply_cache = use_cache ? MOD_APPLY_USECACHE : ModifierApplyFlag(0);
-  const ModifierEvalContext mectx = {&depsgraph, &ob, apply_render | apply_cache};
-  const ModifierEvalContext mectx_orco = {&depsgraph, &ob, apply_render | MOD_APPLY_ORCO};
+  LinearAllocator<> scratch_allocator;
+  const ModifierEvalContext mectx = {
+      &depsgraph, &ob, apply_render | apply_cache, &scratch_allocator};
+  const ModifierEvalContext mectx_orco = {
+      &depsgraph, &ob, apply_render | MOD_APPLY_ORCO, &scratch_allocator};
 
   /* Get effective list of modifiers to execute. Some effects like shape keys
    * are added as virtual modifiers before the user created modifiers. */
@@ -779,8 +782,10 @@ static void editbmesh_calc_modifiers(Depsgraph &depsgraph,
   const bool use_render = (DEG_get_mode(&depsgraph) == DAG_EVAL_RENDER);
   /* Modifier evaluation contexts for different types of modifiers. */
   ModifierApplyFlag apply_render = use_render ? MOD_APPLY_RENDER : ModifierApplyFlag(0);
-  const ModifierEvalContext mectx = {&depsgraph, &ob, MOD_APPLY_USECACHE | apply_render};
-  const ModifierEvalContext mectx_orco = {&depsgraph, &ob, MOD_APPLY_ORCO};
+  LinearAllocator<> scratch_allocator;
+  const ModifierEvalContext mectx = {
+      &depsgraph, &ob, MOD_APPLY_USECACHE | apply_render, &scratch_allocator};
+  const ModifierEvalContext mectx_orco = {&depsgraph, &ob, MOD_APPLY_ORCO, &scratch_allocator};
 
   /* Get effective list of modifiers to execute. Some effects like shape keys
    * are added as virtual modifiers before the user created modifiers. */
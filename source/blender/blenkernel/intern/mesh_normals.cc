@@ -120,6 +120,15 @@ namespace bke::mesh {
  * face See Graphics Gems for
  * computing newell normal.
  */
+static float3 newell_normal_finalize(float3 normal)
+{
+  if (UNLIKELY(normalize_v3(normal) == 0.0f)) {
+    /* Other axis are already set to zero. */
+    normal[2] = 1.0f;
+  }
+  return normal;
+}
+
 static float3 normal_calc_ngon(const Span<float3> vert_positions, const Span<int> face_verts)
 {
   float3 normal(0);
@@ -132,12 +141,28 @@ static float3 normal_calc_ngon(const Span<float3> vert_positions, const Span<int
     v_prev = v_curr;
   }
 
-  if (UNLIKELY(normalize_v3(normal) == 0.0f)) {
-    /* Other axis are already set to zero. */
-    normal[2] = 1.0f;
+  return newell_normal_finalize(normal);
+}
+
+/**
+ * Same as #normal_calc_ngon but for a face size known at compile time, so that the compiler can
+ * unroll the loop and vectorize the accumulation. The operations are done in the same order, so
+ * the result is exactly the same.
+ */
+template<int FaceSize>
+static float3 normal_calc_ngon_fixed(const Span<float3> vert_positions, const Span<int> face_verts)
+{
+  BLI_assert(face_verts.size() == FaceSize);
+  float3 normal(0);
+
+  const float *v_prev = vert_positions[face_verts[FaceSize - 1]];
+  for (int i = 0; i < FaceSize; i++) {
+    const float *v_curr = vert_positions[face_verts[i]];
+    add_newell_cross_v3_v3v3(normal, v_prev, v_curr);
+    v_prev = v_curr;
   }
 
-  return normal;
+  return newell_normal_finalize(normal);
 }
 
 float3 face_normal_calc(const Span<float3> vert_positions, const Span<int> face_verts)
@@ -185,7 +210,18 @@ void normals_calc_faces(const Span<float3> positions,
   BLI_assert(faces.size() == face_normals.size());
   threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
     for (const int i : range) {
-      face_normals[i] = normal_calc_ngon(positions, corner_verts.slice(faces[i]));
+      const Span<int> face_verts = corner_verts.slice(faces[i]);
+      switch (face_verts.size()) {
+        case 3:
+          face_normals[i] = normal_calc_ngon_fixed<3>(positions, face_verts);
+          break;
+        case 4:
+          face_normals[i] = normal_calc_ngon_fixed<4>(positions, face_verts);
+          break;
+        default:
+          face_normals[i] = normal_calc_ngon(positions, face_verts);
+          break;
+      }
     }
   });
 }
@@ -24,6 +24,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_modifier_enums.h"
@@ -74,6 +75,39 @@ static bool mesh_remap_bvhtree_query_nearest(bke::BVHTreeFromMesh *treedata,
   return false;
 }
 
+/**
+ * Find the nearest source element of all destination positions at once, see
+ * #mesh_remap_bvhtree_query_nearest. The positions are converted to tree coordinates first.
+ * Elements further away than the maximum distance are not found, leaving the index at -1.
+ */
+static void mesh_remap_bvhtree_query_nearest_batch(const bke::BVHTreeFromMesh &treedata,
+                                                   const SpaceTransform *space_transform,
+                                                   const Span<float3> positions,
+                                                   const float max_dist_sq,
+                                                   MutableSpan<float3> r_tree_positions,
+                                                   MutableSpan<BVHTreeNearest> r_nearest)
+{
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      r_tree_positions[i] = positions[i];
+      /* Convert the vertex to tree coordinates, if needed. */
+      if (space_transform) {
+        BLI_space_transform_apply(space_transform, r_tree_positions[i]);
+      }
+      r_nearest[i].index = -1;
+      r_nearest[i].dist_sq = max_dist_sq;
+    }
+  });
+  if (treedata.tree == nullptr) {
+    return;
+  }
+  BLI_bvhtree_find_nearest_batch(*treedata.tree,
+                                 r_tree_positions,
+                                 r_nearest,
+                                 treedata.nearest_callback,
+                                 const_cast<bke::BVHTreeFromMesh *>(&treedata));
+}
+
 static bool mesh_remap_bvhtree_query_raycast(bke::BVHTreeFromMesh *treedata,
                                              BVHTreeRayHit *rayhit,
                                              const float co[3],
@@ -466,19 +500,16 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
 
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       treedata = me_src->bvh_verts();
-      nearest.index = -1;
-
-      for (i = 0; i < vert_positions_dst.size(); i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      Array<float3> tree_positions(vert_positions_dst.size());
+      Array<BVHTreeNearest> nearest_dst(vert_positions_dst.size());
+      mesh_remap_bvhtree_query_nearest_batch(
+          treedata, space_transform, vert_positions_dst, max_dist_sq, tree_positions, nearest_dst);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+      for (i = 0; i < vert_positions_dst.size(); i++) {
+        if (nearest_dst[i].index != -1) {
+          hit_dist = sqrtf(nearest_dst[i].dist_sq);
+          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest_dst[i].index, &full_weight);
         }
         else {
           /* No source for this dest vertex! */
@@ -491,19 +522,18 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const Span<float3> positions_src = me_src->vert_positions();
 
       treedata = me_src->bvh_edges();
-      nearest.index = -1;
 
-      for (i = 0; i < vert_positions_dst.size(); i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+      Array<float3> tree_positions(vert_positions_dst.size());
+      Array<BVHTreeNearest> nearest_dst(vert_positions_dst.size());
+      mesh_remap_bvhtree_query_nearest_batch(
+          treedata, space_transform, vert_positions_dst, max_dist_sq, tree_positions, nearest_dst);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      for (i = 0; i < vert_positions_dst.size(); i++) {
+        copy_v3_v3(tmp_co, tree_positions[i]);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const int2 &edge = edges_src[nearest.index];
+        if (nearest_dst[i].index != -1) {
+          hit_dist = sqrtf(nearest_dst[i].dist_sq);
+          const int2 &edge = edges_src[nearest_dst[i].index];
           const float *v1cos = positions_src[edge[0]];
           const float *v2cos = positions_src[edge[1]];
 
@@ -715,6 +715,7 @@ struct MovieClipImBufCacheKey {
 
 struct MovieClipCachePriorityData {
   int framenr;
+  int proxy;
 };
 
 static int user_frame_to_cache_frame(MovieClip *clip, int framenr)
@@ -777,6 +778,7 @@ static void *moviecache_getprioritydata(void *key_v)
 
   priority_data = MEM_new_zeroed<MovieClipCachePriorityData>("movie cache clip priority data");
   priority_data->framenr = key->framenr;
+  priority_data->proxy = key->proxy;
 
   return priority_data;
 }
@@ -787,7 +789,13 @@ static int moviecache_getitempriority(void *last_userkey_v, void *priority_data_
   MovieClipCachePriorityData *priority_data = static_cast<MovieClipCachePriorityData *>(
       priority_data_v);
 
-  return -abs(last_userkey->framenr - priority_data->framenr);
+  const int priority = -abs(last_userkey->framenr - priority_data->framenr);
+  /* Proxy frames are small and fast to read back, prefer freeing them over full resolution frames
+   * from the source movie which need to be decoded again. */
+  if (priority_data->proxy != IMB_PROXY_NONE) {
+    return priority * 2;
+  }
+  return priority;
 }
 
 static void moviecache_prioritydeleter(void *priority_data_v)
@@ -15,6 +15,7 @@
 #include "BKE_mesh.hh"
 #include "BKE_multires.hh"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "multires_reshape.hh"
 
@@ -29,29 +30,31 @@ static void multires_subdivide_create_object_space_linear_grids(Mesh *mesh)
 
   MDisps *mdisps = static_cast<MDisps *>(
       CustomData_get_layer_for_write(&mesh->corner_data, CD_MDISPS, mesh->corners_num));
-  for (const int p : faces.index_range()) {
-    const IndexRange face = faces[p];
-    const float3 face_center = mesh::face_center_calc(positions, corner_verts.slice(face));
-    for (int l = 0; l < face.size(); l++) {
-      const int loop_index = face[l];
-
-      float (*disps)[3] = mdisps[loop_index].disps;
-      mdisps[loop_index].totdisp = 4;
-      mdisps[loop_index].level = 1;
-
-      int prev_loop_index = l - 1 >= 0 ? loop_index - 1 : loop_index + face.size() - 1;
-      int next_loop_index = l + 1 < face.size() ? loop_index + 1 : face.start();
-
-      const int vert = corner_verts[loop_index];
-      const int vert_next = corner_verts[next_loop_index];
-      const int vert_prev = corner_verts[prev_loop_index];
-
-      copy_v3_v3(disps[0], face_center);
-      mid_v3_v3v3(disps[1], positions[vert], positions[vert_next]);
-      mid_v3_v3v3(disps[2], positions[vert], positions[vert_prev]);
-      copy_v3_v3(disps[3], positions[vert]);
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int p : range) {
+      const IndexRange face = faces[p];
+      const float3 face_center = mesh::face_center_calc(positions, corner_verts.slice(face));
+      for (int l = 0; l < face.size(); l++) {
+        const int loop_index = face[l];
+
+        float (*disps)[3] = mdisps[loop_index].disps;
+        mdisps[loop_index].totdisp = 4;
+        mdisps[loop_index].level = 1;
+
+        int prev_loop_index = l - 1 >= 0 ? loop_index - 1 : loop_index + face.size() - 1;
+        int next_loop_index = l + 1 < face.size() ? loop_index + 1 : face.start();
+
+        const int vert = corner_verts[loop_index];
+        const int vert_next = corner_verts[next_loop_index];
+        const int vert_prev = corner_verts[prev_loop_index];
+
+        copy_v3_v3(disps[0], face_center);
+        mid_v3_v3v3(disps[1], positions[vert], positions[vert_next]);
+        mid_v3_v3v3(disps[2], positions[vert], positions[vert_prev]);
+        copy_v3_v3(disps[3], positions[vert]);
+      }
     }
-  }
+  });
 }
 
 void multires_subdivide_create_tangent_displacement_linear_grids(Object *object,
@@ -19,6 +19,7 @@
 #include "BLI_array_utils.hh"
 #include "BLI_gsqueue.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_ccg.hh"
@@ -1177,23 +1178,23 @@ static void multires_create_grids_in_unsubdivided_base_mesh(MultiresUnsubdivideC
   BLI_assert(base_mesh->corners_num == context->num_grids);
 
   /* Allocate the MDISPS grids and copy the extracted data from context. */
-  for (int i = 0; i < totloop; i++) {
-    float (*disps)[3] = MEM_new_array_zeroed<float[3]>(totdisp, __func__);
+  threading::parallel_for(IndexRange(totloop), 256, [&](const IndexRange range) {
+    for (const int i : range) {
+      float (*disps)[3] = MEM_new_array_zeroed<float[3]>(totdisp, __func__);
 
-    if (mdisps[i].disps) {
-      MEM_delete(mdisps[i].disps);
-    }
+      if (mdisps[i].disps) {
+        MEM_delete(mdisps[i].disps);
+      }
 
-    for (int j = 0; j < totdisp; j++) {
       if (context->base_mesh_grids[i].grid_co) {
-        copy_v3_v3(disps[j], context->base_mesh_grids[i].grid_co[j]);
+        memcpy(disps, context->base_mesh_grids[i].grid_co, sizeof(float[3]) * totdisp);
       }
-    }
 
-    mdisps[i].disps = disps;
-    mdisps[i].totdisp = totdisp;
-    mdisps[i].level = context->num_total_levels;
-  }
+      mdisps[i].disps = disps;
+      mdisps[i].totdisp = totdisp;
+      mdisps[i].level = context->num_total_levels;
+    }
+  });
 }
 
 int multiresModifier_rebuild_subdiv(Depsgraph *depsgraph,
@@ -4544,6 +4544,7 @@ bool BKE_object_shapekey_remove(Main *bmain, Object *ob, KeyBlock *kb)
   if (kb->data) {
     MEM_delete_void(kb->data);
   }
+  MEM_delete(kb->runtime);
   MEM_delete(kb);
 
   /* Unset active when all are freed. */
@@ -44,6 +44,7 @@
 #include "BLI_rand.h"
 #include "BLI_string_utf8.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -2782,21 +2783,12 @@ static bool psys_thread_context_init_path(ParticleThreadContext *ctx,
   return true;
 }
 
-static void psys_task_init_path(ParticleTask *task, ParticleSimulationData *sim)
-{
-  /* init random number generator */
-  int seed = 31415926 + sim->psys->seed;
-
-  task->rng_path = BLI_rng_new(seed);
-}
-
 /* NOTE: this function must be thread safe, except for branching! */
-static void psys_thread_create_path(ParticleTask *task,
+static void psys_thread_create_path(ParticleThreadContext *ctx,
                                     ChildParticle *cpa,
                                     ParticleCacheKey *child_keys,
                                     int i)
 {
-  ParticleThreadContext *ctx = task->ctx;
   Object *ob = ctx->sim.ob;
   ParticleSystem *psys = ctx->sim.psys;
   ParticleSettings *part = psys->part;
@@ -3131,20 +3123,21 @@ static void psys_thread_create_path(ParticleTask *task,
   }
 }
 
-static void exec_child_path_cache(TaskPool *__restrict /*pool*/, void *taskdata)
+/**
+ * Create the paths of the given range of children in parallel. Consecutive children are stored
+ * next to each other in the path cache buffers, so a chunk of children per task keeps the writes
+ * local, while still being small enough to balance the uneven cost of skipped children.
+ */
+static void psys_cache_child_paths_range(ParticleThreadContext *ctx, const IndexRange range)
 {
-  ParticleTask *task = static_cast<ParticleTask *>(taskdata);
-  ParticleThreadContext *ctx = task->ctx;
   ParticleSystem *psys = ctx->sim.psys;
   ParticleCacheKey **cache = psys->childcache;
-  ChildParticle *cpa;
-  int i;
-
-  cpa = psys->child + task->begin;
-  for (i = task->begin; i < task->end; i++, cpa++) {
-    BLI_assert(i < psys->totchildcache);
-    psys_thread_create_path(task, cpa, cache[i], i);
-  }
+  threading::parallel_for(range, 256, [&](const IndexRange sub_range) {
+    for (const int i : sub_range) {
+      BLI_assert(i < psys->totchildcache);
+      psys_thread_create_path(ctx, &psys->child[i], cache[i], i);
+    }
+  });
 }
 
 void psys_cache_child_paths(ParticleSimulationData *sim,
@@ -3156,13 +3149,11 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     return;
   }
 
-  /* create a task pool for child path tasks */
   ParticleThreadContext ctx;
   if (!psys_thread_context_init_path(&ctx, sim, sim->scene, cfra, editupdate, use_render_params)) {
     return;
   }
 
-  TaskPool *task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_HIGH);
   const int totchild = ctx.totchild;
   const int totparent = ctx.totparent;
 
@@ -3178,28 +3169,13 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     sim->psys->totchildcache = totchild;
   }
 
-  /* cache parent paths */
+  /* Cache the paths of virtual parents first, the other children are attached to them. */
   ctx.parent_pass = 1;
-  Vector<ParticleTask> tasks_parent = psys_tasks_create(&ctx, 0, totparent);
-  for (ParticleTask &task : tasks_parent) {
-    psys_task_init_path(&task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, &task, false, nullptr);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
+  psys_cache_child_paths_range(&ctx, IndexRange(totparent));
 
   /* cache child paths */
   ctx.parent_pass = 0;
-  Vector<ParticleTask> tasks_child = psys_tasks_create(&ctx, totparent, totchild);
-  for (ParticleTask &task : tasks_child) {
-    psys_task_init_path(&task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, &task, false, nullptr);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
-
-  BLI_task_pool_free(task_pool);
-
-  psys_tasks_free(tasks_parent);
-  psys_tasks_free(tasks_child);
+  psys_cache_child_paths_range(&ctx, IndexRange::from_begin_end(totparent, totchild));
 
   psys_thread_context_free(&ctx);
 }
@@ -7,6 +7,7 @@
  */
 
 #include "BLI_bounds.hh"
+#include "BLI_function_ref.hh"
 #include "BLI_heap_simple.h"
 #include "BLI_map.hh"
 #include "BLI_math_geom.h"
@@ -14,6 +15,7 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -830,23 +832,51 @@ static void long_edge_queue_edge_add(const EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
-static void long_edge_queue_edge_add_recursive(const EdgeQueueContext *eq_ctx,
+/**
+ * An edge found while gathering the edges of a node to add to the queue. The actual insertion into
+ * the queue happens later, because it isn't thread-safe.
+ */
+struct EdgeQueueCandidate {
+  BMEdge *edge;
+  float priority;
+};
+
+/**
+ * Insert the gathered edges in order, skipping edges that are in the queue already. The result is
+ * the same as if the edges were inserted directly while gathering them.
+ */
+static void edge_queue_insert_candidates(const EdgeQueueContext *eq_ctx,
+                                         const Span<Vector<EdgeQueueCandidate>> candidates)
+{
+  for (const Span<EdgeQueueCandidate> node_candidates : candidates) {
+    for (const EdgeQueueCandidate &candidate : node_candidates) {
+      if (!EDGE_QUEUE_TEST(candidate.edge)) {
+        edge_queue_insert(eq_ctx, candidate.edge, candidate.priority);
+      }
+    }
+  }
+}
+
+/**
+ * Find the edges that should be added to the long edge queue. This doesn't modify the mesh or the
+ * queue, so it can run on multiple nodes in parallel.
+ */
+static void long_edge_queue_edge_add_recursive(const EdgeQueue &queue,
                                                const BMLoop *l_edge,
                                                const BMLoop *l_end,
                                                const float len_sq,
-                                               const float limit_len)
+                                               const float limit_len,
+                                               const FunctionRef<void(BMEdge *edge)> add_fn)
 {
   BLI_assert(len_sq > square_f(limit_len));
 
-  if (eq_ctx->queue->use_front_face) {
-    if (dot_v3v3(l_edge->f->no, *eq_ctx->queue->view_normal) < 0.0f) {
+  if (queue.use_front_face) {
+    if (dot_v3v3(l_edge->f->no, *queue.view_normal) < 0.0f) {
       return;
     }
   }
 
-  if (!EDGE_QUEUE_TEST(l_edge->e)) {
-    edge_queue_insert(eq_ctx, l_edge->e, long_edge_queue_priority(*l_edge->e));
-  }
+  add_fn(l_edge->e);
 
   /* temp support previous behavior! */
   if (UNLIKELY(G.debug_value == 1234)) {
@@ -873,63 +903,80 @@ static void long_edge_queue_edge_add_recursive(const EdgeQueueContext *eq_ctx,
         const float len_sq_other = BM_edge_calc_length_squared(l_adjacent[i]->e);
         if (len_sq_other > max_ff(len_sq_cmp, new_limit_len_sq)) {
           // edge_queue_insert(eq_ctx, l_adjacent[i]->e, -len_sq_other);
-          long_edge_queue_edge_add_recursive(
-              eq_ctx, l_adjacent[i]->radial_next, l_adjacent[i], len_sq_other, new_limit_len);
+          long_edge_queue_edge_add_recursive(queue,
+                                             l_adjacent[i]->radial_next,
+                                             l_adjacent[i],
+                                             len_sq_other,
+                                             new_limit_len,
+                                             add_fn);
         }
       }
     } while ((l_iter = l_iter->radial_next) != l_end);
   }
 }
 
-static void short_edge_queue_edge_add(const EdgeQueueContext *eq_ctx, BMEdge *e)
+static void long_edge_queue_face_gather(const EdgeQueue &queue,
+                                        BMFace *f,
+                                        const FunctionRef<void(BMEdge *edge)> add_fn)
 {
-  if (!EDGE_QUEUE_TEST(e)) {
-    if (BM_edge_calc_length_squared(e) < eq_ctx->queue->limit_len_squared) {
-      edge_queue_insert(eq_ctx, e, short_edge_queue_priority(*e));
-    }
-  }
-}
-
-static void long_edge_queue_face_add(const EdgeQueueContext *eq_ctx, BMFace *f)
-{
-  if (eq_ctx->queue->use_front_face) {
-    if (dot_v3v3(f->no, *eq_ctx->queue->view_normal) < 0.0f) {
+  if (queue.use_front_face) {
+    if (dot_v3v3(f->no, *queue.view_normal) < 0.0f) {
       return;
     }
   }
 
-  if (eq_ctx->queue->edge_queue_tri_in_range(eq_ctx->queue, f)) {
+  if (queue.edge_queue_tri_in_range(&queue, f)) {
     /* Check each edge of the face. */
     const BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
     const BMLoop *l_iter = l_first;
     do {
       const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->queue->limit_len_squared) {
+      if (len_sq > queue.limit_len_squared) {
         long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->queue->limit_len);
+            queue, l_iter->radial_next, l_iter, len_sq, queue.limit_len, add_fn);
       }
     } while ((l_iter = l_iter->next) != l_first);
   }
 }
 
-static void short_edge_queue_face_add(const EdgeQueueContext *eq_ctx, BMFace *f)
+static void long_edge_queue_face_add(const EdgeQueueContext *eq_ctx, BMFace *f)
 {
-  if (eq_ctx->queue->use_front_face) {
-    if (dot_v3v3(f->no, *eq_ctx->queue->view_normal) < 0.0f) {
+  long_edge_queue_face_gather(*eq_ctx->queue, f, [&](BMEdge *e) {
+    if (!EDGE_QUEUE_TEST(e)) {
+      edge_queue_insert(eq_ctx, e, long_edge_queue_priority(*e));
+    }
+  });
+}
+
+static void short_edge_queue_face_gather(const EdgeQueue &queue,
+                                         BMFace *f,
+                                         Vector<EdgeQueueCandidate> &r_candidates)
+{
+  if (queue.use_front_face) {
+    if (dot_v3v3(f->no, *queue.view_normal) < 0.0f) {
       return;
     }
   }
 
-  if (eq_ctx->queue->edge_queue_tri_in_range(eq_ctx->queue, f)) {
+  if (queue.edge_queue_tri_in_range(&queue, f)) {
     /* Check each edge of the face. */
     const BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
     const BMLoop *l_iter = l_first;
     do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
+      BMEdge *e = l_iter->e;
+      if (BM_edge_calc_length_squared(e) < queue.limit_len_squared) {
+        r_candidates.append({e, short_edge_queue_priority(*e)});
+      }
     } while ((l_iter = l_iter->next) != l_first);
   }
 }
 
+static bool node_needs_topology_update(const BMeshNode &node)
+{
+  return (node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
+         !(node.flag_ & Node::FullyHidden);
+}
+
 /**
  * Create a priority queue containing vertex pairs connected by a long
  * edge as defined by Tree.bm_max_edge_len.
@@ -971,16 +1018,24 @@ static void long_edge_queue_create(const EdgeQueueContext *eq_ctx,
     eq_ctx->queue->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update. */
-    if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
-        !(node.flag_ & Node::FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        long_edge_queue_face_add(eq_ctx, f);
+  /* Check leaf nodes marked for topology update. Finding the edges is done in parallel, only
+   * inserting them into the queue is single threaded. */
+  const EdgeQueue &queue = *eq_ctx->queue;
+  Array<Vector<EdgeQueueCandidate>> candidates(nodes.size());
+  threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (!node_needs_topology_update(nodes[i])) {
+        continue;
+      }
+      Vector<EdgeQueueCandidate> &node_candidates = candidates[i];
+      for (BMFace *f : nodes[i].bm_faces_) {
+        long_edge_queue_face_gather(queue, f, [&](BMEdge *e) {
+          node_candidates.append({e, long_edge_queue_priority(*e)});
+        });
       }
     }
-  }
+  });
+  edge_queue_insert_candidates(eq_ctx, candidates);
 }
 
 /**
@@ -1024,16 +1079,21 @@ static void short_edge_queue_create(const EdgeQueueContext *eq_ctx,
     eq_ctx->queue->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update */
-    if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
-        !(node.flag_ & Node::FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        short_edge_queue_face_add(eq_ctx, f);
+  /* Check leaf nodes marked for topology update. Finding the edges is done in parallel, only
+   * inserting them into the queue is single threaded. */
+  const EdgeQueue &queue = *eq_ctx->queue;
+  Array<Vector<EdgeQueueCandidate>> candidates(nodes.size());
+  threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (!node_needs_topology_update(nodes[i])) {
+        continue;
+      }
+      for (BMFace *f : nodes[i].bm_faces_) {
+        short_edge_queue_face_gather(queue, f, candidates[i]);
       }
     }
-  }
+  });
+  edge_queue_insert_candidates(eq_ctx, candidates);
 }
 
 /*************************** Topology update **************************/
@@ -42,6 +42,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
+#include "BLI_mmap.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
 #include "BLI_time.h"
@@ -127,6 +128,7 @@ static void ptcache_file_compressed_write(PTCacheFile *pf,
                                           uint item_size);
 static int ptcache_file_write(PTCacheFile *pf, const void *data, uint items_num, uint item_size);
 static bool ptcache_file_read(PTCacheFile *pf, void *f, uint items_num, uint item_size);
+static const uchar *ptcache_file_mapped_data(PTCacheFile *pf, size_t size);
 
 /* Common functions */
 static int ptcache_basic_header_read(PTCacheFile *pf)
@@ -134,11 +136,11 @@ static int ptcache_basic_header_read(PTCacheFile *pf)
   int error = 0;
 
   /* Custom functions should read these basic elements too! */
-  if (!error && !fread(&pf->totpoint, sizeof(uint), 1, pf->fp)) {
+  if (!error && !ptcache_file_read(pf, &pf->totpoint, 1, sizeof(uint))) {
     error = 1;
   }
 
-  if (!error && !fread(&pf->data_types, sizeof(uint), 1, pf->fp)) {
+  if (!error && !ptcache_file_read(pf, &pf->data_types, 1, sizeof(uint))) {
     error = 1;
   }
 
@@ -1486,14 +1488,27 @@ static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
 
   pf = MEM_new<PTCacheFile>("PTCacheFile");
   pf->fp = fp;
+  pf->mmap_file = nullptr;
+  pf->mmap_offset = 0;
   pf->old_format = 0;
   pf->frame = cfra;
 
+  if (mode == PTCACHE_FILE_READ) {
+    /* Mapping the file avoids copying the compressed data into temporary buffers, and only reads
+     * the parts of the file that are accessed. Opening the mapping seeks to the end of the file,
+     * reading falls back to the file stream when mapping isn't possible. */
+    pf->mmap_file = BLI_mmap_open(fileno(fp));
+    BLI_fseek(fp, 0, SEEK_SET);
+  }
+
   return pf;
 }
 static void ptcache_file_close(PTCacheFile *pf)
 {
   if (pf) {
+    if (pf->mmap_file) {
+      BLI_mmap_free(pf->mmap_file);
+    }
     fclose(pf->fp);
     MEM_delete(pf);
   }
@@ -1518,8 +1533,17 @@ static int ptcache_file_compressed_read(PTCacheFile *pf,
       /* do nothing */
     }
     else {
-      uchar *in = MEM_new_array_zeroed<uchar>(in_len, "pointcache_compressed_buffer");
-      ptcache_file_read(pf, in, in_len, sizeof(uchar));
+      /* Decompress straight from the memory mapped file when possible. */
+      const uchar *in = ptcache_file_mapped_data(pf, in_len);
+      uchar *in_buffer = nullptr;
+      if (in) {
+        pf->mmap_offset += in_len;
+      }
+      else {
+        in_buffer = MEM_new_array_zeroed<uchar>(in_len, "pointcache_compressed_buffer");
+        ptcache_file_read(pf, in_buffer, in_len, sizeof(uchar));
+        in = in_buffer;
+      }
 
       uchar *decomp_result = result;
       if (compressed == PTCACHE_COMPRESS_ZSTD_FILTERED) {
@@ -1533,12 +1557,15 @@ static int ptcache_file_compressed_read(PTCacheFile *pf,
       {
         const size_t err = ZSTD_decompress(decomp_result, items_num * item_size, in, in_len);
         r = ZSTD_isError(err);
+        if (!in_buffer && BLI_mmap_any_io_error(pf->mmap_file)) {
+          r = 1;
+        }
       }
       else {
         /* We are trying to read an unsupported compression format. */
         r = 1;
       }
-      MEM_delete(in);
+      MEM_SAFE_DELETE(in_buffer);
 
       /* Un-filter the decompressed data, if needed. */
       if (compressed == PTCACHE_COMPRESS_ZSTD_FILTERED) {
@@ -1583,8 +1610,31 @@ static void ptcache_file_compressed_write(PTCacheFile *pf,
   ptcache_file_write(pf, out.data(), out_len, sizeof(uchar));
 }
 
+/**
+ * Return a pointer to the next `size` bytes of a memory mapped file without advancing the read
+ * position, or null if the file isn't mapped or is too short.
+ */
+static const uchar *ptcache_file_mapped_data(PTCacheFile *pf, const size_t size)
+{
+  if (pf->mmap_file == nullptr) {
+    return nullptr;
+  }
+  if (pf->mmap_offset + size > BLI_mmap_get_length(pf->mmap_file)) {
+    return nullptr;
+  }
+  return static_cast<const uchar *>(BLI_mmap_get_pointer(pf->mmap_file)) + pf->mmap_offset;
+}
+
 static bool ptcache_file_read(PTCacheFile *pf, void *f, uint items_num, uint item_size)
 {
+  if (pf->mmap_file) {
+    const size_t size = size_t(items_num) * item_size;
+    if (!BLI_mmap_read(pf->mmap_file, f, pf->mmap_offset, size)) {
+      return false;
+    }
+    pf->mmap_offset += size;
+    return true;
+  }
   return (fread(f, item_size, items_num, pf->fp) == items_num);
 }
 static int ptcache_file_write(PTCacheFile *pf, const void *data, uint items_num, uint item_size)
@@ -1612,7 +1662,7 @@ static int ptcache_file_header_begin_read(PTCacheFile *pf)
 
   pf->data_types = 0;
 
-  if (fread(bphysics, sizeof(char), 8, pf->fp) != 8) {
+  if (!ptcache_file_read(pf, bphysics, 8, sizeof(char))) {
     error = 1;
   }
 
@@ -1620,7 +1670,7 @@ static int ptcache_file_header_begin_read(PTCacheFile *pf)
     error = 1;
   }
 
-  if (!error && !fread(&typeflag, sizeof(uint), 1, pf->fp)) {
+  if (!error && !ptcache_file_read(pf, &typeflag, 1, sizeof(uint))) {
     error = 1;
   }
 
@@ -1630,6 +1680,7 @@ static int ptcache_file_header_begin_read(PTCacheFile *pf)
   /* if there was an error set file as it was */
   if (error) {
     BLI_fseek(pf->fp, 0, SEEK_SET);
+    pf->mmap_offset = 0;
   }
 
   return !error;
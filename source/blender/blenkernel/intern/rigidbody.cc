@@ -1952,6 +1952,13 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
                                              Scene *scene,
                                              RigidBodyWorld *rbw)
 {
+  EffectorWeights *effector_weights = rbw->effector_weights;
+  /* Get effectors present in the group specified by effector_weights. Only bodies without a force
+   * field of their own are affected, so excluding the affected object from the effectors (as
+   * #BKE_effectors_create does) makes no difference and the effectors can be shared. */
+  ListBaseT<EffectorCache> *effectors = BKE_effectors_create(
+      depsgraph, nullptr, nullptr, effector_weights, false);
+
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     /* only update if rigid body exists */
     RigidBodyOb *rbo = ob->rigidbody_object;
@@ -1964,12 +1971,8 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
     if (rbo->type == RBO_TYPE_ACTIVE &&
         ((ob->pd == nullptr) || (ob->pd->forcefield == PFIELD_NULL)))
     {
-      EffectorWeights *effector_weights = rbw->effector_weights;
       EffectedPoint epoint;
-      ListBaseT<EffectorCache> *effectors;
 
-      /* get effectors present in the group specified by effector_weights */
-      effectors = BKE_effectors_create(depsgraph, ob, nullptr, effector_weights, false);
       if (effectors) {
         float eff_force[3] = {0.0f, 0.0f, 0.0f};
         float eff_loc[3], eff_vel[3];
@@ -1986,7 +1989,9 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
 
         /* Calculate net force of effectors, and apply to sim object:
          * - we use 'central force' since apply force requires a "relative position"
-         *   which we don't have... */
+         *   which we don't have...
+         * - random effects like wind noise should be the same as with separate effectors. */
+        BKE_effectors_reset_random(effectors);
         BKE_effectors_apply(
             effectors, nullptr, effector_weights, &epoint, eff_force, nullptr, nullptr);
         if (G.f & G_DEBUG) {
@@ -2008,13 +2013,12 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
       else if (G.f & G_DEBUG) {
         printf("\tno forces to apply to '%s'\n", ob->id.name + 2);
       }
-
-      /* cleanup */
-      BKE_effectors_free(effectors);
     }
     /* NOTE: passive objects don't need to be updated since they don't move */
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+
+  BKE_effectors_free(effectors);
 }
 
 static void rigidbody_free_substep_data(ListBaseT<LinkData> *substep_targets)
@@ -49,6 +49,7 @@
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
 #include "BLI_threads.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BLO_readfile.hh"
@@ -2672,6 +2673,7 @@ static void scene_graph_update_tagged(Depsgraph *depsgraph, Main *bmain, bool on
   if (only_if_tagged && DEG_is_fully_evaluated(depsgraph)) {
     return;
   }
+  TRACE_ZONE("Scene Graph Update");
 
   Scene *scene = DEG_get_input_scene(depsgraph);
   ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
@@ -2750,6 +2752,7 @@ void BKE_scene_graph_evaluated_ensure(Depsgraph *depsgraph, Main *bmain)
 
 void BKE_scene_graph_update_for_newframe_ex(Depsgraph *depsgraph, const bool clear_recalc)
 {
+  TRACE_ZONE("Scene Frame Change Update");
   Scene *scene = DEG_get_input_scene(depsgraph);
   Main *bmain = DEG_get_bmain(depsgraph);
   bool used_multiple_passes = false;
@@ -72,6 +72,8 @@ struct ShrinkwrapCalcData {
   Mesh *target;                /* mesh we are shrinking to */
   SpaceTransform local2target; /* transform to move between local and target space */
   ShrinkwrapTreeData *tree;    /* mesh BVH tree data */
+  /* Nearest target element of every vertex from the previous evaluation, optional. */
+  MutableSpan<int> nearest_index;
 
   Object *aux_target;
 
@@ -300,6 +302,49 @@ const ShrinkwrapBoundaryData &boundary_cache_ensure(const Mesh &mesh)
 
 }  // namespace bke::shrinkwrap
 
+/**
+ * Use the target element found for the vertex in the previous evaluation as the first candidate
+ * of the nearest search, and remember the new result after the search with
+ * #shrinkwrap_nearest_index_store.
+ */
+static void shrinkwrap_nearest_index_seed(const ShrinkwrapCalcData *calc,
+                                          bke::BVHTreeFromMesh *treeData,
+                                          const int i,
+                                          const float co[3],
+                                          BVHTreeNearest *nearest)
+{
+  if (calc->nearest_index.is_empty()) {
+    return;
+  }
+  const int index = calc->nearest_index[i];
+  if (index == -1) {
+    return;
+  }
+  if (treeData->nearest_callback) {
+    /* The target mesh may have changed since the previous evaluation. */
+    if (index < treeData->corner_tris.size()) {
+      treeData->nearest_callback(treeData, index, co, nearest);
+    }
+  }
+  else if (index < treeData->vert_positions.size()) {
+    const float dist_sq = len_squared_v3v3(co, treeData->vert_positions[index]);
+    if (dist_sq < nearest->dist_sq) {
+      nearest->index = index;
+      nearest->dist_sq = dist_sq;
+      copy_v3_v3(nearest->co, treeData->vert_positions[index]);
+    }
+  }
+}
+
+static void shrinkwrap_nearest_index_store(const ShrinkwrapCalcData *calc,
+                                           const int i,
+                                           const BVHTreeNearest *nearest)
+{
+  if (!calc->nearest_index.is_empty()) {
+    calc->nearest_index[i] = nearest->index;
+  }
+}
+
 /**
  * Shrink-wrap to the nearest vertex
  *
@@ -345,8 +390,10 @@ static void shrinkwrap_calc_nearest_vertex_cb_ex(void *__restrict userdata,
   else {
     nearest->dist_sq = FLT_MAX;
   }
+  shrinkwrap_nearest_index_seed(calc, treeData, i, tmp_co, nearest);
 
   BLI_bvhtree_find_nearest(treeData->tree, tmp_co, nearest, treeData->nearest_callback, treeData);
+  shrinkwrap_nearest_index_store(calc, i, nearest);
 
   /* Found the nearest vertex */
   if (nearest->index != -1) {
@@ -1121,8 +1168,12 @@ static void shrinkwrap_calc_nearest_surface_point_cb_ex(void *__restrict userdat
   else {
     nearest->dist_sq = FLT_MAX;
   }
+  if (calc->smd->shrinkType == MOD_SHRINKWRAP_NEAREST_SURFACE) {
+    shrinkwrap_nearest_index_seed(calc, &data->tree->treeData, i, tmp_co, nearest);
+  }
 
   BKE_shrinkwrap_find_nearest_surface(data->tree, nearest, tmp_co, calc->smd->shrinkType);
+  shrinkwrap_nearest_index_store(calc, i, nearest);
 
   /* Found the nearest vertex */
   if (nearest->index != -1) {
@@ -1377,7 +1428,8 @@ void shrinkwrapModifier_deform(ShrinkwrapModifierData *smd,
                                const MDeformVert *dvert,
                                const int defgrp_index,
                                float (*vertexCos)[3],
-                               int numVerts)
+                               int numVerts,
+                               ShrinkwrapRuntime *runtime)
 {
   ShrinkwrapCalcData calc = NULL_ShrinkwrapCalcData;
   Array<float3> subdivided_positions;
@@ -1425,6 +1477,17 @@ void shrinkwrapModifier_deform(ShrinkwrapModifierData *smd,
     }
   }
 
+  if (runtime &&
+      ELEM(smd->shrinkType, MOD_SHRINKWRAP_NEAREST_SURFACE, MOD_SHRINKWRAP_NEAREST_VERTEX))
+  {
+    if (runtime->shrink_type != smd->shrinkType || runtime->nearest_index.size() != numVerts) {
+      runtime->shrink_type = smd->shrinkType;
+      runtime->nearest_index.reinitialize(numVerts);
+      runtime->nearest_index.fill(-1);
+    }
+    calc.nearest_index = runtime->nearest_index;
+  }
+
   /* Projecting target defined - lets work! */
   ShrinkwrapTreeData tree;
 
@@ -1524,7 +1587,8 @@ void BKE_shrinkwrap_mesh_nearest_surface_deform(Depsgraph *depsgraph,
       nullptr,
       -1,
       reinterpret_cast<float (*)[3]>(src_me->vert_positions_for_write().data()),
-      src_me->verts_num);
+      src_me->verts_num,
+      nullptr);
   src_me->tag_positions_changed();
 }
 
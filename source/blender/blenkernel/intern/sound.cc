@@ -7,6 +7,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstdlib>
@@ -1246,46 +1247,58 @@ static int sound_read(
   std::shared_ptr<IReader> reader = ChannelMapper(sound, specs).createReader();
 
   specs.specs = reader->getSpecs();
-  int len;
   float samplejump = specs.rate / samples_per_second;
   float min, max, power, overallmax;
-  bool eos;
+  bool eos = false;
 
   overallmax = 0;
 
-  for (int i = 0; i < length; i++) {
-    len = floor(samplejump * (i + 1)) - floor(samplejump * i);
+  /* Decode about a second of audio per read, many small reads are much slower because every
+   * read has a fixed overhead in the decoder and the channel mapper. */
+  const int block_size = std::max(samples_per_second, 1);
 
-    if (*interrupt)
+  for (int block_start = 0; block_start < length && !eos; block_start += block_size) {
+    if (*interrupt) {
       return 0;
+    }
+
+    const int block_end = std::min(block_start + block_size, length);
+    const int first_sample = floor(samplejump * block_start);
+    int len = floor(samplejump * block_end) - first_sample;
 
     aBuffer.assureSize(len * AUD_SAMPLE_SIZE(specs));
     buf = aBuffer.getBuffer();
 
     reader->read(len, eos, buf);
 
-    max = min = *buf;
-    power = *buf * *buf;
-    for (int j = 1; j < len; j++) {
-      if (buf[j] < min)
-        min = buf[j];
-      if (buf[j] > max)
-        max = buf[j];
-      power += buf[j] * buf[j];
-    }
+    for (int i = block_start; i < block_end; i++) {
+      const int start = int(floor(samplejump * i)) - first_sample;
+      const int end = int(floor(samplejump * (i + 1))) - first_sample;
 
-    buffer[i * 3] = min;
-    buffer[i * 3 + 1] = max;
-    buffer[i * 3 + 2] = std::sqrt(power / len);
+      if (eos && end > len) {
+        /* The stream ended before all samples of this part were read. */
+        length = i;
+        break;
+      }
 
-    if (overallmax < max)
-      overallmax = max;
-    if (overallmax < -min)
-      overallmax = -min;
+      max = min = buf[start];
+      power = buf[start] * buf[start];
+      for (int j = start + 1; j < end; j++) {
+        if (buf[j] < min)
+          min = buf[j];
+        if (buf[j] > max)
+          max = buf[j];
+        power += buf[j] * buf[j];
+      }
 
-    if (eos) {
-      length = i;
-      break;
+      buffer[i * 3] = min;
+      buffer[i * 3 + 1] = max;
+      buffer[i * 3 + 2] = std::sqrt(power / (end - start));
+
+      if (overallmax < max)
+        overallmax = max;
+      if (overallmax < -min)
+        overallmax = -min;
     }
   }
 
@@ -11,6 +11,9 @@
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BKE_attribute.hh"
+#include "BKE_mesh.hh"
+#include "BKE_mesh_topology_state.hh"
 #include "BKE_subdiv_modifier.hh"
 
 #include "MEM_guardedalloc.h"
@@ -142,6 +145,93 @@ Subdiv *new_from_mesh(const Settings *settings, const Mesh *mesh)
 
 /* Creation with cached-aware semantic. */
 
+template<typename T> static ArrayState<T> array_state_from_reader(const AttributeReader<T> &attr)
+{
+  if (!attr) {
+    return {};
+  }
+  return {attr.varray, attr.sharing_info};
+}
+
+template<typename T>
+static bool array_state_matches_reader(const ArrayState<T> &state, const AttributeReader<T> &attr)
+{
+  if (!attr) {
+    return state.is_empty();
+  }
+  return state.same_as(attr.varray, attr.sharing_info);
+}
+
+/**
+ * All mesh data that is used to build the topology refiner (see #converter_init_for_mesh).
+ *
+ * Building a converter and comparing it with an existing topology refiner is linear in the size of
+ * the mesh, and happens on every evaluation of the subdivision surface modifier, even when only
+ * positions changed. When the data is still implicitly shared with the mesh the refiner was built
+ * for, the comparison is done in constant time instead.
+ */
+struct SourceMeshState {
+  int verts_num;
+  MeshTopologyState topology;
+  bool use_creases;
+  ArrayState<float> vert_creases;
+  ArrayState<float> edge_creases;
+  Vector<std::string> uv_map_names;
+  Vector<ArrayState<float2>> uv_maps;
+
+  SourceMeshState(const Settings &settings, const Mesh &mesh)
+      : verts_num(mesh.verts_num), topology(mesh), use_creases(settings.use_creases)
+  {
+    const AttributeAccessor attributes = mesh.attributes();
+    if (use_creases) {
+      vert_creases = array_state_from_reader(
+          attributes.lookup<float>("crease_vert", AttrDomain::Point));
+      edge_creases = array_state_from_reader(
+          attributes.lookup<float>("crease_edge", AttrDomain::Edge));
+    }
+    for (const StringRef name : mesh.uv_map_names()) {
+      uv_map_names.append(name);
+      uv_maps.append(
+          array_state_from_reader(attributes.lookup<float2>(name, AttrDomain::Corner)));
+    }
+  }
+
+  bool same_as(const Settings &settings, const Mesh &mesh) const
+  {
+    if (mesh.verts_num != verts_num || settings.use_creases != use_creases) {
+      return false;
+    }
+    if (!topology.same_topology_as(mesh)) {
+      return false;
+    }
+    const AttributeAccessor attributes = mesh.attributes();
+    if (use_creases) {
+      if (!array_state_matches_reader(
+              vert_creases, attributes.lookup<float>("crease_vert", AttrDomain::Point)) ||
+          !array_state_matches_reader(
+              edge_creases, attributes.lookup<float>("crease_edge", AttrDomain::Edge)))
+      {
+        return false;
+      }
+    }
+    const VectorSet<StringRefNull> mesh_uv_map_names = mesh.uv_map_names();
+    if (mesh_uv_map_names.size() != uv_map_names.size()) {
+      return false;
+    }
+    for (const int i : uv_maps.index_range()) {
+      if (mesh_uv_map_names[i] != uv_map_names[i]) {
+        return false;
+      }
+      if (!array_state_matches_reader(
+              uv_maps[i], attributes.lookup<float2>(uv_map_names[i], AttrDomain::Corner)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
 Subdiv *update_from_converter(Subdiv *subdiv,
                               const Settings *settings,
                               OpenSubdiv_Converter *converter)
@@ -178,10 +268,20 @@ Subdiv *update_from_converter(Subdiv *subdiv,
 
 Subdiv *update_from_mesh(Subdiv *subdiv, const Settings *settings, const Mesh *mesh)
 {
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr &&
+      subdiv->source_mesh_state != nullptr && settings_equal(&subdiv->settings, settings) &&
+      subdiv->source_mesh_state->same_as(*settings, *mesh))
+  {
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   converter_init_for_mesh(&converter, settings, mesh);
   subdiv = update_from_converter(subdiv, settings, &converter);
   converter_free(&converter);
+  if (subdiv != nullptr) {
+    MEM_delete(subdiv->source_mesh_state);
+    subdiv->source_mesh_state = MEM_new<SourceMeshState>(__func__, *settings, *mesh);
+  }
   return subdiv;
 }
 
@@ -200,6 +300,7 @@ void free(Subdiv *subdiv)
     delete subdiv->evaluator;
   }
   delete subdiv->topology_refiner;
+  MEM_delete(subdiv->source_mesh_state);
   displacement_detach(subdiv);
   MEM_delete(subdiv);
 #else
@@ -7,6 +7,7 @@
 #include "FN_multi_function_builder.hh"
 
 #include "BLI_color.hh"
+#include "BLI_generic_array.hh"
 #include "BLI_math_euler.hh"
 #include "BLI_math_quaternion.hh"
 #include "BLI_math_vector.hh"
@@ -704,6 +705,32 @@ static void call_convert_to_uninitialized_fn(const GVArray &from,
   call_convert_to_uninitialized_fn(from, fn, IndexMask(from.size()), to);
 }
 
+/**
+ * Convert the values selected by the mask into a compressed array. The source values are gathered
+ * into a contiguous buffer first, so that the conversion function can process them as a span
+ * instead of retrieving every element from the virtual array separately.
+ */
+static void convert_compressed_to_uninitialized(const GVArray &from,
+                                                const mf::MultiFunction &fn,
+                                                const IndexMask &mask,
+                                                GMutableSpan to)
+{
+  BLI_assert(mask.size() == to.size());
+  if (const std::optional<IndexRange> range = mask.to_range()) {
+    call_convert_to_uninitialized_fn(from.slice(*range), fn, to);
+    return;
+  }
+  const CommonVArrayInfo info = from.common_info();
+  if (info.type == CommonVArrayInfo::Type::Single) {
+    call_convert_to_uninitialized_fn(
+        GVArray::from_single_ref(from.type(), mask.size(), info.data), fn, to);
+    return;
+  }
+  GArray<> from_values(from.type(), mask.size(), NoInitialization());
+  from.materialize_compressed_to_uninitialized(mask, from_values.data());
+  call_convert_to_uninitialized_fn(GVArray::from_span(from_values), fn, to);
+}
+
 void DataTypeConversions::convert_to_initialized_n(GSpan from_span, GMutableSpan to_span) const
 {
   const CPPType &from_type = from_span.type();
@@ -763,6 +790,17 @@ class GVArray_For_ConvertedGVArray : public GVArrayImpl {
                                      mask,
                                      {this->type(), dst, mask.min_array_size()});
   }
+
+  void materialize_compressed(const IndexMask &mask,
+                              void *dst,
+                              const bool dst_is_uninitialized) const override
+  {
+    if (!dst_is_uninitialized) {
+      type_->destruct_n(dst, mask.size());
+    }
+    convert_compressed_to_uninitialized(
+        varray_, *old_to_new_conversions_.multi_function, mask, {this->type(), dst, mask.size()});
+  }
 };
 
 class GVMutableArray_For_ConvertedGVMutableArray : public GVMutableArrayImpl {
@@ -820,6 +858,17 @@ class GVMutableArray_For_ConvertedGVMutableArray : public GVMutableArrayImpl {
                                      mask,
                                      {this->type(), dst, mask.min_array_size()});
   }
+
+  void materialize_compressed(const IndexMask &mask,
+                              void *dst,
+                              const bool dst_is_uninitialized) const override
+  {
+    if (!dst_is_uninitialized) {
+      type_->destruct_n(dst, mask.size());
+    }
+    convert_compressed_to_uninitialized(
+        varray_, *old_to_new_conversions_.multi_function, mask, {this->type(), dst, mask.size()});
+  }
 };
 
 GVArray DataTypeConversions::try_convert(GVArray varray, const CPPType &to_type) const
@@ -831,6 +880,17 @@ GVArray DataTypeConversions::try_convert(GVArray varray, const CPPType &to_type)
   if (!this->is_convertible(from_type, to_type)) {
     return {};
   }
+  if (varray.is_single()) {
+    /* Convert the value only once, which also keeps the result a single value for the caller. */
+    BUFFER_FOR_CPP_TYPE_VALUE(from_type, from_value);
+    BUFFER_FOR_CPP_TYPE_VALUE(to_type, to_value);
+    varray.get_internal_single_to_uninitialized(from_value);
+    this->convert_to_uninitialized(from_type, to_type, from_value, to_value);
+    GVArray result = GVArray::from_single(to_type, varray.size(), to_value);
+    from_type.destruct(from_value);
+    to_type.destruct(to_value);
+    return result;
+  }
   return GVArray::from<GVArray_For_ConvertedGVArray>(std::move(varray), to_type, *this);
 }
 
@@ -0,0 +1,83 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_timeit.hh"
+
+#include "BKE_type_conversions.hh"
+
+namespace blender::bke::tests {
+
+TEST(type_conversions, ConvertedSingle)
+{
+  const DataTypeConversions &conversions = get_implicit_type_conversions();
+  const GVArray varray = conversions.try_convert(VArray<bool>::from_single(true, 10),
+                                                 CPPType::get<float>());
+  const VArray<float> converted = varray.typed<float>();
+  ASSERT_TRUE(converted.is_single());
+  EXPECT_EQ(converted.size(), 10);
+  EXPECT_EQ(converted.get_internal_single(), 1.0f);
+}
+
+TEST(type_conversions, MaterializeCompressed)
+{
+  const DataTypeConversions &conversions = get_implicit_type_conversions();
+  Array<int> values(100);
+  for (const int i : values.index_range()) {
+    values[i] = i;
+  }
+  const VArray<int> src = VArray<int>::from_func(values.size(),
+                                                 [&](const int64_t i) { return values[i]; });
+  const VArray<float> converted =
+      conversions.try_convert(GVArray(src), CPPType::get<float>()).typed<float>();
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      values.index_range(), memory, [](const int64_t i) { return i % 3 == 0; });
+  Array<float> compressed(mask.size());
+  converted.materialize_compressed(mask, compressed);
+  mask.foreach_index([&](const int64_t i, const int64_t pos) {
+    EXPECT_EQ(compressed[pos], float(values[i]));
+  });
+
+  const IndexMask range_mask(IndexRange(20, 30));
+  Array<float> range_compressed(range_mask.size());
+  converted.materialize_compressed(range_mask, range_compressed);
+  for (const int i : range_compressed.index_range()) {
+    EXPECT_EQ(range_compressed[i], float(values[20 + i]));
+  }
+}
+
+/* Measures reading converted attributes, which happens when e.g. a boolean selection is used as a
+ * float. Disabled by default because of its run-time. */
+TEST(type_conversions, DISABLED_Benchmark)
+{
+  const DataTypeConversions &conversions = get_implicit_type_conversions();
+  const int64_t size = 10'000'000;
+  Array<bool> values(size);
+  for (const int64_t i : values.index_range()) {
+    values[i] = i % 7 < 3;
+  }
+  const VArray<float> converted =
+      conversions.try_convert(VArray<bool>::from_span(values), CPPType::get<float>())
+          .typed<float>();
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_bools(values, memory);
+  Array<float> result(size);
+  for ([[maybe_unused]] const int i : IndexRange(5)) {
+    {
+      SCOPED_TIMER("Materialize");
+      converted.materialize(result);
+    }
+    {
+      SCOPED_TIMER("Materialize compressed");
+      converted.materialize_compressed(mask, result.as_mutable_span().take_front(mask.size()));
+    }
+  }
+}
+
+}  // namespace blender::bke::tests
@@ -124,6 +124,36 @@ inline std::optional<Vector<ChunkT>> parse_csv_in_chunks(
   return result_chunks;
 }
 
+/**
+ * Same as #parse_csv_in_chunks, but the buffer only contains data records and no header. This
+ * allows parsing large files in multiple consecutive buffers that each end at a record boundary,
+ * without having to keep the entire file in memory. The header of the file can be parsed with
+ * #detail::parse_record_fields.
+ */
+std::optional<Vector<Any<>>> parse_csv_records_in_chunks(
+    const Span<char> buffer,
+    const CsvParseOptions &options,
+    FunctionRef<Any<>(const CsvRecords &records)> process_records);
+
+template<typename ChunkT>
+inline std::optional<Vector<ChunkT>> parse_csv_records_in_chunks(
+    const Span<char> buffer,
+    const CsvParseOptions &options,
+    FunctionRef<ChunkT(const CsvRecords &records)> process_records)
+{
+  std::optional<Vector<Any<>>> result = parse_csv_records_in_chunks(
+      buffer, options, [&](const CsvRecords &records) { return Any<>(process_records(records)); });
+  if (!result.has_value()) {
+    return std::nullopt;
+  }
+  Vector<ChunkT> result_chunks;
+  result_chunks.reserve(result->size());
+  for (Any<> &value : *result) {
+    result_chunks.append(std::move(value.get<ChunkT>()));
+  }
+  return result_chunks;
+}
+
 /**
  * Fields in a CSV file may contain escaped quote characters (e.g. "" or \").
  * This function replaces these with just the quote character.
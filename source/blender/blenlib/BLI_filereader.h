@@ -30,12 +30,22 @@ struct FileReader;
 typedef int64_t (*FileReaderReadFn)(struct FileReader *reader, void *buffer, size_t size);
 typedef off64_t (*FileReaderSeekFn)(struct FileReader *reader, off64_t offset, int whence);
 typedef void (*FileReaderCloseFn)(struct FileReader *reader);
+typedef const void *(*FileReaderViewFn)(struct FileReader *reader, off64_t offset, size_t size);
 
 /** General structure for all #FileReaders, implementations add custom fields at the end. */
 struct FileReader {
   FileReaderReadFn read;
   FileReaderSeekFn seek;
   FileReaderCloseFn close;
+  /**
+   * Optional, gives direct access to `size` bytes at `offset` without copying them, it does not
+   * change the current offset. Only implemented by readers that have all their data in memory.
+   *
+   * Returns null if the range is not available or if an IO error happened. Since IO errors can
+   * also happen while the returned memory is being accessed, callers should call this again
+   * afterwards to check that the data they read was valid.
+   */
+  FileReaderViewFn view;
 
   off64_t offset;
 };
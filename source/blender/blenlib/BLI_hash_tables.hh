@@ -109,6 +109,34 @@ class LoadFactor {
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Slot Tags
+ *
+ * Similar to the control bytes of "Swiss tables", a slot can store a few bits of the hash of its
+ * key in its otherwise mostly unused state byte. When probing, keys whose tag differs from the
+ * tag of the searched hash can be skipped without calling the potentially expensive equality
+ * function. With a 7 bit tag, only about one in 128 occupied slots with a different key still
+ * has to compare the keys.
+ *
+ * The most significant bit is always set for occupied slots, so that the values 0 to 127 can be
+ * used for other states.
+ * \{ */
+
+constexpr uint8_t SLOT_TAG_OCCUPIED_FLAG = 0x80;
+
+/**
+ * Compute the state byte of an occupied slot containing a key with the given hash. Keys that end
+ * up in the same probing sequence usually share the low bits of their hash, because those are
+ * used to find the slot index. Therefore the tag is taken from the high bits of a multiplicative
+ * mix, which depend on all bits of the hash.
+ */
+constexpr uint8_t slot_tag_from_hash(const uint64_t hash)
+{
+  return uint8_t(SLOT_TAG_OCCUPIED_FLAG | ((hash * 0x9E3779B97F4A7C15u) >> 57));
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Intrusive Key Info
  *
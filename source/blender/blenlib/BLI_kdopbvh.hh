@@ -11,6 +11,7 @@
 #include "BLI_function_ref.hh"
 #include "BLI_hash.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
 #include "BLI_sys_types.h"
 
 namespace blender {
@@ -313,6 +314,30 @@ int BLI_bvhtree_find_nearest_projected(const BVHTree *tree,
                                        BVHTree_NearestProjectedCallback callback,
                                        void *userdata);
 
+/**
+ * Batch versions of #BLI_bvhtree_find_nearest and #BLI_bvhtree_ray_cast, running one query for
+ * every position. The queries are processed in parallel and in a spatially coherent order, where
+ * each query starts from the result of a nearby query, which visits far fewer nodes than
+ * independent queries when the positions are close to each other, like the vertices of a mesh.
+ * The callback is called from multiple threads.
+ *
+ * \param r_nearest, r_hits: Have to be initialized like for the single queries, e.g. to limit the
+ * search distance. When ties are possible, the found element can differ from the single queries.
+ */
+void BLI_bvhtree_find_nearest_batch(const BVHTree &tree,
+                                    Span<float3> positions,
+                                    MutableSpan<BVHTreeNearest> r_nearest,
+                                    BVHTree_NearestPointCallback callback,
+                                    void *userdata);
+void BLI_bvhtree_ray_cast_batch(const BVHTree &tree,
+                                Span<float3> origins,
+                                Span<float3> directions,
+                                float radius,
+                                MutableSpan<BVHTreeRayHit> r_hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                int flag = BVH_RAYCAST_DEFAULT);
+
 /**
  * Expose for BVH callbacks to use.
  */
@@ -15,6 +15,7 @@
 #include "BLI_kdtree_types.hh"
 #include "BLI_math_base.h"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include <algorithm>
@@ -296,6 +297,25 @@ inline int kdtree_find_nearest(const KDTree<CoordT> *tree,
   return min_node->index;
 }
 
+/**
+ * Run #kdtree_find_nearest for every position in parallel. The index of positions without a
+ * nearest point, because the tree is empty, is set to -1.
+ */
+template<typename CoordT>
+inline void kdtree_find_nearest_batch(const KDTree<CoordT> *tree,
+                                      const Span<CoordT> positions,
+                                      MutableSpan<KDTreeNearest<CoordT>> r_nearest)
+{
+  BLI_assert(positions.size() == r_nearest.size());
+  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      if (kdtree_find_nearest(tree, positions[i], &r_nearest[i]) == -1) {
+        r_nearest[i].index = -1;
+      }
+    }
+  });
+}
+
 /**
  * A version of #kdtree_3d_find_nearest which runs a callback
  * to filter out values.
@@ -1216,6 +1236,11 @@ constexpr inline auto kdtree_2d_find_nearest = kdtree_find_nearest<float2>;
 constexpr inline auto kdtree_3d_find_nearest = kdtree_find_nearest<float3>;
 constexpr inline auto kdtree_4d_find_nearest = kdtree_find_nearest<float4>;
 
+constexpr inline auto kdtree_1d_find_nearest_batch = kdtree_find_nearest_batch<float1>;
+constexpr inline auto kdtree_2d_find_nearest_batch = kdtree_find_nearest_batch<float2>;
+constexpr inline auto kdtree_3d_find_nearest_batch = kdtree_find_nearest_batch<float3>;
+constexpr inline auto kdtree_4d_find_nearest_batch = kdtree_find_nearest_batch<float4>;
+
 constexpr inline auto kdtree_1d_find_nearest_n = kdtree_find_nearest_n<float1>;
 constexpr inline auto kdtree_2d_find_nearest_n = kdtree_find_nearest_n<float2>;
 constexpr inline auto kdtree_3d_find_nearest_n = kdtree_find_nearest_n<float3>;
@@ -47,13 +47,16 @@ void initialize_pointer_pair(Src1 &&src1, Src2 &&src2, Dst1 *dst1, Dst2 *dst2)
  */
 template<typename Key, typename Value> class SimpleMapSlot {
  private:
+  /**
+   * Occupied slots store the tag computed by #slot_tag_from_hash, which always has its most
+   * significant bit set.
+   */
   enum State : uint8_t {
     Empty = 0,
-    Occupied = 1,
-    Removed = 2,
+    Removed = 1,
   };
 
-  State state_;
+  uint8_t state_;
   TypedBuffer<Key> key_buffer_;
   TypedBuffer<Value> value_buffer_;
 
@@ -71,7 +74,7 @@ template<typename Key, typename Value> class SimpleMapSlot {
    */
   ~SimpleMapSlot()
   {
-    if (state_ == Occupied) {
+    if (state_ & SLOT_TAG_OCCUPIED_FLAG) {
       key_buffer_.ref().~Key();
       value_buffer_.ref().~Value();
     }
@@ -84,7 +87,7 @@ template<typename Key, typename Value> class SimpleMapSlot {
   SimpleMapSlot(const SimpleMapSlot &other)
   {
     state_ = other.state_;
-    if (other.state_ == Occupied) {
+    if (other.state_ & SLOT_TAG_OCCUPIED_FLAG) {
       initialize_pointer_pair(other.key_buffer_.ref(),
                               other.value_buffer_.ref(),
                               key_buffer_.ptr(),
@@ -101,7 +104,7 @@ template<typename Key, typename Value> class SimpleMapSlot {
                                                 std::is_nothrow_move_constructible_v<Value>)
   {
     state_ = other.state_;
-    if (other.state_ == Occupied) {
+    if (other.state_ & SLOT_TAG_OCCUPIED_FLAG) {
       initialize_pointer_pair(std::move(other.key_buffer_.ref()),
                               std::move(other.value_buffer_.ref()),
                               key_buffer_.ptr(),
@@ -146,7 +149,7 @@ template<typename Key, typename Value> class SimpleMapSlot {
    */
   bool is_occupied() const
   {
-    return state_ == Occupied;
+    return (state_ & SLOT_TAG_OCCUPIED_FLAG) != 0;
   }
 
   /**
@@ -169,12 +172,13 @@ template<typename Key, typename Value> class SimpleMapSlot {
 
   /**
    * Returns true, when this slot is occupied and contains a key that compares equal to the given
-   * key. The hash can be used by other slot implementations to determine inequality faster.
+   * key. The tag stored in the state is compared first, so that most slots with a different key
+   * are skipped without calling the equality function.
    */
   template<typename ForwardKey, typename IsEqual>
-  bool contains(const ForwardKey &key, const IsEqual &is_equal, uint64_t /*hash*/) const
+  bool contains(const ForwardKey &key, const IsEqual &is_equal, const uint64_t hash) const
   {
-    if (state_ == Occupied) {
+    if (state_ == slot_tag_from_hash(hash)) {
       return is_equal(key, *key_buffer_);
     }
     return false;
@@ -190,14 +194,13 @@ template<typename Key, typename Value> class SimpleMapSlot {
     BLI_assert(!this->is_occupied());
     new (&value_buffer_) Value(std::forward<ForwardValue>(value)...);
     this->occupy_no_value(std::forward<ForwardKey>(key), hash);
-    state_ = Occupied;
   }
 
   /**
    * Change the state of this slot from empty/removed to occupied. The value is assumed to be
    * constructed already.
    */
-  template<typename ForwardKey> void occupy_no_value(ForwardKey &&key, uint64_t /*hash*/)
+  template<typename ForwardKey> void occupy_no_value(ForwardKey &&key, const uint64_t hash)
   {
     BLI_assert(!this->is_occupied());
     try {
@@ -208,7 +211,7 @@ template<typename Key, typename Value> class SimpleMapSlot {
       value_buffer_.ref().~Value();
       throw;
     }
-    state_ = Occupied;
+    state_ = slot_tag_from_hash(hash);
   }
 
   /**
@@ -49,6 +49,12 @@ struct Vert {
   double3 co;
   int id = NO_INDEX;
   int orig = NO_INDEX;
+  /**
+   * True when #co represents #co_exact without rounding, which is the case for all vertices of the
+   * input meshes. Predicates on such vertices can then use the (still exact) double versions
+   * instead of the much slower multi-precision arithmetic.
+   */
+  bool co_is_exact = false;
 
   Vert() = default;
   Vert(const mpq3 &mco, const double3 &dco, int id, int orig);
@@ -10,6 +10,7 @@
 
 #include "BLI_math_matrix_types.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
 
 namespace blender::noise {
 
@@ -73,6 +74,13 @@ float perlin_signed(float2 position);
 float perlin_signed(float3 position);
 float perlin_signed(float4 position);
 
+/**
+ * Evaluate #perlin_signed for many positions at once, which allows hashing the lattice corners of
+ * multiple positions with SIMD instructions. The result is identical to the single position
+ * version.
+ */
+void perlin_signed(Span<float3> positions, MutableSpan<float> r_values);
+
 /* Perlin noise in the range [0, 1]. */
 
 float perlin(float position);
@@ -85,6 +93,14 @@ float perlin(float4 position);
 template<typename T>
 float perlin_fbm(T p, float detail, float roughness, float lacunarity, bool normalize);
 
+/** Evaluate #perlin_fbm for many positions at once, with the same parameters for all of them. */
+void perlin_fbm(Span<float3> positions,
+                float detail,
+                float roughness,
+                float lacunarity,
+                bool normalize,
+                MutableSpan<float> r_values);
+
 /* Distorted fractal perlin noise. */
 
 template<typename T>
@@ -32,13 +32,16 @@ namespace blender {
  */
 template<typename Key> class SimpleSetSlot {
  private:
+  /**
+   * Occupied slots store the tag computed by #slot_tag_from_hash, which always has its most
+   * significant bit set.
+   */
   enum State : uint8_t {
     Empty = 0,
-    Occupied = 1,
-    Removed = 2,
+    Removed = 1,
   };
 
-  State state_;
+  uint8_t state_;
   TypedBuffer<Key> key_buffer_;
 
  public:
@@ -55,7 +58,7 @@ template<typename Key> class SimpleSetSlot {
    */
   ~SimpleSetSlot()
   {
-    if (state_ == Occupied) {
+    if (state_ & SLOT_TAG_OCCUPIED_FLAG) {
       key_buffer_.ref().~Key();
     }
   }
@@ -67,7 +70,7 @@ template<typename Key> class SimpleSetSlot {
   SimpleSetSlot(const SimpleSetSlot &other)
   {
     state_ = other.state_;
-    if (other.state_ == Occupied) {
+    if (other.state_ & SLOT_TAG_OCCUPIED_FLAG) {
       new (&key_buffer_) Key(*other.key_buffer_);
     }
   }
@@ -80,7 +83,7 @@ template<typename Key> class SimpleSetSlot {
   SimpleSetSlot(SimpleSetSlot &&other) noexcept(std::is_nothrow_move_constructible_v<Key>)
   {
     state_ = other.state_;
-    if (other.state_ == Occupied) {
+    if (other.state_ & SLOT_TAG_OCCUPIED_FLAG) {
       new (&key_buffer_) Key(std::move(*other.key_buffer_));
     }
   }
@@ -106,7 +109,7 @@ template<typename Key> class SimpleSetSlot {
    */
   bool is_occupied() const
   {
-    return state_ == Occupied;
+    return (state_ & SLOT_TAG_OCCUPIED_FLAG) != 0;
   }
 
   /**
@@ -129,12 +132,13 @@ template<typename Key> class SimpleSetSlot {
 
   /**
    * Return true, when this slot is occupied and contains a key that compares equal to the given
-   * key. The hash is used by other slot implementations to determine inequality faster.
+   * key. The tag stored in the state is compared first, so that most slots with a different key
+   * are skipped without calling the equality function.
    */
   template<typename ForwardKey, typename IsEqual>
-  bool contains(const ForwardKey &key, const IsEqual &is_equal, uint64_t /*hash*/) const
+  bool contains(const ForwardKey &key, const IsEqual &is_equal, const uint64_t hash) const
   {
-    if (state_ == Occupied) {
+    if (state_ == slot_tag_from_hash(hash)) {
       return is_equal(key, *key_buffer_);
     }
     return false;
@@ -144,11 +148,11 @@ template<typename Key> class SimpleSetSlot {
    * Change the state of this slot from empty/removed to occupied. The key has to be constructed
    * by calling the constructor with the given key as parameter.
    */
-  template<typename ForwardKey> void occupy(ForwardKey &&key, uint64_t /*hash*/)
+  template<typename ForwardKey> void occupy(ForwardKey &&key, const uint64_t hash)
   {
     BLI_assert(!this->is_occupied());
     new (&key_buffer_) Key(std::forward<ForwardKey>(key));
-    state_ = Occupied;
+    state_ = slot_tag_from_hash(hash);
   }
 
   /**
@@ -14,6 +14,8 @@
 #  include <algorithm>
 #endif
 
+#include "BLI_span.hh"
+
 namespace blender {
 
 #ifdef WITH_TBB
@@ -31,4 +33,14 @@ void parallel_sort(RandomAccessIterator begin, RandomAccessIterator end, const C
 }
 #endif
 
+/**
+ * Sort the indices by the keys they refer to, i.e. by `keys[indices[i]]`. The sort is stable,
+ * so indices with equal keys keep their order. Negative and positive zero are considered to be
+ * equal.
+ *
+ * Large inputs are sorted with a parallel LSD radix sort, which is much faster than a comparison
+ * sort with a comparator that looks up the keys.
+ */
+void parallel_sort_indices_by_key(Span<float> keys, MutableSpan<int> indices);
+
 }  // namespace blender
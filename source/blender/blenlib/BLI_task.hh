@@ -27,6 +27,16 @@ namespace blender {
 
 namespace threading {
 
+/**
+ * Priority of a group of tasks. Worker threads prefer tasks with a higher priority, so that work
+ * like depsgraph evaluation that the user is waiting for is not slowed down by work that is done
+ * in the background (e.g. building proxies, prefetching or compressing undo steps).
+ */
+enum class TaskPriority {
+  Background,
+  Interactive,
+};
+
 template<typename Range, typename Function>
 inline void parallel_for_each(Range &&range, const Function &function)
 {
@@ -45,6 +55,10 @@ void parallel_for_impl(IndexRange range,
                        FunctionRef<void(IndexRange)> function,
                        const TaskSizeHints &size_hints);
 void memory_bandwidth_bound_task_impl(FunctionRef<void()> function);
+void execute_with_priority_impl(TaskPriority priority, FunctionRef<void()> function);
+void parallel_for_numa_impl(IndexRange range,
+                            int64_t grain_size,
+                            FunctionRef<void(IndexRange)> function);
 }  // namespace detail
 
 /**
@@ -122,6 +136,33 @@ inline void parallel_for_aligned(const IndexRange range,
   });
 }
 
+/**
+ * Number of NUMA nodes that tasks can be distributed over. This is 1 on most systems and when the
+ * topology is unknown.
+ */
+int numa_nodes_num();
+
+/**
+ * Same as #parallel_for, but on systems with multiple NUMA nodes the range is split into one
+ * contiguous part per node, which is only processed by threads of that node. Memory is usually
+ * placed on the node that touches it first, so when an array is initialized and later processed
+ * with this function, most memory accesses stay local to the node. This matters for large,
+ * memory bandwidth bound loops. On other systems this is the same as #parallel_for.
+ */
+template<typename Function>
+inline void parallel_for_numa(const IndexRange range,
+                              const int64_t grain_size,
+                              const Function &function)
+{
+  if (range.size() <= grain_size) {
+    if (!range.is_empty()) {
+      function(range);
+    }
+    return;
+  }
+  detail::parallel_for_numa_impl(range, grain_size, function);
+}
+
 template<typename Value, typename Function, typename Reduction>
 inline Value parallel_reduce(IndexRange range,
                              int64_t grain_size,
@@ -230,6 +271,24 @@ template<typename Function> inline auto isolate_task(const Function &function)
 #endif
 }
 
+/**
+ * Execute the function with the given priority. Tasks spawned by the function, e.g. with
+ * #parallel_for, get the same priority. Code running with #TaskPriority::Interactive is the
+ * default, background work runs in a separate task arena which only gets threads that are not
+ * needed for interactive tasks.
+ *
+ * Like #isolate_task, the calling thread only works on tasks of the same priority while waiting.
+ */
+template<typename Function>
+inline void execute_with_priority(const TaskPriority priority, const Function &function)
+{
+  if (priority == TaskPriority::Interactive) {
+    function();
+    return;
+  }
+  detail::execute_with_priority_impl(priority, function);
+}
+
 /**
  * Should surround parallel code that is highly bandwidth intensive, e.g. it just fills a buffer
  * with no or just few additional operations. If the buffers are large, it's beneficial to limit
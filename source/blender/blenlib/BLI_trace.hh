@@ -0,0 +1,95 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ *
+ * Low overhead instrumentation of hot code paths.
+ *
+ * Named zones are recorded into fixed size per-thread ring buffers, so recording never allocates
+ * or takes a contended lock. When tracing is disabled, a zone only checks a global flag. The
+ * recorded zones can be written as Chrome trace event JSON, which can be opened in Perfetto or
+ * `chrome://tracing`.
+ *
+ * \code{.cc}
+ * void my_function()
+ * {
+ *   TRACE_ZONE("My Function");
+ *   ...
+ * }
+ * \endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+
+#include "BLI_sys_types.h"
+
+namespace blender::trace {
+
+namespace detail {
+extern std::atomic<bool> enabled;
+int64_t now_ns();
+void record_zone(const char *name, int64_t begin_ns, int64_t end_ns);
+}  // namespace detail
+
+/** Number of zones each thread keeps, older zones are overwritten when the buffer is full. */
+constexpr int64_t thread_buffer_size = 1 << 16;
+
+inline bool is_enabled()
+{
+  return detail::enabled.load(std::memory_order_relaxed);
+}
+
+void set_enabled(bool enabled);
+
+/** Remove all zones recorded so far. */
+void clear();
+
+/** Number of zones currently stored in all thread buffers. */
+int64_t recorded_zones_num();
+
+/** Write all recorded zones as Chrome trace event JSON. */
+void write_chrome_json(FILE *file);
+
+/**
+ * Set a file that the recorded zones are written to by #write_output_file, used for tracing a
+ * whole session from the command line. Also enables tracing.
+ */
+void set_output_filepath(const char *filepath);
+void write_output_file();
+
+/**
+ * Record the time spent in the current scope.
+ * \param name: Must be a string with static lifetime, only the pointer is stored.
+ */
+class ScopedZone {
+ private:
+  const char *name_;
+  int64_t begin_ns_ = -1;
+
+ public:
+  ScopedZone(const char *name) : name_(name)
+  {
+    if (is_enabled()) {
+      begin_ns_ = detail::now_ns();
+    }
+  }
+
+  ~ScopedZone()
+  {
+    if (begin_ns_ != -1) {
+      detail::record_zone(name_, begin_ns_, detail::now_ns());
+    }
+  }
+
+  ScopedZone(const ScopedZone &other) = delete;
+  ScopedZone &operator=(const ScopedZone &other) = delete;
+};
+
+}  // namespace blender::trace
+
+#define TRACE_ZONE(name) blender::trace::ScopedZone trace_zone_(name)
@@ -28,12 +28,17 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
+#include "BLI_bounds.hh"
 #include "BLI_heap_simple.h"
 #include "BLI_kdopbvh.hh"
 #include "BLI_math_geom.h"
+#include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_sort.hh"
 #include "BLI_stack.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
@@ -121,6 +126,8 @@ struct BVHNearestData {
   void *userdata;
   float proj[13]; /* coordinates projection over axis */
   BVHTreeNearest nearest;
+  /* The leaf that improved the nearest result last, used by batch queries. */
+  const BVHNode *nearest_leaf = nullptr;
 };
 
 struct BVHRayCastData {
@@ -135,6 +142,9 @@ struct BVHRayCastData {
   IsectRayPrecalc isect_precalc;
 #endif
 
+  /* The leaf that improved the hit last, used by batch queries. */
+  const BVHNode *hit_leaf = nullptr;
+
   /* initialized by bvhtree_ray_cast_data_precalc */
   float ray_dot_axis[13];
   float idot_axis[13];
@@ -1525,7 +1535,9 @@ int *BLI_bvhtree_intersect_plane(const BVHTree *tree, float plane[4], uint *r_in
 
 /* Determines the nearest point of the given node BV.
  * Returns the squared distance to that point. */
-static float calc_nearest_point_squared(const float proj[3], BVHNode *node, float nearest[3])
+static float calc_nearest_point_squared(const float proj[3],
+                                        const BVHNode *node,
+                                        float nearest[3])
 {
   int i;
   const float *bv = node->bv;
@@ -1541,17 +1553,31 @@ static float calc_nearest_point_squared(const float proj[3], BVHNode *node, floa
   return len_squared_v3v3(proj, nearest);
 }
 
+static void find_nearest_test_leaf(BVHNearestData *data, const BVHNode *node)
+{
+  const float dist_sq_prev = data->nearest.dist_sq;
+  if (data->callback) {
+    data->callback(data->userdata, node->index, data->co, &data->nearest);
+  }
+  else {
+    float nearest[3];
+    const float dist_sq = calc_nearest_point_squared(data->proj, node, nearest);
+    if (dist_sq < data->nearest.dist_sq) {
+      data->nearest.index = node->index;
+      data->nearest.dist_sq = dist_sq;
+      copy_v3_v3(data->nearest.co, nearest);
+    }
+  }
+  if (data->nearest.dist_sq < dist_sq_prev) {
+    data->nearest_leaf = node;
+  }
+}
+
 /* Depth first search method */
 static void dfs_find_nearest_dfs(BVHNearestData *data, BVHNode *node)
 {
   if (node->node_num == 0) {
-    if (data->callback) {
-      data->callback(data->userdata, node->index, data->co, &data->nearest);
-    }
-    else {
-      data->nearest.index = node->index;
-      data->nearest.dist_sq = calc_nearest_point_squared(data->proj, node, data->nearest.co);
-    }
+    find_nearest_test_leaf(data, node);
   }
   else {
     /* Better heuristic to pick the closest node to dive on */
@@ -1596,13 +1622,7 @@ static void dfs_find_nearest_begin(BVHNearestData *data, BVHNode *node)
 static void heap_find_nearest_inner(BVHNearestData *data, HeapSimple *heap, BVHNode *node)
 {
   if (node->node_num == 0) {
-    if (data->callback) {
-      data->callback(data->userdata, node->index, data->co, &data->nearest);
-    }
-    else {
-      data->nearest.index = node->index;
-      data->nearest.dist_sq = calc_nearest_point_squared(data->proj, node, data->nearest.co);
-    }
+    find_nearest_test_leaf(data, node);
   }
   else {
     float nearest[3];
@@ -1852,7 +1872,7 @@ static float fast_ray_nearest_hit(const BVHRayCastData *data, const BVHNode *nod
   return max_fff(t1x, t1y, t1z);
 }
 
-static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
+static void dfs_raycast(BVHRayCastData *data, const BVHNode *node)
 {
   int i;
 
@@ -1866,6 +1886,7 @@ static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
   }
 
   if (node->node_num == 0) {
+    const float hit_dist_prev = data->hit.dist;
     if (data->callback) {
       data->callback(data->userdata, node->index, &data->ray, &data->hit);
     }
@@ -1874,6 +1895,9 @@ static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
       data->hit.dist = dist;
       madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, dist);
     }
+    if (data->hit.dist < hit_dist_prev) {
+      data->hit_leaf = node;
+    }
   }
   else {
     /* pick loop direction to dive into the tree (based on ray direction and split axis) */
@@ -2183,6 +2207,151 @@ int BLI_bvhtree_range_query(const BVHTree *tree,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name BLI_bvhtree_find_nearest_batch / BLI_bvhtree_ray_cast_batch
+ *
+ * Queries are sorted along a Z-order curve of their positions and processed in blocks of
+ * consecutive queries. Every query is first tested against the leaf found by the previous query
+ * of its block, which usually gives a tight bound right away so that most of the tree is skipped.
+ * The block size is fixed to keep the results independent of the task scheduling.
+ * \{ */
+
+#define BVH_BATCH_BLOCK_SIZE 256
+
+/** Spread the lower 10 bits of the value, so that there are two zero bits between every bit. */
+static uint32_t morton_spread_bits(uint32_t x)
+{
+  x &= 0x3ff;
+  x = (x | (x << 16)) & 0x030000ff;
+  x = (x | (x << 8)) & 0x0300f00f;
+  x = (x | (x << 4)) & 0x030c30c3;
+  x = (x | (x << 2)) & 0x09249249;
+  return x;
+}
+
+static Array<int> bvhtree_batch_spatial_order(const Span<float3> positions)
+{
+  Array<int> order(positions.size());
+  const std::optional<Bounds<float3>> bounds = bounds::min_max(positions);
+  if (!bounds) {
+    return order;
+  }
+  const float3 size = math::max(bounds->max - bounds->min, float3(FLT_EPSILON));
+  const float3 scale = float3(1023.0f) / size;
+
+  Array<uint32_t> keys(positions.size());
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const float3 co = math::clamp(
+          (positions[i] - bounds->min) * scale, float3(0.0f), float3(1023.0f));
+      keys[i] = morton_spread_bits(uint32_t(co.x)) | (morton_spread_bits(uint32_t(co.y)) << 1) |
+                (morton_spread_bits(uint32_t(co.z)) << 2);
+      order[i] = int(i);
+    }
+  });
+  parallel_sort(order.begin(), order.end(), [&](const int a, const int b) {
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+  });
+  return order;
+}
+
+template<typename Fn>
+static void bvhtree_batch_foreach_block(const Span<int> order, const Fn &fn)
+{
+  const int64_t blocks_num = int64_t(
+      divide_ceil_ul(uint64_t(order.size()), BVH_BATCH_BLOCK_SIZE));
+  threading::parallel_for(IndexRange(blocks_num), 1, [&](const IndexRange blocks) {
+    for (const int64_t block : blocks) {
+      fn(order.slice_safe(block * BVH_BATCH_BLOCK_SIZE, BVH_BATCH_BLOCK_SIZE));
+    }
+  });
+}
+
+void BLI_bvhtree_find_nearest_batch(const BVHTree &tree,
+                                    const Span<float3> positions,
+                                    MutableSpan<BVHTreeNearest> r_nearest,
+                                    BVHTree_NearestPointCallback callback,
+                                    void *userdata)
+{
+  BLI_assert(positions.size() == r_nearest.size());
+  BVHNode *root = tree.nodes[tree.leaf_num];
+  if (root == nullptr) {
+    return;
+  }
+
+  const Array<int> order = bvhtree_batch_spatial_order(positions);
+  bvhtree_batch_foreach_block(order, [&](const Span<int> block) {
+    const BVHNode *prev_leaf = nullptr;
+    for (const int i : block) {
+      BVHNearestData data;
+      data.tree = &tree;
+      data.co = positions[i];
+      data.callback = callback;
+      data.userdata = userdata;
+      for (axis_t axis_iter = tree.start_axis; axis_iter != tree.stop_axis; axis_iter++) {
+        data.proj[axis_iter] = dot_v3v3(data.co, bvhtree_kdop_axes[axis_iter]);
+      }
+      data.nearest = r_nearest[i];
+
+      if (prev_leaf) {
+        find_nearest_test_leaf(&data, prev_leaf);
+      }
+      dfs_find_nearest_begin(&data, root);
+
+      r_nearest[i] = data.nearest;
+      if (data.nearest_leaf) {
+        prev_leaf = data.nearest_leaf;
+      }
+    }
+  });
+}
+
+void BLI_bvhtree_ray_cast_batch(const BVHTree &tree,
+                                const Span<float3> origins,
+                                const Span<float3> directions,
+                                const float radius,
+                                MutableSpan<BVHTreeRayHit> r_hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                const int flag)
+{
+  BLI_assert(origins.size() == directions.size());
+  BLI_assert(origins.size() == r_hits.size());
+  BVHNode *root = tree.nodes[tree.leaf_num];
+  if (root == nullptr) {
+    return;
+  }
+
+  const Array<int> order = bvhtree_batch_spatial_order(origins);
+  bvhtree_batch_foreach_block(order, [&](const Span<int> block) {
+    const BVHNode *prev_leaf = nullptr;
+    for (const int i : block) {
+      BLI_ASSERT_UNIT_V3(directions[i]);
+      BVHRayCastData data;
+      data.tree = &tree;
+      data.callback = callback;
+      data.userdata = userdata;
+      copy_v3_v3(data.ray.origin, origins[i]);
+      copy_v3_v3(data.ray.direction, directions[i]);
+      data.ray.radius = radius;
+      bvhtree_ray_cast_data_precalc(&data, flag);
+      data.hit = r_hits[i];
+
+      if (prev_leaf) {
+        dfs_raycast(&data, prev_leaf);
+      }
+      dfs_raycast(&data, root);
+
+      r_hits[i] = data.hit;
+      if (data.hit_leaf) {
+        prev_leaf = data.hit_leaf;
+      }
+    }
+  });
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name BLI_bvhtree_nearest_projected
  * \{ */
@@ -95,10 +95,12 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 #include "BLI_mempool.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLI_array_store.h" /* Own include. */
@@ -997,6 +999,25 @@ static void hash_array_from_data(const BArrayInfo *info,
 #  undef HASH_ARRAY_FROM_DATA_GENERIC
 }
 
+/**
+ * Same as #hash_array_from_data, hashing large arrays in parallel.
+ */
+static void hash_array_from_data_parallel(const BArrayInfo *info,
+                                          const uchar *data_slice,
+                                          const size_t data_slice_len,
+                                          hash_key *hash_array)
+{
+  const size_t hash_array_len = data_slice_len / info->chunk_stride;
+  threading::parallel_for(
+      IndexRange(int64_t(hash_array_len)), 16384, [&](const IndexRange range) {
+        const size_t offset = size_t(range.start()) * info->chunk_stride;
+        hash_array_from_data(info,
+                             &data_slice[offset],
+                             size_t(range.size()) * info->chunk_stride,
+                             &hash_array[range.start()]);
+      });
+}
+
 /**
  * Similar to hash_array_from_data,
  * but able to step into the next chunk if we run-out of data.
@@ -1051,6 +1072,68 @@ static void hash_accum(hash_key *hash_array, const size_t hash_array_len, size_t
   }
 }
 
+/**
+ * Same as #hash_accum, accumulating large arrays in parallel.
+ *
+ * Every accumulated value depends on the values up to the read-ahead length after it, see
+ * #BArrayInfo::accum_read_ahead_len. The array is split into blocks, each of them is accumulated
+ * in a local buffer that includes the original values of the read-ahead after the block, so the
+ * results are the same as with #hash_accum.
+ */
+static void hash_accum_parallel(hash_key *hash_array,
+                                const size_t hash_array_len,
+                                size_t iter_steps)
+{
+  if (UNLIKELY(iter_steps > hash_array_len)) {
+    iter_steps = hash_array_len;
+  }
+  const size_t read_ahead_len = (iter_steps * (iter_steps + 1)) / 2;
+  const size_t block_len = std::max<size_t>(read_ahead_len, 65536);
+  if (hash_array_len < block_len * 2) {
+    hash_accum(hash_array, hash_array_len, iter_steps);
+    return;
+  }
+  const size_t hash_array_search_len = hash_array_len - iter_steps;
+  const size_t blocks_num = ceil_division(hash_array_len, block_len);
+
+  /* Store the read-ahead values of every block before they are modified by another block. */
+  Array<hash_key> read_ahead_store(int64_t(blocks_num * read_ahead_len));
+  threading::parallel_for(IndexRange(int64_t(blocks_num)), 16, [&](const IndexRange range) {
+    for (const int64_t block : range) {
+      const size_t start = std::min(size_t(block + 1) * block_len, hash_array_len);
+      const size_t len = std::min(read_ahead_len, hash_array_len - start);
+      std::copy_n(&hash_array[start], len, &read_ahead_store[block * int64_t(read_ahead_len)]);
+    }
+  });
+
+  threading::parallel_for(IndexRange(int64_t(blocks_num)), 1, [&](const IndexRange range) {
+    Array<hash_key> local(int64_t(block_len + read_ahead_len), NoInitialization());
+    for (const int64_t block : range) {
+      const size_t start = size_t(block) * block_len;
+      const size_t len = std::min(block_len, hash_array_len - start);
+      const size_t local_len = len + std::min(read_ahead_len, hash_array_len - start - len);
+      std::copy_n(&hash_array[start], len, local.data());
+      std::copy_n(&read_ahead_store[block * int64_t(read_ahead_len)],
+                  local_len - len,
+                  &local[int64_t(len)]);
+
+      /* Values at the end of the local buffer become invalid because their read-ahead is
+       * missing, but that never reaches the values of the block itself. */
+      const size_t local_search_len = start < hash_array_search_len ?
+                                          std::min(local_len, hash_array_search_len - start) :
+                                          0;
+      for (size_t hash_offset = std::min(iter_steps, local_len); hash_offset != 0; hash_offset--)
+      {
+        const size_t search_len = std::min(local_search_len, local_len - hash_offset);
+        for (size_t i = 0; i < search_len; i++) {
+          hash_accum_impl(local.data(), i, i + hash_offset);
+        }
+      }
+      std::copy_n(local.data(), len, &hash_array[start]);
+    }
+  });
+}
+
 /**
  * When we only need a single value, can use a small optimization.
  * we can avoid accumulating the tail of the array a little, each iteration.
@@ -1461,9 +1544,9 @@ static BChunkList *bchunk_list_from_data_merge(const BArrayInfo *info,
     const size_t table_hash_array_len = (data_len - i_prev) / info->chunk_stride;
     hash_key *table_hash_array = MEM_new_array_uninitialized<hash_key>(table_hash_array_len,
                                                                        __func__);
-    hash_array_from_data(info, &data[i_prev], data_len - i_prev, table_hash_array);
+    hash_array_from_data_parallel(info, &data[i_prev], data_len - i_prev, table_hash_array);
 
-    hash_accum(table_hash_array, table_hash_array_len, info->accum_steps);
+    hash_accum_parallel(table_hash_array, table_hash_array_len, info->accum_steps);
 #else
     /* Dummy vars. */
     uint i_table_start = 0;
@@ -36,7 +36,34 @@ bool or_bytes_into_bits(const Span<char> bytes,
       iteration_end = (iteration_end + 16) & ~15;
     }
   }
-  /* Iterate over chunks of bytes. */
+  /* Iterate over groups of 64 bytes, so that a full bit integer is computed before it is written.
+   * This avoids most of the read-modify-write operations on the output. */
+  for (; byte_i + 64 <= iteration_end; byte_i += 64) {
+    const BitInt is_true_mask =
+        BitInt(byte_to_bit.see2_chunk(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes_ + byte_i)))) |
+        (BitInt(byte_to_bit.see2_chunk(
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes_ + byte_i + 16))))
+         << 16) |
+        (BitInt(byte_to_bit.see2_chunk(
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes_ + byte_i + 32))))
+         << 32) |
+        (BitInt(byte_to_bit.see2_chunk(
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes_ + byte_i + 48))))
+         << 48);
+    if (is_true_mask == 0) {
+      continue;
+    }
+    any_true = true;
+
+    const int start_bit_in_int = (r_bits.bit_range().start() + byte_i) & BitIndexMask;
+    BitInt *start_bit_int = int_containing_bit(r_bits.data(), r_bits.bit_range().start() + byte_i);
+    *start_bit_int |= is_true_mask << start_bit_in_int;
+    if (start_bit_in_int > 0) {
+      start_bit_int[1] |= is_true_mask >> (BitsPerInt - start_bit_in_int);
+    }
+  }
+  /* Iterate over the remaining chunks of bytes. */
   for (; byte_i + 16 <= iteration_end; byte_i += 16) {
     /* Load 16 bytes at once. */
     const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes_ + byte_i));
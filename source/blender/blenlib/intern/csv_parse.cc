@@ -109,6 +109,14 @@ std::optional<Vector<Any<>>> parse_csv_in_chunks(
 
   /* This buffer contains only the data records, without the header. */
   const Span<char> data_buffer = buffer.drop_front(*first_data_record_start);
+  return parse_csv_records_in_chunks(data_buffer, options, process_records);
+}
+
+std::optional<Vector<Any<>>> parse_csv_records_in_chunks(
+    const Span<char> data_buffer,
+    const CsvParseOptions &options,
+    FunctionRef<Any<>(const CsvRecords &records)> process_records)
+{
   /* Split the buffer into chunks that can be processed in parallel. */
   const Vector<Span<char>> data_buffer_chunks = split_into_aligned_chunks(
       data_buffer, options.chunk_size_bytes);
@@ -14,14 +14,14 @@
  *  - Literals:
  *      floating point and decimal integer.
  *  - Constants:
- *      pi, True, False
+ *      pi, tau, e, True, False
  *  - Operators:
- *      +, -, *, /, ==, !=, <, <=, >, >=, and, or, not, ternary if
+ *      +, -, *, /, //, %, **, ==, !=, <, <=, >, >=, and, or, not, ternary if
  *  - Functions:
  *      min, max, radians, degrees,
  *      abs, fabs, floor, ceil, trunc, int,
- *      sin, cos, tan, asin, acos, atan, atan2,
- *      exp, log, sqrt, pow, fmod
+ *      sin, cos, tan, asin, acos, atan, atan2, sinh, cosh, tanh, hypot,
+ *      exp, log, log2, log10, sqrt, pow, fmod, copysign
  *
  * The implementation has no global state and can be used multi-threaded.
  */
@@ -300,6 +300,21 @@ static double op_sub(double a, double b)
   return a - b;
 }
 
+static double op_floordiv(double a, double b)
+{
+  return floor(a / b);
+}
+
+/* Python modulo, the result has the sign of the divisor unlike with `fmod`. */
+static double op_mod(double a, double b)
+{
+  double r = fmod(a, b);
+  if (r != 0.0 && ((r < 0.0) != (b < 0.0))) {
+    r += b;
+  }
+  return r;
+}
+
 static double op_radians(double arg)
 {
   return arg * M_PI / 180.0;
@@ -380,7 +395,13 @@ struct BuiltinConstDef {
 };
 
 static BuiltinConstDef builtin_consts[] = {
-    {"pi", M_PI}, {"True", 1.0}, {"False", 0.0}, {nullptr, 0.0}};
+    {"pi", M_PI},
+    {"tau", 2.0 * M_PI},
+    {"e", M_E},
+    {"True", 1.0},
+    {"False", 0.0},
+    {nullptr, 0.0},
+};
 
 struct BuiltinOpDef {
   const char *name;
@@ -428,12 +449,19 @@ static BuiltinOpDef builtin_ops[] = {
     {"acos", UnaryOpFunc(acos)},
     {"atan", UnaryOpFunc(atan)},
     {"atan2", BinaryOpFunc(atan2)},
+    {"sinh", UnaryOpFunc(sinh)},
+    {"cosh", UnaryOpFunc(cosh)},
+    {"tanh", UnaryOpFunc(tanh)},
+    {"hypot", BinaryOpFunc(hypot)},
     {"exp", UnaryOpFunc(exp)},
     {"log", UnaryOpFunc(log)},
     {"log", BinaryOpFunc(op_log2)},
+    {"log2", UnaryOpFunc(log2)},
+    {"log10", UnaryOpFunc(log10)},
     {"sqrt", UnaryOpFunc(sqrt)},
     {"pow", BinaryOpFunc(pow)},
     {"fmod", BinaryOpFunc(fmod)},
+    {"copysign", BinaryOpFunc(copysign)},
     {"lerp", TernaryOpFunc(op_lerp)},
     {"clamp", UnaryOpFunc(op_clamp)},
     {"clamp", TernaryOpFunc(op_clamp3)},
@@ -463,6 +491,8 @@ static BuiltinOpDef builtin_ops[] = {
 #define TOKEN_LE MAKE_CHAR2('<', '=')
 #define TOKEN_NE MAKE_CHAR2('!', '=')
 #define TOKEN_EQ MAKE_CHAR2('=', '=')
+#define TOKEN_POW MAKE_CHAR2('*', '*')
+#define TOKEN_FLOORDIV MAKE_CHAR2('/', '/')
 #define TOKEN_AND MAKE_CHAR2('A', 'N')
 #define TOKEN_OR MAKE_CHAR2('O', 'R')
 #define TOKEN_NOT MAKE_CHAR2('N', 'O')
@@ -679,6 +709,13 @@ static bool parse_next_token(ExprParseState *state)
     return true;
   }
 
+  /* `**` and `//` tokens */
+  if (state->cur[1] == state->cur[0] && ELEM(state->cur[0], '*', '/')) {
+    state->token = MAKE_CHAR2(state->cur[0], state->cur[1]);
+    state->cur += 2;
+    return true;
+  }
+
   /* Special characters (single character tokens) */
   if (strchr(token_characters, *state->cur)) {
     state->token = *state->cur++;
@@ -751,19 +788,13 @@ static int parse_function_args(ExprParseState *state)
   }
 }
 
-static bool parse_unary(ExprParseState *state)
+static bool parse_unary(ExprParseState *state);
+
+static bool parse_primary(ExprParseState *state)
 {
   int i;
 
   switch (state->token) {
-    case '+':
-      return parse_next_token(state) && parse_unary(state);
-
-    case '-':
-      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
-      parse_add_func(state, op_negate);
-      return true;
-
     case '(':
       return parse_next_token(state) && parse_expr(state) && state->token == ')' &&
              parse_next_token(state);
@@ -837,6 +868,35 @@ static bool parse_unary(ExprParseState *state)
   }
 }
 
+/* The power operator binds tighter than unary operators on its left, but not on its right. */
+static bool parse_power(ExprParseState *state)
+{
+  CHECK_ERROR(parse_primary(state));
+
+  if (state->token == TOKEN_POW) {
+    CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+    parse_add_func(state, BinaryOpFunc(pow));
+  }
+
+  return true;
+}
+
+static bool parse_unary(ExprParseState *state)
+{
+  switch (state->token) {
+    case '+':
+      return parse_next_token(state) && parse_unary(state);
+
+    case '-':
+      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+      parse_add_func(state, op_negate);
+      return true;
+
+    default:
+      return parse_power(state);
+  }
+}
+
 static bool parse_mul(ExprParseState *state)
 {
   CHECK_ERROR(parse_unary(state));
@@ -853,6 +913,16 @@ static bool parse_mul(ExprParseState *state)
         parse_add_func(state, op_div);
         break;
 
+      case TOKEN_FLOORDIV:
+        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        parse_add_func(state, op_floordiv);
+        break;
+
+      case '%':
+        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        parse_add_func(state, op_mod);
+        break;
+
       default:
         return true;
     }
@@ -65,6 +65,15 @@ static off64_t memory_seek(FileReader *reader, off64_t offset, int whence)
   return mem->reader.offset;
 }
 
+static const void *memory_view_raw(FileReader *reader, off64_t offset, size_t size)
+{
+  MemoryReader *mem = reinterpret_cast<MemoryReader *>(reader);
+  if (offset < 0 || offset + size > mem->length) {
+    return nullptr;
+  }
+  return mem->data + offset;
+}
+
 static void memory_close_raw(FileReader *reader)
 {
   MEM_delete(reader);
@@ -80,6 +89,7 @@ FileReader *BLI_filereader_new_memory(const void *data, size_t len)
   mem->reader.read = memory_read_raw;
   mem->reader.seek = memory_seek;
   mem->reader.close = memory_close_raw;
+  mem->reader.view = memory_view_raw;
 
   return reinterpret_cast<FileReader *>(mem);
 }
@@ -106,6 +116,15 @@ static int64_t memory_read_mmap(FileReader *reader, void *buffer, size_t size)
   return readsize;
 }
 
+static const void *memory_view_mmap(FileReader *reader, off64_t offset, size_t size)
+{
+  MemoryReader *mem = reinterpret_cast<MemoryReader *>(reader);
+  if (offset < 0 || offset + size > mem->length || BLI_mmap_any_io_error(mem->mmap)) {
+    return nullptr;
+  }
+  return static_cast<const char *>(BLI_mmap_get_pointer(mem->mmap)) + offset;
+}
+
 static void memory_close_mmap(FileReader *reader)
 {
   MemoryReader *mem = reinterpret_cast<MemoryReader *>(reader);
@@ -128,6 +147,7 @@ FileReader *BLI_filereader_new_mmap(int filedes)
   mem->reader.read = memory_read_mmap;
   mem->reader.seek = memory_seek;
   mem->reader.close = memory_close_mmap;
+  mem->reader.view = memory_view_mmap;
 
   return reinterpret_cast<FileReader *>(mem);
 }
@@ -7,11 +7,13 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <zstd.h>
 
 #include "BLI_fileops.hh"
 #include "BLI_filereader.h"
+#include "BLI_task.hh"
 
 #include "MEM_guardedalloc.h"
 
@@ -193,6 +195,51 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
   return uncompressed_data;
 }
 
+/* Decompress the frames in `[first_frame, last_frame)` straight into `buffer`, using one task
+ * per frame. The frames are independent, so only reading the compressed data is serialized. */
+static bool zstd_read_frames_parallel(ZstdReader *zstd,
+                                      const int first_frame,
+                                      const int last_frame,
+                                      char *buffer)
+{
+  const size_t compressed_start = zstd->seek.compressed_ofs[first_frame];
+  const size_t compressed_size = zstd->seek.compressed_ofs[last_frame] - compressed_start;
+
+  char *compressed_data = MEM_new_array_uninitialized<char>(compressed_size, __func__);
+  if (zstd->base->seek(zstd->base, compressed_start, SEEK_SET) < 0 ||
+      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
+  {
+    MEM_delete(compressed_data);
+    return false;
+  }
+
+  const size_t uncompressed_start = zstd->seek.uncompressed_ofs[first_frame];
+  const IndexRange frames(first_frame, last_frame - first_frame);
+  std::atomic<bool> success = true;
+  threading::parallel_for(frames, 1, [&](const IndexRange range) {
+    ZSTD_DCtx *ctx = ZSTD_createDCtx();
+    for (const int frame : range) {
+      const size_t frame_compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                                           zstd->seek.compressed_ofs[frame];
+      const size_t frame_uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                                             zstd->seek.uncompressed_ofs[frame];
+      const size_t res = ZSTD_decompressDCtx(
+          ctx,
+          buffer + (zstd->seek.uncompressed_ofs[frame] - uncompressed_start),
+          frame_uncompressed_size,
+          compressed_data + (zstd->seek.compressed_ofs[frame] - compressed_start),
+          frame_compressed_size);
+      if (ZSTD_isError(res) || res < frame_uncompressed_size) {
+        success = false;
+        break;
+      }
+    }
+    ZSTD_freeDCtx(ctx);
+  });
+  MEM_delete(compressed_data);
+  return success;
+}
+
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
 {
   ZstdReader *zstd = reinterpret_cast<ZstdReader *>(reader);
@@ -205,6 +252,29 @@ static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
       break;
     }
 
+    if (zstd->seek.uncompressed_ofs[frame] == zstd->reader.offset) {
+      /* Large reads (e.g. big arrays) may cover several whole frames, decompress those in
+       * parallel without going through the frame cache. */
+      int last_frame = frame;
+      while (last_frame < zstd->seek.frames_num &&
+             zstd->seek.uncompressed_ofs[last_frame + 1] <= end_offset)
+      {
+        last_frame++;
+      }
+      if (last_frame - frame >= 2) {
+        if (!zstd_read_frames_parallel(
+                zstd, frame, last_frame, static_cast<char *>(buffer) + read_len))
+        {
+          break;
+        }
+        const size_t frames_read_len = zstd->seek.uncompressed_ofs[last_frame] -
+                                       zstd->reader.offset;
+        read_len += frames_read_len;
+        zstd->reader.offset += frames_read_len;
+        continue;
+      }
+    }
+
     const char *framedata = zstd_ensure_cache(zstd, frame);
     if (framedata == nullptr) {
       /* Error while reading the frame, so return as much as we can. */
@@ -633,17 +633,32 @@ IndexMask IndexMask::from_bools(const IndexMask &universe,
         return from_bits_batch_predicate(universe_segment, builder, bits);
       },
       exec_mode::grain_size(max_segment_size));
-  BitVector bits(bools);
-  return IndexMask::from_bits(universe, bits, memory);
 }
 
 IndexMask IndexMask::from_bools_inverse(const IndexMask &universe,
                                         Span<bool> bools,
                                         IndexMaskMemory &memory)
 {
-  BitVector bits(bools);
-  bits::invert(bits);
-  return IndexMask::from_bits(universe, bits, memory);
+  BLI_assert(bools.size() >= universe.min_array_size());
+  /* Same as #from_bools, but the bits are inverted before they are used. This avoids converting
+   * all bools to bits on a single thread first. */
+  return IndexMask::from_batch_predicate(
+      universe,
+      memory,
+      [&](const IndexMaskSegment universe_segment,
+          IndexRangesBuilder<int16_t> &builder) -> int64_t {
+        const IndexRange slice = IndexRange::from_begin_end_inclusive(universe_segment[0],
+                                                                      universe_segment.last());
+        /* +16 to allow for some overshoot when converting bools to bits. */
+        BitVector<max_segment_size + 16> bits;
+        bits.resize(slice.size(), false);
+        const int64_t allowed_overshoot = std::min<int64_t>(bits.capacity() - slice.size(),
+                                                            bools.size() - slice.one_after_last());
+        bits::or_bools_into_bits(bools.slice(slice), bits, allowed_overshoot);
+        bits::invert(bits);
+        return from_bits_batch_predicate(universe_segment, builder, bits);
+      },
+      exec_mode::grain_size(max_segment_size));
 }
 
 IndexMask IndexMask::from_bools(const IndexMask &universe,
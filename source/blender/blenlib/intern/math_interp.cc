@@ -104,6 +104,49 @@ BLI_INLINE void bicubic_interpolation_uchar_simd(
 }
 #endif /* BLI_HAVE_SSE4 */
 
+#if BLI_HAVE_SSE2
+template<eCubicFilter filter>
+BLI_INLINE void bicubic_interpolation_float4_simd(
+    const float *src_buffer, float *output, int width, int height, float u, float v)
+{
+  const float uf = floorf(u);
+  const float vf = floorf(v);
+  const int iu = int(uf);
+  const int iv = int(vf);
+
+  /* Calculate pixel weights. */
+  const float4 wx = cubic_filter_coefficients<filter>(u - uf);
+  const float4 wy = cubic_filter_coefficients<filter>(v - vf);
+
+  /* Pixel offsets of the four columns, they are the same for every row. */
+  int64_t x_offsets[4];
+  for (int m = 0; m < 4; m++) {
+    x_offsets[m] = int64_t(clamp(iu + m - 1, 0, width - 1)) * 4;
+  }
+
+  /* Read 4x4 source pixels and blend them, first horizontally within each row and then the
+   * rows vertically. */
+  __m128 out = _mm_setzero_ps();
+  for (int n = 0; n < 4; n++) {
+    const int y1 = clamp(iv + n - 1, 0, height - 1);
+    const float *row = src_buffer + int64_t(width) * y1 * 4;
+
+    __m128 row_sum = _mm_setzero_ps();
+    for (int m = 0; m < 4; m++) {
+      const __m128 sample = _mm_loadu_ps(row + x_offsets[m]);
+      row_sum = _mm_add_ps(row_sum, _mm_mul_ps(sample, _mm_set1_ps(wx[m])));
+    }
+    out = _mm_add_ps(out, _mm_mul_ps(row_sum, _mm_set1_ps(wy[n])));
+  }
+
+  /* Mitchell filter has negative lobes; prevent output from going out of range. */
+  if constexpr (filter == eCubicFilter::Mitchell) {
+    out = _mm_max_ps(out, _mm_setzero_ps());
+  }
+  _mm_storeu_ps(output, out);
+}
+#endif /* BLI_HAVE_SSE2 */
+
 template<typename T, eCubicFilter filter>
 BLI_INLINE void bicubic_interpolation(const T *src_buffer,
                                       T *output,
@@ -131,6 +174,14 @@ BLI_INLINE void bicubic_interpolation(const T *src_buffer,
     }
   }
 #endif
+#if BLI_HAVE_SSE2
+  if constexpr (std::is_same_v<T, float>) {
+    if (components == 4 && wrap_u == InterpWrapMode::Extend && wrap_v == InterpWrapMode::Extend) {
+      bicubic_interpolation_float4_simd<filter>(src_buffer, output, width, height, u, v);
+      return;
+    }
+  }
+#endif
 
   float4 out{0.0f};
 
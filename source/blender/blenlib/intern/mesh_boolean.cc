@@ -897,9 +897,6 @@ static int sort_tris_class(const Face &tri, const Face &tri0, const Edge e)
   if (dbg_level > 0) {
     std::cout << "classify  e = " << e << "\n";
   }
-  mpq3 a0 = tri0[0]->co_exact;
-  mpq3 a1 = tri0[1]->co_exact;
-  mpq3 a2 = tri0[2]->co_exact;
   bool rev;
   bool rev0;
   const Vert *flapv0 = find_flap_vert(tri0, e, &rev0);
@@ -911,9 +908,19 @@ static int sort_tris_class(const Face &tri, const Face &tri0, const Edge e)
     std::cout << " rev = " << rev << " flapv = " << flapv << "\n";
   }
   BLI_assert(flapv != nullptr && flapv0 != nullptr);
-  const mpq3 flap = flapv->co_exact;
-  /* orient will be positive if flap is below oriented plane of a0,a1,a2. */
-  int orient = orient3d(a0, a1, a2, flap);
+  /* orient will be positive if flap is below oriented plane of tri0.
+   * The double version of the predicate is exact as well (it uses adaptive precision), so it can
+   * be used whenever the double coordinates are not rounded, which is the common case of
+   * triangles that are not the result of an intersection. */
+  int orient;
+  if (tri0[0]->co_is_exact && tri0[1]->co_is_exact && tri0[2]->co_is_exact && flapv->co_is_exact)
+  {
+    orient = orient3d(tri0[0]->co, tri0[1]->co, tri0[2]->co, flapv->co);
+  }
+  else {
+    orient = orient3d(
+        tri0[0]->co_exact, tri0[1]->co_exact, tri0[2]->co_exact, flapv->co_exact);
+  }
   int ans;
   if (orient > 0) {
     ans = rev0 ? 4 : 3;
@@ -60,7 +60,11 @@ static void dump_perfdata();
 static constexpr bool intersect_use_threading = true;
 
 Vert::Vert(const mpq3 &mco, const double3 &dco, int id, int orig)
-    : co_exact(mco), co(dco), id(id), orig(orig)
+    : co_exact(mco),
+      co(dco),
+      id(id),
+      orig(orig),
+      co_is_exact(mco.x == dco.x && mco.y == dco.y && mco.z == dco.z)
 {
 }
 
@@ -2937,10 +2941,15 @@ IMesh trimesh_nary_intersect(const IMesh &tm_in,
   std::cout << "subdivided non-cluster tris found, time = " << subdivided_tris_time - itt_time
             << "\n";
 #  endif
+  /* The clusters are independent, so their triangulations can be computed in parallel. The new
+   * faces are still extracted serially in #calc_cluster_tris to keep the result repeatable. */
   Array<CDT_data> cluster_subdivided(clinfo.tot_cluster());
-  for (int c : clinfo.index_range()) {
-    cluster_subdivided[c] = calc_cluster_subdivided(clinfo, c, *tm_clean, tri_ov, itt_map, arena);
-  }
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (int c : range) {
+      cluster_subdivided[c] = calc_cluster_subdivided(
+          clinfo, c, *tm_clean, tri_ov, itt_map, arena);
+    }
+  });
 #  ifdef PERFDEBUG
   double cluster_subdivide_time = BLI_time_now_seconds();
   std::cout << "subdivided clusters found, time = "
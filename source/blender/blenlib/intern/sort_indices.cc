@@ -0,0 +1,153 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#include "BLI_array.hh"
+#include "BLI_index_range.hh"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+
+namespace blender {
+
+/** Below this size, a comparison sort is faster than the radix sort passes. */
+static constexpr int64_t radix_sort_min_size = 4096;
+/** Size of the parts of the input that are counted and scattered by one task. */
+static constexpr int64_t radix_sort_chunk_size = 1 << 16;
+
+static constexpr int radix_digit_bits = 8;
+static constexpr int radix_digits_num = 1 << radix_digit_bits;
+static constexpr int radix_passes_num = 32 / radix_digit_bits;
+
+using DigitCounts = std::array<int, radix_digits_num>;
+
+/**
+ * Map floats to unsigned integers that have the same order. All bits of negative values are
+ * flipped, and only the sign bit of positive values.
+ */
+static uint32_t float_to_radix_key(const float value)
+{
+  /* Negative zero is mapped to positive zero, so that they compare equal. */
+  const uint32_t bits = std::bit_cast<uint32_t>(value == 0.0f ? 0.0f : value);
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+static int radix_digit(const uint32_t key, const int pass)
+{
+  return int((key >> (pass * radix_digit_bits)) & (radix_digits_num - 1));
+}
+
+void parallel_sort_indices_by_key(const Span<float> keys, MutableSpan<int> indices)
+{
+  const int64_t size = indices.size();
+  if (size < radix_sort_min_size) {
+    std::stable_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+      return keys[a] < keys[b];
+    });
+    return;
+  }
+
+  const int64_t chunks_num = (size + radix_sort_chunk_size - 1) / radix_sort_chunk_size;
+  const auto chunk_range = [&](const int64_t chunk) {
+    const int64_t start = chunk * radix_sort_chunk_size;
+    return IndexRange(start, std::min(radix_sort_chunk_size, size - start));
+  };
+
+  /* Gather the keys and count the digits of all passes at once. The counts of the first pass
+   * are used for scattering, the others to skip passes where all keys have the same digit. */
+  Array<uint32_t> keys_a(size, NoInitialization());
+  Array<uint32_t> keys_b(size, NoInitialization());
+  Array<std::array<DigitCounts, radix_passes_num>> all_chunk_counts(chunks_num);
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      std::array<DigitCounts, radix_passes_num> &counts = all_chunk_counts[chunk];
+      for (DigitCounts &pass_counts : counts) {
+        pass_counts.fill(0);
+      }
+      for (const int64_t i : chunk_range(chunk)) {
+        const uint32_t key = float_to_radix_key(keys[indices[i]]);
+        keys_a[i] = key;
+        for (int pass = 0; pass < radix_passes_num; pass++) {
+          counts[pass][radix_digit(key, pass)]++;
+        }
+      }
+    }
+  });
+
+  Array<int> indices_buffer(size, NoInitialization());
+  MutableSpan<uint32_t> src_keys = keys_a;
+  MutableSpan<uint32_t> dst_keys = keys_b;
+  MutableSpan<int> src_indices = indices;
+  MutableSpan<int> dst_indices = indices_buffer;
+
+  Array<DigitCounts> chunk_counts(chunks_num);
+  Array<DigitCounts> chunk_offsets(chunks_num);
+  bool is_reordered = false;
+  for (int pass = 0; pass < radix_passes_num; pass++) {
+    const int first_digit = radix_digit(src_keys.first(), pass);
+    int first_digit_count = 0;
+    for (const int64_t chunk : IndexRange(chunks_num)) {
+      first_digit_count += all_chunk_counts[chunk][pass][first_digit];
+    }
+    if (first_digit_count == size) {
+      /* All keys have the same digit, the pass would not change the order. */
+      continue;
+    }
+
+    if (is_reordered) {
+      /* The elements moved to other chunks in the previous pass, so count again. */
+      threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+        for (const int64_t chunk : range) {
+          chunk_counts[chunk].fill(0);
+          for (const int64_t i : chunk_range(chunk)) {
+            chunk_counts[chunk][radix_digit(src_keys[i], pass)]++;
+          }
+        }
+      });
+    }
+    else {
+      for (const int64_t chunk : IndexRange(chunks_num)) {
+        chunk_counts[chunk] = all_chunk_counts[chunk][pass];
+      }
+    }
+
+    /* Elements of earlier chunks come first within each digit, which keeps the sort stable. */
+    int offset = 0;
+    for (const int digit : IndexRange(radix_digits_num)) {
+      for (const int64_t chunk : IndexRange(chunks_num)) {
+        chunk_offsets[chunk][digit] = offset;
+        offset += chunk_counts[chunk][digit];
+      }
+    }
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        DigitCounts &offsets = chunk_offsets[chunk];
+        for (const int64_t i : chunk_range(chunk)) {
+          const int dst = offsets[radix_digit(src_keys[i], pass)]++;
+          dst_keys[dst] = src_keys[i];
+          dst_indices[dst] = src_indices[i];
+        }
+      }
+    });
+
+    std::swap(src_keys, dst_keys);
+    std::swap(src_indices, dst_indices);
+    is_reordered = true;
+  }
+
+  if (src_indices.data() != indices.data()) {
+    threading::parallel_for(indices.index_range(), 8192, [&](const IndexRange range) {
+      indices.slice(range).copy_from(src_indices.slice(range));
+    });
+  }
+}
+
+}  // namespace blender
@@ -20,6 +20,7 @@
 #include "BLI_assert.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_vector.hh"
 
@@ -130,9 +131,8 @@ class TBBTaskGroup : public tbb::task_group {
   TBBTaskGroup(eTaskPriority priority)
   {
 #  if TBB_INTERFACE_VERSION_MAJOR >= 12
-    /* TODO: support priorities in TBB 2021, where they are only available as
-     * part of task arenas, no longer for task groups. Or remove support for
-     * task priorities if they are no longer useful. */
+    /* In TBB 2021 priorities are only available as part of task arenas, no longer for task
+     * groups. Those are handled by #TaskPool::tbb_execute_with_priority. */
     UNUSED_VARS(priority);
 #  else
     switch (priority) {
@@ -331,6 +331,7 @@ struct TaskPool {
    * initialize data structures and create tasks in a single pass. */
   void tbb_task_pool_run(Task &&task);
   void tbb_task_pool_work_and_wait();
+  template<typename Function> void tbb_execute_with_priority(const Function &function);
   void tbb_task_pool_cancel();
   bool tbb_task_pool_canceled();
 
@@ -344,6 +345,18 @@ struct TaskPool {
   static void *background_task_run(void *userdata);
 };
 
+/**
+ * Tasks have to be spawned and waited for in the same task arena, which is chosen based on the
+ * priority of the pool.
+ */
+template<typename Function> void TaskPool::tbb_execute_with_priority(const Function &function)
+{
+  threading::execute_with_priority(this->priority == TASK_PRIORITY_LOW ?
+                                       threading::TaskPriority::Background :
+                                       threading::TaskPriority::Interactive,
+                                   function);
+}
+
 void TaskPool::tbb_task_pool_run(Task &&task)
 {
   BLI_assert(ELEM(this->type, TASK_POOL_TBB, TASK_POOL_TBB_SUSPENDED, TASK_POOL_NO_THREADS));
@@ -367,7 +380,7 @@ void TaskPool::tbb_task_pool_run(Task &&task)
 #ifdef WITH_TBB
   else if (this->use_threads) {
     /* Execute in TBB task group. */
-    this->tbb_group->run(std::move(task));
+    this->tbb_execute_with_priority([&]() { this->tbb_group->run(std::move(task)); });
   }
 #endif
   else {
@@ -395,7 +408,7 @@ void TaskPool::tbb_task_pool_work_and_wait()
     /* This is called wait(), but internally it can actually do work. This
      * matters because we don't want recursive usage of task pools to run
      * out of threads and get stuck. */
-    this->tbb_group->wait();
+    this->tbb_execute_with_priority([&]() { this->tbb_group->wait(); });
   }
 #endif
 }
@@ -406,7 +419,7 @@ void TaskPool::tbb_task_pool_cancel()
 #ifdef WITH_TBB
   if (this->use_threads) {
     this->tbb_group->cancel();
-    this->tbb_group->wait();
+    this->tbb_execute_with_priority([&]() { this->tbb_group->wait(); });
   }
 #endif
 }
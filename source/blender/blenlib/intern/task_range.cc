@@ -27,6 +27,12 @@
 #  include <tbb/enumerable_thread_specific.h>
 #  include <tbb/parallel_for.h>
 #  include <tbb/parallel_reduce.h>
+#  include <tbb/task_arena.h>
+#  include <tbb/task_group.h>
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+#    include <tbb/info.h>
+#    define WITH_TBB_NUMA
+#  endif
 #endif
 
 namespace blender {
@@ -316,5 +322,74 @@ void memory_bandwidth_bound_task_impl(const FunctionRef<void()> function)
 #endif
 }
 
+#ifdef WITH_TBB_NUMA
+/** One task arena per NUMA node, whose threads only run on the cores of that node. */
+static Span<std::unique_ptr<tbb::task_arena>> numa_arenas()
+{
+  static const Vector<std::unique_ptr<tbb::task_arena>> arenas = []() {
+    Vector<std::unique_ptr<tbb::task_arena>> arenas;
+    const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+    if (nodes.size() > 1) {
+      for (const tbb::numa_node_id node : nodes) {
+        arenas.append(std::make_unique<tbb::task_arena>(tbb::task_arena::constraints(node)));
+      }
+    }
+    return arenas;
+  }();
+  return arenas;
+}
+#endif
+
+void parallel_for_numa_impl(const IndexRange range,
+                            const int64_t grain_size,
+                            const FunctionRef<void(IndexRange)> function)
+{
+#ifdef WITH_TBB_NUMA
+  const Span<std::unique_ptr<tbb::task_arena>> arenas = numa_arenas();
+  if (arenas.is_empty()) {
+    parallel_for(range, grain_size, function);
+    return;
+  }
+
+  /* Make sure the lazy threading hints are send now, because they shouldn't be send out of an
+   * isolated region. */
+  lazy_threading::send_hint();
+  lazy_threading::ReceiverIsolation isolation;
+
+  /* Tasks have to be spawned and waited for in the arena of their node. Spawn the work on all
+   * nodes first, so that they run at the same time. */
+  const int64_t nodes_num = arenas.size();
+  Array<tbb::task_group> groups(nodes_num);
+  for (const int64_t node : arenas.index_range()) {
+    const IndexRange node_range = IndexRange::from_begin_end(
+        range.start() + range.size() * node / nodes_num,
+        range.start() + range.size() * (node + 1) / nodes_num);
+    arenas[node]->execute([&]() {
+      groups[node].run([node_range, grain_size, function]() {
+        parallel_for(node_range, grain_size, function);
+      });
+    });
+  }
+  for (const int64_t node : arenas.index_range()) {
+    arenas[node]->execute([&]() { groups[node].wait(); });
+  }
+#else
+  parallel_for(range, grain_size, function);
+#endif
+}
+
 }  // namespace threading::detail
+
+namespace threading {
+
+int numa_nodes_num()
+{
+#ifdef WITH_TBB_NUMA
+  return std::max<int>(detail::numa_arenas().size(), 1);
+#else
+  return 1;
+#endif
+}
+
+}  // namespace threading
 }  // namespace blender
@@ -10,8 +10,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_assert.h"
 #include "BLI_lazy_threading.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #ifdef WITH_TBB
@@ -22,6 +24,9 @@
 #    include <tbb/global_control.h>
 #    define WITH_TBB_GLOBAL_CONTROL
 #  endif
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+#    define WITH_TBB_ARENA_PRIORITY
+#  endif
 #endif
 
 namespace blender {
@@ -79,4 +84,30 @@ void BLI_task_isolate(void (*func)(void *userdata), void *userdata)
 #endif
 }
 
+namespace threading::detail {
+
+void execute_with_priority_impl(const TaskPriority priority, const FunctionRef<void()> function)
+{
+#ifdef WITH_TBB_ARENA_PRIORITY
+  BLI_assert(priority == TaskPriority::Background);
+  UNUSED_VARS_NDEBUG(priority);
+  /* TBB assigns worker threads to arenas with a higher priority first, so background tasks only
+   * use threads that are not needed by the (normal priority) default arena. One slot is reserved
+   * for the calling thread, so that it can always work on its own tasks. */
+  static tbb::task_arena arena{tbb::task_arena::automatic, 1, tbb::task_arena::priority::low};
+
+  /* Make sure the lazy threading hints are send now, because they shouldn't be send out of an
+   * isolated region. */
+  lazy_threading::send_hint();
+  lazy_threading::ReceiverIsolation isolation;
+
+  arena.execute(function);
+#else
+  UNUSED_VARS(priority);
+  function();
+#endif
+}
+
+}  // namespace threading::detail
+
 }  // namespace blender
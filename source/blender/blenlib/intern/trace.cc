@@ -0,0 +1,191 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_trace.hh"
+#include "BLI_vector.hh"
+
+namespace blender::trace {
+
+namespace detail {
+std::atomic<bool> enabled = false;
+}
+
+namespace {
+
+struct Zone {
+  const char *name;
+  int64_t begin_ns;
+  int64_t end_ns;
+};
+
+struct ThreadBuffer {
+  /** Only contended while the zones are read or cleared. */
+  std::mutex mutex;
+  Array<Zone> zones;
+  /** Total number of zones recorded, the next zone is written at `recorded % size`. */
+  int64_t recorded = 0;
+  int thread_index;
+
+  ThreadBuffer(const int thread_index)
+      : zones(thread_buffer_size, NoInitialization()), thread_index(thread_index)
+  {
+  }
+
+  int64_t size() const
+  {
+    return std::min(recorded, thread_buffer_size);
+  }
+};
+
+struct Registry {
+  std::mutex mutex;
+  /** Buffers are kept alive after their thread exits, so their zones can still be written. */
+  Vector<std::unique_ptr<ThreadBuffer>> buffers;
+  std::string output_filepath;
+};
+
+}  // namespace
+
+static Registry &get_registry()
+{
+  static Registry registry;
+  return registry;
+}
+
+static ThreadBuffer &get_thread_buffer()
+{
+  thread_local ThreadBuffer *buffer = [] {
+    Registry &registry = get_registry();
+    std::lock_guard lock{registry.mutex};
+    registry.buffers.append(std::make_unique<ThreadBuffer>(int(registry.buffers.size())));
+    return registry.buffers.last().get();
+  }();
+  return *buffer;
+}
+
+int64_t detail::now_ns()
+{
+  static const std::chrono::steady_clock::time_point start_time =
+      std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              start_time)
+      .count();
+}
+
+void detail::record_zone(const char *name, const int64_t begin_ns, const int64_t end_ns)
+{
+  ThreadBuffer &buffer = get_thread_buffer();
+  std::lock_guard lock{buffer.mutex};
+  buffer.zones[buffer.recorded % thread_buffer_size] = {name, begin_ns, end_ns};
+  buffer.recorded++;
+}
+
+void set_enabled(const bool enabled)
+{
+  if (enabled) {
+    /* Initialize the start time, so that the first zone does not include it. */
+    detail::now_ns();
+  }
+  detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void clear()
+{
+  Registry &registry = get_registry();
+  std::lock_guard lock{registry.mutex};
+  for (std::unique_ptr<ThreadBuffer> &buffer : registry.buffers) {
+    std::lock_guard buffer_lock{buffer->mutex};
+    buffer->recorded = 0;
+  }
+}
+
+int64_t recorded_zones_num()
+{
+  Registry &registry = get_registry();
+  std::lock_guard lock{registry.mutex};
+  int64_t num = 0;
+  for (std::unique_ptr<ThreadBuffer> &buffer : registry.buffers) {
+    std::lock_guard buffer_lock{buffer->mutex};
+    num += buffer->size();
+  }
+  return num;
+}
+
+void write_chrome_json(FILE *file)
+{
+  Registry &registry = get_registry();
+  std::lock_guard lock{registry.mutex};
+
+  fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  bool is_first = true;
+  for (std::unique_ptr<ThreadBuffer> &buffer : registry.buffers) {
+    /* Copy the zones, so that the thread is not blocked while writing the file. */
+    Vector<Zone> zones;
+    {
+      std::lock_guard buffer_lock{buffer->mutex};
+      const int64_t size = buffer->size();
+      const int64_t first = buffer->recorded - size;
+      zones.reserve(size);
+      for (int64_t i = first; i < buffer->recorded; i++) {
+        zones.append(buffer->zones[i % thread_buffer_size]);
+      }
+    }
+    for (const Zone &zone : zones) {
+      fprintf(file,
+              "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, \"ts\": %.3f, "
+              "\"dur\": %.3f}",
+              is_first ? "" : ",\n",
+              zone.name,
+              buffer->thread_index,
+              zone.begin_ns / 1000.0,
+              (zone.end_ns - zone.begin_ns) / 1000.0);
+      is_first = false;
+    }
+  }
+  fprintf(file, "\n]}\n");
+}
+
+void set_output_filepath(const char *filepath)
+{
+  Registry &registry = get_registry();
+  {
+    std::lock_guard lock{registry.mutex};
+    registry.output_filepath = filepath;
+  }
+  set_enabled(true);
+}
+
+void write_output_file()
+{
+  std::string filepath;
+  {
+    Registry &registry = get_registry();
+    std::lock_guard lock{registry.mutex};
+    filepath = registry.output_filepath;
+  }
+  if (filepath.empty()) {
+    return;
+  }
+  FILE *file = BLI_fopen(filepath.c_str(), "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Unable to write trace to '%s'\n", filepath.c_str());
+    return;
+  }
+  write_chrome_json(file);
+  fclose(file);
+}
+
+}  // namespace blender::trace
@@ -807,6 +807,40 @@ TEST(array_store, TestChunk_Rand31_Stride11_Chunk21)
   random_chunk_mutate_helper(31, 100, 11, 21, 7117);
 }
 
+/* Large enough to hash the array in parallel. */
+TEST(array_store, LargeShifted)
+{
+  const size_t values_num = 1000000;
+  RNG *rng = BLI_rng_new(1);
+  uint32_t *data_a = MEM_new_array_uninitialized<uint32_t>(values_num, __func__);
+  uint32_t *data_b = MEM_new_array_uninitialized<uint32_t>(values_num, __func__);
+  for (size_t i = 0; i < values_num; i++) {
+    data_a[i] = BLI_rng_get_uint(rng);
+  }
+  /* Insert a value at the start, so no chunks are aligned with the first state. */
+  data_b[0] = 0;
+  memcpy(data_b + 1, data_a, (values_num - 1) * sizeof(uint32_t));
+  BLI_rng_free(rng);
+
+  BArrayStore *bs = BLI_array_store_create(sizeof(uint32_t), 32);
+  const size_t data_len = values_num * sizeof(uint32_t);
+  BArrayState *state_a = BLI_array_store_state_add(bs, data_a, data_len, nullptr);
+  BArrayState *state_b = BLI_array_store_state_add(bs, data_b, data_len, state_a);
+  EXPECT_TRUE(BLI_array_store_is_valid(bs));
+  /* Nearly all chunks of the second state are shared with the first one. */
+  EXPECT_LT(BLI_array_store_calc_size_compacted_get(bs), data_len + data_len / 10);
+
+  size_t data_dst_len;
+  void *data_dst = BLI_array_store_state_data_get_alloc(state_b, &data_dst_len);
+  EXPECT_EQ(data_dst_len, data_len);
+  EXPECT_EQ(memcmp(data_dst, data_b, data_len), 0);
+
+  MEM_delete_void(data_dst);
+  MEM_delete(data_a);
+  MEM_delete(data_b);
+  BLI_array_store_destroy(bs);
+}
+
 /* -------------------------------------------------------------------- */
 /** \name RLE Encode/Decode Utilities
  * \{ */
@@ -415,6 +415,27 @@ TEST(bit_span, or_bools_into_bits)
   }
 }
 
+TEST(bit_span, or_bools_into_bits_unaligned)
+{
+  Vector<bool> bools(1000);
+  for (const int64_t i : bools.index_range()) {
+    bools[i] = (i * 7) % 5 < 2;
+  }
+  for (const int64_t offset : {0, 1, 13, 63, 64, 100}) {
+    for (const int64_t size : {0, 15, 64, 65, 200, 900}) {
+      BitVector<> bits(1000 + offset, false);
+      const bool any_true = bits::or_bools_into_bits(
+          bools.as_span().take_front(size),
+          MutableBitSpan(bits).slice(IndexRange::from_begin_size(offset, size)));
+      EXPECT_EQ(any_true, size > 0);
+      for (const int64_t i : bits.index_range()) {
+        const bool expected = i >= offset && i < offset + size && bools[i - offset];
+        EXPECT_EQ(bits[i].test(), expected);
+      }
+    }
+  }
+}
+
 TEST(bit_span, to_index_ranges_small)
 {
   BitVector<> bits(10, false);
@@ -256,6 +256,31 @@ TEST(csv_parse, ParseCsvTrailingNewline)
   EXPECT_EQ(result.records[1][0], "2");
 }
 
+TEST(csv_parse, ParseCsvRecordsWithoutHeader)
+{
+  CsvParseOptions options;
+  options.chunk_size_bytes = 1;
+  const StringRef str = "1,2\n3\n";
+  const std::optional<Vector<Vector<std::string>>> chunks =
+      parse_csv_records_in_chunks<Vector<std::string>>(
+          Span<char>(str), options, [&](const CsvRecords &records) {
+            Vector<std::string> fields;
+            for (const int64_t record_i : records.index_range()) {
+              const CsvRecord record = records.record(record_i);
+              for (const int64_t column_i : record.index_range()) {
+                fields.append(record.field_str(column_i));
+              }
+            }
+            return fields;
+          });
+  EXPECT_TRUE(chunks.has_value());
+  Vector<std::string> fields;
+  for (const Vector<std::string> &chunk : *chunks) {
+    fields.extend(chunk);
+  }
+  EXPECT_EQ(fields, Vector<std::string>({"1", "2", "3"}));
+}
+
 TEST(csv_parse, UnescapeField)
 {
   LinearAllocator<> allocator;
@@ -161,6 +161,27 @@ TEST(index_mask, FromBitsAlternating)
   EXPECT_EQ(mask[3], 6);
 }
 
+TEST(index_mask, FromBoolsInverse)
+{
+  Vector<bool> bools(100'000, true);
+  bools[3] = false;
+  bools[4] = false;
+  bools[70'000] = false;
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_bools_inverse(bools, memory);
+  EXPECT_EQ(mask.size(), 3);
+  EXPECT_EQ(mask[0], 3);
+  EXPECT_EQ(mask[1], 4);
+  EXPECT_EQ(mask[2], 70'000);
+
+  const IndexMask universe = IndexMask::from_indices<int>({0, 4, 5, 70'000, 99'999}, memory);
+  const IndexMask mask_in_universe = IndexMask::from_bools_inverse(universe, bools, memory);
+  EXPECT_EQ(mask_in_universe.size(), 2);
+  EXPECT_EQ(mask_in_universe[0], 4);
+  EXPECT_EQ(mask_in_universe[1], 70'000);
+}
+
 /* The benchmark is too slow to run during normal test runs. */
 #if 0
 
@@ -235,6 +256,24 @@ TEST(index_mask, FromBitsBenchmark)
   }
 }
 
+TEST(index_mask, FromBoolsBenchmark)
+{
+  const int size = 100'000'000;
+  RandomNumberGenerator rng(0);
+  Array<bool> bools(size);
+  for (const float probability : {0.001f, 0.5f, 0.999f}) {
+    for (bool &value : bools) {
+      value = rng.get_float() < probability;
+    }
+    for ([[maybe_unused]] const int64_t i : IndexRange(3)) {
+      IndexMaskMemory memory;
+      SCOPED_TIMER(fmt::format("From bools, probability {}", probability));
+      const IndexMask mask = IndexMask::from_bools(bools, memory);
+      EXPECT_GT(mask.size(), 0);
+    }
+  }
+}
+
 /* Benchmark. */
 #endif
 
@@ -8,6 +8,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_compiler_attrs.h"
 #include "BLI_kdopbvh.hh"
 #include "BLI_math_vector.h"
@@ -137,4 +138,77 @@ TEST(kdopbvh, OptimalFindNearest_500)
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
 
+static BVHTree *create_random_points_tree(const int points_len, const float epsilon, RNG *rng)
+{
+  BVHTree *tree = BLI_bvhtree_new(points_len, epsilon, 4, 6);
+  for (int i = 0; i < points_len; i++) {
+    float co[3];
+    rng_v3_round(co, 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, co, 1);
+  }
+  BLI_bvhtree_balance(tree);
+  return tree;
+}
+
+TEST(kdopbvh, FindNearestBatch)
+{
+  RNG *rng = BLI_rng_new(42);
+  BVHTree *tree = create_random_points_tree(500, 0.0f, rng);
+
+  const int queries_num = 2000;
+  Array<float3> positions(queries_num);
+  rng_v3_round(&positions.data()->x, queries_num * 3, rng, 1000, 1.5f);
+  Array<BVHTreeNearest> nearest(queries_num);
+  for (BVHTreeNearest &item : nearest) {
+    item.index = -1;
+    item.dist_sq = FLT_MAX;
+  }
+  BLI_bvhtree_find_nearest_batch(*tree, positions, nearest, nullptr, nullptr);
+
+  for (int i = 0; i < queries_num; i++) {
+    BVHTreeNearest expected;
+    expected.index = -1;
+    expected.dist_sq = FLT_MAX;
+    BLI_bvhtree_find_nearest(tree, positions[i], &expected, nullptr, nullptr);
+    EXPECT_NE(nearest[i].index, -1);
+    EXPECT_EQ(nearest[i].dist_sq, expected.dist_sq);
+  }
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+}
+
+TEST(kdopbvh, RayCastBatch)
+{
+  RNG *rng = BLI_rng_new(42);
+  BVHTree *tree = create_random_points_tree(500, 0.05f, rng);
+
+  const int rays_num = 2000;
+  Array<float3> origins(rays_num);
+  rng_v3_round(&origins.data()->x, rays_num * 3, rng, 1000, 1.0f);
+  for (float3 &origin : origins) {
+    origin.z = 2.0f;
+  }
+  const Array<float3> directions(rays_num, float3(0.0f, 0.0f, -1.0f));
+  Array<BVHTreeRayHit> hits(rays_num);
+  for (BVHTreeRayHit &hit : hits) {
+    hit.index = -1;
+    hit.dist = BVH_RAYCAST_DIST_MAX;
+  }
+  BLI_bvhtree_ray_cast_batch(*tree, origins, directions, 0.0f, hits, nullptr, nullptr);
+
+  int hits_num = 0;
+  for (int i = 0; i < rays_num; i++) {
+    BVHTreeRayHit expected;
+    expected.index = -1;
+    expected.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast(tree, origins[i], directions[i], 0.0f, &expected, nullptr, nullptr);
+    EXPECT_EQ(hits[i].index == -1, expected.index == -1);
+    EXPECT_EQ(hits[i].dist, expected.dist);
+    hits_num += (expected.index != -1);
+  }
+  EXPECT_GT(hits_num, 0);
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+}
+
 }  // namespace blender
@@ -4,6 +4,7 @@
 
 #include "testing/testing.h"
 
+#include "BLI_array.hh"
 #include "BLI_kdtree.hh"
 
 #include <cmath>
@@ -66,4 +67,27 @@ TEST(kdtree, Deduplicate)
   deduplicate_test();
 }
 
+TEST(kdtree, FindNearestBatch)
+{
+  const int points_num = 1000;
+  KDTree_3d *tree = kdtree_3d_new(points_num);
+  for (int i = 0; i < points_num; i++) {
+    kdtree_3d_insert(tree, i, float3(fmodf(i * 7.121f, 1.0f), fmodf(i * 3.17f, 1.0f), 0.0f));
+  }
+  kdtree_3d_balance(tree);
+
+  Array<float3> positions(points_num);
+  for (int i = 0; i < points_num; i++) {
+    positions[i] = float3(fmodf(i * 1.37f, 1.0f), fmodf(i * 5.3f, 1.0f), 0.5f);
+  }
+  Array<KDTreeNearest_3d> nearest(points_num);
+  kdtree_3d_find_nearest_batch(tree, positions, nearest);
+  for (int i = 0; i < points_num; i++) {
+    KDTreeNearest_3d expected;
+    EXPECT_EQ(kdtree_3d_find_nearest(tree, positions[i], &expected), nearest[i].index);
+    EXPECT_EQ(expected.dist, nearest[i].dist);
+  }
+  kdtree_3d_free(tree);
+}
+
 }  // namespace blender
@@ -814,6 +814,41 @@ TEST(map, PointerKeyCustomEq)
   EXPECT_FALSE(map.remove(&key2));
 }
 
+/** All keys start probing at the same slot, but their hashes are still different. */
+struct ShiftedIntHash {
+  uint64_t operator()(const int key) const
+  {
+    return uint64_t(key) << 20;
+  }
+};
+
+struct CountingIntEq {
+  static inline int calls_num = 0;
+
+  bool operator()(const int a, const int b) const
+  {
+    calls_num++;
+    return a == b;
+  }
+};
+
+TEST(map, SkipKeysWithDifferentTag)
+{
+  Map<int, int, 0, DefaultProbingStrategy, ShiftedIntHash, CountingIntEq> map;
+  for (const int i : IndexRange(1000)) {
+    map.add_new(i, i);
+  }
+  CountingIntEq::calls_num = 0;
+  for (const int i : IndexRange(1000)) {
+    EXPECT_EQ(map.lookup(i), i);
+  }
+  for (const int i : IndexRange(1000, 1000)) {
+    EXPECT_FALSE(map.contains(i));
+  }
+  /* Most keys with a different hash are skipped without comparing them. */
+  EXPECT_LT(CountingIntEq::calls_num, 1200);
+}
+
 /**
  * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
  */
@@ -986,6 +1021,50 @@ TEST(map, Benchmark)
  * Count: 1889920
  */
 
+template<typename MapT>
+BLI_NOINLINE void benchmark_string_keys(StringRef name, const int amount)
+{
+  Vector<std::string> keys;
+  Vector<std::string> missing_keys;
+  for (const int i : IndexRange(amount)) {
+    keys.append("Object." + std::to_string(i));
+    missing_keys.append("Object." + std::to_string(i + amount));
+  }
+
+  MapT map;
+  {
+    SCOPED_TIMER(name + " Add");
+    for (const int i : keys.index_range()) {
+      map.add(keys[i], i);
+    }
+  }
+  int count = 0;
+  {
+    SCOPED_TIMER(name + " Lookup");
+    for (const std::string &key : keys) {
+      count += map.lookup(key);
+    }
+  }
+  {
+    SCOPED_TIMER(name + " Contains Missing");
+    for (const std::string &key : missing_keys) {
+      count += map.contains(key);
+    }
+  }
+
+  /* Print the value for simple error checking and to avoid some compiler optimizations. */
+  std::cout << "Count: " << count << "\n";
+}
+
+TEST(map, BenchmarkStringKeys)
+{
+  for (const int amount : {100, 10000, 1000000}) {
+    std::cout << amount << " keys:\n";
+    benchmark_string_keys<Map<std::string, int>>("Map          ", amount);
+    benchmark_string_keys<StdUnorderedMapWrapper<std::string, int>>("std::unordered_map", amount);
+  }
+}
+
 #endif /* Benchmark */
 
 }  // namespace blender::tests
@@ -0,0 +1,50 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BLI_array.hh"
+#include "BLI_noise.hh"
+#include "BLI_rand.hh"
+
+#include "testing/testing.h"
+
+namespace blender::noise::tests {
+
+static Array<float3> random_positions(const int64_t size, const float range)
+{
+  RandomNumberGenerator rng(0);
+  Array<float3> positions(size);
+  for (float3 &position : positions) {
+    position = (float3(rng.get_float(), rng.get_float(), rng.get_float()) * 2.0f - 1.0f) * range;
+  }
+  return positions;
+}
+
+TEST(noise, PerlinSignedBatchMatchesSingle)
+{
+  /* Use a size that is not a multiple of the SIMD width and include far away positions. */
+  Array<float3> positions = random_positions(1001, 100.0f);
+  positions[10] = float3(2000000.5f, -3000000.25f, 12.0f);
+  positions[11] = float3(-150000.0f, 99999.9f, -0.0f);
+  Array<float> values(positions.size());
+  perlin_signed(positions, values);
+  for (const int64_t i : positions.index_range()) {
+    EXPECT_NEAR(values[i], perlin_signed(positions[i]), 1e-6f);
+  }
+}
+
+TEST(noise, PerlinFbmBatchMatchesSingle)
+{
+  const Array<float3> positions = random_positions(1001, 10.0f);
+  Array<float> values(positions.size());
+  for (const float detail : {0.0f, 2.0f, 4.5f}) {
+    for (const bool normalize : {false, true}) {
+      perlin_fbm(positions, detail, 0.5f, 2.0f, normalize, values);
+      for (const int64_t i : positions.index_range()) {
+        EXPECT_NEAR(values[i], perlin_fbm(positions[i], detail, 0.5f, 2.0f, normalize), 1e-6f);
+      }
+    }
+  }
+}
+
+}  // namespace blender::noise::tests
@@ -0,0 +1,91 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <algorithm>
+#include <limits>
+
+#include "BLI_array.hh"
+#include "BLI_array_utils.hh"
+#include "BLI_rand.hh"
+#include "BLI_sort.hh"
+#include "BLI_timeit.hh"
+
+#include "testing/testing.h"
+
+namespace blender::tests {
+
+static Array<int> sort_indices_by_key_reference(const Span<float> keys, const Span<int> indices)
+{
+  Array<int> sorted(indices);
+  std::stable_sort(sorted.begin(), sorted.end(), [&](const int a, const int b) {
+    return keys[a] < keys[b];
+  });
+  return sorted;
+}
+
+static void test_sort_indices_by_key(const Span<float> keys)
+{
+  Array<int> indices(keys.size());
+  array_utils::fill_index_range<int>(indices);
+  /* Use an order that is not sorted by index already, to check that the sort is stable. */
+  std::reverse(indices.begin(), indices.end());
+  const Array<int> expected = sort_indices_by_key_reference(keys, indices);
+  parallel_sort_indices_by_key(keys, indices);
+  EXPECT_EQ_SPAN<int>(expected, indices);
+}
+
+TEST(sort, SortIndicesByKeySmall)
+{
+  const Array<float> keys = {3.0f, -1.0f, 0.0f, -0.0f, 2.5f, -1.0f, 100.0f};
+  test_sort_indices_by_key(keys);
+}
+
+TEST(sort, SortIndicesByKeyLarge)
+{
+  RandomNumberGenerator rng(0);
+  Array<float> keys(300'000);
+  for (float &key : keys) {
+    key = (rng.get_float() - 0.5f) * 1000.0f;
+  }
+  keys[5] = 0.0f;
+  keys[6] = -0.0f;
+  keys[7] = std::numeric_limits<float>::infinity();
+  keys[8] = -std::numeric_limits<float>::infinity();
+  test_sort_indices_by_key(keys);
+}
+
+TEST(sort, SortIndicesByKeyFewDistinct)
+{
+  /* Many equal keys, and passes that can be skipped because all keys share a digit. */
+  Array<float> keys(100'000);
+  for (const int64_t i : keys.index_range()) {
+    keys[i] = float(i % 7);
+  }
+  test_sort_indices_by_key(keys);
+}
+
+/* Compares the radix sort with a comparison sort. Disabled by default because of its run-time. */
+TEST(sort, DISABLED_SortIndicesByKeyBenchmark)
+{
+  RandomNumberGenerator rng(0);
+  Array<float> keys(10'000'000);
+  for (float &key : keys) {
+    key = rng.get_float();
+  }
+  Array<int> indices(keys.size());
+  array_utils::fill_index_range<int>(indices);
+  {
+    SCOPED_TIMER("Comparison sort");
+    parallel_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+      return keys[a] < keys[b];
+    });
+  }
+  array_utils::fill_index_range<int>(indices);
+  {
+    SCOPED_TIMER("Radix sort");
+    parallel_sort_indices_by_key(keys, indices);
+  }
+}
+
+}  // namespace blender::tests
@@ -10,6 +10,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
@@ -246,4 +247,57 @@ TEST(task, ParallelInvoke)
   EXPECT_EQ(counter, 6);
 }
 
+
+TEST(task, ExecuteWithBackgroundPriority)
+{
+  std::atomic<int> counter = 0;
+  threading::execute_with_priority(threading::TaskPriority::Background, [&]() {
+    threading::parallel_for(IndexRange(1000), 10, [&](const IndexRange range) {
+      /* Interactive work started from a background task still runs. */
+      threading::execute_with_priority(threading::TaskPriority::Interactive,
+                                       [&]() { counter += int(range.size()); });
+    });
+  });
+  EXPECT_EQ(counter, 1000);
+}
+
+TEST(task, ParallelForNuma)
+{
+  Array<std::atomic<int>> counts(10000);
+  for (std::atomic<int> &count : counts) {
+    count = 0;
+  }
+  threading::parallel_for_numa(counts.index_range(), 100, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      counts[i]++;
+    }
+  });
+  for (const std::atomic<int> &count : counts) {
+    EXPECT_EQ(count, 1);
+  }
+  EXPECT_GE(threading::numa_nodes_num(), 1);
+}
+
+static void task_pool_count_func(TaskPool *__restrict pool, void * /*taskdata*/)
+{
+  std::atomic<int> *counter = static_cast<std::atomic<int> *>(BLI_task_pool_user_data(pool));
+  (*counter)++;
+}
+
+TEST(task, LowPriorityPool)
+{
+  BLI_threadapi_init();
+  BLI_task_scheduler_init(); /* Without this, no parallelism. */
+  std::atomic<int> counter = 0;
+  TaskPool *pool = BLI_task_pool_create(&counter, TASK_PRIORITY_LOW);
+  for (int i = 0; i < 100; i++) {
+    BLI_task_pool_push(pool, task_pool_count_func, nullptr, false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(pool);
+  EXPECT_EQ(counter, 100);
+  BLI_task_pool_free(pool);
+  BLI_task_scheduler_exit();
+  BLI_threadapi_exit();
+}
+
 }  // namespace blender
@@ -0,0 +1,106 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "BLI_index_range.hh"
+#include "BLI_timeit.hh"
+#include "BLI_trace.hh"
+
+#include "testing/testing.h"
+
+namespace blender::trace::tests {
+
+TEST(trace, DisabledDoesNotRecord)
+{
+  set_enabled(false);
+  clear();
+  {
+    TRACE_ZONE("Disabled");
+  }
+  EXPECT_EQ(recorded_zones_num(), 0);
+}
+
+TEST(trace, RecordAndClear)
+{
+  set_enabled(true);
+  clear();
+  for ([[maybe_unused]] const int i : IndexRange(10)) {
+    TRACE_ZONE("Zone");
+  }
+  EXPECT_EQ(recorded_zones_num(), 10);
+  clear();
+  EXPECT_EQ(recorded_zones_num(), 0);
+  set_enabled(false);
+}
+
+TEST(trace, RingBufferOverwritesOldZones)
+{
+  set_enabled(true);
+  clear();
+  for ([[maybe_unused]] const int64_t i : IndexRange(thread_buffer_size + 100)) {
+    TRACE_ZONE("Zone");
+  }
+  EXPECT_EQ(recorded_zones_num(), thread_buffer_size);
+  clear();
+  set_enabled(false);
+}
+
+TEST(trace, MultipleThreads)
+{
+  set_enabled(true);
+  clear();
+  std::thread thread([]() {
+    for ([[maybe_unused]] const int i : IndexRange(5)) {
+      TRACE_ZONE("Other Thread");
+    }
+  });
+  thread.join();
+  {
+    TRACE_ZONE("Main Thread");
+  }
+  /* Zones of threads that exited are kept. */
+  EXPECT_EQ(recorded_zones_num(), 6);
+  clear();
+  set_enabled(false);
+}
+
+TEST(trace, WriteChromeJson)
+{
+  set_enabled(true);
+  clear();
+  {
+    TRACE_ZONE("Written Zone");
+  }
+  FILE *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  write_chrome_json(file);
+  char buffer[1024] = {0};
+  std::rewind(file);
+  std::fread(buffer, 1, sizeof(buffer) - 1, file);
+  std::fclose(file);
+  EXPECT_NE(strstr(buffer, "\"traceEvents\""), nullptr);
+  EXPECT_NE(strstr(buffer, "\"name\": \"Written Zone\""), nullptr);
+  clear();
+  set_enabled(false);
+}
+
+/* Measures the overhead of zones, which should stay small enough to use them in hot loops.
+ * Disabled by default because of its run-time. */
+TEST(trace, DISABLED_Benchmark)
+{
+  for (const bool enabled : {false, true}) {
+    set_enabled(enabled);
+    SCOPED_TIMER(enabled ? "Enabled zones" : "Disabled zones");
+    for ([[maybe_unused]] const int i : IndexRange(10'000'000)) {
+      TRACE_ZONE("Benchmark");
+    }
+  }
+  clear();
+  set_enabled(false);
+}
+
+}  // namespace blender::trace::tests
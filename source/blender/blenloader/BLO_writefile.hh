@@ -13,6 +13,7 @@
 
 namespace blender {
 
+struct BlendFileMemoryWrite;
 struct BlendThumbnail;
 struct Main;
 struct MemFile;
@@ -58,6 +59,29 @@ extern bool BLO_write_file(Main *mainvar,
                            const BlendFileWriteParams *params,
                            ReportList *reports);
 
+/**
+ * Serialize `mainvar` into memory, so that the (potentially slow) write to `filepath` can be
+ * done later with #BLO_write_file_from_memory, e.g. from a background job.
+ *
+ * Path remapping and file versions are not supported by this path.
+ *
+ * \return The serialized file, or null on failure. Free with #BLO_write_file_memory_free.
+ */
+extern BlendFileMemoryWrite *BLO_write_file_to_memory(Main *mainvar,
+                                                      const char *filepath,
+                                                      int write_flags,
+                                                      const BlendFileWriteParams *params,
+                                                      ReportList *reports);
+/**
+ * Write data serialized by #BLO_write_file_to_memory to its file path.
+ * Doesn't access any #Main data, so it can be called from any thread.
+ *
+ * \return Success.
+ */
+extern bool BLO_write_file_from_memory(const BlendFileMemoryWrite *memory_write,
+                                       ReportList *reports);
+extern void BLO_write_file_memory_free(BlendFileMemoryWrite *memory_write);
+
 /**
  * \return Success.
  */
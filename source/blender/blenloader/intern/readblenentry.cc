@@ -18,6 +18,7 @@
 #include "BLI_path_utils.hh" /* Only for assertions. */
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_genfile.h"
@@ -119,26 +120,20 @@ LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
 {
   FileData *fd = reinterpret_cast<FileData *>(bh);
   LinkNode *names = nullptr;
-  BHead *bhead;
   int tot = 0;
 
-  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    if (bhead->code == ofblocktype) {
-      const char *idname;
-      short idflag;
-      AssetMetaData *asset_meta_data;
-      if (!blendhandle_load_id_data_and_validate(
-              fd, bhead, use_assets_only, idname, idflag, asset_meta_data))
-      {
-        continue;
-      }
-
-      BLI_linklist_prepend(&names, BLI_strdup(idname + 2));
-      tot++;
-    }
-    else if (bhead->code == BLO_CODE_ENDB) {
-      break;
+  for (BHead *bhead : blo_bheads_by_id_code(fd, ofblocktype)) {
+    const char *idname;
+    short idflag;
+    AssetMetaData *asset_meta_data;
+    if (!blendhandle_load_id_data_and_validate(
+            fd, bhead, use_assets_only, idname, idflag, asset_meta_data))
+    {
+      continue;
     }
+
+    BLI_linklist_prepend(&names, BLI_strdup(idname + 2));
+    tot++;
   }
 
   *r_tot_names = tot;
@@ -152,57 +147,46 @@ LinkNode *BLO_blendhandle_get_datablock_info(BlendHandle *bh,
 {
   FileData *fd = reinterpret_cast<FileData *>(bh);
   LinkNode *infos = nullptr;
-  BHead *bhead;
   int tot = 0;
 
   const int sdna_nr_preview_image = DNA_struct_find_with_alias(fd->filesdna, "PreviewImage");
 
-  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    if (bhead->code == BLO_CODE_ENDB) {
-      break;
+  for (BHead *id_bhead : blo_bheads_by_id_code(fd, ofblocktype)) {
+    const char *idname;
+    short idflag;
+    AssetMetaData *asset_meta_data;
+    if (!blendhandle_load_id_data_and_validate(
+            fd, id_bhead, use_assets_only, idname, idflag, asset_meta_data))
+    {
+      continue;
     }
-    if (bhead->code == ofblocktype) {
-      BHead *id_bhead = bhead;
-
-      const char *idname;
-      short idflag;
-      AssetMetaData *asset_meta_data;
-      if (!blendhandle_load_id_data_and_validate(
-              fd, id_bhead, use_assets_only, idname, idflag, asset_meta_data))
-      {
-        continue;
-      }
 
-      const char *name = idname + 2;
-      BLODataBlockInfo *info = MEM_new<BLODataBlockInfo>(__func__);
+    const char *name = idname + 2;
+    BLODataBlockInfo *info = MEM_new<BLODataBlockInfo>(__func__);
 
-      /* Lastly, read asset data from the following blocks. */
-      if (asset_meta_data) {
-        bhead = blo_read_asset_data_block(fd, bhead, &asset_meta_data);
-        /* blo_read_asset_data_block() reads all DATA heads and already advances bhead to the
-         * next non-DATA one. Go back, so the loop doesn't skip the non-DATA head. */
-        bhead = blo_bhead_prev(fd, bhead);
-      }
+    /* Lastly, read asset data from the following blocks. */
+    if (asset_meta_data) {
+      blo_read_asset_data_block(fd, id_bhead, &asset_meta_data);
+    }
 
-      STRNCPY(info->name, name);
-      info->asset_data = asset_meta_data;
-      info->free_asset_data = true;
-
-      bool has_preview = false;
-      /* See if we can find a preview in the data of this ID. */
-      for (BHead *data_bhead = blo_bhead_next(fd, id_bhead); data_bhead->code == BLO_CODE_DATA;
-           data_bhead = blo_bhead_next(fd, data_bhead))
-      {
-        if (data_bhead->SDNAnr == sdna_nr_preview_image) {
-          has_preview = true;
-          break;
-        }
-      }
-      info->no_preview_found = !has_preview;
+    STRNCPY(info->name, name);
+    info->asset_data = asset_meta_data;
+    info->free_asset_data = true;
 
-      BLI_linklist_prepend(&infos, info);
-      tot++;
+    bool has_preview = false;
+    /* See if we can find a preview in the data of this ID. */
+    for (BHead *data_bhead = blo_bhead_next(fd, id_bhead); data_bhead->code == BLO_CODE_DATA;
+         data_bhead = blo_bhead_next(fd, data_bhead))
+    {
+      if (data_bhead->SDNAnr == sdna_nr_preview_image) {
+        has_preview = true;
+        break;
+      }
     }
+    info->no_preview_found = !has_preview;
+
+    BLI_linklist_prepend(&infos, info);
+    tot++;
   }
 
   *r_tot_info_items = tot;
@@ -299,15 +283,11 @@ LinkNode *BLO_blendhandle_get_linkable_groups(BlendHandle *bh)
   FileData *fd = reinterpret_cast<FileData *>(bh);
   Set<const char *> gathered;
   LinkNode *names = nullptr;
-  BHead *bhead;
 
-  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    if (bhead->code == BLO_CODE_ENDB) {
-      break;
-    }
-    if (BKE_idtype_idcode_is_valid(bhead->code)) {
-      if (BKE_idtype_idcode_is_linkable(bhead->code)) {
-        const char *str = BKE_idtype_idcode_to_name(bhead->code);
+  for (const int id_code : blo_bhead_id_codes(fd)) {
+    if (BKE_idtype_idcode_is_valid(id_code)) {
+      if (BKE_idtype_idcode_is_linkable(id_code)) {
+        const char *str = BKE_idtype_idcode_to_name(id_code);
 
         if (gathered.add(str)) {
           BLI_linklist_prepend(&names, BLI_strdup(str));
@@ -341,6 +321,7 @@ BlendFileData *BLO_read_from_file(const char *filepath,
 {
   BLI_assert(!BLI_path_is_rel(filepath));
   BLI_assert(BLI_path_is_abs_from_cwd(filepath));
+  TRACE_ZONE("Read Blend File");
 
   BlendFileData *bfd = nullptr;
   FileData *fd;
@@ -61,6 +61,7 @@
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
@@ -557,6 +558,37 @@ static void read_file_bhead_idname_map_create(FileData *fd)
   }
 }
 
+static FileData::BHeadIDCodeIndex &read_file_bhead_id_code_index_ensure(FileData *fd)
+{
+  if (fd->bhead_id_code_index) {
+    return *fd->bhead_id_code_index;
+  }
+  FileData::BHeadIDCodeIndex &index = fd->bhead_id_code_index.emplace();
+  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code == BLO_CODE_ENDB) {
+      break;
+    }
+    if (!blo_bhead_is_id(bhead)) {
+      continue;
+    }
+    if (index.bheads.lookup(bhead->code).is_empty()) {
+      index.id_codes.append(bhead->code);
+    }
+    index.bheads.add(bhead->code, bhead);
+  }
+  return index;
+}
+
+Span<BHead *> blo_bheads_by_id_code(FileData *fd, const int id_code)
+{
+  return read_file_bhead_id_code_index_ensure(fd).bheads.lookup(id_code);
+}
+
+Span<int> blo_bhead_id_codes(FileData *fd)
+{
+  return read_file_bhead_id_code_index_ensure(fd).id_codes;
+}
+
 void blo_readfile_invalidate(FileData *fd, Main *bmain, const char *message)
 {
   /* Tag given `bmain`, and 'root 'local' main one (in case given one is a library one) as invalid.
@@ -755,6 +787,23 @@ static bool blo_bhead_read_data(FileData *fd, BHead *thisblock, void *buf)
   return success;
 }
 
+/**
+ * Direct access to the data of a block that has not been read yet, without copying it. This is
+ * only possible when the whole file is available in memory already (e.g. when it is
+ * memory-mapped), null is returned otherwise.
+ *
+ * \note Call again after accessing the data, to check that no IO error happened in the meantime.
+ */
+static const void *blo_bhead_data_view(FileData *fd, const BHead *thisblock)
+{
+  const BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
+  BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  if (fd->file->view == nullptr) {
+    return nullptr;
+  }
+  return fd->file->view(fd->file, new_bhead->file_offset, size_t(thisblock->len));
+}
+
 static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
 {
   BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
@@ -1780,6 +1829,35 @@ static const char *get_alloc_name(FileData *fd,
 #endif
 }
 
+/**
+ * Reconstruct the structs of a block saved with a different DNA. Large arrays of structs (e.g.
+ * mesh data from older files) are converted on multiple threads.
+ */
+static void *read_struct_reconstruct(FileData *fd,
+                                     const BHead *bh,
+                                     const void *data,
+                                     const char *alloc_name)
+{
+  constexpr int grain_size = 1024;
+  if (bh->nr < 2 * grain_size) {
+    return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, data, alloc_name);
+  }
+  void *new_blocks = DNA_struct_reconstruct_alloc(
+      fd->reconstruct_info, bh->SDNAnr, bh->nr, alloc_name);
+  if (new_blocks == nullptr) {
+    return nullptr;
+  }
+  threading::parallel_for(IndexRange(bh->nr), grain_size, [&](const IndexRange range) {
+    DNA_struct_reconstruct_blocks(fd->reconstruct_info,
+                                  bh->SDNAnr,
+                                  int(range.start()),
+                                  int(range.size()),
+                                  data,
+                                  new_blocks);
+  });
+  return new_blocks;
+}
+
 static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const int id_type_index)
 {
   void *temp = nullptr;
@@ -1812,6 +1890,17 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
+          /* Reconstruct directly from the file data if it is in memory already (e.g. for
+           * memory-mapped files), instead of making a temporary copy of the whole block first. */
+          if (const void *data = blo_bhead_data_view(fd, bh)) {
+            temp = read_struct_reconstruct(fd, bh, data, alloc_name);
+            if (UNLIKELY(blo_bhead_data_view(fd, bh) == nullptr)) {
+              fd->flags &= ~FD_FLAGS_FILE_OK;
+              MEM_delete_void(temp);
+              temp = nullptr;
+            }
+            return temp;
+          }
           bh = blo_bhead_read_full(fd, bh);
           if (UNLIKELY(bh == nullptr)) {
             fd->flags &= ~FD_FLAGS_FILE_OK;
@@ -1819,8 +1908,7 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(
-            fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1), alloc_name);
+        temp = read_struct_reconstruct(fd, bh, (bh + 1), alloc_name);
       }
       else {
         /* SDNA_CMP_EQUAL */
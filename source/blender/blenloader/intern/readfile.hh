@@ -20,6 +20,8 @@
 #include "BLI_fileops.h"
 #include "BLI_filereader.h"
 #include "BLI_map.hh"
+#include "BLI_multi_value_map.hh"
+#include "BLI_vector.hh"
 
 #include "DNA_sdna_types.h"
 #include "DNA_space_types.h"
@@ -160,6 +162,15 @@ struct FileData {
 
   std::optional<Map<StringRefNull, BHead *>> bhead_idname_map;
 
+  /** Lazily created index of all ID BHeads by their ID code, see #blo_bheads_by_id_code. */
+  struct BHeadIDCodeIndex {
+    /** All ID codes found in the file, in order of their first appearance. */
+    Vector<int> id_codes;
+    /** ID BHeads of each ID code, in file order. */
+    MultiValueMap<int, BHead *> bheads;
+  };
+  std::optional<BHeadIDCodeIndex> bhead_id_code_index;
+
   /**
    * The root (main, local) Main.
    * The Main that will own Library IDs.
@@ -253,6 +264,16 @@ BHead *blo_bhead_first(FileData *fd) ATTR_NONNULL(1);
 BHead *blo_bhead_next(FileData *fd, BHead *thisblock) ATTR_NONNULL(1);
 BHead *blo_bhead_prev(FileData *fd, BHead *thisblock) ATTR_NONNULL(1, 2);
 
+/**
+ * All ID BHeads with the given ID code, in file order.
+ *
+ * The whole BHead chain is only scanned once per #FileData, so that listing the data-blocks of
+ * each ID type of a file does not have to go over all of its blocks again for every type.
+ */
+Span<BHead *> blo_bheads_by_id_code(FileData *fd, int id_code) ATTR_NONNULL(1);
+/** All ID codes used by ID BHeads in the file, in order of their first appearance. */
+Span<int> blo_bhead_id_codes(FileData *fd) ATTR_NONNULL(1);
+
 /**
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
  *
@@ -4599,7 +4599,7 @@ void blo_do_versions_280(FileData *fd, Library * /*lib*/, Main *bmain)
                         R_MODE_UNUSED_5 | R_MODE_UNUSED_6 | R_MODE_UNUSED_7 | R_MODE_UNUSED_8 |
                         R_MODE_UNUSED_10 | R_MODE_UNUSED_13 | R_MODE_UNUSED_16 | R_MODE_UNUSED_17 |
                         R_MODE_UNUSED_18 | R_MODE_UNUSED_19 | R_MODE_UNUSED_20 | R_MODE_UNUSED_21 |
-                        R_MODE_UNUSED_27);
+                        R_SAVE_BACKGROUND);
 
       scene.r.scemode &= ~(R_SCEMODE_UNUSED_8 | R_SCEMODE_UNUSED_11 | R_SCEMODE_UNUSED_13 |
                            R_SCEMODE_UNUSED_16 | R_SCEMODE_UNUSED_17 | R_SCEMODE_UNUSED_19);
@@ -1759,6 +1759,15 @@ void blo_do_versions_userdef(UserDef *userdef)
     userdef->uiflag2 |= USER_UIFLAG2_SHOW_ONLINE_ASSETS;
   }
 
+  if (!USER_VERSION_ATLEAST(502, 6)) {
+    userdef->sequencer_disk_cache_compression = USER_SEQ_DISK_CACHE_COMPRESSION_LOW;
+    userdef->sequencer_disk_cache_size_limit = 100;
+  }
+
+  if (!USER_VERSION_ATLEAST(502, 7)) {
+    userdef->sequencer_proxy_build_jobs = 2;
+  }
+
   /**
    * Always bump subversion in BKE_blender_version.h when adding versioning
    * code here, and wrap it inside a USER_VERSION_ATLEAST check.
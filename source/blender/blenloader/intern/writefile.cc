@@ -95,6 +95,7 @@
 #include "DNA_userdef_types.h"
 #include "DNA_windowmanager_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_endian_defines.h"
 #include "BLI_fileops.hh"
 #include "BLI_implicit_sharing.hh"
@@ -105,8 +106,10 @@
 #include "BLI_path_utils.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_trace.hh"
 
 #include "MEM_guardedalloc.h"
 
@@ -224,6 +227,38 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/** Keeps the written data in memory, see #BLO_write_file_to_memory. */
+class MemoryWriteWrap : public WriteWrap {
+ public:
+  MemoryWriteWrap(BlendFileMemoryWrite &memory_write) : memory_write(memory_write) {}
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+ private:
+  BlendFileMemoryWrite &memory_write;
+};
+
+struct BlendFileMemoryWrite {
+  std::string filepath;
+  Vector<Array<uint8_t>> chunks;
+};
+
+bool MemoryWriteWrap::open(const char * /*filepath*/)
+{
+  return true;
+}
+bool MemoryWriteWrap::close()
+{
+  return true;
+}
+bool MemoryWriteWrap::write(const void *buf, size_t buf_len)
+{
+  memory_write.chunks.append(Array<uint8_t>(Span(static_cast<const uint8_t *>(buf), buf_len)));
+  return true;
+}
+
 struct ThreadSlot;
 
 class ZstdWriteWrap : public WriteWrap {
@@ -518,6 +553,12 @@ static void mywrite(WriteData *wd, const void *adr, size_t len)
   wd->write_len += len;
 #endif
 
+  if (wd->id_stream) {
+    wd->id_stream->data.extend(Span(static_cast<const uchar *>(adr), int64_t(len)));
+    wd->id_stream->segment_sizes.append(int64_t(len));
+    return;
+  }
+
   if (wd->buffer.buf == nullptr) {
     writedata_do_write(wd, adr, len);
   }
@@ -792,10 +833,18 @@ static uint64_t stable_id_from_hint(const uint64_t hint)
   return stable_id;
 }
 
+static bool stable_address_id_is_used_in_parent(const WriteData &wd, const uint64_t stable_id)
+{
+  const WriteDataStableAddressIDs *parent = wd.stable_address_ids.parent;
+  return parent != nullptr && parent->used_ids.contains(stable_id);
+}
+
 static uint64_t get_next_stable_address_id(WriteData &wd, uint64_t &hint)
 {
   uint64_t stable_id = stable_id_from_hint(hint);
-  while (!wd.stable_address_ids.used_ids.add(stable_id)) {
+  while (stable_address_id_is_used_in_parent(wd, stable_id) ||
+         !wd.stable_address_ids.used_ids.add(stable_id))
+  {
     /* Generate a new hint because there is a collision. Collisions are generally expected to be
      * very rare. It can happen when #get_stable_pointer_hint_for_id produces values that are very
      * close for different IDs. */
@@ -844,6 +893,11 @@ static uint64_t get_address_id_int(WriteData &wd, const void *address)
    * values are used. The only really critical thing is that all written stable addresses remain
    * unique, which should remain true even if this ever happens.
    */
+  if (const WriteDataStableAddressIDs *parent = wd.stable_address_ids.parent) {
+    if (const uint64_t *address_id = parent->pointer_map.lookup_ptr(address)) {
+      return *address_id;
+    }
+  }
   return wd.stable_address_ids.pointer_map.lookup_or_add_cb(address, [&]() {
     return get_next_stable_address_id(wd, wd.stable_address_ids.next_id_hint);
   });
@@ -1250,6 +1304,101 @@ static void write_id(WriteData *wd, ID *id)
   mywrite_id_end(wd, id);
 }
 
+static bool stable_address_ids_conflict(const WriteDataStableAddressIDs &main_ids,
+                                        const WriteDataStableAddressIDs &id_ids)
+{
+  for (const uint64_t stable_id : id_ids.used_ids) {
+    if (main_ids.used_ids.contains(stable_id)) {
+      return true;
+    }
+  }
+  for (const void *address : id_ids.pointer_map.keys()) {
+    if (main_ids.pointer_map.contains(address)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Pass the data written by a data-block serialized in isolation on to the main #WriteData.
+ */
+static void write_id_stream_merge(WriteData *wd, WriteData &id_wd)
+{
+  WriteDataStableAddressIDs &main_ids = wd->stable_address_ids;
+  const WriteDataStableAddressIDs &id_ids = id_wd.stable_address_ids;
+  for (const auto item : id_ids.pointer_map.items()) {
+    main_ids.pointer_map.add_new(item.key, item.value);
+  }
+  for (const uint64_t stable_id : id_ids.used_ids) {
+    main_ids.used_ids.add_new(stable_id);
+  }
+  /* Data written after the last data-block (e.g. the user preferences) continues from there. */
+  main_ids.next_id_hint = id_ids.next_id_hint;
+
+  if (id_wd.validation_data.critical_error) {
+    wd->validation_data.critical_error = true;
+  }
+
+  const WriteDataIDStream &stream = *id_wd.id_stream;
+  int64_t offset = 0;
+  for (const int64_t size : stream.segment_sizes) {
+    mywrite(wd, stream.data.data() + offset, size_t(size));
+    offset += size;
+  }
+}
+
+/**
+ * Writes the given IDs like #write_id, but serializes them on multiple threads.
+ *
+ * Every ID is first written into its own #WriteDataIDStream, generating stable address ids only
+ * locally. The streams are then passed on to the main #WriteData in the original order. When an
+ * ID generated stable address ids that conflict with ones generated by a previous ID, it is
+ * written again directly, so the result is always identical to writing all IDs sequentially.
+ *
+ * 
+ote This requires the `blend_write` callbacks of the written ID types to be thread-safe.
+ */
+static void write_ids_parallel(WriteData *wd, const Span<ID *> ids)
+{
+  BLI_assert(!wd->use_memfile);
+  BLI_assert(wd->debug_dst == nullptr);
+
+  /* Only serialize a limited amount of IDs at once, to limit the memory used by the streams. */
+  const int64_t batch_size = int64_t(std::max(1, BLI_system_thread_count())) * 4;
+
+  for (int64_t batch_start = 0; batch_start < ids.size(); batch_start += batch_size) {
+    const Span<ID *> batch = ids.slice(batch_start,
+                                       std::min(batch_size, ids.size() - batch_start));
+    Array<WriteDataIDStream> streams(batch.size());
+    Array<WriteData *> id_wds(batch.size());
+
+    threading::parallel_for(batch.index_range(), 1, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        WriteData *id_wd = MEM_new<WriteData>(__func__);
+        id_wd->sdna = wd->sdna;
+        id_wd->stable_address_ids.sdna_pointers = wd->stable_address_ids.sdna_pointers;
+        id_wd->stable_address_ids.parent = &wd->stable_address_ids;
+        id_wd->id_stream = &streams[i];
+        write_id(id_wd, batch[i]);
+        id_wds[i] = id_wd;
+      }
+    });
+
+    for (const int64_t i : batch.index_range()) {
+      WriteData *id_wd = id_wds[i];
+      if (stable_address_ids_conflict(wd->stable_address_ids, id_wd->stable_address_ids)) {
+        CLOG_DEBUG(&LOG, "Rewriting '%s' because of conflicting address ids", batch[i]->name);
+        write_id(wd, batch[i]);
+      }
+      else {
+        write_id_stream_merge(wd, *id_wd);
+      }
+      MEM_delete(id_wd);
+    }
+  }
+}
+
 static void write_id_placeholder(WriteData *wd, ID *id)
 {
   mywrite_id_begin(wd, id);
@@ -1832,8 +1981,15 @@ static bool write_file_handle(Main *mainvar,
   }
 
   /* Actually write local data-blocks to the file. */
-  for (ID *id : local_ids_to_write) {
-    write_id(wd, id);
+  if (!is_undo && wd->debug_dst == nullptr &&
+      USER_DEVELOPER_TOOL_TEST(&U, use_parallel_blend_write))
+  {
+    write_ids_parallel(wd, local_ids_to_write);
+  }
+  else {
+    for (ID *id : local_ids_to_write) {
+      write_id(wd, id);
+    }
   }
 
   /* Write libraries about libraries and linked data-blocks. */
@@ -2132,6 +2288,7 @@ bool BLO_write_file(Main *mainvar,
                     const BlendFileWriteParams *params,
                     ReportList *reports)
 {
+  TRACE_ZONE("Write Blend File");
   RawWriteWrap raw_wrap;
 
   if (write_flags & G_FILE_COMPRESS) {
@@ -2142,6 +2299,88 @@ bool BLO_write_file(Main *mainvar,
   return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
 }
 
+BlendFileMemoryWrite *BLO_write_file_to_memory(Main *mainvar,
+                                               const char *filepath,
+                                               const int write_flags,
+                                               const BlendFileWriteParams *params,
+                                               ReportList *reports)
+{
+  BLI_assert(params->remap_mode == BLO_WRITE_PATH_REMAP_NONE);
+  BLI_assert(!params->use_save_versions && !params->use_save_as_copy);
+
+  if ((write_flags & G_FILE_ASSET_EDIT_FILE) && !mainvar->is_asset_edit_file) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot save normal file (%s) as asset system file", filepath);
+    return nullptr;
+  }
+
+  write_file_main_validate_pre(mainvar, reports);
+
+  BlendFileMemoryWrite *memory_write = MEM_new<BlendFileMemoryWrite>(__func__);
+  memory_write->filepath = filepath;
+
+  MemoryWriteWrap memory_wrap(*memory_write);
+  ZstdWriteWrap zstd_wrap(memory_wrap);
+  WriteWrap &ww = (write_flags & G_FILE_COMPRESS) ? static_cast<WriteWrap &>(zstd_wrap) :
+                                                   memory_wrap;
+  ww.open(filepath);
+  const bool err = write_file_handle(
+      mainvar, &ww, nullptr, nullptr, write_flags, params->use_userdef, params->thumb, nullptr);
+  ww.close();
+
+  if (err) {
+    BKE_report(reports, RPT_ERROR, strerror(errno));
+    BLO_write_file_memory_free(memory_write);
+    return nullptr;
+  }
+
+  write_file_main_validate_post(mainvar, reports);
+  if (mainvar->is_global_main) {
+    STRNCPY(G.filepath_last_blend, filepath);
+  }
+  return memory_write;
+}
+
+bool BLO_write_file_from_memory(const BlendFileMemoryWrite *memory_write, ReportList *reports)
+{
+  char tempname[FILE_MAX + 1];
+  SNPRINTF(tempname, "%s@", memory_write->filepath.c_str());
+
+  RawWriteWrap raw_wrap;
+  if (raw_wrap.open(tempname) == false) {
+    BKE_reportf(
+        reports, RPT_ERROR, "Cannot open file %s for writing: %s", tempname, strerror(errno));
+    return false;
+  }
+
+  bool err = false;
+  for (const Array<uint8_t> &chunk : memory_write->chunks) {
+    if (!raw_wrap.write(chunk.data(), chunk.size())) {
+      err = true;
+      break;
+    }
+  }
+  if (!raw_wrap.close()) {
+    err = true;
+  }
+
+  if (err) {
+    BKE_report(reports, RPT_ERROR, strerror(errno));
+    remove(tempname);
+    return false;
+  }
+
+  if (BLI_rename_overwrite(tempname, memory_write->filepath.c_str()) != 0) {
+    BKE_report(reports, RPT_ERROR, "Cannot change old file (file saved with @)");
+    return false;
+  }
+  return true;
+}
+
+void BLO_write_file_memory_free(BlendFileMemoryWrite *memory_write)
+{
+  MEM_delete(memory_write);
+}
+
 bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, const int write_flags)
 {
   bool use_userdef = false;
@@ -2354,6 +2593,11 @@ void BLO_write_shared(BlendWriter *writer,
         memfile.size += approximate_size_in_bytes / sharing_info->strong_users();
         return;
       }
+      if (memfile.shared_storage->sharing_info_by_address_id.lookup(address_id).data == data) {
+        /* Already referenced by another ID in this undo-step, reading resolves it from the shared
+         * storage as well, so there is no need to serialize a copy of the data. */
+        return;
+      }
     }
   }
   if (sharing_info != nullptr) {
@@ -16,6 +16,7 @@
 
 #include "BLI_map.hh"
 #include "BLI_set.hh"
+#include "BLI_vector.hh"
 
 #include "BLO_undofile.hh"
 
@@ -61,6 +62,24 @@ struct WriteDataStableAddressIDs {
    * previous hints.
    */
   uint64_t next_id_hint = 0;
+  /**
+   * When a data-block is serialized in isolation (see #WriteDataIDStream), the stable address
+   * ids of the main #WriteData are looked up here (read-only), while newly generated ones are
+   * only added to the maps above. They are merged back into the parent once it is known that they
+   * do not conflict with ids generated in the meantime.
+   */
+  const WriteDataStableAddressIDs *parent = nullptr;
+};
+
+/**
+ * All bytes written for a single data-block when it is serialized in isolation. The size of every
+ * individual low-level write is kept, so that replaying the stream in the main #WriteData results
+ * in exactly the same buffering (and thus the same compressed frames) as writing the data-block
+ * directly.
+ */
+struct WriteDataIDStream {
+  Vector<uchar> data;
+  Vector<int64_t> segment_sizes;
 };
 
 struct WriteData {
@@ -128,6 +147,11 @@ struct WriteData {
    */
   WriteWrap *ww;
 
+  /**
+   * When set, everything is written into this stream instead of #ww or #mem.
+   */
+  WriteDataIDStream *id_stream;
+
   /**
    * Timestamp info defined when creating the new WriteData. Used for performance logging.
    */
@@ -0,0 +1,154 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "CLG_log.h"
+
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+
+#include "BKE_attribute.hh"
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.hh"
+
+#include "DNA_mesh_types.h"
+
+#include "bmesh.hh"
+
+namespace blender::bmesh::tests {
+
+class BMeshConvertTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    BKE_idtype_init();
+  }
+
+  static void TearDownTestSuite()
+  {
+    CLG_exit();
+  }
+};
+
+/** Create a grid of `size` by `size` quads with a point and a corner attribute. */
+static Mesh *create_grid_mesh(const int size)
+{
+  const int verts_x = size + 1;
+  Mesh *mesh = BKE_mesh_new_nomain(verts_x * verts_x, 0, size * size, size * size * 4);
+  MutableSpan<float3> positions = mesh->vert_positions_for_write();
+  MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
+  MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
+  threading::parallel_for(IndexRange(verts_x), 64, [&](const IndexRange range) {
+    for (const int y : range) {
+      for (const int x : IndexRange(verts_x)) {
+        positions[y * verts_x + x] = float3(x, y, 0.0f);
+      }
+    }
+  });
+  threading::parallel_for(IndexRange(size), 64, [&](const IndexRange range) {
+    for (const int y : range) {
+      for (const int x : IndexRange(size)) {
+        const int face = y * size + x;
+        const int vert = y * verts_x + x;
+        face_offsets[face] = face * 4;
+        corner_verts[face * 4 + 0] = vert;
+        corner_verts[face * 4 + 1] = vert + 1;
+        corner_verts[face * 4 + 2] = vert + verts_x + 1;
+        corner_verts[face * 4 + 3] = vert + verts_x;
+      }
+    }
+  });
+  bke::mesh_calc_edges(*mesh, false, false);
+
+  bke::MutableAttributeAccessor attributes = mesh->attributes_for_write();
+  bke::SpanAttributeWriter<float> vert_values =
+      attributes.lookup_or_add_for_write_only_span<float>("vert_values", bke::AttrDomain::Point);
+  for (const int i : vert_values.span.index_range()) {
+    vert_values.span[i] = float(i);
+  }
+  vert_values.finish();
+  bke::SpanAttributeWriter<int> corner_values =
+      attributes.lookup_or_add_for_write_only_span<int>("corner_values", bke::AttrDomain::Corner);
+  for (const int i : corner_values.span.index_range()) {
+    corner_values.span[i] = i;
+  }
+  corner_values.finish();
+  return mesh;
+}
+
+static BMesh *mesh_to_bmesh(const Mesh *mesh)
+{
+  const BMAllocTemplate allocsize = BMALLOC_TEMPLATE_FROM_ME(mesh);
+  BMeshCreateParams create_params{};
+  create_params.use_toolflags = false;
+  BMesh *bm = BM_mesh_create(&allocsize, &create_params);
+  BMeshFromMeshParams from_mesh_params{};
+  from_mesh_params.calc_face_normal = true;
+  from_mesh_params.calc_vert_normal = true;
+  BM_mesh_bm_from_me(bm, mesh, &from_mesh_params);
+  return bm;
+}
+
+TEST_F(BMeshConvertTest, AttributesRoundTrip)
+{
+  Mesh *mesh = create_grid_mesh(20);
+  BMesh *bm = mesh_to_bmesh(mesh);
+  EXPECT_EQ(bm->totvert, mesh->verts_num);
+  EXPECT_EQ(bm->totedge, mesh->edges_num);
+  EXPECT_EQ(bm->totface, mesh->faces_num);
+  EXPECT_EQ(bm->totloop, mesh->corners_num);
+
+  Mesh *result = BKE_mesh_new_nomain(0, 0, 0, 0);
+  BMeshToMeshParams to_mesh_params{};
+  to_mesh_params.calc_object_remap = false;
+  BM_mesh_bm_to_me(nullptr, bm, result, &to_mesh_params);
+  BM_mesh_free(bm);
+
+  EXPECT_EQ(result->corner_verts(), mesh->corner_verts());
+  const bke::AttributeAccessor attributes = result->attributes();
+  const VArraySpan vert_values = *attributes.lookup<float>("vert_values", bke::AttrDomain::Point);
+  const VArraySpan corner_values = *attributes.lookup<int>("corner_values",
+                                                           bke::AttrDomain::Corner);
+  ASSERT_EQ(vert_values.size(), mesh->verts_num);
+  ASSERT_EQ(corner_values.size(), mesh->corners_num);
+  for (const int i : vert_values.index_range()) {
+    EXPECT_EQ(vert_values[i], float(i));
+  }
+  for (const int i : corner_values.index_range()) {
+    EXPECT_EQ(corner_values[i], i);
+  }
+
+  BKE_id_free(nullptr, result);
+  BKE_id_free(nullptr, mesh);
+}
+
+/* Measures the time it takes to convert large meshes to BMesh and back, similar to entering and
+ * leaving edit mode. Disabled by default because of its run-time. */
+TEST_F(BMeshConvertTest, DISABLED_Benchmark)
+{
+  for (const int size : {1000, 3163}) {
+    Mesh *mesh = create_grid_mesh(size);
+    std::cout << mesh->faces_num << " faces:\n";
+    BMesh *bm;
+    {
+      SCOPED_TIMER("  Mesh to BMesh");
+      bm = mesh_to_bmesh(mesh);
+    }
+    Mesh *result = BKE_mesh_new_nomain(0, 0, 0, 0);
+    {
+      SCOPED_TIMER("  BMesh to Mesh");
+      BMeshToMeshParams to_mesh_params{};
+      to_mesh_params.calc_object_remap = false;
+      BM_mesh_bm_to_me(nullptr, bm, result, &to_mesh_params);
+    }
+    BM_mesh_free(bm);
+    BKE_id_free(nullptr, result);
+    BKE_id_free(nullptr, mesh);
+  }
+}
+
+}  // namespace blender::bmesh::tests
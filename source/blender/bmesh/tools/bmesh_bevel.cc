@@ -26,6 +26,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
 #include "BLI_set.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -2378,6 +2379,23 @@ static void calculate_profile_segments(const Profile *profile,
  * the coordinate values for the power of 2 >= bp->seg, because the ADJ pattern needs power-of-2
  * boundaries during construction.
  */
+/** Allocate the profile coordinates that are filled by #calculate_profile. */
+static void profile_ensure_coords(BevelParams *bp, Profile *pro)
+{
+  if (pro->prof_co != nullptr) {
+    return;
+  }
+  pro->prof_co = static_cast<float *>(
+      BLI_memarena_alloc(bp->mem_arena, sizeof(float[3]) * (bp->seg + 1)));
+  if (bp->seg != bp->pro_spacing.seg_2) {
+    pro->prof_co_2 = static_cast<float *>(
+        BLI_memarena_alloc(bp->mem_arena, sizeof(float[3]) * (bp->pro_spacing.seg_2 + 1)));
+  }
+  else {
+    pro->prof_co_2 = pro->prof_co;
+  }
+}
+
 static void calculate_profile(BevelParams *bp, BoundVert *bndv, bool reversed, bool miter)
 {
   Profile *pro = &bndv->profile;
@@ -2388,17 +2406,7 @@ static void calculate_profile(BevelParams *bp, BoundVert *bndv, bool reversed, b
   }
 
   bool need_2 = bp->seg != bp->pro_spacing.seg_2;
-  if (pro->prof_co == nullptr) {
-    pro->prof_co = static_cast<float *>(
-        BLI_memarena_alloc(bp->mem_arena, sizeof(float[3]) * (bp->seg + 1)));
-    if (need_2) {
-      pro->prof_co_2 = static_cast<float *>(
-          BLI_memarena_alloc(bp->mem_arena, sizeof(float[3]) * (bp->pro_spacing.seg_2 + 1)));
-    }
-    else {
-      pro->prof_co_2 = pro->prof_co;
-    }
-  }
+  profile_ensure_coords(bp, pro);
 
   bool use_map;
   float map[4][4];
@@ -6130,7 +6138,56 @@ static void bevel_vert_two_edges(BevelParams *bp, BMesh *bm, BevVert *bv)
   }
 }
 
-/* Given that the boundary is built, now make the actual BMVerts
+/**
+ * Allocate the profile coordinates of all BoundVerts of the vertex mesh. This has to be done
+ * serially before calling #build_vmesh_profiles because the memory arena isn't thread-safe.
+ */
+static void vmesh_profiles_ensure_coords(BevelParams *bp, VMesh *vm)
+{
+  if (bp->seg == 1) {
+    /* Profiles are not calculated in this case. */
+    return;
+  }
+  BoundVert *bndv = vm->boundstart;
+  do {
+    profile_ensure_coords(bp, &bndv->profile);
+  } while ((bndv = bndv->next) != vm->boundstart);
+}
+
+/**
+ * Calculate the profiles of all BoundVerts, once their positions are final.
+ * It's simpler to calculate all profiles only once at a single moment, so keep just a single
+ * profile calculation here, the last point before actual mesh verts are created by #build_vmesh.
+ *
+ * Only the data of the given #BevVert is modified, so this can run in parallel for different
+ * vertices after #vmesh_profiles_ensure_coords.
+ */
+static void build_vmesh_profiles(BevelParams *bp, BevVert *bv)
+{
+  VMesh *vm = bv->vmesh;
+
+  /* Special case: just two beveled edges welded together, move their profile planes. */
+  if ((bv->selcount == 2) && (vm->count == 2)) {
+    BoundVert *weld1 = nullptr;
+    BoundVert *bndv = vm->boundstart;
+    do {
+      if (bndv->ebev) {
+        if (!weld1) {
+          weld1 = bndv;
+        }
+        else {
+          set_profile_params(bp, bv, weld1);
+          set_profile_params(bp, bv, bndv);
+          move_weld_profile_planes(bv, weld1, bndv);
+        }
+      }
+    } while ((bndv = bndv->next) != vm->boundstart);
+  }
+
+  calculate_vm_profiles(bp, bv, vm);
+}
+
+/* Given that the boundary is built and the profiles are calculated, now make the actual BMVerts
  * for the boundary and the interior of the vertex mesh. */
 static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
 {
@@ -6157,24 +6214,17 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
     create_mesh_bmvert(bm, vm, i, 0, 0, bv->v);          /* Create BMVert for that NewVert. */
     bndv->nv.v = mesh_vert(vm, i, 0, 0)->v; /* Use the BMVert for the BoundVert's NewVert. */
 
-    /* Find boundverts and move profile planes if this is a weld case. */
+    /* Find boundverts of the weld case, see #build_vmesh_profiles for their profiles. */
     if (weld && bndv->ebev) {
       if (!weld1) {
         weld1 = bndv;
       }
       else { /* Get the last of the two BoundVerts. */
         weld2 = bndv;
-        set_profile_params(bp, bv, weld1);
-        set_profile_params(bp, bv, weld2);
-        move_weld_profile_planes(bv, weld1, weld2);
       }
     }
   } while ((bndv = bndv->next) != vm->boundstart);
 
-  /* It's simpler to calculate all profiles only once at a single moment, so keep just a single
-   * profile calculation here, the last point before actual mesh verts are created. */
-  calculate_vm_profiles(bp, bv, vm);
-
   /* Create new vertices and place them based on the profiles. */
   /* Copy other ends to (i, 0, ns) for all i, and fill in profiles for edges. */
   bndv = vm->boundstart;
@@ -8061,15 +8111,27 @@ void BM_mesh_bevel(BMesh *bm,
     }
   }
 
-  /* Build the meshes around vertices, now that positions are final. */
+  /* Build the meshes around vertices, now that positions are final. The profiles of different
+   * vertices are independent, so they are calculated in parallel, the BMesh is modified serially
+   * in the original order of vertices to keep the result deterministic. */
+  Vector<BevVert *> bevverts;
   BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
     if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
       bv = find_bevvert(&bp, v);
       if (bv) {
-        build_vmesh(&bp, bm, bv);
+        vmesh_profiles_ensure_coords(&bp, bv->vmesh);
+        bevverts.append(bv);
       }
     }
   }
+  threading::parallel_for(bevverts.index_range(), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      build_vmesh_profiles(&bp, bevverts[i]);
+    }
+  });
+  for (const int i : bevverts.index_range()) {
+    build_vmesh(&bp, bm, bevverts[i]);
+  }
 
   /* Build polygons for edges. */
   if (bp.affect_type != BEVEL_AFFECT_VERTICES) {
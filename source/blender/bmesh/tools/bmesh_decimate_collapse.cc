@@ -22,6 +22,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.hh"
@@ -78,23 +79,31 @@ static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
   BMFace *f;
   BMEdge *e;
 
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
+  /* Compute the face quadrics in parallel, but accumulate them in the same order as before, so
+   * that the result doesn't depend on the number of threads. */
+  BM_mesh_elem_table_ensure(bm, BM_FACE);
+  Array<Quadric> face_quadrics(bm->totface);
+  threading::parallel_for(IndexRange(bm->totface), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const BMFace *f = bm->ftable[i];
+      float center[3];
+      double plane_db[4];
+
+      BM_face_calc_center_median(f, center);
+      copy_v3db_v3fl(plane_db, f->no);
+      plane_db[3] = -dot_v3db_v3fl(plane_db, center);
+
+      BLI_quadric_from_plane(&face_quadrics[i], plane_db);
+    }
+  });
+
+  for (const int i : IndexRange(bm->totface)) {
     BMLoop *l_first;
     BMLoop *l_iter;
 
-    float center[3];
-    double plane_db[4];
-    Quadric q;
-
-    BM_face_calc_center_median(f, center);
-    copy_v3db_v3fl(plane_db, f->no);
-    plane_db[3] = -dot_v3db_v3fl(plane_db, center);
-
-    BLI_quadric_from_plane(&q, plane_db);
-
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+    l_iter = l_first = BM_FACE_FIRST_LOOP(bm->ftable[i]);
     do {
-      BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(l_iter->v)], &q);
+      BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(l_iter->v)], &face_quadrics[i]);
     } while ((l_iter = l_iter->next) != l_first);
   }
 
@@ -230,12 +239,16 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * Calculate the collapse cost of an edge, without modifying any data.
+ *
+ * \return false if the edge must not be collapsed.
+ */
+static bool bm_decim_calc_edge_cost_single(BMEdge *e,
+                                           const Quadric *vquadrics,
+                                           const float *vweights,
+                                           const float vweight_factor,
+                                           float &r_cost)
 {
   float cost;
 
@@ -318,10 +331,26 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  r_cost = cost;
+  return true;
 
 clear:
+  return false;
+}
+
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+  if (bm_decim_calc_edge_cost_single(e, vquadrics, vweights, vweight_factor, cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+    return;
+  }
+
   if (eheap_table[BM_elem_index_get(e)]) {
     BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
   }
@@ -343,14 +372,22 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
+  /* Evaluating the quadrics of all edges is independent from the heap, so it's done in parallel
+   * and only the insertion into the heap is serial. */
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+  Array<float> costs(bm->totedge);
+  Array<bool> is_valid(bm->totedge);
+  threading::parallel_for(IndexRange(bm->totedge), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      is_valid[i] = bm_decim_calc_edge_cost_single(
+          bm->etable[i], vquadrics, vweights, vweight_factor, costs[i]);
+    }
+  });
 
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
-    /* keep sanity check happy */
-    eheap_table[i] = nullptr;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+  for (const int i : IndexRange(bm->totedge)) {
+    BMEdge *e = bm->etable[i];
+    BLI_assert(BM_elem_index_get(e) == i);
+    eheap_table[i] = is_valid[i] ? BLI_heap_insert(eheap, costs[i], e) : nullptr;
   }
 }
 
@@ -56,8 +56,12 @@ namespace blender::compositor {
  * the criteria of whether the compile unit should be compiled given the node currently being
  * processed as an argument. Those criteria are described as follows. If the compile unit is empty
  * as is the case when processing nodes 1, 2, and 3, then it plainly shouldn't be compiled. If the
- * given node is not a pixel node, then it can't be added to the compile unit and the unit is
- * considered complete and should be compiled, as is the case when processing node 6. If the
+ * given node is not a pixel node, then it can't be added to the compile unit. If it also uses the
+ * output of any of the nodes in the compile unit, then the unit is considered complete and should
+ * be compiled, as is the case when processing node 6. But if it doesn't, then the node can be
+ * evaluated before the compile unit, so the unit shouldn't be compiled just yet and the pixel
+ * nodes scheduled after the node can still be added to it, which avoids allocating intermediate
+ * buffers between pixel operations when the schedule interleaves pixel and non pixel nodes. If the
  * compile unit operates on single values and the given node operates on non-single values or vice
  * versa, then it can't be added to the compile unit and the unit is considered complete and should
  * be compiled, more on that in the next section. If the computed domain of the given node is not
@@ -197,6 +201,10 @@ class CompileState {
    * Operation::compute_domain method, except it is computed from the node itself as opposed to a
    * compiled operation. See the discussion in COM_domain.hh for more information. */
   Domain compute_pixel_node_domain(const bNode &node);
+
+  /* Returns true if any of the inputs of the given node is linked to a node in the pixel compile
+   * unit. */
+  bool is_node_dependent_on_pixel_compile_unit(const bNode &node);
 };
 
 }  // namespace blender::compositor
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
+
 #include "BLI_string_ref.hh"
 #include "BLI_vector_set.hh"
 
@@ -63,6 +66,17 @@ class NodeOperation : public Operation {
   /* Compute a node preview using the result returned from the get_preview_result method. */
   void compute_preview() override;
 
+  /* Returns a hash of any state other than the inputs that the results of the operation depend on,
+   * or std::nullopt if the results should not be cached across evaluations, which is the default.
+   * Expensive operations whose results are fully determined by their inputs and that state should
+   * override this method to opt in, see the execute_or_use_cached_results method. */
+  virtual std::optional<uint64_t> get_cache_state_hash() const;
+
+  /* Reuse the results cached in a previous evaluation if the inputs and the cache state hash
+   * didn't change since then, otherwise, execute the operation and cache its results. Only done
+   * for CPU contexts and if the operation opted in through the get_cache_state_hash method. */
+  void execute_or_use_cached_results() override;
+
   /* Returns a reference to the node that this operation represents. */
   const bNode &node() const;
 
@@ -71,6 +85,10 @@ class NodeOperation : public Operation {
    * of the node, if no outputs exist, then the first allocated input will be chosen. Returns
    * nullptr if no result is viewable. */
   Result *get_preview_result();
+
+  /* Computes a hash of the cache state and the contents of all inputs of the operation. Returns
+   * std::nullopt if the results of the operation can't be cached. */
+  std::optional<uint64_t> compute_cache_hash() const;
 };
 
 }  // namespace blender::compositor
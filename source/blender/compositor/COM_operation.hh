@@ -114,6 +114,11 @@ class Operation {
    * output results. */
   virtual void execute() = 0;
 
+  /* Execute the operation as part of its evaluation. This method defaults to calling the execute
+   * method, but can be overridden to reuse results cached in a previous evaluation instead of
+   * executing the operation, see NodeOperation for an example. */
+  virtual void execute_or_use_cached_results();
+
   /* Compute and set a preview of the operation if needed. This method defaults to an empty
    * implementation and should be implemented by operations which can have previews. */
   virtual void compute_preview();
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "BLI_map.hh"
+#include "BLI_string_ref.hh"
 #include "BLI_timeit.hh"
 
 #include "DNA_node_types.h"
@@ -19,19 +22,65 @@ class Context;
  * A class that profiles the evaluation of the compositor and tracks information like the
  * evaluation time of every node. */
 class Profiler {
+ public:
+  /* Information about the evaluation of a node instance other than its evaluation time. */
+  struct NodeStatistics {
+    /* The size in bytes of the output results of the node. For GPU results, this is computed
+     * using the full precision size of the result type, so it might overestimate the size of half
+     * precision textures. */
+    int64_t results_size_in_bytes = 0;
+    /* The number of evaluations in which the cached results of the node were reused or had to be
+     * computed and cached. Only counted for nodes whose results can be cached, see the
+     * NodeOperation::get_cache_state_hash method. */
+    int cache_hits = 0;
+    int cache_misses = 0;
+  };
+
  private:
   /* Stores the evaluation time of each node instance keyed by its instance key. Note that
    * pixel-wise nodes like Math nodes will not be measured, that's because they are compiled
    * together with other pixel-wise operations in a single operation, so we can't measure the
    * evaluation time of each individual node. */
   Map<bNodeInstanceKey, timeit::Nanoseconds> nodes_evaluation_times_;
+  /* Stores the statistics of each node instance keyed by its instance key. Pixel-wise nodes are
+   * not tracked for the same reason as above. */
+  Map<bNodeInstanceKey, NodeStatistics> nodes_statistics_;
+  /* If true, wait for the GPU to finish executing the commands of every node before and after its
+   * evaluation, such that the evaluation times of GPU contexts include the actual execution time
+   * on the GPU and not only the time needed to submit the commands. This stalls the GPU pipeline
+   * and is thus only enabled if debug logging for the compositor is enabled. */
+  bool synchronize_gpu_ = false;
 
  public:
+  Profiler();
+
   /* Returns a reference to the nodes evaluation times. */
   Map<bNodeInstanceKey, timeit::Nanoseconds> &get_nodes_evaluation_times();
 
+  /* Returns a reference to the nodes statistics. */
+  Map<bNodeInstanceKey, NodeStatistics> &get_nodes_statistics();
+
   /* Set the evaluation time of the node identified by the given node instance key. */
   void set_node_evaluation_time(bNodeInstanceKey node_instance_key, timeit::Nanoseconds time);
+
+  /* Add the given size to the results size of the node identified by the given instance key. */
+  void add_node_results_size(bNodeInstanceKey node_instance_key, int64_t size_in_bytes);
+
+  /* Count a cache hit or miss for the node identified by the given node instance key. */
+  void add_node_cache_hit(bNodeInstanceKey node_instance_key);
+  void add_node_cache_miss(bNodeInstanceKey node_instance_key);
+
+  /* Returns true if the GPU should be synchronized with when measuring the evaluation time of
+   * nodes. See the synchronize_gpu_ member for more information. */
+  bool should_synchronize_gpu() const;
+
+  /* Write a report of the evaluation times and statistics of all profiled nodes to the debug log
+   * of the compositor, identifying nodes by their names in the given node tree or the node groups
+   * it references. Note that the values are accumulated over all evaluations done with this
+   * profiler, like those of multiple views. Does nothing unless debug logging is enabled, which is
+   * done using `--log "compositor.profiler" --log-level debug`, and optionally `--log-file` to
+   * export the report to a file. */
+  void log_report(const bNodeTree &node_tree, int frame_number, StringRef view_name) const;
 };
 
 }  // namespace blender::compositor
@@ -0,0 +1,68 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "BLI_map.hh"
+
+#include "DNA_node_types.h"
+
+#include "COM_cached_resource.hh"
+#include "COM_result.hh"
+
+namespace blender::compositor {
+
+class Context;
+
+/* -------------------------------------------------------------------------------------------------
+ * Cached Node Result.
+ *
+ * A cached resource that stores the output results of a node operation along with a hash of the
+ * inputs and state that were used to compute them. The results share their data with the outputs
+ * of the operation that computed them, so caching doesn't involve any copies. */
+class CachedNodeResult : public CachedResource {
+ public:
+  uint64_t hash;
+  Map<std::string, Result> results;
+
+  CachedNodeResult(uint64_t hash);
+
+  ~CachedNodeResult();
+
+  /* Returns the total size of the data of the cached results in bytes. */
+  int64_t size_in_bytes() const;
+};
+
+/* -------------------------------------------------------------------------------------------------
+ * Cached Node Result Container.
+ *
+ * Stores a single cached result per node instance, so that results computed in one evaluation
+ * can be reused in the next evaluation if the inputs of the node didn't change. The total size of
+ * the cached data is limited by the memory cache limit in the user preferences. */
+class CachedNodeResultContainer : CachedResourceContainer {
+ private:
+  Map<bNodeInstanceKey, std::unique_ptr<CachedNodeResult>> map_;
+
+ public:
+  void reset() override;
+
+  /* Returns the cached result of the node instance with the given key if one exists and it was
+   * computed from inputs with the given hash, otherwise, returns nullptr. If found, the cached
+   * resource is tagged as needed to keep it cached for the next evaluation. */
+  const CachedNodeResult *get(const bNodeInstanceKey &key, uint64_t hash);
+
+  /* Cache the given results of the node instance with the given key which were computed from
+   * inputs with the given hash, replacing any previously cached results for the node instance.
+   * Nothing is cached if this would exceed the memory cache limit. */
+  void add(Context &context,
+           const bNodeInstanceKey &key,
+           uint64_t hash,
+           const Map<std::string, const Result *> &results);
+};
+
+}  // namespace blender::compositor
@@ -0,0 +1,98 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "BLI_map.hh"
+
+#include "DNA_node_types.h"
+#include "DNA_userdef_types.h"
+
+#include "COM_cached_node_result.hh"
+#include "COM_context.hh"
+#include "COM_result.hh"
+
+namespace blender::compositor {
+
+/* --------------------------------------------------------------------
+ * Cached Node Result.
+ */
+
+CachedNodeResult::CachedNodeResult(const uint64_t hash) : hash(hash) {}
+
+CachedNodeResult::~CachedNodeResult()
+{
+  for (Result &result : this->results.values()) {
+    result.free();
+  }
+}
+
+int64_t CachedNodeResult::size_in_bytes() const
+{
+  int64_t size = 0;
+  for (const Result &result : this->results.values()) {
+    size += result.size_in_bytes();
+  }
+  return size;
+}
+
+/* --------------------------------------------------------------------
+ * Cached Node Result Container.
+ */
+
+void CachedNodeResultContainer::reset()
+{
+  /* First, delete all resources that are no longer needed. */
+  map_.remove_if([](auto item) { return !item.value->needed; });
+
+  /* Second, reset the needed status of the remaining resources to false to ready them to track
+   * their needed status for the next evaluation. */
+  for (auto &value : map_.values()) {
+    value->needed = false;
+  }
+}
+
+const CachedNodeResult *CachedNodeResultContainer::get(const bNodeInstanceKey &key,
+                                                       const uint64_t hash)
+{
+  std::unique_ptr<CachedNodeResult> *cached_node_result = map_.lookup_ptr(key);
+  if (!cached_node_result || (*cached_node_result)->hash != hash) {
+    return nullptr;
+  }
+
+  (*cached_node_result)->needed = true;
+  return cached_node_result->get();
+}
+
+void CachedNodeResultContainer::add(Context &context,
+                                    const bNodeInstanceKey &key,
+                                    const uint64_t hash,
+                                    const Map<std::string, const Result *> &results)
+{
+  /* Remove the outdated results first to not count them against the limit. */
+  map_.remove(key);
+
+  std::unique_ptr<CachedNodeResult> cached_node_result = std::make_unique<CachedNodeResult>(hash);
+  for (const auto item : results.items()) {
+    Result cached_result = context.create_result(item.value->type(), item.value->precision());
+    cached_result.share_data(*item.value);
+    cached_node_result->results.add_new(item.key, cached_result);
+  }
+
+  int64_t cached_size = cached_node_result->size_in_bytes();
+  for (const std::unique_ptr<CachedNodeResult> &value : map_.values()) {
+    cached_size += value->size_in_bytes();
+  }
+
+  const int64_t size_limit = int64_t(U.memcachelimit) * 1024 * 1024;
+  if (cached_size > size_limit) {
+    return;
+  }
+
+  map_.add_new(key, std::move(cached_node_result));
+}
+
+}  // namespace blender::compositor
@@ -101,10 +101,12 @@ bool CompileState::should_compile_pixel_compile_unit(const bNode &node)
     return false;
   }
 
-  /* If the node is not a pixel node, then it can't be added to the pixel compile unit and the
-   * pixel compile unit is considered complete and should be compiled. */
+  /* If the node is not a pixel node, then it can't be added to the pixel compile unit. If it
+   * depends on the pixel compile unit, then the unit is considered complete and should be
+   * compiled. Otherwise, the node can be evaluated first, leaving the unit open for the pixel
+   * nodes that follow it in the schedule. */
   if (!is_pixel_node(node)) {
-    return true;
+    return this->is_node_dependent_on_pixel_compile_unit(node);
   }
 
   /* If the compile unit is single value and the given node is not or vice versa, then it can't be
@@ -128,6 +130,22 @@ bool CompileState::should_compile_pixel_compile_unit(const bNode &node)
   return false;
 }
 
+bool CompileState::is_node_dependent_on_pixel_compile_unit(const bNode &node)
+{
+  for (const bNodeSocket *input : node.input_sockets()) {
+    if (!is_socket_available(input)) {
+      continue;
+    }
+
+    const bNodeSocket *output = get_output_linked_to_input(*input);
+    if (output && pixel_compile_unit_.contains(&output->owner_node())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool CompileState::is_pixel_node_single_value(const bNode &node)
 {
   /* If any of the outputs are single-only outputs, then the node is operating on single values. */
@@ -2,7 +2,14 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <cstdint>
+#include <optional>
+#include <string>
+
 #include "BLI_assert.h"
+#include "BLI_hash.hh"
+#include "BLI_map.hh"
+#include "BLI_math_matrix_types.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_timeit.hh"
 #include "BLI_vector_set.hh"
@@ -13,15 +20,20 @@
 #include "BKE_node_runtime.hh"
 
 #include "GPU_debug.hh"
+#include "GPU_state.hh"
 
 #include "COM_algorithm_compute_preview.hh"
+#include "COM_cached_node_result.hh"
 #include "COM_context.hh"
 #include "COM_input_descriptor.hh"
 #include "COM_node_operation.hh"
 #include "COM_operation.hh"
+#include "COM_profiler.hh"
 #include "COM_result.hh"
 #include "COM_utilities.hh"
 
+#include "xxhash.h"
+
 namespace blender::compositor {
 
 NodeOperation::NodeOperation(Context &context, const bNode &node) : Operation(context), node_(node)
@@ -50,11 +62,32 @@ void NodeOperation::evaluate()
   if (this->context().use_gpu()) {
     GPU_debug_group_begin(this->node().typeinfo->idname.c_str());
   }
+  Profiler *profiler = this->context().profiler();
+  const bool synchronize_gpu = profiler && this->context().use_gpu() &&
+                               profiler->should_synchronize_gpu();
+  if (synchronize_gpu) {
+    GPU_finish();
+  }
   const timeit::TimePoint before_time = timeit::Clock::now();
   Operation::evaluate();
+  if (synchronize_gpu) {
+    GPU_finish();
+  }
   const timeit::TimePoint after_time = timeit::Clock::now();
-  if (this->context().profiler()) {
-    this->context().profiler()->set_node_evaluation_time(instance_key_, after_time - before_time);
+  if (profiler) {
+    profiler->set_node_evaluation_time(instance_key_, after_time - before_time);
+
+    int64_t results_size = 0;
+    for (const bNodeSocket *output : this->node().output_sockets()) {
+      if (!is_socket_available(output)) {
+        continue;
+      }
+      const Result &result = this->get_result(output->identifier);
+      if (result.is_allocated() && !result.is_single_value()) {
+        results_size += result.size_in_bytes();
+      }
+    }
+    profiler->add_node_results_size(instance_key_, results_size);
   }
   if (this->context().use_gpu()) {
     GPU_debug_group_end();
@@ -105,6 +138,129 @@ void NodeOperation::compute_preview()
   }
 }
 
+std::optional<uint64_t> NodeOperation::get_cache_state_hash() const
+{
+  return std::nullopt;
+}
+
+void NodeOperation::execute_or_use_cached_results()
+{
+  const std::optional<uint64_t> hash = this->compute_cache_hash();
+  if (!hash) {
+    this->execute();
+    return;
+  }
+
+  CachedNodeResultContainer &cache = this->context().cache_manager().cached_node_results;
+  const CachedNodeResult *cached_node_result = cache.get(instance_key_, *hash);
+
+  /* The results can only be reused if all needed outputs were computed and cached before. */
+  bool has_all_needed_results = cached_node_result != nullptr;
+  for (const bNodeSocket *output : this->node().output_sockets()) {
+    if (!has_all_needed_results) {
+      break;
+    }
+    if (is_socket_available(output) && this->get_result(output->identifier).should_compute()) {
+      has_all_needed_results = cached_node_result->results.contains(output->identifier);
+    }
+  }
+
+  if (Profiler *profiler = this->context().profiler()) {
+    if (has_all_needed_results) {
+      profiler->add_node_cache_hit(instance_key_);
+    }
+    else {
+      profiler->add_node_cache_miss(instance_key_);
+    }
+  }
+
+  if (has_all_needed_results) {
+    for (const bNodeSocket *output : this->node().output_sockets()) {
+      if (!is_socket_available(output)) {
+        continue;
+      }
+      Result &result = this->get_result(output->identifier);
+      if (result.should_compute()) {
+        result.share_data(cached_node_result->results.lookup(output->identifier));
+      }
+    }
+    return;
+  }
+
+  this->execute();
+
+  Map<std::string, const Result *> results;
+  for (const bNodeSocket *output : this->node().output_sockets()) {
+    if (!is_socket_available(output)) {
+      continue;
+    }
+    const Result &result = this->get_result(output->identifier);
+    if (result.is_allocated()) {
+      results.add_new(output->identifier, &result);
+    }
+  }
+  cache.add(this->context(), instance_key_, *hash, results);
+}
+
+/* Computes a hash of the given input, including the contents of its data. Returns std::nullopt
+ * if the input can't be hashed. */
+static std::optional<uint64_t> compute_input_hash(const Result &input)
+{
+  if (!input.is_allocated()) {
+    return std::nullopt;
+  }
+
+  if (input.is_single_value()) {
+    const GPointer value = input.single_value();
+    if (!value.type()->is_hashable()) {
+      return std::nullopt;
+    }
+    return get_default_hash(input.type(), value.type()->hash(value.get()));
+  }
+
+  const Domain &domain = input.domain();
+  const RealizationOptions &realization_options = domain.realization_options;
+  const uint64_t data_hash = XXH3_64bits(input.cpu_data().data(), input.size_in_bytes());
+  const uint64_t transformation_hash = XXH3_64bits(&domain.transformation,
+                                                   sizeof(domain.transformation));
+  return get_default_hash(get_default_hash(input.type(), input.precision(), domain.data_size),
+                          get_default_hash(realization_options.interpolation,
+                                           realization_options.extension_x,
+                                           realization_options.extension_y),
+                          data_hash,
+                          transformation_hash);
+}
+
+std::optional<uint64_t> NodeOperation::compute_cache_hash() const
+{
+  /* Hashing GPU inputs would require downloading them, and results allocated from the texture
+   * pool should not outlive the evaluation, so caching is only supported for CPU contexts. */
+  if (this->context().use_gpu() || instance_key_ == bke::NODE_INSTANCE_KEY_NONE) {
+    return std::nullopt;
+  }
+
+  const std::optional<uint64_t> state_hash = this->get_cache_state_hash();
+  if (!state_hash) {
+    return std::nullopt;
+  }
+
+  uint64_t hash = get_default_hash(*state_hash, StringRef(this->node().idname));
+  for (const bNodeSocket *input : this->node().input_sockets()) {
+    if (!is_socket_available(input)) {
+      continue;
+    }
+
+    const std::optional<uint64_t> input_hash = compute_input_hash(
+        this->get_input(input->identifier));
+    if (!input_hash) {
+      return std::nullopt;
+    }
+    hash = get_default_hash(hash, StringRef(input->identifier), *input_hash);
+  }
+
+  return hash;
+}
+
 const bNode &NodeOperation::node() const
 {
   return node_;
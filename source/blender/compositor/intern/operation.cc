@@ -26,7 +26,7 @@ Operation::~Operation() = default;
 void Operation::evaluate()
 {
   this->evaluate_input_processors();
-  this->execute();
+  this->execute_or_use_cached_results();
   this->compute_preview();
   this->release_inputs();
   this->context().evaluate_operation_post();
@@ -112,6 +112,11 @@ void Operation::evaluate_input_processors()
   }
 }
 
+void Operation::execute_or_use_cached_results()
+{
+  this->execute();
+}
+
 void Operation::compute_preview() {};
 
 void Operation::populate_result(StringRef identifier, Result result)
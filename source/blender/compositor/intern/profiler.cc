@@ -2,23 +2,145 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "BLI_string_ref.hh"
 #include "BLI_timeit.hh"
 
 #include "DNA_node_types.h"
 
+#include "BKE_node.hh"
+#include "BKE_node_runtime.hh"
+
 #include "COM_profiler.hh"
 
+#include "CLG_log.h"
+
 namespace blender::compositor {
 
+static CLG_LogRef LOG = {"compositor.profiler"};
+
+Profiler::Profiler() : synchronize_gpu_(CLOG_CHECK(&LOG, CLG_LEVEL_DEBUG)) {}
+
 Map<bNodeInstanceKey, timeit::Nanoseconds> &Profiler::get_nodes_evaluation_times()
 {
   return nodes_evaluation_times_;
 }
 
+Map<bNodeInstanceKey, Profiler::NodeStatistics> &Profiler::get_nodes_statistics()
+{
+  return nodes_statistics_;
+}
+
 void Profiler::set_node_evaluation_time(bNodeInstanceKey node_instance_key,
                                         timeit::Nanoseconds time)
 {
   nodes_evaluation_times_.lookup_or_add(node_instance_key, timeit::Nanoseconds::zero()) += time;
 }
 
+void Profiler::add_node_results_size(bNodeInstanceKey node_instance_key,
+                                     const int64_t size_in_bytes)
+{
+  nodes_statistics_.lookup_or_add_default(node_instance_key).results_size_in_bytes +=
+      size_in_bytes;
+}
+
+void Profiler::add_node_cache_hit(bNodeInstanceKey node_instance_key)
+{
+  nodes_statistics_.lookup_or_add_default(node_instance_key).cache_hits++;
+}
+
+void Profiler::add_node_cache_miss(bNodeInstanceKey node_instance_key)
+{
+  nodes_statistics_.lookup_or_add_default(node_instance_key).cache_misses++;
+}
+
+bool Profiler::should_synchronize_gpu() const
+{
+  return synchronize_gpu_;
+}
+
+/* Append a line for every profiled node in the given node tree to the given report, recursively
+ * going into node groups. Returns the total evaluation time of the profiled nodes. */
+static timeit::Nanoseconds append_node_tree_report(
+    const bNodeTree &node_tree,
+    const bNodeInstanceKey instance_key,
+    const std::string &path,
+    const Map<bNodeInstanceKey, timeit::Nanoseconds> &evaluation_times,
+    const Map<bNodeInstanceKey, Profiler::NodeStatistics> &statistics,
+    std::string &report)
+{
+  timeit::Nanoseconds total_time = timeit::Nanoseconds::zero();
+  node_tree.ensure_topology_cache();
+  for (const bNode *node : node_tree.all_nodes()) {
+    const bNodeInstanceKey node_instance_key = bke::node_instance_key(
+        instance_key, &node_tree, node);
+    const std::string node_path = path + node->name;
+
+    /* Nodes inside groups are measured as part of the group node as well, so don't count their
+     * times twice. */
+    if (node->is_group() && node->id) {
+      append_node_tree_report(*reinterpret_cast<const bNodeTree *>(node->id),
+                              node_instance_key,
+                              node_path + " > ",
+                              evaluation_times,
+                              statistics,
+                              report);
+    }
+
+    const timeit::Nanoseconds *time = evaluation_times.lookup_ptr(node_instance_key);
+    const Profiler::NodeStatistics *node_statistics = statistics.lookup_ptr(node_instance_key);
+    if (!time && !node_statistics) {
+      continue;
+    }
+
+    const double time_in_ms = time ? std::chrono::duration<double, std::milli>(*time).count() :
+                                     0.0;
+    const Profiler::NodeStatistics default_statistics;
+    const Profiler::NodeStatistics &node_data = node_statistics ? *node_statistics :
+                                                                  default_statistics;
+    report += fmt::format("  {}: {:.3f} ms, results {:.2f} MiB",
+                          node_path,
+                          time_in_ms,
+                          double(node_data.results_size_in_bytes) / (1024.0 * 1024.0));
+    if (node_data.cache_hits != 0 || node_data.cache_misses != 0) {
+      report += fmt::format(
+          ", cache hits {}, misses {}", node_data.cache_hits, node_data.cache_misses);
+    }
+    report += "\n";
+
+    if (time) {
+      total_time += *time;
+    }
+  }
+  return total_time;
+}
+
+void Profiler::log_report(const bNodeTree &node_tree,
+                          const int frame_number,
+                          const StringRef view_name) const
+{
+  if (!CLOG_CHECK(&LOG, CLG_LEVEL_DEBUG)) {
+    return;
+  }
+
+  std::string report;
+  const timeit::Nanoseconds total_time = append_node_tree_report(node_tree,
+                                                                 bke::NODE_INSTANCE_KEY_BASE,
+                                                                 "",
+                                                                 nodes_evaluation_times_,
+                                                                 nodes_statistics_,
+                                                                 report);
+  CLOG_DEBUG(&LOG,
+             "Profile of frame %d, view \"%s\", top level nodes took %.3f ms:\n%s",
+             frame_number,
+             std::string(view_name).c_str(),
+             std::chrono::duration<double, std::milli>(total_time).count(),
+             report.c_str());
+}
+
 }  // namespace blender::compositor
@@ -55,6 +55,13 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Write the evaluation timeline of the last graph evaluation in the Chrome trace event format,
+ * which can be viewed in Perfetto or `chrome://tracing`. The timeline is only recorded when
+ * depsgraph time debugging is enabled (`--debug-depsgraph-time`).
+ */
+void DEG_debug_trace_chrome(const Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
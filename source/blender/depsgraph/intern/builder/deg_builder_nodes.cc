@@ -373,6 +373,7 @@ void DepsgraphNodeBuilder::begin_build()
 {
   /* Store existing evaluated versions of datablock, so we can re-use
    * them for new ID nodes. */
+  id_info_hash_.reserve(graph_->id_nodes.size());
   for (IDNode *id_node : graph_->id_nodes) {
     /* It is possible that the ID does not need to have evaluated version in which case id_cow is
      * the same as id_orig. Additionally, such ID might have been removed, which makes the check
@@ -410,7 +411,7 @@ void DepsgraphNodeBuilder::begin_build()
   /* Make sure graph has no nodes left from previous state. */
   graph_->clear_all_nodes();
   graph_->operations.clear();
-  graph_->entry_tags.clear();
+  graph_->entry_tags.clear_and_keep_capacity();
 }
 
 /* Utility callbacks for `BKE_library_foreach_ID_link`, used to detect when an evaluated ID is
@@ -15,6 +15,10 @@
 
 #include "BKE_global.hh"
 
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
 namespace blender::deg {
 
 DepsgraphDebug::DepsgraphDebug() : flags(G.debug), graph_evaluation_start_time_(0) {}
@@ -53,6 +57,36 @@ double DepsgraphDebug::total_evaluation_time() const
   return graph_evaluation_total_time_;
 }
 
+void DepsgraphDebug::trace_record(const OperationNode *operation_node,
+                                  const double begin_time,
+                                  const double end_time)
+{
+  trace_recorded_operations_.local().append({operation_node, begin_time, end_time});
+}
+
+void DepsgraphDebug::trace_finalize()
+{
+  trace_events.clear();
+  int thread_index = 0;
+  for (Vector<RecordedOperation> &recorded_operations : trace_recorded_operations_) {
+    if (recorded_operations.is_empty()) {
+      continue;
+    }
+    for (const RecordedOperation &recorded : recorded_operations) {
+      const OperationNode *operation_node = recorded.operation_node;
+      TraceEvent event;
+      event.name = operation_node->identifier();
+      event.id_name = operation_node->owner->owner->name;
+      event.begin_time = recorded.begin_time - graph_evaluation_start_time_;
+      event.end_time = recorded.end_time - graph_evaluation_start_time_;
+      event.thread_index = thread_index;
+      trace_events.append(std::move(event));
+    }
+    recorded_operations.clear();
+    thread_index++;
+  }
+}
+
 bool terminal_do_color()
 {
   return (G.debug & G_DEBUG_DEPSGRAPH_PRETTY) != 0;
@@ -10,12 +10,29 @@
 
 #include <string>
 
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_vector.hh"
+
 #include "BKE_global.hh"  // IWYU pragma: keep
 
 namespace blender::deg {
 
+struct OperationNode;
+
 class DepsgraphDebug {
  public:
+  /* Evaluation of a single operation, as shown in the evaluation timeline. */
+  struct TraceEvent {
+    std::string name;
+    /* Name of the ID the operation belongs to. */
+    std::string id_name;
+    /* In seconds, relative to the start of the graph evaluation. */
+    double begin_time;
+    double end_time;
+    /* Index of the thread which evaluated the operation, only meaningful within one trace. */
+    int thread_index;
+  };
+
   DepsgraphDebug();
 
   bool do_time_debug() const;
@@ -25,6 +42,16 @@ class DepsgraphDebug {
 
   double total_evaluation_time() const;
 
+  /* Record evaluation of an operation in the timeline, can be called from any thread. */
+  void trace_record(const OperationNode *operation_node, double begin_time, double end_time);
+  /* Resolve operations recorded during the last evaluation into #trace_events. Needs to be called
+   * while the operation nodes are still valid. */
+  void trace_finalize();
+
+  /* Evaluation timeline of the last graph evaluation. Only recorded when time debugging is
+   * enabled. */
+  Vector<TraceEvent> trace_events;
+
   /* NOTE: Corresponds to G_DEBUG_DEPSGRAPH_* flags. */
   int flags;
 
@@ -42,6 +69,13 @@ class DepsgraphDebug {
   double graph_evaluation_start_time_;
   /* Total time of the last evaluation. */
   double graph_evaluation_total_time_;
+
+  struct RecordedOperation {
+    const OperationNode *operation_node;
+    double begin_time;
+    double end_time;
+  };
+  threading::EnumerableThreadSpecific<Vector<RecordedOperation>> trace_recorded_operations_;
 };
 
 #define DEG_DEBUG_PRINTF(depsgraph, type, ...) \
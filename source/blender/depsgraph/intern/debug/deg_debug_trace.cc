@@ -0,0 +1,68 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "DEG_depsgraph_debug.hh"
+
+#include <cinttypes>
+
+#include "BLI_utildefines.h"
+
+#include "intern/depsgraph.hh"
+
+namespace blender {
+
+namespace deg {
+namespace {
+
+void trace_fprint_escaped(FILE *fp, const std::string &str)
+{
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      fputc('\\', fp);
+      fputc(c, fp);
+    }
+    else if (uchar(c) < 0x20) {
+      fprintf(fp, "\\u%04x", int(c));
+    }
+    else {
+      fputc(c, fp);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace deg
+
+void DEG_debug_trace_chrome(const Depsgraph *graph, FILE *fp)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  const std::string &graph_name = deg_graph->debug.name;
+
+  fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  fprintf(fp, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"args\": {\"name\": \"");
+  deg::trace_fprint_escaped(fp, graph_name.empty() ? "Depsgraph" : graph_name);
+  fprintf(fp, "\"}}");
+  for (const deg::DepsgraphDebug::TraceEvent &event : deg_graph->debug.trace_events) {
+    /* Time-stamps and durations are in microseconds. */
+    const int64_t begin = int64_t(event.begin_time * 1e6);
+    const int64_t duration = int64_t((event.end_time - event.begin_time) * 1e6);
+    fprintf(fp, ",\n{\"name\": \"");
+    deg::trace_fprint_escaped(fp, event.name);
+    fprintf(fp, "\", \"cat\": \"");
+    deg::trace_fprint_escaped(fp, event.id_name);
+    fprintf(fp,
+            "\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, \"ts\": %" PRId64 ", \"dur\": %" PRId64
+            "}",
+            event.thread_index,
+            begin,
+            duration);
+  }
+  fprintf(fp, "\n]}\n");
+}
+
+}  // namespace blender
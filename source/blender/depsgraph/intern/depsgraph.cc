@@ -237,7 +237,11 @@ void Depsgraph::add_entry_tag(OperationNode *node)
 
 void Depsgraph::clear_all_nodes()
 {
+  /* This is used on relations rebuild, where the new graph is usually about as large as the old
+   * one: avoid growing the ID lookup table one re-hash at a time. */
+  const int64_t id_nodes_num = id_nodes.size();
   clear_id_nodes();
+  id_hash.reserve(id_nodes_num);
   delete time_source;
   time_source = nullptr;
   /* Memory used by the build allocator is now unused. Rebuild it from scratch. */
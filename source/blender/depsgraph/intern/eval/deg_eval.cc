@@ -8,20 +8,25 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 
 #include "intern/eval/deg_eval.h"
 
+#include "MEM_guardedalloc.h"
+
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
+#include "DNA_userdef_types.h"
 
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_query.hh"
@@ -79,6 +84,8 @@ enum class EvaluationStage {
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
+  /* Measure operation costs and prefer scheduling operations on the longest remaining path. */
+  bool use_critical_path;
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
@@ -88,13 +95,26 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 {
   blender::Depsgraph *depsgraph = reinterpret_cast<blender::Depsgraph *>(state->graph);
 
+  /* Count evaluated data like modifier results as depsgraph memory. */
+  static const int memory_category = MEM_memory_category_register("Depsgraph");
+  const MEM_MemoryCategoryScope memory_category_scope(memory_category);
+
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
-  if (state->do_stats) {
+  if (state->do_stats || state->use_critical_path) {
     const double start_time = BLI_time_now_seconds();
     operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    const double end_time = BLI_time_now_seconds();
+    const double duration = end_time - start_time;
+    if (state->do_stats) {
+      operation_node->stats.current_time += duration;
+      state->graph->debug.trace_record(operation_node, start_time, end_time);
+    }
+    if (state->use_critical_path) {
+      float &average = operation_node->eval_time_average;
+      average = (average == 0.0f) ? float(duration) : average * 0.75f + float(duration) * 0.25f;
+    }
   }
   else {
     operation_node->evaluate(depsgraph);
@@ -114,12 +134,34 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
 
   /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  if (!state->use_critical_path) {
+    evaluate_node(state, operation_node);
+
+    /* Schedule children. */
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    return;
+  }
+
+  /* Keep evaluating the child with the longest remaining path in this task, instead of letting it
+   * queue up behind operations which unlock less work. */
+  while (operation_node != nullptr) {
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node != nullptr && next_node->critical_path_time >= node->critical_path_time) {
+        BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+        return;
+      }
+      if (next_node != nullptr) {
+        BLI_task_pool_push(pool, deg_task_run_func, next_node, false, nullptr);
+      }
+      next_node = node;
+    });
+    operation_node = next_node;
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -185,6 +227,53 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
   state->need_update_pending_parents = false;
 }
 
+/* Calculate #OperationNode::critical_path_time for all operations, based on the evaluation times
+ * measured during previous updates. Cyclic relations are ignored, which makes the remaining graph
+ * acyclic. */
+void calculate_critical_path_times(Depsgraph *graph)
+{
+  /* Negative times are used to tag operations which have not been visited yet. */
+  constexpr float not_visited = -1.0f;
+  constexpr float in_progress = -2.0f;
+  for (OperationNode *node : graph->operations) {
+    node->critical_path_time = not_visited;
+  }
+
+  /* Iterative depth-first traversal, to compute children before their parents without recursing
+   * through long chains of operations. */
+  Vector<std::pair<OperationNode *, int64_t>> stack;
+  for (OperationNode *root : graph->operations) {
+    if (root->critical_path_time != not_visited) {
+      continue;
+    }
+    root->critical_path_time = in_progress;
+    stack.append({root, 0});
+    while (!stack.is_empty()) {
+      OperationNode *node = stack.last().first;
+      int64_t &link_index = stack.last().second;
+      if (link_index < node->outlinks.size()) {
+        const Relation *rel = node->outlinks[link_index++];
+        OperationNode *child = static_cast<OperationNode *>(rel->to);
+        if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && child->critical_path_time == not_visited) {
+          child->critical_path_time = in_progress;
+          stack.append({child, 0});
+        }
+        continue;
+      }
+      float longest_child_path = 0.0f;
+      for (const Relation *rel : node->outlinks) {
+        if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+          const OperationNode *child = static_cast<const OperationNode *>(rel->to);
+          longest_child_path = std::max(longest_child_path, child->critical_path_time);
+        }
+      }
+      const float cost = (node->flag & DEPSOP_FLAG_NEEDS_UPDATE) ? node->eval_time_average : 0.0f;
+      node->critical_path_time = cost + longest_child_path;
+      stack.remove_last();
+    }
+  }
+}
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   /* Clear tags and other things which needs to be clear. */
@@ -317,9 +406,22 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
-    BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  if (state->use_critical_path) {
+    /* Start with the operations which have the most work depending on them. */
+    Vector<OperationNode *> nodes;
+    schedule_graph(state, [&](OperationNode *node) { nodes.append(node); });
+    std::sort(nodes.begin(), nodes.end(), [](const OperationNode *a, const OperationNode *b) {
+      return a->critical_path_time > b->critical_path_time;
+    });
+    for (OperationNode *node : nodes) {
+      BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
+    }
+  }
+  else {
+    schedule_graph(state, [&](OperationNode *node) {
+      BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
+    });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -411,9 +513,14 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  state.use_critical_path = USER_DEVELOPER_TOOL_TEST(&U, use_depsgraph_critical_path_scheduling) &&
+                            (G.debug & G_DEBUG_DEPSGRAPH_NO_THREADS) == 0;
 
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
+  if (state.use_critical_path) {
+    calculate_critical_path_times(graph);
+  }
 
   /* Evaluation happens in several incremental steps:
    *
@@ -464,6 +571,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
    * synchronization. */
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
+    graph->debug.trace_finalize();
   }
 
   /* Clear any uncleared tags. */
@@ -37,6 +37,7 @@
 #include "DNA_ID.h"
 #include "DNA_anim_types.h"
 #include "DNA_armature_types.h"
+#include "DNA_key_types.h"
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 #include "DNA_object_types.h"
@@ -47,7 +48,6 @@
 
 #ifdef NESTED_ID_NASTY_WORKAROUND
 #  include "DNA_curve_types.h"
-#  include "DNA_key_types.h"
 #  include "DNA_lattice_types.h"
 #  include "DNA_light_types.h"
 #  include "DNA_linestyle_types.h"
@@ -835,6 +835,79 @@ ID *deg_expand_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_
   return id_cow;
 }
 
+/* Shape keys are tagged for copy-on-evaluation whenever one of their properties changes (e.g.
+ * while dragging a shape key value), while their key-block arrays can be very large. When the
+ * layout of the key did not change, update the existing evaluated copy in place. This avoids
+ * freeing and re-allocating all key-block arrays, and only writes the arrays which did change.
+ *
+ * Animation data and ID properties are not handled here, as they would need remapping.
+ *
+ * \return False if the evaluated copy is to be re-created from scratch instead. */
+bool key_update_eval_copy_inplace(const Key *key_orig, Key *key_cow)
+{
+  if (key_orig->adt != nullptr || key_cow->adt != nullptr) {
+    return false;
+  }
+  if (key_orig->id.properties != nullptr || key_orig->id.system_properties != nullptr ||
+      key_cow->id.properties != nullptr || key_cow->id.system_properties != nullptr)
+  {
+    return false;
+  }
+  if (!STREQ(key_orig->id.name, key_cow->id.name) || key_orig->elemsize != key_cow->elemsize) {
+    return false;
+  }
+  /* The evaluated copy points to the evaluated owner when it is part of the depsgraph. */
+  const ID *from_cow = key_cow->from;
+  if (from_cow != nullptr && from_cow->orig_id != nullptr) {
+    from_cow = from_cow->orig_id;
+  }
+  if (from_cow != key_orig->from) {
+    return false;
+  }
+  if (BLI_listbase_count(&key_orig->block) != BLI_listbase_count(&key_cow->block)) {
+    return false;
+  }
+  const KeyBlock *kb_orig = static_cast<const KeyBlock *>(key_orig->block.first);
+  const KeyBlock *kb_cow = static_cast<const KeyBlock *>(key_cow->block.first);
+  for (; kb_orig; kb_orig = kb_orig->next, kb_cow = kb_cow->next) {
+    if (kb_orig->totelem != kb_cow->totelem ||
+        (kb_orig->data == nullptr) != (kb_cow->data == nullptr))
+    {
+      return false;
+    }
+  }
+
+  key_cow->refkey = nullptr;
+  kb_orig = static_cast<const KeyBlock *>(key_orig->block.first);
+  for (KeyBlock &kb : key_cow->block) {
+    KeyBlock *next = kb.next;
+    KeyBlock *prev = kb.prev;
+    void *data = kb.data;
+    kb = *kb_orig;
+    kb.next = next;
+    kb.prev = prev;
+    kb.data = data;
+    if (data != nullptr) {
+      const size_t data_size = size_t(key_orig->elemsize) * size_t(kb_orig->totelem);
+      if (memcmp(data, kb_orig->data, data_size) != 0) {
+        memcpy(data, kb_orig->data, data_size);
+      }
+    }
+    if (kb_orig == key_orig->refkey) {
+      key_cow->refkey = &kb;
+    }
+    kb_orig = kb_orig->next;
+  }
+
+  memcpy(key_cow->elemstr, key_orig->elemstr, sizeof(key_cow->elemstr));
+  key_cow->totkey = key_orig->totkey;
+  key_cow->flag = key_orig->flag;
+  key_cow->type = key_orig->type;
+  key_cow->ctime = key_orig->ctime;
+  key_cow->uidgen = key_orig->uidgen;
+  return true;
+}
+
 }  // namespace
 
 ID *deg_update_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_node)
@@ -870,6 +943,14 @@ ID *deg_update_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_
     }
   }
 
+  if (GS(id_orig->name) == ID_KE && check_datablock_expanded(id_cow)) {
+    if (key_update_eval_copy_inplace(reinterpret_cast<const Key *>(id_orig),
+                                     reinterpret_cast<Key *>(id_cow)))
+    {
+      return id_cow;
+    }
+  }
+
   RuntimeBackup backup(depsgraph);
   backup.init_from_id(id_cow);
   deg_free_eval_copy_datablock(id_cow);
@@ -298,6 +298,12 @@ struct OperationNode : public Node {
   /* (OperationFlag) extra settings affecting evaluation. */
   int flag;
 
+  /* Running average of the evaluation time in seconds, and the estimated time of the longest
+   * chain of operations depending on this one (including itself). Only maintained when critical
+   * path scheduling is enabled. */
+  float eval_time_average = 0.0f;
+  float critical_path_time = 0.0f;
+
   DEG_DEPSNODE_DECLARE;
 };
 
@@ -57,6 +57,15 @@ struct SELECTID_Context {
   float4x4 persmat;
   uint64_t depsgraph_last_update = 0;
 
+  /**
+   * Copy of the whole select ID buffer, read back from the GPU once the same drawing is read more
+   * than once, so that repeated selections (e.g. circle select while dragging) don't have to wait
+   * on a GPU read-back each time. Cleared whenever the buffer is drawn again.
+   */
+  Array<uint> buffer_cache;
+  /** Number of reads of the select ID buffer since it was last drawn. */
+  int buffer_reads_num = 0;
+
   bool is_dirty(Depsgraph *depsgraph, RegionView3D *rv3d);
 };
 
@@ -232,6 +232,11 @@ MaterialPass MaterialModule::material_pass_get(Object *ob,
     }
     case GPU_MAT_QUEUED:
       queued_shaders_count++;
+      if (probe_capture == MAT_PROBE_NONE && pipeline_type != MAT_PIPE_SHADOW) {
+        /* Compile what is visible in the view before the shadow and light-probe variants, these
+         * are the materials that are missing the most while waiting. */
+        GPU_material_compilation_priority_set(matpass.gpumat, CompilationPriority::High);
+      }
       matpass.gpumat = inst_.shaders.material_shader_get(
           default_mat, default_mat->nodetree, pipeline_type, geometry_type, false, nullptr);
       break;
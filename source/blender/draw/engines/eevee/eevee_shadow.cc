@@ -769,7 +769,10 @@ void ShadowModule::sync_object(const Object *ob,
   const bool is_initialized = shadow_ob.resource_handle.is_valid();
   const bool has_jittered_transparency = has_transparent_shadows && data_.use_jitter;
   if (is_shadow_caster && (handle.recalc || !is_initialized || has_jittered_transparency)) {
-    if (handle.recalc && is_initialized) {
+    /* The previous bounds only need to be tagged if the caster could have moved or changed
+     * shape. For shading changes, tagging the current bounds covers the same pages. */
+    const bool bounds_changed = handle.recalc & (ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY);
+    if (bounds_changed && is_initialized) {
       past_casters_updated_.append(shadow_ob.resource_handle.raw());
     }
 
@@ -6,6 +6,8 @@
  * \ingroup draw
  */
 
+#include "MEM_guardedalloc.h"
+
 #include "DNA_curve_types.h"
 #include "DNA_curves_types.h"
 #include "DNA_grease_pencil_types.h"
@@ -486,8 +488,16 @@ void drw_batch_cache_validate(Object *ob)
   }
 }
 
+/** The memory category of the batch caches, see #MEM_memory_category_set. */
+static int batch_cache_memory_category()
+{
+  static const int category = MEM_memory_category_register("Draw Cache");
+  return category;
+}
+
 void drw_batch_cache_generate_requested(Object *ob, TaskGraph &task_graph)
 {
+  const MEM_MemoryCategoryScope memory_category_scope(batch_cache_memory_category());
   const DRWContext *draw_ctx = DRW_context_get();
   const Scene *scene = draw_ctx->scene;
   const enum eContextObjectMode mode = CTX_data_mode_enum_ex(
@@ -529,6 +539,7 @@ void drw_batch_cache_generate_requested(Object *ob, TaskGraph &task_graph)
 void drw_batch_cache_generate_requested_evaluated_mesh_or_curve(Object *ob, TaskGraph &task_graph)
 {
   /* NOTE: Logic here is duplicated from #drw_batch_cache_generate_requested. */
+  const MEM_MemoryCategoryScope memory_category_scope(batch_cache_memory_category());
 
   const DRWContext *draw_ctx = DRW_context_get();
   const Scene *scene = draw_ctx->scene;
@@ -46,15 +46,10 @@ static void ensure_dependency_data(MeshRenderData &mr,
   const bool request_corner_normals = vbo_requests.contains(VBOType::CornerNormal);
   const bool force_corner_normals = vbo_requests.contains(VBOType::Tangents);
 
-  if (request_face_normals) {
-    mesh_render_data_update_face_normals(mr);
-  }
-  if ((request_corner_normals && mr.normals_domain == bke::MeshNormalDomain::Corner &&
-       !mr.use_simplify_normals) ||
-      force_corner_normals)
-  {
-    mesh_render_data_update_corner_normals(mr);
-  }
+  const bool calc_corner_normals = (request_corner_normals &&
+                                    mr.normals_domain == bke::MeshNormalDomain::Corner &&
+                                    !mr.use_simplify_normals) ||
+                                   force_corner_normals;
 
   const bool calc_loose_geom = ibo_requests.contains(IBOType::Lines) ||
                                ibo_requests.contains(IBOType::LinesLoose) ||
@@ -66,9 +61,21 @@ static void ensure_dependency_data(MeshRenderData &mr,
                                vbo_requests.contains(VBOType::IndexEdge) ||
                                vbo_requests.contains(VBOType::EdgeFactor);
 
-  if (calc_loose_geom) {
-    mesh_render_data_update_loose_geom(mr, cache);
-  }
+  /* Normals and loose geometry are independent, and both can be costly for large meshes. */
+  threading::parallel_invoke(
+      [&]() {
+        if (request_face_normals) {
+          mesh_render_data_update_face_normals(mr);
+        }
+        if (calc_corner_normals) {
+          mesh_render_data_update_corner_normals(mr);
+        }
+      },
+      [&]() {
+        if (calc_loose_geom) {
+          mesh_render_data_update_loose_geom(mr, cache);
+        }
+      });
 }
 
 /** \} */
@@ -156,27 +163,25 @@ void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
 
   Array<gpu::IndexBufPtr, 16> created_ibos(ibos_to_create.size());
 
-  {
-    /* Because lines and loose lines are stored in the same buffer, they're handled separately
-     * rather than from potentially multiple threads in the parallel_for_each loop below. */
-    const int lines_index = ibos_to_create.as_span().first_index_try(IBOType::Lines);
-    const int loose_lines_index = ibos_to_create.as_span().first_index_try(IBOType::LinesLoose);
-    if (lines_index != -1 || loose_lines_index != -1) {
-      extract_lines(mr,
-                    lines_index == -1 ? nullptr : &created_ibos[lines_index],
-                    loose_lines_index == -1 ? nullptr : &created_ibos[loose_lines_index],
-                    cache.no_loose_wire);
-    }
-  }
+  /* Because lines and loose lines are stored in the same buffer, they're extracted by a single
+   * task rather than from potentially multiple threads. */
+  const int lines_index = ibos_to_create.as_span().first_index_try(IBOType::Lines);
+  const int loose_lines_index = ibos_to_create.as_span().first_index_try(IBOType::LinesLoose);
+  const int lines_task_index = lines_index == -1 ? loose_lines_index : lines_index;
 
-  threading::parallel_for_each(ibos_to_create.index_range(), [&](const int i) {
+  const auto extract_ibo = [&](const int i) {
     switch (ibos_to_create[i]) {
       case IBOType::Tris:
         created_ibos[i] = extract_tris(mr, mesh_render_data_faces_sorted_ensure(mr, mbc));
         break;
       case IBOType::Lines:
       case IBOType::LinesLoose:
-        /* Handled as a special case above. */
+        if (i == lines_task_index) {
+          extract_lines(mr,
+                        lines_index == -1 ? nullptr : &created_ibos[lines_index],
+                        loose_lines_index == -1 ? nullptr : &created_ibos[loose_lines_index],
+                        cache.no_loose_wire);
+        }
         break;
       case IBOType::Points:
         created_ibos[i] = extract_points(mr);
@@ -212,14 +217,14 @@ void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
         created_ibos[i] = extract_edituv_face_dots(mr);
         break;
     }
-  });
+  };
 
   Array<gpu::VertBufPtr, 16> created_vbos(vbos_to_create.size());
 
   const bool do_hq_normals = (scene.r.perf_flag & SCE_PERF_HQ_NORMALS) != 0 ||
                              GPU_use_hq_normals_workaround();
 
-  threading::parallel_for_each(vbos_to_create.index_range(), [&](const int i) {
+  const auto extract_vbo = [&](const int i) {
     switch (vbos_to_create[i]) {
       case VBOType::Position:
         created_vbos[i] = extract_positions(mr);
@@ -316,6 +321,21 @@ void mesh_buffer_cache_create_requested(TaskGraph & /*task_graph*/,
         created_vbos[i] = extract_paint_overlay_flags(mr);
         break;
     }
+  };
+
+  /* Schedule all index and vertex buffers in a single task set. Most extractors are parallelized
+   * internally, but some parts of them are serial (e.g. sorting faces by material, the lines
+   * extraction, or waiting on lazily computed caches). Running all of them at the same time lets
+   * other extractors fill the idle threads instead of waiting for the slowest buffer of each
+   * group. */
+  const int tasks_num = ibos_to_create.size() + vbos_to_create.size();
+  threading::parallel_for_each(IndexRange(tasks_num), [&](const int task) {
+    if (task < ibos_to_create.size()) {
+      extract_ibo(task);
+    }
+    else {
+      extract_vbo(task - ibos_to_create.size());
+    }
   });
 
   for (const int i : ibos_to_create.index_range()) {
@@ -1469,12 +1469,15 @@ static void grease_pencil_geom_batch_ensure(Object &object,
           }));
     }
 
-    /* Fill in IBO in series. */
+    /* Find the fill each curve belongs to. Will be `-1` if not a fill. */
+    Array<int> fill_index_by_curves;
+    Array<int> first_curves;
     if (fills) {
       int fill_index = 0;
 
-      Array<int> fill_index_by_curves(curves.curves_num(), -1);
-      Array<int> first_curves(curves.curves_num());
+      fill_index_by_curves.reinitialize(curves.curves_num());
+      fill_index_by_curves.fill(-1);
+      first_curves.reinitialize(curves.curves_num());
       array_utils::fill_index_range<int>(first_curves);
 
       for (const int curve_i : curves.curves_range()) {
@@ -1494,102 +1497,103 @@ static void grease_pencil_geom_batch_ensure(Object &object,
           fill_index++;
         }
       }
+    }
 
-      visible_strokes.foreach_index([&](const int curve_i) {
-        /* Will be `-1` if not a fill. */
-        const int fill_index = fill_index_by_curves[curve_i];
-
-        const bool is_filled = fill_index != -1;
-        const bool active_filled = triangles && is_filled && (first_curves[curve_i] == curve_i);
+    /* The fill triangles are only added for the first curve of a fill. */
+    auto get_active_fill_index = [&](const int curve_i) -> int {
+      if (!fills || !triangles) {
+        return -1;
+      }
+      const int fill_index = fill_index_by_curves[curve_i];
+      if (fill_index == -1 || first_curves[curve_i] != curve_i) {
+        return -1;
+      }
+      return fill_index;
+    };
 
-        if (active_filled) {
-          const int fill_index = fill_index_by_curves[curve_i];
-          const Span<int3> tris_slice = (*triangles)[fill_index];
-          const Span<int> fill = (*fills)[fill_index];
+    /* Compute where the triangles of each visible stroke start in the IBO, so that it can be
+     * filled in parallel. The triangles are still written in the order of the strokes. */
+    Array<int> ibo_offsets_data(visible_strokes.size() + 1);
+    visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+      const IndexRange points = points_by_curve[curve_i];
+      const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
+      int tris_num = (points.size() + (is_cyclic ? 1 : 0)) * 2;
+      const int fill_index = get_active_fill_index(curve_i);
+      if (fill_index != -1) {
+        tris_num += (*triangles)[fill_index].size();
+      }
+      ibo_offsets_data[pos] = tris_num;
+    });
+    const OffsetIndices<int> ibo_offsets = offset_indices::accumulate_counts_to_offsets(
+        ibo_offsets_data, triangle_ibo_index);
+    triangle_ibo_index = ibo_offsets_data.last();
+
+    visible_strokes.foreach_index(
+        [&](const int curve_i, const int pos) {
+          MutableSpan<uint3> stroke_ibo_data = triangle_ibo_data.slice(ibo_offsets[pos]);
+          int stroke_ibo_index = 0;
+
+          const int fill_index = get_active_fill_index(curve_i);
+          if (fill_index != -1) {
+            const Span<int3> tris_slice = (*triangles)[fill_index];
+            const Span<int> fill = (*fills)[fill_index];
+
+            IndexMaskMemory memory;
+            Array<int> fill_point_offset_data(fill.size() + 1);
+            OffsetIndices<int> fill_point_offset = offset_indices::gather_selected_offsets(
+                points_by_curve,
+                IndexMask::from_indices(fill, memory),
+                fill_point_offset_data.as_mutable_span());
+
+            Array<int> fill_point_to_pos_map(fill_point_offset_data.last());
+            threading::parallel_for(fill.index_range(), 1024, [&](const IndexRange range) {
+              for (const int i : range) {
+                fill_point_to_pos_map.as_mutable_span().slice(fill_point_offset[i]).fill(i);
+              }
+            });
 
-          IndexMaskMemory memory;
-          Array<int> fill_point_offset_data(fill.size() + 1);
-          OffsetIndices<int> fill_point_offset = offset_indices::gather_selected_offsets(
-              points_by_curve,
-              IndexMask::from_indices(fill, memory),
-              fill_point_offset_data.as_mutable_span());
-
-          Array<int> fill_point_to_pos_map(fill_point_offset_data.last());
-          threading::parallel_for(fill.index_range(), 1024, [&](const IndexRange range) {
-            for (const int i : range) {
-              fill_point_to_pos_map.as_mutable_span().slice(fill_point_offset[i]).fill(i);
+            auto point_to_id = [&](int32_t p) {
+              const int pos_ = fill_point_to_pos_map[p];
+              const int curve_ = fill[pos_];
+              const int fill_offset = fill_point_offset[pos_].first();
+              return (1 + p - fill_offset + verts_start_offsets[curve_]) << GP_VERTEX_ID_SHIFT;
+            };
+
+            /* Add all triangle indices to the index buffer. */
+            for (const int3 tri : tris_slice) {
+              stroke_ibo_data[stroke_ibo_index] = uint3(
+                  point_to_id(tri.x), point_to_id(tri.y), point_to_id(tri.z));
+              stroke_ibo_index++;
             }
-          });
-
-          auto point_to_id = [&](int32_t p) {
-            const int pos_ = fill_point_to_pos_map[p];
-            const int curve_ = fill[pos_];
-            const int fill_offset = fill_point_offset[pos_].first();
-            return (1 + p - fill_offset + verts_start_offsets[curve_]) << GP_VERTEX_ID_SHIFT;
-          };
-
-          /* Add all triangle indices to the index buffer. */
-          for (const int3 tri : tris_slice) {
-            triangle_ibo_data[triangle_ibo_index] = uint3(
-                point_to_id(tri.x), point_to_id(tri.y), point_to_id(tri.z));
-            triangle_ibo_index++;
           }
-        }
 
-        const IndexRange points = points_by_curve[curve_i];
-        const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
-        const int verts_start_offset = verts_start_offsets[curve_i];
-        const int num_verts = 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
-        const IndexRange verts_range = IndexRange(verts_start_offset, num_verts);
-
-        for (const int i : points.index_range()) {
-          const int idx = i + 1;
-          int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
-          triangle_ibo_index++;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
-          triangle_ibo_index++;
-        }
+          const IndexRange points = points_by_curve[curve_i];
+          const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
+          const int verts_start_offset = verts_start_offsets[curve_i];
+          const int num_verts = 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
+          const IndexRange verts_range = IndexRange(verts_start_offset, num_verts);
 
-        if (is_cyclic) {
-          const int idx = points.size() + 1;
-
-          int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
-          triangle_ibo_index++;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
-          triangle_ibo_index++;
-        }
-      });
-    }
-    else {
-      visible_strokes.foreach_index([&](const int curve_i, const int pos) {
-        const IndexRange points = points_by_curve[curve_i];
-        const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
-        const int verts_start_offset = verts_start_offsets[pos];
-        const int num_verts = 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
-        const IndexRange verts_range = IndexRange(verts_start_offset, num_verts);
-
-        for (const int i : points.index_range()) {
-          const int idx = i + 1;
-          int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
-          triangle_ibo_index++;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
-          triangle_ibo_index++;
-        }
+          for (const int i : points.index_range()) {
+            const int idx = i + 1;
+            int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
+            stroke_ibo_data[stroke_ibo_index] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
+            stroke_ibo_index++;
+            stroke_ibo_data[stroke_ibo_index] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
+            stroke_ibo_index++;
+          }
 
-        if (is_cyclic) {
-          const int idx = points.size() + 1;
+          if (is_cyclic) {
+            const int idx = points.size() + 1;
 
-          int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
-          triangle_ibo_index++;
-          triangle_ibo_data[triangle_ibo_index] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
-          triangle_ibo_index++;
-        }
-      });
-    }
+            int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
+            stroke_ibo_data[stroke_ibo_index] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
+            stroke_ibo_index++;
+            stroke_ibo_data[stroke_ibo_index] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
+            stroke_ibo_index++;
+          }
+          BLI_assert(stroke_ibo_index == stroke_ibo_data.size());
+        },
+        exec_mode::grain_size(512));
   };
 
   /* Mark last 2 verts as invalid. */
@@ -17,6 +17,7 @@
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 #include "BLI_sys_types.h"
+#include "BLI_task.hh"
 
 #include "GPU_material.hh"
 
@@ -331,7 +332,12 @@ inline ResourceHandleRange Manager::resource_handle(const ObjectRef &ref, float
                               ELEM(object_active->mode, OB_MODE_TEXTURE_PAINT, OB_MODE_SCULPT)) &&
                              ref.object->mode == object_active->mode;
   if (ref.duplis_) {
-    uint start = resource_len_;
+    const uint start = resource_len_;
+    const int64_t duplis_num = ref.duplis_->size();
+    if (duplis_num == 0) {
+      return ResourceHandleRange(
+          ResourceHandle(start, (ref.object->transflag & OB_NEG_SCALE) != 0), 0);
+    }
 
     ObjectBounds proto_bounds;
     proto_bounds.sync(*ref.object, inflate_bounds);
@@ -339,16 +345,31 @@ inline ResourceHandleRange Manager::resource_handle(const ObjectRef &ref, float
     ObjectInfos proto_info;
     proto_info.sync(ref, is_active_object, is_active_edit_mode);
 
-    for (const DupliObject *dupli : *ref.duplis_) {
-      matrix_buf.current().get_or_resize(resource_len_).sync(float4x4(dupli->mat));
-      bounds_buf.current().get_or_resize(resource_len_) = proto_bounds;
-
-      ObjectInfos &info = infos_buf.current().get_or_resize(resource_len_);
-      info = proto_info;
-      info.random = dupli->random_id * (1.0f / float(0xFFFFFFFF));
+    /* Scenes can contain a very large number of instances of the same object. Allocate the
+     * resources for all of them at once, so that they can be filled in parallel. Inverting the
+     * instance matrices is the main cost here. */
+    const int64_t end = start + duplis_num;
+    matrix_buf.current().get_or_resize(end - 1);
+    bounds_buf.current().get_or_resize(end - 1);
+    infos_buf.current().get_or_resize(end - 1);
+    MutableSpan<ObjectMatrices> matrices(matrix_buf.current().data(), end);
+    MutableSpan<ObjectBounds> bounds(bounds_buf.current().data(), end);
+    MutableSpan<ObjectInfos> infos(infos_buf.current().data(), end);
+
+    const VectorList<DupliObject *> &duplis = *ref.duplis_;
+    threading::parallel_for(IndexRange(duplis_num), 1024, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        const DupliObject *dupli = duplis[i];
+        matrices[start + i].sync(float4x4(dupli->mat));
+        bounds[start + i] = proto_bounds;
+
+        ObjectInfos &info = infos[start + i];
+        info = proto_info;
+        info.random = dupli->random_id * (1.0f / float(0xFFFFFFFF));
+      }
+    });
+    resource_len_ += duplis_num;
 
-      resource_len_++;
-    }
     return ResourceHandleRange(ResourceHandle(start, (ref.object->transflag & OB_NEG_SCALE) != 0),
                                resource_len_ - start);
   }
@@ -37,6 +37,8 @@
 #include "attribute_convert.hh"
 #include "bmesh.hh"
 
+#include <xxhash.h>
+
 namespace blender {
 
 template<> struct DefaultHash<draw::pbvh::AttributeRequest> {
@@ -99,6 +101,13 @@ class DrawCacheImpl : public DrawCache {
      * different sets of attributes).
      */
     BitVector<> dirty_nodes;
+    /**
+     * Hashes of fixed-size chunks of each node's vertex buffer data, from the last time it was
+     * uploaded. Used to only upload the parts of the buffer that actually changed. Since strokes
+     * usually only affect part of a node, and tagging is often conservative, this avoids most of
+     * the host to device transfers while sculpting.
+     */
+    Vector<Array<uint64_t, 0>> chunk_hashes;
     /**
      * Mark attribute values dirty for specific nodes. The next time the attribute is requested,
      * the values will be extracted again.
@@ -514,6 +523,22 @@ void DrawCacheImpl::free_nodes_with_changed_topology(const bke::pbvh::Tree &pbvh
   }
 }
 
+/**
+ * The buffers use dynamic usage so that the host copy of the data is kept after uploading. When
+ * the size is unchanged, the existing allocation is reused and only the changed parts are
+ * uploaded again (see #flush_vbo_data).
+ */
+static void ensure_vbo_size(const GPUVertFormat &format, const int verts_num, gpu::VertBufPtr &vbo)
+{
+  if (!vbo) {
+    vbo = gpu::VertBufPtr(GPU_vertbuf_create_with_format_ex(format, GPU_USAGE_DYNAMIC));
+  }
+  else if (GPU_vertbuf_get_vertex_len(vbo.get()) == verts_num && !vbo->data<uchar>().is_empty()) {
+    return;
+  }
+  GPU_vertbuf_data_alloc(*vbo, verts_num);
+}
+
 BLI_NOINLINE static void ensure_vbos_allocated_mesh(const Object &object,
                                                     const GPUVertFormat &format,
                                                     const IndexMask &node_mask,
@@ -523,10 +548,7 @@ BLI_NOINLINE static void ensure_vbos_allocated_mesh(const Object &object,
   const Span<bke::pbvh::MeshNode> nodes = pbvh.nodes<bke::pbvh::MeshNode>();
   node_mask.foreach_index(
       [&](const int i) {
-        if (!vbos[i]) {
-          vbos[i] = gpu::VertBufPtr(GPU_vertbuf_create_with_format(format));
-        }
-        GPU_vertbuf_data_alloc(*vbos[i], nodes[i].corners_num());
+        ensure_vbo_size(format, nodes[i].corners_num(), vbos[i]);
       },
       exec_mode::grain_size(64));
 }
@@ -542,13 +564,10 @@ BLI_NOINLINE static void ensure_vbos_allocated_grids(const Object &object,
   const SubdivCCG &subdiv_ccg = *object.runtime->sculpt_session->subdiv_ccg;
   node_mask.foreach_index(
       [&](const int i) {
-        if (!vbos[i]) {
-          vbos[i] = gpu::VertBufPtr(GPU_vertbuf_create_with_format(format));
-        }
         const int verts_per_grid = use_flat_layout[i] ? square_i(subdiv_ccg.grid_size - 1) * 4 :
                                                         square_i(subdiv_ccg.grid_size);
         const int verts_num = nodes[i].grids().size() * verts_per_grid;
-        GPU_vertbuf_data_alloc(*vbos[i], verts_num);
+        ensure_vbo_size(format, verts_num, vbos[i]);
       },
       exec_mode::grain_size(64));
 }
@@ -562,13 +581,10 @@ BLI_NOINLINE static void ensure_vbos_allocated_bmesh(const Object &object,
   const Span<bke::pbvh::BMeshNode> nodes = pbvh.nodes<bke::pbvh::BMeshNode>();
   node_mask.foreach_index(
       [&](const int i) {
-        if (!vbos[i]) {
-          vbos[i] = gpu::VertBufPtr(GPU_vertbuf_create_with_format(format));
-        }
         const Set<BMFace *, 0> &faces = BKE_pbvh_bmesh_node_faces(
             &const_cast<bke::pbvh::BMeshNode &>(nodes[i]));
         const int verts_num = count_visible_tris_bmesh(faces) * 3;
-        GPU_vertbuf_data_alloc(*vbos[i], verts_num);
+        ensure_vbo_size(format, verts_num, vbos[i]);
       },
       exec_mode::grain_size(64));
 }
@@ -1695,10 +1711,72 @@ BitSpan DrawCacheImpl::ensure_use_flat_layout(const Object &object,
   return use_flat_layout_;
 }
 
+/** The granularity of change detection for vertex buffer uploads. */
+static constexpr int64_t vbo_chunk_size = 16 * 1024;
+
+static bool vbo_needs_full_upload(const gpu::VertBuf &vbo)
+{
+  return GPU_vertbuf_get_status(&vbo) & GPU_VERTBUF_DATA_DIRTY;
+}
+
+/**
+ * Update the stored chunk hashes for the buffer's data.
+ * \return The byte range containing all chunks that changed since the last upload.
+ */
+static IndexRange update_chunk_hashes(const Span<uchar> data, Array<uint64_t, 0> &hashes)
+{
+  const int64_t chunks_num = int64_t(divide_ceil_ul(data.size(), vbo_chunk_size));
+  const bool all_changed = hashes.size() != chunks_num;
+  if (all_changed) {
+    hashes.reinitialize(chunks_num);
+  }
+  int64_t first_changed = chunks_num;
+  int64_t last_changed = -1;
+  for (const int64_t chunk : IndexRange(chunks_num)) {
+    const IndexRange range = IndexRange(chunk * vbo_chunk_size, vbo_chunk_size)
+                                 .intersect(data.index_range());
+    const uint64_t hash = XXH3_64bits(data.slice(range).data(), range.size());
+    if (all_changed || hash != hashes[chunk]) {
+      hashes[chunk] = hash;
+      first_changed = std::min(first_changed, chunk);
+      last_changed = chunk;
+    }
+  }
+  if (last_changed == -1) {
+    return {};
+  }
+  return IndexRange::from_begin_end(first_changed * vbo_chunk_size,
+                                    std::min((last_changed + 1) * vbo_chunk_size, data.size()));
+}
+
 BLI_NOINLINE static void flush_vbo_data(const Span<gpu::VertBufPtr> vbos,
+                                        const MutableSpan<Array<uint64_t, 0>> chunk_hashes,
                                         const IndexMask &node_mask)
 {
-  node_mask.foreach_index([&](const int i) { GPU_vertbuf_use(vbos[i].get()); });
+  /* Detect which parts of the buffers changed in parallel, the GPU module can only be used from
+   * the main thread. Newly allocated buffers have to be uploaded entirely anyway. */
+  Array<IndexRange> changed_ranges(node_mask.size());
+  node_mask.foreach_index(
+      [&](const int i, const int pos) {
+        changed_ranges[pos] = update_chunk_hashes(vbos[i]->data<uchar>(), chunk_hashes[i]);
+      },
+      exec_mode::grain_size(1));
+
+  node_mask.foreach_index([&](const int i, const int pos) {
+    gpu::VertBuf &vbo = *vbos[i];
+    if (vbo_needs_full_upload(vbo)) {
+      GPU_vertbuf_use(&vbo);
+      return;
+    }
+    const IndexRange range = changed_ranges[pos];
+    if (range.is_empty()) {
+      return;
+    }
+    /* Bind the buffer so that #GPU_vertbuf_update_sub can work. */
+    GPU_vertbuf_use(&vbo);
+    GPU_vertbuf_update_sub(
+        &vbo, range.start(), range.size(), vbo.data<uchar>().slice(range).data());
+  });
 }
 
 Span<gpu::VertBufPtr> DrawCacheImpl::ensure_attribute_data(const Object &object,
@@ -1710,6 +1788,7 @@ Span<gpu::VertBufPtr> DrawCacheImpl::ensure_attribute_data(const Object &object,
   AttributeData &data = attribute_vbos_.lookup_or_add_default(attr);
   Vector<gpu::VertBufPtr> &vbos = data.vbos;
   vbos.resize(pbvh.nodes_num());
+  data.chunk_hashes.resize(pbvh.nodes_num());
 
   /* The nodes we recompute here are a combination of:
    *   1. null VBOs, which correspond to nodes that either haven't been drawn before, or have been
@@ -1806,7 +1885,7 @@ Span<gpu::VertBufPtr> DrawCacheImpl::ensure_attribute_data(const Object &object,
    * avoid unnecessary processing in subsequent redraws. */
   dirty_mask.foreach_index_optimized<int>([&](const int i) { data.dirty_nodes[i].reset(); });
 
-  flush_vbo_data(vbos, mask);
+  flush_vbo_data(vbos, data.chunk_hashes, mask);
 
   return vbos;
 }
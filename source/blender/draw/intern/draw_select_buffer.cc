@@ -8,6 +8,7 @@
  * Utilities to read id buffer created in select_engine.
  */
 
+#include <algorithm>
 #include <cfloat>
 
 #include "BLI_math_matrix.hh"
@@ -89,6 +90,8 @@ uint *DRW_select_buffer_read(
     if (select_ctx->is_dirty(depsgraph, rv3d)) {
       /* Update drawing. */
       DRW_draw_select_id(depsgraph, region, v3d);
+      select_ctx->buffer_cache = {};
+      select_ctx->buffer_reads_num = 0;
     }
 
     if (select_ctx->max_index_drawn_len > 1) {
@@ -99,17 +102,51 @@ uint *DRW_select_buffer_read(
       buf_len = BLI_rcti_size_x(rect) * BLI_rcti_size_y(rect);
       buf = MEM_new_array_uninitialized<uint>(buf_len, __func__);
 
+      const int64_t region_len = int64_t(region->winx) * int64_t(region->winy);
+      if (select_ctx->buffer_cache.size() != region_len) {
+        select_ctx->buffer_cache = {};
+      }
+
       gpu::FrameBuffer *select_id_fb = DRW_engine_select_framebuffer_get();
-      GPU_framebuffer_bind(select_id_fb);
-      GPU_framebuffer_read_color(select_id_fb,
-                                 rect_clamp.xmin,
-                                 rect_clamp.ymin,
-                                 BLI_rcti_size_x(&rect_clamp),
-                                 BLI_rcti_size_y(&rect_clamp),
-                                 1,
-                                 0,
-                                 GPU_DATA_UINT,
-                                 buf);
+      if (select_ctx->buffer_cache.is_empty() && select_ctx->buffer_reads_num > 0) {
+        /* The same drawing is read more than once, read all of it back once so that this and
+         * the following reads don't have to synchronize with the GPU. */
+        select_ctx->buffer_cache.reinitialize(region_len);
+        GPU_framebuffer_bind(select_id_fb);
+        GPU_framebuffer_read_color(select_id_fb,
+                                   0,
+                                   0,
+                                   region->winx,
+                                   region->winy,
+                                   1,
+                                   0,
+                                   GPU_DATA_UINT,
+                                   select_ctx->buffer_cache.data());
+      }
+      select_ctx->buffer_reads_num++;
+
+      if (!select_ctx->buffer_cache.is_empty()) {
+        const int clamp_width = BLI_rcti_size_x(&rect_clamp);
+        uint *buf_row = buf;
+        for (int y = rect_clamp.ymin; y < rect_clamp.ymax; y++) {
+          const uint *cache_row = &select_ctx->buffer_cache[int64_t(y) * region->winx +
+                                                            rect_clamp.xmin];
+          std::copy_n(cache_row, clamp_width, buf_row);
+          buf_row += clamp_width;
+        }
+      }
+      else {
+        GPU_framebuffer_bind(select_id_fb);
+        GPU_framebuffer_read_color(select_id_fb,
+                                   rect_clamp.xmin,
+                                   rect_clamp.ymin,
+                                   BLI_rcti_size_x(&rect_clamp),
+                                   BLI_rcti_size_y(&rect_clamp),
+                                   1,
+                                   0,
+                                   GPU_DATA_UINT,
+                                   buf);
+      }
 
       if (!BLI_rcti_compare(rect, &rect_clamp)) {
         /* The rect has been clamped so we need to realign the buffer and fill in the blanks */
@@ -477,6 +514,7 @@ void DRW_select_buffer_context_create(Depsgraph *depsgraph,
 
   select_ctx->select_mode = select_mode;
   select_ctx->persmat = float4x4::zero();
+  select_ctx->buffer_cache = {};
 }
 
 /** \} */
@@ -46,16 +46,22 @@ static OffsetIndices<int> build_bmesh_face_offsets(const BMesh &bm, Array<int> &
   return offset_indices::accumulate_counts_to_offsets(r_offset_data);
 }
 
+static IndexMask calc_visible_bm_faces(const BMesh &bm,
+                                       const bool sync_selection,
+                                       IndexMaskMemory &memory)
+{
+  return IndexMask::from_predicate(IndexRange(bm.totface), memory, [&](const int face) {
+    return !skip_bm_face(*BM_face_at_index(&const_cast<BMesh &>(bm), face), sync_selection);
+  });
+}
+
 static gpu::IndexBufPtr extract_edituv_tris_bm(const MeshRenderData &mr, const bool sync_selection)
 {
   const Span<std::array<BMLoop *, 3>> looptris = mr.edit_bmesh->looptris;
   const BMesh &bm = *mr.bm;
 
   IndexMaskMemory memory;
-  const IndexMask selection = IndexMask::from_predicate(
-      IndexRange(bm.totface), memory, [&](const int face) {
-        return !skip_bm_face(*BM_face_at_index(&const_cast<BMesh &>(bm), face), sync_selection);
-      });
+  const IndexMask selection = calc_visible_bm_faces(bm, sync_selection, memory);
 
   if (selection.size() == bm.totface) {
     GPUIndexBufBuilder builder;
@@ -259,34 +265,36 @@ gpu::IndexBufPtr extract_edituv_tris_subdiv(const MeshRenderData &mr,
 static gpu::IndexBufPtr extract_edituv_lines_bm(const MeshRenderData &mr,
                                                 const bool sync_selection)
 {
+  const BMesh &bm = *mr.bm;
+
+  /* Every corner of a visible face adds a line, so the visible faces can be counted first, which
+   * allows filling the data array in parallel. */
+  IndexMaskMemory memory;
+  const IndexMask selection = calc_visible_bm_faces(bm, sync_selection, memory);
+
+  Array<int> face_offset_data;
+  const OffsetIndices faces = build_bmesh_face_offsets(bm, face_offset_data);
+
+  Array<int> selected_face_offset_data(selection.size() + 1);
+  const OffsetIndices selected_faces = offset_indices::gather_selected_offsets(
+      faces, selection, selected_face_offset_data);
+
   GPUIndexBufBuilder builder;
-  GPU_indexbuf_init(&builder, GPU_PRIM_LINES, mr.corners_num, mr.corners_num);
+  GPU_indexbuf_init(&builder, GPU_PRIM_LINES, selected_faces.total_size(), mr.corners_num);
   MutableSpan<uint2> data = GPU_indexbuf_get_data(&builder).cast<uint2>();
-  int line_index = 0;
 
-  const BMFace *face;
-  BMIter f_iter;
-  BM_ITER_MESH (face, &f_iter, mr.bm, BM_FACES_OF_MESH) {
-    if (skip_bm_face(*face, sync_selection)) {
-      continue;
-    }
-    const BMLoop *loop = BM_FACE_FIRST_LOOP(face);
-    for ([[maybe_unused]] const int i : IndexRange(face->len)) {
-      data[line_index++] = uint2(BM_elem_index_get(loop), BM_elem_index_get(loop->next));
-      loop = loop->next;
-    }
-  }
+  selection.foreach_index(
+      [&](const int face_index, const int mask) {
+        const BMFace &face = *BM_face_at_index(&const_cast<BMesh &>(bm), face_index);
+        const BMLoop *loop = BM_FACE_FIRST_LOOP(&face);
+        for (const int line : selected_faces[mask]) {
+          data[line] = uint2(BM_elem_index_get(loop), BM_elem_index_get(loop->next));
+          loop = loop->next;
+        }
+      },
+      exec_mode::grain_size(4096));
 
-  /* Only upload the part of the index buffer that is used. Alternatively it might be beneficial to
-   * count the number of visible edges first, especially if that allows parallelizing filling the
-   * data array. */
-  builder.index_len = line_index * 2;
-  builder.index_min = 0;
-  builder.index_max = mr.corners_num;
-  builder.uses_restart_indices = false;
-  gpu::IndexBufPtr result = gpu::IndexBufPtr(GPU_indexbuf_calloc());
-  GPU_indexbuf_build_in_place(&builder, result.get());
-  return result;
+  return gpu::IndexBufPtr(GPU_indexbuf_build_ex(&builder, 0, mr.corners_num, false));
 }
 
 static gpu::IndexBufPtr extract_edituv_lines_mesh(const MeshRenderData &mr,
@@ -502,23 +510,37 @@ gpu::IndexBufPtr extract_edituv_lines_subdiv(const MeshRenderData &mr,
 /** \name Extract Edit UV Points Indices
  * \{ */
 
-static void extract_edituv_points_bm(const MeshRenderData &mr,
-                                     const bool sync_selection,
-                                     GPUIndexBufBuilder &builder)
+static gpu::IndexBufPtr extract_edituv_points_bm(const MeshRenderData &mr,
+                                                 const bool sync_selection)
 {
   const BMesh &bm = *mr.bm;
-  const BMFace *face;
-  BMIter f_iter;
-  BM_ITER_MESH (face, &f_iter, &const_cast<BMesh &>(bm), BM_FACES_OF_MESH) {
-    if (skip_bm_face(*face, sync_selection)) {
-      continue;
-    }
-    const BMLoop *loop = BM_FACE_FIRST_LOOP(face);
-    for ([[maybe_unused]] const int i : IndexRange(face->len)) {
-      GPU_indexbuf_add_point_vert(&builder, BM_elem_index_get(loop));
-      loop = loop->next;
-    }
-  }
+
+  IndexMaskMemory memory;
+  const IndexMask selection = calc_visible_bm_faces(bm, sync_selection, memory);
+
+  Array<int> face_offset_data;
+  const OffsetIndices faces = build_bmesh_face_offsets(bm, face_offset_data);
+
+  Array<int> selected_face_offset_data(selection.size() + 1);
+  const OffsetIndices selected_faces = offset_indices::gather_selected_offsets(
+      faces, selection, selected_face_offset_data);
+
+  GPUIndexBufBuilder builder;
+  GPU_indexbuf_init(&builder, GPU_PRIM_POINTS, selected_faces.total_size(), mr.corners_num);
+  MutableSpan<uint32_t> data = GPU_indexbuf_get_data(&builder);
+
+  selection.foreach_index(
+      [&](const int face_index, const int mask) {
+        const BMFace &face = *BM_face_at_index(&const_cast<BMesh &>(bm), face_index);
+        const BMLoop *loop = BM_FACE_FIRST_LOOP(&face);
+        for (const int point : selected_faces[mask]) {
+          data[point] = BM_elem_index_get(loop);
+          loop = loop->next;
+        }
+      },
+      exec_mode::grain_size(4096));
+
+  return gpu::IndexBufPtr(GPU_indexbuf_build_ex(&builder, 0, mr.corners_num, false));
 }
 
 static void extract_edituv_points_mesh(const MeshRenderData &mr,
@@ -552,14 +574,13 @@ gpu::IndexBufPtr extract_edituv_points(const MeshRenderData &mr)
 {
   const bool sync_selection = (mr.toolsettings->uv_flag & UV_FLAG_SELECT_SYNC) != 0;
 
-  GPUIndexBufBuilder builder;
-  GPU_indexbuf_init(&builder, GPU_PRIM_POINTS, mr.corners_num, mr.corners_num);
   if (mr.extract_type == MeshExtractType::BMesh) {
-    extract_edituv_points_bm(mr, sync_selection, builder);
-  }
-  else {
-    extract_edituv_points_mesh(mr, sync_selection, builder);
+    return extract_edituv_points_bm(mr, sync_selection);
   }
+
+  GPUIndexBufBuilder builder;
+  GPU_indexbuf_init(&builder, GPU_PRIM_POINTS, mr.corners_num, mr.corners_num);
+  extract_edituv_points_mesh(mr, sync_selection, builder);
   return gpu::IndexBufPtr(GPU_indexbuf_build(&builder));
 }
 
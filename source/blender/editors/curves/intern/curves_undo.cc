@@ -6,6 +6,7 @@
  * \ingroup edcurves
  */
 
+#include "BLI_memory_counter.hh"
 #include "BLI_task.hh"
 
 #include "BKE_context.hh"
@@ -71,6 +72,15 @@ static bool step_encode(bContext *C, Main *bmain, UndoStep *us_p)
     }
   });
 
+  /* The arrays are shared with the edited geometry and other steps until they are modified, so
+   * this is an upper bound of the memory that is owned by the step. */
+  MemoryCount memory;
+  MemoryCounter memory_counter(memory);
+  for (const StepObject &object : us->objects) {
+    object.geometry.count_memory(memory_counter);
+  }
+  us->step.data_size = memory.total_bytes;
+
   bmain->is_memfile_undo_flush_needed = true;
 
   return true;
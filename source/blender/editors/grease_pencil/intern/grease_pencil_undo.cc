@@ -6,6 +6,7 @@
  * \ingroup edgrease_pencil
  */
 
+#include "BLI_memory_counter.hh"
 #include "BLI_task.hh"
 
 #include "BKE_context.hh"
@@ -146,6 +147,11 @@ class StepDrawingGeometry : public StepDrawingGeometryBase {
      * same, to avoid recomputing the caches all the time for all drawings? */
     drawing_geometry.wrap().tag_topology_changed();
   }
+
+  void count_memory(MemoryCounter &memory) const
+  {
+    geometry_.count_memory(memory);
+  }
 };
 
 class StepDrawingReference : public StepDrawingGeometryBase {
@@ -306,6 +312,14 @@ class StepObject {
     DEG_id_tag_update(&grease_pencil.id, ID_RECALC_GEOMETRY);
   }
 
+  void count_memory(MemoryCounter &memory) const
+  {
+    for (const StepDrawingGeometry &drawing : drawings_geometry_) {
+      drawing.count_memory(memory);
+    }
+    layer_attributes_.count_memory(memory);
+  }
+
   void foreach_id_ref(UndoTypeForEachIDRefFn foreach_ID_ref_fn, void *user_data)
   {
     foreach_ID_ref_fn(user_data, reinterpret_cast<UndoRefID *>(&this->obedit_ref));
@@ -341,6 +355,15 @@ static bool step_encode(bContext *C, Main *bmain, UndoStep *us_p)
     }
   });
 
+  /* Used for the undo memory limit. Drawings that are still shared with the edited data are
+   * counted as well. */
+  MemoryCount memory;
+  MemoryCounter memory_counter(memory);
+  for (const StepObject &step_object : us->objects) {
+    step_object.count_memory(memory_counter);
+  }
+  us->step.data_size = memory.total_bytes;
+
   bmain->is_memfile_undo_flush_needed = true;
 
   return true;
@@ -106,6 +106,8 @@ struct FileIndexerType {
    * entries field, `r_read_entries_len` must be set to `0` and the function must return
    * `eFileIndexerResult::FILE_INDEXER_NEEDS_UPDATE`. In this case the blend file will read from
    * the blend file and the `update_index` function will be called.
+   *
+   * Indices of multiple blend files can be read in parallel, so this callback must be thread-safe.
    */
   FileIndexerReadIndexFunc read_index;
 
@@ -164,6 +164,12 @@ struct EDBMUpdate_Params {
  * So many tools call these that we better make it a generic function.
  */
 void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params);
+/**
+ * Same as #EDBM_update, for operators that only moved the vertices tagged with \a hflag and
+ * didn't change the topology. Normals and tessellation are only recalculated for the geometry
+ * around the moved vertices, unless most of the mesh is affected.
+ */
+void EDBM_update_verts_moved(Mesh *mesh, char hflag, const EDBMUpdate_Params *params);
 /**
  * Bad level call from Python API.
  */
@@ -650,7 +650,9 @@ void WM_OT_usd_export(wmOperatorType *ot)
                   "use_instancing",
                   false,
                   "Instancing",
-                  "Export instanced objects as references in USD rather than real objects");
+                  "Export instanced objects as references in USD rather than real objects. "
+                  "For static exports, meshes with identical data also reference a single "
+                  "mesh");
 
   RNA_def_enum(ot->srna,
                "evaluation_mode",
@@ -2806,7 +2806,13 @@ static wmOperatorStatus edbm_do_smooth_vertex_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = calc_normals;
     params.is_destructive = false;
-    EDBM_update(id_cast<Mesh *>(obedit->data), &params);
+    if (calc_normals) {
+      EDBM_update(id_cast<Mesh *>(obedit->data), &params);
+    }
+    else {
+      /* Without mirroring, only the selected vertices have been moved. */
+      EDBM_update_verts_moved(id_cast<Mesh *>(obedit->data), BM_ELEM_SELECT, &params);
+    }
   }
 
   if (tot_selected == 0 && !tot_locked) {
@@ -2928,7 +2934,13 @@ static wmOperatorStatus edbm_do_smooth_laplacian_vertex_exec(bContext *C, wmOper
     params.calc_looptris = true;
     params.calc_normals = calc_normals;
     params.is_destructive = false;
-    EDBM_update(id_cast<Mesh *>(obedit->data), &params);
+    if (calc_normals) {
+      EDBM_update(id_cast<Mesh *>(obedit->data), &params);
+    }
+    else {
+      /* Without mirroring, only the selected vertices have been moved. */
+      EDBM_update_verts_moved(id_cast<Mesh *>(obedit->data), BM_ELEM_SELECT, &params);
+    }
   }
 
   if (tot_selected == 0 && !tot_locked) {
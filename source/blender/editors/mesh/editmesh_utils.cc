@@ -13,8 +13,10 @@
 #include "DNA_object_types.h"
 
 #include "BLI_array.hh"
+#include "BLI_bit_vector.hh"
 #include "BLI_kdtree.hh"
 #include "BLI_listbase.h"
+#include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 
@@ -1805,6 +1807,63 @@ void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params)
 #endif
 }
 
+void EDBM_update_verts_moved(Mesh *mesh, const char hflag, const EDBMUpdate_Params *params)
+{
+  BMEditMesh *em = mesh->runtime->edit_mesh.get();
+  BMesh *bm = em->bm;
+
+  /* The partial update writes into the existing tessellation, so it can only be used when the
+   * topology is unchanged. */
+  const bool use_partial = (params->calc_normals || params->calc_looptris) &&
+                           em->looptris.size() == poly_to_tri_count(bm->totface, bm->totloop) &&
+                           !(bm->totface && em->looptris.is_empty());
+  if (!use_partial) {
+    EDBM_update(mesh, params);
+    return;
+  }
+
+  BitVector<> verts_mask(bm->totvert);
+  int verts_mask_count = 0;
+  BMIter iter;
+  BMVert *v;
+  int i;
+  BM_ITER_MESH_INDEX (v, &iter, bm, BM_VERTS_OF_MESH, i) {
+    if (BM_elem_flag_test(v, hflag)) {
+      verts_mask[i].set();
+      verts_mask_count++;
+    }
+  }
+  bm->elem_index_dirty &= ~BM_VERT;
+
+  /* Gathering the connected geometry costs more than it saves when most vertices moved. */
+  if (verts_mask_count > bm->totvert / 2) {
+    EDBM_update(mesh, params);
+    return;
+  }
+
+  BMPartialUpdate_Params partial_params{};
+  partial_params.do_normals = params->calc_normals;
+  partial_params.do_tessellate = params->calc_looptris;
+  BMPartialUpdate *bmpinfo = BM_mesh_partial_create_from_verts(
+      *bm, partial_params, verts_mask, verts_mask_count);
+
+  if (params->calc_normals && params->calc_looptris) {
+    BKE_editmesh_looptris_and_normals_calc_with_partial(em, bmpinfo);
+  }
+  else if (params->calc_normals) {
+    BM_mesh_normals_update_with_partial(bm, bmpinfo);
+  }
+  else {
+    BKE_editmesh_looptris_calc_with_partial(em, bmpinfo);
+  }
+  BM_mesh_partial_destroy(bmpinfo);
+
+  EDBMUpdate_Params params_remaining = *params;
+  params_remaining.calc_normals = false;
+  params_remaining.calc_looptris = false;
+  EDBM_update(mesh, &params_remaining);
+}
+
 void EDBM_update_extern(Mesh *mesh, const bool do_tessellation, const bool is_destructive)
 {
   EDBMUpdate_Params params{};
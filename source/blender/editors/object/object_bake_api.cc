@@ -1406,24 +1406,36 @@ static void bake_targets_free(BakeTargets *targets)
 
 /* Main Bake Logic */
 
+/**
+ * We build a depsgraph for the baking,
+ * so we don't need to change the original data to adjust visibility and modifiers.
+ */
+static Depsgraph *bake_depsgraph_new(const BakeAPIRender *bkr)
+{
+  Depsgraph *depsgraph = DEG_graph_new(bkr->main, bkr->scene, bkr->view_layer, DAG_EVAL_RENDER);
+
+  /* Ensure meshes are generated even for objects with animated visibility, see: #107426. */
+  DEG_disable_visibility_optimization(depsgraph);
+
+  DEG_graph_build_from_view_layer(depsgraph);
+  return depsgraph;
+}
+
+/**
+ * \param depsgraph_shared: Depsgraph used for baking multiple objects one after another, so that
+ * the scene is only evaluated once. When null, a depsgraph is built for this bake only.
+ */
 static wmOperatorStatus bake(const BakeAPIRender *bkr,
                              Object *ob_low,
                              const Span<PointerRNA> selected_objects,
+                             Depsgraph *depsgraph_shared,
                              ReportList *reports)
 {
   Render *re = bkr->render;
   Main *bmain = bkr->main;
   Scene *scene = bkr->scene;
-  ViewLayer *view_layer = bkr->view_layer;
-
-  /* We build a depsgraph for the baking,
-   * so we don't need to change the original data to adjust visibility and modifiers. */
-  Depsgraph *depsgraph = DEG_graph_new(bmain, scene, view_layer, DAG_EVAL_RENDER);
-
-  /* Ensure meshes are generated even for objects with animated visibility, see: #107426. */
-  DEG_disable_visibility_optimization(depsgraph);
 
-  DEG_graph_build_from_view_layer(depsgraph);
+  Depsgraph *depsgraph = depsgraph_shared ? depsgraph_shared : bake_depsgraph_new(bkr);
 
   wmOperatorStatus op_result = OPERATOR_CANCELLED;
   bool ok = false;
@@ -1448,6 +1460,9 @@ static wmOperatorStatus bake(const BakeAPIRender *bkr,
 
   const bool preserve_origindex = (bkr->target == R_BAKE_TARGET_VERTEX_COLORS);
   const bool check_valid_uv_map = (bkr->target == R_BAKE_TARGET_IMAGE_TEXTURES);
+  const bool is_multires_tangent = bkr->pass_type == SCE_PASS_NORMAL &&
+                                   bkr->normal_space == R_BAKE_SPACE_TANGENT &&
+                                   !bkr->is_selected_to_active;
 
   RE_bake_engine_set_engine_parameters(re, bmain, scene);
 
@@ -1502,14 +1517,15 @@ static wmOperatorStatus bake(const BakeAPIRender *bkr,
   }
 
   /* for multires bake, use linear UV subdivision to match low res UVs */
-  if (bkr->pass_type == SCE_PASS_NORMAL && bkr->normal_space == R_BAKE_SPACE_TANGENT &&
-      !bkr->is_selected_to_active)
-  {
+  if (is_multires_tangent) {
     mmd_low = reinterpret_cast<MultiresModifierData *>(
         BKE_modifiers_findby_type(ob_low, eModifierType_Multires));
     if (mmd_low) {
       mmd_flags_low = mmd_low->flags;
       mmd_low->uv_smooth = SUBSURF_UV_SMOOTH_NONE;
+      if (depsgraph_shared) {
+        DEG_graph_id_tag_update(bmain, depsgraph, &ob_low->id, ID_RECALC_GEOMETRY);
+      }
     }
   }
 
@@ -1869,7 +1885,14 @@ cleanup:
     BKE_id_free(nullptr, &me_cage_eval->id);
   }
 
-  DEG_graph_free(depsgraph);
+  if (depsgraph_shared == nullptr) {
+    DEG_graph_free(depsgraph);
+  }
+  else if (is_multires_tangent) {
+    /* The multires settings and the evaluated object were changed for this bake, make sure
+     * following bakes use the regular evaluated object. */
+    DEG_graph_id_tag_update(bmain, depsgraph, &ob_low->id, ID_RECALC_GEOMETRY);
+  }
 
   return op_result;
 }
@@ -1988,14 +2011,16 @@ static wmOperatorStatus bake_exec(bContext *C, wmOperator *op)
   RE_SetReports(re, bkr.reports);
 
   if (bkr.is_selected_to_active) {
-    result = bake(&bkr, bkr.ob, bkr.selected_objects, bkr.reports);
+    result = bake(&bkr, bkr.ob, bkr.selected_objects, nullptr, bkr.reports);
   }
   else {
     bkr.is_clear = bkr.is_clear && bkr.selected_objects.size() == 1;
+    Depsgraph *depsgraph = bake_depsgraph_new(&bkr);
     for (const PointerRNA &ptr : bkr.selected_objects) {
       Object *ob_iter = static_cast<Object *>(ptr.data);
-      result = bake(&bkr, ob_iter, {}, bkr.reports);
+      result = bake(&bkr, ob_iter, {}, depsgraph, bkr.reports);
     }
+    DEG_graph_free(depsgraph);
   }
 
   RE_SetReports(re, nullptr);
@@ -2039,18 +2064,21 @@ static void bake_startjob(void *bkv, wmJobWorkerStatus *worker_status)
   }
 
   if (bkr->is_selected_to_active) {
-    bkr->result = bake(bkr, bkr->ob, bkr->selected_objects, bkr->reports);
+    bkr->result = bake(bkr, bkr->ob, bkr->selected_objects, nullptr, bkr->reports);
   }
   else {
     bkr->is_clear = bkr->is_clear && bkr->selected_objects.size() == 1;
+    Depsgraph *depsgraph = bake_depsgraph_new(bkr);
     for (const PointerRNA &ptr : bkr->selected_objects) {
       Object *ob_iter = static_cast<Object *>(ptr.data);
-      bkr->result = bake(bkr, ob_iter, {}, bkr->reports);
+      bkr->result = bake(bkr, ob_iter, {}, depsgraph, bkr->reports);
 
       if (bkr->result == OPERATOR_CANCELLED) {
+        DEG_graph_free(depsgraph);
         return;
       }
     }
+    DEG_graph_free(depsgraph);
   }
 
   RE_SetReports(bkr->render, nullptr);
@@ -8,6 +8,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -257,6 +258,37 @@ static void clear_requested_bakes_in_modifier_cache(BakeGeometryNodesJob &job)
   }
 }
 
+/** Serialized bake data of one frame that still has to be written to disk. */
+struct DiskBakeFrameFiles {
+  std::string meta_path;
+  std::string meta_data;
+  std::string blobs_dir;
+  Vector<std::pair<std::string, std::string>> blob_files;
+};
+
+static void bake_frame_files_write_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const Vector<DiskBakeFrameFiles> &frame_files = *static_cast<Vector<DiskBakeFrameFiles> *>(
+      taskdata);
+  for (const DiskBakeFrameFiles &files : frame_files) {
+    BLI_file_ensure_parent_dir_exists(files.meta_path.c_str());
+    fstream meta_file{files.meta_path, std::ios::out | std::ios::binary};
+    meta_file.write(files.meta_data.data(), files.meta_data.size());
+    for (const auto &[name, data] : files.blob_files) {
+      char blob_path[FILE_MAX];
+      BLI_path_join(blob_path, sizeof(blob_path), files.blobs_dir.c_str(), name.c_str());
+      BLI_file_ensure_parent_dir_exists(blob_path);
+      fstream blob_file{blob_path, std::ios::out | std::ios::binary};
+      blob_file.write(data.data(), data.size());
+    }
+  }
+}
+
+static void bake_frame_files_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<Vector<DiskBakeFrameFiles> *>(taskdata));
+}
+
 static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *worker_status)
 {
   BakeGeometryNodesJob &job = *static_cast<BakeGeometryNodesJob *>(customdata);
@@ -293,6 +325,10 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
   Map<NodeBakeRequest *, PackedBake> packed_data_by_bake;
   Map<NodeBakeRequest *, int64_t> size_by_bake;
 
+  /* Bakes to disk are serialized into memory and written to disk in the background, while the
+   * next frame is evaluated. At most one frame is written at a time, to bound memory usage. */
+  TaskPool *disk_write_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_LOW);
+
   for (float frame_f = global_bake_start_frame; frame_f <= global_bake_end_frame;
        frame_f += frame_step_size)
   {
@@ -312,6 +348,7 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
     clear_requested_bakes_in_modifier_cache(job);
 
     const std::string frame_file_name = bake::frame_to_file_name(frame);
+    Vector<DiskBakeFrameFiles> *disk_frame_files = MEM_new<Vector<DiskBakeFrameFiles>>(__func__);
 
     for (NodeBakeRequest &request : job.bake_requests) {
       NodesModifierData &nmd = *request.nmd;
@@ -336,12 +373,24 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
                       sizeof(meta_path),
                       request.path->meta_dir.c_str(),
                       (frame_file_name + ".json").c_str());
-        BLI_file_ensure_parent_dir_exists(meta_path);
-        bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
-        fstream meta_file{meta_path, std::ios::out};
+        /* Uses the same blob names as #bake::DiskBlobWriter. */
+        bake::MemoryBlobWriter blob_writer{frame_file_name};
+        std::ostringstream meta_file{std::ios::binary};
         bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
         written_size += blob_writer.written_size();
         written_size += meta_file.tellp();
+
+        const int64_t files_index = disk_frame_files->append_and_get_index_as();
+        DiskBakeFrameFiles &files = (*disk_frame_files)[files_index];
+        files.meta_path = meta_path;
+        files.meta_data = meta_file.str();
+        files.blobs_dir = request.path->blobs_dir;
+        for (auto &&item : blob_writer.get_stream_by_name().items()) {
+          std::string data = item.value.stream->str();
+          if (!data.empty()) {
+            files.blob_files.append({item.key, std::move(data)});
+          }
+        }
       }
       else {
         PackedBake &packed_data = packed_data_by_bake.lookup_or_add_default(&request);
@@ -360,6 +409,9 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
           }
           if (data.size() > PACKED_FILE_MAX_SIZE) {
             job.error_message = TIP_("A file is too large to be packed (>2GB).");
+            MEM_delete(disk_frame_files);
+            BLI_task_pool_work_and_wait(disk_write_pool);
+            BLI_task_pool_free(disk_write_pool);
             return;
           }
           packed_data.blob_files.append({item.key, std::move(data)});
@@ -369,10 +421,25 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
       }
     }
 
+    BLI_task_pool_work_and_wait(disk_write_pool);
+    if (disk_frame_files->is_empty()) {
+      MEM_delete(disk_frame_files);
+    }
+    else {
+      BLI_task_pool_push(disk_write_pool,
+                         bake_frame_files_write_task,
+                         disk_frame_files,
+                         false,
+                         bake_frame_files_free);
+    }
+
     worker_status->progress += progress_per_frame;
     worker_status->do_update = true;
   }
 
+  BLI_task_pool_work_and_wait(disk_write_pool);
+  BLI_task_pool_free(disk_write_pool);
+
   /* Update bake sizes. */
   for (NodeBakeRequest &request : job.bake_requests) {
     NodesModifierBake *bake = request.nmd->find_bake(request.bake_id);
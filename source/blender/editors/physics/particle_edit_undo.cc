@@ -229,6 +229,7 @@ static bool particle_undosys_step_encode(bContext *C, Main * /*bmain*/, UndoStep
   us->object_ref.ptr = BKE_view_layer_active_object_get(view_layer);
   PTCacheEdit *edit = PE_get_current(depsgraph, us->scene_ref.ptr, us->object_ref.ptr);
   undoptcache_from_editcache(&us->data, edit);
+  us->step.data_size = us->data.undo_size;
   return true;
 }
 
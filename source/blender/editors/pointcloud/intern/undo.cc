@@ -6,6 +6,7 @@
  * \ingroup edpointcloud
  */
 
+#include "BLI_memory_counter.hh"
 #include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
@@ -79,6 +80,14 @@ static bool step_encode(bContext *C, Main *bmain, UndoStep *us_p)
     }
   });
 
+  /* Attributes that are still shared with the point cloud are counted too, as with curves. */
+  MemoryCount memory;
+  MemoryCounter memory_counter(memory);
+  for (const StepObject &object : us->objects) {
+    object.attribute_storage.wrap().count_memory(memory_counter);
+  }
+  us->step.data_size = memory.total_bytes;
+
   bmain->is_memfile_undo_flush_needed = true;
 
   return true;
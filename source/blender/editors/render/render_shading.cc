@@ -1444,6 +1444,7 @@ enum {
   LIGHTCACHE_SUBSET_ALL = 0,
   LIGHTCACHE_SUBSET_SELECTED,
   LIGHTCACHE_SUBSET_ACTIVE,
+  LIGHTCACHE_SUBSET_DIRTY,
 };
 
 static Vector<Object *> lightprobe_cache_irradiance_volume_subset_get(bContext *C, wmOperator *op)
@@ -1496,6 +1497,18 @@ static Vector<Object *> lightprobe_cache_irradiance_volume_subset_get(bContext *
       }
       break;
     }
+    case LIGHTCACHE_SUBSET_DIRTY: {
+      FOREACH_OBJECT_BEGIN (scene, view_layer, ob) {
+        if (is_irradiance_volume(ob)) {
+          const LightProbeObjectCache *cache = ob->lightprobe_cache;
+          if (cache == nullptr || cache->grid_static_cache == nullptr || cache->dirty) {
+            irradiance_volume_setup(ob);
+          }
+        }
+      }
+      FOREACH_OBJECT_END;
+      break;
+    }
     default:
       BLI_assert_unreachable();
       break;
@@ -1636,6 +1649,12 @@ void OBJECT_OT_lightprobe_cache_bake(wmOperatorType *ot)
        0,
        "Active Only",
        "Only bake the active light probe volume"},
+      {LIGHTCACHE_SUBSET_DIRTY,
+       "DIRTY",
+       0,
+       "Modified Only",
+       "Only bake light probe volumes without baked data, or which can be affected by changes to "
+       "the scene since they were baked"},
       {0, nullptr, 0, nullptr, nullptr},
   };
 
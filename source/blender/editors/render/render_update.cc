@@ -13,6 +13,7 @@
 #include "DNA_brush_types.h"
 #include "DNA_cachefile_types.h"
 #include "DNA_light_types.h"
+#include "DNA_lightprobe_types.h"
 #include "DNA_material_types.h"
 #include "DNA_node_types.h"
 #include "DNA_object_types.h"
@@ -25,6 +26,7 @@
 
 #include "DRW_engine.hh"
 
+#include "BLI_bounds.hh"
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
 
@@ -36,6 +38,7 @@
 #include "BKE_material.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_node_tree_update.hh"
+#include "BKE_object.hh"
 #include "BKE_paint.hh"
 #include "BKE_scene.hh"
 
@@ -105,6 +108,77 @@ void ED_render_view3d_update(Depsgraph *depsgraph,
   }
 }
 
+/**
+ * Tag baked light probe volumes which can be affected by changed objects, lights or the world as
+ * dirty, so that only those have to be baked again. Only the bounds of objects after the change
+ * are known, so moving an object out of a volume in one step doesn't tag the volume.
+ */
+static void lightprobe_volumes_tag_dirty(Depsgraph *depsgraph)
+{
+  const bool lights_changed = DEG_id_type_updated(depsgraph, ID_LA) ||
+                              DEG_id_type_updated(depsgraph, ID_WO);
+  if (!lights_changed && !DEG_id_type_updated(depsgraph, ID_OB)) {
+    return;
+  }
+
+  struct VolumeBounds {
+    LightProbeObjectCache *cache;
+    Bounds<float3> bounds;
+  };
+  Vector<VolumeBounds> volumes;
+  Vector<Bounds<float3>> changed_bounds;
+  bool tag_all = lights_changed;
+
+  DEGObjectIterSettings deg_iter_settings{};
+  deg_iter_settings.depsgraph = depsgraph;
+  deg_iter_settings.flags = DEG_ITER_OBJECT_FLAG_LINKED_DIRECTLY |
+                            DEG_ITER_OBJECT_FLAG_LINKED_VIA_SET | DEG_ITER_OBJECT_FLAG_VISIBLE;
+  DEG_OBJECT_ITER_BEGIN (&deg_iter_settings, ob) {
+    const bool is_changed = (ob->id.recalc & (ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY)) != 0;
+    if (ob->type == OB_LIGHTPROBE) {
+      const Object *ob_orig = DEG_get_original(ob);
+      LightProbeObjectCache *cache = ob_orig->lightprobe_cache;
+      if (id_cast<const LightProbe *>(ob->data)->type != LIGHTPROBE_TYPE_VOLUME ||
+          cache == nullptr || cache->grid_static_cache == nullptr)
+      {
+        continue;
+      }
+      if (is_changed) {
+        cache->dirty = true;
+        continue;
+      }
+      volumes.append({cache,
+                      bounds::transform_bounds(ob->object_to_world(),
+                                               Bounds<float3>(float3(-1.0f), float3(1.0f)))});
+      continue;
+    }
+    if (!is_changed) {
+      continue;
+    }
+    if (ob->type == OB_LAMP) {
+      tag_all = true;
+      continue;
+    }
+    if (const std::optional<Bounds<float3>> bounds = BKE_object_boundbox_get(ob)) {
+      changed_bounds.append(bounds::transform_bounds(ob->object_to_world(), *bounds));
+    }
+  }
+  DEG_OBJECT_ITER_END;
+
+  for (VolumeBounds &volume : volumes) {
+    if (tag_all) {
+      volume.cache->dirty = true;
+      continue;
+    }
+    for (const Bounds<float3> &bounds : changed_bounds) {
+      if (volume.bounds.intersects(bounds)) {
+        volume.cache->dirty = true;
+        break;
+      }
+    }
+  }
+}
+
 void ED_render_scene_update(const DEGEditorUpdateContext *update_ctx, const bool updated)
 {
   Main *bmain = update_ctx->bmain;
@@ -128,6 +202,10 @@ void ED_render_scene_update(const DEGEditorUpdateContext *update_ctx, const bool
 
   recursive_check = true;
 
+  if (updated) {
+    lightprobe_volumes_tag_dirty(update_ctx->depsgraph);
+  }
+
   wmWindowManager *wm = static_cast<wmWindowManager *>(bmain->wm.first);
   for (wmWindow &window : wm->windows) {
     bScreen *screen = WM_window_get_active_screen(&window);
@@ -3,14 +3,19 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 #include "mesh_brush_common.hh"
 
+#include "BKE_brush.hh"
 #include "BKE_idtype.hh"
 #include "BKE_lib_id.hh"
+#include "BKE_paint.hh"
 
 #include "BLI_array_utils.hh"
 #include "BLI_map.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
 
 #include "CLG_log.h"
 
+#include "DNA_brush_enums.h"
 #include "DNA_mesh_types.h"
 
 #include "GEO_mesh_primitive_cuboid.hh"
@@ -123,4 +128,156 @@ TEST_F(MeshTests, calc_vert_neighbors_interior__1D_strip)
     ASSERT_EQ(calculated_counts.lookup_default(key, -1), expected_counts.lookup_default(key, -2));
   }
 }
+
+static Array<float3> random_positions(const int size)
+{
+  RandomNumberGenerator rng(0);
+  Array<float3> positions(size);
+  for (float3 &position : positions) {
+    position = rng.get_unit_float3() * rng.get_float();
+  }
+  return positions;
+}
+
+static Array<float> random_factors(const int size)
+{
+  RandomNumberGenerator rng(1);
+  Array<float> factors(size);
+  for (float &factor : factors) {
+    factor = rng.get_float();
+  }
+  return factors;
+}
+
+/* Vector sizes that aren't a multiple of four also test the scalar code for the remainder. */
+static constexpr int kernel_test_size = 1003;
+
+TEST(brush_kernels, distances)
+{
+  const Array<float3> positions = random_positions(kernel_test_size);
+  Array<int> verts(kernel_test_size);
+  for (const int i : verts.index_range()) {
+    verts[i] = (i * 7) % kernel_test_size;
+  }
+  SculptSession ss;
+  ss.cursor_location = float3(0.1f, -0.2f, 0.3f);
+
+  Array<float> distances(kernel_test_size);
+  calc_brush_distances(ss, positions, PAINT_FALLOFF_SHAPE_SPHERE, distances);
+  for (const int i : positions.index_range()) {
+    EXPECT_FLOAT_EQ(distances[i], math::distance(ss.cursor_location, positions[i]));
+  }
+
+  calc_brush_distances(ss, positions, verts, PAINT_FALLOFF_SHAPE_SPHERE, distances);
+  for (const int i : verts.index_range()) {
+    EXPECT_FLOAT_EQ(distances[i], math::distance(ss.cursor_location, positions[verts[i]]));
+  }
+}
+
+TEST(brush_kernels, falloff)
+{
+  const float radius = 0.8f;
+  const float hardness = 0.3f;
+  const Array<float> initial_factors = random_factors(kernel_test_size);
+  Array<float> distances = random_factors(kernel_test_size);
+  for (float &distance : distances) {
+    distance *= radius * 1.2f;
+  }
+
+  Array<float> factors = initial_factors;
+  filter_distances_with_radius(radius, distances, factors);
+  for (const int i : factors.index_range()) {
+    EXPECT_EQ(factors[i], distances[i] >= radius ? 0.0f : initial_factors[i]);
+  }
+
+  Array<float> hard_distances = distances;
+  apply_hardness_to_distances(radius, hardness, hard_distances);
+  for (const int i : hard_distances.index_range()) {
+    const float expected = distances[i] < hardness * radius ?
+                               0.0f :
+                               (distances[i] / radius - hardness) / (1.0f - hardness) * radius;
+    EXPECT_NEAR(hard_distances[i], expected, 1e-5f);
+  }
+
+  for (const eBrushCurvePreset preset : {BRUSH_CURVE_SMOOTH,
+                                         BRUSH_CURVE_SPHERE,
+                                         BRUSH_CURVE_ROOT,
+                                         BRUSH_CURVE_SHARP,
+                                         BRUSH_CURVE_LIN,
+                                         BRUSH_CURVE_POW4,
+                                         BRUSH_CURVE_INVSQUARE,
+                                         BRUSH_CURVE_CONSTANT,
+                                         BRUSH_CURVE_SMOOTHER})
+  {
+    Array<float> factors = initial_factors;
+    BKE_brush_calc_curve_factors(preset, nullptr, distances, radius, factors);
+    for (const int i : factors.index_range()) {
+      const float expected = initial_factors[i] *
+                             BKE_brush_curve_strength(preset, nullptr, distances[i], radius);
+      EXPECT_NEAR(factors[i], expected, 1e-5f);
+    }
+  }
+}
+
+TEST(brush_kernels, translations)
+{
+  const float3 offset(0.5f, -2.0f, 3.0f);
+  const Array<float> factors = random_factors(kernel_test_size);
+
+  Array<float3> translations(kernel_test_size);
+  translations_from_offset_and_factors(offset, factors, translations);
+  for (const int i : translations.index_range()) {
+    EXPECT_EQ(translations[i], offset * factors[i]);
+  }
+
+  const Array<float3> initial_translations = random_positions(kernel_test_size);
+  translations = initial_translations;
+  scale_translations(translations, factors);
+  for (const int i : translations.index_range()) {
+    EXPECT_EQ(translations[i], initial_translations[i] * factors[i]);
+  }
+
+  translations = initial_translations;
+  scale_translations(translations, 0.25f);
+  for (const int i : translations.index_range()) {
+    EXPECT_EQ(translations[i], initial_translations[i] * 0.25f);
+  }
+}
+
+/**
+ * Time the calculations done by a simple brush for every vertex, compared to a plain scalar
+ * implementation of the same steps.
+ */
+TEST(brush_kernels_performance, common_path)
+{
+  const int size = 1'000'000;
+  const float radius = 0.8f;
+  const float3 offset(0.0f, 0.0f, 0.01f);
+  const Array<float3> positions = random_positions(size);
+  SculptSession ss;
+  ss.cursor_location = float3(0.0f);
+
+  Array<float> distances(size);
+  Array<float> factors(size);
+  Array<float3> translations(size);
+  for ([[maybe_unused]] const int iteration : IndexRange(5)) {
+    {
+      SCOPED_TIMER("scalar");
+      for (const int i : positions.index_range()) {
+        distances[i] = math::distance(ss.cursor_location, positions[i]);
+        factors[i] = BKE_brush_curve_strength(BRUSH_CURVE_SMOOTH, nullptr, distances[i], radius);
+        translations[i] = offset * factors[i];
+      }
+    }
+    {
+      SCOPED_TIMER("simd");
+      factors.fill(1.0f);
+      calc_brush_distances(ss, positions, PAINT_FALLOFF_SHAPE_SPHERE, distances);
+      filter_distances_with_radius(radius, distances, factors);
+      BKE_brush_calc_curve_factors(BRUSH_CURVE_SMOOTH, nullptr, distances, radius, factors);
+      translations_from_offset_and_factors(offset, factors, translations);
+    }
+  }
+}
+
 }  // namespace blender::ed::sculpt_paint::tests
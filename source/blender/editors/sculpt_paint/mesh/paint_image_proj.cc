@@ -19,6 +19,7 @@
 #  include "BLI_winstuff.h"
 #endif
 
+#include "BLI_bounds.hh"
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_math_base_safe.h"
@@ -32,6 +33,7 @@
 #include "BLI_string.h"
 #include "BLI_string_utf8.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -3846,52 +3848,56 @@ static void proj_paint_state_viewport_init(ProjPaintState *ps, const char symmet
 
 static void proj_paint_state_screen_coords_init(ProjPaintState *ps, const int diameter)
 {
-  float *projScreenCo;
   float projMargin;
-  int a;
-
-  INIT_MINMAX2(ps->screenMin, ps->screenMax);
 
   ps->screenCoords = MEM_new_array_uninitialized<float[4]>(ps->totvert_eval,
                                                            "ProjectPaint ScreenVerts");
-  projScreenCo = *ps->screenCoords;
 
-  if (ps->is_ortho) {
-    for (a = 0; a < ps->totvert_eval; a++, projScreenCo += 4) {
-      mul_v3_m4v3(projScreenCo, ps->projectMat, ps->vert_positions_eval[a]);
+  const Bounds<float2> screen_bounds = threading::parallel_reduce(
+      IndexRange(ps->totvert_eval),
+      4096,
+      Bounds<float2>(float2(FLT_MAX), float2(-FLT_MAX)),
+      [&](const IndexRange range, Bounds<float2> bounds) {
+        for (const int a : range) {
+          float *projScreenCo = ps->screenCoords[a];
+          if (ps->is_ortho) {
+            mul_v3_m4v3(projScreenCo, ps->projectMat, ps->vert_positions_eval[a]);
+
+            /* screen space, not clamped */
+            projScreenCo[0] = float(ps->winx * 0.5f) + (ps->winx * 0.5f) * projScreenCo[0];
+            projScreenCo[1] = float(ps->winy * 0.5f) + (ps->winy * 0.5f) * projScreenCo[1];
+            math::min_max(float2(projScreenCo), bounds.min, bounds.max);
+            continue;
+          }
 
-      /* screen space, not clamped */
-      projScreenCo[0] = float(ps->winx * 0.5f) + (ps->winx * 0.5f) * projScreenCo[0];
-      projScreenCo[1] = float(ps->winy * 0.5f) + (ps->winy * 0.5f) * projScreenCo[1];
-      minmax_v2v2_v2(ps->screenMin, ps->screenMax, projScreenCo);
-    }
-  }
-  else {
-    for (a = 0; a < ps->totvert_eval; a++, projScreenCo += 4) {
-      copy_v3_v3(projScreenCo, ps->vert_positions_eval[a]);
-      projScreenCo[3] = 1.0f;
-
-      mul_m4_v4(ps->projectMat, projScreenCo);
-
-      if (projScreenCo[3] > ps->clip_start) {
-        /* screen space, not clamped */
-        projScreenCo[0] = float(ps->winx * 0.5f) +
-                          (ps->winx * 0.5f) * projScreenCo[0] / projScreenCo[3];
-        projScreenCo[1] = float(ps->winy * 0.5f) +
-                          (ps->winy * 0.5f) * projScreenCo[1] / projScreenCo[3];
-        /* Use the depth for bucket point occlusion */
-        projScreenCo[2] = projScreenCo[2] / projScreenCo[3];
-        minmax_v2v2_v2(ps->screenMin, ps->screenMax, projScreenCo);
-      }
-      else {
-        /* TODO: deal with cases where 1 side of a face goes behind the view ?
-         *
-         * After some research this is actually very tricky, only option is to
-         * clip the derived mesh before painting, which is a Pain */
-        projScreenCo[0] = FLT_MAX;
-      }
-    }
-  }
+          copy_v3_v3(projScreenCo, ps->vert_positions_eval[a]);
+          projScreenCo[3] = 1.0f;
+
+          mul_m4_v4(ps->projectMat, projScreenCo);
+
+          if (projScreenCo[3] > ps->clip_start) {
+            /* screen space, not clamped */
+            projScreenCo[0] = float(ps->winx * 0.5f) +
+                              (ps->winx * 0.5f) * projScreenCo[0] / projScreenCo[3];
+            projScreenCo[1] = float(ps->winy * 0.5f) +
+                              (ps->winy * 0.5f) * projScreenCo[1] / projScreenCo[3];
+            /* Use the depth for bucket point occlusion */
+            projScreenCo[2] = projScreenCo[2] / projScreenCo[3];
+            math::min_max(float2(projScreenCo), bounds.min, bounds.max);
+          }
+          else {
+            /* TODO: deal with cases where 1 side of a face goes behind the view ?
+             *
+             * After some research this is actually very tricky, only option is to
+             * clip the derived mesh before painting, which is a Pain */
+            projScreenCo[0] = FLT_MAX;
+          }
+        }
+        return bounds;
+      },
+      [](const Bounds<float2> &a, const Bounds<float2> &b) { return bounds::merge(a, b); });
+  copy_v2_v2(ps->screenMin, screen_bounds.min);
+  copy_v2_v2(ps->screenMax, screen_bounds.max);
 
   /* If this border is not added we get artifacts for faces that
    * have a parallel edge and at the bounds of the 2D projected verts eg
@@ -4007,36 +4013,36 @@ static void proj_paint_state_thread_init(ProjPaintState *ps, const bool reset_th
 static void proj_paint_state_vert_flags_init(ProjPaintState *ps)
 {
   if (ps->do_backfacecull && ps->do_mask_normal) {
-    float viewDirPersp[3];
-    float no[3];
-    int a;
-
     ps->vertFlags = MEM_new_array_zeroed<char>(ps->totvert_eval, "paint-vertFlags");
 
-    for (a = 0; a < ps->totvert_eval; a++) {
-      copy_v3_v3(no, ps->vert_normals[a]);
-      if (UNLIKELY(ps->is_flip_object)) {
-        negate_v3(no);
-      }
-
-      if (ps->is_ortho) {
-        if (dot_v3v3(ps->viewDir, no) <= ps->normal_angle__cos) {
-          /* 1 vert of this face is towards us */
-          ps->vertFlags[a] |= PROJ_VERT_CULL;
-        }
-      }
-      else {
-        sub_v3_v3v3(viewDirPersp, ps->viewPos, ps->vert_positions_eval[a]);
-        normalize_v3(viewDirPersp);
+    threading::parallel_for(IndexRange(ps->totvert_eval), 4096, [&](const IndexRange range) {
+      float viewDirPersp[3];
+      float no[3];
+      for (const int a : range) {
+        copy_v3_v3(no, ps->vert_normals[a]);
         if (UNLIKELY(ps->is_flip_object)) {
-          negate_v3(viewDirPersp);
+          negate_v3(no);
+        }
+
+        if (ps->is_ortho) {
+          if (dot_v3v3(ps->viewDir, no) <= ps->normal_angle__cos) {
+            /* 1 vert of this face is towards us */
+            ps->vertFlags[a] |= PROJ_VERT_CULL;
+          }
         }
-        if (dot_v3v3(viewDirPersp, no) <= ps->normal_angle__cos) {
-          /* 1 vert of this face is towards us */
-          ps->vertFlags[a] |= PROJ_VERT_CULL;
+        else {
+          sub_v3_v3v3(viewDirPersp, ps->viewPos, ps->vert_positions_eval[a]);
+          normalize_v3(viewDirPersp);
+          if (UNLIKELY(ps->is_flip_object)) {
+            negate_v3(viewDirPersp);
+          }
+          if (dot_v3v3(viewDirPersp, no) <= ps->normal_angle__cos) {
+            /* 1 vert of this face is towards us */
+            ps->vertFlags[a] |= PROJ_VERT_CULL;
+          }
         }
       }
-    }
+    });
   }
   else {
     ps->vertFlags = nullptr;
@@ -28,6 +28,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_rect.h"
 #include "BLI_set.hh"
+#include "BLI_simd.hh"
 #include "BLI_span.hh"
 #include "BLI_task.h"
 #include "BLI_task.hh"
@@ -7286,6 +7287,157 @@ void filter_region_clip_factors(const SculptSession &ss,
   }
 }
 
+#if BLI_HAVE_SSE2
+
+/* -------------------------------------------------------------------- */
+/** \name SIMD Brush Kernels
+ *
+ * The functions below run for every vertex of every node affected by most brushes. Compilers
+ * don't reliably vectorize them, mostly because of the interleaved #float3 layout, so the common
+ * cases use explicit SIMD instructions. Four #float3 values fill exactly three registers. The
+ * operations are done in the same order as in the scalar loops.
+ * \{ */
+
+/** Load four consecutive #float3 values and transpose them into x, y and z registers. */
+BLI_INLINE void load_float3x4(const float3 *src, __m128 &r_x, __m128 &r_y, __m128 &r_z)
+{
+  const float *src_flat = &src->x;
+  const __m128 r0 = _mm_loadu_ps(src_flat);
+  const __m128 r1 = _mm_loadu_ps(src_flat + 4);
+  const __m128 r2 = _mm_loadu_ps(src_flat + 8);
+  const __m128 t0 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(0, 1, 0, 2));
+  r_x = _mm_shuffle_ps(r0, t0, _MM_SHUFFLE(2, 0, 3, 0));
+  const __m128 t1 = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(0, 0, 0, 1));
+  const __m128 t2 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(0, 2, 0, 3));
+  r_y = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 t3 = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(0, 1, 0, 2));
+  const __m128 t4 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(0, 3, 0, 0));
+  r_z = _mm_shuffle_ps(t3, t4, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+/** Like #load_float3x4, but for four indexed #float3 values. */
+BLI_INLINE void gather_float3x4(const Span<float3> src,
+                                const int *indices,
+                                __m128 &r_x,
+                                __m128 &r_y,
+                                __m128 &r_z)
+{
+  const float3 &a = src[indices[0]];
+  const float3 &b = src[indices[1]];
+  const float3 &c = src[indices[2]];
+  const float3 &d = src[indices[3]];
+  r_x = _mm_setr_ps(a.x, b.x, c.x, d.x);
+  r_y = _mm_setr_ps(a.y, b.y, c.y, d.y);
+  r_z = _mm_setr_ps(a.z, b.z, c.z, d.z);
+}
+
+/** Repeat four values so that they match the layout of four consecutive #float3 values. */
+BLI_INLINE void broadcast_float3x4(const __m128 values, __m128 &r_0, __m128 &r_1, __m128 &r_2)
+{
+  r_0 = _mm_shuffle_ps(values, values, _MM_SHUFFLE(1, 0, 0, 0));
+  r_1 = _mm_shuffle_ps(values, values, _MM_SHUFFLE(2, 2, 1, 1));
+  r_2 = _mm_shuffle_ps(values, values, _MM_SHUFFLE(3, 3, 3, 2));
+}
+
+BLI_INLINE __m128 distance_squared_simd(const __m128 location[3],
+                                        const __m128 x,
+                                        const __m128 y,
+                                        const __m128 z)
+{
+  const __m128 dx = _mm_sub_ps(location[0], x);
+  const __m128 dy = _mm_sub_ps(location[1], y);
+  const __m128 dz = _mm_sub_ps(location[2], z);
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+}
+
+/** \return The number of processed elements from the start of the spans. */
+static int64_t calc_distances_squared_simd(const float3 &location,
+                                           const Span<float3> positions,
+                                           const MutableSpan<float> r_distances)
+{
+  const int64_t simd_size = positions.size() & ~int64_t(3);
+  const __m128 location_simd[3] = {
+      _mm_set1_ps(location.x), _mm_set1_ps(location.y), _mm_set1_ps(location.z)};
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    __m128 x, y, z;
+    load_float3x4(&positions[i], x, y, z);
+    _mm_storeu_ps(&r_distances[i], distance_squared_simd(location_simd, x, y, z));
+  }
+  return simd_size;
+}
+
+static int64_t calc_distances_squared_simd(const float3 &location,
+                                           const Span<float3> positions,
+                                           const Span<int> verts,
+                                           const MutableSpan<float> r_distances)
+{
+  const int64_t simd_size = verts.size() & ~int64_t(3);
+  const __m128 location_simd[3] = {
+      _mm_set1_ps(location.x), _mm_set1_ps(location.y), _mm_set1_ps(location.z)};
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    __m128 x, y, z;
+    gather_float3x4(positions, &verts[i], x, y, z);
+    _mm_storeu_ps(&r_distances[i], distance_squared_simd(location_simd, x, y, z));
+  }
+  return simd_size;
+}
+
+static int64_t sqrt_simd(const MutableSpan<float> values)
+{
+  const int64_t simd_size = values.size() & ~int64_t(3);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    _mm_storeu_ps(&values[i], _mm_sqrt_ps(_mm_loadu_ps(&values[i])));
+  }
+  return simd_size;
+}
+
+/** Multiply every element of the flattened #float3 values with the corresponding factor. */
+static int64_t scale_float3_simd(const MutableSpan<float3> values, const Span<float> factors)
+{
+  const int64_t simd_size = values.size() & ~int64_t(3);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    __m128 f0, f1, f2;
+    broadcast_float3x4(_mm_loadu_ps(&factors[i]), f0, f1, f2);
+    float *dst = &values[i].x;
+    _mm_storeu_ps(dst, _mm_mul_ps(_mm_loadu_ps(dst), f0));
+    _mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_loadu_ps(dst + 4), f1));
+    _mm_storeu_ps(dst + 8, _mm_mul_ps(_mm_loadu_ps(dst + 8), f2));
+  }
+  return simd_size;
+}
+
+static int64_t scale_simd(const MutableSpan<float> values, const float factor)
+{
+  const int64_t simd_size = values.size() & ~int64_t(3);
+  const __m128 factor_simd = _mm_set1_ps(factor);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    _mm_storeu_ps(&values[i], _mm_mul_ps(_mm_loadu_ps(&values[i]), factor_simd));
+  }
+  return simd_size;
+}
+
+static int64_t scale_simd(const MutableSpan<float> values, const Span<float> factors)
+{
+  const int64_t simd_size = values.size() & ~int64_t(3);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    _mm_storeu_ps(&values[i], _mm_mul_ps(_mm_loadu_ps(&values[i]), _mm_loadu_ps(&factors[i])));
+  }
+  return simd_size;
+}
+
+static int64_t add_simd(const MutableSpan<float> values, const Span<float> src)
+{
+  const int64_t simd_size = values.size() & ~int64_t(3);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    _mm_storeu_ps(&values[i], _mm_add_ps(_mm_loadu_ps(&values[i]), _mm_loadu_ps(&src[i])));
+  }
+  return simd_size;
+}
+
+/** \} */
+
+#endif
+
 void calc_brush_distances_squared(const SculptSession &ss,
                                   const Span<float3> positions,
                                   const Span<int> verts,
@@ -7308,7 +7460,11 @@ void calc_brush_distances_squared(const SculptSession &ss,
     }
   }
   else {
-    for (const int i : verts.index_range()) {
+    int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+    simd_size = calc_distances_squared_simd(test_location, positions, verts, r_distances);
+#endif
+    for (const int i : verts.index_range().drop_front(simd_size)) {
       r_distances[i] = math::distance_squared(test_location, positions[verts[i]]);
     }
   }
@@ -7321,7 +7477,11 @@ void calc_brush_distances(const SculptSession &ss,
                           const MutableSpan<float> r_distances)
 {
   calc_brush_distances_squared(ss, positions, verts, falloff_shape, r_distances);
-  for (float &value : r_distances) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = sqrt_simd(r_distances);
+#endif
+  for (float &value : r_distances.drop_front(simd_size)) {
     value = std::sqrt(value);
   }
 }
@@ -7347,7 +7507,11 @@ void calc_brush_distances_squared(const SculptSession &ss,
     }
   }
   else {
-    for (const int i : positions.index_range()) {
+    int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+    simd_size = calc_distances_squared_simd(test_location, positions, r_distances);
+#endif
+    for (const int i : positions.index_range().drop_front(simd_size)) {
       r_distances[i] = math::distance_squared(test_location, positions[i]);
     }
   }
@@ -7359,7 +7523,11 @@ void calc_brush_distances(const SculptSession &ss,
                           const MutableSpan<float> r_distances)
 {
   calc_brush_distances_squared(ss, positions, falloff_shape, r_distances);
-  for (float &value : r_distances) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = sqrt_simd(r_distances);
+#endif
+  for (float &value : r_distances.drop_front(simd_size)) {
     value = std::sqrt(value);
   }
 }
@@ -7368,7 +7536,16 @@ void filter_distances_with_radius(const float radius,
                                   const Span<float> distances,
                                   const MutableSpan<float> factors)
 {
-  for (const int i : distances.index_range()) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = distances.size() & ~int64_t(3);
+  const __m128 radius_simd = _mm_set1_ps(radius);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    const __m128 outside = _mm_cmpge_ps(_mm_loadu_ps(&distances[i]), radius_simd);
+    _mm_storeu_ps(&factors[i], _mm_andnot_ps(outside, _mm_loadu_ps(&factors[i])));
+  }
+#endif
+  for (const int i : distances.index_range().drop_front(simd_size)) {
     if (distances[i] >= radius) {
       factors[i] = 0.0f;
     }
@@ -7423,15 +7600,39 @@ void apply_hardness_to_distances(const float radius,
     return;
   }
   const float threshold = hardness * radius;
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = distances.size() & ~int64_t(3);
+  const __m128 threshold_simd = _mm_set1_ps(threshold);
+  const __m128 radius_simd = _mm_set1_ps(radius);
+#endif
   if (hardness == 1.0f) {
-    for (const int i : distances.index_range()) {
+#if BLI_HAVE_SSE2
+    for (int64_t i = 0; i < simd_size; i += 4) {
+      const __m128 inside = _mm_cmplt_ps(_mm_loadu_ps(&distances[i]), threshold_simd);
+      _mm_storeu_ps(&distances[i], _mm_andnot_ps(inside, radius_simd));
+    }
+#endif
+    for (const int i : distances.index_range().drop_front(simd_size)) {
       distances[i] = distances[i] < threshold ? 0.0f : radius;
     }
     return;
   }
   const float radius_inv = math::rcp(radius);
   const float hardness_inv_rcp = math::rcp(1.0f - hardness);
-  for (const int i : distances.index_range()) {
+#if BLI_HAVE_SSE2
+  const __m128 radius_inv_simd = _mm_set1_ps(radius_inv);
+  const __m128 hardness_simd = _mm_set1_ps(hardness);
+  const __m128 hardness_inv_rcp_simd = _mm_set1_ps(hardness_inv_rcp);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    const __m128 distance = _mm_loadu_ps(&distances[i]);
+    const __m128 inside = _mm_cmplt_ps(distance, threshold_simd);
+    const __m128 radius_factor = _mm_mul_ps(
+        _mm_sub_ps(_mm_mul_ps(distance, radius_inv_simd), hardness_simd), hardness_inv_rcp_simd);
+    _mm_storeu_ps(&distances[i], _mm_andnot_ps(inside, _mm_mul_ps(radius_factor, radius_simd)));
+  }
+#endif
+  for (const int i : distances.index_range().drop_front(simd_size)) {
     if (distances[i] < threshold) {
       distances[i] = 0.0f;
     }
@@ -7552,7 +7753,13 @@ void apply_translations(const Span<float3> translations,
   for (const int i : grids.index_range()) {
     const Span<float3> grid_translations = translations.slice(bke::ccg::grid_range(key, i));
     MutableSpan<float3> grid_positions = positions.slice(bke::ccg::grid_range(key, grids[i]));
-    for (const int offset : grid_positions.index_range()) {
+    int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+    simd_size = grid_positions.size() & ~int64_t(3);
+    add_simd(grid_positions.cast<float>().take_front(simd_size * 3),
+             grid_translations.cast<float>().take_front(simd_size * 3));
+#endif
+    for (const int offset : grid_positions.index_range().drop_front(simd_size)) {
       grid_positions[offset] += grid_translations[offset];
     }
   }
@@ -7756,7 +7963,11 @@ void PositionDeformData::deform(MutableSpan<float3> translations, const Span<int
 
 void scale_translations(const MutableSpan<float3> translations, const Span<float> factors)
 {
-  for (const int i : translations.index_range()) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = scale_float3_simd(translations, factors);
+#endif
+  for (const int i : translations.index_range().drop_front(simd_size)) {
     translations[i] *= factors[i];
   }
 }
@@ -7766,7 +7977,12 @@ void scale_translations(const MutableSpan<float3> translations, const float fact
   if (factor == 1.0f) {
     return;
   }
-  for (const int i : translations.index_range()) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = translations.size() & ~int64_t(3);
+  scale_simd(translations.cast<float>().take_front(simd_size * 3), factor);
+#endif
+  for (const int i : translations.index_range().drop_front(simd_size)) {
     translations[i] *= factor;
   }
 }
@@ -7776,7 +7992,11 @@ void scale_factors(const MutableSpan<float> factors, const float strength)
   if (strength == 1.0f) {
     return;
   }
-  for (float &factor : factors) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = scale_simd(factors, strength);
+#endif
+  for (float &factor : factors.drop_front(simd_size)) {
     factor *= strength;
   }
 }
@@ -7785,7 +8005,11 @@ void scale_factors(const MutableSpan<float> factors, const Span<float> strengths
 {
   BLI_assert(factors.size() == strengths.size());
 
-  for (const int i : factors.index_range()) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = scale_simd(factors, strengths);
+#endif
+  for (const int i : factors.index_range().drop_front(simd_size)) {
     factors[i] *= strengths[i];
   }
 }
@@ -7796,7 +8020,22 @@ void translations_from_offset_and_factors(const float3 &offset,
 {
   BLI_assert(r_translations.size() == factors.size());
 
-  for (const int i : factors.index_range()) {
+  int64_t simd_size = 0;
+#if BLI_HAVE_SSE2
+  simd_size = factors.size() & ~int64_t(3);
+  const __m128 offset_0 = _mm_setr_ps(offset.x, offset.y, offset.z, offset.x);
+  const __m128 offset_1 = _mm_setr_ps(offset.y, offset.z, offset.x, offset.y);
+  const __m128 offset_2 = _mm_setr_ps(offset.z, offset.x, offset.y, offset.z);
+  for (int64_t i = 0; i < simd_size; i += 4) {
+    __m128 f0, f1, f2;
+    broadcast_float3x4(_mm_loadu_ps(&factors[i]), f0, f1, f2);
+    float *dst = &r_translations[i].x;
+    _mm_storeu_ps(dst, _mm_mul_ps(offset_0, f0));
+    _mm_storeu_ps(dst + 4, _mm_mul_ps(offset_1, f1));
+    _mm_storeu_ps(dst + 8, _mm_mul_ps(offset_2, f2));
+  }
+#endif
+  for (const int i : factors.index_range().drop_front(simd_size)) {
     r_translations[i] = offset * factors[i];
   }
 }
@@ -29,13 +29,17 @@
 
 #include "CLG_log.h"
 
+#include "MEM_guardedalloc.h"
+
 #include "BLI_array.hh"
 #include "BLI_bit_group_vector.hh"
 #include "BLI_compression.hh"
 #include "BLI_enumerable_thread_specific.hh"
+#include "BLI_fileops.h"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 #include "BLI_memory_counter.hh"
+#include "BLI_path_utils.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
@@ -45,7 +49,9 @@
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
 #include "DNA_screen_types.h"
+#include "DNA_userdef_types.h"
 
+#include "BKE_appdir.hh"
 #include "BKE_attribute.hh"
 #include "BKE_attribute_legacy_convert.hh"
 #include "BKE_ccg.hh"
@@ -164,6 +170,14 @@ struct Node {
   Array<int, 0> face_sets;
 
   Vector<int> face_indices;
+
+  /**
+   * Compressed versions of #mask, #col and #loop_col, used when the step is finished (see
+   * #NodeDataUndoStorage). While the data is compressed, the uncompressed arrays are empty.
+   */
+  Array<std::byte, 0> compressed_mask;
+  Array<std::byte, 0> compressed_col;
+  Array<std::byte, 0> compressed_loop_col;
 };
 
 struct SculptAttrRef {
@@ -195,6 +209,7 @@ struct NodeGeometry {
 
 struct Node;
 struct PositionUndoStorage;
+struct NodeDataUndoStorage;
 
 struct StepData {
  private:
@@ -271,6 +286,7 @@ struct StepData {
   /** Storage of per-node undo data after creation of the undo step is finished. */
   Vector<std::unique_ptr<Node>> nodes;
   std::unique_ptr<PositionUndoStorage> position_step_storage;
+  std::unique_ptr<NodeDataUndoStorage> node_data_storage;
   size_t undo_size;
 
   /** Whether processing code needs to handle the current data as an undo step. */
@@ -349,12 +365,35 @@ void filter_decompress(const Span<std::byte> src, Vector<std::byte> &buffer, Vec
 
 template void filter_compress<float3>(Span<float3>, Vector<std::byte> &, Vector<std::byte> &);
 template void filter_compress<int>(Span<int>, Vector<std::byte> &, Vector<std::byte> &);
+template void filter_compress<float>(Span<float>, Vector<std::byte> &, Vector<std::byte> &);
+template void filter_compress<float4>(Span<float4>, Vector<std::byte> &, Vector<std::byte> &);
 
 template void filter_decompress<float3>(Span<std::byte>, Vector<std::byte> &, Vector<float3> &);
 template void filter_decompress<int>(Span<std::byte>, Vector<std::byte> &, Vector<int> &);
+template void filter_decompress<float>(Span<std::byte>, Vector<std::byte> &, Vector<float> &);
+template void filter_decompress<float4>(Span<std::byte>, Vector<std::byte> &, Vector<float4> &);
 
 }  // namespace compression
 
+/**
+ * With the "Sculpt Undo Paging" developer option, the compressed data of position undo steps that
+ * were not used recently is written to a file in the session's temporary directory and read back
+ * when the step is undone or redone. That bounds the memory used by the undo stack when sculpting
+ * on meshes that barely fit into memory, where every stroke can store hundreds of megabytes.
+ *
+ * The list of resident storages is only accessed from the main thread.
+ */
+namespace paging {
+
+/** Maximum size of the compressed position undo data that stays in memory. */
+static constexpr size_t resident_size_limit = size_t(1) << 30;
+
+static void tag_used(PositionUndoStorage &storage);
+static void remove(const PositionUndoStorage &storage);
+static void evict_until_within_limit();
+
+}  // namespace paging
+
 struct PositionUndoStorage : NonMovable {
   Vector<std::unique_ptr<Node>> nodes_to_compress;
   bool multires_undo;
@@ -367,6 +406,14 @@ struct PositionUndoStorage : NonMovable {
 
   Array<int> unique_verts_nums;
 
+  /**
+   * The file containing the compressed data while it is paged out. The compressed arrays keep
+   * their size but contain empty elements during that time.
+   */
+  std::string paged_filepath;
+  /** The size of the compressed indices and positions of every node, interleaved. */
+  Array<int64_t> paged_sizes;
+
   TaskPool *compression_task_pool;
   std::atomic<bool> compression_ready = false;
   std::atomic<bool> compression_started = false;
@@ -387,6 +434,8 @@ struct PositionUndoStorage : NonMovable {
     this->compression_started = true;
 
     BLI_task_pool_push(this->compression_task_pool, compress_fn, this, false, nullptr);
+
+    paging::tag_used(*this);
   }
 
   ~PositionUndoStorage()
@@ -395,6 +444,10 @@ struct PositionUndoStorage : NonMovable {
       BLI_task_pool_work_and_wait(compression_task_pool);
       BLI_task_pool_free(compression_task_pool);
     }
+    paging::remove(*this);
+    if (this->is_paged()) {
+      BLI_delete(this->paged_filepath.c_str(), false, false);
+    }
   }
 
   void ensure_compression_complete()
@@ -404,6 +457,116 @@ struct PositionUndoStorage : NonMovable {
     }
   }
 
+  /** Make sure the compressed data is available in memory before it is accessed. */
+  void ensure_resident()
+  {
+    this->ensure_compression_complete();
+    if (this->is_paged()) {
+      this->page_in();
+    }
+    paging::tag_used(*this);
+    paging::evict_until_within_limit();
+  }
+
+  bool is_paged() const
+  {
+    return !this->paged_filepath.empty();
+  }
+
+  /** The size of the compressed data in memory. Zero while the compression is still running. */
+  size_t resident_size_in_bytes() const
+  {
+    if (!compression_ready.load(std::memory_order_acquire) || this->is_paged()) {
+      return 0;
+    }
+    size_t size = 0;
+    for (const int i : this->compressed_indices.index_range()) {
+      size += this->compressed_indices[i].as_span().size_in_bytes();
+      size += this->compressed_positions[i].as_span().size_in_bytes();
+    }
+    return size;
+  }
+
+  /**
+   * Write the compressed data to a temporary file and free it.
+   * \return False if the file couldn't be written, in which case the data stays in memory.
+   */
+  bool page_out()
+  {
+    BLI_assert(compression_ready.load() && !this->is_paged());
+    static int file_counter = 0;
+    const std::string filename = fmt::format("sculpt_undo_{}.bin", file_counter++);
+    char filepath[FILE_MAX];
+    BLI_path_join(filepath, sizeof(filepath), BKE_tempdir_session(), filename.c_str());
+
+    FILE *file = BLI_fopen(filepath, "wb");
+    if (!file) {
+      return false;
+    }
+    const int nodes_num = this->compressed_indices.size();
+    Array<int64_t> sizes(nodes_num * 2);
+    bool success = true;
+    for (const int i : IndexRange(nodes_num)) {
+      const Span<std::byte> indices = this->compressed_indices[i];
+      const Span<std::byte> positions = this->compressed_positions[i];
+      sizes[i * 2] = indices.size();
+      sizes[i * 2 + 1] = positions.size();
+      success &= fwrite(indices.data(), 1, indices.size(), file) == indices.size();
+      success &= fwrite(positions.data(), 1, positions.size(), file) == positions.size();
+      if (!success) {
+        break;
+      }
+    }
+    success &= fclose(file) == 0;
+    if (!success) {
+      CLOG_WARN(&LOG, "Failed to write undo data to \"%s\"", filepath);
+      BLI_delete(filepath, false, false);
+      return false;
+    }
+
+    for (const int i : IndexRange(nodes_num)) {
+      this->compressed_indices[i] = {};
+      this->compressed_positions[i] = {};
+    }
+    this->paged_sizes = std::move(sizes);
+    this->paged_filepath = filepath;
+    return true;
+  }
+
+  /** Read the data written by #page_out back into memory. */
+  void page_in()
+  {
+    BLI_assert(this->is_paged());
+    FILE *file = BLI_fopen(this->paged_filepath.c_str(), "rb");
+    bool success = file != nullptr;
+    if (file) {
+      for (const int i : this->compressed_indices.index_range()) {
+        Array<std::byte> indices(this->paged_sizes[i * 2], NoInitialization());
+        Array<std::byte> positions(this->paged_sizes[i * 2 + 1], NoInitialization());
+        success &= fread(indices.data(), 1, indices.size(), file) == indices.size();
+        success &= fread(positions.data(), 1, positions.size(), file) == positions.size();
+        if (!success) {
+          break;
+        }
+        this->compressed_indices[i] = std::move(indices);
+        this->compressed_positions[i] = std::move(positions);
+      }
+      fclose(file);
+    }
+    if (!success) {
+      /* The data is lost, make sure that restoring the step doesn't do anything. */
+      CLOG_ERROR(&LOG, "Failed to read undo data from \"%s\"", this->paged_filepath.c_str());
+      for (const int i : this->compressed_indices.index_range()) {
+        this->compressed_indices[i] = {};
+        this->compressed_positions[i] = {};
+      }
+      this->unique_verts_nums.fill(0);
+    }
+    BLI_delete(this->paged_filepath.c_str(), false, false);
+    this->paged_filepath.clear();
+    this->paged_sizes = {};
+  }
+
   static void compress_fn(TaskPool * /*pool*/, void *task_data)
   {
 #ifdef DEBUG_TIME
@@ -452,6 +615,187 @@ struct PositionUndoStorage : NonMovable {
   }
 };
 
+namespace paging {
+
+/** Storages that have their data in memory, from least to most recently used. */
+static Vector<PositionUndoStorage *> &resident_storages()
+{
+  static Vector<PositionUndoStorage *> storages;
+  return storages;
+}
+
+static void tag_used(PositionUndoStorage &storage)
+{
+  Vector<PositionUndoStorage *> &storages = resident_storages();
+  const int64_t index = storages.first_index_of_try(&storage);
+  if (index != -1) {
+    storages.remove(index);
+  }
+  storages.append(&storage);
+}
+
+static void remove(const PositionUndoStorage &storage)
+{
+  Vector<PositionUndoStorage *> &storages = resident_storages();
+  const int64_t index = storages.first_index_of_try(const_cast<PositionUndoStorage *>(&storage));
+  if (index != -1) {
+    storages.remove(index);
+  }
+}
+
+static void evict_until_within_limit()
+{
+  if (!USER_DEVELOPER_TOOL_TEST(&U, use_sculpt_undo_paging)) {
+    return;
+  }
+  Vector<PositionUndoStorage *> &storages = resident_storages();
+  size_t resident_size = 0;
+  for (const PositionUndoStorage *storage : storages) {
+    resident_size += storage->resident_size_in_bytes();
+  }
+  /* The most recently used storage always stays in memory. Storages that are still being
+   * compressed in the background are skipped. */
+  int64_t i = 0;
+  while (resident_size > resident_size_limit && i < storages.size() - 1) {
+    PositionUndoStorage &storage = *storages[i];
+    const size_t size = storage.resident_size_in_bytes();
+    if (size == 0 || !storage.page_out()) {
+      i++;
+      continue;
+    }
+    resident_size -= size;
+    storages.remove(i);
+  }
+}
+
+}  // namespace paging
+
+static size_t node_size_in_bytes(const Node &node);
+
+/**
+ * Mask and color undo steps keep their #Node structs, but the mask and color arrays are
+ * compressed in a background task once the step is finished, with the same filtering as the
+ * position data. They are decompressed temporarily while the step is undone or redone.
+ */
+struct NodeDataUndoStorage : NonMovable {
+  StepData *owner_step_data = nullptr;
+  TaskPool *compression_task_pool;
+  std::atomic<bool> compression_ready = false;
+
+  explicit NodeDataUndoStorage(StepData &step_data) : owner_step_data(&step_data)
+  {
+    this->compression_task_pool = BLI_task_pool_create_background(this, TASK_PRIORITY_LOW);
+    this->start_compression();
+  }
+
+  ~NodeDataUndoStorage()
+  {
+    BLI_task_pool_work_and_wait(this->compression_task_pool);
+    BLI_task_pool_free(this->compression_task_pool);
+  }
+
+  void ensure_compression_complete()
+  {
+    if (!compression_ready.load(std::memory_order_acquire)) {
+      BLI_task_pool_work_and_wait(compression_task_pool);
+    }
+  }
+
+  /** Compress the node data again in the background, after it has been restored. */
+  void start_compression()
+  {
+    this->compression_ready.store(false, std::memory_order_release);
+    BLI_task_pool_push(this->compression_task_pool, compress_fn, this, false, nullptr);
+  }
+
+  /** Make the uncompressed data available in the nodes until #start_compression is called. */
+  void decompress()
+  {
+    this->ensure_compression_complete();
+    struct LocalData {
+      Vector<std::byte> buffer;
+      Vector<float> mask;
+      Vector<float4> col;
+    };
+    MutableSpan<std::unique_ptr<Node>> nodes = this->owner_step_data->nodes;
+    threading::EnumerableThreadSpecific<LocalData> all_tls;
+    threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+      LocalData &tls = all_tls.local();
+      for (const int i : range) {
+        Node &node = *nodes[i];
+        decompress_array(node.compressed_mask, tls.buffer, tls.mask, node.mask);
+        decompress_array(node.compressed_col, tls.buffer, tls.col, node.col);
+        decompress_array(node.compressed_loop_col, tls.buffer, tls.col, node.loop_col);
+      }
+    });
+  }
+
+  template<typename T>
+  static void compress_array(Array<T, 0> &data,
+                             Vector<std::byte> &filter_buffer,
+                             Vector<std::byte> &compress_buffer,
+                             Array<std::byte, 0> &r_compressed)
+  {
+    if (data.is_empty()) {
+      return;
+    }
+    compression::filter_compress(data.as_span(), filter_buffer, compress_buffer);
+    if (compress_buffer.is_empty()) {
+      /* Keep the uncompressed data if compression failed. */
+      return;
+    }
+    r_compressed = compress_buffer.as_span();
+    data = {};
+  }
+
+  template<typename T>
+  static void decompress_array(Array<std::byte, 0> &compressed,
+                               Vector<std::byte> &buffer,
+                               Vector<T> &values,
+                               Array<T, 0> &r_data)
+  {
+    if (compressed.is_empty()) {
+      return;
+    }
+    compression::filter_decompress(compressed.as_span(), buffer, values);
+    r_data = values.as_span();
+    compressed = {};
+  }
+
+  static void compress_fn(TaskPool * /*pool*/, void *task_data)
+  {
+#ifdef DEBUG_TIME
+    SCOPED_TIMER_AVERAGED(__func__);
+#endif
+    auto *data = static_cast<NodeDataUndoStorage *>(task_data);
+    MutableSpan<std::unique_ptr<Node>> nodes = data->owner_step_data->nodes;
+    struct LocalData {
+      Vector<std::byte> filtered;
+      Vector<std::byte> compressed;
+    };
+    threading::isolate_task([&]() {
+      threading::EnumerableThreadSpecific<LocalData> all_tls;
+      threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+        LocalData &tls = all_tls.local();
+        for (const int i : range) {
+          Node &node = *nodes[i];
+          compress_array(node.mask, tls.filtered, tls.compressed, node.compressed_mask);
+          compress_array(node.col, tls.filtered, tls.compressed, node.compressed_col);
+          compress_array(node.loop_col, tls.filtered, tls.compressed, node.compressed_loop_col);
+        }
+      });
+    });
+
+    size_t memory_size = 0;
+    for (const std::unique_ptr<Node> &node : nodes) {
+      memory_size += node_size_in_bytes(*node);
+    }
+    data->owner_step_data->undo_size = memory_size;
+
+    data->compression_ready.store(true, std::memory_order_release);
+  }
+};
+
 struct SculptUndoStep {
   UndoStep step;
   /* NOTE: will split out into list for multi-object-sculpt-mode. */
@@ -475,6 +819,9 @@ size_t step_memory_size_get(UndoStep *step)
   if (sculpt_step->data.position_step_storage) {
     sculpt_step->data.position_step_storage->ensure_compression_complete();
   }
+  if (sculpt_step->data.node_data_storage) {
+    sculpt_step->data.node_data_storage->ensure_compression_complete();
+  }
 
   return sculpt_step->data.undo_size;
 }
@@ -486,6 +833,13 @@ static SculptUndoStep *get_active_step()
   return reinterpret_cast<SculptUndoStep *>(us);
 }
 
+/** The memory category of undo data, see #MEM_memory_category_set. */
+static int memory_category()
+{
+  static const int category = MEM_memory_category_register("Sculpt Undo");
+  return category;
+}
+
 static StepData *get_step_data()
 {
   if (SculptUndoStep *us = get_active_step()) {
@@ -565,7 +919,7 @@ static void restore_position_mesh(Object &object,
   MutableSpan<float3> positions = mesh.vert_positions_for_write();
   std::optional<ShapeKeyData> shape_key_data = ShapeKeyData::from_object(object);
 
-  undo_data.ensure_compression_complete();
+  undo_data.ensure_resident();
 
   const int nodes_num = undo_data.unique_verts_nums.size();
 
@@ -635,6 +989,8 @@ static void restore_position_grids(const MutableSpan<float3> positions,
                                    PositionUndoStorage &undo_data,
                                    const MutableSpan<bool> modified_grids)
 {
+  undo_data.ensure_resident();
+
   const int nodes_num = undo_data.compressed_indices.size();
 
   struct LocalData {
@@ -1264,6 +1620,10 @@ static void restore_list(bContext *C, Depsgraph *depsgraph, StepData &step_data)
         return;
       }
 
+      if (step_data.node_data_storage) {
+        step_data.node_data_storage->decompress();
+      }
+
       if (use_multires_undo(step_data, ss)) {
         MutableSpan<bke::pbvh::GridsNode> nodes = pbvh.nodes<bke::pbvh::GridsNode>();
         Array<bool> modified_grids(ss.subdiv_ccg->grids_num, false);
@@ -1295,6 +1655,10 @@ static void restore_list(bContext *C, Depsgraph *depsgraph, StepData &step_data)
         bke::pbvh::update_mask_mesh(mesh, changed_nodes, pbvh);
         pbvh.tag_masks_changed(changed_nodes);
       }
+
+      if (step_data.node_data_storage) {
+        step_data.node_data_storage->start_compression();
+      }
       break;
     }
     case Type::FaceSet: {
@@ -1350,7 +1714,13 @@ static void restore_list(bContext *C, Depsgraph *depsgraph, StepData &step_data)
 
       const Mesh &mesh = *id_cast<const Mesh *>(object.data);
       Array<bool> modified_verts(mesh.verts_num, false);
+      if (step_data.node_data_storage) {
+        step_data.node_data_storage->decompress();
+      }
       restore_color(object, step_data, modified_verts);
+      if (step_data.node_data_storage) {
+        step_data.node_data_storage->start_compression();
+      }
       const IndexMask changed_nodes = IndexMask::from_predicate(
           node_mask,
           memory,
@@ -1581,6 +1951,7 @@ static void fill_node_data_mesh(const Depsgraph &depsgraph,
                                 const Type type,
                                 Node &unode)
 {
+  const MEM_MemoryCategoryScope memory_category_scope(memory_category());
   const SculptSession &ss = *object.runtime->sculpt_session;
   const Mesh &mesh = *id_cast<Mesh *>(object.data);
 
@@ -1648,6 +2019,7 @@ static void fill_node_data_grids(const Object &object,
                                  const Type type,
                                  Node &unode)
 {
+  const MEM_MemoryCategoryScope memory_category_scope(memory_category());
   const SculptSession &ss = *object.runtime->sculpt_session;
   const Mesh &base_mesh = *id_cast<const Mesh *>(object.data);
   const SubdivCCG &subdiv_ccg = *ss.subdiv_ccg;
@@ -1715,6 +2087,7 @@ BLI_NOINLINE static void bmesh_push(const Object &object,
                                     const bke::pbvh::BMeshNode *node,
                                     Type type)
 {
+  const MEM_MemoryCategoryScope memory_category_scope(memory_category());
   StepData *step_data = get_step_data();
   const SculptSession &ss = *object.runtime->sculpt_session;
 
@@ -2042,6 +2415,9 @@ static size_t node_size_in_bytes(const Node &node)
   size += node.grid_hidden.all_bits().size() / 8;
   size += node.face_sets.as_span().size_in_bytes();
   size += node.face_indices.as_span().size_in_bytes();
+  size += node.compressed_mask.as_span().size_in_bytes();
+  size += node.compressed_col.as_span().size_in_bytes();
+  size += node.compressed_loop_col.as_span().size_in_bytes();
   return size;
 }
 
@@ -2067,6 +2443,7 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
 
   if (step_data->type == Type::Position) {
     step_data->position_step_storage = std::make_unique<PositionUndoStorage>(*step_data);
+    paging::evict_until_within_limit();
   }
   else {
     step_data->undo_size = threading::parallel_reduce(
@@ -2080,6 +2457,9 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
           return size;
         },
         std::plus<size_t>());
+    if (ELEM(step_data->type, Type::Mask, Type::Color)) {
+      step_data->node_data_storage = std::make_unique<NodeDataUndoStorage>(*step_data);
+    }
   }
 
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
@@ -67,4 +67,32 @@ TEST_F(SculptUndoTest, CompressRoundTrip)
   }
 }
 
+TEST_F(SculptUndoTest, CompressMaskAndColorRoundTrip)
+{
+  const Span<float3> positions = this->cube_mesh->vert_positions();
+  Array<float> masks(positions.size());
+  Array<float4> colors(positions.size());
+  for (const int i : positions.index_range()) {
+    masks[i] = std::clamp(positions[i].x, 0.0f, 1.0f);
+    colors[i] = float4(positions[i], 1.0f);
+  }
+
+  Vector<std::byte> buffer;
+  Vector<std::byte> compressed;
+
+  {
+    compression::filter_compress<float>(masks, buffer, compressed);
+    Vector<float> decompressed;
+    compression::filter_decompress<float>(compressed, buffer, decompressed);
+    EXPECT_EQ_SPAN(masks.as_span(), decompressed.as_span());
+  }
+
+  {
+    compression::filter_compress<float4>(colors, buffer, compressed);
+    Vector<float4> decompressed;
+    compression::filter_decompress<float4>(compressed, buffer, decompressed);
+    EXPECT_EQ_SPAN(colors.as_span(), decompressed.as_span());
+  }
+}
+
 }  // namespace blender::ed::sculpt_paint::undo::tests
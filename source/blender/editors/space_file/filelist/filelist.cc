@@ -537,6 +537,14 @@ static void filelist_cache_preview_runf(TaskPool *__restrict pool, void *taskdat
       taskdata);
   FileListEntryPreview *preview = preview_taskdata->preview;
 
+  {
+    std::scoped_lock lock(cache->previews_mutex);
+    if (preview_taskdata->generation != cache->previews_generation) {
+      /* The request was cleared, the preview is freed with the task data. */
+      return;
+    }
+  }
+
   /* XXX #THB_SOURCE_IMAGE for "historic" reasons. The case of an undefined source should be
    * handled better. */
   ThumbSource source = THB_SOURCE_IMAGE;
@@ -575,6 +583,16 @@ static void filelist_cache_preview_runf(TaskPool *__restrict pool, void *taskdat
     preview->icon_id = BKE_icon_imbuf_create(imbuf);
   }
 
+  std::scoped_lock lock(cache->previews_mutex);
+  if (preview_taskdata->generation != cache->previews_generation) {
+    /* The request was cleared while generating the preview. The thumbnail was still created and
+     * will be reused from disk next time. */
+    if (preview->icon_id) {
+      BKE_icon_delete(preview->icon_id);
+    }
+    return;
+  }
+
   /* Move ownership to the done queue. */
   preview_taskdata->preview = nullptr;
 
@@ -610,7 +628,13 @@ static void filelist_cache_preview_ensure_running(FileListEntryCache *cache)
 static void filelist_cache_previews_clear(FileListEntryCache *cache)
 {
   if (cache->previews_pool) {
-    BLI_task_pool_cancel(cache->previews_pool);
+    /* Don't cancel the task pool, that would wait for previews that are generated currently (which
+     * can take a while for large images) and cause stutters while scrolling. Invalidate all
+     * requests instead, so the tasks don't add their previews to the done queue anymore. */
+    {
+      std::scoped_lock lock(cache->previews_mutex);
+      cache->previews_generation++;
+    }
 
     for (FileDirEntry &entry : cache->cached_entries) {
       entry.flags &= ~FILE_ENTRY_PREVIEW_LOADING;
@@ -637,6 +661,7 @@ static void filelist_cache_previews_free(FileListEntryCache *cache)
   if (cache->previews_pool) {
     BLI_thread_queue_nowait(cache->previews_done);
 
+    BLI_task_pool_cancel(cache->previews_pool);
     filelist_cache_previews_clear(cache);
 
     BLI_thread_queue_free(cache->previews_done);
@@ -769,6 +794,8 @@ static bool filelist_cache_previews_push(FileList *filelist, FileDirEntry *entry
     FileListEntryPreviewTaskData *preview_taskdata = MEM_new_zeroed<FileListEntryPreviewTaskData>(
         __func__);
     preview_taskdata->preview = preview;
+    /* Only modified on this thread, no need to lock. */
+    preview_taskdata->generation = cache->previews_generation;
     BLI_task_pool_push(cache->previews_pool,
                        filelist_cache_preview_runf,
                        preview_taskdata,
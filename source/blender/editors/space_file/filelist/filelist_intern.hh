@@ -13,6 +13,7 @@
 
 #include "BLI_fileops.h"
 #include "BLI_map.hh"
+#include "BLI_mutex.hh"
 
 #include "DNA_listBase.h"
 #include "DNA_space_enums.h"
@@ -148,6 +149,14 @@ struct FileListEntryCache {
    * previews either in `previews_pool` or `previews_done`. #filelist_cache_previews_update() makes
    * previews in `preview_done` ready for display, so the counter is decremented there. */
   int previews_todo_count = 0;
+  /**
+   * Incremented when the queued previews are cleared (e.g. to prioritize newly visible entries),
+   * so that tasks of earlier requests don't add their preview to `previews_done` anymore. That
+   * way clearing doesn't have to wait for the previews that are being generated already.
+   * Protected by `previews_mutex`.
+   */
+  int previews_generation = 0;
+  Mutex previews_mutex;
 
   FileListEntryCache();
   ~FileListEntryCache();
@@ -170,6 +179,8 @@ struct FileListEntryPreview {
  * tasks' data (see #74609). */
 struct FileListEntryPreviewTaskData {
   FileListEntryPreview *preview;
+  /** #FileListEntryCache.previews_generation when the preview was requested. */
+  int generation;
 };
 
 struct FileListFilter {
@@ -8,12 +8,15 @@
 
 #include "AS_asset_library.hh"
 
+#include "BLI_array.hh"
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_stack.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_asset.hh"
 #include "BKE_blendfile.hh"
@@ -520,7 +523,92 @@ static int filelist_readjob_list_lib_populate_from_index(FileListReadJob *job_pa
   return read_from_index + navigate_to_parent_len;
 }
 
+/** A linkable group of a library file and its data-blocks. */
+struct ListLibGroup {
+  std::string name;
+  int idcode = 0;
+  /** Only read when listing recursively. */
+  LinkNode * /*BLODataBlockInfo*/ datablock_infos = nullptr;
+  int datablocks_num = 0;
+};
+
+static Vector<ListLibGroup> filelist_readjob_list_lib_groups_read(BlendHandle *libfiledata,
+                                                                  const ListLibOptions options)
+{
+  Vector<ListLibGroup> groups;
+  LinkNode *group_names = BLO_blendhandle_get_linkable_groups(libfiledata);
+  for (LinkNode *ln = group_names; ln; ln = ln->next) {
+    ListLibGroup group;
+    group.name = static_cast<char *>(ln->link);
+    group.idcode = groupname_to_code(group.name.c_str());
+    if (options & LIST_LIB_RECURSIVE) {
+      group.datablock_infos = BLO_blendhandle_get_datablock_info(
+          libfiledata, group.idcode, options & LIST_LIB_ASSETS_ONLY, &group.datablocks_num);
+    }
+    groups.append(std::move(group));
+  }
+  BLI_linklist_freeN(group_names);
+  return groups;
+}
+
+/**
+ * Contents of a library file (or its index) that were read ahead, so that the files of a
+ * directory can be read in parallel. The file list entries are still created in order by
+ * #filelist_readjob_list_lib, since adding assets to the asset library isn't thread-safe.
+ */
+struct ListLibPrefetch {
+  eFileIndexerResult indexer_result = FILE_INDEXER_NEEDS_UPDATE;
+  FileIndexerEntries indexer_entries = {nullptr};
+  int read_from_index = 0;
+  /** False when there is no up-to-date index and the library file couldn't be opened. */
+  bool is_valid = false;
+  Vector<ListLibGroup> groups;
+
+  ~ListLibPrefetch()
+  {
+    ED_file_indexer_entries_clear(&this->indexer_entries);
+    for (ListLibGroup &group : this->groups) {
+      BLO_datablock_info_linklist_free(group.datablock_infos);
+    }
+  }
+};
+
+/**
+ * Read the contents of the library file at \a root without modifying the file list. May be called
+ * from multiple threads at once.
+ *
+ * \return Nothing if \a root isn't a library file, or is a group inside of one.
+ */
+static std::unique_ptr<ListLibPrefetch> filelist_readjob_list_lib_prefetch(
+    const char *root, const ListLibOptions options, FileIndexer *indexer_runtime)
+{
+  char dir[FILE_MAX_LIBEXTRA], *group;
+  if (!BKE_blendfile_library_path_explode(root, dir, &group, nullptr) || group != nullptr) {
+    return nullptr;
+  }
+
+  std::unique_ptr<ListLibPrefetch> prefetch = std::make_unique<ListLibPrefetch>();
+  prefetch->indexer_result = indexer_runtime->callbacks->read_index(
+      dir, &prefetch->indexer_entries, &prefetch->read_from_index, indexer_runtime->user_data);
+  if (prefetch->indexer_result == FILE_INDEXER_ENTRIES_LOADED) {
+    return prefetch;
+  }
+
+  BlendFileReadReport bf_reports{};
+  BlendHandle *libfiledata = BLO_blendhandle_from_file(dir, &bf_reports);
+  if (libfiledata == nullptr) {
+    return prefetch;
+  }
+  prefetch->groups = filelist_readjob_list_lib_groups_read(libfiledata, options);
+  prefetch->is_valid = true;
+  BLO_blendhandle_close(libfiledata);
+  return prefetch;
+}
+
 /**
+ * \param prefetch: Contents of the library that were read ahead by
+ * #filelist_readjob_list_lib_prefetch, or null to read them here.
+ *
  * \return The number of entries found if the \a root path points to a valid library file.
  *         Otherwise returns no value (#std::nullopt).
  */
@@ -528,7 +616,8 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
                                                     const char *root,
                                                     ListBaseT<FileListInternEntry> *entries,
                                                     const ListLibOptions options,
-                                                    FileIndexer *indexer_runtime)
+                                                    FileIndexer *indexer_runtime,
+                                                    ListLibPrefetch *prefetch)
 {
   BLI_assert(indexer_runtime);
 
@@ -548,6 +637,7 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
 
   /* The root path contains an ID group (e.g. "Materials" or "Objects"). */
   const bool has_group = group != nullptr;
+  BLI_assert(!(prefetch && has_group));
 
   /* Try read from indexer_runtime. */
   /* Indexing returns all entries in a blend file. We should ignore the index when listing a group
@@ -561,8 +651,16 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
   FileIndexerEntries indexer_entries = {nullptr};
   if (use_indexer) {
     int read_from_index = 0;
-    eFileIndexerResult indexer_result = indexer_runtime->callbacks->read_index(
-        dir, &indexer_entries, &read_from_index, indexer_runtime->user_data);
+    eFileIndexerResult indexer_result;
+    if (prefetch) {
+      indexer_result = prefetch->indexer_result;
+      read_from_index = prefetch->read_from_index;
+      std::swap(indexer_entries, prefetch->indexer_entries);
+    }
+    else {
+      indexer_result = indexer_runtime->callbacks->read_index(
+          dir, &indexer_entries, &read_from_index, indexer_runtime->user_data);
+    }
     if (indexer_result == FILE_INDEXER_ENTRIES_LOADED) {
       int entries_read = filelist_readjob_list_lib_populate_from_index(
           job_params, entries, options, read_from_index, &indexer_entries);
@@ -572,10 +670,17 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
   }
 
   /* Open the library file. */
-  BlendFileReadReport bf_reports{};
-  libfiledata = BLO_blendhandle_from_file(dir, &bf_reports);
-  if (libfiledata == nullptr) {
-    return std::nullopt;
+  if (prefetch) {
+    if (!prefetch->is_valid) {
+      return std::nullopt;
+    }
+  }
+  else {
+    BlendFileReadReport bf_reports{};
+    libfiledata = BLO_blendhandle_from_file(dir, &bf_reports);
+    if (libfiledata == nullptr) {
+      return std::nullopt;
+    }
   }
 
   /* Add current parent when requested. */
@@ -603,35 +708,37 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
   }
   /* Read all datablocks from all groups. */
   else {
-    LinkNode *groups = BLO_blendhandle_get_linkable_groups(libfiledata);
-    group_len = BLI_linklist_count(groups);
+    Vector<ListLibGroup> groups = prefetch ?
+                                      std::move(prefetch->groups) :
+                                      filelist_readjob_list_lib_groups_read(libfiledata, options);
+    group_len = groups.size();
 
-    for (LinkNode *ln = groups; ln; ln = ln->next) {
-      const char *group_name = static_cast<char *>(ln->link);
-      const int idcode = groupname_to_code(group_name);
+    for (ListLibGroup &lib_group : groups) {
       FileListInternEntry *group_entry = filelist_readjob_list_lib_group_create(
-          job_params, idcode, group_name);
+          job_params, lib_group.idcode, lib_group.name.c_str());
       BLI_addtail(entries, group_entry);
 
       if (options & LIST_LIB_RECURSIVE) {
-        int group_datablock_len;
-        LinkNode *group_datablock_infos = BLO_blendhandle_get_datablock_info(
-            libfiledata, idcode, options & LIST_LIB_ASSETS_ONLY, &group_datablock_len);
-        filelist_readjob_list_lib_add_datablocks(
-            job_params, entries, group_datablock_infos, true, idcode, group_name);
+        filelist_readjob_list_lib_add_datablocks(job_params,
+                                                 entries,
+                                                 lib_group.datablock_infos,
+                                                 true,
+                                                 lib_group.idcode,
+                                                 lib_group.name.c_str());
         if (use_indexer) {
           ED_file_indexer_entries_extend_from_datablock_infos(
-              &indexer_entries, group_datablock_infos, idcode);
+              &indexer_entries, lib_group.datablock_infos, lib_group.idcode);
         }
-        BLO_datablock_info_linklist_free(group_datablock_infos);
-        datablock_len += group_datablock_len;
+        datablock_len += lib_group.datablocks_num;
       }
+      BLO_datablock_info_linklist_free(lib_group.datablock_infos);
+      lib_group.datablock_infos = nullptr;
     }
-
-    BLI_linklist_freeN(groups);
   }
 
-  BLO_blendhandle_close(libfiledata);
+  if (libfiledata) {
+    BLO_blendhandle_close(libfiledata);
+  }
 
   /* Update the index. */
   if (use_indexer) {
@@ -644,6 +751,47 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
   return added_entries_len;
 }
 
+/**
+ * Number of library files read ahead in parallel at once. Keeps the number of files opened at the
+ * same time bounded, and lets the entries of the first files show up in the file list early.
+ */
+static constexpr int LIST_LIB_PREFETCH_BATCH_SIZE = 64;
+
+/**
+ * Read the contents of the libraries at the end of \a libs_to_prefetch in parallel, since that is
+ * the order in which they are popped from the stack of directories to read.
+ */
+static void filelist_readjob_list_libs_prefetch(
+    Vector<std::string> &libs_to_prefetch,
+    Map<std::string, std::unique_ptr<ListLibPrefetch>> &prefetched_libs,
+    const ListLibOptions options,
+    FileIndexer *indexer_runtime,
+    const bool *stop)
+{
+  const int batch_size = std::min<int>(libs_to_prefetch.size(), LIST_LIB_PREFETCH_BATCH_SIZE);
+  Array<std::string> paths(batch_size);
+  for (const int i : paths.index_range()) {
+    paths[i] = libs_to_prefetch.pop_last();
+  }
+
+  Array<std::unique_ptr<ListLibPrefetch>> prefetches(batch_size);
+  threading::parallel_for(paths.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (*stop) {
+        return;
+      }
+      prefetches[i] = filelist_readjob_list_lib_prefetch(
+          paths[i].c_str(), options, indexer_runtime);
+    }
+  });
+
+  for (const int i : paths.index_range()) {
+    if (prefetches[i]) {
+      prefetched_libs.add(std::move(paths[i]), std::move(prefetches[i]));
+    }
+  }
+}
+
 static bool filelist_readjob_should_recurse_into_entry(const int max_recursion,
                                                        const bool is_lib,
                                                        const int current_recursion_level,
@@ -715,6 +863,13 @@ void filelist_readjob_recursive_dir_add_items(const bool do_lib,
     indexer_runtime.user_data = indexer_runtime.callbacks->init_user_data(dir, sizeof(dir));
   }
 
+  /* When listing libraries recursively (e.g. for asset libraries), the library files found in a
+   * directory are read ahead in parallel, which matters a lot for libraries with many files or
+   * on network drives. */
+  const bool use_prefetch = do_lib && max_recursion > 0;
+  Vector<std::string> libs_to_prefetch;
+  Map<std::string, std::unique_ptr<ListLibPrefetch>> prefetched_libs;
+
   while (!BLI_stack_is_empty(todo_dirs) && !(*stop)) {
     int entries_num = 0;
 
@@ -760,8 +915,13 @@ void filelist_readjob_recursive_dir_add_items(const bool do_lib,
       if (job_params->load_asset_library) {
         list_lib_options |= LIST_LIB_ASSETS_ONLY;
       }
+      if (use_prefetch && !libs_to_prefetch.is_empty() && libs_to_prefetch.last() == subdir) {
+        filelist_readjob_list_libs_prefetch(
+            libs_to_prefetch, prefetched_libs, list_lib_options, &indexer_runtime, stop);
+      }
+      std::unique_ptr<ListLibPrefetch> prefetch = prefetched_libs.pop_default(subdir, nullptr);
       std::optional<int> lib_entries_num = filelist_readjob_list_lib(
-          job_params, subdir, &entries, list_lib_options, &indexer_runtime);
+          job_params, subdir, &entries, list_lib_options, &indexer_runtime, prefetch.get());
       if (lib_entries_num) {
         is_lib = true;
         entries_num += *lib_entries_num;
@@ -797,6 +957,9 @@ void filelist_readjob_recursive_dir_add_items(const bool do_lib,
         td_dir->level = recursion_level + 1;
         td_dir->dir = BLI_strdup(dir);
         dirs_todo_count++;
+        if (use_prefetch && (entry.typeflag & FILE_TYPE_BLENDER)) {
+          libs_to_prefetch.append(dir);
+        }
       }
     }
 
@@ -26,6 +26,7 @@
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 #include "BLI_math_base.h"
+#include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
@@ -447,6 +448,37 @@ static void utile_restore(
   tmpibuf->byte_buffer.data = prev_rect;
 }
 
+/**
+ * Check whether the tile already matches this region of the image, so that restoring it can be
+ * skipped and the region doesn't need to be updated on the GPU.
+ */
+static bool utile_matches_imbuf(const UndoImageTile *utile,
+                                const uint x,
+                                const uint y,
+                                const ImBuf *ibuf)
+{
+  if (ibuf->channels != 4) {
+    return false;
+  }
+  const bool has_float = ibuf->float_buffer.data;
+  const size_t pixel_size = has_float ? sizeof(float[4]) : sizeof(uint8_t[4]);
+  const uint8_t *tile_data = static_cast<const uint8_t *>(utile->rect.pt);
+  const uint8_t *ibuf_data = has_float ?
+                                 reinterpret_cast<const uint8_t *>(ibuf->float_buffer.data) :
+                                 ibuf->byte_buffer.data;
+
+  const int width = std::min(ED_IMAGE_UNDO_TILE_SIZE, ibuf->x - int(x));
+  const int height = std::min(ED_IMAGE_UNDO_TILE_SIZE, ibuf->y - int(y));
+  for (int row = 0; row < height; row++) {
+    const uint8_t *tile_row = tile_data + size_t(row) * ED_IMAGE_UNDO_TILE_SIZE * pixel_size;
+    const uint8_t *ibuf_row = ibuf_data + (size_t(y + row) * ibuf->x + x) * pixel_size;
+    if (memcmp(tile_row, ibuf_row, size_t(width) * pixel_size) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static void utile_decref(UndoImageTile *utile)
 {
   utile->users -= 1;
@@ -536,20 +568,26 @@ static void ubuf_from_image_all_tiles(UndoImageBuf *ubuf, const ImBuf *ibuf)
   IMB_freeImBuf(tmpibuf);
 }
 
-/** Ensure we can copy the ubuf into the ibuf. */
-static void ubuf_ensure_compat_ibuf(const UndoImageBuf *ubuf, ImBuf *ibuf)
+/**
+ * Ensure we can copy the ubuf into the ibuf.
+ *
+ * \return false when the buffers of the ibuf had to be changed for that.
+ */
+static bool ubuf_ensure_compat_ibuf(const UndoImageBuf *ubuf, ImBuf *ibuf)
 {
+  bool is_compatible = true;
   /* We could have both float and rect buffers,
    * in this case free the float buffer if it's unused. */
   if ((ibuf->float_buffer.data != nullptr) && (ubuf->image_state.use_float == false)) {
     IMB_free_float_pixels(ibuf);
+    is_compatible = false;
   }
 
   if (ibuf->x == ubuf->image_dims[0] && ibuf->y == ubuf->image_dims[1] &&
       (ubuf->image_state.use_float ? static_cast<void *>(ibuf->float_buffer.data) :
                                      static_cast<void *>(ibuf->byte_buffer.data)))
   {
-    return;
+    return is_compatible;
   }
 
   IMB_free_all_data(ibuf);
@@ -561,6 +599,7 @@ static void ubuf_ensure_compat_ibuf(const UndoImageBuf *ubuf, ImBuf *ibuf)
   else {
     IMB_alloc_byte_pixels(ibuf);
   }
+  return false;
 }
 
 static void ubuf_free(UndoImageBuf *ubuf)
@@ -614,27 +653,39 @@ static void uhandle_restore_list(ListBaseT<UndoImageHandle> *undo_handles, bool
       CLOG_ERROR(&LOG, "Unable to get buffer for image '%s'", image->id.name + 2);
       continue;
     }
+    const ImageTile *image_tile = BKE_image_get_tile_from_iuser(image, &uh.iuser);
     bool changed = false;
     for (UndoImageBuf &ubuf_iter : uh.buffers) {
       UndoImageBuf *ubuf = use_init ? &ubuf_iter : ubuf_iter.post;
-      ubuf_ensure_compat_ibuf(ubuf, ibuf);
+      const bool was_compatible = ubuf_ensure_compat_ibuf(ubuf, ibuf);
 
       int i = 0;
       for (uint y_tile = 0; y_tile < ubuf->tiles_dims[1]; y_tile += 1) {
         uint y = y_tile << ED_IMAGE_UNDO_TILE_BITS;
         for (uint x_tile = 0; x_tile < ubuf->tiles_dims[0]; x_tile += 1) {
           uint x = x_tile << ED_IMAGE_UNDO_TILE_BITS;
-          utile_restore(ubuf->tiles[i], x, y, ibuf, tmpibuf);
-          changed = true;
+          /* Most tiles are typically untouched by the stroke, only update the ones that differ so
+           * that the GPU texture doesn't have to be uploaded again completely. */
+          if (!was_compatible || !utile_matches_imbuf(ubuf->tiles[i], x, y, ibuf)) {
+            utile_restore(ubuf->tiles[i], x, y, ibuf, tmpibuf);
+            changed = true;
+            if (was_compatible) {
+              rcti tile_region;
+              BLI_rcti_init(
+                  &tile_region, x, x + ED_IMAGE_UNDO_TILE_SIZE, y, y + ED_IMAGE_UNDO_TILE_SIZE);
+              BKE_image_partial_update_mark_region(image, image_tile, ibuf, &tile_region);
+            }
+          }
           i += 1;
         }
       }
+      if (!was_compatible) {
+        BKE_image_partial_update_mark_full_update(image);
+      }
     }
 
     if (changed) {
       BKE_image_mark_dirty(image, ibuf);
-      /* TODO(@jbakker): only mark areas that are actually updated to improve performance. */
-      BKE_image_partial_update_mark_full_update(image);
 
       if (ibuf->float_buffer.data) {
         ibuf->userflags |= IB_RECT_INVALID; /* Force recreate of char `rect` */
@@ -796,6 +796,25 @@ const char *ED_info_statusbar_string_ex(Main *bmain,
     uintptr_t mem_in_use = MEM_get_memory_in_use();
     BLI_str_format_byte_unit(formatted_mem, mem_in_use, false);
     ofs += BLI_snprintf_utf8_rlen(info + ofs, len - ofs, IFACE_("Memory: %s"), formatted_mem);
+
+    /* Show the category that uses the most memory, see #MEM_memory_category_set. */
+    int largest_category = MEM_MEMORY_CATEGORY_NONE;
+    size_t largest_category_mem = 0;
+    for (int category = 1; category < MEM_memory_categories_num(); category++) {
+      const size_t category_mem = MEM_memory_category_in_use(category);
+      if (category_mem > largest_category_mem) {
+        largest_category = category;
+        largest_category_mem = category_mem;
+      }
+    }
+    if (largest_category != MEM_MEMORY_CATEGORY_NONE) {
+      BLI_str_format_byte_unit(formatted_mem, largest_category_mem, false);
+      ofs += BLI_snprintf_utf8_rlen(info + ofs,
+                                    len - ofs,
+                                    " (%s: %s)",
+                                    MEM_memory_category_name(largest_category),
+                                    formatted_mem);
+    }
   }
 
   /* GPU VRAM status. */
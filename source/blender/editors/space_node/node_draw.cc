@@ -161,17 +161,21 @@ struct TreeDrawContext {
   Map<const bNode *, const bNode *> menu_switch_source_by_index_switch;
 
   /**
-   * Precomputed extra info rows for each node. This avoids having to compute them multiple times
-   * during drawing. The array is indexed by `bNode::index()`.
+   * Cached extra info rows for each node. They are only computed when needed, because building
+   * them is relatively expensive and most nodes of large trees are not drawn. The array is indexed
+   * by `bNode::index()`.
    */
-  Array<Vector<NodeExtraInfoRow>> extra_info_rows_per_node;
+  Array<std::optional<Vector<NodeExtraInfoRow>>> extra_info_rows_per_node;
 
   Map<int32_t, VectorSet<std::string>> shader_node_errors;
 
   ~TreeDrawContext()
   {
-    for (MutableSpan<NodeExtraInfoRow> rows : this->extra_info_rows_per_node) {
-      for (NodeExtraInfoRow &row : rows) {
+    for (std::optional<Vector<NodeExtraInfoRow>> &rows : this->extra_info_rows_per_node) {
+      if (!rows) {
+        continue;
+      }
+      for (NodeExtraInfoRow &row : *rows) {
         if (row.tooltip_fn_free_arg) {
           BLI_assert(row.tooltip_fn_copy_arg);
           row.tooltip_fn_free_arg(row.tooltip_fn_arg);
@@ -2605,6 +2609,19 @@ static Vector<NodeExtraInfoRow> node_get_extra_info(const bContext &C,
   return rows;
 }
 
+static Span<NodeExtraInfoRow> node_get_extra_info_cached(const bContext &C,
+                                                         TreeDrawContext &tree_draw_ctx,
+                                                         const SpaceNode &snode,
+                                                         const bNode &node)
+{
+  std::optional<Vector<NodeExtraInfoRow>> &rows =
+      tree_draw_ctx.extra_info_rows_per_node[node.index()];
+  if (!rows) {
+    rows = node_get_extra_info(C, tree_draw_ctx, snode, node);
+  }
+  return *rows;
+}
+
 static void node_draw_extra_info_row(const bNode &node,
                                      ui::Block &block,
                                      const rctf &rect,
@@ -2713,8 +2730,8 @@ static void node_draw_extra_info_panel(const bContext &C,
     /* If the preview has an non-drawable size, just don't draw it. */
     preview = nullptr;
   }
-  const Span<NodeExtraInfoRow> extra_info_rows =
-      tree_draw_ctx.extra_info_rows_per_node[node.index()];
+  const Span<NodeExtraInfoRow> extra_info_rows = node_get_extra_info_cached(
+      C, tree_draw_ctx, snode, node);
   if (extra_info_rows.is_empty() && !preview) {
     return;
   }
@@ -3574,7 +3591,7 @@ static rctf calc_node_frame_dimensions(const bContext &C,
      * This has to get the full extra_rows information (including all the text strings), even
      * though all that's actually needed is the count of how many info_rows there are. */
     if (snode.overlay.flag & SN_OVERLAY_SHOW_OVERLAYS) {
-      extra_row_padding = tree_draw_ctx.extra_info_rows_per_node[node.index()].size() *
+      extra_row_padding = node_get_extra_info_cached(C, tree_draw_ctx, snode, node).size() *
                           EXTRA_INFO_ROW_HEIGHT;
     }
 
@@ -4753,12 +4770,6 @@ static void draw_nodetree(const bContext &C,
     }
   }
 
-  for (const int i : nodes.index_range()) {
-    const bNode &node = *nodes[i];
-    tree_draw_ctx.extra_info_rows_per_node[node.index()] = node_get_extra_info(
-        C, tree_draw_ctx, *snode, node);
-  }
-
   node_update_nodetree(C, tree_draw_ctx, ntree, nodes, blocks);
   node_draw_zones_and_frames(region, *snode, ntree);
   node_draw_nodetree(C, tree_draw_ctx, region, *snode, ntree, nodes, blocks, parent_key);
@@ -292,6 +292,7 @@ TreeElement *outliner_add_collection_recursive(SpaceOutliner *space_outliner,
                                                TreeElement *ten);
 
 bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *space_outliner);
+bool outliner_requires_rebuild_on_visibility_change(const SpaceOutliner *space_outliner);
 
 struct IDsSelectedData {
   ListBaseT<LinkData> selected_array;
@@ -186,6 +186,14 @@ bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *s
   return exclude_flags & (SO_FILTER_OB_STATE_SELECTED | SO_FILTER_OB_STATE_ACTIVE);
 }
 
+bool outliner_requires_rebuild_on_visibility_change(const SpaceOutliner *space_outliner)
+{
+  int exclude_flags = outliner_exclude_filter_get(space_outliner);
+  /* Hiding objects only changes flags of their bases, so the tree only has to be rebuilt to
+   * re-apply filters based on the object state. Hiding also deselects objects. */
+  return exclude_flags & SO_FILTER_OB_STATE;
+}
+
 #ifdef WITH_FREESTYLE
 static void outliner_add_line_styles(SpaceOutliner *space_outliner,
                                      ListBaseT<TreeElement> *lb,
@@ -11,6 +11,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_array.hh"
+#include "BLI_bitmap.h"
 #include "BLI_linklist_stack.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
@@ -171,6 +172,14 @@ struct TransCustomDataLayer {
   } merge_group;
 
   bool use_merge_group;
+
+  /**
+   * One bit per #TransData and #TransDataMirror, set when the vertex was displaced the last time
+   * its custom-data was corrected. Vertices that stay at their original location keep their
+   * original custom-data, so correcting them can be skipped unless they were moved before
+   * (e.g. when they are outside of the proportional editing radius).
+   */
+  BLI_bitmap *verts_displaced;
 };
 
 #define USE_FACE_SUBSTITUTE
@@ -394,6 +403,7 @@ static TransCustomDataLayer *mesh_customdatacorrect_create_impl(TransDataContain
   /* Init `cd_loop_mdisp_offset` to -1 to avoid problems with a valid index. */
   tcld->cd_loop_mdisp_offset = -1;
   tcld->use_merge_group = use_merge_group;
+  tcld->verts_displaced = BLI_BITMAP_NEW(tc->data_len + tc->data_mirror_len, __func__);
 
   mesh_customdatacorrect_init_container_generic(tc, tcld);
 
@@ -450,6 +460,7 @@ static void mesh_customdatacorrect_free(TransCustomDataLayer *tcld)
   if (tcld->merge_group.customdatalayer_map) {
     MEM_delete(tcld->merge_group.customdatalayer_map);
   }
+  MEM_delete(tcld->verts_displaced);
 
   MEM_delete(tcld);
 }
@@ -667,26 +678,31 @@ static void mesh_customdatacorrect_apply(TransDataContainer *tc, bool is_final)
     return;
   }
   const bool use_merge_group = tcld->use_merge_group;
-
   TransCustomDataMergeGroup *merge_data = tcld->merge_group.data;
-  TransData *tob = tc->data;
-  for (int i = tc->data_len; i--; tob++) {
-    mesh_customdatacorrect_apply_vert(
-        tcld, static_cast<TransDataBasic *>(tob), merge_data, is_final);
 
+  /* With proportional editing most vertices often don't move, skip the ones that didn't move
+   * since the last correction. */
+  auto apply_vert = [&](TransDataBasic *td_basic, const int index) {
+    const BMVert *v = static_cast<const BMVert *>(td_basic->extra);
+    const bool is_displaced = !equals_v3v3(v->co, td_basic->iloc);
+    if (is_displaced || is_final || BLI_BITMAP_TEST(tcld->verts_displaced, index)) {
+      mesh_customdatacorrect_apply_vert(tcld, td_basic, merge_data, is_final);
+      BLI_BITMAP_SET(tcld->verts_displaced, index, is_displaced);
+    }
     if (use_merge_group) {
       merge_data++;
     }
+  };
+
+  int index = 0;
+  TransData *tob = tc->data;
+  for (int i = tc->data_len; i--; tob++, index++) {
+    apply_vert(static_cast<TransDataBasic *>(tob), index);
   }
 
   TransDataMirror *td_mirror = tc->data_mirror;
-  for (int i = tc->data_mirror_len; i--; td_mirror++) {
-    mesh_customdatacorrect_apply_vert(
-        tcld, static_cast<TransDataBasic *>(td_mirror), merge_data, is_final);
-
-    if (use_merge_group) {
-      merge_data++;
-    }
+  for (int i = tc->data_mirror_len; i--; td_mirror++, index++) {
+    apply_vert(static_cast<TransDataBasic *>(td_mirror), index);
   }
 }
 
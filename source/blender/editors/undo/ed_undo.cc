@@ -14,6 +14,7 @@
 #include "DNA_scene_types.h"
 
 #include "BLI_listbase.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_blender_undo.hh"
@@ -96,6 +97,7 @@ void ED_undo_group_end(bContext *C)
 
 void ED_undo_push(bContext *C, const char *str)
 {
+  TRACE_ZONE("Undo Push");
   CLOG_INFO(&LOG, "Push '%s'", str);
   WM_file_tag_modified();
 
@@ -11,6 +11,10 @@
  * another #Graph again).
  */
 
+#include <atomic>
+#include <chrono>
+
+#include "BLI_array.hh"
 #include "BLI_generic_pointer.hh"
 #include "BLI_vector.hh"
 
@@ -37,6 +41,15 @@ class GraphExecutorLogger {
                                       const Params &params,
                                       const Context &context) const;
 
+  /**
+   * Called after a node has been processed. The duration is the time spent by the executor on the
+   * node besides the actual execution of the node (e.g. locking, notifying other nodes and
+   * scheduling them).
+   */
+  virtual void log_node_scheduling_overhead(const FunctionNode &node,
+                                            std::chrono::nanoseconds duration,
+                                            const Context &context) const;
+
   virtual void dump_when_outputs_are_missing(const FunctionNode &node,
                                              Span<const OutputSocket *> missing_sockets,
                                              const Context &context) const;
@@ -74,6 +87,19 @@ class GraphExecutorNodeExecuteWrapper {
                             const Context &context) const = 0;
 };
 
+/**
+ * Runtime statistics of a single node that are gathered over all evaluations of a
+ * #GraphExecutor.
+ */
+struct GraphExecutorNodeStats {
+  /** Number of times the node has been executed. */
+  int64_t executions_num = 0;
+  /** Moving average of the time spent in a single execution of the node. */
+  std::chrono::nanoseconds average_time{0};
+  /** Moving average of the executor overhead (locking, scheduling) of a single execution. */
+  std::chrono::nanoseconds average_overhead{0};
+};
+
 class GraphExecutor : public LazyFunction {
  public:
   using Logger = GraphExecutorLogger;
@@ -118,6 +144,18 @@ class GraphExecutor : public LazyFunction {
     int total_size;
   } init_buffer_info_;
 
+  /**
+   * Statistics that are updated from multiple threads while the graph is evaluated. They are used
+   * to estimate how expensive scheduled nodes are, which helps deciding whether it's worth
+   * running them in separate tasks. Indexed by #Node::index_in_graph.
+   */
+  struct AtomicNodeStats {
+    std::atomic<int64_t> executions_num = 0;
+    std::atomic<int64_t> average_time_ns = 0;
+    std::atomic<int64_t> average_overhead_ns = 0;
+  };
+  mutable Array<AtomicNodeStats> node_stats_;
+
   friend class Executor;
 
  public:
@@ -139,6 +177,11 @@ class GraphExecutor : public LazyFunction {
   std::string input_name(int index) const override;
   std::string output_name(int index) const override;
 
+  /**
+   * Get the runtime statistics of the given node accumulated over all evaluations so far.
+   */
+  GraphExecutorNodeStats node_stats(const FunctionNode &node) const;
+
  private:
   void execute_impl(Params &params, const Context &context) const override;
 };
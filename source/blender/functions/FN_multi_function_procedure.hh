@@ -274,6 +274,8 @@ class Procedure : NonCopyable, NonMovable {
   Span<Variable *> variables();
   Span<const Variable *> variables() const;
 
+  bool has_branches() const;
+
   std::string to_dot() const;
 
   bool validate() const;
@@ -520,6 +522,11 @@ inline Span<const Variable *> Procedure::variables() const
   return variables_;
 }
 
+inline bool Procedure::has_branches() const
+{
+  return !branch_instructions_.is_empty();
+}
+
 template<typename T, typename... Args>
 inline const MultiFunction &Procedure::construct_function(Args &&...args)
 {
@@ -9,6 +9,7 @@
  */
 
 #include "FN_multi_function_procedure.hh"
+#include "FN_multi_function_procedure_optimization.hh"
 
 namespace blender::fn::multi_function {
 
@@ -17,6 +18,13 @@ class ProcedureExecutor : public MultiFunction {
  private:
   Signature signature_;
   const Procedure &procedure_;
+  /**
+   * True when the procedure has no branches and only single-value parameters. Such procedures are
+   * evaluated in smaller tiles, so that intermediate buffers stay in the CPU cache.
+   */
+  bool use_tiled_evaluation_ = false;
+  /** Preplanned buffers for intermediate variables, see #assign_buffer_slots. */
+  procedure_optimization::BufferSlots buffer_slots_;
 
  public:
   ProcedureExecutor(const Procedure &procedure);
@@ -23,6 +23,8 @@
  *   impact on performance.
  */
 
+#include "BLI_array.hh"
+
 #include "FN_multi_function_procedure.hh"
 
 namespace blender::fn::multi_function::procedure_optimization {
@@ -46,4 +48,25 @@ namespace blender::fn::multi_function::procedure_optimization {
  */
 void move_destructs_up(Procedure &procedure, Instruction &block_end_instr);
 
+struct BufferSlots {
+  /** Slot of every variable, indexed by #Variable::index_in_procedure. -1 if it has no slot. */
+  Array<int> slot_by_variable;
+  /** Size in bytes of a single element in each slot. */
+  Vector<int64_t> element_size_by_slot;
+};
+
+/**
+ * Computes the lifetime of every intermediate variable in the procedure and assigns buffer slots
+ * to them, similar to register allocation. Variables whose lifetimes don't overlap and whose
+ * elements have the same size share a slot. The executor can then allocate all buffers at once
+ * before it starts, and the buffers of variables that have been destructed are reused for
+ * variables that are computed later.
+ *
+ * Only straight-line procedures without branches are handled, where the lifetimes are known
+ * statically. For other procedures, no slots are assigned. Variables that are parameters of the
+ * procedure use memory provided by the caller and don't get a slot either. Running
+ * #move_destructs_up before makes the lifetimes shorter and allows more buffers to be shared.
+ */
+BufferSlots assign_buffer_slots(const Procedure &procedure);
+
 }  // namespace blender::fn::multi_function::procedure_optimization
@@ -42,6 +42,8 @@
  */
 
 #include <atomic>
+#include <chrono>
+#include <utility>
 
 #include "BLI_enumerable_thread_specific.hh"
 #include "BLI_function_ref.hh"
@@ -219,28 +221,65 @@ class GraphExecutorLFParams;
  */
 struct ScheduledNodes {
  private:
+  struct ScheduledNode {
+    const FunctionNode *node;
+    /**
+     * Estimated execution time based on previous evaluations, or -1 when the node has not been
+     * executed before. It's stored so that the same value is removed from the total again, even
+     * when the statistics changed in the mean time.
+     */
+    int64_t estimated_time_ns;
+  };
+
   /** Use two stacks of scheduled nodes for different priorities. */
-  Vector<const FunctionNode *> priority_;
-  Vector<const FunctionNode *> normal_;
+  Vector<ScheduledNode> priority_;
+  Vector<ScheduledNode> normal_;
+  /**
+   * Sum of the estimated execution times of all scheduled nodes. Nodes without an estimate are
+   * counted separately.
+   */
+  int64_t estimated_time_ns_ = 0;
+  int64_t nodes_without_estimate_num_ = 0;
 
  public:
-  void schedule(const FunctionNode &node, const bool is_priority)
+  ScheduledNodes() = default;
+
+  ScheduledNodes(ScheduledNodes &&other) noexcept
+      : priority_(std::move(other.priority_)),
+        normal_(std::move(other.normal_)),
+        estimated_time_ns_(std::exchange(other.estimated_time_ns_, 0)),
+        nodes_without_estimate_num_(std::exchange(other.nodes_without_estimate_num_, 0))
+  {
+  }
+
+  ScheduledNodes &operator=(ScheduledNodes &&other) noexcept
   {
+    priority_ = std::move(other.priority_);
+    normal_ = std::move(other.normal_);
+    estimated_time_ns_ = std::exchange(other.estimated_time_ns_, 0);
+    nodes_without_estimate_num_ = std::exchange(other.nodes_without_estimate_num_, 0);
+    return *this;
+  }
+
+  void schedule(const FunctionNode &node, const bool is_priority, const int64_t estimated_time_ns)
+  {
+    this->add_estimate(estimated_time_ns);
     if (is_priority) {
-      this->priority_.append(&node);
+      this->priority_.append({&node, estimated_time_ns});
     }
     else {
-      this->normal_.append(&node);
+      this->normal_.append({&node, estimated_time_ns});
     }
   }
 
   const FunctionNode *pop_next_node()
   {
-    if (!this->priority_.is_empty()) {
-      return this->priority_.pop_last();
-    }
-    if (!this->normal_.is_empty()) {
-      return this->normal_.pop_last();
+    for (Vector<ScheduledNode> *nodes : {&priority_, &normal_}) {
+      if (!nodes->is_empty()) {
+        const ScheduledNode scheduled_node = nodes->pop_last();
+        this->remove_estimate(scheduled_node.estimated_time_ns);
+        return scheduled_node.node;
+      }
     }
     return nullptr;
   }
@@ -255,6 +294,16 @@ struct ScheduledNodes {
     return priority_.size() + normal_.size();
   }
 
+  int64_t estimated_time_ns() const
+  {
+    return estimated_time_ns_;
+  }
+
+  int64_t nodes_without_estimate_num() const
+  {
+    return nodes_without_estimate_num_;
+  }
+
   /**
    * Split up the scheduled nodes into two groups that can be worked on in parallel.
    */
@@ -263,11 +312,40 @@ struct ScheduledNodes {
     BLI_assert(this != &other);
     const int64_t priority_split = priority_.size() / 2;
     const int64_t normal_split = normal_.size() / 2;
-    other.priority_.extend(priority_.as_span().drop_front(priority_split));
-    other.normal_.extend(normal_.as_span().drop_front(normal_split));
+    const Span<ScheduledNode> moved_priority = priority_.as_span().drop_front(priority_split);
+    const Span<ScheduledNode> moved_normal = normal_.as_span().drop_front(normal_split);
+    for (const Span<ScheduledNode> moved_nodes : {moved_priority, moved_normal}) {
+      for (const ScheduledNode &scheduled_node : moved_nodes) {
+        this->remove_estimate(scheduled_node.estimated_time_ns);
+        other.add_estimate(scheduled_node.estimated_time_ns);
+      }
+    }
+    other.priority_.extend(moved_priority);
+    other.normal_.extend(moved_normal);
     priority_.resize(priority_split);
     normal_.resize(normal_split);
   }
+
+ private:
+  void add_estimate(const int64_t estimated_time_ns)
+  {
+    if (estimated_time_ns < 0) {
+      nodes_without_estimate_num_++;
+    }
+    else {
+      estimated_time_ns_ += estimated_time_ns;
+    }
+  }
+
+  void remove_estimate(const int64_t estimated_time_ns)
+  {
+    if (estimated_time_ns < 0) {
+      nodes_without_estimate_num_--;
+    }
+    else {
+      estimated_time_ns_ -= estimated_time_ns;
+    }
+  }
 };
 
 struct CurrentTask {
@@ -741,12 +819,13 @@ class Executor {
       case NodeScheduleState::NotScheduled: {
         locked_node.node_state.schedule_state = NodeScheduleState::Scheduled;
         const FunctionNode &node = static_cast<const FunctionNode &>(locked_node.node);
+        const int64_t estimated_time_ns = this->get_estimated_time_ns(node);
         if (this->use_multi_threading()) {
           std::lock_guard lock{current_task.mutex};
-          current_task.scheduled_nodes.schedule(node, is_priority);
+          current_task.scheduled_nodes.schedule(node, is_priority, estimated_time_ns);
         }
         else {
-          current_task.scheduled_nodes.schedule(node, is_priority);
+          current_task.scheduled_nodes.schedule(node, is_priority, estimated_time_ns);
         }
         current_task.has_scheduled_nodes.store(true, std::memory_order_relaxed);
         break;
@@ -805,6 +884,39 @@ class Executor {
     }
   }
 
+  /**
+   * Estimated execution time of the node based on previous evaluations, or -1 if the node has not
+   * been executed yet.
+   */
+  int64_t get_estimated_time_ns(const FunctionNode &node) const
+  {
+    const GraphExecutor::AtomicNodeStats &stats = self_.node_stats_[node.index_in_graph()];
+    if (stats.executions_num.load(std::memory_order_relaxed) == 0) {
+      return -1;
+    }
+    return stats.average_time_ns.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Decide whether the scheduled nodes are worth distributing to multiple threads. Known cheap
+   * nodes are always run on the current thread, because spawning a task for them costs more than
+   * it saves.
+   */
+  static bool should_split_scheduled_nodes(const ScheduledNodes &scheduled_nodes)
+  {
+    /* Below this estimated amount of work, the overhead of a separate task is not worth it. */
+    static constexpr int64_t min_task_time_ns = 50'000;
+    if (scheduled_nodes.nodes_num() < 2) {
+      return false;
+    }
+    /* Without statistics, fall back to a simple heuristic. If there are many nodes scheduled at
+     * the same time, it's beneficial to let multiple threads work on those. */
+    if (scheduled_nodes.nodes_without_estimate_num() > 128) {
+      return true;
+    }
+    return scheduled_nodes.estimated_time_ns() > 2 * min_task_time_ns;
+  }
+
   void run_task(CurrentTask &current_task, const LocalData &local_data)
   {
     while (const FunctionNode *node = current_task.scheduled_nodes.pop_next_node()) {
@@ -813,9 +925,7 @@ class Executor {
       }
       this->run_node_task(*node, current_task, local_data);
 
-      /* If there are many nodes scheduled at the same time, it's beneficial to let multiple
-       * threads work on those. */
-      if (current_task.scheduled_nodes.nodes_num() > 128) {
+      if (should_split_scheduled_nodes(current_task.scheduled_nodes)) {
         if (this->try_enable_multi_threading()) {
           std::unique_ptr<ScheduledNodes> split_nodes = std::make_unique<ScheduledNodes>();
           current_task.scheduled_nodes.split_into(*split_nodes);
@@ -829,6 +939,10 @@ class Executor {
                      CurrentTask &current_task,
                      const LocalData &local_data)
   {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start_time = Clock::now();
+    std::chrono::nanoseconds execution_time{0};
+
     NodeState &node_state = *node_states_[node.index_in_graph()];
     LinearAllocator<> &allocator = *local_data.allocator;
     Context local_context{context_->storage, context_->user_data, local_data.local_user_data};
@@ -921,7 +1035,9 @@ class Executor {
       /* Importantly, the node must not be locked when it is executed. That would result in locks
        * being hold very long in some cases and results in multiple locks being hold by the same
        * thread in the same graph which can lead to deadlocks. */
+      const Clock::time_point execution_start_time = Clock::now();
       this->execute_node(node, node_state, current_task, local_data);
+      execution_time = Clock::now() - execution_start_time;
     }
 
     this->with_locked_node(
@@ -939,6 +1055,35 @@ class Executor {
             this->schedule_node(locked_node, current_task, false);
           }
         });
+
+    if (node_needs_execution) {
+      const std::chrono::nanoseconds overhead = Clock::now() - start_time - execution_time;
+      this->update_node_stats(node, execution_time, overhead);
+      if (self_.logger_ != nullptr) {
+        self_.logger_->log_node_scheduling_overhead(node, overhead, local_context);
+      }
+    }
+  }
+
+  /**
+   * Update the moving averages of the node statistics. Concurrent evaluations of the same graph
+   * may update the same statistics, so some samples can get lost. That is fine because they are
+   * only used as estimates.
+   */
+  void update_node_stats(const FunctionNode &node,
+                         const std::chrono::nanoseconds execution_time,
+                         const std::chrono::nanoseconds overhead)
+  {
+    GraphExecutor::AtomicNodeStats &stats = self_.node_stats_[node.index_in_graph()];
+    const bool is_first_sample = stats.executions_num.fetch_add(1, std::memory_order_relaxed) ==
+                                 0;
+    auto update_average = [&](std::atomic<int64_t> &average, const int64_t sample) {
+      const int64_t old_average = average.load(std::memory_order_relaxed);
+      const int64_t new_average = is_first_sample ? sample : (old_average * 3 + sample) / 4;
+      average.store(new_average, std::memory_order_relaxed);
+    };
+    update_average(stats.average_time_ns, execution_time.count());
+    update_average(stats.average_overhead_ns, overhead.count());
   }
 
   void assert_expected_outputs_have_been_computed(LockedNode &locked_node,
@@ -1485,7 +1630,8 @@ GraphExecutor::GraphExecutor(const Graph &graph,
       graph_output_index_by_socket_index_(graph.graph_outputs().size(), -1),
       logger_(logger),
       side_effect_provider_(side_effect_provider),
-      node_execute_wrapper_(node_execute_wrapper)
+      node_execute_wrapper_(node_execute_wrapper),
+      node_stats_(graph.nodes().size())
 {
   debug_name_ = graph.name().c_str();
 
@@ -1560,6 +1706,18 @@ std::string GraphExecutor::output_name(const int index) const
   return socket.name();
 }
 
+GraphExecutorNodeStats GraphExecutor::node_stats(const FunctionNode &node) const
+{
+  const AtomicNodeStats &stats = node_stats_[node.index_in_graph()];
+  GraphExecutorNodeStats result;
+  result.executions_num = stats.executions_num.load(std::memory_order_relaxed);
+  result.average_time = std::chrono::nanoseconds(
+      stats.average_time_ns.load(std::memory_order_relaxed));
+  result.average_overhead = std::chrono::nanoseconds(
+      stats.average_overhead_ns.load(std::memory_order_relaxed));
+  return result;
+}
+
 void GraphExecutorLogger::log_socket_value(const Socket &socket,
                                            const GPointer value,
                                            const Context &context) const
@@ -1588,6 +1746,13 @@ Vector<const FunctionNode *> GraphExecutorSideEffectProvider::get_nodes_with_sid
   return {};
 }
 
+void GraphExecutorLogger::log_node_scheduling_overhead(const FunctionNode &node,
+                                                       const std::chrono::nanoseconds duration,
+                                                       const Context &context) const
+{
+  UNUSED_VARS(node, duration, context);
+}
+
 void GraphExecutorLogger::dump_when_outputs_are_missing(const FunctionNode &node,
                                                         Span<const OutputSocket *> missing_sockets,
                                                         const Context &context) const
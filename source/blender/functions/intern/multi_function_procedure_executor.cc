@@ -4,6 +4,7 @@
 
 #include "FN_multi_function_procedure_executor.hh"
 
+#include "BLI_math_base.h"
 #include "BLI_stack.hh"
 
 namespace blender::fn::multi_function {
@@ -17,6 +18,15 @@ ProcedureExecutor::ProcedureExecutor(const Procedure &procedure) : procedure_(pr
   }
 
   this->set_signature(&signature_);
+
+  use_tiled_evaluation_ = !procedure.has_branches();
+  for (const ConstParameter &param : procedure.params()) {
+    if (!param.variable->data_type().is_single()) {
+      use_tiled_evaluation_ = false;
+    }
+  }
+
+  buffer_slots_ = procedure_optimization::assign_buffer_slots(procedure);
 }
 
 using IndicesSplitVectors = std::array<Vector<int64_t>, 2>;
@@ -148,8 +158,17 @@ class ValueAllocator : NonCopyable, NonMovable {
   Stack<void *> small_single_value_free_list_;
   Map<const CPPType *, Stack<void *>> single_value_free_lists_;
 
+  /**
+   * Span buffers are allocated with at least this many elements. This allows reusing the buffers
+   * when the procedure is evaluated multiple times with different masks.
+   */
+  int64_t min_span_size_;
+
  public:
-  ValueAllocator(LinearAllocator<> &linear_allocator) : linear_allocator_(linear_allocator) {}
+  ValueAllocator(LinearAllocator<> &linear_allocator, const int64_t min_span_size = 0)
+      : linear_allocator_(linear_allocator), min_span_size_(min_span_size)
+  {
+  }
 
   VariableValue_GVArray *obtain_GVArray(const GVArray &varray)
   {
@@ -166,9 +185,10 @@ class ValueAllocator : NonCopyable, NonMovable {
     return this->obtain<VariableValue_Span>(buffer, false);
   }
 
-  VariableValue_Span *obtain_Span(const CPPType &type, int size)
+  VariableValue_Span *obtain_Span(const CPPType &type, int64_t size)
   {
     void *buffer = nullptr;
+    size = std::max(size, min_span_size_);
 
     const int64_t element_size = type.size;
     const int64_t alignment = type.alignment;
@@ -310,6 +330,11 @@ class VariableState : NonCopyable, NonMovable {
   int tot_initialized_ = 0;
   /* This a non-owning pointer to either span buffer or #GVectorArray or null. */
   void *caller_provided_storage_ = nullptr;
+  /**
+   * Non-owning pointer to a buffer that has been allocated for this variable before the
+   * evaluation started. Other variables whose lifetime does not overlap may use the same buffer.
+   */
+  void *preallocated_buffer_ = nullptr;
 
   void destruct_value(ValueAllocator &value_allocator, const DataType &data_type)
   {
@@ -406,7 +431,10 @@ class VariableState : NonCopyable, NonMovable {
       case DataType::Single: {
         const CPPType &type = data_type.single_type();
         VariableValue_Span *new_value = nullptr;
-        if (caller_provided_storage_ == nullptr) {
+        if (preallocated_buffer_ != nullptr) {
+          new_value = value_allocator.obtain_Span_not_owned(preallocated_buffer_);
+        }
+        else if (caller_provided_storage_ == nullptr) {
           new_value = value_allocator.obtain_Span(type, array_size);
         }
         else {
@@ -813,17 +841,17 @@ class VariableState : NonCopyable, NonMovable {
 /** Keeps track of the states of all variables during evaluation. */
 class VariableStates {
  private:
-  ValueAllocator value_allocator_;
+  ValueAllocator &value_allocator_;
   const Procedure &procedure_;
   /** The state of every variable, indexed by #Variable::index_in_procedure(). */
   Array<VariableState> variable_states_;
   const IndexMask &full_mask_;
 
  public:
-  VariableStates(LinearAllocator<> &linear_allocator,
+  VariableStates(ValueAllocator &value_allocator,
                  const Procedure &procedure,
                  const IndexMask &full_mask)
-      : value_allocator_(linear_allocator),
+      : value_allocator_(value_allocator),
         procedure_(procedure),
         variable_states_(procedure.variables().size()),
         full_mask_(full_mask)
@@ -846,6 +874,20 @@ class VariableStates {
     return value_allocator_;
   }
 
+  void set_preallocated_buffers(const procedure_optimization::BufferSlots &buffer_slots,
+                                const Span<void *> buffer_by_slot)
+  {
+    if (buffer_by_slot.is_empty()) {
+      return;
+    }
+    for (const int variable_i : procedure_.variables().index_range()) {
+      const int slot = buffer_slots.slot_by_variable[variable_i];
+      if (slot != -1) {
+        variable_states_[variable_i].preallocated_buffer_ = buffer_by_slot[slot];
+      }
+    }
+  }
+
   const IndexMask &full_mask() const
   {
     return full_mask_;
@@ -1157,19 +1199,21 @@ class InstructionScheduler {
   }
 };
 
-void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context context) const
+static void execute_procedure(const ProcedureExecutor &fn,
+                              const Procedure &procedure,
+                              const IndexMask &full_mask,
+                              Params params,
+                              Context context,
+                              ValueAllocator &value_allocator,
+                              const procedure_optimization::BufferSlots &buffer_slots,
+                              const Span<void *> buffer_by_slot)
 {
-  BLI_assert(procedure_.validate());
-
-  AlignedBuffer<512, 64> local_buffer;
-  LinearAllocator<> linear_allocator;
-  linear_allocator.provide_buffer(local_buffer);
-
-  VariableStates variable_states{linear_allocator, procedure_, full_mask};
-  variable_states.add_initial_variable_states(*this, procedure_, params);
+  VariableStates variable_states{value_allocator, procedure, full_mask};
+  variable_states.add_initial_variable_states(fn, procedure, params);
+  variable_states.set_preallocated_buffers(buffer_slots, buffer_by_slot);
 
   InstructionScheduler scheduler;
-  scheduler.add_referenced_indices(*procedure_.entry(), full_mask);
+  scheduler.add_referenced_indices(*procedure.entry(), full_mask);
 
   /* Loop until all indices got to a return instruction. */
   while (!scheduler.is_done()) {
@@ -1218,9 +1262,9 @@ void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context
     }
   }
 
-  for (const int param_index : this->param_indices()) {
-    const ParamType param_type = this->param_type(param_index);
-    const Variable *variable = procedure_.params()[param_index].variable;
+  for (const int param_index : fn.param_indices()) {
+    const ParamType param_type = fn.param_type(param_index);
+    const Variable *variable = procedure.params()[param_index].variable;
     VariableState &variable_state = variable_states.get_variable_state(*variable);
     switch (param_type.interface_type()) {
       case ParamType::Input: {
@@ -1241,10 +1285,130 @@ void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context
   }
 }
 
+/**
+ * Number of indices that are processed at once when the procedure is evaluated in tiles. This is
+ * small enough so that the intermediate buffers of typical procedures fit into the CPU cache, but
+ * large enough so that the per-instruction overhead is negligible.
+ */
+static constexpr int64_t tile_size = 2048;
+
+/**
+ * Allocate the buffers for all slots in a single allocation.
+ */
+static Array<void *> allocate_slot_buffers(const procedure_optimization::BufferSlots &buffer_slots,
+                                           const int64_t array_size,
+                                           LinearAllocator<> &allocator)
+{
+  constexpr int64_t alignment = 64;
+  const Span<int64_t> element_sizes = buffer_slots.element_size_by_slot;
+  if (element_sizes.is_empty()) {
+    return {};
+  }
+  Array<int64_t> offsets(element_sizes.size());
+  int64_t total_size = 0;
+  for (const int slot : element_sizes.index_range()) {
+    offsets[slot] = total_size;
+    total_size += int64_t(ceil_to_multiple_ul(element_sizes[slot] * array_size, alignment));
+  }
+  char *buffer = static_cast<char *>(allocator.allocate(total_size, alignment));
+  Array<void *> buffer_by_slot(element_sizes.size());
+  for (const int slot : element_sizes.index_range()) {
+    buffer_by_slot[slot] = buffer + offsets[slot];
+  }
+  return buffer_by_slot;
+}
+
+static void add_tile_parameters(const Signature &signature,
+                                Params &full_params,
+                                const IndexRange tile_range,
+                                ParamsBuilder &r_tile_params)
+{
+  for (const int param_index : signature.params.index_range()) {
+    const ParamType &param_type = signature.params[param_index].type;
+    switch (param_type.category()) {
+      case ParamCategory::SingleInput: {
+        const GVArray &varray = full_params.readonly_single_input(param_index);
+        r_tile_params.add_readonly_single_input(varray.slice(tile_range));
+        break;
+      }
+      case ParamCategory::SingleMutable: {
+        const GMutableSpan span = full_params.single_mutable(param_index);
+        r_tile_params.add_single_mutable(span.slice(tile_range));
+        break;
+      }
+      case ParamCategory::SingleOutput: {
+        const GMutableSpan span = full_params.uninitialized_single_output(param_index);
+        r_tile_params.add_uninitialized_single_output(span.slice(tile_range));
+        break;
+      }
+      case ParamCategory::VectorInput:
+      case ParamCategory::VectorMutable:
+      case ParamCategory::VectorOutput: {
+        BLI_assert_unreachable();
+        break;
+      }
+    }
+  }
+}
+
+void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context context) const
+{
+  BLI_assert(procedure_.validate());
+
+  AlignedBuffer<512, 64> local_buffer;
+  LinearAllocator<> linear_allocator;
+  linear_allocator.provide_buffer(local_buffer);
+
+  const IndexRange full_range = full_mask.bounds();
+  if (!use_tiled_evaluation_ || full_range.size() <= tile_size) {
+    ValueAllocator value_allocator{linear_allocator};
+    const Array<void *> buffer_by_slot = allocate_slot_buffers(
+        buffer_slots_, full_mask.min_array_size(), linear_allocator);
+    execute_procedure(*this,
+                      procedure_,
+                      full_mask,
+                      params,
+                      context,
+                      value_allocator,
+                      buffer_slots_,
+                      buffer_by_slot);
+    return;
+  }
+
+  /* Evaluate the entire procedure for one tile at a time. Compared to evaluating every
+   * instruction for all indices, this keeps the intermediate values in the cache. The same
+   * intermediate buffers are reused for every tile. */
+  ValueAllocator value_allocator{linear_allocator, tile_size};
+  const Array<void *> buffer_by_slot = allocate_slot_buffers(
+      buffer_slots_, tile_size, linear_allocator);
+  for (int64_t tile_start = full_range.start(); tile_start < full_range.one_after_last();
+       tile_start += tile_size)
+  {
+    const IndexRange tile_range = IndexRange(tile_start, tile_size).intersect(full_range);
+    const IndexMask tile_mask = full_mask.slice_content(tile_range);
+    if (tile_mask.is_empty()) {
+      continue;
+    }
+    IndexMaskMemory memory;
+    const IndexMask shifted_mask = tile_mask.shift(-tile_start, memory);
+    ParamsBuilder tile_params{*this, &shifted_mask};
+    add_tile_parameters(signature_, params, tile_range, tile_params);
+    execute_procedure(*this,
+                      procedure_,
+                      shifted_mask,
+                      tile_params,
+                      context,
+                      value_allocator,
+                      buffer_slots_,
+                      buffer_by_slot);
+  }
+}
+
 MultiFunction::ExecutionHints ProcedureExecutor::get_execution_hints() const
 {
   ExecutionHints hints;
-  hints.allocates_array = true;
+  /* Tiled evaluation only allocates small intermediate buffers, independent of the mask size. */
+  hints.allocates_array = !use_tiled_evaluation_;
   hints.min_grain_size = 10000;
   return hints;
 }
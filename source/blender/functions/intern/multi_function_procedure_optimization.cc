@@ -4,6 +4,10 @@
 
 #include "FN_multi_function_procedure_optimization.hh"
 
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_stack.hh"
+
 namespace blender::fn::multi_function::procedure_optimization {
 
 void move_destructs_up(Procedure &procedure, Instruction &block_end_instr)
@@ -74,4 +78,93 @@ void move_destructs_up(Procedure &procedure, Instruction &block_end_instr)
   }
 }
 
+BufferSlots assign_buffer_slots(const Procedure &procedure)
+{
+  BufferSlots slots;
+  slots.slot_by_variable.reinitialize(procedure.variables().size());
+  slots.slot_by_variable.fill(-1);
+  if (procedure.has_branches()) {
+    return slots;
+  }
+
+  Set<const Variable *> param_variables;
+  for (const ConstParameter &param : procedure.params()) {
+    param_variables.add(param.variable);
+  }
+
+  /* Slots of variables that have been destructed already, by the size of their elements. */
+  Map<int64_t, Stack<int>> free_slots_by_element_size;
+  Set<const Variable *> destructed_variables;
+
+  const Instruction *current_instr = procedure.entry();
+  while (current_instr != nullptr) {
+    switch (current_instr->type()) {
+      case InstructionType::Call: {
+        const CallInstruction &call_instr = static_cast<const CallInstruction &>(*current_instr);
+        const MultiFunction &fn = call_instr.fn();
+        for (const int param_index : fn.param_indices()) {
+          const Variable *variable = call_instr.params()[param_index];
+          if (variable == nullptr) {
+            continue;
+          }
+          if (fn.param_type(param_index).interface_type() != ParamType::Output) {
+            continue;
+          }
+          const DataType data_type = variable->data_type();
+          if (!data_type.is_single() || param_variables.contains(variable)) {
+            continue;
+          }
+          const CPPType &type = data_type.single_type();
+          if (type.alignment > 64) {
+            continue;
+          }
+          int &slot = slots.slot_by_variable[variable->index_in_procedure()];
+          if (destructed_variables.contains(variable)) {
+            /* The variable is initialized a second time, so its slot may be used by another
+             * variable already. Don't use a slot for it at all, because it is not known which
+             * other variables would overlap. */
+            slot = -1;
+            continue;
+          }
+          Stack<int> &free_slots = free_slots_by_element_size.lookup_or_add_default(type.size);
+          if (free_slots.is_empty()) {
+            slot = slots.element_size_by_slot.append_and_get_index(type.size);
+          }
+          else {
+            slot = free_slots.pop();
+          }
+        }
+        current_instr = call_instr.next();
+        break;
+      }
+      case InstructionType::Destruct: {
+        const DestructInstruction &destruct_instr = static_cast<const DestructInstruction &>(
+            *current_instr);
+        if (const Variable *variable = destruct_instr.variable()) {
+          const int slot = slots.slot_by_variable[variable->index_in_procedure()];
+          if (slot != -1 && destructed_variables.add(variable)) {
+            free_slots_by_element_size.lookup(slots.element_size_by_slot[slot]).push(slot);
+          }
+        }
+        current_instr = destruct_instr.next();
+        break;
+      }
+      case InstructionType::Dummy: {
+        current_instr = static_cast<const DummyInstruction &>(*current_instr).next();
+        break;
+      }
+      case InstructionType::Return: {
+        current_instr = nullptr;
+        break;
+      }
+      case InstructionType::Branch: {
+        BLI_assert_unreachable();
+        current_instr = nullptr;
+        break;
+      }
+    }
+  }
+  return slots;
+}
+
 }  // namespace blender::fn::multi_function::procedure_optimization
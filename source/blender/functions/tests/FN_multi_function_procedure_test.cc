@@ -7,6 +7,7 @@
 #include "FN_multi_function_builder.hh"
 #include "FN_multi_function_procedure_builder.hh"
 #include "FN_multi_function_procedure_executor.hh"
+#include "FN_multi_function_procedure_optimization.hh"
 #include "FN_multi_function_test_common.hh"
 
 namespace blender::fn::multi_function::tests {
@@ -96,6 +97,113 @@ TEST(multi_function_procedure, SimpleTest)
   EXPECT_EQ(output_array[2], 19);
 }
 
+TEST(multi_function_procedure, TiledEvaluation)
+{
+  /**
+   * procedure(int var1, int *var3) {
+   *   int var2 = var1 + var1;
+   *   var3 = var2 + var1;
+   * }
+   */
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+
+  Procedure procedure;
+  ProcedureBuilder builder{procedure};
+
+  Variable *var1 = &builder.add_single_input_parameter<int>();
+  auto [var2] = builder.add_call<1>(add_fn, {var1, var1});
+  auto [var3] = builder.add_call<1>(add_fn, {var2, var1});
+  builder.add_destruct({var1, var2});
+  builder.add_return();
+  builder.add_output_parameter(*var3);
+
+  EXPECT_TRUE(procedure.validate());
+
+  ProcedureExecutor executor{procedure};
+
+  /* Use a sparse mask that is large enough to be split into multiple tiles. */
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      IndexRange(10000), memory, [](const int64_t i) { return i % 3 != 0; });
+  ParamsBuilder params{executor, &mask};
+  ContextBuilder context;
+
+  Array<int> input_array(10000);
+  for (const int i : input_array.index_range()) {
+    input_array[i] = i;
+  }
+  params.add_readonly_single_input(input_array.as_span());
+
+  Array<int> output_array(10000, -1);
+  params.add_uninitialized_single_output(output_array.as_mutable_span());
+
+  executor.call(mask, params, context);
+
+  for (const int i : output_array.index_range()) {
+    EXPECT_EQ(output_array[i], i % 3 != 0 ? i * 3 : -1);
+  }
+}
+
+TEST(multi_function_procedure, BufferSlots)
+{
+  /**
+   * procedure(int var1, int *var5) {
+   *   int var2 = var1 + var1;
+   *   int var3 = var2 + var1;
+   *   int var4 = var3 + var3;
+   *   var5 = var4 + var4;
+   * }
+   */
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+
+  Procedure procedure;
+  ProcedureBuilder builder{procedure};
+
+  Variable *var1 = &builder.add_single_input_parameter<int>();
+  auto [var2] = builder.add_call<1>(add_fn, {var1, var1});
+  auto [var3] = builder.add_call<1>(add_fn, {var2, var1});
+  builder.add_destruct({var1, var2});
+  auto [var4] = builder.add_call<1>(add_fn, {var3, var3});
+  builder.add_destruct(*var3);
+  auto [var5] = builder.add_call<1>(add_fn, {var4, var4});
+  builder.add_destruct(*var4);
+  builder.add_return();
+  builder.add_output_parameter(*var5);
+
+  EXPECT_TRUE(procedure.validate());
+
+  const procedure_optimization::BufferSlots slots = procedure_optimization::assign_buffer_slots(
+      procedure);
+  EXPECT_EQ(slots.element_size_by_slot.size(), 2);
+  EXPECT_EQ(slots.slot_by_variable[var1->index_in_procedure()], -1);
+  EXPECT_EQ(slots.slot_by_variable[var2->index_in_procedure()], 0);
+  EXPECT_EQ(slots.slot_by_variable[var3->index_in_procedure()], 1);
+  /* The buffer of the destructed variable is reused. */
+  EXPECT_EQ(slots.slot_by_variable[var4->index_in_procedure()], 0);
+  EXPECT_EQ(slots.slot_by_variable[var5->index_in_procedure()], -1);
+
+  ProcedureExecutor executor{procedure};
+
+  const IndexMask mask(IndexRange(1, 3));
+  ParamsBuilder params{executor, &mask};
+  ContextBuilder context;
+
+  Array<int> input_array = {0, 1, 2, 3};
+  params.add_readonly_single_input(input_array.as_span());
+
+  Array<int> output_array(4, -1);
+  params.add_uninitialized_single_output(output_array.as_mutable_span());
+
+  executor.call(mask, params, context);
+
+  EXPECT_EQ(output_array[0], -1);
+  EXPECT_EQ(output_array[1], 12);
+  EXPECT_EQ(output_array[2], 24);
+  EXPECT_EQ(output_array[3], 36);
+}
+
 TEST(multi_function_procedure, BranchTest)
 {
   /**
@@ -58,6 +58,18 @@ bke::VolumeGridData *fog_volume_grid_add_from_mesh(Volume *volume,
                                                    float interior_band_width,
                                                    float density);
 
+/**
+ * Estimate the memory in bytes used by the fog grid that #fog_volume_grid_add_from_mesh creates,
+ * without creating it. The fully inside parts of the volume are stored as tiles, so the estimate
+ * is based on the voxels in the band around the surface.
+ */
+int64_t mesh_to_volume_memory_estimate(Span<float3> positions,
+                                       Span<int> corner_verts,
+                                       Span<int3> corner_tris,
+                                       const float4x4 &mesh_to_volume_space_transform,
+                                       float voxel_size,
+                                       float interior_band_width);
+
 bke::VolumeGrid<float> mesh_to_density_grid(const Span<float3> positions,
                                             const Span<int> corner_verts,
                                             const Span<int3> corner_tris,
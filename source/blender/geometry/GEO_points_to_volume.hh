@@ -34,6 +34,15 @@ bke::VolumeGrid<float> points_to_sdf_grid(Span<float3> positions,
                                           Span<float> radii,
                                           float voxel_size);
 
+/**
+ * Estimate the memory in bytes used by the grid that is created from the points, without
+ * creating it. Only the narrow band around the spheres uses memory. Overlapping spheres are
+ * counted multiple times, so the estimate is an upper bound, limited by the bounding box.
+ */
+int64_t points_to_volume_memory_estimate(Span<float3> positions,
+                                         Span<float> radii,
+                                         float voxel_size);
+
 #endif
 }  // namespace geometry
 }  // namespace blender
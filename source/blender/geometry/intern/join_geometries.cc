@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "BLI_array_utils.hh"
+#include "BLI_task.hh"
 
 #include "GEO_join_geometries.hh"
 #include "GEO_realize_instances.hh"
@@ -36,29 +37,29 @@ static GeometrySet::GatheredAttributes get_final_attribute_info(
 }
 
 static void fill_new_attribute(const Span<const GeometryComponent *> src_components,
+                               const OffsetIndices<int> dst_offsets,
                                const StringRef name,
                                const bke::AttrType data_type,
                                const bke::AttrDomain domain,
                                GMutableSpan dst_span)
 {
-  const CPPType &cpp_type = bke::attribute_type_to_cpp_type(data_type);
-
-  int offset = 0;
-  for (const GeometryComponent *component : src_components) {
-    const int domain_num = component->attribute_domain_size(domain);
-    if (domain_num == 0) {
-      continue;
-    }
-    GVArray read_attribute = *component->attributes()->lookup_or_default(
-        name, domain, data_type, nullptr);
-
-    GVArraySpan src_span{read_attribute};
-    const void *src_buffer = src_span.data();
-    void *dst_buffer = dst_span[offset];
-    cpp_type.copy_construct_n(src_buffer, dst_buffer, domain_num);
-
-    offset += domain_num;
-  }
+  /* Components are copied in parallel, since they write to separate parts of the result. */
+  threading::parallel_for(
+      src_components.index_range(),
+      1,
+      [&](const IndexRange range) {
+        for (const int i : range) {
+          const IndexRange dst_range = dst_offsets[i];
+          if (dst_range.is_empty()) {
+            continue;
+          }
+          const GVArray src = *src_components[i]->attributes()->lookup_or_default(
+              name, domain, data_type, nullptr);
+          array_utils::copy(src, dst_span.slice(dst_range));
+        }
+      },
+      threading::accumulated_task_sizes(
+          [&](const IndexRange range) { return dst_offsets[range].size(); }));
 }
 
 static bool try_join_single_value_attribute(const Span<const GeometryComponent *> src_components,
@@ -114,6 +115,22 @@ static void join_attributes(const Span<const GeometryComponent *> src_components
                                                                         ignored_attributes);
   bke::MutableAttributeAccessor dst_attributes = *result.attributes_for_write();
 
+  /* Offsets of every component in the result, per domain. */
+  Map<bke::AttrDomain, Array<int>> offsets_by_domain;
+  const auto ensure_offsets = [&](const bke::AttrDomain domain) {
+    offsets_by_domain.lookup_or_add_cb(domain, [&]() {
+      Array<int> offsets(src_components.size() + 1);
+      for (const int i : src_components.index_range()) {
+        offsets[i] = src_components[i]->attribute_domain_size(domain);
+      }
+      offset_indices::accumulate_counts_to_offsets(offsets);
+      return offsets;
+    });
+  };
+
+  /* Adding attributes is not thread-safe, so create all of them before copying the values. */
+  Vector<int> attributes_to_fill;
+  Vector<bke::GSpanAttributeWriter> writers;
   for (const int i : info.names.index_range()) {
     const StringRef name = info.names[i];
     const AttributeDomainAndType &meta_data = info.kinds[i];
@@ -129,9 +146,26 @@ static void join_attributes(const Span<const GeometryComponent *> src_components
     if (!write_attribute) {
       continue;
     }
-    fill_new_attribute(
-        src_components, name, meta_data.data_type, meta_data.domain, write_attribute.span);
-    write_attribute.finish();
+    ensure_offsets(meta_data.domain);
+    attributes_to_fill.append(i);
+    writers.append(std::move(write_attribute));
+  }
+
+  threading::parallel_for(writers.index_range(), 1, [&](const IndexRange range) {
+    for (const int writer_i : range) {
+      const int i = attributes_to_fill[writer_i];
+      const AttributeDomainAndType &meta_data = info.kinds[i];
+      fill_new_attribute(src_components,
+                         OffsetIndices<int>(offsets_by_domain.lookup(meta_data.domain)),
+                         info.names[i],
+                         meta_data.data_type,
+                         meta_data.domain,
+                         writers[writer_i].span);
+    }
+  });
+
+  for (bke::GSpanAttributeWriter &writer : writers) {
+    writer.finish();
   }
 }
 
@@ -7,12 +7,15 @@
 
 #include "BKE_attribute_math.hh"
 #include "BLI_array.hh"
+#include "BLI_atomic_disjoint_set.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_bounds.hh"
 #include "BLI_index_mask.hh"
 #include "BLI_kdtree.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
 #include "BLI_offset_indices.hh"
+#include "BLI_sort.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
@@ -1811,21 +1814,225 @@ static Mesh *create_merged_mesh(const Mesh &mesh,
 /** \name Merge Map Creation
  * \{ */
 
+/**
+ * Uniform grid with cells as large as the merge distance, so that all vertices within the merge
+ * distance of a position are in the 27 cells around it. Non-empty cells are stored as sorted keys
+ * instead of in a hash table, so that the grid can be built in parallel.
+ */
+class VertCellGrid {
+ private:
+  /** Number of bits used for the cell coordinate on each axis in a cell key. */
+  static constexpr int coord_bits = 21;
+  static constexpr int max_coord = (1 << coord_bits) - 1;
+
+  float3 min_;
+  float cell_size_inv_;
+  /** Sorted keys of all non-empty cells. */
+  Array<uint64_t> cell_keys_;
+  Array<int> cell_offsets_data_;
+  /** Selected vertices sorted by cell and by index within each cell. */
+  Array<int> verts_by_cell_;
+
+  int3 cell_coord(const float3 &position) const
+  {
+    return int3(math::floor((position - min_) * cell_size_inv_));
+  }
+
+  static uint64_t cell_key(const int3 &coord)
+  {
+    return (uint64_t(coord.x) << (2 * coord_bits)) | (uint64_t(coord.y) << coord_bits) |
+           uint64_t(coord.z);
+  }
+
+ public:
+  /**
+   * \return False if the grid would be too large for the cell keys, or if the positions are not
+   * finite.
+   */
+  bool build(const Span<float3> positions, const IndexMask &selection, const float cell_size)
+  {
+    const std::optional<Bounds<float3>> bounds = bounds::min_max(selection, positions);
+    if (!bounds) {
+      return false;
+    }
+    min_ = bounds->min;
+    cell_size_inv_ = 1.0f / cell_size;
+    const float3 extent = (bounds->max - bounds->min) * cell_size_inv_;
+    for (const int axis : IndexRange(3)) {
+      /* The negated comparison also handles non-finite values. */
+      if (!(extent[axis] < float(max_coord - 1))) {
+        return false;
+      }
+    }
+
+    Array<std::pair<uint64_t, int>> verts_with_key(selection.size());
+    selection.foreach_index(
+        [&](const int vert, const int pos) {
+          verts_with_key[pos] = {cell_key(this->cell_coord(positions[vert])), vert};
+        },
+        exec_mode::grain_size(4096));
+    parallel_sort(verts_with_key.begin(), verts_with_key.end());
+
+    Vector<uint64_t> cell_keys;
+    Vector<int> cell_offsets;
+    for (const int i : verts_with_key.index_range()) {
+      if (i == 0 || verts_with_key[i].first != verts_with_key[i - 1].first) {
+        cell_keys.append(verts_with_key[i].first);
+        cell_offsets.append(i);
+      }
+    }
+    cell_offsets.append(verts_with_key.size());
+    cell_keys_ = cell_keys.as_span();
+    cell_offsets_data_ = cell_offsets.as_span();
+
+    verts_by_cell_.reinitialize(verts_with_key.size());
+    threading::parallel_for(verts_with_key.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        verts_by_cell_[i] = verts_with_key[i].second;
+      }
+    });
+    return true;
+  }
+
+  Span<int> verts() const
+  {
+    return verts_by_cell_;
+  }
+
+  template<typename Fn> void foreach_vert_in_neighborhood(const float3 &position, Fn &&fn) const
+  {
+    const OffsetIndices<int> cells(cell_offsets_data_);
+    const int3 center = this->cell_coord(position);
+    for (int z = center.z - 1; z <= center.z + 1; z++) {
+      for (int y = center.y - 1; y <= center.y + 1; y++) {
+        for (int x = center.x - 1; x <= center.x + 1; x++) {
+          if (std::min({x, y, z}) < 0 || std::max({x, y, z}) > max_coord) {
+            continue;
+          }
+          const uint64_t key = cell_key({x, y, z});
+          const uint64_t *cell = std::lower_bound(cell_keys_.begin(), cell_keys_.end(), key);
+          if (cell == cell_keys_.end() || *cell != key) {
+            continue;
+          }
+          for (const int vert : verts_by_cell_.as_span().slice(cells[cell - cell_keys_.begin()])) {
+            fn(vert);
+          }
+        }
+      }
+    }
+  }
+};
+
+/**
+ * Same as #kdtree_3d_calc_duplicates_fast with index order, but multi-threaded. The vertices are
+ * first split into clusters of vertices that are transitively within the merge distance of each
+ * other. Since the merge targets within a cluster only depend on the vertices in the cluster, the
+ * clusters can be processed in parallel while still visiting the vertices in index order.
+ */
+static int calc_duplicates_grid(const VertCellGrid &grid,
+                                const Span<float3> positions,
+                                const float merge_distance,
+                                MutableSpan<int> vert_dest_map)
+{
+  const float merge_distance_sq = merge_distance * merge_distance;
+  const Span<int> verts = grid.verts();
+
+  AtomicDisjointSet clusters(positions.size());
+  Array<bool> has_neighbor(positions.size(), false);
+  threading::parallel_for(verts.index_range(), 1024, [&](const IndexRange range) {
+    for (const int vert : verts.slice(range)) {
+      grid.foreach_vert_in_neighborhood(positions[vert], [&](const int other) {
+        if (other == vert) {
+          return;
+        }
+        if (math::distance_squared(positions[vert], positions[other]) <= merge_distance_sq) {
+          has_neighbor[vert] = true;
+          if (other > vert) {
+            clusters.join(vert, other);
+          }
+        }
+      });
+    }
+  });
+
+  IndexMaskMemory memory;
+  const IndexMask verts_to_check = IndexMask::from_bools(has_neighbor, memory);
+  if (verts_to_check.is_empty()) {
+    return 0;
+  }
+  Array<std::pair<int, int>> verts_by_cluster(verts_to_check.size());
+  verts_to_check.foreach_index(
+      [&](const int vert, const int pos) {
+        verts_by_cluster[pos] = {clusters.find_root(vert), vert};
+      },
+      exec_mode::grain_size(4096));
+  parallel_sort(verts_by_cluster.begin(), verts_by_cluster.end());
+  Vector<int> cluster_offsets;
+  for (const int i : verts_by_cluster.index_range()) {
+    if (i == 0 || verts_by_cluster[i].first != verts_by_cluster[i - 1].first) {
+      cluster_offsets.append(i);
+    }
+  }
+  cluster_offsets.append(verts_by_cluster.size());
+  const OffsetIndices<int> cluster_ranges(cluster_offsets);
+
+  std::atomic<int> duplicates_num = 0;
+  threading::parallel_for(cluster_ranges.index_range(), 64, [&](const IndexRange range) {
+    int local_duplicates_num = 0;
+    for (const int cluster : range) {
+      for (const int i : cluster_ranges[cluster]) {
+        const int vert = verts_by_cluster[i].second;
+        if (!ELEM(vert_dest_map[vert], OUT_OF_CONTEXT, vert)) {
+          continue;
+        }
+        bool found = false;
+        grid.foreach_vert_in_neighborhood(positions[vert], [&](const int other) {
+          if (other == vert || vert_dest_map[other] != OUT_OF_CONTEXT) {
+            return;
+          }
+          if (math::distance_squared(positions[vert], positions[other]) <= merge_distance_sq) {
+            vert_dest_map[other] = vert;
+            local_duplicates_num++;
+            found = true;
+          }
+        });
+        if (found) {
+          /* Prevent chains of doubles. */
+          vert_dest_map[vert] = vert;
+        }
+      }
+    }
+    duplicates_num += local_duplicates_num;
+  });
+  return duplicates_num;
+}
+
 std::optional<Mesh *> mesh_merge_by_distance_all(const Mesh &mesh,
                                                  const IndexMask &selection,
                                                  const float merge_distance)
 {
   Array<int> vert_dest_map(mesh.verts_num, OUT_OF_CONTEXT);
-
-  KDTree_3d *tree = kdtree_3d_new(selection.size());
-
   const Span<float3> positions = mesh.vert_positions();
-  selection.foreach_index([&](const int64_t i) { kdtree_3d_insert(tree, i, positions[i]); });
 
-  kdtree_3d_balance(tree);
-  const int vert_kill_len = kdtree_3d_calc_duplicates_fast(
-      tree, merge_distance, true, vert_dest_map.data());
-  kdtree_3d_free(tree);
+  int vert_kill_len = 0;
+  /* The KD-tree is faster to build for small meshes, the grid can be built and used in parallel.
+   * Both give the same result, except for vertices that are at exactly the merge distance. The
+   * cells are slightly larger than the merge distance to avoid missing neighbors due to floating
+   * point precision. */
+  VertCellGrid grid;
+  if (selection.size() > 10000 && merge_distance > 0.0f &&
+      grid.build(positions, selection, merge_distance * 1.001f))
+  {
+    vert_kill_len = calc_duplicates_grid(grid, positions, merge_distance, vert_dest_map);
+  }
+  else {
+    KDTree_3d *tree = kdtree_3d_new(selection.size());
+    selection.foreach_index([&](const int64_t i) { kdtree_3d_insert(tree, i, positions[i]); });
+    kdtree_3d_balance(tree);
+    vert_kill_len = kdtree_3d_calc_duplicates_fast(
+        tree, merge_distance, true, vert_dest_map.data());
+    kdtree_3d_free(tree);
+  }
 
   if (vert_kill_len == 0) {
     return std::nullopt;
@@ -146,6 +146,43 @@ static openvdb::FloatGrid::Ptr mesh_to_density_grid_impl(
   return new_grid;
 }
 
+int64_t mesh_to_volume_memory_estimate(const Span<float3> positions,
+                                       const Span<int> corner_verts,
+                                       const Span<int3> corner_tris,
+                                       const float4x4 &mesh_to_volume_space_transform,
+                                       const float voxel_size,
+                                       const float interior_band_width)
+{
+  if (!BKE_volume_voxel_size_valid(float3(voxel_size))) {
+    return 0;
+  }
+  const double area = threading::parallel_reduce(
+      corner_tris.index_range(),
+      4096,
+      0.0,
+      [&](const IndexRange range, double sum) {
+        for (const int i : range) {
+          const int3 &tri = corner_tris[i];
+          const float3 a = math::transform_point(mesh_to_volume_space_transform,
+                                                 positions[corner_verts[tri[0]]]);
+          const float3 b = math::transform_point(mesh_to_volume_space_transform,
+                                                 positions[corner_verts[tri[1]]]);
+          const float3 c = math::transform_point(mesh_to_volume_space_transform,
+                                                 positions[corner_verts[tri[2]]]);
+          sum += 0.5 * double(math::length(math::cross(b - a, c - a)));
+        }
+        return sum;
+      },
+      std::plus<>());
+
+  /* The band reaches one voxel outside of the surface, see #mesh_to_density_grid_impl. */
+  const double band_voxels = 1.0 + std::max(1.0f, interior_band_width / voxel_size);
+  const double voxels = area / (double(voxel_size) * double(voxel_size)) * band_voxels;
+  /* Leaf nodes are only partially filled by a narrow band, and also store masks. */
+  const double bytes_per_voxel = 2.0 * sizeof(float);
+  return int64_t(std::min(voxels * bytes_per_voxel, double(INT64_MAX / 2)));
+}
+
 bke::VolumeGrid<float> mesh_to_density_grid(const Span<float3> positions,
                                             const Span<int> corner_verts,
                                             const Span<int3> corner_tris,
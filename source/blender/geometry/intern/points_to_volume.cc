@@ -2,7 +2,10 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_bounds.hh"
 #include "BLI_math_base.hh"
+#include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 
 #include "BKE_volume.hh"
 #include "BKE_volume_grid.hh"
@@ -81,6 +84,42 @@ static openvdb::FloatGrid::Ptr points_to_sdf_grid_impl(const Span<float3> positi
   return new_grid;
 }
 
+int64_t points_to_volume_memory_estimate(const Span<float3> positions,
+                                         const Span<float> radii,
+                                         const float voxel_size)
+{
+  if (positions.is_empty() || !BKE_volume_voxel_size_valid(float3(voxel_size))) {
+    return 0;
+  }
+  /* The grid is rasterized in index space with a background value of one, which makes the narrow
+   * band reach one voxel to each side of the sphere surfaces. */
+  const double half_band = 1.0;
+  const double voxel_size_inv = 1.0 / double(voxel_size);
+  const double band_voxels = threading::parallel_reduce(
+      radii.index_range(),
+      4096,
+      0.0,
+      [&](const IndexRange range, double sum) {
+        for (const int i : range) {
+          const double radius = double(radii[i]) * voxel_size_inv;
+          const double outer = radius + half_band;
+          const double inner = std::max(radius - half_band, 0.0);
+          sum += 4.0 / 3.0 * M_PI * (outer * outer * outer - inner * inner * inner);
+        }
+        return sum;
+      },
+      std::plus<>());
+
+  const Bounds<float3> bounds = *bounds::min_max(positions);
+  const double max_radius = double(*std::max_element(radii.begin(), radii.end()));
+  const double3 bounds_voxels = double3(bounds.max - bounds.min) * voxel_size_inv +
+                                2.0 * (max_radius * voxel_size_inv + half_band);
+  const double voxels = std::min(band_voxels, bounds_voxels.x * bounds_voxels.y * bounds_voxels.z);
+  /* Leaf nodes are only partially filled by a narrow band, and also store masks. */
+  const double bytes_per_voxel = 2.0 * sizeof(float);
+  return int64_t(std::min(voxels * bytes_per_voxel, double(INT64_MAX / 2)));
+}
+
 bke::VolumeGrid<float> points_to_sdf_grid(const Span<float3> positions,
                                           const Span<float> radii,
                                           const float voxel_size)
@@ -414,6 +414,24 @@ static void threaded_fill(const GPointer value, GMutableSpan dst)
   });
 }
 
+/**
+ * Copy the source attribute into the destination, or fill it with the instance attribute value
+ * (or the default value) if the source geometry does not have the attribute.
+ */
+static void copy_generic_attribute_to_result(const std::optional<GVArray> &src_attribute,
+                                             const void *fallback,
+                                             GMutableSpan dst_span)
+{
+  if (src_attribute.has_value()) {
+    threaded_copy(*src_attribute, dst_span);
+  }
+  else {
+    const CPPType &cpp_type = dst_span.type();
+    threaded_fill({cpp_type, fallback == nullptr ? cpp_type.default_value() : fallback},
+                  dst_span);
+  }
+}
+
 static void copy_generic_attributes_to_result(
     const Span<std::optional<GVArray>> src_attributes,
     const AttributeFallbacksArray &attribute_fallbacks,
@@ -431,17 +449,9 @@ static void copy_generic_attributes_to_result(
           if (!writer) {
             continue;
           }
-          GMutableSpan dst_span = writer.span.slice(element_slice);
-          if (src_attributes[attribute_index].has_value()) {
-            threaded_copy(*src_attributes[attribute_index], dst_span);
-          }
-          else {
-            const CPPType &cpp_type = dst_span.type();
-            const void *fallback = attribute_fallbacks.array[attribute_index] == nullptr ?
-                                       cpp_type.default_value() :
-                                       attribute_fallbacks.array[attribute_index];
-            threaded_fill({cpp_type, fallback}, dst_span);
-          }
+          copy_generic_attribute_to_result(src_attributes[attribute_index],
+                                           attribute_fallbacks.array[attribute_index],
+                                           writer.span.slice(element_slice));
         }
       });
 }
@@ -1646,137 +1656,104 @@ static AllMeshesInfo preprocess_meshes(const bke::GeometrySet &geometry_set,
   return info;
 }
 
-static void execute_realize_mesh_task(const RealizeInstancesOptions &options,
-                                      const RealizeMeshTask &task,
-                                      const OrderedAttributes &ordered_attributes,
-                                      MutableSpan<GSpanAttributeWriter> dst_attribute_writers,
-                                      MutableSpan<float3> all_dst_positions,
-                                      MutableSpan<int2> all_dst_edges,
-                                      MutableSpan<int> all_dst_face_offsets,
-                                      MutableSpan<int> all_dst_corner_verts,
-                                      MutableSpan<int> all_dst_corner_edges,
-                                      MutableSpan<int> all_dst_vert_ids,
-                                      MutableSpan<int> all_dst_material_indices,
-                                      GSpanAttributeWriter &all_dst_custom_normals)
+static IndexRange mesh_task_domain_range(const RealizeMeshTask &task, const bke::AttrDomain domain)
 {
-  const MeshRealizeInfo &mesh_info = *task.mesh_info;
-  const Mesh &mesh = *mesh_info.mesh;
-
-  const Span<float3> src_positions = mesh_info.positions;
-  const Span<int2> src_edges = mesh_info.edges;
-  const OffsetIndices src_faces = mesh_info.faces;
-  const Span<int> src_corner_verts = mesh_info.corner_verts;
-  const Span<int> src_corner_edges = mesh_info.corner_edges;
-
-  const IndexRange dst_vert_range(task.start_indices.vert, src_positions.size());
-  const IndexRange dst_edge_range(task.start_indices.edge, src_edges.size());
-  const IndexRange dst_face_range(task.start_indices.face, src_faces.size());
-  const IndexRange dst_corner_range(task.start_indices.corner, src_corner_verts.size());
-
-  MutableSpan<float3> dst_positions = all_dst_positions.slice(dst_vert_range);
-  MutableSpan<int2> dst_edges = all_dst_edges.slice(dst_edge_range);
-  MutableSpan<int> dst_face_offsets = all_dst_face_offsets.slice(dst_face_range);
-  MutableSpan<int> dst_corner_verts = all_dst_corner_verts.slice(dst_corner_range);
-  MutableSpan<int> dst_corner_edges = all_dst_corner_edges.slice(dst_corner_range);
-
-  math::transform_points(src_positions, task.transform, dst_positions);
+  const Mesh &mesh = *task.mesh_info->mesh;
+  switch (domain) {
+    case bke::AttrDomain::Point:
+      return IndexRange(task.start_indices.vert, mesh.verts_num);
+    case bke::AttrDomain::Edge:
+      return IndexRange(task.start_indices.edge, mesh.edges_num);
+    case bke::AttrDomain::Face:
+      return IndexRange(task.start_indices.face, mesh.faces_num);
+    case bke::AttrDomain::Corner:
+      return IndexRange(task.start_indices.corner, mesh.corners_num);
+    default:
+      BLI_assert_unreachable();
+      return IndexRange();
+  }
+}
 
-  threading::parallel_for(src_edges.index_range(), 1024, [&](const IndexRange edge_range) {
-    for (const int i : edge_range) {
-      dst_edges[i] = src_edges[i] + task.start_indices.vert;
+/**
+ * Call #fn for every task in parallel. #elements_num is the total number of elements that are
+ * processed for all tasks. It's used to group many small tasks together.
+ */
+static void foreach_mesh_task_parallel(const Span<RealizeMeshTask> tasks,
+                                       const int64_t elements_num,
+                                       const FunctionRef<void(const RealizeMeshTask &task)> fn)
+{
+  const int64_t grain_size = std::max<int64_t>(
+      1, tasks.size() * 4096 / std::max<int64_t>(elements_num, 1));
+  threading::parallel_for(tasks.index_range(), grain_size, [&](const IndexRange task_range) {
+    for (const int64_t task_index : task_range) {
+      fn(tasks[task_index]);
     }
   });
-  threading::parallel_for(
-      src_corner_verts.index_range(), 1024, [&](const IndexRange corner_range) {
-        for (const int i : corner_range) {
-          dst_corner_verts[i] = src_corner_verts[i] + task.start_indices.vert;
-        }
-      });
-  threading::parallel_for(
-      src_corner_edges.index_range(), 1024, [&](const IndexRange corner_range) {
-        for (const int i : corner_range) {
-          dst_corner_edges[i] = src_corner_edges[i] + task.start_indices.edge;
-        }
-      });
-  threading::parallel_for(src_faces.index_range(), 1024, [&](const IndexRange face_range) {
-    for (const int i : face_range) {
-      dst_face_offsets[i] = src_faces[i].start() + task.start_indices.corner;
+}
+
+template<typename T>
+static void copy_indices_with_offset(const Span<T> src, const int offset, MutableSpan<T> dst)
+{
+  threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      dst[i] = src[i] + offset;
     }
   });
-  if (!all_dst_material_indices.is_empty()) {
-    const Span<int> material_index_map = mesh_info.material_index_map;
-    MutableSpan<int> dst_material_indices = all_dst_material_indices.slice(dst_face_range);
-    if (mesh.totcol == 0) {
-      /* The material index map contains the index of the null material in the result. */
-      dst_material_indices.fill(material_index_map.first());
+}
+
+static void realize_mesh_task_material_indices(const RealizeMeshTask &task,
+                                               MutableSpan<int> all_dst_material_indices)
+{
+  const MeshRealizeInfo &mesh_info = *task.mesh_info;
+  const Mesh &mesh = *mesh_info.mesh;
+  const Span<int> material_index_map = mesh_info.material_index_map;
+  MutableSpan<int> dst_material_indices = all_dst_material_indices.slice(
+      task.start_indices.face, mesh.faces_num);
+  if (mesh.totcol == 0) {
+    /* The material index map contains the index of the null material in the result. */
+    dst_material_indices.fill(material_index_map.first());
+  }
+  else {
+    if (mesh_info.material_indices.is_single()) {
+      const int src_index = mesh_info.material_indices.get_internal_single();
+      const bool valid = IndexRange(mesh.totcol).contains(src_index);
+      dst_material_indices.fill(valid ? material_index_map[src_index] : 0);
     }
     else {
-      if (mesh_info.material_indices.is_single()) {
-        const int src_index = mesh_info.material_indices.get_internal_single();
-        const bool valid = IndexRange(mesh.totcol).contains(src_index);
-        dst_material_indices.fill(valid ? material_index_map[src_index] : 0);
-      }
-      else {
-        VArraySpan<int> indices_span(mesh_info.material_indices);
-        threading::parallel_for(src_faces.index_range(), 1024, [&](const IndexRange face_range) {
-          for (const int i : face_range) {
-            const int src_index = indices_span[i];
-            const bool valid = IndexRange(mesh.totcol).contains(src_index);
-            dst_material_indices[i] = valid ? material_index_map[src_index] : 0;
-          }
-        });
-      }
+      VArraySpan<int> indices_span(mesh_info.material_indices);
+      threading::parallel_for(
+          indices_span.index_range(), 1024, [&](const IndexRange face_range) {
+            for (const int i : face_range) {
+              const int src_index = indices_span[i];
+              const bool valid = IndexRange(mesh.totcol).contains(src_index);
+              dst_material_indices[i] = valid ? material_index_map[src_index] : 0;
+            }
+          });
     }
   }
+}
 
-  if (!all_dst_vert_ids.is_empty()) {
-    create_result_ids(options,
-                      mesh_info.stored_vert_ids,
-                      task.id,
-                      all_dst_vert_ids.slice(task.start_indices.vert, mesh.verts_num));
-  }
-
-  const auto domain_to_range = [&](const bke::AttrDomain domain) {
-    switch (domain) {
-      case bke::AttrDomain::Point:
-        return dst_vert_range;
-      case bke::AttrDomain::Edge:
-        return dst_edge_range;
-      case bke::AttrDomain::Face:
-        return dst_face_range;
-      case bke::AttrDomain::Corner:
-        return dst_corner_range;
-      default:
-        BLI_assert_unreachable();
-        return IndexRange();
-    }
-  };
-
-  if (all_dst_custom_normals) {
-    if (all_dst_custom_normals.span.type().is<short2>()) {
-      if (mesh_info.custom_normal.is_empty()) {
-        all_dst_custom_normals.span.typed<short2>().slice(dst_corner_range).fill(short2(0));
-      }
-      else {
-        all_dst_custom_normals.span.typed<short2>()
-            .slice(dst_corner_range)
-            .copy_from(mesh_info.custom_normal.typed<short2>());
-      }
+static void realize_mesh_task_custom_normals(const RealizeMeshTask &task,
+                                             GSpanAttributeWriter &all_dst_custom_normals)
+{
+  const MeshRealizeInfo &mesh_info = *task.mesh_info;
+  const IndexRange dst_range = mesh_task_domain_range(task, all_dst_custom_normals.domain);
+  if (all_dst_custom_normals.span.type().is<short2>()) {
+    if (mesh_info.custom_normal.is_empty()) {
+      all_dst_custom_normals.span.typed<short2>().slice(dst_range).fill(short2(0));
     }
     else {
-      const IndexRange dst_range = domain_to_range(all_dst_custom_normals.domain);
-      math::transform_normals(mesh_info.custom_normal.typed<float3>(),
-                              float3x3(task.transform),
-                              all_dst_custom_normals.span.typed<float3>().slice(dst_range));
+      all_dst_custom_normals.span.typed<short2>().slice(dst_range).copy_from(
+          mesh_info.custom_normal.typed<short2>());
     }
   }
-
-  copy_generic_attributes_to_result(mesh_info.attributes,
-                                    task.attribute_fallbacks,
-                                    ordered_attributes,
-                                    domain_to_range,
-                                    dst_attribute_writers);
+  else {
+    math::transform_normals(mesh_info.custom_normal.typed<float3>(),
+                            float3x3(task.transform),
+                            all_dst_custom_normals.span.typed<float3>().slice(dst_range));
+  }
 }
+
 static void copy_vertex_group_name(ListBaseT<bDeformGroup> *dst_deform_group,
                                    const OrderedAttributes &ordered_attributes,
                                    const bDeformGroup &src_deform_group)
@@ -1931,24 +1908,73 @@ static void execute_realize_mesh_tasks(const RealizeInstancesOptions &options,
         dst_attributes.lookup_or_add_for_write_only_span(name, domain, data_type));
   }
 
-  /* Actually execute all tasks. */
-  threading::parallel_for(tasks.index_range(), 100, [&](const IndexRange task_range) {
-    for (const int task_index : task_range) {
-      const RealizeMeshTask &task = tasks[task_index];
-      execute_realize_mesh_task(options,
-                                task,
-                                ordered_attributes,
-                                dst_attribute_writers,
-                                dst_positions,
-                                dst_edges,
-                                dst_face_offsets,
-                                dst_corner_verts,
-                                dst_corner_edges,
-                                vert_ids.span,
-                                material_indices.span,
-                                custom_normals);
-    }
+  /* Actually execute all tasks. The output arrays are filled one after another instead of
+   * filling all arrays for one task at a time. When there are many small instances, this is much
+   * more cache friendly, because the output is written sequentially and the data of the instanced
+   * meshes stays in the cache. */
+  foreach_mesh_task_parallel(tasks, verts_num, [&](const RealizeMeshTask &task) {
+    const Span<float3> src_positions = task.mesh_info->positions;
+    math::transform_points(src_positions,
+                           task.transform,
+                           dst_positions.slice(task.start_indices.vert, src_positions.size()));
   });
+  foreach_mesh_task_parallel(tasks, edges_num, [&](const RealizeMeshTask &task) {
+    const Span<int2> src_edges = task.mesh_info->edges;
+    copy_indices_with_offset(src_edges,
+                             task.start_indices.vert,
+                             dst_edges.slice(task.start_indices.edge, src_edges.size()));
+  });
+  foreach_mesh_task_parallel(tasks, faces_num, [&](const RealizeMeshTask &task) {
+    const Span<int> src_face_starts = task.mesh_info->faces.data().drop_back(1);
+    copy_indices_with_offset(
+        src_face_starts,
+        task.start_indices.corner,
+        dst_face_offsets.slice(task.start_indices.face, src_face_starts.size()));
+  });
+  foreach_mesh_task_parallel(tasks, corners_num, [&](const RealizeMeshTask &task) {
+    const Span<int> src_corner_verts = task.mesh_info->corner_verts;
+    copy_indices_with_offset(
+        src_corner_verts,
+        task.start_indices.vert,
+        dst_corner_verts.slice(task.start_indices.corner, src_corner_verts.size()));
+  });
+  foreach_mesh_task_parallel(tasks, corners_num, [&](const RealizeMeshTask &task) {
+    const Span<int> src_corner_edges = task.mesh_info->corner_edges;
+    copy_indices_with_offset(
+        src_corner_edges,
+        task.start_indices.edge,
+        dst_corner_edges.slice(task.start_indices.corner, src_corner_edges.size()));
+  });
+  if (!material_indices.span.is_empty()) {
+    foreach_mesh_task_parallel(tasks, faces_num, [&](const RealizeMeshTask &task) {
+      realize_mesh_task_material_indices(task, material_indices.span);
+    });
+  }
+  if (!vert_ids.span.is_empty()) {
+    foreach_mesh_task_parallel(tasks, verts_num, [&](const RealizeMeshTask &task) {
+      const IndexRange dst_range = mesh_task_domain_range(task, bke::AttrDomain::Point);
+      create_result_ids(
+          options, task.mesh_info->stored_vert_ids, task.id, vert_ids.span.slice(dst_range));
+    });
+  }
+  if (custom_normals) {
+    foreach_mesh_task_parallel(
+        tasks, custom_normals.span.size(), [&](const RealizeMeshTask &task) {
+          realize_mesh_task_custom_normals(task, custom_normals);
+        });
+  }
+  for (const int attribute_index : ordered_attributes.index_range()) {
+    GSpanAttributeWriter &writer = dst_attribute_writers[attribute_index];
+    if (!writer) {
+      continue;
+    }
+    foreach_mesh_task_parallel(tasks, writer.span.size(), [&](const RealizeMeshTask &task) {
+      copy_generic_attribute_to_result(
+          task.mesh_info->attributes[attribute_index],
+          task.attribute_fallbacks.array[attribute_index],
+          writer.span.slice(mesh_task_domain_range(task, writer.domain)));
+    });
+  }
 
   /* Tag modified attributes. */
   for (GSpanAttributeWriter &dst_attribute : dst_attribute_writers) {
@@ -0,0 +1,90 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BLI_kdtree.hh"
+#include "BLI_rand.hh"
+
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_mesh.hh"
+
+#include "DNA_mesh_types.h"
+
+#include "GEO_mesh_merge_by_distance.hh"
+
+#include "CLG_log.h"
+
+#include "testing/testing.h"
+
+namespace blender::geometry::tests {
+
+class MeshMergeByDistanceTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    CLG_init();
+    BKE_idtype_init();
+  }
+
+  static void TearDownTestSuite()
+  {
+    CLG_exit();
+  }
+};
+
+/** Create loose vertices in clusters of varying size and density. */
+static Mesh *create_clustered_points(const int clusters_num, const int points_per_cluster)
+{
+  Mesh *mesh = BKE_mesh_new_nomain(clusters_num * points_per_cluster, 0, 0, 0);
+  MutableSpan<float3> positions = mesh->vert_positions_for_write();
+  RandomNumberGenerator rng(42);
+  for (const int cluster : IndexRange(clusters_num)) {
+    const float3 center = rng.get_unit_float3() * 10.0f;
+    const float radius = rng.get_float() * 0.05f;
+    for (const int i : IndexRange(points_per_cluster)) {
+      positions[cluster * points_per_cluster + i] = center + rng.get_unit_float3() * radius;
+    }
+  }
+  return mesh;
+}
+
+static int count_duplicates_with_kdtree(const Span<float3> positions, const float merge_distance)
+{
+  Array<int> duplicates(positions.size(), -1);
+  KDTree_3d *tree = kdtree_3d_new(positions.size());
+  for (const int i : positions.index_range()) {
+    kdtree_3d_insert(tree, i, positions[i]);
+  }
+  kdtree_3d_balance(tree);
+  const int duplicates_num = kdtree_3d_calc_duplicates_fast(
+      tree, merge_distance, true, duplicates.data());
+  kdtree_3d_free(tree);
+  return duplicates_num;
+}
+
+TEST_F(MeshMergeByDistanceTest, LargeMeshMatchesKDTree)
+{
+  const float merge_distance = 0.01f;
+  Mesh *mesh = create_clustered_points(4000, 5);
+  const int expected_verts_num = mesh->verts_num -
+                                 count_duplicates_with_kdtree(mesh->vert_positions(),
+                                                              merge_distance);
+
+  const IndexMask selection(mesh->verts_num);
+  const std::optional<Mesh *> result_a = mesh_merge_by_distance_all(
+      *mesh, selection, merge_distance);
+  const std::optional<Mesh *> result_b = mesh_merge_by_distance_all(
+      *mesh, selection, merge_distance);
+  ASSERT_TRUE(result_a.has_value());
+  ASSERT_TRUE(result_b.has_value());
+  EXPECT_EQ((*result_a)->verts_num, expected_verts_num);
+  /* The result must not depend on the multi-threaded scheduling. */
+  EXPECT_EQ_SPAN<float3>((*result_a)->vert_positions(), (*result_b)->vert_positions());
+
+  BKE_id_free(nullptr, *result_a);
+  BKE_id_free(nullptr, *result_b);
+  BKE_id_free(nullptr, mesh);
+}
+
+}  // namespace blender::geometry::tests
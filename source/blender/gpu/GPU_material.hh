@@ -169,6 +169,12 @@ GPUMaterialStatus GPU_material_status(GPUMaterial *mat);
  */
 eGPUMaterialOptimizationStatus GPU_material_optimization_status(GPUMaterial *mat);
 
+/**
+ * Change the priority of the deferred compilation of the material, e.g. to compile the materials
+ * that are visible in the viewport before the others.
+ */
+void GPU_material_compilation_priority_set(GPUMaterial *mat, CompilationPriority priority);
+
 uint64_t GPU_material_compilation_timestamp(GPUMaterial *mat);
 
 gpu::UniformBuf *GPU_material_uniform_buffer_get(GPUMaterial *material);
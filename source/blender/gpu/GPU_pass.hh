@@ -36,7 +36,13 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
 
 GPUPassStatus GPU_pass_status(GPUPass *pass);
 bool GPU_pass_should_optimize(GPUPass *pass);
+/**
+ * Whether the pass is used by more than one material, meaning a structurally identical node tree
+ * was already compiled.
+ */
+bool GPU_pass_is_shared(GPUPass *pass);
 void GPU_pass_ensure_its_ready(GPUPass *pass);
+void GPU_pass_compilation_priority_set(GPUPass *pass, CompilationPriority priority);
 gpu::Shader *GPU_pass_shader_get(GPUPass *pass);
 void GPU_pass_acquire(GPUPass *pass);
 void GPU_pass_release(GPUPass *pass);
@@ -108,6 +108,13 @@ bool GPU_shader_async_compilation_is_ready(AsyncCompilationHandle handle);
  * WARNING: The handle will be invalidated by this call, you can't request the same shader twice.
  */
 gpu::Shader *GPU_shader_async_compilation_finalize(AsyncCompilationHandle &handle);
+/**
+ * Change the priority of a compilation that has not started yet, so shaders that are needed
+ * sooner can be moved ahead of the rest of the queue.
+ * Compilations that are already running or finished are not affected.
+ */
+void GPU_shader_async_compilation_priority_set(AsyncCompilationHandle handle,
+                                               CompilationPriority priority);
 /**
  * Cancel the compilation of the shader.
  * WARNING: The handle will be invalidated by this call.
@@ -1217,6 +1217,11 @@ const char *GPU_texture_format_name(gpu::TextureFormat format);
  */
 unsigned int GPU_texture_memory_usage_get();
 
+/**
+ * Returns the estimated memory usage of \a texture in bytes, including its mip-maps.
+ */
+size_t GPU_texture_memory_size_get(const gpu::Texture *texture);
+
 /**
  * Update sampler states depending on user settings.
  */
@@ -196,8 +196,11 @@ GPUMaterialFromNodeTreeResult GPU_material_from_nodetree(
   }
 
   /* Determine whether we should generate an optimized variant of the graph.
-   * Heuristic is based on complexity of default material pass and shader node graph. */
-  if (GPU_pass_should_optimize(mat->pass)) {
+   * Heuristic is based on complexity of default material pass and shader node graph.
+   * Optimized variants bake the uniform values into the shader and can't be shared, so skip them
+   * when the default pass is already shared with other materials using an identical node tree,
+   * to avoid compiling one variant per material. */
+  if (GPU_pass_should_optimize(mat->pass) && !GPU_pass_is_shared(mat->pass)) {
     mat->optimized_pass = GPU_generate_pass(
         mat, &mat->graph, mat->name.c_str(), engine, true, callback, thunk, true);
   }
@@ -243,7 +246,7 @@ GPUMaterial *GPU_material_from_callbacks(eGPUMaterialEngine engine,
 
   /* Determine whether we should generate an optimized variant of the graph.
    * Heuristic is based on complexity of default material pass and shader node graph. */
-  if (GPU_pass_should_optimize(material->pass)) {
+  if (GPU_pass_should_optimize(material->pass) && !GPU_pass_is_shared(material->pass)) {
     material->optimized_pass = GPU_generate_pass(material,
                                                  &material->graph,
                                                  __func__,
@@ -327,9 +330,14 @@ GPUMaterialStatus GPU_material_status(GPUMaterial *mat)
   }
 }
 
+void GPU_material_compilation_priority_set(GPUMaterial *mat, CompilationPriority priority)
+{
+  GPU_pass_compilation_priority_set(mat->pass, priority);
+}
+
 eGPUMaterialOptimizationStatus GPU_material_optimization_status(GPUMaterial *mat)
 {
-  if (!GPU_pass_should_optimize(mat->pass)) {
+  if (mat->optimized_pass == nullptr) {
     return GPU_MAT_OPTIMIZATION_SKIP;
   }
 
@@ -54,8 +54,12 @@ struct GPUPass {
   bool should_optimize = false;
   bool is_optimization_pass = false;
 
+  CompilationPriority priority = CompilationPriority::Medium;
+
   /* Number of seconds after creation required before compiling an optimization pass. */
   static constexpr float optimization_delay = 10.0f;
+  /* Number of seconds with 0 users required before cancelling a pending compilation. */
+  static constexpr float orphan_compilation_delay = 1.0f;
 
   GPUPass(GPUCodegenCreateInfo *info,
           bool deferred_compilation,
@@ -64,7 +68,8 @@ struct GPUPass {
       : create_info(info),
         creation_timestamp(BLI_time_now_seconds()),
         should_optimize(should_optimize),
-        is_optimization_pass(is_optimization_pass)
+        is_optimization_pass(is_optimization_pass),
+        priority(is_optimization_pass ? CompilationPriority::Low : CompilationPriority::Medium)
   {
     BLI_assert(!is_optimization_pass || !should_optimize);
     if (is_optimization_pass && deferred_compilation) {
@@ -97,7 +102,18 @@ struct GPUPass {
 
   CompilationPriority compilation_priority()
   {
-    return is_optimization_pass ? CompilationPriority::Low : CompilationPriority::Medium;
+    return priority;
+  }
+
+  void compilation_priority_set(CompilationPriority new_priority)
+  {
+    if (priority == new_priority) {
+      return;
+    }
+    priority = new_priority;
+    if (compilation_handle) {
+      GPU_shader_async_compilation_priority_set(compilation_handle, priority);
+    }
   }
 
   void finalize_compilation()
@@ -152,8 +168,12 @@ struct GPUPass {
   bool should_gc(int gc_collect_rate, double timestamp)
   {
     BLI_assert(gc_timestamp != 0.0f);
-    return !compilation_handle && status != GPU_PASS_FAILED &&
-           (timestamp - gc_timestamp) >= gc_collect_rate;
+    if (compilation_handle) {
+      /* Nothing uses the pass anymore (e.g. the node tree was edited again before the compilation
+       * finished), so the compilation can be cancelled instead of occupying the compiler. */
+      return (timestamp - gc_timestamp) >= orphan_compilation_delay;
+    }
+    return status != GPU_PASS_FAILED && (timestamp - gc_timestamp) >= gc_collect_rate;
   }
 };
 
@@ -171,6 +191,11 @@ bool GPU_pass_should_optimize(GPUPass *pass)
   return (GPU_backend_get_type() == GPU_BACKEND_METAL) && pass->should_optimize;
 }
 
+bool GPU_pass_is_shared(GPUPass *pass)
+{
+  return pass->refcount > 1;
+}
+
 gpu::Shader *GPU_pass_shader_get(GPUPass *pass)
 {
   return pass->shader;
@@ -305,6 +330,12 @@ void GPU_pass_ensure_its_ready(GPUPass *pass)
   }
 }
 
+void GPU_pass_compilation_priority_set(GPUPass *pass, CompilationPriority priority)
+{
+  std::lock_guard lock(g_cache->get_mutex());
+  pass->compilation_priority_set(priority);
+}
+
 void GPU_pass_cache_init()
 {
   g_cache = MEM_new<GPUPassCache>(__func__);
@@ -326,6 +326,12 @@ gpu::Shader *GPU_shader_async_compilation_finalize(AsyncCompilationHandle &handl
   return reinterpret_cast<gpu::Shader *>(result);
 }
 
+void GPU_shader_async_compilation_priority_set(AsyncCompilationHandle handle,
+                                               CompilationPriority priority)
+{
+  GPUBackend::get()->get_compiler()->async_compilation_priority_set(handle, priority);
+}
+
 void GPU_shader_async_compilation_cancel(AsyncCompilationHandle &handle)
 {
   GPUBackend::get()->get_compiler()->asyc_compilation_cancel(handle);
@@ -1067,6 +1073,31 @@ void ShaderCompiler::asyc_compilation_cancel(AsyncCompilationHandle &handle)
   compilation_finished_notification_.notify_all();
 }
 
+void ShaderCompiler::requeue_work_impl(AsyncCompilation &compilation,
+                                       CompilationPriority priority)
+{
+  /* The mutex should be locked before calling this function. */
+  BLI_assert(!mutex_.try_lock());
+
+  if (compilation_worker_ == nullptr || compilation.is_ready) {
+    return;
+  }
+  /* Only work that is still waiting in the queue can be moved, it's a no-op if a worker thread
+   * already picked it up. */
+  if (compilation_worker_->cancel_work(compilation.work->id)) {
+    compilation.work->id = compilation_worker_->push_work(compilation.work.get(),
+                                                          to_work_priority(priority));
+  }
+}
+
+void ShaderCompiler::async_compilation_priority_set(AsyncCompilationHandle handle,
+                                                    CompilationPriority priority)
+{
+  std::lock_guard lock(mutex_);
+
+  requeue_work_impl(*async_compilations_.lookup(handle), priority);
+}
+
 bool ShaderCompiler::async_compilation_is_ready(AsyncCompilationHandle handle)
 {
   std::lock_guard lock(mutex_);
@@ -1077,7 +1108,9 @@ bool ShaderCompiler::async_compilation_is_ready(AsyncCompilationHandle handle)
 Shader *ShaderCompiler::async_compilation_finalize(AsyncCompilationHandle &handle)
 {
   std::unique_lock lock(mutex_);
-  /* TODO: Move to be first on the queue. */
+  /* The caller is going to wait for this compilation, so don't let it wait behind the rest of the
+   * queue. */
+  requeue_work_impl(*async_compilations_.lookup(handle), CompilationPriority::High);
   compilation_finished_notification_.wait(
       lock, [&]() { return async_compilations_.lookup(handle)->is_ready == true; });
 
@@ -203,6 +203,7 @@ class ShaderCompiler {
   AsyncCompilationHandle next_handle_ = 1;
 
   bool is_compiling_impl();
+  void requeue_work_impl(AsyncCompilation &compilation, CompilationPriority priority);
 
   bool is_paused_ = false;
   std::condition_variable pause_finished_notification_;
@@ -229,6 +230,8 @@ class ShaderCompiler {
   AsyncCompilationHandle async_compilation(const shader::ShaderCreateInfo *info,
                                            CompilationPriority priority);
   void asyc_compilation_cancel(AsyncCompilationHandle &handle);
+  void async_compilation_priority_set(AsyncCompilationHandle handle,
+                                      CompilationPriority priority);
   bool async_compilation_is_ready(AsyncCompilationHandle handle);
   Shader *async_compilation_finalize(AsyncCompilationHandle &handle);
 
@@ -245,6 +245,26 @@ uint GPU_texture_memory_usage_get()
   return 0;
 }
 
+size_t GPU_texture_memory_size_get(const gpu::Texture *texture)
+{
+  const size_t width = max_ii(texture->width_get(), 1);
+  const size_t height = max_ii(texture->height_get(), 1);
+  const size_t depth = max_ii(texture->depth_get(), 1);
+  const TextureFormat format = texture->format_get();
+  size_t size;
+  if (texture->format_flag_get() & GPU_FORMAT_COMPRESSED) {
+    size = divide_ceil_ul(width, 4) * divide_ceil_ul(height, 4) * depth * to_block_size(format);
+  }
+  else {
+    size = width * height * depth * to_bytesize(format);
+  }
+  /* A complete mip-map chain adds about a third of the size of the first level. */
+  if (texture->mip_count() > 1) {
+    size += size / 3;
+  }
+  return size;
+}
+
 /* ------ Creation ------ */
 
 static inline gpu::Texture *gpu_texture_create(const char *name,
@@ -56,10 +56,14 @@ Texture *TexturePoolImpl::acquire_texture(int2 extent,
   if (match_index != -1) {
     TextureHandle handle = {pool_[match_index].texture};
     acquired_.add(handle);
+    pool_memory_size_ -= GPU_texture_memory_size_get(handle.texture);
     pool_.remove_and_reorder(match_index);
     return handle.texture;
   }
 
+  /* Make room for the new texture when many unused textures are kept alive. */
+  free_least_recently_used(max_unused_memory_size_);
+
   /* Generate debug label name, if one isn't passed in `name`. TexturePoolImpl ignores the
    *name argument, as returned textures do not shadow/view/abstract the underlying texture. */
   std::string name_str;
@@ -80,6 +84,7 @@ void TexturePoolImpl::release_texture(Texture *tex)
                  "Unacquired texture passed to TexturePool::release_texture()");
   acquired_.remove({tex});
   pool_.append({tex});
+  pool_memory_size_ += GPU_texture_memory_size_get(tex);
 }
 
 void TexturePoolImpl::offset_users_count(Texture *tex, int offset)
@@ -106,12 +111,34 @@ void TexturePoolImpl::reset(bool force_free)
   for (int i = pool_.size() - 1; i >= 0; i--) {
     TextureHandle &tex = pool_[i];
     if (tex.unused_cycles_count >= max_unused_cycles_ || force_free) {
-      GPU_texture_free(tex.texture);
-      pool_.remove_and_reorder(i);
+      free_pool_texture(i);
     }
     else {
       tex.unused_cycles_count++;
     }
   }
+
+  free_least_recently_used(max_unused_memory_size_);
+}
+
+void TexturePoolImpl::free_pool_texture(int64_t index)
+{
+  Texture *tex = pool_[index].texture;
+  pool_memory_size_ -= GPU_texture_memory_size_get(tex);
+  GPU_texture_free(tex);
+  pool_.remove_and_reorder(index);
+}
+
+void TexturePoolImpl::free_least_recently_used(size_t max_memory_size)
+{
+  while (pool_memory_size_ > max_memory_size && !pool_.is_empty()) {
+    int64_t oldest_index = 0;
+    for (const int64_t i : pool_.index_range()) {
+      if (pool_[i].unused_cycles_count > pool_[oldest_index].unused_cycles_count) {
+        oldest_index = i;
+      }
+    }
+    free_pool_texture(oldest_index);
+  }
 }
 }  // namespace blender::gpu
@@ -20,6 +20,10 @@ class TexturePoolImpl : public TexturePool {
   /* Defer deallocation enough cycles to avoid interleaved calls to different viewport render
    * functions (selection / display) causing constant allocation / deallocation (See #113024). */
   static constexpr int max_unused_cycles_ = 8;
+  /* Memory that unused textures can occupy before the least recently used ones are freed, even
+   * if they did not reach `max_unused_cycles_` yet. Avoids peaks when multiple viewports and the
+   * compositor use textures of different sizes. */
+  static constexpr size_t max_unused_memory_size_ = size_t(512) * 1024 * 1024;
 
   /* Internal packet for texture, which supports set insertion. */
   struct TextureHandle {
@@ -45,6 +49,13 @@ class TexturePoolImpl : public TexturePool {
   Vector<TextureHandle> pool_;
   /* Set of textures currently in use. */
   Set<TextureHandle> acquired_;
+  /* Estimated memory used by the textures in `pool_`. */
+  size_t pool_memory_size_ = 0;
+
+  /** Free the texture at the given index of `pool_`. */
+  void free_pool_texture(int64_t index);
+  /** Free the least recently used textures of the pool until it fits inside the given size. */
+  void free_least_recently_used(size_t max_memory_size);
 
  public:
   ~TexturePoolImpl();
@@ -17,6 +17,7 @@
 #  include "GHOST_ISystem.hh"
 #  include "GPU_context.hh"
 #  include "GPU_init_exit.hh"
+#  include "GPU_platform.hh"
 #  include "gpu_capabilities_private.hh"
 #  include <iostream>
 #  include <string>
@@ -140,7 +141,14 @@ std::string GL_shader_cache_dir_get()
   static char tmp_dir_buffer[1024];
   BKE_appdir_folder_caches(tmp_dir_buffer, sizeof(tmp_dir_buffer));
 
-  std::string cache_dir = std::string(tmp_dir_buffer) + "gl-shader-cache" + SEP_STR;
+  /* Program binaries are only valid for the driver that created them. Loading a binary from a
+   * different driver can fail or even crash, so keep a separate directory per driver. */
+  const std::string driver_id = std::string(GPU_platform_vendor()) + GPU_platform_renderer() +
+                                GPU_platform_version();
+  const std::string driver_hash = std::to_string(DefaultHash<std::string>{}(driver_id));
+
+  std::string cache_dir = std::string(tmp_dir_buffer) + "gl-shader-cache" + SEP_STR +
+                          driver_hash + SEP_STR;
   BLI_dir_create_recursive(cache_dir.c_str());
 
   return cache_dir;
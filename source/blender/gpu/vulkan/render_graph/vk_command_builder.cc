@@ -11,6 +11,7 @@
 #include "vk_render_graph.hh"
 #include "vk_to_string.hh"
 
+#include <algorithm>
 #include <sstream>
 
 namespace blender::gpu::render_graph {
@@ -238,18 +239,18 @@ void VKCommandBuilder::groups_build_commands(VKRenderGraph &render_graph,
     Span<NodeHandle> group_node_handles = node_handles.slice(group_nodes);
 
     /* Record group pre barriers. */
+    BLI_assert_msg(!rendering_active,
+                   "Pre group barriers must be executed outside a rendering scope.");
+#if 0
     for (BarrierIndex barrier_index : group_pre_barriers_[group_index]) {
-      BLI_assert_msg(!rendering_active,
-                     "Pre group barriers must be executed outside a rendering scope.");
       Barrier &barrier = barrier_list_[barrier_index];
-#if 0
       std::cout << __func__ << ": node_group=" << group_index
                 << ", node_group_range=" << group_node_handles.first() << "-"
                 << group_node_handles.last() << ", pre_barrier=(" << to_string_barrier(barrier)
                 << ")\n";
-#endif
-      send_pipeline_barriers(command_buffer, barrier, false);
     }
+#endif
+    send_pipeline_barriers(command_buffer, group_pre_barriers_[group_index]);
 
     /* Record group node commands. */
     for (NodeHandle node_handle : group_node_handles) {
@@ -309,18 +310,18 @@ void VKCommandBuilder::groups_build_commands(VKRenderGraph &render_graph,
     }
 
     /* Record group post barriers. */
+    BLI_assert_msg(!rendering_active,
+                   "Post group barriers must be executed outside a rendering scope.");
+#if 0
     for (BarrierIndex barrier_index : group_post_barriers_[group_index]) {
-      BLI_assert_msg(!rendering_active,
-                     "Post group barriers must be executed outside a rendering scope.");
       Barrier &barrier = barrier_list_[barrier_index];
-#if 0
       std::cout << __func__ << ": node_group=" << group_index
                 << ", node_group_range=" << group_node_handles.first() << "-"
                 << group_node_handles.last() << ", post_barrier=(" << to_string_barrier(barrier)
                 << ")\n";
-#endif
-      send_pipeline_barriers(command_buffer, barrier, false);
     }
+#endif
+    send_pipeline_barriers(command_buffer, group_post_barriers_[group_index]);
   }
 
   finish_debug_groups(command_buffer, debug_groups);
@@ -465,6 +466,10 @@ void VKCommandBuilder::send_pipeline_barriers(VKCommandBufferInterface &command_
   Span<VkImageMemoryBarrier> image_barriers = vk_image_memory_barriers_.as_span().slice(
       barrier.image_memory_barriers);
 
+  statistics.pipeline_barriers += 1;
+  statistics.buffer_memory_barriers += buffer_barriers.size();
+  statistics.image_memory_barriers += image_barriers.size();
+
   command_buffer.pipeline_barrier(src_stage_mask,
                                   dst_stage_mask,
                                   VK_DEPENDENCY_BY_REGION_BIT,
@@ -476,6 +481,86 @@ void VKCommandBuilder::send_pipeline_barriers(VKCommandBufferInterface &command_
                                   image_barriers.data());
 }
 
+void VKCommandBuilder::send_pipeline_barriers(VKCommandBufferInterface &command_buffer,
+                                              Barriers barriers)
+{
+  Vector<BarrierIndex, 8> merge_barriers;
+  for (const BarrierIndex barrier_index : barriers) {
+    const Barrier &barrier = barrier_list_[barrier_index];
+    /* Barriers of the same resource can contain layout transitions that need to be performed in
+     * order, these cannot be part of the same `vkCmdPipelineBarrier`. */
+    const bool share_resources = std::any_of(
+        merge_barriers.begin(), merge_barriers.end(), [&](const BarrierIndex merge_index) {
+          return barriers_share_resources(barrier_list_[merge_index], barrier);
+        });
+    if (share_resources) {
+      send_merged_pipeline_barriers(command_buffer, merge_barriers);
+      merge_barriers.clear();
+    }
+    merge_barriers.append(barrier_index);
+  }
+  send_merged_pipeline_barriers(command_buffer, merge_barriers);
+}
+
+void VKCommandBuilder::send_merged_pipeline_barriers(VKCommandBufferInterface &command_buffer,
+                                                     Span<BarrierIndex> barrier_indices)
+{
+  if (barrier_indices.is_empty()) {
+    return;
+  }
+  if (barrier_indices.size() == 1) {
+    send_pipeline_barriers(command_buffer, barrier_list_[barrier_indices.first()], false);
+    return;
+  }
+
+  /* Copy the memory barriers to the end of the lists so they can be referenced by a single
+   * barrier. Copies are made before appending as appending can reallocate the lists. */
+  Barrier merged_barrier = {};
+  const int64_t buffer_barriers_start = vk_buffer_memory_barriers_.size();
+  const int64_t image_barriers_start = vk_image_memory_barriers_.size();
+  for (const BarrierIndex barrier_index : barrier_indices) {
+    const Barrier &barrier = barrier_list_[barrier_index];
+    merged_barrier.src_stage_mask |= barrier.src_stage_mask;
+    merged_barrier.dst_stage_mask |= barrier.dst_stage_mask;
+    for (const int64_t index : barrier.buffer_memory_barriers) {
+      const VkBufferMemoryBarrier vk_buffer_memory_barrier = vk_buffer_memory_barriers_[index];
+      vk_buffer_memory_barriers_.append(vk_buffer_memory_barrier);
+    }
+    for (const int64_t index : barrier.image_memory_barriers) {
+      const VkImageMemoryBarrier vk_image_memory_barrier = vk_image_memory_barriers_[index];
+      vk_image_memory_barriers_.append(vk_image_memory_barrier);
+    }
+  }
+  merged_barrier.buffer_memory_barriers = IndexRange::from_begin_end(
+      buffer_barriers_start, vk_buffer_memory_barriers_.size());
+  merged_barrier.image_memory_barriers = IndexRange::from_begin_end(
+      image_barriers_start, vk_image_memory_barriers_.size());
+
+  statistics.merged_pipeline_barriers += barrier_indices.size() - 1;
+  send_pipeline_barriers(command_buffer, merged_barrier, false);
+}
+
+bool VKCommandBuilder::barriers_share_resources(const Barrier &barrier_a,
+                                                const Barrier &barrier_b) const
+{
+  for (const int64_t index_a : barrier_a.buffer_memory_barriers) {
+    for (const int64_t index_b : barrier_b.buffer_memory_barriers) {
+      if (vk_buffer_memory_barriers_[index_a].buffer == vk_buffer_memory_barriers_[index_b].buffer)
+      {
+        return true;
+      }
+    }
+  }
+  for (const int64_t index_a : barrier_a.image_memory_barriers) {
+    for (const int64_t index_b : barrier_b.image_memory_barriers) {
+      if (vk_image_memory_barriers_[index_a].image == vk_image_memory_barriers_[index_b].image) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void VKCommandBuilder::add_buffer_barriers(VKRenderGraph &render_graph,
                                            NodeHandle node_handle,
                                            VkPipelineStageFlags node_stages,
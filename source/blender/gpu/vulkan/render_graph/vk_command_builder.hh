@@ -188,6 +188,18 @@ class VKCommandBuilder {
   Vector<Barrier> barrier_list_;
 
  public:
+  /** Counters of the recorded commands, used for debugging and profiling. */
+  struct Statistics {
+    /** Number of recorded `vkCmdPipelineBarrier` calls. */
+    int64_t pipeline_barriers = 0;
+    /** Number of barriers that were merged into the `vkCmdPipelineBarrier` of another barrier. */
+    int64_t merged_pipeline_barriers = 0;
+    int64_t buffer_memory_barriers = 0;
+    int64_t image_memory_barriers = 0;
+  };
+  /** Statistics accumulated by `record_commands`. Can be reset by the caller. */
+  Statistics statistics;
+
   /**
    * Build execution groups and barriers.
    * This method should be performed when the resources are locked.
@@ -247,6 +259,14 @@ class VKCommandBuilder {
   void send_pipeline_barriers(VKCommandBufferInterface &command_buffer,
                               const Barrier &barrier,
                               bool within_rendering);
+  /**
+   * Record the given group barriers. Barriers are merged into a single `vkCmdPipelineBarrier`
+   * when they don't touch the same resources, as there are no commands recorded in between.
+   */
+  void send_pipeline_barriers(VKCommandBufferInterface &command_buffer, Barriers barriers);
+  void send_merged_pipeline_barriers(VKCommandBufferInterface &command_buffer,
+                                     Span<BarrierIndex> barrier_indices);
+  bool barriers_share_resources(const Barrier &barrier_a, const Barrier &barrier_b) const;
 
   void add_buffer_barriers(VKRenderGraph &render_graph,
                            NodeHandle node_handle,
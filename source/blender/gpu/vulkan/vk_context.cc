@@ -47,6 +47,7 @@ VKContext::~VKContext()
     surface_texture_ = nullptr;
   }
   free_resources();
+  staging_memory_.free();
   delete imm;
   imm = nullptr;
   VKDevice &device = VKBackend::get().device;
@@ -49,6 +49,7 @@ class VKContext : public Context, NonCopyable {
   GHOST_IContext *ghost_context_;
 
   Vector<std::unique_ptr<VKStreamingBuffer>> streaming_buffers_;
+  VKStagingMemory staging_memory_;
 
   /* Reusable data. Stored inside context to limit reallocations. */
   render_graph::VKResourceAccessInfo access_info_ = {};
@@ -164,6 +165,11 @@ class VKContext : public Context, NonCopyable {
   std::unique_ptr<VKStreamingBuffer> &get_or_create_streaming_buffer(
       VKBuffer &buffer, VkDeviceSize min_offset_alignment);
 
+  VKStagingMemory &staging_memory_get()
+  {
+    return staging_memory_;
+  }
+
  private:
   void swap_buffer_draw_handler(const GHOST_VulkanSwapChainData &data, bool wait_for_submission);
   void swap_buffer_acquired_handler();
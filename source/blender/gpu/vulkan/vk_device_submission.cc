@@ -160,6 +160,7 @@ void VKDevice::submission_runner(TaskPool *__restrict pool, void *task_data)
   std::optional<render_graph::VKCommandBufferWrapper> command_buffer;
   uint64_t previous_gc_timeline = 0;
   uint64_t num_nodes = 0;
+  std::chrono::steady_clock::duration record_duration = {};
 
   CLOG_TRACE(&LOG, "Submission runner initialized");
   while (!BLI_task_pool_current_canceled(pool)) {
@@ -204,6 +205,7 @@ void VKDevice::submission_runner(TaskPool *__restrict pool, void *task_data)
     BLI_assert(vk_command_buffer != VK_NULL_HANDLE);
 
     render_graph::VKRenderGraph &render_graph = *submit_task->render_graph;
+    const std::chrono::steady_clock::time_point record_start = std::chrono::steady_clock::now();
     Span<render_graph::NodeHandle> node_handles = scheduler.select_nodes(render_graph);
     {
       std::scoped_lock lock_resources(device->resources.mutex);
@@ -211,6 +213,7 @@ void VKDevice::submission_runner(TaskPool *__restrict pool, void *task_data)
     }
     command_builder.record_commands(render_graph, *command_buffer, node_handles);
     num_nodes += node_handles.size();
+    record_duration += std::chrono::steady_clock::now() - record_start;
 
     if (submit_task->submit_to_device) {
       /* Finalize current command buffer. */
@@ -245,8 +248,18 @@ void VKDevice::submission_runner(TaskPool *__restrict pool, void *task_data)
                                      signal_semaphore_len,
                                      signal_semaphores};
 
-      CLOG_TRACE(&LOG, "Submitting %u render graph nodes to device.", uint32_t(num_nodes));
+      CLOG_TRACE(&LOG,
+                 "Submitting %u render graph nodes to device (recorded in %.3f ms, %u pipeline "
+                 "barriers, %u merged barriers, %u buffer and %u image memory barriers).",
+                 uint32_t(num_nodes),
+                 std::chrono::duration<double, std::milli>(record_duration).count(),
+                 uint32_t(command_builder.statistics.pipeline_barriers),
+                 uint32_t(command_builder.statistics.merged_pipeline_barriers),
+                 uint32_t(command_builder.statistics.buffer_memory_barriers),
+                 uint32_t(command_builder.statistics.image_memory_barriers));
       num_nodes = 0;
+      record_duration = {};
+      command_builder.statistics = {};
 
       {
         std::scoped_lock lock_queue(*device->queue_mutex_);
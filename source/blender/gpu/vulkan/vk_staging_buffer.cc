@@ -66,4 +66,43 @@ void VKStagingBuffer::free()
   host_buffer_.free();
 }
 
+std::optional<VKStagingMemory::Region> VKStagingMemory::allocate(VkDeviceSize size,
+                                                                 VkDeviceSize alignment)
+{
+  if (size > block_size_) {
+    return std::nullopt;
+  }
+
+  VkDeviceSize offset = ceil_to_multiple_ul(offset_, alignment);
+  if (!block_ || offset + size > block_size_) {
+    /* The previous block is discarded and kept alive until the device has finished using it. */
+    block_ = std::make_unique<VKBuffer>();
+    if (!block_->create(block_size_,
+                        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                        VMA_ALLOCATION_CREATE_MAPPED_BIT |
+                            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
+                        0.4f))
+    {
+      block_.reset();
+      return std::nullopt;
+    }
+    debug::object_label(block_->vk_handle(), "StagingMemory");
+    offset = 0;
+  }
+  offset_ = offset + size;
+
+  Region region;
+  region.vk_buffer = block_->vk_handle();
+  region.offset = offset;
+  region.mapped_memory = static_cast<uint8_t *>(block_->mapped_memory_get()) + offset;
+  return region;
+}
+
+void VKStagingMemory::free()
+{
+  block_.reset();
+  offset_ = 0;
+}
+
 }  // namespace blender::gpu
@@ -84,4 +84,42 @@ class VKStagingBuffer {
     return region_size_;
   }
 };
+
+/**
+ * Host visible memory that is sub-allocated for uploading data to the device.
+ *
+ * Uploading many resources (e.g. image textures when loading a scene) would otherwise create and
+ * destroy a buffer for each upload. Staging memory is allocated in blocks and each upload uses
+ * the next free region of the active block. Full blocks are discarded, and are destroyed when
+ * the device has finished the transfers.
+ */
+class VKStagingMemory {
+ public:
+  struct Region {
+    VkBuffer vk_buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    void *mapped_memory = nullptr;
+  };
+
+ private:
+  /** Size of a single block. Larger uploads are not sub-allocated. */
+  static constexpr VkDeviceSize block_size_ = 16 * 1024 * 1024;
+
+  std::unique_ptr<VKBuffer> block_;
+  /** Offset of the first free byte in `block_`. */
+  VkDeviceSize offset_ = 0;
+
+ public:
+  /**
+   * Allocate a region of `size` bytes with an offset that is a multiple of `alignment`.
+   *
+   * Returns `std::nullopt` when the region doesn't fit inside a single block or when allocating
+   * a new block failed. In that case a dedicated staging buffer should be used.
+   */
+  std::optional<Region> allocate(VkDeviceSize size, VkDeviceSize alignment);
+
+  /** Discard the active block. */
+  void free();
+};
+
 }  // namespace blender::gpu
@@ -481,14 +481,30 @@ void VKTexture::update_sub(int mip,
 
   VKBuffer staging_buffer;
   VkBuffer vk_buffer = VK_NULL_HANDLE;
+  VkDeviceSize vk_buffer_offset = 0;
   if (data) {
-    staging_buffer.create(device_memory_size,
-                          VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                          VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
-                          VMA_ALLOCATION_CREATE_MAPPED_BIT |
-                              VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
-                          0.4f);
-    vk_buffer = staging_buffer.vk_handle();
+    /* Buffer offsets of buffer to image copies must be a multiple of the texel block size and of
+     * 4 for depth stencil formats. */
+    const VkDeviceSize alignment = 4 * (is_compressed ? to_block_size(device_format_) :
+                                                        to_bytesize(device_format_));
+    void *mapped_memory = nullptr;
+    if (std::optional<VKStagingMemory::Region> region =
+            context.staging_memory_get().allocate(device_memory_size, alignment))
+    {
+      vk_buffer = region->vk_buffer;
+      vk_buffer_offset = region->offset;
+      mapped_memory = region->mapped_memory;
+    }
+    else {
+      staging_buffer.create(device_memory_size,
+                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                            VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                            VMA_ALLOCATION_CREATE_MAPPED_BIT |
+                                VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
+                            0.4f);
+      vk_buffer = staging_buffer.vk_handle();
+      mapped_memory = staging_buffer.mapped_memory_get();
+    }
     /* Rows are sequentially stored, when unpack row length is 0, or equal to the extent width. In
      * other cases we unpack the rows to reduce the size of the staging buffer and data transfer.
      */
@@ -496,7 +512,7 @@ void VKTexture::update_sub(int mip,
       /* Data has already been converted, only need to copy.
        * NOTE: Don't use multi-threaded copy as staging buffer is optimized for sequential access.
        */
-      memcpy(staging_buffer.mapped_memory_get(), data, device_memory_size);
+      memcpy(mapped_memory, data, device_memory_size);
     }
     else {
       BLI_assert_msg(!is_compressed,
@@ -505,7 +521,7 @@ void VKTexture::update_sub(int mip,
                      "3D texture data with unpack_row_length != 0 is not supported.");
       size_t dst_row_stride = extent.x * to_bytesize(device_format_);
       size_t src_row_stride = unpack_row_length * to_bytesize(format_, format);
-      uint8_t *dst_ptr = static_cast<uint8_t *>(staging_buffer.mapped_memory_get());
+      uint8_t *dst_ptr = static_cast<uint8_t *>(mapped_memory);
       const uint8_t *src_ptr = static_cast<const uint8_t *>(data);
       for (int y = 0; y < extent.y; y++) {
         convert_host_to_device(dst_ptr, src_ptr, extent.x, format, format_, device_format_);
@@ -523,6 +539,7 @@ void VKTexture::update_sub(int mip,
   render_graph::VKCopyBufferToImageNode::Data &node_data = copy_buffer_to_image.node_data;
   node_data.src_buffer = vk_buffer;
   node_data.dst_image = vk_image_handle();
+  node_data.region.bufferOffset = vk_buffer_offset;
   node_data.region.imageExtent.width = extent.x;
   node_data.region.imageExtent.height = extent.y;
   node_data.region.imageExtent.depth = extent.z;
@@ -40,6 +40,16 @@ void IMB_moviecache_set_priority_callback(MovieCache *cache,
                                           MovieCacheGetPriorityDataFP getprioritydatafp,
                                           MovieCacheGetItemPriorityFP getitempriorityfp,
                                           MovieCachePriorityDeleterFP prioritydeleterfp);
+/**
+ * Set how expensive it is to re-create items of this cache, relative to reading a frame from disk
+ * which is the default of 1. Items with a lower cost are freed first when the cache is full.
+ */
+void IMB_moviecache_set_cost(MovieCache *cache, float cost);
+
+/**
+ * Memory used by all movie caches together, in bytes.
+ */
+size_t IMB_moviecache_get_memory_in_use();
 
 void IMB_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf);
 bool IMB_moviecache_put_if_possible(MovieCache *cache, void *userkey, ImBuf *ibuf);
@@ -310,6 +310,9 @@ void *imb_alloc_pixels(
     return nullptr;
   }
 
+  static const int memory_category = MEM_memory_category_register("Image");
+  const MEM_MemoryCategoryScope memory_category_scope(memory_category);
+
   size_t size = size_t(x) * size_t(y) * size_t(channels) * typesize;
   return initialize_pixels ? MEM_new_zeroed(size, alloc_name) :
                              MEM_new_uninitialized(size, alloc_name);
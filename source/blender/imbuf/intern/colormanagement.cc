@@ -31,6 +31,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_color.hh"
 #include "BLI_colorspace.hh"
 #include "BLI_fileops.hh"
@@ -310,6 +311,8 @@ static MovieCache *colormanage_moviecache_ensure(ImBuf *ibuf)
                                        sizeof(ColormanageCacheKey),
                                        colormanage_hashhash,
                                        colormanage_hashcmp);
+    /* Display buffers are re-created from image buffers which are already in memory. */
+    IMB_moviecache_set_cost(moviecache, 0.5f);
 
     ibuf->colormanage_cache->moviecache = moviecache;
   }
@@ -4392,13 +4395,17 @@ void IMB_colormanagement_processor_apply_byte(
    * but for now it's not so important.
    */
   BLI_assert(channels == 4);
-  float pixel[4];
+  /* Convert a row at a time, so that the OCIO processor can be applied on a packed image instead
+   * of going through the per-pixel API. */
+  Array<float4> row(width);
   for (int y = 0; y < height; y++) {
+    uchar *row_buffer = buffer + size_t(channels) * size_t(y) * width;
     for (int x = 0; x < width; x++) {
-      size_t offset = channels * (size_t(y) * width + x);
-      rgba_uchar_to_float(pixel, buffer + offset);
-      IMB_colormanagement_processor_apply_v4(cm_processor, pixel);
-      rgba_float_to_uchar(buffer + offset, pixel);
+      rgba_uchar_to_float(row[x], row_buffer + channels * x);
+    }
+    IMB_colormanagement_processor_apply(cm_processor, &row[0].x, width, 1, channels, false);
+    for (int x = 0; x < width; x++) {
+      rgba_float_to_uchar(row_buffer + channels * x, row[x]);
     }
   }
 }
@@ -15,6 +15,7 @@
 #include "MEM_CacheLimiterC-Api.h"
 #include "MEM_guardedalloc.h"
 
+#include "BLI_assert.h"
 #include "BLI_ghash.h"
 #include "BLI_mempool.h"
 #include "BLI_string.h"
@@ -65,7 +66,9 @@ struct MovieCache {
   void *last_userkey;
 
   int totseg, *points, proxy, render_flags; /* for visual statistics optimization */
-  int pad;
+
+  /* Estimate of how expensive it is to re-create an item, relative to a frame read from disk. */
+  float cost;
 };
 
 struct MovieCacheKey {
@@ -209,6 +212,19 @@ static size_t get_item_size(void *p)
   return size;
 }
 
+/**
+ * Priorities are zero for the most important item and negative for the others, scale them by the
+ * cost so that items which are cheap to re-create are destroyed before expensive ones which are
+ * equally far away from the current frame.
+ */
+static int moviecache_priority_apply_cost(const MovieCache *cache, const int priority)
+{
+  if (cache->cost == 1.0f) {
+    return priority;
+  }
+  return int(float(priority) / cache->cost);
+}
+
 static int get_item_priority(void *item_v, int default_priority)
 {
   MovieCacheItem *item = static_cast<MovieCacheItem *>(item_v);
@@ -222,10 +238,11 @@ static int get_item_priority(void *item_v, int default_priority)
           item,
           default_priority);
 
-    return default_priority;
+    return moviecache_priority_apply_cost(cache, default_priority);
   }
 
-  priority = cache->getitempriorityfp(cache->last_userkey, item->priority_data);
+  priority = moviecache_priority_apply_cost(
+      cache, cache->getitempriorityfp(cache->last_userkey, item->priority_data));
 
   PRINT("%s: cache '%s' item %p priority %d\n", __func__, cache->name, item, priority);
 
@@ -288,6 +305,7 @@ MovieCache *IMB_moviecache_create(const char *name,
   cache->hashfp = hashfp;
   cache->cmpfp = cmpfp;
   cache->proxy = -1;
+  cache->cost = 1.0f;
 
   return cache;
 }
@@ -309,6 +327,21 @@ void IMB_moviecache_set_priority_callback(MovieCache *cache,
   cache->prioritydeleterfp = prioritydeleterfp;
 }
 
+void IMB_moviecache_set_cost(MovieCache *cache, const float cost)
+{
+  BLI_assert(cost > 0.0f);
+  cache->cost = cost;
+}
+
+size_t IMB_moviecache_get_memory_in_use()
+{
+  std::lock_guard lock(limitor_lock);
+  if (!limitor) {
+    return 0;
+  }
+  return MEM_CacheLimiter_get_memory_in_use(limitor);
+}
+
 static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, bool need_lock)
 {
   MovieCacheKey *key;
@@ -17,6 +17,7 @@
 #include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <set>
 #include <string>
 
@@ -1197,12 +1198,10 @@ void IMB_exr_write_channels(ExrHandle *handle)
     return;
   }
 
-  const size_t num_pixels = size_t(handle->width) * handle->height;
   const size_t num_parts = (handle->mpofile) ? handle->mpofile->parts() : 1;
 
   for (size_t part_num = 0; part_num < num_parts; part_num++) {
     const std::string &part_id = (handle->mpofile) ? handle->mpofile->header(part_num).name() : "";
-    /* We allocate temporary storage for half pixels for all the channels at once. */
     int num_half_channels = 0;
     for (const ExrChannel &echan : handle->channels) {
       if (echan.part_name == part_id && echan.use_half_float) {
@@ -1210,52 +1209,67 @@ void IMB_exr_write_channels(ExrHandle *handle)
       }
     }
 
-    Vector<half> rect_half;
-    half *current_rect_half = nullptr;
-    if (num_half_channels > 0) {
-      rect_half.resize(size_t(num_half_channels) * num_pixels);
-      current_rect_half = rect_half.data();
-    }
+    /* Half float channels are converted and written in chunks of scan-lines, so that the
+     * temporary storage doesn't have to hold all channels of the whole image at once. */
+    const int chunk_height = (num_half_channels > 0) ? std::min(handle->height, 512) :
+                                                        handle->height;
+    Vector<half> rect_half(size_t(num_half_channels) * handle->width * chunk_height);
 
     FrameBuffer frameBuffer;
 
     for (const ExrChannel &echan : handle->channels) {
       /* Writing starts from last scan-line, stride negative. */
-      if (echan.part_name != part_id) {
+      if (echan.part_name != part_id || echan.use_half_float) {
         continue;
       }
-
-      if (echan.use_half_float) {
-        const float *rect = echan.rect;
-        half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan.xstride], handle->half_max_val);
-        }
-        half *rect_to_write = current_rect_half + (handle->height - 1L) * handle->width;
-        frameBuffer.insert(
-            echan.name,
-            Slice(Imf::HALF, (char *)rect_to_write, sizeof(half), -handle->width * sizeof(half)));
-        current_rect_half += num_pixels;
-      }
-      else {
-        float *rect = echan.rect + echan.xstride * (handle->height - 1L) * handle->width;
-        frameBuffer.insert(echan.name,
-                           Slice(Imf::FLOAT,
-                                 (char *)rect,
-                                 echan.xstride * sizeof(float),
-                                 -echan.ystride * sizeof(float)));
-      }
+      float *rect = echan.rect + echan.xstride * (handle->height - 1L) * handle->width;
+      frameBuffer.insert(echan.name,
+                         Slice(Imf::FLOAT,
+                               (char *)rect,
+                               echan.xstride * sizeof(float),
+                               -echan.ystride * sizeof(float)));
     }
 
     try {
+      std::optional<OutputPart> part;
       if (handle->mpofile) {
-        OutputPart part(*handle->mpofile, part_num);
-        part.setFrameBuffer(frameBuffer);
-        part.writePixels(handle->height);
+        part.emplace(*handle->mpofile, part_num);
       }
-      else {
-        handle->ofile->setFrameBuffer(frameBuffer);
-        handle->ofile->writePixels(handle->height);
+
+      for (int y_start = 0; y_start < handle->height; y_start += chunk_height) {
+        const int chunk_lines = std::min(chunk_height, handle->height - y_start);
+        half *current_rect_half = rect_half.data();
+
+        for (const ExrChannel &echan : handle->channels) {
+          if (echan.part_name != part_id || !echan.use_half_float) {
+            continue;
+          }
+          /* File scan-lines are stored top to bottom, the buffers bottom to top. */
+          for (int y = y_start; y < y_start + chunk_lines; y++) {
+            const float *rect = echan.rect + size_t(handle->height - 1 - y) * handle->width *
+                                                 echan.xstride;
+            half *cur = current_rect_half + size_t(y - y_start) * handle->width;
+            for (int x = 0; x < handle->width; x++) {
+              cur[x] = float_to_half_safe(rect[x * echan.xstride], handle->half_max_val);
+            }
+          }
+          /* Offset the pointer so that it addresses the scan-lines of the current chunk. */
+          char *rect_to_write = (char *)current_rect_half -
+                                ptrdiff_t(y_start) * handle->width * sizeof(half);
+          frameBuffer.insert(
+              echan.name,
+              Slice(Imf::HALF, rect_to_write, sizeof(half), handle->width * sizeof(half)));
+          current_rect_half += size_t(handle->width) * chunk_height;
+        }
+
+        if (part) {
+          part->setFrameBuffer(frameBuffer);
+          part->writePixels(chunk_lines);
+        }
+        else {
+          handle->ofile->setFrameBuffer(frameBuffer);
+          handle->ofile->writePixels(chunk_lines);
+        }
       }
     }
     catch (const std::exception &exc) {
@@ -1287,6 +1301,16 @@ void IMB_exr_read_channels(ExrHandle *handle)
              "internal_name");
 
   for (int i = 0; i < numparts; i++) {
+    /* Skip parts that none of the requested channels are in, there is no need to decompress their
+     * pixels. For multi-part files with many passes only some of them are usually needed. */
+    const bool part_is_used = std::any_of(
+        handle->channels.begin(), handle->channels.end(), [&](const ExrChannel &echan) {
+          return echan.part_number == i && echan.rect != nullptr;
+        });
+    if (!part_is_used) {
+      continue;
+    }
+
     /* Read part header. */
     InputPart in(*handle->ifile, i);
     Header header = in.header();
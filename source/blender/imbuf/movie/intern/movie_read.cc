@@ -22,6 +22,7 @@
 #include "BLI_utildefines.h"
 
 #include "DNA_scene_types.h"
+#include "DNA_userdef_types.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -44,7 +45,9 @@
 extern "C" {
 #  include <libavcodec/avcodec.h>
 #  include <libavformat/avformat.h>
+#  include <libavutil/hwcontext.h>
 #  include <libavutil/imgutils.h>
+#  include <libavutil/pixdesc.h>
 #  include <libavutil/rational.h>
 #  include <libswscale/swscale.h>
 
@@ -373,6 +376,94 @@ static AVFormatContext *init_format_context_vpx_workarounds(const char *filepath
   return format_ctx;
 }
 
+static SwsContext *ffmpeg_rgb_convert_context_get(MovieReader *anim, const int src_format)
+{
+  anim->img_convert_src_format = src_format;
+
+  /* Use full_chroma_int + accurate_rnd YUV->RGB conversion flags. Otherwise
+   * the conversion is not fully accurate and introduces some banding and color
+   * shifts, particularly in dark regions. See issue #111703 or upstream
+   * ffmpeg ticket https://trac.ffmpeg.org/ticket/1582 */
+  return ffmpeg_sws_get_context(anim->x,
+                                anim->y,
+                                src_format,
+                                anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG,
+                                anim->pCodecCtx->colorspace,
+                                anim->x,
+                                anim->y,
+                                anim->pFrameRGB->format,
+                                false,
+                                -1,
+                                SWS_POINT | SWS_FULL_CHR_H_INT | SWS_ACCURATE_RND);
+}
+
+static AVPixelFormat ffmpeg_hw_get_format(AVCodecContext *pCodecCtx,
+                                          const AVPixelFormat *pix_fmts)
+{
+  const MovieReader *anim = static_cast<const MovieReader *>(pCodecCtx->opaque);
+  for (const AVPixelFormat *pix_fmt = pix_fmts; *pix_fmt != AV_PIX_FMT_NONE; pix_fmt++) {
+    if (*pix_fmt == anim->hw_pix_fmt) {
+      return *pix_fmt;
+    }
+  }
+
+  /* The hardware decoder can't handle this stream (e.g. unsupported profile or bit depth), fall
+   * back to the first software format. */
+  for (const AVPixelFormat *pix_fmt = pix_fmts; *pix_fmt != AV_PIX_FMT_NONE; pix_fmt++) {
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(*pix_fmt);
+    if (!(desc->flags & AV_PIX_FMT_FLAG_HWACCEL)) {
+      CLOG_INFO(&LOG, "Hardware decoding not supported, using software decoding for \"%s\"",
+                anim->filepath);
+      return *pix_fmt;
+    }
+  }
+  return AV_PIX_FMT_NONE;
+}
+
+/**
+ * Set up hardware accelerated decoding through the first hardware device type that the codec
+ * supports and that is available on this system. The decoder falls back to software decoding
+ * when no device can be created, or when the stream turns out to be unsupported.
+ */
+static void ffmpeg_hw_decoding_init(MovieReader *anim,
+                                    AVCodecContext *pCodecCtx,
+                                    const AVCodec *pCodec)
+{
+  if ((U.sequencer_editor_flag & USER_SEQ_ED_HARDWARE_DECODING) == 0) {
+    return;
+  }
+  /* De-interlacing works on frames in the codec pixel format, which the frames transferred from
+   * the device don't necessarily have. */
+  if (anim->ib_flags & IB_animdeinterlace) {
+    return;
+  }
+
+  for (int i = 0;; i++) {
+    const AVCodecHWConfig *config = avcodec_get_hw_config(pCodec, i);
+    if (config == nullptr) {
+      break;
+    }
+    if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0) {
+      continue;
+    }
+    if (av_hwdevice_ctx_create(&anim->hw_device_ctx, config->device_type, nullptr, nullptr, 0) <
+        0)
+    {
+      continue;
+    }
+
+    anim->hw_pix_fmt = config->pix_fmt;
+    pCodecCtx->hw_device_ctx = av_buffer_ref(anim->hw_device_ctx);
+    pCodecCtx->opaque = anim;
+    pCodecCtx->get_format = ffmpeg_hw_get_format;
+    CLOG_INFO(&LOG,
+              "Using %s hardware decoding for \"%s\"",
+              av_hwdevice_get_type_name(config->device_type),
+              anim->filepath);
+    return;
+  }
+}
+
 static int startffmpeg(MovieReader *anim)
 {
   if (anim == nullptr) {
@@ -407,6 +498,8 @@ static int startffmpeg(MovieReader *anim)
     pCodecCtx->thread_type = FF_THREAD_SLICE;
   }
 
+  ffmpeg_hw_decoding_init(anim, pCodecCtx, pCodec);
+
   if (avcodec_open2(pCodecCtx, pCodec, nullptr) < 0) {
     avformat_close_input(&pFormatCtx);
     return -1;
@@ -509,22 +602,7 @@ static int startffmpeg(MovieReader *anim)
         1);
   }
 
-  /* Use full_chroma_int + accurate_rnd YUV->RGB conversion flags. Otherwise
-   * the conversion is not fully accurate and introduces some banding and color
-   * shifts, particularly in dark regions. See issue #111703 or upstream
-   * ffmpeg ticket https://trac.ffmpeg.org/ticket/1582 */
-  anim->img_convert_ctx = ffmpeg_sws_get_context(anim->x,
-                                                 anim->y,
-                                                 anim->pCodecCtx->pix_fmt,
-                                                 anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG,
-                                                 anim->pCodecCtx->colorspace,
-                                                 anim->x,
-                                                 anim->y,
-                                                 anim->pFrameRGB->format,
-                                                 false,
-                                                 -1,
-                                                 SWS_POINT | SWS_FULL_CHR_H_INT |
-                                                     SWS_ACCURATE_RND);
+  anim->img_convert_ctx = ffmpeg_rgb_convert_context_get(anim, anim->pCodecCtx->pix_fmt);
 
   if (!anim->img_convert_ctx) {
     CLOG_ERROR(&LOG,
@@ -872,6 +950,41 @@ static void ffmpeg_decode_store_frame_pts(MovieReader *anim)
          int64_t(anim->cur_pts));
 }
 
+/**
+ * Receive the next decoded frame into `anim->pFrame`. Frames decoded on a hardware device are
+ * transferred to system memory, where the rest of the pipeline expects them.
+ */
+static bool ffmpeg_receive_frame(MovieReader *anim)
+{
+  if (avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) != 0) {
+    return false;
+  }
+  if (anim->hw_device_ctx == nullptr || anim->pFrame->format != anim->hw_pix_fmt) {
+    return true;
+  }
+
+  AVFrame *sw_frame = av_frame_alloc();
+  if (av_hwframe_transfer_data(sw_frame, anim->pFrame, 0) < 0 ||
+      av_frame_copy_props(sw_frame, anim->pFrame) < 0)
+  {
+    CLOG_ERROR(&LOG, "Failed to transfer hardware decoded frame (%s)", anim->filepath);
+    av_frame_free(&sw_frame);
+    av_frame_unref(anim->pFrame);
+    return false;
+  }
+  av_frame_unref(anim->pFrame);
+  av_frame_move_ref(anim->pFrame, sw_frame);
+  av_frame_free(&sw_frame);
+
+  /* The device typically outputs a different pixel format (like NV12 or P010) than software
+   * decoding, so the conversion to RGB has to match. */
+  if (anim->pFrame->format != anim->img_convert_src_format) {
+    ffmpeg_sws_release_context(anim->img_convert_ctx);
+    anim->img_convert_ctx = ffmpeg_rgb_convert_context_get(anim, anim->pFrame->format);
+  }
+  return anim->img_convert_ctx != nullptr;
+}
+
 static int ffmpeg_read_video_frame(MovieReader *anim, AVPacket *packet)
 {
   int ret = 0;
@@ -893,7 +1006,7 @@ static int ffmpeg_decode_video_frame(MovieReader *anim)
 
   /* Sometimes, decoder returns more than one frame per sent packet. Check if frames are available.
    * This frames must be read, otherwise decoding will fail. See #91405. */
-  anim->pFrame_complete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+  anim->pFrame_complete = ffmpeg_receive_frame(anim);
   if (anim->pFrame_complete) {
     av_log(anim->pFormatCtx, AV_LOG_DEBUG, "  DECODE FROM CODEC BUFFER\n");
     ffmpeg_decode_store_frame_pts(anim);
@@ -920,7 +1033,7 @@ static int ffmpeg_decode_video_frame(MovieReader *anim)
            (anim->cur_packet->flags & AV_PKT_FLAG_KEY) ? " KEY" : "");
 
     avcodec_send_packet(anim->pCodecCtx, anim->cur_packet);
-    anim->pFrame_complete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+    anim->pFrame_complete = ffmpeg_receive_frame(anim);
 
     if (anim->pFrame_complete) {
       ffmpeg_decode_store_frame_pts(anim);
@@ -933,7 +1046,7 @@ static int ffmpeg_decode_video_frame(MovieReader *anim)
   if (rval == AVERROR_EOF) {
     /* Flush any remaining frames out of the decoder. */
     avcodec_send_packet(anim->pCodecCtx, nullptr);
-    anim->pFrame_complete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+    anim->pFrame_complete = ffmpeg_receive_frame(anim);
 
     if (anim->pFrame_complete) {
       ffmpeg_decode_store_frame_pts(anim);
@@ -1364,6 +1477,8 @@ static void free_anim_ffmpeg(MovieReader *anim)
     av_frame_free(&anim->pFrameDeinterlaced);
     ffmpeg_sws_release_context(anim->img_convert_ctx);
   }
+  /* Also freed here when opening the codec failed after the device was created. */
+  av_buffer_unref(&anim->hw_device_ctx);
   anim->duration_in_frames = 0;
 }
 
@@ -18,11 +18,13 @@ struct AVCodecContext;
 struct AVCodec;
 struct AVFrame;
 struct AVPacket;
+struct AVBufferRef;
 struct SwsContext;
 
 #ifdef WITH_FFMPEG
 
 extern "C" {
+#  include <libavutil/pixfmt.h>
 #  include <libavutil/rational.h>
 }
 
@@ -60,8 +62,15 @@ struct MovieReader {
   AVFrame *pFrameRGB = nullptr;
   AVFrame *pFrameDeinterlaced = nullptr;
   SwsContext *img_convert_ctx = nullptr;
+  /** Pixel format that #img_convert_ctx converts from. */
+  int img_convert_src_format = -1;
   int videoStream = 0;
 
+  /** Device used for hardware accelerated decoding, null for software decoding. */
+  AVBufferRef *hw_device_ctx = nullptr;
+  /** Pixel format of frames decoded on #hw_device_ctx. */
+  AVPixelFormat hw_pix_fmt = AV_PIX_FMT_NONE;
+
   AVFrame *pFrame = nullptr;
   bool pFrame_complete = false;
   AVFrame *pFrame_backup = nullptr;
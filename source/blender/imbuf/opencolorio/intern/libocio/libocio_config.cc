@@ -436,6 +436,7 @@ void LibOCIOConfig::set_scene_linear_role(StringRefNull name)
   for (LibOCIODisplay &display : displays_) {
     display.clear_caches();
   }
+  processor_cache_.clear();
   gpu_shader_binder_.clear_caches();
 }
 
@@ -545,23 +546,29 @@ const Look *LibOCIOConfig::get_look_by_index(const int index) const
 std::shared_ptr<const CPUProcessor> LibOCIOConfig::get_display_cpu_processor(
     const DisplayParameters &display_parameters) const
 {
-  OCIO_NAMESPACE::ConstProcessorRcPtr processor = create_ocio_display_processor(
-      *this, display_parameters);
-  if (!processor) {
-    return nullptr;
-  }
-  return std::make_shared<LibOCIOCPUProcessor>(processor->getDefaultCPUProcessor());
+  return processor_cache_.get_display(
+      display_parameters, [&]() -> std::shared_ptr<const CPUProcessor> {
+        OCIO_NAMESPACE::ConstProcessorRcPtr processor = create_ocio_display_processor(
+            *this, display_parameters);
+        if (!processor) {
+          return nullptr;
+        }
+        return std::make_shared<LibOCIOCPUProcessor>(processor->getDefaultCPUProcessor());
+      });
 }
 
 std::shared_ptr<const CPUProcessor> LibOCIOConfig::get_cpu_processor(
     const StringRefNull from_colorspace, const StringRefNull to_colorspace) const
 {
-  const OCIO_NAMESPACE::ConstProcessorRcPtr processor = create_ocio_processor(
-      ocio_config_, from_colorspace.c_str(), to_colorspace.c_str());
-  if (!processor) {
-    return nullptr;
-  }
-  return std::make_shared<LibOCIOCPUProcessor>(processor->getDefaultCPUProcessor());
+  return processor_cache_.get(
+      from_colorspace, to_colorspace, [&]() -> std::shared_ptr<const CPUProcessor> {
+        const OCIO_NAMESPACE::ConstProcessorRcPtr processor = create_ocio_processor(
+            ocio_config_, from_colorspace.c_str(), to_colorspace.c_str());
+        if (!processor) {
+          return nullptr;
+        }
+        return std::make_shared<LibOCIOCPUProcessor>(processor->getDefaultCPUProcessor());
+      });
 }
 
 /** \} */
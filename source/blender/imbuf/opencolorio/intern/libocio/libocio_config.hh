@@ -16,6 +16,7 @@
 #  include "libocio_display.hh"
 #  include "libocio_gpu_shader_binder.hh"
 #  include "libocio_look.hh"
+#  include "libocio_processor_cache.hh"
 
 #  include "../opencolorio.hh"
 
@@ -43,6 +44,10 @@ class LibOCIOConfig : public Config {
 
   LibOCIOGPUShaderBinder gpu_shader_binder_{*this};
 
+  /* Most recently used CPU processors, to avoid re-creating processors when the same image is
+   * drawn or processed many times with the same settings. */
+  LibOCIOProcessorCache processor_cache_;
+
  public:
   ~LibOCIOConfig();
 
@@ -0,0 +1,92 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "libocio_processor_cache.hh"
+
+#if defined(WITH_OPENCOLORIO)
+
+#  include <mutex>
+
+#  include "OCIO_cpu_processor.hh"
+
+namespace blender::ocio {
+
+LibOCIOProcessorCache::DisplayKey::DisplayKey(const DisplayParameters &display_parameters)
+    : from_colorspace(display_parameters.from_colorspace),
+      view(display_parameters.view),
+      display(display_parameters.display),
+      look(display_parameters.look),
+      scale(display_parameters.scale),
+      exponent(display_parameters.exponent),
+      temperature(display_parameters.temperature),
+      tint(display_parameters.tint),
+      use_white_balance(display_parameters.use_white_balance),
+      use_hdr_buffer(display_parameters.use_hdr_buffer),
+      use_hdr_display(display_parameters.use_hdr_display),
+      is_image_output(display_parameters.is_image_output),
+      use_display_emulation(display_parameters.use_display_emulation),
+      inverse(display_parameters.inverse)
+{
+}
+
+/**
+ * Find the processor in the list of cached processors and move it to the front of the list to
+ * mark it as the most recently used. When it is not found create it, removing the least recently
+ * used processor if the cache is full.
+ *
+ * Must be called with the cache mutex locked. The creation happens with the lock held as well, so
+ * that multiple threads asking for the same processor don't create it multiple times.
+ */
+template<typename ItemT>
+static std::shared_ptr<const CPUProcessor> lookup_or_add(
+    std::list<ItemT> &cache,
+    const decltype(ItemT::key) &key,
+    const int max_size,
+    const FunctionRef<std::shared_ptr<const CPUProcessor>()> create_processor)
+{
+  for (auto it = cache.begin(); it != cache.end(); it++) {
+    if (it->key == key) {
+      if (it != cache.begin()) {
+        cache.splice(cache.begin(), cache, it);
+      }
+      return cache.front().processor;
+    }
+  }
+
+  while (cache.size() >= size_t(max_size)) {
+    cache.pop_back();
+  }
+  cache.push_front({key, create_processor()});
+  return cache.front().processor;
+}
+
+std::shared_ptr<const CPUProcessor> LibOCIOProcessorCache::get_display(
+    const DisplayParameters &display_parameters,
+    const FunctionRef<std::shared_ptr<const CPUProcessor>()> create_processor) const
+{
+  const DisplayKey key(display_parameters);
+  std::lock_guard lock(mutex_);
+  return lookup_or_add(display_processors_, key, MAX_SIZE, create_processor);
+}
+
+std::shared_ptr<const CPUProcessor> LibOCIOProcessorCache::get(
+    const StringRefNull from_colorspace,
+    const StringRefNull to_colorspace,
+    const FunctionRef<std::shared_ptr<const CPUProcessor>()> create_processor) const
+{
+  const ColorSpaceKey key{from_colorspace, to_colorspace};
+  std::lock_guard lock(mutex_);
+  return lookup_or_add(color_space_processors_, key, MAX_SIZE, create_processor);
+}
+
+void LibOCIOProcessorCache::clear()
+{
+  std::lock_guard lock(mutex_);
+  display_processors_.clear();
+  color_space_processors_.clear();
+}
+
+}  // namespace blender::ocio
+
+#endif
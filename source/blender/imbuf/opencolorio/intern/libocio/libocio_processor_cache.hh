@@ -0,0 +1,102 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#if defined(WITH_OPENCOLORIO)
+
+#  include <list>
+#  include <memory>
+#  include <string>
+
+#  include "BLI_function_ref.hh"
+#  include "BLI_mutex.hh"
+#  include "BLI_string_ref.hh"
+
+#  include "OCIO_config.hh"
+
+namespace blender::ocio {
+
+class CPUProcessor;
+
+/**
+ * Cache of the most recently used CPU processors.
+ *
+ * Drawing and processing images asks for the same processor over and over again, for example for
+ * every frame of the sequencer preview or for every tile of a render result. Creating the
+ * OpenColorIO processor involves building and optimizing the transform, which is avoided when the
+ * same parameters have been used recently.
+ *
+ * The cache is thread-safe.
+ */
+class LibOCIOProcessorCache {
+  /* The maximum number of cached processors of each kind. */
+  static constexpr int MAX_SIZE = 16;
+
+  struct DisplayKey {
+    std::string from_colorspace;
+    std::string view;
+    std::string display;
+    std::string look;
+    float scale;
+    float exponent;
+    float temperature;
+    float tint;
+    bool use_white_balance;
+    bool use_hdr_buffer;
+    bool use_hdr_display;
+    bool is_image_output;
+    bool use_display_emulation;
+    bool inverse;
+
+    explicit DisplayKey(const DisplayParameters &display_parameters);
+    bool operator==(const DisplayKey &other) const = default;
+  };
+
+  struct ColorSpaceKey {
+    std::string from_colorspace;
+    std::string to_colorspace;
+
+    bool operator==(const ColorSpaceKey &other) const = default;
+  };
+
+  template<typename Key> struct Item {
+    Key key;
+    std::shared_ptr<const CPUProcessor> processor;
+  };
+
+  mutable Mutex mutex_;
+  mutable std::list<Item<DisplayKey>> display_processors_;
+  mutable std::list<Item<ColorSpaceKey>> color_space_processors_;
+
+ public:
+  /**
+   * Get display processor for the given parameters, or create the new one using
+   * create_processor() and cache it.
+   *
+   * If the create_processor() returns nullptr it is cached as nullptr, to avoid re-trying to build
+   * the same failing processor.
+   */
+  std::shared_ptr<const CPUProcessor> get_display(
+      const DisplayParameters &display_parameters,
+      FunctionRef<std::shared_ptr<const CPUProcessor>()> create_processor) const;
+
+  /**
+   * Get processor to convert color space, or create the new one using create_processor() and
+   * cache it.
+   */
+  std::shared_ptr<const CPUProcessor> get(
+      StringRefNull from_colorspace,
+      StringRefNull to_colorspace,
+      FunctionRef<std::shared_ptr<const CPUProcessor>()> create_processor) const;
+
+  /**
+   * Remove all processors from the cache.
+   */
+  void clear();
+};
+
+}  // namespace blender::ocio
+
+#endif
@@ -19,6 +19,8 @@
 #include "BKE_object.hh"
 #include "BKE_subdiv.hh"
 
+#include "BLI_task.hh"
+
 #include "bmesh.hh"
 #include "bmesh_tools.hh"
 
@@ -209,9 +211,27 @@ void ABCGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   std::vector<Imath::V3f> points, normals;
   std::vector<int32_t> face_verts, loop_counts;
   std::vector<Imath::V3f> velocities;
-
-  get_vertices(mesh, points);
-  get_topology(mesh, face_verts, loop_counts);
+  UVSample uvs_and_indices;
+  const char *uv_name = "";
+  bool has_velocities = false;
+
+  /* Extracting the sample arrays only reads the evaluated mesh, so do it in parallel. Writing to
+   * the archive is not thread-safe and stays on the calling thread. */
+  threading::parallel_invoke(
+      mesh->verts_num > 1024,
+      [&]() { get_vertices(mesh, points); },
+      [&]() { get_topology(mesh, face_verts, loop_counts); },
+      [&]() {
+        if (args_.export_params->uvs) {
+          uv_name = get_uv_sample(uvs_and_indices, m_custom_data_config, *mesh);
+        }
+      },
+      [&]() {
+        if (args_.export_params->normals) {
+          get_loop_normals(mesh, normals);
+        }
+      },
+      [&]() { has_velocities = get_velocities(mesh, velocities); });
 
   if (!frame_has_been_written_ && args_.export_params->face_sets) {
     write_face_sets(context.object, mesh, abc_poly_mesh_schema_);
@@ -220,18 +240,14 @@ void ABCGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   OPolyMeshSchema::Sample mesh_sample = OPolyMeshSchema::Sample(
       V3fArraySample(points), Int32ArraySample(face_verts), Int32ArraySample(loop_counts));
 
-  UVSample uvs_and_indices;
-
   if (args_.export_params->uvs) {
-    const char *name = get_uv_sample(uvs_and_indices, m_custom_data_config, *mesh);
-
     if (!uvs_and_indices.indices.empty() && !uvs_and_indices.uvs.empty()) {
       OV2fGeomParam::Sample uv_sample;
       uv_sample.setVals(V2fArraySample(uvs_and_indices.uvs));
       uv_sample.setIndices(UInt32ArraySample(uvs_and_indices.indices));
       uv_sample.setScope(kFacevaryingScope);
 
-      abc_poly_mesh_schema_.setUVSourceName(name);
+      abc_poly_mesh_schema_.setUVSourceName(uv_name);
       mesh_sample.setUVs(uv_sample);
     }
 
@@ -240,8 +256,6 @@ void ABCGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   }
 
   if (args_.export_params->normals) {
-    get_loop_normals(mesh, normals);
-
     ON3fGeomParam::Sample normals_sample;
     if (!normals.empty()) {
       normals_sample.setScope(kFacevaryingScope);
@@ -255,7 +269,7 @@ void ABCGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
     write_generated_coordinates(abc_poly_mesh_schema_.getArbGeomParams(), m_custom_data_config);
   }
 
-  if (get_velocities(mesh, velocities)) {
+  if (has_velocities) {
     mesh_sample.setVelocities(V3fArraySample(velocities));
   }
 
@@ -274,10 +288,14 @@ void ABCGenericMeshWriter::write_subd(HierarchyContext &context, Mesh *mesh)
   std::vector<int32_t> face_verts, loop_counts;
   std::vector<int32_t> edge_crease_indices, edge_crease_lengths, vert_crease_indices;
 
-  get_vertices(mesh, points);
-  get_topology(mesh, face_verts, loop_counts);
-  get_edge_creases(mesh, edge_crease_indices, edge_crease_lengths, edge_crease_sharpness);
-  get_vert_creases(mesh, vert_crease_indices, vert_crease_sharpness);
+  threading::parallel_invoke(
+      mesh->verts_num > 1024,
+      [&]() { get_vertices(mesh, points); },
+      [&]() { get_topology(mesh, face_verts, loop_counts); },
+      [&]() {
+        get_edge_creases(mesh, edge_crease_indices, edge_crease_lengths, edge_crease_sharpness);
+      },
+      [&]() { get_vert_creases(mesh, vert_crease_indices, vert_crease_sharpness); });
 
   if (!frame_has_been_written_ && args_.export_params->face_sets) {
     write_face_sets(context.object, mesh, abc_subdiv_schema_);
@@ -372,9 +390,11 @@ bool ABCGenericMeshWriter::get_velocities(Mesh *mesh, std::vector<Imath::V3f> &v
   vels.clear();
   vels.resize(totverts);
 
-  for (int i = 0; i < totverts; i++) {
-    copy_yup_from_zup(vels[i].getValue(), attr[i]);
-  }
+  threading::parallel_for(IndexRange(totverts), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      copy_yup_from_zup(vels[i].getValue(), attr[i]);
+    }
+  });
 
   return true;
 }
@@ -429,9 +449,11 @@ static void get_vertices(Mesh *mesh, std::vector<Imath::V3f> &points)
   points.resize(mesh->verts_num);
 
   const Span<float3> positions = mesh->vert_positions();
-  for (int i = 0, e = mesh->verts_num; i < e; i++) {
-    copy_yup_from_zup(points[i].getValue(), positions[i]);
-  }
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      copy_yup_from_zup(points[i].getValue(), positions[i]);
+    }
+  });
 }
 
 static void get_topology(Mesh *mesh,
@@ -443,19 +465,19 @@ static void get_topology(Mesh *mesh,
 
   face_verts.clear();
   loop_counts.clear();
-  face_verts.reserve(corner_verts.size());
-  loop_counts.reserve(faces.size());
+  face_verts.resize(corner_verts.size());
+  loop_counts.resize(faces.size());
 
   /* NOTE: data needs to be written in the reverse order. */
-  for (const int i : faces.index_range()) {
-    const IndexRange face = faces[i];
-    loop_counts.push_back(face.size());
-
-    int corner = face.start() + (face.size() - 1);
-    for (int j = 0; j < face.size(); j++, corner--) {
-      face_verts.push_back(corner_verts[corner]);
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const IndexRange face = faces[i];
+      loop_counts[i] = face.size();
+      for (const int j : face.index_range()) {
+        face_verts[face[j]] = corner_verts[face.last(j)];
+      }
     }
-  }
+  });
 }
 
 static void get_edge_creases(Mesh *mesh,
@@ -22,6 +22,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_offset_indices.hh"
 #include "BLI_ordered_edge.hh"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -437,11 +438,10 @@ static bool samples_have_same_topology(const SampleType &sample, const SampleTyp
 static void read_mesh_sample(const std::string &iobject_full_name,
                              ImportSettings *settings,
                              const IPolyMeshSchema &schema,
+                             const IPolyMeshSchema::Sample &sample,
                              const ISampleSelector &selector,
                              CDStreamConfig &config)
 {
-  const IPolyMeshSchema::Sample sample = schema.getValue(selector);
-
   AbcMeshData abc_mesh_data;
   abc_mesh_data.face_counts = sample.getFaceCounts();
   abc_mesh_data.face_indices = sample.getFaceIndices();
@@ -490,6 +490,10 @@ static void read_mesh_sample(const std::string &iobject_full_name,
 
 /* ************************************************************************** */
 
+/* The number of samples following the current frame that are read in the background while a mesh
+ * is streamed. Every prefetched sample holds the positions and topology arrays of the mesh. */
+static constexpr int prefetch_samples_num = 3;
+
 AbcMeshReader::AbcMeshReader(const IObject &object, ImportSettings &settings)
     : AbcObjectReader(object, settings)
 {
@@ -660,6 +664,12 @@ bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSel
     return false;
   }
 
+  return topology_changed(existing_mesh, sample);
+}
+
+bool AbcMeshReader::topology_changed(const Mesh *existing_mesh,
+                                     const IPolyMeshSchema::Sample &sample) const
+{
   const P3fArraySamplePtr &positions = sample.getPositions();
   const Alembic::Abc::Int32ArraySamplePtr &face_indices = sample.getFaceIndices();
   const Alembic::Abc::Int32ArraySamplePtr &face_counts = sample.getFaceCounts();
@@ -720,10 +730,39 @@ void AbcMeshReader::read_geometry(bke::GeometrySet &geometry_set,
     return;
   }
 
+  if (!m_sample_prefetcher) {
+    m_sample_prefetcher = std::make_unique<
+        io::SamplePrefetcher<Alembic::Abc::index_t, IPolyMeshSchema::Sample>>(
+        [this](const Alembic::Abc::index_t index) {
+          return m_schema.getValue(ISampleSelector(index));
+        },
+        prefetch_samples_num);
+  }
+
   Mesh *new_mesh = read_mesh(
       mesh, sample_sel, read_flag, velocity_name, velocity_scale, r_err_str);
 
   geometry_set.replace_mesh(new_mesh);
+
+  prefetch_samples_after(sample_sel);
+}
+
+void AbcMeshReader::prefetch_samples_after(const ISampleSelector &sample_sel)
+{
+  /* File sequences use a separate archive for every frame. */
+  const int64_t samples_num = m_schema.getNumSamples();
+  if (m_is_reading_a_file_sequence || samples_num <= 1) {
+    return;
+  }
+
+  const Alembic::Abc::index_t index = sample_sel.getIndex(m_schema.getTimeSampling(),
+                                                          samples_num);
+  const int64_t end = std::min<int64_t>(index + 1 + prefetch_samples_num, samples_num);
+  Vector<Alembic::Abc::index_t, prefetch_samples_num> indices;
+  for (Alembic::Abc::index_t i = index + 1; i < end; i++) {
+    indices.append(i);
+  }
+  m_sample_prefetcher->prefetch(indices);
 }
 
 Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
@@ -735,7 +774,13 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
 {
   IPolyMeshSchema::Sample sample;
   try {
-    sample = m_schema.getValue(sample_sel);
+    if (m_sample_prefetcher) {
+      sample = m_sample_prefetcher->get(
+          sample_sel.getIndex(m_schema.getTimeSampling(), m_schema.getNumSamples()));
+    }
+    else {
+      sample = m_schema.getValue(sample_sel);
+    }
   }
   catch (Alembic::Util::Exception &ex) {
     if (r_err_str != nullptr) {
@@ -776,7 +821,7 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   settings.velocity_name = velocity_name;
   settings.velocity_scale = velocity_scale;
 
-  if (topology_changed(existing_mesh, sample_sel)) {
+  if (topology_changed(existing_mesh, sample)) {
     new_mesh = BKE_mesh_new_nomain_from_template(
         existing_mesh, positions->size(), 0, face_counts->size(), face_indices->size());
 
@@ -804,7 +849,7 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   config.time = sample_sel.getRequestedTime();
   config.modifier_error_message = r_err_str;
 
-  read_mesh_sample(m_iobject.getFullName(), &settings, m_schema, sample_sel, config);
+  read_mesh_sample(m_iobject.getFullName(), &settings, m_schema, sample, sample_sel, config);
 
   if (new_mesh) {
     /* Here we assume that the number of materials doesn't change, i.e. that
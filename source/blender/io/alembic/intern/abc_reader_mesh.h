@@ -7,8 +7,12 @@
  * \ingroup balembic
  */
 
+#include <memory>
+
 #include "BLI_span.hh"
 
+#include "IO_sample_prefetcher.hh"
+
 #include "abc_reader_object.h"
 
 #include <Alembic/AbcGeom/IPolyMesh.h>
@@ -23,6 +27,12 @@ namespace io::alembic {
 class AbcMeshReader final : public AbcObjectReader {
   Alembic::AbcGeom::IPolyMeshSchema m_schema;
 
+  /* Reads the samples of the next frames in the background while the mesh is streamed by a cache
+   * modifier. Declared after the schema so that it is destructed before the schema it reads. */
+  std::unique_ptr<
+      io::SamplePrefetcher<Alembic::Abc::index_t, Alembic::AbcGeom::IPolyMeshSchema::Sample>>
+      m_sample_prefetcher;
+
  public:
   AbcMeshReader(const Alembic::Abc::IObject &object, ImportSettings &settings);
 
@@ -50,6 +60,15 @@ class AbcMeshReader final : public AbcObjectReader {
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
+  bool topology_changed(const Mesh *existing_mesh,
+                        const Alembic::AbcGeom::IPolyMeshSchema::Sample &sample) const;
+
+  /**
+   * Start reading the samples following the given one in the background, unless the schema
+   * isn't animated.
+   */
+  void prefetch_samples_after(const Alembic::Abc::ISampleSelector &sample_sel);
+
   void readFaceSetsSample(Main *bmain,
                           Mesh *mesh,
                           const Alembic::AbcGeom::ISampleSelector &sample_sel);
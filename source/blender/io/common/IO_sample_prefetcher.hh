@@ -0,0 +1,156 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include "BLI_map.hh"
+#include "BLI_span.hh"
+#include "BLI_task.h"
+#include "BLI_vector.hh"
+
+namespace blender::io {
+
+/**
+ * This code is shared between the Alembic and USD cache readers.
+ * Reads the samples of upcoming frames of an animated cache in a background thread, so that
+ * playback only has to wait for the cache file when the prefetching can't keep up.
+ *
+ * The reading function is called from the background thread and must therefore only access data
+ * that stays valid and unmodified for the lifetime of the prefetcher. The destructor waits for
+ * the sample that is currently being read, so the prefetcher should be destructed before the data
+ * that the reading function uses.
+ */
+template<typename KeyT, typename SampleT> class SamplePrefetcher final {
+ public:
+  using ReadFn = std::function<SampleT(const KeyT &key)>;
+
+ private:
+  ReadFn read_fn_;
+  /* The maximum number of samples to read ahead of time, bounding the memory usage. */
+  int max_samples_;
+
+  std::mutex mutex_;
+  /* Notified every time the background thread finished reading a sample. */
+  std::condition_variable sample_read_;
+  Map<KeyT, SampleT> samples_;
+  /* The keys of the samples that still have to be read by the background thread. */
+  Vector<KeyT> queue_;
+  std::optional<KeyT> key_in_flight_;
+  bool worker_running_ = false;
+
+  TaskPool *task_pool_ = nullptr;
+
+ public:
+  SamplePrefetcher(ReadFn read_fn, const int max_samples)
+      : read_fn_(std::move(read_fn)), max_samples_(max_samples)
+  {
+  }
+
+  ~SamplePrefetcher()
+  {
+    if (task_pool_ == nullptr) {
+      return;
+    }
+    {
+      std::lock_guard lock(mutex_);
+      queue_.clear();
+    }
+    BLI_task_pool_work_and_wait(task_pool_);
+    BLI_task_pool_free(task_pool_);
+  }
+
+  /**
+   * Return the sample with the given key. Prefetched samples are handed out and removed from the
+   * prefetcher, if the sample is being read by the background thread that read is waited for,
+   * otherwise the sample is read on the calling thread.
+   */
+  SampleT get(const KeyT &key)
+  {
+    std::unique_lock lock(mutex_);
+    sample_read_.wait(lock, [&]() { return key_in_flight_ != key; });
+    if (std::optional<SampleT> sample = samples_.pop_try(key)) {
+      return std::move(*sample);
+    }
+    /* Don't read the sample twice if the background thread didn't get to it yet. */
+    const int64_t queue_index = queue_.first_index_of_try(key);
+    if (queue_index != -1) {
+      queue_.remove(queue_index);
+    }
+    lock.unlock();
+    return read_fn_(key);
+  }
+
+  /**
+   * Start reading the samples with the given keys in the background, in the given order. Only the
+   * first `max_samples` keys are considered and previously prefetched samples that are not part of
+   * the given keys are freed, since they are unlikely to be requested anymore.
+   */
+  void prefetch(const Span<KeyT> keys)
+  {
+    const Span<KeyT> wanted_keys = keys.take_front(max_samples_);
+
+    std::lock_guard lock(mutex_);
+    samples_.remove_if([&](const auto item) { return !wanted_keys.contains(item.key); });
+
+    queue_.clear();
+    for (const KeyT &key : wanted_keys) {
+      if (!samples_.contains(key) && key_in_flight_ != key) {
+        queue_.append(key);
+      }
+    }
+
+    if (queue_.is_empty() || worker_running_) {
+      return;
+    }
+    if (task_pool_ == nullptr) {
+      task_pool_ = BLI_task_pool_create_background(this, TASK_PRIORITY_LOW);
+    }
+    worker_running_ = true;
+    BLI_task_pool_push(task_pool_, prefetch_task, nullptr, false, nullptr);
+  }
+
+  /* Disallow copying. */
+  SamplePrefetcher(const SamplePrefetcher &) = delete;
+  SamplePrefetcher &operator=(const SamplePrefetcher &) = delete;
+
+ private:
+  static void prefetch_task(TaskPool *__restrict pool, void * /*taskdata*/)
+  {
+    SamplePrefetcher &prefetcher = *static_cast<SamplePrefetcher *>(BLI_task_pool_user_data(pool));
+    prefetcher.read_queued_samples();
+  }
+
+  void read_queued_samples()
+  {
+    std::unique_lock lock(mutex_);
+    while (!queue_.is_empty()) {
+      const KeyT key = queue_.first();
+      queue_.remove(0);
+      key_in_flight_ = key;
+      lock.unlock();
+
+      /* Errors are ignored here, they are reported when the sample is read again on request. */
+      std::optional<SampleT> sample;
+      try {
+        sample.emplace(read_fn_(key));
+      }
+      catch (...) {
+      }
+
+      lock.lock();
+      key_in_flight_.reset();
+      if (sample) {
+        samples_.add_overwrite(key, std::move(*sample));
+      }
+      sample_read_.notify_all();
+    }
+    worker_running_ = false;
+  }
+};
+
+}  // namespace blender::io
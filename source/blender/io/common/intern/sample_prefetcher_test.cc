@@ -0,0 +1,67 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+#include "IO_sample_prefetcher.hh"
+
+#include "testing/testing.h"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace blender::io {
+
+TEST(io_common_sample_prefetcher, get_without_prefetch)
+{
+  std::atomic<int> reads = 0;
+  SamplePrefetcher<int, int> prefetcher(
+      [&](const int key) {
+        reads++;
+        return key * 10;
+      },
+      2);
+
+  EXPECT_EQ(prefetcher.get(3), 30);
+  EXPECT_EQ(prefetcher.get(3), 30);
+  EXPECT_EQ(reads, 2);
+}
+
+TEST(io_common_sample_prefetcher, get_prefetched)
+{
+  std::atomic<int> reads = 0;
+  SamplePrefetcher<int, int> prefetcher(
+      [&](const int key) {
+        reads++;
+        return key * 10;
+      },
+      2);
+
+  /* Only the first two keys are prefetched. */
+  prefetcher.prefetch({1, 2, 3});
+  EXPECT_EQ(prefetcher.get(1), 10);
+  EXPECT_EQ(prefetcher.get(2), 20);
+  EXPECT_EQ(reads, 2);
+
+  EXPECT_EQ(prefetcher.get(3), 30);
+  EXPECT_EQ(reads, 3);
+}
+
+TEST(io_common_sample_prefetcher, read_error)
+{
+  std::atomic<bool> fail = true;
+  SamplePrefetcher<int, int> prefetcher(
+      [&](const int key) {
+        if (fail) {
+          throw std::runtime_error("read error");
+        }
+        return key;
+      },
+      4);
+
+  prefetcher.prefetch({5});
+  EXPECT_THROW(prefetcher.get(5), std::runtime_error);
+
+  fail = false;
+  EXPECT_EQ(prefetcher.get(5), 5);
+}
+
+}  // namespace blender::io
@@ -179,116 +179,143 @@ static ChunkResult parse_records_chunk(const csv_parse::CsvRecords &records,
 }
 
 /**
- * So far, the parsed data is still split into many chunks. This function flattens the chunks into
- * continuous buffers that can be used as attributes.
+ * Append the values of a column that are still split into many chunks to the continuous buffer of
+ * the values of all the rows that were parsed before.
  */
-static Array<std::optional<GArray<>>> flatten_valid_attribute_chunks(
-    const Span<ColumnInfo> columns_info,
-    OffsetIndices<int> chunk_offsets,
-    MutableSpan<ChunkResult> chunks)
+template<typename T>
+static void append_column_chunks(const int column_i,
+                                 const OffsetIndices<int> chunk_offsets,
+                                 MutableSpan<ChunkResult> chunks,
+                                 Vector<T> &values)
 {
-  const int points_num = chunk_offsets.total_size();
-  Array<std::optional<GArray<>>> flattened_attributes(columns_info.size());
+  const int64_t start = values.size();
+  values.resize(start + chunk_offsets.total_size());
+  MutableSpan<T> dst = values.as_mutable_span().drop_front(start);
+  threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange chunks_range) {
+    for (const int chunk_i : chunks_range) {
+      MutableSpan<T> chunk_dst = dst.slice(chunk_offsets[chunk_i]);
+      ColumnData &column_data = chunks[chunk_i].columns[column_i];
+      if (const auto *int_vec = std::get_if<Vector<int>>(&column_data)) {
+        /* For float columns, chunks that were read entirely as integers are converted here. */
+        BLI_assert(int_vec->size() == chunk_dst.size());
+        uninitialized_convert_n(int_vec->data(), chunk_dst.size(), chunk_dst.data());
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        if (const auto *float_vec = std::get_if<Vector<float>>(&column_data)) {
+          BLI_assert(float_vec->size() == chunk_dst.size());
+          uninitialized_copy_n(float_vec->data(), chunk_dst.size(), chunk_dst.data());
+        }
+        else {
+          /* Expected data to be available, because the `found_invalid` flag was not set. */
+          BLI_assert_unreachable();
+        }
+      }
+      else {
+        /* Expected integer data to be available, because the `found_invalid` and `found_float`
+         * flags were not set. */
+        BLI_assert_unreachable();
+      }
+      /* Free data for chunk. */
+      column_data = std::monostate{};
+    }
+  });
+}
 
+/**
+ * So far, the parsed data of a block of the file is still split into many chunks. This function
+ * appends the chunks to the continuous buffers of all the rows parsed before, which are used as
+ * attributes in the end.
+ */
+static void append_valid_attribute_chunks(const Span<ColumnInfo> columns_info,
+                                          const OffsetIndices<int> chunk_offsets,
+                                          MutableSpan<ChunkResult> chunks,
+                                          MutableSpan<ColumnData> columns)
+{
   threading::parallel_for(columns_info.index_range(), 1, [&](const IndexRange columns_range) {
     for (const int column_i : columns_range) {
       const ColumnInfo &column_info = columns_info[column_i];
+      ColumnData &column = columns[column_i];
       if (column_info.has_invalid_name || column_info.found_invalid) {
-        /* Column can be ignored. */
+        /* Column can be ignored, free the values of the previous blocks. */
+        column = std::monostate{};
         continue;
       }
       if (column_info.found_float) {
         /* Should read column as floats. */
-        GArray<> attribute(CPPType::get<float>(), points_num);
-        float *attribute_buffer = static_cast<float *>(attribute.data());
-        threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange chunks_range) {
-          for (const int chunk_i : chunks_range) {
-            const IndexRange dst_range = chunk_offsets[chunk_i];
-            ChunkResult &chunk = chunks[chunk_i];
-            ColumnData &column_data = chunk.columns[column_i];
-            if (const auto *float_vec = std::get_if<Vector<float>>(&column_data)) {
-              BLI_assert(float_vec->size() == dst_range.size());
-              uninitialized_copy_n(
-                  float_vec->data(), dst_range.size(), attribute_buffer + dst_range.first());
-            }
-            else if (const auto *int_vec = std::get_if<Vector<int>>(&column_data)) {
-              /* This chunk was read entirely as integers, so it still has to be converted to
-               * floats. */
-              BLI_assert(int_vec->size() == dst_range.size());
-              uninitialized_convert_n(int_vec->data(), dst_range.size(), attribute_buffer);
-            }
-            else {
-              /* Expected data to be available, because the `found_invalid` flag was not
-               * set. */
-              BLI_assert_unreachable();
-            }
-            /* Free data for chunk. */
-            column_data = std::monostate{};
-          }
-        });
-        flattened_attributes[column_i] = std::move(attribute);
+        if (const auto *int_values = std::get_if<Vector<int>>(&column)) {
+          /* The column only contained integers in the previous blocks, so convert them. */
+          Vector<float> float_values(int_values->size());
+          threading::parallel_for(
+              int_values->index_range(), 4096, [&](const IndexRange range) {
+                uninitialized_convert_n(int_values->data() + range.start(),
+                                        range.size(),
+                                        float_values.data() + range.start());
+              });
+          column = std::move(float_values);
+        }
+        else if (!std::holds_alternative<Vector<float>>(column)) {
+          column = Vector<float>();
+        }
+        append_column_chunks(column_i, chunk_offsets, chunks, std::get<Vector<float>>(column));
         continue;
       }
       if (column_info.found_int) {
         /* Should read column as ints. */
-        GArray<> attribute(CPPType::get<int>(), points_num);
-        int *attribute_buffer = static_cast<int *>(attribute.data());
-        threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange chunks_range) {
-          for (const int chunk_i : chunks_range) {
-            const IndexRange dst_range = chunk_offsets[chunk_i];
-            ChunkResult &chunk = chunks[chunk_i];
-            ColumnData &column_data = chunk.columns[column_i];
-            if (const auto *int_vec = std::get_if<Vector<int>>(&column_data)) {
-              BLI_assert(int_vec->size() == dst_range.size());
-              uninitialized_copy_n(
-                  int_vec->data(), dst_range.size(), attribute_buffer + dst_range.first());
-            }
-            else {
-              /* Expected data to be available, because the `found_invalid` and
-               * `found_float` flags were not set. */
-              BLI_assert_unreachable();
-            }
-            /* Free data for chunk. */
-            column_data = std::monostate{};
-          }
-        });
-        flattened_attributes[column_i] = std::move(attribute);
+        if (!std::holds_alternative<Vector<int>>(column)) {
+          column = Vector<int>();
+        }
+        append_column_chunks(column_i, chunk_offsets, chunks, std::get<Vector<int>>(column));
         continue;
       }
     }
   });
-  return flattened_attributes;
+}
+
+/**
+ * The file is read and parsed in blocks of this size, so that the memory usage doesn't depend on
+ * the size of the file but only on the number of rows and valid columns.
+ */
+static constexpr int64_t read_block_size = 64 * 1024 * 1024;
+
+template<typename T> static void add_shared_attribute(bke::MutableAttributeAccessor &attributes,
+                                                      const StringRef name,
+                                                      Vector<T> &values)
+{
+  const auto *data = new ImplicitSharedValue<Vector<T>>(std::move(values));
+  attributes.add(name,
+                 bke::AttrDomain::Point,
+                 bke::cpp_type_to_attribute_type(CPPType::get<T>()),
+                 bke::AttributeInitShared{data->data.data(), *data});
+  data->remove_user_and_delete_if_last();
 }
 
 PointCloud *import_csv_as_pointcloud(const CSVImportParams &import_params)
 {
-  size_t buffer_len;
-  char *buffer = BLI_file_read_text_as_mem(import_params.filepath, 0, &buffer_len);
-  if (buffer == nullptr) {
+  FILE *file = BLI_fopen(import_params.filepath, "rb");
+  if (file == nullptr) {
     BKE_reportf(import_params.reports,
                 RPT_ERROR,
                 "CSV Import: Cannot open file '%s'",
                 import_params.filepath);
     return nullptr;
   }
-  BLI_SCOPED_DEFER([&]() { MEM_delete(buffer); });
-  if (buffer_len == 0) {
-    BKE_reportf(
-        import_params.reports, RPT_ERROR, "CSV Import: empty file '%s'", import_params.filepath);
-    return nullptr;
-  }
+  BLI_SCOPED_DEFER([&]() { fclose(file); });
 
   LinearAllocator<> allocator;
   Array<ColumnInfo> columns_info;
+  /* The values of every column for all the rows parsed so far. */
+  Array<ColumnData> columns;
   csv_parse::CsvParseOptions parse_options;
   parse_options.delimiter = import_params.delimiter;
 
   const auto parse_header = [&](const csv_parse::CsvRecord &record) {
     columns_info.reinitialize(record.size());
+    columns.reinitialize(record.size());
     for (const int i : record.index_range()) {
       ColumnInfo &column_info = columns_info[i];
-      const StringRef name = csv_parse::unescape_field(
-          record.field_str(i), parse_options, allocator);
+      /* Copy the name, because the buffer it references is reused for the following blocks. */
+      const StringRef name = allocator.copy_string(
+          csv_parse::unescape_field(record.field_str(i), parse_options, allocator));
       column_info.name = name;
       if (!bke::allow_procedural_attribute_access(name) ||
           bke::attribute_name_is_anonymous(name) || name.is_empty())
@@ -302,11 +329,93 @@ PointCloud *import_csv_as_pointcloud(const CSVImportParams &import_params)
     return parse_records_chunk(records, columns_info);
   };
 
-  const Span<char> buffer_span{buffer, int64_t(buffer_len)};
-  std::optional<Vector<ChunkResult>> parsed_chunks = csv_parse::parse_csv_in_chunks<ChunkResult>(
-      buffer_span, parse_options, parse_header, parse_data_chunk);
+  /* Contains the part of the file that has not been parsed yet, which always starts at the
+   * beginning of a record. */
+  Vector<char, 0> buffer;
+  bool header_parsed = false;
+  bool is_file_end = false;
+  int points_num = 0;
+  while (!is_file_end) {
+    const int64_t unparsed_size = buffer.size();
+    buffer.resize(unparsed_size + read_block_size);
+    const size_t read_size = fread(buffer.data() + unparsed_size, 1, read_block_size, file);
+    buffer.resize(unparsed_size + int64_t(read_size));
+    if (ferror(file)) {
+      BKE_reportf(import_params.reports,
+                  RPT_ERROR,
+                  "CSV Import: Cannot read file '%s'",
+                  import_params.filepath);
+      return nullptr;
+    }
+    is_file_end = read_size < read_block_size;
+    if (is_file_end && !header_parsed && buffer.is_empty()) {
+      BKE_reportf(
+          import_params.reports, RPT_ERROR, "CSV Import: empty file '%s'", import_params.filepath);
+      return nullptr;
+    }
+
+    /* Only parse complete lines, the remaining part is parsed with the next block. */
+    Span<char> block = buffer;
+    if (!is_file_end) {
+      int64_t block_size = block.size();
+      while (block_size > 0 && block[block_size - 1] != '\n') {
+        block_size--;
+      }
+      if (block_size == 0) {
+        continue;
+      }
+      block = block.take_front(block_size);
+    }
+
+    /* A quoted multi-line field can continue in the next block, in which case parsing fails and
+     * the block is parsed again together with more data. */
+    if (!header_parsed) {
+      Vector<Span<char>> header_fields;
+      const std::optional<int64_t> first_data_record_start =
+          csv_parse::detail::parse_record_fields(block,
+                                                 0,
+                                                 parse_options.delimiter,
+                                                 parse_options.quote,
+                                                 parse_options.quote_escape_chars,
+                                                 header_fields);
+      if (!first_data_record_start.has_value()) {
+        if (is_file_end) {
+          break;
+        }
+        continue;
+      }
+      parse_header(csv_parse::CsvRecord(header_fields));
+      header_parsed = true;
+      buffer.remove(0, *first_data_record_start);
+      block = block.drop_front(*first_data_record_start);
+    }
+
+    std::optional<Vector<ChunkResult>> parsed_chunks =
+        csv_parse::parse_csv_records_in_chunks<ChunkResult>(
+            block, parse_options, parse_data_chunk);
+    if (!parsed_chunks.has_value()) {
+      if (is_file_end) {
+        break;
+      }
+      continue;
+    }
+
+    /* Count the number of records and compute the offset of each chunk which is used when
+     * appending the parsed data. */
+    Vector<int> chunk_offsets_vec;
+    chunk_offsets_vec.append(0);
+    for (const ChunkResult &chunk : *parsed_chunks) {
+      chunk_offsets_vec.append(chunk_offsets_vec.last() + chunk.rows_num);
+    }
+    const OffsetIndices<int> chunk_offsets(chunk_offsets_vec);
+    threading::memory_bandwidth_bound_task(block.size(), [&]() {
+      append_valid_attribute_chunks(columns_info, chunk_offsets, *parsed_chunks, columns);
+    });
+    points_num += chunk_offsets.total_size();
+    buffer.remove(0, block.size());
+  }
 
-  if (!parsed_chunks.has_value()) {
+  if (!buffer.is_empty() || !header_parsed) {
     BKE_reportf(import_params.reports,
                 RPT_ERROR,
                 "CSV import: failed to parse file '%s'",
@@ -314,46 +423,23 @@ PointCloud *import_csv_as_pointcloud(const CSVImportParams &import_params)
     return nullptr;
   }
 
-  /* Count the total number of records and compute the offset of each chunk which is used when
-   * flattening the parsed data. */
-  Vector<int> chunk_offsets_vec;
-  chunk_offsets_vec.append(0);
-  for (const ChunkResult &chunk : *parsed_chunks) {
-    chunk_offsets_vec.append(chunk_offsets_vec.last() + chunk.rows_num);
-  }
-  const OffsetIndices<int> chunk_offsets(chunk_offsets_vec);
-  const int points_num = chunk_offsets_vec.last();
-
   PointCloud *pointcloud = BKE_pointcloud_new_nomain(points_num);
-
-  Array<std::optional<GArray<>>> flattened_attributes;
-  threading::memory_bandwidth_bound_task(points_num * 16, [&]() {
-    threading::parallel_invoke(
-        [&]() {
-          array_utils::copy(VArray<float3>::from_single(float3(0), points_num),
-                            pointcloud->positions_for_write());
-        },
-        [&]() {
-          flattened_attributes = flatten_valid_attribute_chunks(
-              columns_info, chunk_offsets, *parsed_chunks);
-        });
+  threading::memory_bandwidth_bound_task(points_num * 12, [&]() {
+    array_utils::copy(VArray<float3>::from_single(float3(0), points_num),
+                      pointcloud->positions_for_write());
   });
 
   /* Add all valid attributes to the pointcloud. */
   bke::MutableAttributeAccessor attributes = pointcloud->attributes_for_write();
   for (const int column_i : columns_info.index_range()) {
-    std::optional<GArray<>> &attribute = flattened_attributes[column_i];
-    if (!attribute.has_value()) {
-      continue;
+    const StringRef name = columns_info[column_i].name;
+    ColumnData &column = columns[column_i];
+    if (auto *float_values = std::get_if<Vector<float>>(&column)) {
+      add_shared_attribute(attributes, name, *float_values);
+    }
+    else if (auto *int_values = std::get_if<Vector<int>>(&column)) {
+      add_shared_attribute(attributes, name, *int_values);
     }
-    const auto *data = new ImplicitSharedValue<GArray<>>(std::move(*attribute));
-    const bke::AttrType type = bke::cpp_type_to_attribute_type(attribute->type());
-    const ColumnInfo &column_info = columns_info[column_i];
-    attributes.add(column_info.name,
-                   bke::AttrDomain::Point,
-                   type,
-                   bke::AttributeInitShared{data->data.data(), *data});
-    data->remove_user_and_delete_if_last();
   }
 
   /* Since all positions are set to zero, the bounding box can be updated eagerly to avoid
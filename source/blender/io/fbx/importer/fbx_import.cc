@@ -17,6 +17,8 @@
 #include "BLI_fileops.h"
 #include "BLI_math_rotation.h"
 #include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
 
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_build.hh"
@@ -38,6 +40,8 @@
 
 #include "CLG_log.h"
 
+#include <fmt/format.h>
+
 namespace blender {
 
 static CLG_LogRef LOG = {"io.fbx"};
@@ -313,6 +317,34 @@ void FbxImportContext::setup_hierarchy()
   }
 }
 
+/* Measures the durations of the import stages, which are reported at the end of the import. */
+class ImportStageTimes {
+  Vector<std::pair<const char *, timeit::Nanoseconds>> stages_;
+  timeit::TimePoint stage_start_ = timeit::Clock::now();
+
+ public:
+  /* Record the time since the end of the previous stage as the duration of the given stage. */
+  void stage_done(const char *name)
+  {
+    const timeit::TimePoint now = timeit::Clock::now();
+    stages_.append({name, now - stage_start_});
+    stage_start_ = now;
+  }
+
+  std::string to_string() const
+  {
+    std::string str;
+    for (const auto &[name, duration] : stages_) {
+      if (!str.empty()) {
+        str += ", ";
+      }
+      str += fmt::format(
+          "{} {:.1f} ms", name, std::chrono::duration<double, std::milli>(duration).count());
+    }
+    return str;
+  }
+};
+
 static void fbx_task_run_fn(void * /* user */,
                             ufbx_thread_pool_context ctx,
                             uint32_t /* group */,
@@ -335,6 +367,8 @@ static void fbx_task_wait_fn(void * /* user */,
 
 void importer_main(Main *bmain, Scene *scene, ViewLayer *view_layer, const FBXImportParams &params)
 {
+  ImportStageTimes stage_times;
+
   FILE *file = BLI_fopen(params.filepath, "rb");
   if (!file) {
     CLOG_ERROR(&LOG, "Failed to open FBX file '%s'", params.filepath);
@@ -387,6 +421,7 @@ void importer_main(Main *bmain, Scene *scene, ViewLayer *view_layer, const FBXIm
                 fbx_error.description.data);
     return;
   }
+  stage_times.stage_done("parsing");
 
   LayerCollection *lc = BKE_layer_collection_get_active_editable(view_layer);
   if (!ID_IS_EDITABLE(lc->collection)) {
@@ -429,12 +464,17 @@ void importer_main(Main *bmain, Scene *scene, ViewLayer *view_layer, const FBXIm
 #endif
 
   ctx.import_materials();
+  stage_times.stage_done("materials");
   ctx.import_armatures();
+  stage_times.stage_done("armatures");
   ctx.import_meshes();
+  stage_times.stage_done("meshes");
   ctx.import_cameras();
   ctx.import_lights();
   ctx.import_empties();
+  stage_times.stage_done("cameras, lights and empties");
   ctx.import_animation(scene->frames_per_second());
+  stage_times.stage_done("animation");
   ctx.setup_hierarchy();
 
   ufbx_free_scene(fbx);
@@ -472,6 +512,9 @@ void importer_main(Main *bmain, Scene *scene, ViewLayer *view_layer, const FBXIm
 
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
   DEG_relations_tag_update(bmain);
+  stage_times.stage_done("scene setup");
+
+  BKE_reportf(params.reports, RPT_INFO, "FBX Import: %s", stage_times.to_string().c_str());
 }
 
 }  // namespace io::fbx
@@ -65,6 +65,22 @@ Span<char> PlyReadBuffer::read_line()
 
 bool PlyReadBuffer::read_bytes(void *dst, size_t size)
 {
+  /* Large reads copy the remaining buffered bytes and read the rest directly from the file, to
+   * avoid going through the read buffer in small pieces. */
+  if (size > read_buffer_size_) {
+    const size_t buffered = size_t(buf_used_ - pos_);
+    memcpy(dst, buffer_.data() + pos_, buffered);
+    pos_ = buf_used_;
+    const size_t remaining = size - buffered;
+    if (file_ == nullptr || at_eof_ ||
+        fread(static_cast<char *>(dst) + buffered, 1, remaining, file_) != remaining)
+    {
+      at_eof_ = true;
+      return false;
+    }
+    return true;
+  }
+
   while (size > 0) {
     if (pos_ + size > buf_used_) {
       if (!refill_buffer()) {
@@ -12,6 +12,7 @@
 
 #include "BLI_endian_switch.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 
 #include "fast_float.h"
 
@@ -196,22 +197,16 @@ template<typename T> static T get_binary_value(PlyDataTypes type, const uint8_t
   return val;
 }
 
-static const char *parse_row_binary(PlyReadBuffer &file,
-                                    const PlyHeader &header,
-                                    const PlyElement &element,
-                                    Vector<uint8_t> &r_scratch,
-                                    Vector<float> &r_values)
+/**
+ * Convert the values of a row of binary properties into floats. The row data might be modified
+ * in place to switch its endianness.
+ */
+static void decode_row_binary(const PlyHeader &header,
+                              const PlyElement &element,
+                              uint8_t *row,
+                              MutableSpan<float> r_values)
 {
-  if (element.stride == 0) {
-    return "Vertex/Edge element contains list properties, this is not supported";
-  }
-  BLI_assert(r_scratch.size() == element.stride);
-  BLI_assert(r_values.size() == element.properties.size());
-  if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
-    return "Could not read row of binary property";
-  }
-
-  const uint8_t *ptr = r_scratch.data();
+  const uint8_t *ptr = row;
   if (header.type == PlyFormatType::BINARY_LE) {
     /* Little endian: just read/convert the values. */
     for (int i = 0, n = int(element.properties.size()); i != n; i++) {
@@ -220,7 +215,8 @@ static const char *parse_row_binary(PlyReadBuffer &file,
       r_values[i] = val;
     }
   }
-  else if (header.type == PlyFormatType::BINARY_BE) {
+  else {
+    BLI_assert(header.type == PlyFormatType::BINARY_BE);
     /* Big endian: read, switch endian, convert the values. */
     for (int i = 0, n = int(element.properties.size()); i != n; i++) {
       const PlyProperty &prop = element.properties[i];
@@ -229,12 +225,38 @@ static const char *parse_row_binary(PlyReadBuffer &file,
       r_values[i] = val;
     }
   }
-  else {
+}
+
+static const char *check_binary_row_format(const PlyHeader &header, const PlyElement &element)
+{
+  if (element.stride == 0) {
+    return "Vertex/Edge element contains list properties, this is not supported";
+  }
+  if (!ELEM(header.type, PlyFormatType::BINARY_LE, PlyFormatType::BINARY_BE)) {
     return "Unknown binary ply format for vertex element";
   }
   return nullptr;
 }
 
+static const char *parse_row_binary(PlyReadBuffer &file,
+                                    const PlyHeader &header,
+                                    const PlyElement &element,
+                                    Vector<uint8_t> &r_scratch,
+                                    Vector<float> &r_values)
+{
+  if (const char *error = check_binary_row_format(header, element)) {
+    return error;
+  }
+  BLI_assert(r_scratch.size() == element.stride);
+  BLI_assert(r_values.size() == element.properties.size());
+  if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
+    return "Could not read row of binary property";
+  }
+
+  decode_row_binary(header, element, r_scratch.data(), r_values);
+  return nullptr;
+}
+
 static const char *load_vertex_element(PlyReadBuffer &file,
                                        const PlyHeader &header,
                                        const PlyElement &element,
@@ -273,15 +295,15 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     data->vertex_custom_attr.append(attr);
   }
 
-  data->vertices.reserve(element.count);
+  data->vertices.resize(element.count);
   if (has_color) {
-    data->vertex_colors.reserve(element.count);
+    data->vertex_colors.resize(element.count);
   }
   if (has_normal) {
-    data->vertex_normals.reserve(element.count);
+    data->vertex_normals.resize(element.count);
   }
   if (has_uv) {
-    data->uv_coordinates.reserve(element.count);
+    data->uv_coordinates.resize(element.count);
   }
 
   float4 color_norm = {1, 1, 1, 1};
@@ -294,31 +316,13 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     color_norm.w = data_type_normalizer[element.properties[alpha_index].type];
   }
 
-  Vector<float> value_vec(element.properties.size());
-  Vector<uint8_t> scratch;
-  if (header.type != PlyFormatType::ASCII) {
-    scratch.resize(element.stride);
-  }
-
-  for (int i = 0; i < element.count; i++) {
-
-    const char *error = nullptr;
-    if (header.type == PlyFormatType::ASCII) {
-      error = parse_row_ascii(file, value_vec);
-    }
-    else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
-    }
-    if (error != nullptr) {
-      return error;
-    }
-
+  auto store_row = [&](const int i, const Span<float> value_vec) {
     /* Vertex coord */
     float3 vertex3;
     vertex3.x = value_vec[vertex_index.x];
     vertex3.y = value_vec[vertex_index.y];
     vertex3.z = value_vec[vertex_index.z];
-    data->vertices.append(vertex3);
+    data->vertices[i] = vertex3;
 
     /* Vertex color */
     if (has_color) {
@@ -332,7 +336,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       else {
         colors4.w = 1.0f;
       }
-      data->vertex_colors.append(colors4);
+      data->vertex_colors[i] = colors4;
     }
 
     /* If normals */
@@ -341,7 +345,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       normals3.x = value_vec[normal_index.x];
       normals3.y = value_vec[normal_index.y];
       normals3.z = value_vec[normal_index.z];
-      data->vertex_normals.append(normals3);
+      data->vertex_normals[i] = normals3;
     }
 
     /* If uv */
@@ -349,7 +353,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       float2 uvmap;
       uvmap.x = value_vec[uv_index.x];
       uvmap.y = value_vec[uv_index.y];
-      data->uv_coordinates.append(uvmap);
+      data->uv_coordinates[i] = uvmap;
     }
 
     /* Custom attributes */
@@ -357,6 +361,40 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       float value = value_vec[custom_attr_indices[ci]];
       data->vertex_custom_attr[ci].data[i] = value;
     }
+  };
+
+  if (header.type == PlyFormatType::ASCII) {
+    Vector<float> value_vec(element.properties.size());
+    for (int i = 0; i < element.count; i++) {
+      if (const char *error = parse_row_ascii(file, value_vec)) {
+        return error;
+      }
+      store_row(i, value_vec);
+    }
+    return nullptr;
+  }
+
+  if (const char *error = check_binary_row_format(header, element)) {
+    return error;
+  }
+
+  /* Read binary rows in large batches that are converted in parallel, since the rows have a fixed
+   * size and don't depend on each other. */
+  const int batch_size = std::max(1, (4 * 1024 * 1024) / element.stride);
+  Vector<uint8_t> scratch;
+  for (int batch_start = 0; batch_start < element.count; batch_start += batch_size) {
+    const IndexRange batch(batch_start, std::min(batch_size, element.count - batch_start));
+    scratch.resize(batch.size() * element.stride);
+    if (!file.read_bytes(scratch.data(), scratch.size())) {
+      return "Could not read row of binary property";
+    }
+    threading::parallel_for(batch.index_range(), 1024, [&](const IndexRange range) {
+      Vector<float> value_vec(element.properties.size());
+      for (const int64_t i : range) {
+        decode_row_binary(header, element, scratch.data() + i * element.stride, value_vec);
+        store_row(int(batch[i]), value_vec);
+      }
+    });
   }
   return nullptr;
 }
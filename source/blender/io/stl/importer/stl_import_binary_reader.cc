@@ -12,6 +12,8 @@
 #include "BKE_mesh.hh"
 
 #include "BLI_array.hh"
+#include "BLI_mmap.h"
+#include "BLI_span.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -36,8 +38,30 @@ Mesh *read_stl_binary(FILE *file, const bool use_custom_normals)
     return BKE_mesh_new_nomain(0, 0, 0, 0);
   }
 
-  Array<PackedTriangle> tris_buf(chunk_size);
   STLMeshHelper stl_mesh(num_tris, use_custom_normals);
+
+  /* Map the file into memory to access all triangles without copying them, which allows merging
+   * their vertices in parallel. */
+  const size_t tris_offset = BINARY_HEADER_SIZE + sizeof(uint32_t);
+  if (BLI_mmap_file *mmap_file = BLI_mmap_open(fileno(file))) {
+    if (BLI_mmap_get_length(mmap_file) >= tris_offset + size_t(num_tris) * BINARY_STRIDE) {
+      const char *data = static_cast<const char *>(BLI_mmap_get_pointer(mmap_file));
+      const PackedTriangle *tris = reinterpret_cast<const PackedTriangle *>(data + tris_offset);
+      stl_mesh.add_triangles(Span<PackedTriangle>(tris, num_tris));
+      const bool io_error = BLI_mmap_any_io_error(mmap_file);
+      BLI_mmap_free(mmap_file);
+      if (io_error) {
+        stl_import_report_error(file);
+        return nullptr;
+      }
+      return stl_mesh.to_mesh();
+    }
+    BLI_mmap_free(mmap_file);
+  }
+
+  /* Opening the mapping seeks to the end of the file. */
+  fseek(file, tris_offset, SEEK_SET);
+  Array<PackedTriangle> tris_buf(chunk_size);
   size_t num_read_tris;
   while ((num_read_tris = fread(tris_buf.data(), sizeof(PackedTriangle), chunk_size, file))) {
     for (size_t i = 0; i < num_read_tris; i++) {
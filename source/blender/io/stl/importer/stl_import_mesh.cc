@@ -8,8 +8,11 @@
 
 #include "BKE_mesh.hh"
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.hh"
+#include "BLI_hash.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -37,11 +40,83 @@ STLMeshHelper::STLMeshHelper(int tris_num, bool use_custom_normals)
   }
 }
 
+int STLMeshHelper::add_vertex(const float3 &position)
+{
+  return vert_indices_.lookup_or_add_cb(position, [&]() {
+    verts_.append(position);
+    return int(verts_.size() - 1);
+  });
+}
+
 bool STLMeshHelper::add_triangle(const PackedTriangle &data)
 {
-  int v1_id = verts_.index_of_or_add(data.vertices[0]);
-  int v2_id = verts_.index_of_or_add(data.vertices[1]);
-  int v3_id = verts_.index_of_or_add(data.vertices[2]);
+  if (vert_indices_.is_empty()) {
+    vert_indices_.reserve(verts_.capacity());
+  }
+  const int v1_id = this->add_vertex(data.vertices[0]);
+  const int v2_id = this->add_vertex(data.vertices[1]);
+  const int v3_id = this->add_vertex(data.vertices[2]);
+  return this->add_triangle(v1_id, v2_id, v3_id, data.normal);
+}
+
+void STLMeshHelper::add_triangles(const Span<PackedTriangle> tris)
+{
+  BLI_assert(verts_.is_empty() && tris_.is_empty());
+  const int64_t positions_num = tris.size() * 3;
+  auto get_position = [&](const int64_t i) -> const float3 & {
+    return tris[i / 3].vertices[i % 3];
+  };
+
+  /* Split the positions into partitions based on their hash, such that equal positions are always
+   * in the same partition and the partitions can be deduplicated in parallel. The partition is
+   * taken from the high bits of the mixed hash, since the maps use the low bits. */
+  const int partitions_num = 64;
+  Array<uint8_t> partitions(positions_num);
+  threading::parallel_for(IndexRange(positions_num), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const uint64_t hash = get_default_hash(get_position(i)) * 0x9E3779B97F4A7C15ull;
+      partitions[i] = uint8_t(hash >> 58);
+    }
+  });
+
+  /* Find the first occurrence of every position, going over the positions of each partition in
+   * order, like adding them one after the other would do. */
+  Array<int> first_occurrences(positions_num);
+  threading::parallel_for(IndexRange(partitions_num), 1, [&](const IndexRange range) {
+    for (const int64_t partition : range) {
+      Map<float3, int> first_occurrence_by_position;
+      for (const int64_t i : IndexRange(positions_num)) {
+        if (partitions[i] != partition) {
+          continue;
+        }
+        first_occurrences[i] = first_occurrence_by_position.lookup_or_add(get_position(i),
+                                                                          int(i));
+      }
+    }
+  });
+
+  /* Give vertices indices in order of their first occurrence. */
+  Array<int> vert_ids(positions_num);
+  for (const int64_t i : IndexRange(positions_num)) {
+    if (first_occurrences[i] == i) {
+      vert_ids[i] = int(verts_.size());
+      verts_.append(get_position(i));
+    }
+    else {
+      vert_ids[i] = vert_ids[first_occurrences[i]];
+    }
+  }
+
+  for (const int64_t i : tris.index_range()) {
+    this->add_triangle(vert_ids[i * 3], vert_ids[i * 3 + 1], vert_ids[i * 3 + 2], tris[i].normal);
+  }
+}
+
+bool STLMeshHelper::add_triangle(const int v1_id,
+                                 const int v2_id,
+                                 const int v3_id,
+                                 const float3 &normal)
+{
   if ((v1_id == v2_id) || (v1_id == v3_id) || (v2_id == v3_id)) {
     degenerate_tris_num_++;
     return false;
@@ -52,7 +127,7 @@ bool STLMeshHelper::add_triangle(const PackedTriangle &data)
   }
 
   if (use_custom_normals_) {
-    loop_normals_.append_n_times(data.normal, 3);
+    loop_normals_.append_n_times(normal, 3);
   }
   return true;
 }
@@ -10,7 +10,9 @@
 
 #include <cstdint>
 
+#include "BLI_map.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 #include "stl_data.hh"
@@ -51,7 +53,9 @@ class Triangle {
 
 class STLMeshHelper {
  private:
-  VectorSet<float3> verts_;
+  Vector<float3> verts_;
+  /* Index of each unique vertex position in #verts_. */
+  Map<float3, int> vert_indices_;
   VectorSet<Triangle> tris_;
   Vector<float3> loop_normals_;
   int degenerate_tris_num_;
@@ -66,6 +70,18 @@ class STLMeshHelper {
    */
   bool add_triangle(const PackedTriangle &data);
 
+  /* Same as calling #add_triangle for each of the triangles in order, but duplicate vertices are
+   * found in parallel. Expected to be called on a helper that has no triangles yet.
+   */
+  void add_triangles(Span<PackedTriangle> tris);
+
+ private:
+  int add_vertex(const float3 &position);
+  /* Adds a triangle defined using indices into #verts_. */
+  bool add_triangle(int v1_id, int v2_id, int v3_id, const float3 &normal);
+
+ public:
+
   Mesh *to_mesh();
 };
 
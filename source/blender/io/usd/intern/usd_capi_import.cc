@@ -24,6 +24,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "BLT_translation.hh"
@@ -275,6 +276,19 @@ static void import_startjob(void *customdata, wmJobWorkerStatus *worker_status)
     }
   }
 
+  /* Read the parts of the object data that don't need access to Main in parallel, since that is
+   * where most of the time is spent for files with many prims. */
+  threading::parallel_for(archive->readers().index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t reader_index : range) {
+      archive->readers()[reader_index]->prepare_object_data(0.0);
+    }
+  });
+
+  if (G.is_break) {
+    data->was_canceled = true;
+    return;
+  }
+
   /* Setup parenthood and read actual object data. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
@@ -477,6 +477,17 @@ void USDHierarchyIterator::add_to_prim_map(const pxr::SdfPath &usd_path, const I
   }
 }
 
+std::optional<pxr::SdfPath> USDHierarchyIterator::lookup_or_add_mesh_prim(
+    const uint64_t content_hash, const pxr::SdfPath &usd_path) const
+{
+  const pxr::SdfPath *existing_path = mesh_prims_by_content_hash_.lookup_ptr(content_hash);
+  if (existing_path) {
+    return *existing_path;
+  }
+  mesh_prims_by_content_hash_.add_new(content_hash, usd_path);
+  return std::nullopt;
+}
+
 USDExporterContext USDHierarchyIterator::create_point_instancer_context(
     const HierarchyContext *context, const USDExporterContext &export_context) const
 {
@@ -8,6 +8,7 @@
 #include "usd_exporter_context.hh"
 #include "usd_skel_convert.hh"
 
+#include <optional>
 #include <string>
 
 #include <pxr/usd/usd/common.h>
@@ -45,6 +46,10 @@ class USDHierarchyIterator : public AbstractHierarchyIterator {
    * This map is updated by writers during stage export. */
   mutable Map<pxr::SdfPath, Vector<ID *>> exported_prim_map_;
 
+  /* Map a hash of the content of written mesh prims to the path of the first prim written with
+   * that content. This map is updated by mesh writers during stage export. */
+  mutable Map<uint64_t, pxr::SdfPath> mesh_prims_by_content_hash_;
+
   /* Map prototype_paths[instancer path] = [
    *   (proto_path_1, proto_object_1), (proto_path_2, proto_object_2), ... ] */
   Map<pxr::SdfPath, Set<std::pair<pxr::SdfPath, Object *>>> prototype_paths_;
@@ -70,6 +75,11 @@ class USDHierarchyIterator : public AbstractHierarchyIterator {
   /* Add an ID to the prim map for a given USD path. */
   void add_to_prim_map(const pxr::SdfPath &usd_path, const ID *id) const;
 
+  /* Get the path of a previously written mesh prim with the given content hash. If there is
+   * none, the given path is registered for the hash and nullopt is returned. */
+  std::optional<pxr::SdfPath> lookup_or_add_mesh_prim(uint64_t content_hash,
+                                                      const pxr::SdfPath &usd_path) const;
+
  protected:
   bool mark_as_weak_export(const Object *object) const override;
   bool determine_point_instancers(const HierarchyContext *context);
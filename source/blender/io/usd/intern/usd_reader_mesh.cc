@@ -16,6 +16,7 @@
 #include "BKE_attribute.h"
 #include "BKE_attribute.hh"
 #include "BKE_geometry_set.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_material.hh"
 #include "BKE_mesh.hh"
@@ -29,6 +30,7 @@
 #include "BLI_ordered_edge.hh"
 #include "BLI_set.hh"
 #include "BLI_span.hh"
+#include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 
 #include "BLT_translation.hh"
@@ -169,6 +171,10 @@ static void assign_materials(Main *bmain,
 
 }  // namespace utils
 
+/* The number of frames following the current one whose data is read in the background while a
+ * mesh is streamed. Every prefetched frame holds the positions, normals and topology arrays. */
+static constexpr int prefetch_frames_num = 3;
+
 USDMeshReadData::USDMeshReadData(const pxr::UsdGeomMesh &mesh_prim, const pxr::UsdTimeCode time)
 {
   mesh_prim.GetPointsAttr().Get(&positions_, time);
@@ -212,7 +218,15 @@ void USDMeshReader::create_object(Main *bmain)
   object_->data = id_cast<ID *>(mesh);
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const pxr::UsdTimeCode time)
+USDMeshReader::~USDMeshReader()
+{
+  /* The prepared mesh wasn't used because the import was canceled. */
+  if (prepared_mesh_ && object_ && prepared_mesh_ != object_->data) {
+    BKE_id_free(nullptr, prepared_mesh_);
+  }
+}
+
+void USDMeshReader::prepare_object_data(const pxr::UsdTimeCode time)
 {
   Mesh *mesh = id_cast<Mesh *>(object_->data);
 
@@ -220,9 +234,21 @@ void USDMeshReader::read_object_data(Main *bmain, const pxr::UsdTimeCode time)
   const USDMeshReadParams params = create_mesh_read_params(time.GetValue(),
                                                            import_params_.mesh_read_flag);
 
-  Mesh *read_mesh = this->read_mesh(mesh, params, nullptr);
+  prepared_mesh_ = this->read_mesh(mesh, params, nullptr);
 
   is_initial_load_ = false;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const pxr::UsdTimeCode time)
+{
+  Mesh *mesh = id_cast<Mesh *>(object_->data);
+
+  if (!prepared_mesh_) {
+    this->prepare_object_data(time);
+  }
+  Mesh *read_mesh = prepared_mesh_;
+  prepared_mesh_ = nullptr;
+
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
   }
@@ -940,7 +966,9 @@ Mesh *USDMeshReader::read_mesh(Mesh *existing_mesh,
                                const USDMeshReadParams params,
                                const char ** /*r_err_str*/)
 {
-  USDMeshReadData usd_data(mesh_prim_, params.motion_sample_time);
+  USDMeshReadData usd_data = sample_prefetcher_ ?
+                                  sample_prefetcher_->get(params.motion_sample_time) :
+                                  USDMeshReadData(mesh_prim_, params.motion_sample_time);
   if (usd_data.orientation == pxr::UsdGeomTokens->leftHanded) {
     is_left_handed_ = true;
   }
@@ -994,12 +1022,27 @@ void USDMeshReader::read_geometry(bke::GeometrySet &geometry_set,
                                   const USDMeshReadParams params,
                                   const char **r_err_str)
 {
+  if (!sample_prefetcher_ && mesh_prim_.GetPointsAttr().ValueMightBeTimeVarying()) {
+    sample_prefetcher_ = std::make_unique<io::SamplePrefetcher<double, USDMeshReadData>>(
+        [this](const double time) { return USDMeshReadData(mesh_prim_, time); },
+        prefetch_frames_num);
+  }
+
   Mesh *existing_mesh = geometry_set.get_mesh_for_write();
   Mesh *new_mesh = read_mesh(existing_mesh, params, r_err_str);
 
   if (new_mesh != existing_mesh) {
     geometry_set.replace_mesh(new_mesh);
   }
+
+  if (sample_prefetcher_) {
+    /* Assume forward playback, USD time codes are in frames. */
+    Vector<double, prefetch_frames_num> times;
+    for (int i = 1; i <= prefetch_frames_num; i++) {
+      times.append(params.motion_sample_time + i);
+    }
+    sample_prefetcher_->prefetch(times);
+  }
 }
 
 pxr::SdfPath USDMeshReader::get_skeleton_path() const
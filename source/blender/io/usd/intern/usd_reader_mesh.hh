@@ -5,10 +5,14 @@
  * Modifications Copyright 2021 Tangent Animation and. NVIDIA Corporation. All rights reserved. */
 #pragma once
 
+#include <memory>
+
 #include "BLI_map.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_span.hh"
 
+#include "IO_sample_prefetcher.hh"
+
 #include "usd.hh"
 #include "usd_api_modifier.hh"
 #include "usd_reader_geom.hh"
@@ -64,8 +68,17 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_ = false;
 
+  /* The mesh read by #prepare_object_data, which is either the object data itself or a new mesh
+   * not in Main that replaces it in #read_object_data. */
+  Mesh *prepared_mesh_ = nullptr;
+
   Map<const pxr::TfToken, bool> primvar_varying_map_;
 
+  /* Reads the data of the next frames in the background while the mesh is streamed by a cache
+   * modifier, keyed by the time code. Declared last so that it is destructed before the data it
+   * reads from. */
+  std::unique_ptr<io::SamplePrefetcher<double, USDMeshReadData>> sample_prefetcher_;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
@@ -74,12 +87,15 @@ class USDMeshReader : public USDGeomReader {
   {
   }
 
+  ~USDMeshReader() override;
+
   bool valid() const override
   {
     return bool(mesh_prim_);
   }
 
   void create_object(Main *bmain) override;
+  void prepare_object_data(pxr::UsdTimeCode time) override;
   void read_object_data(Main *bmain, pxr::UsdTimeCode time) override;
 
   void read_geometry(bke::GeometrySet &geometry_set,
@@ -95,6 +95,12 @@ class USDPrimReader {
   virtual bool valid() const;
 
   virtual void create_object(Main *bmain) = 0;
+  /**
+   * Read the parts of the object data that don't need access to Main, to be used later by
+   * #read_object_data. Called on all readers in parallel after their objects were created, so
+   * implementations must only modify data owned by the reader and its object data.
+   */
+  virtual void prepare_object_data(pxr::UsdTimeCode /*time*/) {};
   virtual void read_object_data(Main * /*bmain*/, pxr::UsdTimeCode /*time*/) {};
 
   Object *object() const;
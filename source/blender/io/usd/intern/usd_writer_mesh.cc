@@ -43,6 +43,8 @@
 
 #include "CLG_log.h"
 
+#include "xxhash.h"
+
 namespace blender {
 
 static CLG_LogRef LOG = {"io.usd"};
@@ -373,6 +375,12 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context,
   pxr::UsdGeomMesh usd_mesh = pxr::UsdGeomMesh::Define(stage, usd_path);
   write_visibility(context, time, usd_mesh);
 
+  if (this->can_reference_identical_mesh(context) &&
+      this->reference_identical_mesh(context, mesh, subsurfData, usd_mesh))
+  {
+    return;
+  }
+
   USDMeshData usd_mesh_data;
   /* Ensure data exists if currently in edit mode. */
   BKE_mesh_wrapper_ensure_mdata(mesh);
@@ -612,6 +620,92 @@ static void get_vert_creases(const Mesh *mesh, USDMeshData &usd_mesh_data)
   }
 }
 
+bool USDGenericMeshWriter::can_reference_identical_mesh(const HierarchyContext &context) const
+{
+  /* Only static exports are supported, since the referenced mesh would need to be identical at
+   * every frame. Prototypes and instances are handled by the hierarchy iterator already, and their
+   * prims might be moved when processing scene graph instancing. */
+  return usd_export_context_.export_params.use_instancing &&
+         !usd_export_context_.export_params.export_animation &&
+         usd_export_context_.hierarchy_iterator != nullptr && !context.is_instance() &&
+         !context.is_prototype();
+}
+
+/**
+ * Hash everything that is written for the given mesh of the given object, such that meshes with
+ * the same hash can share their data.
+ */
+static uint64_t compute_mesh_content_hash(const Object &object,
+                                          const Mesh &mesh,
+                                          const SubsurfModifierData *subsurfData)
+{
+  XXH3_state_t *state = XXH3_createState();
+  XXH3_64bits_reset(state);
+  auto update = [&](const void *data, const size_t size) {
+    XXH3_64bits_update(state, data, size);
+  };
+
+  update(&mesh.verts_num, sizeof(mesh.verts_num));
+  update(&mesh.edges_num, sizeof(mesh.edges_num));
+  update(&mesh.faces_num, sizeof(mesh.faces_num));
+  update(&mesh.corners_num, sizeof(mesh.corners_num));
+  update(mesh.face_offsets().data(), mesh.face_offsets().size_in_bytes());
+
+  /* All attributes, including positions, topology, UV maps and vertex groups. */
+  mesh.attributes().foreach_attribute([&](const bke::AttributeIter &iter) {
+    update(iter.name.data(), iter.name.size());
+    update(&iter.domain, sizeof(iter.domain));
+    update(&iter.data_type, sizeof(iter.data_type));
+    const GVArraySpan data(*iter.get());
+    update(data.data(), data.size_in_bytes());
+  });
+  const StringRef default_uv_map_name = mesh.default_uv_map_name();
+  update(default_uv_map_name.data(), default_uv_map_name.size());
+
+  /* The materials are bound by path, so identical materials result in identical bindings. */
+  for (const int i : IndexRange(object.totcol)) {
+    const Material *material = BKE_object_material_get(const_cast<Object *>(&object), i + 1);
+    update(&material, sizeof(material));
+  }
+
+  const bool has_subdiv = subsurfData != nullptr;
+  update(&has_subdiv, sizeof(has_subdiv));
+  if (subsurfData) {
+    update(&subsurfData->uv_smooth, sizeof(subsurfData->uv_smooth));
+    update(&subsurfData->boundary_smooth, sizeof(subsurfData->boundary_smooth));
+  }
+
+  const uint64_t hash = XXH3_64bits_digest(state);
+  XXH3_freeState(state);
+  return hash;
+}
+
+bool USDGenericMeshWriter::reference_identical_mesh(const HierarchyContext &context,
+                                                    const Mesh *mesh,
+                                                    const SubsurfModifierData *subsurfData,
+                                                    const pxr::UsdGeomMesh &usd_mesh)
+{
+  /* Ensure data exists if currently in edit mode. */
+  BKE_mesh_wrapper_ensure_mdata(const_cast<Mesh *>(mesh));
+
+  const uint64_t content_hash = compute_mesh_content_hash(*context.object, *mesh, subsurfData);
+  const std::optional<pxr::SdfPath> identical_mesh_path =
+      usd_export_context_.hierarchy_iterator->lookup_or_add_mesh_prim(content_hash,
+                                                                      usd_mesh.GetPath());
+  if (!identical_mesh_path) {
+    return false;
+  }
+
+  if (!usd_mesh.GetPrim().GetReferences().AddInternalReference(*identical_mesh_path)) {
+    CLOG_WARN(&LOG,
+              "Unable to add reference from %s to identical mesh %s, writing mesh data instead",
+              usd_mesh.GetPath().GetAsString().c_str(),
+              identical_mesh_path->GetAsString().c_str());
+    return false;
+  }
+  return true;
+}
+
 void USDGenericMeshWriter::get_geometry_data(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
   get_positions(mesh, usd_mesh_data);
@@ -886,6 +980,13 @@ void USDMeshWriter::do_write(HierarchyContext &context)
   }
 }
 
+bool USDMeshWriter::can_reference_identical_mesh(const HierarchyContext &context) const
+{
+  /* Skinning and blend shapes are written for each mesh prim separately. */
+  return !write_skinned_mesh_ && !write_blend_shapes_ &&
+         USDGenericMeshWriter::can_reference_identical_mesh(context);
+}
+
 Mesh *USDMeshWriter::get_export_mesh(Object *object_eval, bool &r_needsfree)
 {
   if (write_blend_shapes_) {
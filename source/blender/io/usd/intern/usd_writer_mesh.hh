@@ -36,6 +36,12 @@ class USDGenericMeshWriter : public USDAbstractWriter {
   virtual Mesh *get_export_mesh(Object *object_eval, bool &r_needsfree) = 0;
   virtual void free_export_mesh(Mesh *mesh);
 
+  /**
+   * Whether the written mesh prim may reference a previously written mesh prim with identical
+   * content instead of writing the mesh data again.
+   */
+  virtual bool can_reference_identical_mesh(const HierarchyContext &context) const;
+
  private:
   void write_mesh(HierarchyContext &context, Mesh *mesh, const SubsurfModifierData *subsurfData);
   pxr::TfToken get_subdiv_scheme(const SubsurfModifierData *subsurfData);
@@ -43,6 +49,14 @@ class USDGenericMeshWriter : public USDAbstractWriter {
                     const pxr::UsdGeomMesh &usd_mesh,
                     const SubsurfModifierData *subsurfData);
   void get_geometry_data(const Mesh *mesh, struct USDMeshData &usd_mesh_data);
+  /**
+   * Make the mesh prim reference a previously written mesh prim if it has identical content, and
+   * return true if it did. Otherwise, register the mesh prim to be referenced by later ones.
+   */
+  bool reference_identical_mesh(const HierarchyContext &context,
+                                const Mesh *mesh,
+                                const SubsurfModifierData *subsurfData,
+                                const pxr::UsdGeomMesh &usd_mesh);
   void assign_materials(const HierarchyContext &context,
                         const pxr::UsdGeomMesh &usd_mesh,
                         const MaterialFaceGroups &usd_face_groups);
@@ -71,6 +85,8 @@ class USDMeshWriter : public USDGenericMeshWriter {
 
   Mesh *get_export_mesh(Object *object_eval, bool &r_needsfree) override;
 
+  bool can_reference_identical_mesh(const HierarchyContext &context) const override;
+
   /**
    * Determine whether we should write skinned mesh or blend shape data
    * based on the export parameters and the modifiers enabled on the object.
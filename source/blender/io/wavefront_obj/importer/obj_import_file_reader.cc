@@ -15,6 +15,7 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "IO_string_utils.hh"
@@ -178,11 +179,11 @@ static const char *parse_vertex_index(const char *p, const char *end, size_t n_e
 static void geom_add_polyline(Geometry *geom,
                               const char *p,
                               const char *end,
-                              GlobalVertices &r_global_vertices)
+                              const ElementCounts &counts)
 {
   int last_vertex_index;
   p = drop_whitespace(p, end);
-  p = parse_vertex_index(p, end, r_global_vertices.vertices.size(), last_vertex_index);
+  p = parse_vertex_index(p, end, counts.vertices, last_vertex_index);
 
   if (last_vertex_index == INT32_MAX) {
     CLOG_WARN(&LOG, "Skipping invalid OBJ polyline.");
@@ -198,7 +199,7 @@ static void geom_add_polyline(Geometry *geom,
     /* Skip whitespace to get to the next vertex. */
     p = drop_whitespace(p, end);
 
-    p = parse_vertex_index(p, end, r_global_vertices.vertices.size(), vertex_index);
+    p = parse_vertex_index(p, end, counts.vertices, vertex_index);
     if (vertex_index == INT32_MAX) {
       break;
     }
@@ -209,30 +210,19 @@ static void geom_add_polyline(Geometry *geom,
   }
 }
 
-static void geom_add_polygon(Geometry *geom,
-                             const char *p,
-                             const char *end,
-                             const GlobalVertices &global_vertices,
-                             const int material_index,
-                             const int group_index,
-                             const bool shaded_smooth)
+/**
+ * Parse the corners of a face in the forms "f v1 v2 ...", "f v1/vt1 v2/vt2 ...",
+ * "f v1//vn1 v2//vn2 ..." or "f v1/vt1/vn1 v2/vt2/vn2 ...", appending them to the given corners.
+ * Parsing doesn't depend on any previous line of the file, so it can happen in parallel.
+ */
+static void parse_face_corners(const char *p,
+                               const char *end,
+                               Vector<ParsedFaceCorner> &r_face_corners)
 {
-  FaceElem curr_face;
-  curr_face.shaded_smooth = shaded_smooth;
-  curr_face.material_index = material_index;
-  if (group_index >= 0) {
-    curr_face.vertex_group_index = group_index;
-    geom->has_vertex_groups_ = true;
-  }
-
-  const int orig_corners_size = geom->face_corners_.size();
-  curr_face.start_index_ = orig_corners_size;
-
-  bool face_valid = true;
   p = drop_whitespace(p, end);
-  while (p < end && face_valid) {
-    FaceCorner corner;
-    bool got_uv = false, got_normal = false;
+  while (p < end) {
+    ParsedFaceCorner parsed_corner;
+    FaceCorner &corner = parsed_corner.corner;
     /* Parse vertex index. */
     p = parse_int(p, end, INT32_MAX, corner.vert_index, false);
 
@@ -241,68 +231,93 @@ static void geom_add_polygon(Geometry *geom,
       break;
     }
 
-    face_valid &= corner.vert_index != INT32_MAX;
     if (p < end && *p == '/') {
       /* Parse UV index. */
       ++p;
       if (p < end && *p != '/') {
         p = parse_int(p, end, INT32_MAX, corner.uv_vert_index, false);
-        got_uv = corner.uv_vert_index != INT32_MAX;
+        parsed_corner.got_uv = corner.uv_vert_index != INT32_MAX;
       }
       /* Parse normal index. */
       if (p < end && *p == '/') {
         ++p;
         p = parse_int(p, end, INT32_MAX, corner.vertex_normal_index, false);
-        got_normal = corner.vertex_normal_index != INT32_MAX;
+        parsed_corner.got_normal = corner.vertex_normal_index != INT32_MAX;
       }
     }
+    r_face_corners.append(parsed_corner);
+
+    /* Some files contain extra stuff per face (e.g. 4 indices); skip any remainder (#103441). */
+    p = drop_non_whitespace(p, end);
+    /* Skip whitespace to get to the next face corner. */
+    p = drop_whitespace(p, end);
+  }
+}
+
+static void geom_add_polygon(Geometry *geom,
+                             const Span<ParsedFaceCorner> face_corners,
+                             const ElementCounts &counts,
+                             const int material_index,
+                             const int group_index,
+                             const bool shaded_smooth)
+{
+  FaceElem curr_face;
+  curr_face.shaded_smooth = shaded_smooth;
+  curr_face.material_index = material_index;
+  if (group_index >= 0) {
+    curr_face.vertex_group_index = group_index;
+    geom->has_vertex_groups_ = true;
+  }
+
+  const int orig_corners_size = geom->face_corners_.size();
+  curr_face.start_index_ = orig_corners_size;
+
+  bool face_valid = true;
+  for (const ParsedFaceCorner &parsed_corner : face_corners) {
+    FaceCorner corner = parsed_corner.corner;
+    face_valid &= corner.vert_index != INT32_MAX;
     /* Always keep stored indices non-negative and zero-based. */
-    corner.vert_index += corner.vert_index < 0 ? global_vertices.vertices.size() : -1;
-    if (corner.vert_index < 0 || corner.vert_index >= global_vertices.vertices.size()) {
+    corner.vert_index += corner.vert_index < 0 ? counts.vertices : -1;
+    if (corner.vert_index < 0 || corner.vert_index >= counts.vertices) {
       CLOG_WARN(&LOG,
                 "Invalid vertex index %i (valid range [0, %zu)), ignoring face",
                 corner.vert_index,
-                size_t(global_vertices.vertices.size()));
+                size_t(counts.vertices));
       face_valid = false;
     }
     else {
       geom->track_vertex_index(corner.vert_index);
     }
     /* Ignore UV index, if the geometry does not have any UVs (#103212). */
-    if (got_uv && !global_vertices.uv_vertices.is_empty()) {
-      corner.uv_vert_index += corner.uv_vert_index < 0 ? global_vertices.uv_vertices.size() : -1;
-      if (corner.uv_vert_index < 0 || corner.uv_vert_index >= global_vertices.uv_vertices.size()) {
+    if (parsed_corner.got_uv && counts.uv_vertices != 0) {
+      corner.uv_vert_index += corner.uv_vert_index < 0 ? counts.uv_vertices : -1;
+      if (corner.uv_vert_index < 0 || corner.uv_vert_index >= counts.uv_vertices) {
         CLOG_WARN(&LOG,
                   "Invalid UV index %i (valid range [0, %zu)), ignoring face",
                   corner.uv_vert_index,
-                  size_t(global_vertices.uv_vertices.size()));
+                  size_t(counts.uv_vertices));
         face_valid = false;
       }
     }
     /* Ignore corner normal index, if the geometry does not have any normals.
      * Some obj files out there do have face definitions that refer to normal indices,
      * without any normals being present (#98782). */
-    if (got_normal && !global_vertices.vert_normals.is_empty()) {
-      corner.vertex_normal_index += corner.vertex_normal_index < 0 ?
-                                        global_vertices.vert_normals.size() :
-                                        -1;
-      if (corner.vertex_normal_index < 0 ||
-          corner.vertex_normal_index >= global_vertices.vert_normals.size())
-      {
+    if (parsed_corner.got_normal && counts.vert_normals != 0) {
+      corner.vertex_normal_index += corner.vertex_normal_index < 0 ? counts.vert_normals : -1;
+      if (corner.vertex_normal_index < 0 || corner.vertex_normal_index >= counts.vert_normals) {
         CLOG_WARN(&LOG,
                   "Invalid normal index %i (valid range [0, %zu)), ignoring face",
                   corner.vertex_normal_index,
-                  size_t(global_vertices.vert_normals.size()));
+                  size_t(counts.vert_normals));
         face_valid = false;
       }
     }
     geom->face_corners_.append(corner);
     curr_face.corner_count_++;
 
-    /* Some files contain extra stuff per face (e.g. 4 indices); skip any remainder (#103441). */
-    p = drop_non_whitespace(p, end);
-    /* Skip whitespace to get to the next face corner. */
-    p = drop_whitespace(p, end);
+    if (!face_valid) {
+      break;
+    }
   }
 
   if (face_valid) {
@@ -340,7 +355,7 @@ static void geom_set_curve_degree(Geometry *geom, const char *p, const char *end
 static void geom_add_curve_vertex_indices(Geometry *geom,
                                           const char *p,
                                           const char *end,
-                                          const GlobalVertices &global_vertices)
+                                          const ElementCounts &counts)
 {
   /* Parse curve parameter range. */
   p = parse_floats(p, end, 0, geom->nurbs_element_.range, 2);
@@ -352,7 +367,7 @@ static void geom_add_curve_vertex_indices(Geometry *geom,
       return;
     }
     /* Always keep stored indices non-negative and zero-based. */
-    index += index < 0 ? global_vertices.vertices.size() : -1;
+    index += index < 0 ? counts.vertices : -1;
     geom->nurbs_element_.curv_indices.append(index);
   }
 }
@@ -484,16 +499,152 @@ static void use_all_vertices_if_no_faces(Geometry *geom,
   }
 }
 
-size_t OBJParser::parse_string_buffer(StringRef &buffer_str,
-                                      Vector<std::unique_ptr<Geometry>> &r_all_geometries,
-                                      GlobalVertices &r_global_vertices,
-                                      Geometry *&curr_geom,
-                                      bool &state_shaded_smooth,
-                                      string &state_group_name,
-                                      int &state_group_index,
-                                      string &state_material_name,
-                                      int &state_material_index)
+static ElementCounts get_element_counts(const GlobalVertices &global_vertices)
+{
+  return {global_vertices.vertices.size(),
+          global_vertices.uv_vertices.size(),
+          global_vertices.vert_normals.size()};
+}
+
+/**
+ * If the line defines a vertex position, normal or UV, add it to the given vertices and return
+ * true. Vertex data doesn't depend on any previous line of the file, so it can be parsed in
+ * parallel.
+ */
+static bool parse_vertex_data_line(const char *p, const char *end, GlobalVertices &r_vertices)
+{
+  /* Most common things that start with 'v': vertices, normals, UVs. */
+  if (*p != 'v') {
+    return false;
+  }
+  if (parse_keyword(p, end, "v")) {
+    geom_add_vertex(p, end, r_vertices);
+  }
+  else if (parse_keyword(p, end, "vn")) {
+    geom_add_vertex_normal(p, end, r_vertices);
+  }
+  else if (parse_keyword(p, end, "vt")) {
+    geom_add_uv_vertex(p, end, r_vertices);
+  }
+  return true;
+}
+
+void OBJParser::parse_element_line(const char *p,
+                                   const char *end,
+                                   const ElementCounts &counts,
+                                   const Span<ParsedFaceCorner> face_corners,
+                                   Vector<std::unique_ptr<Geometry>> &r_all_geometries,
+                                   GlobalVertices &r_global_vertices,
+                                   State &state)
+{
+  /* Faces. */
+  if (parse_keyword(p, end, "f")) {
+    /* If we don't have a material index assigned yet, get one.
+     * It means "usemtl" state came from the previous object. */
+    if (state.material_index == -1 && !state.material_name.empty() &&
+        state.curr_geom->material_indices_.is_empty())
+    {
+      state.curr_geom->material_indices_.add_new(state.material_name, 0);
+      state.curr_geom->material_order_.append(state.material_name);
+      state.material_index = 0;
+    }
+
+    geom_add_polygon(state.curr_geom,
+                     face_corners,
+                     counts,
+                     state.material_index,
+                     state.group_index,
+                     state.shaded_smooth);
+  }
+  /* Faces. */
+  else if (parse_keyword(p, end, "l")) {
+    geom_add_polyline(state.curr_geom, p, end, counts);
+  }
+  /* Objects. */
+  else if (parse_keyword(p, end, "o")) {
+    if (import_params_.use_split_objects) {
+      geom_new_object(p,
+                      end,
+                      state.shaded_smooth,
+                      state.group_name,
+                      state.material_index,
+                      state.curr_geom,
+                      r_all_geometries);
+    }
+  }
+  /* Groups. */
+  else if (parse_keyword(p, end, "g")) {
+    if (import_params_.use_split_groups) {
+      geom_new_object(p,
+                      end,
+                      state.shaded_smooth,
+                      state.group_name,
+                      state.material_index,
+                      state.curr_geom,
+                      r_all_geometries);
+    }
+    else {
+      geom_update_group(StringRef(p, end).trim(), state.group_name);
+      int new_index = state.curr_geom->group_indices_.size();
+      state.group_index = state.curr_geom->group_indices_.lookup_or_add(state.group_name,
+                                                                        new_index);
+      if (new_index == state.group_index) {
+        state.curr_geom->group_order_.append(state.group_name);
+      }
+    }
+  }
+  /* Smoothing groups. */
+  else if (parse_keyword(p, end, "s")) {
+    geom_update_smooth_group(p, end, state.shaded_smooth);
+  }
+  /* Materials and their libraries. */
+  else if (parse_keyword(p, end, "usemtl")) {
+    state.material_name = StringRef(p, end).trim();
+    int new_mat_index = state.curr_geom->material_indices_.size();
+    state.material_index = state.curr_geom->material_indices_.lookup_or_add(state.material_name,
+                                                                            new_mat_index);
+    if (new_mat_index == state.material_index) {
+      state.curr_geom->material_order_.append(state.material_name);
+    }
+  }
+  else if (parse_keyword(p, end, "mtllib")) {
+    add_mtl_library(StringRef(p, end).trim());
+  }
+  else if (parse_keyword(p, end, "#MRGB")) {
+    geom_add_mrgb_colors(p, end, r_global_vertices);
+  }
+  /* Comments. */
+  else if (*p == '#') {
+    /* Nothing to do. */
+  }
+  /* Curve related things. */
+  else if (parse_keyword(p, end, "cstype")) {
+    state.curr_geom = geom_set_curve_type(
+        state.curr_geom, p, end, state.group_name, r_all_geometries);
+  }
+  else if (parse_keyword(p, end, "deg")) {
+    geom_set_curve_degree(state.curr_geom, p, end);
+  }
+  else if (parse_keyword(p, end, "curv")) {
+    geom_add_curve_vertex_indices(state.curr_geom, p, end, counts);
+  }
+  else if (parse_keyword(p, end, "parm")) {
+    geom_add_curve_parameters(state.curr_geom, p, end);
+  }
+  else if (StringRef(p, end).startswith("end")) {
+    /* End of curve definition, nothing else to do. */
+  }
+  else {
+    CLOG_WARN(&LOG, "OBJ element not recognized: '%s'", string(p, end).c_str());
+  }
+}
+
+size_t OBJParser::parse_string_buffer_serial(StringRef buffer_str,
+                                             Vector<std::unique_ptr<Geometry>> &r_all_geometries,
+                                             GlobalVertices &r_global_vertices,
+                                             State &state)
 {
+  Vector<ParsedFaceCorner> face_corners;
   size_t read_lines_num = 0;
   while (!buffer_str.is_empty()) {
     StringRef line = read_next_line(buffer_str);
@@ -503,117 +654,170 @@ size_t OBJParser::parse_string_buffer(StringRef &buffer_str,
     if (p == end) {
       continue;
     }
-    /* Most common things that start with 'v': vertices, normals, UVs. */
-    if (*p == 'v') {
-      if (parse_keyword(p, end, "v")) {
-        geom_add_vertex(p, end, r_global_vertices);
-      }
-      else if (parse_keyword(p, end, "vn")) {
-        geom_add_vertex_normal(p, end, r_global_vertices);
-      }
-      else if (parse_keyword(p, end, "vt")) {
-        geom_add_uv_vertex(p, end, r_global_vertices);
-      }
+    if (parse_vertex_data_line(p, end, r_global_vertices)) {
+      continue;
     }
-    /* Faces. */
-    else if (parse_keyword(p, end, "f")) {
-      /* If we don't have a material index assigned yet, get one.
-       * It means "usemtl" state came from the previous object. */
-      if (state_material_index == -1 && !state_material_name.empty() &&
-          curr_geom->material_indices_.is_empty())
-      {
-        curr_geom->material_indices_.add_new(state_material_name, 0);
-        curr_geom->material_order_.append(state_material_name);
-        state_material_index = 0;
-      }
 
-      geom_add_polygon(curr_geom,
-                       p,
+    face_corners.clear();
+    const char *face_p = p;
+    if (parse_keyword(face_p, end, "f")) {
+      parse_face_corners(face_p, end, face_corners);
+    }
+    parse_element_line(p,
                        end,
+                       get_element_counts(r_global_vertices),
+                       face_corners,
+                       r_all_geometries,
                        r_global_vertices,
-                       state_material_index,
-                       state_group_index,
-                       state_shaded_smooth);
-    }
-    /* Faces. */
-    else if (parse_keyword(p, end, "l")) {
-      geom_add_polyline(curr_geom, p, end, r_global_vertices);
-    }
-    /* Objects. */
-    else if (parse_keyword(p, end, "o")) {
-      if (import_params_.use_split_objects) {
-        geom_new_object(p,
-                        end,
-                        state_shaded_smooth,
-                        state_group_name,
-                        state_material_index,
-                        curr_geom,
-                        r_all_geometries);
-      }
-    }
-    /* Groups. */
-    else if (parse_keyword(p, end, "g")) {
-      if (import_params_.use_split_groups) {
-        geom_new_object(p,
-                        end,
-                        state_shaded_smooth,
-                        state_group_name,
-                        state_material_index,
-                        curr_geom,
-                        r_all_geometries);
-      }
-      else {
-        geom_update_group(StringRef(p, end).trim(), state_group_name);
-        int new_index = curr_geom->group_indices_.size();
-        state_group_index = curr_geom->group_indices_.lookup_or_add(state_group_name, new_index);
-        if (new_index == state_group_index) {
-          curr_geom->group_order_.append(state_group_name);
-        }
-      }
-    }
-    /* Smoothing groups. */
-    else if (parse_keyword(p, end, "s")) {
-      geom_update_smooth_group(p, end, state_shaded_smooth);
-    }
-    /* Materials and their libraries. */
-    else if (parse_keyword(p, end, "usemtl")) {
-      state_material_name = StringRef(p, end).trim();
-      int new_mat_index = curr_geom->material_indices_.size();
-      state_material_index = curr_geom->material_indices_.lookup_or_add(state_material_name,
-                                                                        new_mat_index);
-      if (new_mat_index == state_material_index) {
-        curr_geom->material_order_.append(state_material_name);
-      }
+                       state);
+  }
+  return read_lines_num;
+}
+
+/**
+ * A line of a #ParsedChunk that doesn't define vertex data.
+ */
+struct ParsedLine {
+  /* The line starting from its first non-whitespace character. */
+  StringRef line;
+  /* The counts of the vertex data defined in the chunk before the line. */
+  ElementCounts counts;
+  /* The range of the corners of the line in the face corners of the chunk if it is a face. */
+  IndexRange face_corners;
+};
+
+/**
+ * A chunk of whole lines of the OBJ file. All vertex data and face corners of the chunk are
+ * parsed independently of other chunks, leaving only the lines that depend on the parser state
+ * to be parsed in order.
+ */
+struct ParsedChunk {
+  StringRef text;
+  GlobalVertices vertices;
+  Vector<ParsedFaceCorner> face_corners;
+  /* The lines other than vertex data, empty lines and comments, in the order of the file. */
+  Vector<ParsedLine> lines;
+  size_t lines_num = 0;
+  /* The chunk contains #MRGB colors, which apply to vertices of previous chunks. The chunk is
+   * thus parsed serially instead, which is fine since the extension is rarely used. */
+  bool parse_serially = false;
+};
+
+static void parse_chunk(ParsedChunk &chunk)
+{
+  StringRef buffer_str = chunk.text;
+  while (!buffer_str.is_empty()) {
+    StringRef line = read_next_line(buffer_str);
+    const char *p = line.begin(), *end = line.end();
+    p = drop_whitespace(p, end);
+    ++chunk.lines_num;
+    if (p == end) {
+      continue;
     }
-    else if (parse_keyword(p, end, "mtllib")) {
-      add_mtl_library(StringRef(p, end).trim());
+    if (parse_vertex_data_line(p, end, chunk.vertices)) {
+      continue;
     }
-    else if (parse_keyword(p, end, "#MRGB")) {
-      geom_add_mrgb_colors(p, end, r_global_vertices);
+
+    const char *keyword_p = p;
+    if (parse_keyword(keyword_p, end, "#MRGB")) {
+      chunk.parse_serially = true;
+      return;
     }
     /* Comments. */
-    else if (*p == '#') {
-      /* Nothing to do. */
-    }
-    /* Curve related things. */
-    else if (parse_keyword(p, end, "cstype")) {
-      curr_geom = geom_set_curve_type(curr_geom, p, end, state_group_name, r_all_geometries);
-    }
-    else if (parse_keyword(p, end, "deg")) {
-      geom_set_curve_degree(curr_geom, p, end);
+    if (*p == '#') {
+      continue;
     }
-    else if (parse_keyword(p, end, "curv")) {
-      geom_add_curve_vertex_indices(curr_geom, p, end, r_global_vertices);
+
+    ParsedLine parsed_line;
+    parsed_line.line = StringRef(p, end);
+    parsed_line.counts = get_element_counts(chunk.vertices);
+    if (parse_keyword(keyword_p, end, "f")) {
+      const int64_t corners_start = chunk.face_corners.size();
+      parse_face_corners(keyword_p, end, chunk.face_corners);
+      parsed_line.face_corners = IndexRange::from_begin_end(corners_start,
+                                                            chunk.face_corners.size());
     }
-    else if (parse_keyword(p, end, "parm")) {
-      geom_add_curve_parameters(curr_geom, p, end);
+    chunk.lines.append(parsed_line);
+  }
+}
+
+/**
+ * Append the vertex data of a chunk to the global vertices, after the ones of previous chunks.
+ */
+static void append_chunk_vertices(GlobalVertices &chunk_vertices,
+                                  GlobalVertices &r_global_vertices)
+{
+  if (chunk_vertices.vertices.is_empty()) {
+    r_global_vertices.uv_vertices.extend(chunk_vertices.uv_vertices);
+    r_global_vertices.vert_normals.extend(chunk_vertices.vert_normals);
+    return;
+  }
+
+  /* Pending #MRGB colors apply to the vertices defined before the first vertex of the chunk. */
+  r_global_vertices.flush_mrgb_block();
+
+  const int64_t vertices_offset = r_global_vertices.vertices.size();
+  if (!chunk_vertices.vertex_colors.is_empty()) {
+    r_global_vertices.vertex_colors.resize(vertices_offset, float3(-1.0, -1.0, -1.0));
+    r_global_vertices.vertex_colors.extend(chunk_vertices.vertex_colors);
+  }
+  if (!chunk_vertices.vertex_weights.is_empty()) {
+    r_global_vertices.vertex_weights.resize(vertices_offset, 1.0);
+    r_global_vertices.vertex_weights.extend(chunk_vertices.vertex_weights);
+  }
+  r_global_vertices.vertices.extend(chunk_vertices.vertices);
+  r_global_vertices.uv_vertices.extend(chunk_vertices.uv_vertices);
+  r_global_vertices.vert_normals.extend(chunk_vertices.vert_normals);
+}
+
+size_t OBJParser::parse_string_buffer(StringRef buffer_str,
+                                      Vector<std::unique_ptr<Geometry>> &r_all_geometries,
+                                      GlobalVertices &r_global_vertices,
+                                      State &state)
+{
+  /* Split the buffer into chunks of whole lines. The chunk size is relative to the buffer size
+   * such that large buffers are parsed by many threads. */
+  const int64_t chunk_size = std::max<int64_t>(read_buffer_size_ / 128, 1);
+  Vector<ParsedChunk> chunks;
+  while (!buffer_str.is_empty()) {
+    const int64_t newline = buffer_str.find('\n', std::min(chunk_size, buffer_str.size()) - 1);
+    const int64_t chunk_end = newline == StringRef::not_found ? buffer_str.size() : newline + 1;
+    chunks.append_as();
+    chunks.last().text = buffer_str.substr(0, chunk_end);
+    buffer_str = buffer_str.drop_prefix(chunk_end);
+  }
+
+  threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      parse_chunk(chunks[i]);
     }
-    else if (StringRef(p, end).startswith("end")) {
-      /* End of curve definition, nothing else to do. */
+  });
+
+  /* Add the elements of the chunks in order, resolving the indices of the elements against the
+   * vertex data of all previous chunks. */
+  size_t read_lines_num = 0;
+  for (ParsedChunk &chunk : chunks) {
+    if (chunk.parse_serially) {
+      read_lines_num += parse_string_buffer_serial(
+          chunk.text, r_all_geometries, r_global_vertices, state);
+      continue;
     }
-    else {
-      CLOG_WARN(&LOG, "OBJ element not recognized: '%s'", string(p, end).c_str());
+
+    const ElementCounts offsets = get_element_counts(r_global_vertices);
+    append_chunk_vertices(chunk.vertices, r_global_vertices);
+    for (const ParsedLine &parsed_line : chunk.lines) {
+      const ElementCounts counts = {offsets.vertices + parsed_line.counts.vertices,
+                                    offsets.uv_vertices + parsed_line.counts.uv_vertices,
+                                    offsets.vert_normals + parsed_line.counts.vert_normals};
+      parse_element_line(parsed_line.line.begin(),
+                         parsed_line.line.end(),
+                         counts,
+                         chunk.face_corners.as_span().slice(parsed_line.face_corners),
+                         r_all_geometries,
+                         r_global_vertices,
+                         state);
     }
+    read_lines_num += chunk.lines_num;
   }
   return read_lines_num;
 }
@@ -630,15 +834,10 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
   STRNCPY(ob_name, BLI_path_basename(import_params_.filepath));
   BLI_path_extension_strip(ob_name);
 
-  Geometry *curr_geom = create_geometry(nullptr, GEOM_MESH, ob_name, r_all_geometries);
-
   /* State variables: once set, they remain the same for the remaining
    * elements in the object. */
-  bool state_shaded_smooth = false;
-  string state_group_name;
-  int state_group_index = -1;
-  string state_material_name;
-  int state_material_index = -1;
+  State state;
+  state.curr_geom = create_geometry(nullptr, GEOM_MESH, ob_name, r_all_geometries);
 
   /* Read the input file in chunks. We need up to twice the possible chunk size,
    * to possibly store remainder of the previous input line that got broken mid-chunk. */
@@ -692,15 +891,8 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
     /* Parse the buffer (until last newline) that we have so far,
      * line by line. */
     StringRef buffer_str{buffer.data(), int64_t(last_nl)};
-    line_number += OBJParser::parse_string_buffer(buffer_str,
-                                                  r_all_geometries,
-                                                  r_global_vertices,
-                                                  curr_geom,
-                                                  state_shaded_smooth,
-                                                  state_group_name,
-                                                  state_group_index,
-                                                  state_material_name,
-                                                  state_material_index);
+    line_number += OBJParser::parse_string_buffer(
+        buffer_str, r_all_geometries, r_global_vertices, state);
 
     /* We might have a line that was cut in the middle by the previous buffer;
      * copy it over for next chunk reading. */
@@ -710,7 +902,7 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
   }
 
   r_global_vertices.flush_mrgb_block();
-  use_all_vertices_if_no_faces(curr_geom, r_all_geometries, r_global_vertices);
+  use_all_vertices_if_no_faces(state.curr_geom, r_all_geometries, r_global_vertices);
   add_default_mtl_library();
 }
 
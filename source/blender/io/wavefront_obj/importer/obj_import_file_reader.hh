@@ -11,6 +11,7 @@
 #include "IO_wavefront_obj.hh"
 
 #include "BLI_map.hh"
+#include "BLI_span.hh"
 #include "BLI_vector.hh"
 
 #include "obj_import_objects.hh"
@@ -19,6 +20,26 @@ namespace blender::io::obj {
 
 struct MTLMaterial;
 
+/**
+ * Number of vertex positions, UV vertices and normals defined before some line of the OBJ file.
+ * Relative and one-based indices of faces, polylines and curves are resolved against them.
+ */
+struct ElementCounts {
+  int64_t vertices = 0;
+  int64_t uv_vertices = 0;
+  int64_t vert_normals = 0;
+};
+
+/**
+ * A face corner as it is written in the OBJ file, its indices are not yet transformed to be
+ * non-negative and zero-based.
+ */
+struct ParsedFaceCorner {
+  FaceCorner corner;
+  bool got_uv = false;
+  bool got_normal = false;
+};
+
 /* NOTE: the OBJ parser implementation is planned to get fairly large changes "soon",
  * so don't read too much into current implementation... */
 class OBJParser {
@@ -47,17 +68,48 @@ class OBJParser {
   Span<std::string> mtl_libraries() const;
 
  private:
+  /**
+   * State carried over from line to line: once set, it applies to all following elements in the
+   * file until changed.
+   */
+  struct State {
+    Geometry *curr_geom = nullptr;
+    bool shaded_smooth = false;
+    std::string group_name;
+    int group_index = -1;
+    std::string material_name;
+    int material_index = -1;
+  };
+
   void add_mtl_library(StringRef path);
   void add_default_mtl_library();
-  size_t parse_string_buffer(StringRef &buffer_str,
+  /**
+   * Split the given lines into chunks that are parsed in parallel, then add the parsed elements
+   * of the chunks in order. Returns the number of parsed lines.
+   */
+  size_t parse_string_buffer(StringRef buffer_str,
                              Vector<std::unique_ptr<Geometry>> &r_all_geometries,
                              GlobalVertices &r_global_vertices,
-                             Geometry *&curr_geom,
-                             bool &state_shaded_smooth,
-                             std::string &state_group_name,
-                             int &state_group_index,
-                             std::string &state_material_name,
-                             int &state_material_index);
+                             State &state);
+  /**
+   * Parse the given lines one after the other. Returns the number of parsed lines.
+   */
+  size_t parse_string_buffer_serial(StringRef buffer_str,
+                                    Vector<std::unique_ptr<Geometry>> &r_all_geometries,
+                                    GlobalVertices &r_global_vertices,
+                                    State &state);
+  /**
+   * Parse a line that doesn't define vertex data, where p points to its first non-whitespace
+   * character. The counts are those of the elements defined before the line, and the corners of
+   * face lines are expected to be parsed already.
+   */
+  void parse_element_line(const char *p,
+                          const char *end,
+                          const ElementCounts &counts,
+                          Span<ParsedFaceCorner> face_corners,
+                          Vector<std::unique_ptr<Geometry>> &r_all_geometries,
+                          GlobalVertices &r_global_vertices,
+                          State &state);
 };
 
 class MTLParser {
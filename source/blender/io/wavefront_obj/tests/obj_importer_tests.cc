@@ -15,7 +15,7 @@
 namespace blender::io::obj {
 
 /* Extensive tests for OBJ importing are in `io_obj_import_test.py`.
- * The tests here are only for testing OBJ reader buffer refill behavior,
+ * The tests here are only for testing OBJ reader buffer refill and chunked parsing behavior,
  * by using a very small buffer size on purpose. */
 
 TEST(obj_import, BufferRefillTest)
@@ -45,4 +45,37 @@ TEST(obj_import, BufferRefillTest)
   CLG_exit();
 }
 
+TEST(obj_import, ChunkedParsingTest)
+{
+  CLG_init();
+
+  OBJImportParams params;
+  std::string obj_path = tests::flags_test_asset_dir() + SEP_STR "io_tests" SEP_STR "obj" SEP_STR +
+                         "nurbs_cyclic.obj";
+  STRNCPY(params.filepath, obj_path.c_str());
+
+  /* A large read buffer parses the whole file as a single chunk, while a small one splits it into
+   * many chunks that are parsed in parallel, so the results should be identical. */
+  Vector<std::unique_ptr<Geometry>> single_chunk_geometries;
+  GlobalVertices single_chunk_vertices;
+  OBJParser single_chunk_parser{params, 1024 * 1024};
+  single_chunk_parser.parse(single_chunk_geometries, single_chunk_vertices);
+
+  Vector<std::unique_ptr<Geometry>> chunked_geometries;
+  GlobalVertices chunked_vertices;
+  OBJParser chunked_parser{params, 650};
+  chunked_parser.parse(chunked_geometries, chunked_vertices);
+
+  ASSERT_EQ(single_chunk_geometries.size(), chunked_geometries.size());
+  EXPECT_EQ(single_chunk_vertices.vertices.as_span(), chunked_vertices.vertices.as_span());
+  for (const int i : single_chunk_geometries.index_range()) {
+    EXPECT_EQ(single_chunk_geometries[i]->nurbs_element_.curv_indices.as_span(),
+              chunked_geometries[i]->nurbs_element_.curv_indices.as_span());
+    EXPECT_EQ(single_chunk_geometries[i]->nurbs_element_.parm.as_span(),
+              chunked_geometries[i]->nurbs_element_.parm.as_span());
+  }
+
+  CLG_exit();
+}
+
 }  // namespace blender::io::obj
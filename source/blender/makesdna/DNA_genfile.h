@@ -153,6 +153,25 @@ void *DNA_struct_reconstruct(const struct DNA_ReconstructInfo *reconstruct_info,
                              int blocks,
                              const void *old_blocks,
                              const char *alloc_name);
+/**
+ * Allocate the zero-initialized memory for reconstructing \a blocks structs, to be filled with
+ * #DNA_struct_reconstruct_blocks. Returns null if the struct does not exist anymore.
+ */
+void *DNA_struct_reconstruct_alloc(const struct DNA_ReconstructInfo *reconstruct_info,
+                                   int old_struct_index,
+                                   int blocks,
+                                   const char *alloc_name);
+/**
+ * Reconstruct the array elements `[block_start, block_start + blocks)` of \a old_blocks into
+ * \a new_blocks, which was allocated with #DNA_struct_reconstruct_alloc. Different ranges of the
+ * same array can be reconstructed from multiple threads at the same time.
+ */
+void DNA_struct_reconstruct_blocks(const struct DNA_ReconstructInfo *reconstruct_info,
+                                   int old_struct_index,
+                                   int block_start,
+                                   int blocks,
+                                   const void *old_blocks,
+                                   void *new_blocks);
 
 /**
  * A version of #DNA_struct_member_offset_by_name_with_alias that uses the non-aliased name.
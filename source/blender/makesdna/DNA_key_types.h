@@ -18,6 +18,15 @@ namespace blender {
 
 struct AnimData;
 
+#ifdef __cplusplus
+namespace bke {
+struct KeyBlockRuntime;
+}  // namespace bke
+using KeyBlockRuntime = bke::KeyBlockRuntime;
+#else
+typedef struct KeyBlockRuntime KeyBlockRuntime;
+#endif
+
 /* Key::type: KeyBlocks are interpreted as... */
 enum ShapekeyContainerType {
   /* Sequential positions over time (using KeyBlock::pos and Key::ctime) */
@@ -100,6 +109,9 @@ struct KeyBlock {
   /** Ranges, for RNA and UI only to clamp 'curval'. */
   float slidermin = 0;
   float slidermax = 0;
+
+  /** Only allocated for copies of keys, like evaluated ones. */
+  KeyBlockRuntime *runtime = nullptr;
 };
 
 struct Key {
@@ -740,7 +740,7 @@ enum {
   R_SIMPLIFY = 1 << 24,
   R_EDGE_FRS = 1 << 25,        /* R_EDGE reserved for Freestyle */
   R_PERSISTENT_DATA = 1 << 26, /* Keep data around for re-render. */
-  R_MODE_UNUSED_27 = 1 << 27,  /* cleared */
+  R_SAVE_BACKGROUND = 1 << 27, /* Save animation frames while the next frame renders. */
   R_SAVE_OUTPUT = 1 << 28,
 };
 
@@ -531,6 +531,8 @@ enum eUserpref_SeqProxySetup {
 enum eUserpref_SeqEditorFlags {
   USER_SEQ_ED_UNUSED_0 = (1 << 0), /* Dirty. */
   USER_SEQ_ED_CONNECT_STRIPS_BY_DEFAULT = (1 << 1),
+  USER_SEQ_ED_HARDWARE_DECODING = (1 << 2),
+  USER_SEQ_ED_DISK_CACHE = (1 << 3),
 };
 
 enum eUserpref_ShaderCompileMethod {
@@ -808,6 +810,11 @@ struct UserDef_Experimental {
   char write_legacy_blend_file_format = 0;
   char no_data_block_packing = 0;
   char use_paint_debug = 0;
+  char use_parallel_blend_write = 0;
+  char use_async_autosave = 0;
+  char use_depsgraph_critical_path_scheduling = 0;
+  char use_geometry_nodes_result_cache = 0;
+  char use_sculpt_undo_paging = 0;
   char SANITIZE_AFTER_HERE = {};
   /* The following options are automatically sanitized (set to 0)
    * when the release cycle is not alpha. */
@@ -818,7 +825,7 @@ struct UserDef_Experimental {
   char use_geometry_nodes_lists = 0;
   char use_geometry_bundle = 0;
   char use_remote_asset_libraries = 0;
-  char _pad[3] = {};
+  char _pad[6] = {};
 };
 
 #define USER_EXPERIMENTAL_TEST(userdef, member) (((userdef)->experimental).member)
@@ -1053,7 +1060,8 @@ struct UserDef {
   int prefetchframes = 0;
   /** Control the rotation step of the view when PAD2, PAD4, PAD6&PAD8 is use. */
   float pad_rot_angle = 15;
-  char _pad12[4] = {};
+  /** GPU memory limit for image textures in MiB, 0 for no limit. */
+  int texmemlimit = 0;
   /** Rotating view icon size. */
   short rvisize = 25;
   /** Rotating view icon brightness. */
@@ -1202,10 +1210,15 @@ struct UserDef {
       USER_TEMP_SPACE_DISPLAY_WINDOW; /* eUserpref_TempSpaceDisplayType */
   char preferences_display_type =
       USER_TEMP_SPACE_DISPLAY_WINDOW; /* eUserpref_TempSpaceDisplayType */
-  char _pad18[7] = {};
+  /** #eUserpref_DiskCacheCompression. */
+  char sequencer_disk_cache_compression = USER_SEQ_DISK_CACHE_COMPRESSION_LOW;
+  /** Number of sequencer proxies that are built at the same time. */
+  char sequencer_proxy_build_jobs = 2;
+  char _pad18[5] = {};
 
   short sequencer_proxy_setup = USER_SEQ_PROXY_SETUP_AUTOMATIC; /* eUserpref_SeqProxySetup */
-  short _pad1 = {};
+  /** Maximum size of the sequencer disk cache in GiB. */
+  short sequencer_disk_cache_size_limit = 100;
 
   float collection_instance_empty_size = 1.0f;
   char text_flag = 0;
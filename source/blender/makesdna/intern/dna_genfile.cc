@@ -1142,6 +1142,8 @@ struct DNA_ReconstructInfo {
 
   int *step_counts;
   ReconstructStep **steps;
+  /** Index of the matching struct in #newsdna for every struct in #oldsdna, or -1. */
+  int *new_struct_index_by_old;
 };
 
 static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
@@ -1229,24 +1231,19 @@ static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
   const int new_block_size = reconstruct_info->newsdna->types_size[new_struct->type_index];
 
   for (int a = 0; a < blocks; a++) {
-    const char *old_block = old_blocks + a * old_block_size;
-    char *new_block = new_blocks + a * new_block_size;
+    const char *old_block = old_blocks + int64_t(a) * old_block_size;
+    char *new_block = new_blocks + int64_t(a) * new_block_size;
     reconstruct_struct(reconstruct_info, new_struct_index, old_block, new_block);
   }
 }
 
-void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
-                             int old_struct_index,
-                             int blocks,
-                             const void *old_blocks,
-                             const char *alloc_name)
+void *DNA_struct_reconstruct_alloc(const DNA_ReconstructInfo *reconstruct_info,
+                                   const int old_struct_index,
+                                   const int blocks,
+                                   const char *alloc_name)
 {
-  const SDNA *oldsdna = reconstruct_info->oldsdna;
   const SDNA *newsdna = reconstruct_info->newsdna;
-
-  const SDNA_Struct *old_struct = oldsdna->structs[old_struct_index];
-  const char *type_name = oldsdna->types[old_struct->type_index];
-  const int new_struct_index = DNA_struct_find_index_without_alias(newsdna, type_name);
+  const int new_struct_index = reconstruct_info->new_struct_index_by_old[old_struct_index];
 
   if (new_struct_index == -1) {
     return nullptr;
@@ -1256,14 +1253,47 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
   const int new_block_size = newsdna->types_size[new_struct->type_index];
 
   const int alignment = DNA_struct_alignment(newsdna, new_struct_index);
-  char *new_blocks = static_cast<char *>(
-      MEM_new_array_zeroed_aligned(new_block_size, blocks, alignment, alloc_name));
+  return MEM_new_array_zeroed_aligned(new_block_size, blocks, alignment, alloc_name);
+}
+
+void DNA_struct_reconstruct_blocks(const DNA_ReconstructInfo *reconstruct_info,
+                                   const int old_struct_index,
+                                   const int block_start,
+                                   const int blocks,
+                                   const void *old_blocks,
+                                   void *new_blocks)
+{
+  const SDNA *oldsdna = reconstruct_info->oldsdna;
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  const int new_struct_index = reconstruct_info->new_struct_index_by_old[old_struct_index];
+  BLI_assert(new_struct_index != -1);
+
+  const SDNA_Struct *old_struct = oldsdna->structs[old_struct_index];
+  const SDNA_Struct *new_struct = newsdna->structs[new_struct_index];
+  const int64_t old_block_size = oldsdna->types_size[old_struct->type_index];
+  const int64_t new_block_size = newsdna->types_size[new_struct->type_index];
+
   reconstruct_structs(reconstruct_info,
                       blocks,
                       old_struct_index,
                       new_struct_index,
-                      static_cast<const char *>(old_blocks),
-                      new_blocks);
+                      static_cast<const char *>(old_blocks) + block_start * old_block_size,
+                      static_cast<char *>(new_blocks) + block_start * new_block_size);
+}
+
+void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
+                             int old_struct_index,
+                             int blocks,
+                             const void *old_blocks,
+                             const char *alloc_name)
+{
+  void *new_blocks = DNA_struct_reconstruct_alloc(
+      reconstruct_info, old_struct_index, blocks, alloc_name);
+  if (new_blocks == nullptr) {
+    return nullptr;
+  }
+  DNA_struct_reconstruct_blocks(
+      reconstruct_info, old_struct_index, 0, blocks, old_blocks, new_blocks);
   return new_blocks;
 }
 
@@ -1557,6 +1587,16 @@ DNA_ReconstructInfo *DNA_reconstruct_info_create(const SDNA *oldsdna,
                                                                    __func__);
   reconstruct_info->steps = MEM_new_array_uninitialized<ReconstructStep *>(
       size_t(newsdna->structs_num), __func__);
+  reconstruct_info->new_struct_index_by_old = MEM_new_array_uninitialized<int>(
+      size_t(oldsdna->structs_num), __func__);
+
+  /* Resolve the matching struct once, instead of looking it up by name for every block. */
+  for (int old_struct_index = 0; old_struct_index < oldsdna->structs_num; old_struct_index++) {
+    const SDNA_Struct *old_struct = oldsdna->structs[old_struct_index];
+    const char *old_struct_name = oldsdna->types[old_struct->type_index];
+    reconstruct_info->new_struct_index_by_old[old_struct_index] =
+        DNA_struct_find_index_without_alias(newsdna, old_struct_name);
+  }
 
   /* Generate reconstruct steps for all structs. */
   for (int new_struct_index = 0; new_struct_index < newsdna->structs_num; new_struct_index++) {
@@ -1603,6 +1643,7 @@ void DNA_reconstruct_info_free(DNA_ReconstructInfo *reconstruct_info)
   }
   MEM_delete(reconstruct_info->steps);
   MEM_delete(reconstruct_info->step_counts);
+  MEM_delete(reconstruct_info->new_struct_index_by_old);
   MEM_delete(reconstruct_info);
 }
 
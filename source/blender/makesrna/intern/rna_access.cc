@@ -5558,8 +5558,40 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Convert the values while iterating over the raw array, without going through the RNA
+       * accessors of every item. */
+      const bool use_float = ELEM(in.type, PROP_RAW_FLOAT, PROP_RAW_DOUBLE) ||
+                             ELEM(out.type, PROP_RAW_FLOAT, PROP_RAW_DOUBLE);
+      RawArray item = out;
+      for (int a = 0; a < out.len; a++) {
+        item.array = static_cast<char *>(out.array) + size_t(a) * out.stride;
+        for (int j = 0; j < item_len; j++) {
+          const int in_index = a * item_len + j;
+          if (use_float) {
+            double value;
+            if (set) {
+              RAW_GET(double, value, in, in_index);
+              RAW_SET(double, item, j, value);
+            }
+            else {
+              RAW_GET(double, value, item, j);
+              RAW_SET(double, in, in_index, value);
+            }
+          }
+          else {
+            int64_t value;
+            if (set) {
+              RAW_GET(int64_t, value, in, in_index);
+              RAW_SET(int64_t, item, j, value);
+            }
+            else {
+              RAW_GET(int64_t, value, item, j);
+              RAW_SET(int64_t, in, in_index, value);
+            }
+          }
+        }
+      }
+      return 1;
     }
     BLI_assert_msg(array_len == 0 || itemtype != PROP_ENUM,
                    "Enum array properties should not exist");
@@ -44,8 +44,31 @@
 
 #  include "WM_api.hh"
 
+#  ifdef WITH_PYTHON
+#    include "BPY_extern.hh"
+#  endif
+
 namespace blender {
 
+/** Encoding and writing large images can take a while, don't block other Python threads. */
+static bool rna_Image_save_allow_threads(ReportList *reports,
+                                         Main *bmain,
+                                         Image *image,
+                                         ImageSaveOptions *opts)
+{
+  bool ok;
+#  ifdef WITH_PYTHON
+  BPy_BEGIN_ALLOW_THREADS;
+#  endif
+
+  ok = BKE_image_save(reports, bmain, image, nullptr, opts);
+
+#  ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#  endif
+  return ok;
+}
+
 static void rna_ImagePackedFile_save(ImagePackedFile *imapf, Main *bmain, ReportList *reports)
 {
   if (BKE_packedfile_write_to_file(
@@ -77,7 +100,7 @@ static void rna_Image_save_render(Image *image,
       opts.im_format.quality = clamp_i(quality, 0, 100);
     }
 
-    if (!BKE_image_save(reports, bmain, image, nullptr, &opts)) {
+    if (!rna_Image_save_allow_threads(reports, bmain, image, &opts)) {
       BKE_reportf(
           reports, RPT_ERROR, "Image '%s' could not be saved to '%s'", image->id.name + 2, path);
     }
@@ -110,7 +133,7 @@ static void rna_Image_save(Image *image,
       opts.im_format.quality = clamp_i(quality, 0, 100);
     }
     opts.save_copy = save_copy;
-    if (!BKE_image_save(reports, bmain, image, nullptr, &opts)) {
+    if (!rna_Image_save_allow_threads(reports, bmain, image, &opts)) {
       BKE_reportf(reports,
                   RPT_ERROR,
                   "Image '%s' could not be saved to '%s'",
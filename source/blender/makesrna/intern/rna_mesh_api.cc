@@ -37,6 +37,10 @@
 
 #  include "WM_api.hh"
 
+#  ifdef WITH_PYTHON
+#    include "BPY_extern.hh"
+#  endif
+
 namespace blender {
 
 static const char *rna_Mesh_unit_test_compare(Mesh *mesh, Mesh *mesh2, float threshold)
@@ -87,6 +91,10 @@ static void rna_Mesh_calc_tangents(Mesh *mesh, ReportList *reports, const char *
     return;
   }
 
+#  ifdef WITH_PYTHON
+  BPy_BEGIN_ALLOW_THREADS;
+#  endif
+
   bke::mesh::calc_uv_tangent_tris_quads(mesh->vert_positions(),
                                         mesh->faces(),
                                         mesh->corner_verts(),
@@ -94,6 +102,10 @@ static void rna_Mesh_calc_tangents(Mesh *mesh, ReportList *reports, const char *
                                         uv_map,
                                         {r_looptangents, mesh->corners_num},
                                         reports);
+
+#  ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#  endif
 }
 
 static void rna_Mesh_free_tangents(Mesh *mesh)
@@ -103,7 +115,15 @@ static void rna_Mesh_free_tangents(Mesh *mesh)
 
 static void rna_Mesh_calc_corner_tri(Mesh *mesh)
 {
+#  ifdef WITH_PYTHON
+  BPy_BEGIN_ALLOW_THREADS;
+#  endif
+
   mesh->corner_tris();
+
+#  ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#  endif
 }
 
 static void rna_Mesh_calc_smooth_groups(Mesh *mesh,
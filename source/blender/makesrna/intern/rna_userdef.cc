@@ -6054,6 +6054,25 @@ static void rna_def_userdef_system(BlenderRNA *brna)
       {0, nullptr, 0, nullptr, nullptr},
   };
 
+  static const EnumPropertyItem seq_disk_cache_compression_levels[] = {
+      {USER_SEQ_DISK_CACHE_COMPRESSION_NONE,
+       "NONE",
+       0,
+       "None",
+       "Requires fast storage, but uses minimum CPU resources"},
+      {USER_SEQ_DISK_CACHE_COMPRESSION_LOW,
+       "LOW",
+       0,
+       "Low",
+       "Doesn't require fast storage and uses less CPU resources"},
+      {USER_SEQ_DISK_CACHE_COMPRESSION_HIGH,
+       "HIGH",
+       0,
+       "High",
+       "Works on slower storage devices and uses most CPU resources"},
+      {0, nullptr, 0, nullptr, nullptr},
+  };
+
   srna = RNA_def_struct(brna, "PreferencesSystem", nullptr);
   RNA_def_struct_sdna(srna, "UserDef");
   RNA_def_struct_nested(brna, srna, "Preferences");
@@ -6102,6 +6121,43 @@ static void rna_def_userdef_system(BlenderRNA *brna)
   RNA_def_property_enum_sdna(prop, nullptr, "sequencer_proxy_setup");
   RNA_def_property_ui_text(prop, "Proxy Setup", "When and how proxies are created");
 
+  prop = RNA_def_property(srna, "sequencer_proxy_build_jobs", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, nullptr, "sequencer_proxy_build_jobs");
+  RNA_def_property_range(prop, 1, 32);
+  RNA_def_property_ui_text(prop,
+                           "Proxy Build Jobs",
+                           "Number of proxies that are built at the same time, each one decoding "
+                           "and encoding its own movie");
+
+  prop = RNA_def_property(srna, "use_sequencer_hardware_decoding", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(
+      prop, nullptr, "sequencer_editor_flag", USER_SEQ_ED_HARDWARE_DECODING);
+  RNA_def_property_ui_text(prop,
+                           "Hardware Decoding",
+                           "Decode movies using the GPU video decoder when available, "
+                           "falling back to software decoding otherwise. Only affects movies "
+                           "opened after changing this setting");
+
+  prop = RNA_def_property(srna, "use_sequencer_disk_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "sequencer_editor_flag", USER_SEQ_ED_DISK_CACHE);
+  RNA_def_property_ui_text(prop,
+                           "Disk Cache",
+                           "Store final frames that don't fit in the memory cache in the "
+                           "temporary directory, so they don't have to be rendered again");
+
+  prop = RNA_def_property(srna, "sequencer_disk_cache_size_limit", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, nullptr, "sequencer_disk_cache_size_limit");
+  RNA_def_property_range(prop, 1, SHRT_MAX);
+  RNA_def_property_ui_text(prop, "Disk Cache Limit", "Disk cache limit (in GB)");
+
+  prop = RNA_def_property(srna, "sequencer_disk_cache_compression", PROP_ENUM, PROP_NONE);
+  RNA_def_property_enum_items(prop, seq_disk_cache_compression_levels);
+  RNA_def_property_enum_sdna(prop, nullptr, "sequencer_disk_cache_compression");
+  RNA_def_property_ui_text(
+      prop,
+      "Disk Cache Compression",
+      "Compression of the files in the disk cache, smaller files are slower to read and write");
+
   prop = RNA_def_property(srna, "scrollback", PROP_INT, PROP_UNSIGNED);
   RNA_def_property_int_sdna(prop, nullptr, "scrollback");
   RNA_def_property_range(prop, 32, 32768);
@@ -6204,6 +6260,15 @@ static void rna_def_userdef_system(BlenderRNA *brna)
       "Texture Collection Rate",
       "Number of seconds between each run of the GL texture garbage collector");
 
+  prop = RNA_def_property(srna, "texture_memory_limit", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, nullptr, "texmemlimit");
+  RNA_def_property_range(prop, 0, INT_MAX);
+  RNA_def_property_ui_range(prop, 0, 65536, 256, -1);
+  RNA_def_property_ui_text(prop,
+                           "Texture Memory Limit",
+                           "GPU memory in MiB that image textures can use before the least "
+                           "recently used textures are freed (set to 0 for no limit)");
+
   prop = RNA_def_property(srna, "vbo_time_out", PROP_INT, PROP_NONE);
   RNA_def_property_int_sdna(prop, nullptr, "vbotimeout");
   RNA_def_property_range(prop, 0, 3600);
@@ -7580,6 +7645,41 @@ static void rna_def_userdef_experimental(BlenderRNA *brna)
       "Allows to work around invalid user-count handling in code "
       "that may lead to loss of data due to wrongly detected unused data-blocks");
 
+  prop = RNA_def_property(srna, "use_parallel_blend_write", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_parallel_blend_write", 1);
+  RNA_def_property_ui_text(prop,
+                           "Parallel Blend File Writing",
+                           "Serialize local data-blocks on multiple threads when saving a "
+                           "blend-file. The written file is identical to a single-threaded save");
+
+  prop = RNA_def_property(srna, "use_async_autosave", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_async_autosave", 1);
+  RNA_def_property_ui_text(prop,
+                           "Background Auto Save",
+                           "Serialize auto-save files in memory and write them to disk in a "
+                           "background job, so that slow storage doesn't block the interface");
+
+  prop = RNA_def_property(srna, "use_depsgraph_critical_path_scheduling", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_depsgraph_critical_path_scheduling", 1);
+  RNA_def_property_ui_text(prop,
+                           "Critical Path Depsgraph Scheduling",
+                           "Measure the evaluation time of dependency graph operations and "
+                           "prioritize the ones with the most expensive work depending on them");
+
+  prop = RNA_def_property(srna, "use_geometry_nodes_result_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_geometry_nodes_result_cache", 1);
+  RNA_def_property_ui_text(prop,
+                           "Geometry Nodes Result Cache",
+                           "Reuse the outputs of geometry nodes whose inputs did not change since "
+                           "a previous evaluation, e.g. on other frames during playback");
+
+  prop = RNA_def_property(srna, "use_sculpt_undo_paging", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "use_sculpt_undo_paging", 1);
+  RNA_def_property_ui_text(prop,
+                           "Sculpt Undo Paging",
+                           "Move the position data of sculpt undo steps that were not used "
+                           "recently to a temporary file to reduce memory usage on large meshes");
+
   prop = RNA_def_property(srna, "use_paint_debug", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, nullptr, "use_paint_debug", 1);
   RNA_def_property_ui_text(
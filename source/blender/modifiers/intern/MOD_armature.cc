@@ -55,6 +55,25 @@ static void copy_data(const ModifierData *md, ModifierData *target, const int fl
   tamd->vert_coords_prev = nullptr;
 }
 
+static void free_runtime_data(void *runtime_data)
+{
+  MEM_delete(static_cast<ArmatureDeformWeightsCache *>(runtime_data));
+}
+
+static void free_data(ModifierData *md)
+{
+  free_runtime_data(md->runtime);
+  md->runtime = nullptr;
+}
+
+static ArmatureDeformWeightsCache *weights_cache_get(ModifierData *md)
+{
+  if (md->runtime == nullptr) {
+    md->runtime = MEM_new<ArmatureDeformWeightsCache>(__func__);
+  }
+  return static_cast<ArmatureDeformWeightsCache *>(md->runtime);
+}
+
 static void required_data_mask(ModifierData * /*md*/, CustomData_MeshMasks *r_cddata_masks)
 {
   /* Ask for vertex-groups. */
@@ -133,7 +152,8 @@ static void deform_verts(ModifierData *md,
                                        std::nullopt,
                                        amd->deformflag,
                                        amd->defgrp_name,
-                                       mesh);
+                                       mesh,
+                                       weights_cache_get(md));
 
   /* free cache */
   MEM_SAFE_DELETE(amd->vert_coords_prev);
@@ -204,7 +224,8 @@ static void deform_matrices(ModifierData *md,
                                        matrices,
                                        amd->deformflag,
                                        amd->defgrp_name,
-                                       mesh);
+                                       mesh,
+                                       weights_cache_get(md));
 }
 
 static void panel_draw(const bContext * /*C*/, Panel *panel)
@@ -264,14 +285,14 @@ ModifierTypeInfo modifierType_Armature = {
 
     /*init_data*/ init_data,
     /*required_data_mask*/ required_data_mask,
-    /*free_data*/ nullptr,
+    /*free_data*/ free_data,
     /*is_disabled*/ is_disabled,
     /*update_depsgraph*/ update_depsgraph,
     /*depends_on_time*/ nullptr,
     /*depends_on_normals*/ nullptr,
     /*foreach_ID_link*/ foreach_ID_link,
     /*foreach_tex_link*/ nullptr,
-    /*free_runtime_data*/ nullptr,
+    /*free_runtime_data*/ free_runtime_data,
     /*panel_register*/ panel_register,
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
@@ -8,6 +8,8 @@
 
 #include <cstring>
 
+#include "MEM_guardedalloc.h"
+
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -38,6 +40,17 @@ static void init_data(ModifierData *md)
   INIT_DEFAULT_STRUCT_AFTER(smd, modifier);
 }
 
+static void free_runtime_data(void *runtime_data)
+{
+  MEM_delete(static_cast<ShrinkwrapRuntime *>(runtime_data));
+}
+
+static void free_data(ModifierData *md)
+{
+  free_runtime_data(md->runtime);
+  md->runtime = nullptr;
+}
+
 static void required_data_mask(ModifierData *md, CustomData_MeshMasks *r_cddata_masks)
 {
   ShrinkwrapModifierData *smd = reinterpret_cast<ShrinkwrapModifierData *>(md);
@@ -86,6 +99,10 @@ static void deform_verts(ModifierData *md,
   int defgrp_index = -1;
   MOD_get_vgroup(ctx->object, mesh, swmd->vgroup_name, &dvert, &defgrp_index);
 
+  if (md->runtime == nullptr) {
+    md->runtime = MEM_new<ShrinkwrapRuntime>(__func__);
+  }
+
   shrinkwrapModifier_deform(swmd,
                             ctx,
                             scene,
@@ -94,7 +111,8 @@ static void deform_verts(ModifierData *md,
                             dvert,
                             defgrp_index,
                             reinterpret_cast<float (*)[3]>(positions.data()),
-                            positions.size());
+                            positions.size(),
+                            static_cast<ShrinkwrapRuntime *>(md->runtime));
 }
 
 static void update_depsgraph(ModifierData *md, const ModifierUpdateDepsgraphContext *ctx)
@@ -200,14 +218,14 @@ ModifierTypeInfo modifierType_Shrinkwrap = {
 
     /*init_data*/ init_data,
     /*required_data_mask*/ required_data_mask,
-    /*free_data*/ nullptr,
+    /*free_data*/ free_data,
     /*is_disabled*/ is_disabled,
     /*update_depsgraph*/ update_depsgraph,
     /*depends_on_time*/ nullptr,
     /*depends_on_normals*/ nullptr,
     /*foreach_ID_link*/ foreach_ID_link,
     /*foreach_tex_link*/ nullptr,
-    /*free_runtime_data*/ nullptr,
+    /*free_runtime_data*/ free_runtime_data,
     /*panel_register*/ panel_register,
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
@@ -61,23 +61,20 @@ static void required_data_mask(ModifierData *md, CustomData_MeshMasks *r_cddata_
   }
 }
 
-static void smoothModifier_do(
-    SmoothModifierData *smd, Object *ob, Mesh *mesh, float (*vertexCos)[3], int verts_num)
+static void smoothModifier_do(SmoothModifierData *smd,
+                              Object *ob,
+                              Mesh *mesh,
+                              float (*vertexCos)[3],
+                              int verts_num,
+                              LinearAllocator<> &allocator)
 {
   if (mesh == nullptr) {
     return;
   }
 
-  float (*accumulated_vecs)[3] = MEM_new_array_zeroed<float[3]>(verts_num, __func__);
-  if (!accumulated_vecs) {
-    return;
-  }
-
-  uint *accumulated_vecs_count = MEM_new_array_zeroed<uint>(verts_num, __func__);
-  if (!accumulated_vecs_count) {
-    MEM_delete(accumulated_vecs);
-    return;
-  }
+  float (*accumulated_vecs)[3] = reinterpret_cast<float (*)[3]>(
+      allocator.allocate_array<float3>(verts_num).data());
+  uint *accumulated_vecs_count = allocator.allocate_array<uint>(verts_num).data();
 
   const float fac_new = smd->fac;
   const float fac_orig = 1.0f - fac_new;
@@ -90,10 +87,8 @@ static void smoothModifier_do(
   MOD_get_vgroup(ob, mesh, smd->defgrp_name, &dvert, &defgrp_index);
 
   for (int j = 0; j < smd->repeat; j++) {
-    if (j != 0) {
-      memset(accumulated_vecs, 0, sizeof(*accumulated_vecs) * size_t(verts_num));
-      memset(accumulated_vecs_count, 0, sizeof(*accumulated_vecs_count) * size_t(verts_num));
-    }
+    memset(accumulated_vecs, 0, sizeof(*accumulated_vecs) * size_t(verts_num));
+    memset(accumulated_vecs_count, 0, sizeof(*accumulated_vecs_count) * size_t(verts_num));
 
     for (const int i : edges.index_range()) {
       float fvec[3];
@@ -158,9 +153,6 @@ static void smoothModifier_do(
       }
     }
   }
-
-  MEM_delete(accumulated_vecs);
-  MEM_delete(accumulated_vecs_count);
 }
 
 static void deform_verts(ModifierData *md,
@@ -169,8 +161,16 @@ static void deform_verts(ModifierData *md,
                          MutableSpan<float3> positions)
 {
   SmoothModifierData *smd = reinterpret_cast<SmoothModifierData *>(md);
-  smoothModifier_do(
-      smd, ctx->object, mesh, reinterpret_cast<float (*)[3]>(positions.data()), positions.size());
+  /* Fall back to a local allocator when not evaluated as part of a modifier stack. */
+  LinearAllocator<> local_allocator;
+  LinearAllocator<> &allocator = ctx->scratch_allocator ? *ctx->scratch_allocator :
+                                                          local_allocator;
+  smoothModifier_do(smd,
+                    ctx->object,
+                    mesh,
+                    reinterpret_cast<float (*)[3]>(positions.data()),
+                    positions.size(),
+                    allocator);
 }
 
 static void panel_draw(const bContext * /*C*/, Panel *panel)
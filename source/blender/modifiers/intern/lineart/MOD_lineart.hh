@@ -507,6 +507,12 @@ struct LineartRenderTaskInfo {
    * LineartData::pending_edges, assigned by the occlusion scheduler.
    */
   struct LineartPendingEdges pending_edges;
+
+  /**
+   * Segments discarded by this thread, they are reused for new cuts without having to lock
+   * #LineartData::lock_cuts. Moved to #LineartData::wasted_cuts when the occlusion is done.
+   */
+  ListBaseT<LineartEdgeSegment> wasted_cuts;
 };
 
 #define LRT_OBINDEX_SHIFT 20
@@ -126,12 +126,23 @@ static void lineart_free_bounding_area_memory(LineartBoundingArea *ba, bool recu
 
 static void lineart_free_bounding_area_memories(LineartData *ld);
 
-static void lineart_discard_segment(LineartData *ld, LineartEdgeSegment *es)
+/**
+ * \param thread_wasted_cuts: Optional list of discarded segments that is only used by the calling
+ * thread, which avoids locking.
+ */
+static void lineart_discard_segment(LineartData *ld,
+                                    LineartEdgeSegment *es,
+                                    ListBaseT<LineartEdgeSegment> *thread_wasted_cuts)
 {
-  BLI_spin_lock(&ld->lock_cuts);
-
   memset(es, 0, sizeof(LineartEdgeSegment));
 
+  if (thread_wasted_cuts) {
+    BLI_addtail(thread_wasted_cuts, es);
+    return;
+  }
+
+  BLI_spin_lock(&ld->lock_cuts);
+
   /* Storing the node for potentially reuse the memory for new segment data.
    * Line Art data is not freed after all calculations are done. */
   BLI_addtail(&ld->wasted_cuts, es);
@@ -139,8 +150,15 @@ static void lineart_discard_segment(LineartData *ld, LineartEdgeSegment *es)
   BLI_spin_unlock(&ld->lock_cuts);
 }
 
-static LineartEdgeSegment *lineart_give_segment(LineartData *ld)
+static LineartEdgeSegment *lineart_give_segment(LineartData *ld,
+                                                ListBaseT<LineartEdgeSegment> *thread_wasted_cuts)
 {
+  if (thread_wasted_cuts && thread_wasted_cuts->first) {
+    LineartEdgeSegment *es = static_cast<LineartEdgeSegment *>(BLI_pophead(thread_wasted_cuts));
+    memset(es, 0, sizeof(LineartEdgeSegment));
+    return es;
+  }
+
   BLI_spin_lock(&ld->lock_cuts);
 
   /* See if there is any already allocated memory we can reuse. */
@@ -157,13 +175,14 @@ static LineartEdgeSegment *lineart_give_segment(LineartData *ld)
       lineart_mem_acquire_thread(ld->edge_data_pool, sizeof(LineartEdgeSegment)));
 }
 
-void lineart_edge_cut(LineartData *ld,
-                      LineartEdge *e,
-                      double start,
-                      double end,
-                      uchar material_mask_bits,
-                      uchar mat_occlusion,
-                      uint32_t shadow_bits)
+static void lineart_edge_cut_ex(LineartData *ld,
+                                LineartEdge *e,
+                                double start,
+                                double end,
+                                uchar material_mask_bits,
+                                uchar mat_occlusion,
+                                uint32_t shadow_bits,
+                                ListBaseT<LineartEdgeSegment> *thread_wasted_cuts)
 {
   LineartEdgeSegment *i_seg, *prev_seg;
   LineartEdgeSegment *cut_start_before = nullptr, *cut_end_before = nullptr;
@@ -206,7 +225,7 @@ void lineart_edge_cut(LineartData *ld,
     i_seg = seg.next;
     if (i_seg->ratio > start + 1e-09 && start > seg.ratio) {
       cut_start_before = i_seg;
-      new_seg1 = lineart_give_segment(ld);
+      new_seg1 = lineart_give_segment(ld, thread_wasted_cuts);
       break;
     }
   }
@@ -232,14 +251,14 @@ void lineart_edge_cut(LineartData *ld,
     /* When an actual cut is needed in the line. */
     if (seg->ratio > end) {
       cut_end_before = seg;
-      new_seg2 = lineart_give_segment(ld);
+      new_seg2 = lineart_give_segment(ld, thread_wasted_cuts);
       break;
     }
   }
 
   /* When we still can't find any existing cut in the line, we allocate new ones. */
   if (new_seg1 == nullptr) {
-    new_seg1 = lineart_give_segment(ld);
+    new_seg1 = lineart_give_segment(ld, thread_wasted_cuts);
   }
   if (new_seg2 == nullptr) {
     if (untouched) {
@@ -247,7 +266,7 @@ void lineart_edge_cut(LineartData *ld,
       cut_end_before = new_seg2;
     }
     else {
-      new_seg2 = lineart_give_segment(ld);
+      new_seg2 = lineart_give_segment(ld, thread_wasted_cuts);
     }
   }
 
@@ -340,7 +359,7 @@ void lineart_edge_cut(LineartData *ld,
       BLI_remlink(&e->segments, &seg);
       /* This puts the node back to the render buffer, if more cut happens, these unused nodes get
        * picked first. */
-      lineart_discard_segment(ld, &seg);
+      lineart_discard_segment(ld, &seg, thread_wasted_cuts);
       continue;
     }
 
@@ -351,6 +370,17 @@ void lineart_edge_cut(LineartData *ld,
   e->min_occ = min_occ;
 }
 
+void lineart_edge_cut(LineartData *ld,
+                      LineartEdge *e,
+                      double start,
+                      double end,
+                      uchar material_mask_bits,
+                      uchar mat_occlusion,
+                      uint32_t shadow_bits)
+{
+  lineart_edge_cut_ex(ld, e, start, end, material_mask_bits, mat_occlusion, shadow_bits, nullptr);
+}
+
 /**
  * To see if given line is connected to an adjacent intersection line.
  */
@@ -387,8 +417,11 @@ static void lineart_bounding_area_line_add(LineartBoundingArea *ba, LineartEdge
   ba->line_count++;
 }
 
-static void lineart_occlusion_single_line(LineartData *ld, LineartEdge *e, int thread_id)
+static void lineart_occlusion_single_line(LineartData *ld,
+                                          LineartEdge *e,
+                                          LineartRenderTaskInfo *rti)
 {
+  const int thread_id = rti->thread_id;
   LineartTriangleThread *tri;
   double l, r;
   LRT_EDGE_BA_MARCHING_BEGIN(e->v1->fbcoord, e->v2->fbcoord)
@@ -420,7 +453,14 @@ static void lineart_occlusion_single_line(LineartData *ld, LineartEdge *e, int t
               &l,
               &r))
       {
-        lineart_edge_cut(ld, e, l, r, tri->base.material_mask_bits, tri->base.mat_occlusion, 0);
+        lineart_edge_cut_ex(ld,
+                            e,
+                            l,
+                            r,
+                            tri->base.material_mask_bits,
+                            tri->base.mat_occlusion,
+                            0,
+                            &rti->wasted_cuts);
         if (e->min_occ > ld->conf.max_occlusion_level) {
           /* No need to calculate any longer on this line because no level more than set value is
            * going to show up in the rendered result. */
@@ -466,7 +506,7 @@ static void lineart_occlusion_worker(TaskPool *__restrict /*pool*/, LineartRende
   while (lineart_occlusion_make_task_info(ld, rti)) {
     for (int i = 0; i < rti->pending_edges.max; i++) {
       eip = rti->pending_edges.array[i];
-      lineart_occlusion_single_line(ld, eip, rti->thread_id);
+      lineart_occlusion_single_line(ld, eip, rti);
     }
   }
 }
@@ -488,6 +528,10 @@ void lineart_main_occlusion_begin(LineartData *ld)
   BLI_task_pool_work_and_wait(tp);
   BLI_task_pool_free(tp);
 
+  for (i = 0; i < thread_count; i++) {
+    BLI_movelisttolist(&ld->wasted_cuts, &rti[i].wasted_cuts);
+  }
+
   MEM_delete(rti);
 }
 
@@ -306,6 +306,10 @@ class GeoTreeLogger {
     TimePoint start;
     TimePoint end;
   };
+  struct NodeSchedulingOverhead {
+    int32_t node_id;
+    std::chrono::nanoseconds duration;
+  };
   struct ViewerNodeLogWithNode {
     int32_t node_id;
     destruct_ptr<ViewerNodeLog> viewer_log;
@@ -327,6 +331,7 @@ class GeoTreeLogger {
   linear_allocator::ChunkedList<SocketValueLog, 16> input_socket_values;
   linear_allocator::ChunkedList<SocketValueLog, 16> output_socket_values;
   linear_allocator::ChunkedList<NodeExecutionTime, 16> node_execution_times;
+  linear_allocator::ChunkedList<NodeSchedulingOverhead, 16> node_scheduling_overheads;
   linear_allocator::ChunkedList<ViewerNodeLogWithNode> viewer_node_logs;
   linear_allocator::ChunkedList<AttributeUsageWithNode> used_named_attributes;
   linear_allocator::ChunkedList<DebugMessage> debug_messages;
@@ -351,8 +356,10 @@ class GeoNodeLog {
  public:
   /** Warnings generated for that node. */
   VectorSet<NodeWarning> warnings;
-  /** Time spent in this node. */
+  /** Time spent in this node, including #scheduling_overhead. */
   std::chrono::nanoseconds execution_time{0};
+  /** Time the evaluator spent on scheduling this node and passing on its results. */
+  std::chrono::nanoseconds scheduling_overhead{0};
   /** Maps from socket indices to their values. */
   Map<int, ValueLog *> input_values_;
   Map<int, ValueLog *> output_values_;
@@ -0,0 +1,53 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup nodes
+ *
+ * Geometry node results can be stored in the global #memory_cache, so that they are reused when
+ * the same node is evaluated again with the same inputs. This mainly helps during playback when
+ * e.g. an expensive scattering setup is not animated at all, because then only the animated parts
+ * of the node tree have to be recomputed on every frame.
+ *
+ * Input geometries are identified by the implicitly shared arrays they reference. Those usually
+ * stay the same across evaluations when the original data did not change, even though the
+ * geometry itself is copied.
+ */
+
+#pragma once
+
+#include "BLI_function_ref.hh"
+
+#include "FN_lazy_function.hh"
+
+namespace blender {
+
+struct bNode;
+
+namespace nodes {
+
+/**
+ * Check whether the node type can potentially be cached, i.e. whether its outputs only depend on
+ * its inputs and settings. Additionally, only nodes that take a geometry and output a geometry
+ * are cached, because for other nodes the overhead of the cache is likely higher than the cost
+ * of the node.
+ */
+bool geometry_node_supports_result_cache(const bNode &node);
+
+/**
+ * Execute the geometry node by retrieving its outputs from the cache or by computing and caching
+ * them. All inputs of the node have to be available already. #execute_fn is expected to evaluate
+ * the node with the given params.
+ *
+ * \return False if the node can't be cached with the current inputs. In that case, nothing has
+ * been done and the caller has to execute the node itself.
+ */
+bool execute_geometry_node_with_result_cache(const bNode &node,
+                                             const lf::LazyFunction &fn,
+                                             lf::Params &params,
+                                             const lf::Context &context,
+                                             FunctionRef<void(lf::Params &params)> execute_fn);
+
+}  // namespace nodes
+}  // namespace blender
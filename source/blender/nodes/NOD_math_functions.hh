@@ -34,6 +34,16 @@ const FloatMathOperationInfo *get_float_math_operation_info(int operation);
 const FloatMathOperationInfo *get_float3_math_operation_info(int operation);
 const FloatMathOperationInfo *get_float_compare_operation_info(int operation);
 
+/**
+ * Get a multi-function that computes the operation with explicit SIMD instructions when the inputs
+ * are spans or single values. Otherwise it calls the given fallback function, which has to compute
+ * the same operation. Null is returned when there is no SIMD implementation for the operation.
+ */
+const mf::MultiFunction *get_float_math_simd_function(int operation,
+                                                      const mf::MultiFunction &fallback_fn);
+const mf::MultiFunction *get_vector_math_simd_function(int operation,
+                                                       const mf::MultiFunction &fallback_fn);
+
 /**
  * This calls the `callback` with two arguments:
  * 1. The math function that takes a float as input and outputs a new float.
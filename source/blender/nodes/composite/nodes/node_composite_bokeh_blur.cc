@@ -5,6 +5,7 @@
 #include "BLI_math_base.hh"
 #include "BLI_math_vector_types.hh"
 
+#include "COM_algorithm_convolve.hh"
 #include "COM_algorithm_pad.hh"
 #include "COM_algorithm_parallel_reduction.hh"
 #include "COM_node_operation.hh"
@@ -37,10 +38,22 @@ static void node_declare(NodeDeclarationBuilder &b)
 
 using namespace blender::compositor;
 
+/* The blur radius starting from which the constant size CPU blur is computed using an FFT-based
+ * convolution. The cost of the direct convolution is quadratic in the radius while the cost of
+ * the FFT-based convolution is independent of it, and the two roughly break even at this radius
+ * for typical image sizes. */
+[[maybe_unused]] static constexpr int fft_blur_radius_threshold = 32;
+
 class BokehBlurOperation : public NodeOperation {
  public:
   using NodeOperation::NodeOperation;
 
+  /* The results are expensive to compute and only depend on the inputs, so cache them. */
+  std::optional<uint64_t> get_cache_state_hash() const override
+  {
+    return 0;
+  }
+
   void execute() override
   {
     const Result &input = this->get_input("Image");
@@ -137,6 +150,13 @@ class BokehBlurOperation : public NodeOperation {
   {
     const int radius = this->get_blur_radius();
 
+#if defined(WITH_FFTW3)
+    if (radius >= fft_blur_radius_threshold) {
+      this->execute_constant_size_fft_cpu(input, radius);
+      return;
+    }
+#endif
+
     const Result &mask_image = this->get_input("Mask");
 
     const Domain domain = input.domain();
@@ -173,6 +193,41 @@ class BokehBlurOperation : public NodeOperation {
     blur_kernel.release();
   }
 
+  /* Identical to the direct convolution done in execute_constant_size_cpu, but the convolution is
+   * done in the frequency domain. The convolution assumes a zero boundary, so the input is first
+   * padded by extending its edges to match the extended boundary of the direct convolution, then
+   * the center of the convolved result is extracted. */
+  void execute_constant_size_fft_cpu(const Result &input, const int radius)
+  {
+    Result padded_input = this->context().create_result(ResultType::Color);
+    pad(this->context(), input, padded_input, int2(radius), PaddingMethod::Extend);
+
+    Result blur_kernel = this->compute_blur_kernel(radius);
+    Result convolved = this->context().create_result(ResultType::Color);
+    convolve(this->context(), padded_input, blur_kernel, convolved, true);
+    blur_kernel.release();
+    padded_input.release();
+
+    const Result &mask_image = this->get_input("Mask");
+
+    const Domain domain = input.domain();
+    Result &output = this->get_result("Image");
+    output.allocate_texture(domain);
+
+    parallel_for(domain.data_size, [&](const int2 texel) {
+      /* The mask input is treated as a boolean, see execute_constant_size_cpu. */
+      float mask = mask_image.load_pixel<float, true>(texel);
+      if (mask == 0.0f) {
+        output.store_pixel(texel, input.load_pixel<Color>(texel));
+        return;
+      }
+
+      output.store_pixel(texel, convolved.load_pixel<Color>(texel + radius));
+    });
+
+    convolved.release();
+  }
+
   void execute_variable_size(const Result &input, const Result &size)
   {
     if (this->context().use_gpu()) {
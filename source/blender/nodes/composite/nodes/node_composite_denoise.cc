@@ -6,6 +6,7 @@
 #  include "BLI_system.h"
 #endif
 
+#include "BLI_hash.hh"
 #include "BLI_span.hh"
 
 #include "MEM_guardedalloc.h"
@@ -150,6 +151,13 @@ class DenoiseOperation : public NodeOperation {
  public:
   using NodeOperation::NodeOperation;
 
+  /* The results are expensive to compute and only depend on the inputs and the scene denoise
+   * quality, which is used when the quality mode follows the scene, so cache them. */
+  std::optional<uint64_t> get_cache_state_hash() const override
+  {
+    return get_default_hash(this->context().get_denoise_quality());
+  }
+
   void execute() override
   {
     const Result &input_image = get_input("Image");
@@ -100,6 +100,12 @@ class ConvertKuwaharaOperation : public NodeOperation {
  public:
   using NodeOperation::NodeOperation;
 
+  /* The results are expensive to compute and only depend on the inputs, so cache them. */
+  std::optional<uint64_t> get_cache_state_hash() const override
+  {
+    return 0;
+  }
+
   void execute() override
   {
     const Result &input = this->get_input("Image");
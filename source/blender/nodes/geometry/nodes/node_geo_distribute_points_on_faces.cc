@@ -7,6 +7,7 @@
 #include "BLI_math_quaternion.hh"
 #include "BLI_math_rotation.h"
 #include "BLI_noise.hh"
+#include "BLI_offset_indices.hh"
 #include "BLI_rand.hh"
 #include "BLI_task.hh"
 
@@ -105,6 +106,34 @@ static math::Quaternion normal_to_rotation(const float3 normal)
   return math::normalize(math::Quaternion(quat));
 }
 
+/**
+ * Compute the number of points to distribute on a triangle. The random number generator is seeded
+ * per triangle, and is used afterwards to generate the barycentric coordinates of the points.
+ */
+static int corner_tri_point_amount(const Span<float3> positions,
+                                   const Span<int> corner_verts,
+                                   const int3 &tri,
+                                   const float base_density,
+                                   const Span<float> density_factors,
+                                   RandomNumberGenerator &corner_tri_rng)
+{
+  const float3 &v0_pos = positions[corner_verts[tri[0]]];
+  const float3 &v1_pos = positions[corner_verts[tri[1]]];
+  const float3 &v2_pos = positions[corner_verts[tri[2]]];
+
+  float corner_tri_density_factor = 1.0f;
+  if (!density_factors.is_empty()) {
+    const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
+    const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
+    const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
+    corner_tri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) /
+                                3.0f;
+  }
+  const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
+
+  return corner_tri_rng.round_probabilistic(area * base_density * corner_tri_density_factor);
+}
+
 static void sample_mesh_surface(const Mesh &mesh,
                                 const float base_density,
                                 const Span<float> density_factors,
@@ -117,40 +146,52 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<int> corner_verts = mesh.corner_verts();
   const Span<int3> corner_tris = mesh.corner_tris();
 
-  for (const int tri_i : corner_tris.index_range()) {
-    const int3 &tri = corner_tris[tri_i];
-    const int v0_loop = tri[0];
-    const int v1_loop = tri[1];
-    const int v2_loop = tri[2];
-    const float3 &v0_pos = positions[corner_verts[v0_loop]];
-    const float3 &v1_pos = positions[corner_verts[v1_loop]];
-    const float3 &v2_pos = positions[corner_verts[v2_loop]];
-
-    float corner_tri_density_factor = 1.0f;
-    if (!density_factors.is_empty()) {
-      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
-      corner_tri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) /
-                                  3.0f;
+  /* Count the points of every triangle first, so that the points can be generated in parallel
+   * while keeping the same order as when looping over all triangles sequentially. */
+  Array<int> offsets_data(corner_tris.size() + 1);
+  threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      RandomNumberGenerator corner_tri_rng(noise::hash(tri_i, seed));
+      offsets_data[tri_i] = corner_tri_point_amount(positions,
+                                                    corner_verts,
+                                                    corner_tris[tri_i],
+                                                    base_density,
+                                                    density_factors,
+                                                    corner_tri_rng);
     }
-    const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
-
-    const int corner_tri_seed = noise::hash(tri_i, seed);
-    RandomNumberGenerator corner_tri_rng(corner_tri_seed);
-
-    const int point_amount = corner_tri_rng.round_probabilistic(area * base_density *
-                                                                corner_tri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_tri_indices.append(tri_i);
+  });
+  const int start_index = r_positions.size();
+  const OffsetIndices points_by_tri = offset_indices::accumulate_counts_to_offsets(offsets_data,
+                                                                                   start_index);
+
+  const int points_num = start_index + points_by_tri.total_size();
+  r_positions.resize(points_num);
+  r_bary_coords.resize(points_num);
+  r_tri_indices.resize(points_num);
+
+  threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      const IndexRange tri_points = points_by_tri[tri_i];
+      if (tri_points.is_empty()) {
+        continue;
+      }
+      const int3 &tri = corner_tris[tri_i];
+      /* Generate the same random sequence as when counting the points. */
+      RandomNumberGenerator corner_tri_rng(noise::hash(tri_i, seed));
+      corner_tri_point_amount(
+          positions, corner_verts, tri, base_density, density_factors, corner_tri_rng);
+
+      const float3 &v0_pos = positions[corner_verts[tri[0]]];
+      const float3 &v1_pos = positions[corner_verts[tri[1]]];
+      const float3 &v2_pos = positions[corner_verts[tri[2]]];
+      for (const int i : tri_points) {
+        const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
+        interp_v3_v3v3v3(r_positions[i], v0_pos, v1_pos, v2_pos, bary_coord);
+        r_bary_coords[i] = bary_coord;
+        r_tri_indices[i] = tri_i;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
@@ -210,26 +251,29 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     const MutableSpan<bool> elimination_mask)
 {
   const Span<int3> corner_tris = mesh.corner_tris();
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const int3 &tri = corner_tris[tri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const int3 &tri = corner_tris[tri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
-    const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
-    const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
+      const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
+      const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
+      const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
 
-    const float probability = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                              v2_density_factor * bary_coord.z;
+      const float probability = v0_density_factor * bary_coord.x +
+                                v1_density_factor * bary_coord.y +
+                                v2_density_factor * bary_coord.z;
 
-    const float hash = noise::hash_float_to_float(bary_coord);
-    if (hash > probability) {
-      elimination_mask[i] = true;
+      const float hash = noise::hash_float_to_float(bary_coord);
+      if (hash > probability) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(const Span<bool> elimination_mask,
@@ -377,21 +421,23 @@ static void compute_legacy_normal_outputs(const Mesh &mesh,
   const Span<int> corner_verts = mesh.corner_verts();
   const Span<int3> corner_tris = mesh.corner_tris();
 
-  for (const int i : bary_coords.index_range()) {
-    const int tri_i = tri_indices[i];
-    const int3 &tri = corner_tris[tri_i];
-
-    const int v0_index = corner_verts[tri[0]];
-    const int v1_index = corner_verts[tri[1]];
-    const int v2_index = corner_verts[tri[2]];
-    const float3 v0_pos = positions[v0_index];
-    const float3 v1_pos = positions[v1_index];
-    const float3 v2_pos = positions[v2_index];
-
-    float3 normal;
-    normal_tri_v3(normal, v0_pos, v1_pos, v2_pos);
-    r_normals[i] = normal;
-  }
+  threading::parallel_for(bary_coords.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int tri_i = tri_indices[i];
+      const int3 &tri = corner_tris[tri_i];
+
+      const int v0_index = corner_verts[tri[0]];
+      const int v1_index = corner_verts[tri[1]];
+      const int v2_index = corner_verts[tri[2]];
+      const float3 v0_pos = positions[v0_index];
+      const float3 v1_pos = positions[v1_index];
+      const float3 v2_pos = positions[v2_index];
+
+      float3 normal;
+      normal_tri_v3(normal, v0_pos, v1_pos, v2_pos);
+      r_normals[i] = normal;
+    }
+  });
 }
 
 static void compute_rotation_output(const Span<float3> normals,
@@ -54,7 +54,6 @@ static std::unique_ptr<bke::Instances> add_instances_from_component(
   const int domain_num = src_attributes.domain_size(domain);
 
   VArray<bool> pick_instance;
-  VArray<int> indices;
   VArray<math::Quaternion> rotations;
   VArray<float3> scales;
 
@@ -64,7 +63,6 @@ static std::unique_ptr<bke::Instances> add_instances_from_component(
   /* The evaluator could use the component's stable IDs as a destination directly, but only the
    * selected indices should be copied. */
   evaluator.add(params.get_input<Field<bool>>("Pick Instance"), &pick_instance);
-  evaluator.add(params.get_input<Field<int>>("Instance Index"), &indices);
   evaluator.add(params.get_input<Field<math::Quaternion>>("Rotation"), &rotations);
   evaluator.add(params.get_input<Field<float3>>("Scale"), &scales);
   evaluator.evaluate();
@@ -74,6 +72,20 @@ static std::unique_ptr<bke::Instances> add_instances_from_component(
     return {};
   }
 
+  const bke::Instances *src_instances = instance.get_instances();
+  const bool may_pick_instances = src_instances != nullptr &&
+                                  (!pick_instance.is_single() ||
+                                   pick_instance.get_internal_single());
+
+  /* Only evaluate the instance indices when they are used, to avoid allocating and computing an
+   * array for all points in the common case of instancing the whole geometry. */
+  VArray<int> indices;
+  if (may_pick_instances) {
+    fn::FieldEvaluator indices_evaluator{field_context, &selection};
+    indices_evaluator.add(params.get_input<Field<int>>("Instance Index"), &indices);
+    indices_evaluator.evaluate();
+  }
+
   auto dst_component = std::make_unique<bke::Instances>(selection.size());
 
   MutableSpan<int> dst_handles = dst_component->reference_handles_for_write();
@@ -81,14 +93,10 @@ static std::unique_ptr<bke::Instances> add_instances_from_component(
 
   const VArraySpan positions = *src_attributes.lookup<float3>("position");
 
-  const bke::Instances *src_instances = instance.get_instances();
-
   /* Maps handles from the source instances to handles on the new instance. */
   Array<int> handle_mapping;
   /* Only fill #handle_mapping when it may be used below. */
-  if (src_instances != nullptr &&
-      (!pick_instance.is_single() || pick_instance.get_internal_single()))
-  {
+  if (may_pick_instances) {
     Span<bke::InstanceReference> src_references = src_instances->references();
     handle_mapping.reinitialize(src_references.size());
     for (const int src_instance_handle : src_references.index_range()) {
@@ -9,6 +9,8 @@
 
 #include "BKE_lib_id.hh"
 
+#include "BLI_system.h"
+
 #include "GEO_foreach_geometry.hh"
 #include "GEO_mesh_to_volume.hh"
 
@@ -108,6 +110,19 @@ static Volume *create_volume_from_mesh(const Mesh &mesh, GeoNodeExecParams &para
       0.0f,
       mesh_to_volume_space_transform);
 
+  /* Warn before the conversion, which may run out of memory for small voxel sizes. */
+  const int64_t memory_limit = int64_t(BLI_system_memory_max_in_megabytes()) * 1024 * 1024 / 2;
+  if (geometry::mesh_to_volume_memory_estimate(mesh.vert_positions(),
+                                               mesh.corner_verts(),
+                                               mesh.corner_tris(),
+                                               mesh_to_volume_space_transform,
+                                               voxel_size,
+                                               interior_band_width) > memory_limit)
+  {
+    params.error_message_add(NodeWarningType::Warning,
+                             TIP_("Volume may use a lot of memory, consider a larger voxel size"));
+  }
+
   Volume *volume = BKE_id_new_nomain<Volume>(nullptr);
 
   /* Convert mesh to grid and add to volume. */
@@ -9,6 +9,7 @@
 #endif
 
 #include "BLI_bounds.hh"
+#include "BLI_system.h"
 
 #include "node_geometry_util.hh"
 
@@ -110,6 +111,13 @@ static void initialize_volume_component_from_points(GeoNodeExecParams &params,
     return;
   }
 
+  /* Warn before the conversion, which may run out of memory for small voxel sizes. */
+  const int64_t memory_limit = int64_t(BLI_system_memory_max_in_megabytes()) * 1024 * 1024 / 2;
+  if (geometry::points_to_volume_memory_estimate(positions, radii, voxel_size) > memory_limit) {
+    params.error_message_add(NodeWarningType::Warning,
+                             TIP_("Volume may use a lot of memory, consider a larger voxel size"));
+  }
+
   Volume *volume = BKE_id_new_nomain<Volume>(nullptr);
 
   const float density = params.get_input<float>("Density");
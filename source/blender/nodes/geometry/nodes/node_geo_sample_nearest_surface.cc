@@ -148,6 +148,12 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
     MutableSpan<bool> is_valid_span = params.uninitialized_single_output_if_required<bool>(
         4, "Is Valid");
 
+    /* Use local proximity heuristics to reduce the nearest search. Consecutive sample positions
+     * are often close to each other, so the distance to the previous result in the same group is
+     * used as initial search radius, which prunes most of the tree. */
+    BVHTreeNearest nearest;
+    nearest.index = -1;
+    int nearest_group_index = -1;
     mask.foreach_index([&](const int i) {
       const float3 position = positions[i];
       const int sample_id = sample_ids[i];
@@ -161,9 +167,14 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
         return;
       }
       const bke::BVHTreeFromMesh &bvh = bvh_trees_[group_index];
-      BVHTreeNearest nearest;
-      nearest.dist_sq = FLT_MAX;
-      nearest.index = -1;
+      if (nearest.index != -1 && nearest_group_index == group_index) {
+        nearest.dist_sq = math::distance_squared(position, float3(nearest.co));
+      }
+      else {
+        nearest.dist_sq = FLT_MAX;
+        nearest.index = -1;
+      }
+      nearest_group_index = group_index;
       BLI_bvhtree_find_nearest(bvh.tree,
                                position,
                                &nearest,
@@ -906,13 +906,16 @@ void LazyFunctionForReduceForeachGeometryElement::handle_main_items_and_geometry
       base_cpp_type->value_initialize_indices(attribute.span.data(), inverted_mask);
 
       /* Copy the values from each iteration into the attribute. */
-      mask.foreach_index([&](const int i, const int pos) {
-        const int lf_param_index = pos * body_main_outputs_num + item_i;
-        SocketValueVariant &value_variant = params.get_input<SocketValueVariant>(lf_param_index);
-        value_variant.convert_to_single();
-        const void *value = value_variant.get_single_ptr_raw();
-        base_cpp_type->copy_construct(value, attribute.span[i]);
-      });
+      mask.foreach_index(
+          [&](const int i, const int pos) {
+            const int lf_param_index = pos * body_main_outputs_num + item_i;
+            SocketValueVariant &value_variant = params.get_input<SocketValueVariant>(
+                lf_param_index);
+            value_variant.convert_to_single();
+            const void *value = value_variant.get_single_ptr_raw();
+            base_cpp_type->copy_construct(value, attribute.span[i]);
+          },
+          exec_mode::grain_size(1024));
 
       attribute.finish();
     }
@@ -1055,17 +1058,35 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
       }
       attributes_to_propagate.append({iter.name, iter.data_type});
     });
-    Map<StringRef, GVArray> cached_adapted_src_attributes;
-
     const IndexMask mask = component_info.field_evaluator->get_evaluated_selection_as_mask();
+    if (mask.is_empty()) {
+      continue;
+    }
 
-    /* Add attributes for each field on the geometry created by each iteration. */
-    mask.foreach_index([&](const int element_i, const int local_body_i) {
+    /* Get the source attributes adapted to the iteration domain before processing the iterations
+     * in parallel. */
+    Map<StringRef, GVArray> adapted_src_attributes;
+    for (const NameWithType &name_with_type : attributes_to_propagate) {
+      bke::GAttributeReader attribute = src_attributes.lookup(name_with_type.name);
+      adapted_src_attributes.add(
+          name_with_type.name,
+          src_attributes.adapt_domain(*attribute, attribute.domain, component_info.id.domain));
+    }
+
+    /* Inputs can only be extracted on the thread that executes this lazy-function. */
+    mask.foreach_index([&](const int /*element_i*/, const int local_body_i) {
       const int body_i = component_info.body_nodes_range[local_body_i];
       const int geometry_param_i = body_i * body_main_outputs_num +
                                    parent_.indices_.generation.lf_inner[geometry_item_i];
+      geometries[body_i] =
+          params.extract_input<SocketValueVariant>(geometry_param_i).extract<GeometrySet>();
+    });
+
+    /* Add attributes for each field on the geometry created by each iteration. The geometries of
+     * the iterations are independent, so they are processed in parallel. */
+    const auto process_iteration = [&](const int element_i, const int local_body_i) {
+      const int body_i = component_info.body_nodes_range[local_body_i];
       GeometrySet &geometry = geometries[body_i];
-      geometry = params.extract_input<SocketValueVariant>(geometry_param_i).extract<GeometrySet>();
 
       for (const GeometryComponent::Type dst_component_type :
            {GeometryComponent::Type::Mesh,
@@ -1099,13 +1120,7 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
             /* Attributes created in the zone shouldn't be overridden. */
             continue;
           }
-          /* Get the source attribute adapted to the iteration domain. */
-          const GVArray &src_attribute = cached_adapted_src_attributes.lookup_or_add_cb(
-              name, [&]() {
-                bke::GAttributeReader attribute = src_attributes.lookup(name);
-                return src_attributes.adapt_domain(
-                    *attribute, attribute.domain, component_info.id.domain);
-              });
+          const GVArray &src_attribute = adapted_src_attributes.lookup(name);
           if (!src_attribute) {
             continue;
           }
@@ -1162,7 +1177,8 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
           });
         }
       }
-    });
+    };
+    mask.foreach_index(process_iteration, exec_mode::grain_size(32));
   }
 
   /* The last geometry contains the edit data from the main geometry. */
@@ -26,6 +26,7 @@
 #include "NOD_geometry_nodes_closure.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
 #include "NOD_geometry_nodes_list.hh"
+#include "NOD_geometry_nodes_result_cache.hh"
 #include "NOD_multi_function.hh"
 #include "NOD_node_declaration.hh"
 
@@ -37,6 +38,7 @@
 #include "BLI_map.hh"
 
 #include "DNA_ID.h"
+#include "DNA_userdef_types.h"
 
 #include "BKE_anonymous_attribute_make.hh"
 #include "BKE_compute_contexts.hh"
@@ -129,13 +131,16 @@ class LazyFunctionForGeometryNode : public LazyFunction {
    * does not have to execute.
    */
   Vector<bool> is_attribute_output_bsocket_;
+  /** True if the node results may be reused when it is evaluated with the same inputs again. */
+  bool supports_result_cache_;
 
  public:
   LazyFunctionForGeometryNode(const bNode &node,
                               GeometryNodesLazyFunctionGraphInfo &own_lf_graph_info)
       : node_(node),
         own_lf_graph_info_(own_lf_graph_info),
-        is_attribute_output_bsocket_(node.output_sockets().size(), false)
+        is_attribute_output_bsocket_(node.output_sockets().size(), false),
+        supports_result_cache_(geometry_node_supports_result_cache(node))
   {
     BLI_assert(node.typeinfo->geometry_node_execute != nullptr);
     debug_name_ = node.name;
@@ -236,15 +241,24 @@ class LazyFunctionForGeometryNode : public LazyFunction {
       return this->anonymous_attribute_name_for_output(*user_data, i);
     };
 
-    GeoNodeExecParams geo_params{
-        node_,
-        params,
-        context,
-        own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
-        own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
-        get_anonymous_attribute_name};
+    auto execute_node = [&](lf::Params &node_params) {
+      GeoNodeExecParams geo_params{
+          node_,
+          node_params,
+          context,
+          own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
+          own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
+          get_anonymous_attribute_name};
 
-    node_.typeinfo->geometry_node_execute(geo_params);
+      node_.typeinfo->geometry_node_execute(geo_params);
+    };
+
+    if (supports_result_cache_ && USER_DEVELOPER_TOOL_TEST(&U, use_geometry_nodes_result_cache)) {
+      if (execute_geometry_node_with_result_cache(node_, *this, params, context, execute_node)) {
+        return;
+      }
+    }
+    execute_node(params);
   }
 
   std::string input_name(const int index) const override
@@ -1855,27 +1869,46 @@ class GeometryNodesLazyFunctionLogger : public lf::GraphExecutor::Logger {
     if (tree_logger == nullptr) {
       return;
     }
+    if (const bNode *bnode = this->find_bnode(node)) {
+      tree_logger->debug_messages.append(*tree_logger->allocator,
+                                         {bnode->identifier, thread_id_str});
+    }
+  }
+
+  void log_node_scheduling_overhead(const lf::FunctionNode &node,
+                                    const std::chrono::nanoseconds duration,
+                                    const lf::Context &context) const override
+  {
+    const auto &user_data = *static_cast<GeoNodesUserData *>(context.user_data);
+    const auto &local_user_data = *static_cast<GeoNodesLocalUserData *>(context.local_user_data);
+    geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(user_data);
+    if (tree_logger == nullptr) {
+      return;
+    }
+    if (const bNode *bnode = this->find_bnode(node)) {
+      tree_logger->node_scheduling_overheads.append(*tree_logger->allocator,
+                                                    {bnode->identifier, duration});
+    }
+  }
 
-    /* Find corresponding node based on the socket mapping. */
-    auto check_sockets = [&](const Span<const lf::Socket *> lf_sockets) {
+  /** Find corresponding node based on the socket mapping. */
+  const bNode *find_bnode(const lf::FunctionNode &node) const
+  {
+    auto check_sockets = [&](const Span<const lf::Socket *> lf_sockets) -> const bNode * {
       for (const lf::Socket *lf_socket : lf_sockets) {
         const Span<const bNodeSocket *> bsockets =
             lf_graph_info_.mapping.bsockets_by_lf_socket_map.lookup(lf_socket);
         if (!bsockets.is_empty()) {
-          const bNodeSocket &bsocket = *bsockets[0];
-          const bNode &bnode = bsocket.owner_node();
-          tree_logger->debug_messages.append(*tree_logger->allocator,
-                                             {bnode.identifier, thread_id_str});
-          return true;
+          return &bsockets[0]->owner_node();
         }
       }
-      return false;
+      return nullptr;
     };
 
-    if (check_sockets(node.inputs().cast<const lf::Socket *>())) {
-      return;
+    if (const bNode *bnode = check_sockets(node.inputs().cast<const lf::Socket *>())) {
+      return bnode;
     }
-    check_sockets(node.outputs().cast<const lf::Socket *>());
+    return check_sockets(node.outputs().cast<const lf::Socket *>());
   }
 };
 
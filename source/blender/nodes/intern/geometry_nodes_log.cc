@@ -534,6 +534,13 @@ void GeoTreeLog::ensure_execution_times()
       const std::chrono::nanoseconds duration = timings.end - timings.start;
       this->nodes.lookup_or_add_default_as(timings.node_id).execution_time += duration;
     }
+    for (const GeoTreeLogger::NodeSchedulingOverhead &overhead :
+         tree_logger->node_scheduling_overheads)
+    {
+      GeoNodeLog &node_log = this->nodes.lookup_or_add_default_as(overhead.node_id);
+      node_log.execution_time += overhead.duration;
+      node_log.scheduling_overhead += overhead.duration;
+    }
     this->execution_time += tree_logger->execution_time;
   }
   reduced_execution_times_ = true;
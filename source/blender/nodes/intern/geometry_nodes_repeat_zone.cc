@@ -13,6 +13,9 @@
 #include "BLT_translation.hh"
 
 #include "BLI_array_utils.hh"
+#include "BLI_timeit.hh"
+
+#include "CLG_log.h"
 
 #include "DEG_depsgraph_query.hh"
 
@@ -20,6 +23,8 @@
 
 namespace blender::nodes {
 
+static CLG_LogRef LOG = {"geometry_nodes.repeat_zone"};
+
 using bke::SocketValueVariant;
 
 /**
@@ -104,6 +109,9 @@ struct RepeatEvalStorage {
   bool multi_threading_enabled = false;
   Vector<int> input_index_map;
   Vector<int> output_index_map;
+  /** Number of iterations and accumulated time of all executions, only used for profiling. */
+  int iterations = 0;
+  timeit::Nanoseconds execution_time{0};
 };
 
 class LazyFunctionForRepeatZone : public LazyFunction {
@@ -140,6 +148,15 @@ class LazyFunctionForRepeatZone : public LazyFunction {
   void destruct_storage(void *storage) const override
   {
     RepeatEvalStorage *s = static_cast<RepeatEvalStorage *>(storage);
+    if (s->graph_executor && s->iterations > 0 && CLOG_CHECK(&LOG, CLG_LEVEL_DEBUG)) {
+      const double time_ms = std::chrono::duration<double, std::milli>(s->execution_time).count();
+      CLOG_DEBUG(&LOG,
+                 "\"%s\": %d iterations took %.3f ms, %.3f ms per iteration",
+                 repeat_output_bnode_.name,
+                 s->iterations,
+                 time_ms,
+                 time_ms / s->iterations);
+    }
     if (s->graph_executor_storage) {
       s->graph_executor->destruct_storage(s->graph_executor_storage);
     }
@@ -177,7 +194,15 @@ class LazyFunctionForRepeatZone : public LazyFunction {
                                          eval_storage.multi_threading_enabled};
     lf::Context eval_graph_context{
         eval_storage.graph_executor_storage, context.user_data, context.local_user_data};
+    if (!CLOG_CHECK(&LOG, CLG_LEVEL_DEBUG)) {
+      eval_storage.graph_executor->execute(eval_graph_params, eval_graph_context);
+      return;
+    }
+    /* The zone may be executed multiple times until all its outputs are computed, the total time
+     * is reported when the evaluation storage is destructed. */
+    const timeit::TimePoint start_time = timeit::Clock::now();
     eval_storage.graph_executor->execute(eval_graph_params, eval_graph_context);
+    eval_storage.execution_time += timeit::Clock::now() - start_time;
   }
 
   /**
@@ -239,6 +264,8 @@ class LazyFunctionForRepeatZone : public LazyFunction {
       lf_outputs.append(&lf_graph.add_output(*output.type, this->output_name(i)));
     }
 
+    eval_storage.iterations = iterations;
+
     /* Create body nodes. */
     VectorSet<lf::FunctionNode *> &lf_body_nodes = eval_storage.lf_body_nodes;
     for ([[maybe_unused]] const int i : IndexRange(iterations)) {
@@ -0,0 +1,529 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <algorithm>
+
+#include "MEM_guardedalloc.h"
+
+#include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_result_cache.hh"
+#include "NOD_geometry_nodes_values.hh"
+
+#include "BLI_implicit_sharing_ptr.hh"
+#include "BLI_listbase_iterator.hh"
+#include "BLI_memory_cache.hh"
+#include "BLI_memory_counter.hh"
+
+#include "DNA_curves_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_object_types.h"
+#include "DNA_pointcloud_types.h"
+
+#include "BKE_curves.hh"
+#include "BKE_customdata.hh"
+#include "BKE_geometry_nodes_reference_set.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_instances.hh"
+#include "BKE_mesh.hh"
+#include "BKE_node_legacy_types.hh"
+#include "BKE_node_runtime.hh"
+#include "BKE_node_socket_value.hh"
+
+#include "FN_lazy_function_execute.hh"
+
+namespace blender::nodes {
+
+using bke::GeometryComponent;
+using bke::GeometryNodesReferenceSet;
+using bke::GeometrySet;
+using bke::SocketValueVariant;
+
+/**
+ * Identifies the evaluation of a specific node in a specific compute context with specific
+ * inputs. Everything except for the context and node is stored in flattened arrays that are
+ * filled in a fixed order by #ResultKeyBuilder. Since all counts are stored explicitly as well,
+ * two keys with equal arrays also describe the same inputs.
+ */
+class GeometryNodeResultKey : public GenericKey {
+ public:
+  ComputeContextHash context_hash;
+  const bke::bNodeType *node_type = nullptr;
+  int32_t node_identifier = 0;
+  /** Node settings, counts, enums and pointers to referenced data. */
+  Vector<uint64_t> ints;
+  /** Raw node storage, attribute names and other strings. */
+  Vector<std::string> strings;
+  /** Copies of all non-geometry single value inputs. */
+  Vector<SocketValueVariant> values;
+  /**
+   * Keeps the arrays referenced by input geometries alive while the key is stored. Otherwise their
+   * memory could be reused by new data with the same address, which would make the key match
+   * wrongly. The data pointers themselves are part of #ints.
+   */
+  Vector<ImplicitSharingPtr<>> sharing_infos;
+  uint64_t hash_value = 0;
+
+  uint64_t hash() const override
+  {
+    return hash_value;
+  }
+
+  bool equal_to(const GenericKey &other) const override
+  {
+    const auto *other_key = dynamic_cast<const GeometryNodeResultKey *>(&other);
+    if (!other_key) {
+      return false;
+    }
+    if (hash_value != other_key->hash_value || context_hash != other_key->context_hash ||
+        node_type != other_key->node_type || node_identifier != other_key->node_identifier)
+    {
+      return false;
+    }
+    if (ints != other_key->ints || strings != other_key->strings) {
+      return false;
+    }
+    if (values.size() != other_key->values.size()) {
+      return false;
+    }
+    for (const int i : values.index_range()) {
+      const GPointer a = values[i].get_single_ptr();
+      const GPointer b = other_key->values[i].get_single_ptr();
+      if (a.type() != b.type() || !a.type()->is_equal(a.get(), b.get())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::unique_ptr<GenericKey> to_storable() const override
+  {
+    return std::make_unique<GeometryNodeResultKey>(*this);
+  }
+
+  void compute_hash()
+  {
+    hash_value = get_default_hash(context_hash, node_type, node_identifier);
+    hash_value = get_default_hash(hash_value, ints.as_span().hash(), strings.as_span().hash());
+    for (const SocketValueVariant &value : values) {
+      const GPointer ptr = value.get_single_ptr();
+      hash_value = hash_value * 33 ^ ptr.type()->hash(ptr.get());
+    }
+  }
+};
+
+class CachedGeometryNodeResult : public memory_cache::CachedValue {
+ public:
+  /** Values of the outputs that were computed by the node, indexed by lazy-function output. */
+  Array<std::optional<SocketValueVariant>> outputs;
+
+  void count_memory(MemoryCounter &memory) const override
+  {
+    for (const std::optional<SocketValueVariant> &value : outputs) {
+      if (value.has_value()) {
+        value->count_memory(memory);
+      }
+    }
+  }
+};
+
+/** Fills a #GeometryNodeResultKey. All methods return false if the inputs can't be cached. */
+class ResultKeyBuilder {
+ private:
+  GeometryNodeResultKey &key_;
+
+ public:
+  ResultKeyBuilder(GeometryNodeResultKey &key) : key_(key) {}
+
+  void add_node_settings(const bNode &node)
+  {
+    key_.ints.append(uint64_t(node.custom1));
+    key_.ints.append(uint64_t(node.custom2));
+    key_.ints.append(uint64_t(*reinterpret_cast<const uint32_t *>(&node.custom3)));
+    key_.ints.append(uint64_t(*reinterpret_cast<const uint32_t *>(&node.custom4)));
+    if (node.storage) {
+      key_.strings.append(
+          std::string(static_cast<const char *>(node.storage), MEM_allocN_len(node.storage)));
+    }
+    else {
+      key_.strings.append({});
+    }
+  }
+
+  bool add_input(const CPPType &type, const void *value)
+  {
+    if (type.is<SocketValueVariant>()) {
+      return this->add_socket_value(*static_cast<const SocketValueVariant *>(value));
+    }
+    if (type.is<GeoNodesMultiInput<SocketValueVariant>>()) {
+      const auto &multi_input = *static_cast<const GeoNodesMultiInput<SocketValueVariant> *>(
+          value);
+      key_.ints.append(uint64_t(multi_input.values.size()));
+      for (const SocketValueVariant &item : multi_input.values) {
+        if (!this->add_socket_value(item)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (type.is<bool>()) {
+      key_.ints.append(uint64_t(*static_cast<const bool *>(value)));
+      return true;
+    }
+    if (type.is<GeometryNodesReferenceSet>()) {
+      const auto &reference_set = *static_cast<const GeometryNodesReferenceSet *>(value);
+      if (!reference_set.names) {
+        key_.ints.append(0);
+        return true;
+      }
+      /* Sort the names, because the order in the set is arbitrary. */
+      Vector<StringRef> names(reference_set.names->begin(), reference_set.names->end());
+      std::sort(names.begin(), names.end());
+      key_.ints.append(uint64_t(names.size()));
+      for (const StringRef name : names) {
+        key_.strings.append(name);
+      }
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  bool add_socket_value(const SocketValueVariant &value)
+  {
+    if (!value.is_single()) {
+      /* Fields, grids and lists are not compared yet. */
+      return false;
+    }
+    const GPointer ptr = value.get_single_ptr();
+    const CPPType &type = *ptr.type();
+    if (type.is<GeometrySet>()) {
+      return this->add_geometry(*static_cast<const GeometrySet *>(ptr.get()));
+    }
+    if (type.is_any<Object *, Collection *, Image *, Tex *, Scene *, Text *, Mask *, bSound *>()) {
+      /* The data of these data-blocks may change without the pointer changing. Materials and
+       * fonts are fine, because they are only referenced by the output and are not read. */
+      return false;
+    }
+    if (!type.is_hashable() || !type.is_equality_comparable()) {
+      return false;
+    }
+    key_.values.append(value);
+    return true;
+  }
+
+  void add_shared_data(const ImplicitSharingInfo &sharing_info, const void *data)
+  {
+    sharing_info.add_user();
+    key_.sharing_infos.append(ImplicitSharingPtr<>(&sharing_info));
+    key_.ints.append(uint64_t(uintptr_t(data)));
+  }
+
+  void add_string(const char *str)
+  {
+    key_.strings.append(str ? str : "");
+  }
+
+  bool add_geometry(const GeometrySet &geometry)
+  {
+    if (geometry.has_bundle()) {
+      return false;
+    }
+    key_.strings.append(geometry.name);
+    const Vector<const GeometryComponent *> components = geometry.get_components();
+    key_.ints.append(uint64_t(components.size()));
+    for (const GeometryComponent *component : components) {
+      key_.ints.append(uint64_t(component->type()));
+      switch (component->type()) {
+        case GeometryComponent::Type::Mesh: {
+          const Mesh *mesh = static_cast<const bke::MeshComponent *>(component)->get();
+          if (!mesh || !this->add_mesh(*mesh)) {
+            return false;
+          }
+          break;
+        }
+        case GeometryComponent::Type::PointCloud: {
+          const PointCloud *pointcloud =
+              static_cast<const bke::PointCloudComponent *>(component)->get();
+          if (!pointcloud || !this->add_pointcloud(*pointcloud)) {
+            return false;
+          }
+          break;
+        }
+        case GeometryComponent::Type::Curve: {
+          const Curves *curves = static_cast<const bke::CurveComponent *>(component)->get();
+          if (!curves || !this->add_curves(*curves)) {
+            return false;
+          }
+          break;
+        }
+        case GeometryComponent::Type::Instance: {
+          const bke::Instances *instances =
+              static_cast<const bke::InstancesComponent *>(component)->get();
+          if (!instances || !this->add_instances(*instances)) {
+            return false;
+          }
+          break;
+        }
+        case GeometryComponent::Type::Volume:
+        case GeometryComponent::Type::Edit:
+        case GeometryComponent::Type::GreasePencil:
+          return false;
+      }
+    }
+    return true;
+  }
+
+  bool add_attributes(const bke::AttributeAccessor &attributes)
+  {
+    bool success = true;
+    int attributes_num = 0;
+    attributes.foreach_attribute([&](const bke::AttributeIter &iter) {
+      if (!iter.storage_type) {
+        /* Vertex groups are handled separately by the caller. */
+        return;
+      }
+      const bke::GAttributeReader attribute = iter.get();
+      if (!attribute.sharing_info || !attribute.varray.is_span()) {
+        success = false;
+        iter.stop();
+        return;
+      }
+      key_.strings.append(iter.name);
+      key_.ints.append(uint64_t(iter.domain));
+      key_.ints.append(uint64_t(iter.data_type));
+      this->add_shared_data(*attribute.sharing_info, attribute.varray.get_internal_span().data());
+      attributes_num++;
+    });
+    key_.ints.append(uint64_t(attributes_num));
+    return success;
+  }
+
+  bool add_vertex_groups(const CustomData &data, const ListBaseT<bDeformGroup> &vertex_group_names)
+  {
+    int groups_num = 0;
+    for (const bDeformGroup &group : vertex_group_names) {
+      key_.strings.append(group.name);
+      groups_num++;
+    }
+    key_.ints.append(uint64_t(groups_num));
+    const int layer_index = CustomData_get_layer_index(&data, CD_MDEFORMVERT);
+    if (layer_index == -1) {
+      key_.ints.append(0);
+      return true;
+    }
+    const CustomDataLayer &layer = data.layers[layer_index];
+    if (!layer.sharing_info) {
+      return false;
+    }
+    this->add_shared_data(*layer.sharing_info, layer.data);
+    return true;
+  }
+
+  void add_materials(Material *const *materials, const int materials_num)
+  {
+    key_.ints.append(uint64_t(materials_num));
+    for (const int i : IndexRange(materials_num)) {
+      key_.ints.append(uint64_t(uintptr_t(materials[i])));
+    }
+  }
+
+  bool add_mesh(const Mesh &mesh)
+  {
+    key_.ints.extend({uint64_t(mesh.verts_num),
+                      uint64_t(mesh.edges_num),
+                      uint64_t(mesh.faces_num),
+                      uint64_t(mesh.corners_num),
+                      uint64_t(mesh.flag),
+                      uint64_t(mesh.texspace_flag),
+                      uint64_t(mesh.vertex_group_active_index)});
+    for (const int i : IndexRange(3)) {
+      key_.ints.append(uint64_t(*reinterpret_cast<const uint32_t *>(&mesh.texspace_location[i])));
+      key_.ints.append(uint64_t(*reinterpret_cast<const uint32_t *>(&mesh.texspace_size[i])));
+    }
+    this->add_string(mesh.active_color_attribute);
+    this->add_string(mesh.default_color_attribute);
+    this->add_string(mesh.active_uv_map_attribute);
+    this->add_string(mesh.default_uv_map_attribute);
+    this->add_materials(mesh.mat, mesh.totcol);
+    if (mesh.faces_num > 0) {
+      if (!mesh.runtime->face_offsets_sharing_info) {
+        return false;
+      }
+      this->add_shared_data(*mesh.runtime->face_offsets_sharing_info, mesh.face_offset_indices);
+    }
+    if (!this->add_vertex_groups(mesh.vert_data, mesh.vertex_group_names)) {
+      return false;
+    }
+    return this->add_attributes(mesh.attributes());
+  }
+
+  bool add_pointcloud(const PointCloud &pointcloud)
+  {
+    key_.ints.extend({uint64_t(pointcloud.totpoint), uint64_t(pointcloud.flag)});
+    this->add_materials(pointcloud.mat, pointcloud.totcol);
+    return this->add_attributes(pointcloud.attributes());
+  }
+
+  bool add_curves(const Curves &curves_id)
+  {
+    const bke::CurvesGeometry &curves = curves_id.geometry.wrap();
+    key_.ints.extend({uint64_t(curves.points_num()),
+                      uint64_t(curves.curves_num()),
+                      uint64_t(curves_id.flag),
+                      uint64_t(curves_id.symmetry),
+                      uint64_t(curves_id.selection_domain),
+                      uint64_t(uintptr_t(curves_id.surface))});
+    this->add_string(curves_id.surface_uv_map);
+    this->add_materials(curves_id.mat, curves_id.totcol);
+    if (curves.curves_num() > 0) {
+      if (!curves.runtime->curve_offsets_sharing_info) {
+        return false;
+      }
+      this->add_shared_data(*curves.runtime->curve_offsets_sharing_info,
+                            curves.offsets().data());
+    }
+    if (curves.custom_knots != nullptr) {
+      if (!curves.runtime->custom_knots_sharing_info) {
+        return false;
+      }
+      this->add_shared_data(*curves.runtime->custom_knots_sharing_info, curves.custom_knots);
+    }
+    if (!this->add_vertex_groups(curves.point_data, curves.vertex_group_names)) {
+      return false;
+    }
+    return this->add_attributes(curves.attributes());
+  }
+
+  bool add_instances(const bke::Instances &instances)
+  {
+    key_.ints.append(uint64_t(instances.instances_num()));
+    const Span<bke::InstanceReference> references = instances.references();
+    key_.ints.append(uint64_t(references.size()));
+    for (const bke::InstanceReference &reference : references) {
+      key_.ints.append(uint64_t(reference.type()));
+      switch (reference.type()) {
+        case bke::InstanceReference::Type::None:
+          break;
+        case bke::InstanceReference::Type::GeometrySet:
+          if (!this->add_geometry(reference.geometry_set())) {
+            return false;
+          }
+          break;
+        case bke::InstanceReference::Type::Object:
+        case bke::InstanceReference::Type::Collection:
+          /* The evaluated geometry of referenced objects may change without the reference
+           * changing. */
+          return false;
+      }
+    }
+    return this->add_attributes(instances.attributes());
+  }
+};
+
+bool geometry_node_supports_result_cache(const bNode &node)
+{
+  if (ELEM(node.type_legacy,
+           /* Has side effects. */
+           GEO_NODE_VIEWER,
+           /* Depend on data from the evaluation context. */
+           GEO_NODE_DEFORM_CURVES_ON_SURFACE,
+           GEO_NODE_MESH_TO_VOLUME,
+           GEO_NODE_TOOL_SET_SELECTION))
+  {
+    return false;
+  }
+  auto is_geometry_socket = [](const bNodeSocket *socket) {
+    return socket->type == SOCK_GEOMETRY;
+  };
+  return std::any_of(
+             node.input_sockets().begin(), node.input_sockets().end(), is_geometry_socket) &&
+         std::any_of(
+             node.output_sockets().begin(), node.output_sockets().end(), is_geometry_socket);
+}
+
+bool execute_geometry_node_with_result_cache(
+    const bNode &node,
+    const lf::LazyFunction &fn,
+    lf::Params &params,
+    const lf::Context &context,
+    const FunctionRef<void(lf::Params &params)> execute_fn)
+{
+  const auto &user_data = *static_cast<GeoNodesUserData *>(context.user_data);
+  const auto &local_user_data = *static_cast<GeoNodesLocalUserData *>(context.local_user_data);
+  if (local_user_data.try_get_tree_logger(user_data)) {
+    /* Warnings and other data logged by the node would be missing when the cached result is
+     * used. */
+    return false;
+  }
+
+  const Span<lf::Input> inputs = fn.inputs();
+  const Span<lf::Output> outputs = fn.outputs();
+  for (const lf::Output &output : outputs) {
+    if (!output.type->is<SocketValueVariant>()) {
+      return false;
+    }
+  }
+
+  GeometryNodeResultKey key;
+  key.context_hash = user_data.compute_context->hash();
+  key.node_type = node.typeinfo;
+  key.node_identifier = node.identifier;
+  ResultKeyBuilder key_builder{key};
+  key_builder.add_node_settings(node);
+  for (const int i : inputs.index_range()) {
+    if (!key_builder.add_input(*inputs[i].type, params.try_get_input_data_ptr(i))) {
+      return false;
+    }
+  }
+  /* The node only computes the outputs that are used, so the usages are part of the key too. */
+  Array<lf::ValueUsage> output_usages(outputs.size());
+  Array<bool> set_outputs(outputs.size());
+  for (const int i : outputs.index_range()) {
+    output_usages[i] = params.get_output_usage(i);
+    set_outputs[i] = params.output_was_set(i);
+    key.ints.append(uint64_t(output_usages[i]) | (uint64_t(set_outputs[i]) << 8));
+  }
+  key.compute_hash();
+
+  const std::shared_ptr<const CachedGeometryNodeResult> result =
+      memory_cache::get<CachedGeometryNodeResult>(key, [&]() {
+        /* Evaluate the node with separate output buffers so that the outputs can be copied into
+         * the cache before they are passed on. */
+        Array<GMutablePointer> input_ptrs(inputs.size());
+        for (const int i : inputs.index_range()) {
+          input_ptrs[i] = {inputs[i].type, params.try_get_input_data_ptr(i)};
+        }
+        Array<TypedBuffer<SocketValueVariant>> output_buffers(outputs.size());
+        Array<GMutablePointer> output_ptrs(outputs.size());
+        for (const int i : outputs.index_range()) {
+          output_ptrs[i] = {outputs[i].type, output_buffers[i].ptr()};
+        }
+        Array<std::optional<lf::ValueUsage>> input_usages(inputs.size());
+        Array<bool> node_set_outputs = set_outputs;
+        lf::BasicParams node_params{
+            fn, input_ptrs, output_ptrs, input_usages, output_usages, node_set_outputs};
+        execute_fn(node_params);
+
+        auto cached_result = std::make_unique<CachedGeometryNodeResult>();
+        cached_result->outputs.reinitialize(outputs.size());
+        for (const int i : outputs.index_range()) {
+          if (node_set_outputs[i] && !set_outputs[i]) {
+            cached_result->outputs[i] = std::move(*output_buffers[i]);
+            std::destroy_at(output_buffers[i].ptr());
+          }
+        }
+        return cached_result;
+      });
+
+  for (const int i : outputs.index_range()) {
+    const std::optional<SocketValueVariant> &value = result->outputs[i];
+    if (value.has_value() && !params.output_was_set(i)) {
+      new (params.get_output_data_ptr(i)) SocketValueVariant(*value);
+      params.output_set(i);
+    }
+  }
+  return true;
+}
+
+}  // namespace blender::nodes
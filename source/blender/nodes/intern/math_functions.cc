@@ -2,10 +2,244 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_simd.hh"
+
 #include "NOD_math_functions.hh"
 
 namespace blender::nodes {
 
+#if BLI_HAVE_SSE2
+
+/* -------------------------------------------------------------------- */
+/** \name SIMD Math Functions
+ *
+ * Compilers often fail to vectorize the generic multi-function loops, especially for #float3
+ * values. The simplest and most common operations are therefore implemented with explicit SIMD
+ * instructions. The #float3 versions work on the flattened float arrays, because these operations
+ * are the same for every component.
+ * \{ */
+
+enum class SIMDMathOperation {
+  Add,
+  Subtract,
+  Multiply,
+  Divide,
+  Minimum,
+  Maximum,
+};
+
+template<SIMDMathOperation Op> BLI_INLINE __m128 simd_math(const __m128 a, const __m128 b)
+{
+  if constexpr (Op == SIMDMathOperation::Add) {
+    return _mm_add_ps(a, b);
+  }
+  else if constexpr (Op == SIMDMathOperation::Subtract) {
+    return _mm_sub_ps(a, b);
+  }
+  else if constexpr (Op == SIMDMathOperation::Multiply) {
+    return _mm_mul_ps(a, b);
+  }
+  else if constexpr (Op == SIMDMathOperation::Divide) {
+    /* Same as #safe_divide, the result is zero when dividing by zero. */
+    return _mm_and_ps(_mm_div_ps(a, b), _mm_cmpneq_ps(b, _mm_setzero_ps()));
+  }
+  else if constexpr (Op == SIMDMathOperation::Minimum) {
+    /* The argument order matches `std::min` when there are NaN values. */
+    return _mm_min_ps(b, a);
+  }
+  else if constexpr (Op == SIMDMathOperation::Maximum) {
+    return _mm_max_ps(b, a);
+  }
+}
+
+template<SIMDMathOperation Op> BLI_INLINE float scalar_math(const float a, const float b)
+{
+  if constexpr (Op == SIMDMathOperation::Add) {
+    return a + b;
+  }
+  else if constexpr (Op == SIMDMathOperation::Subtract) {
+    return a - b;
+  }
+  else if constexpr (Op == SIMDMathOperation::Multiply) {
+    return a * b;
+  }
+  else if constexpr (Op == SIMDMathOperation::Divide) {
+    return safe_divide(a, b);
+  }
+  else if constexpr (Op == SIMDMathOperation::Minimum) {
+    return std::min(a, b);
+  }
+  else if constexpr (Op == SIMDMathOperation::Maximum) {
+    return std::max(a, b);
+  }
+}
+
+/**
+ * An input that is either a span or a single value. Single values are repeated in a pattern of
+ * 12 floats, which contains a whole number of elements for one and three components and fills
+ * three SIMD registers.
+ */
+struct SIMDMathInput {
+  static constexpr int pattern_size = 12;
+  const float *span = nullptr;
+  std::array<float, pattern_size> pattern;
+};
+
+template<int Components>
+static bool get_simd_math_input(const GVArray &varray, SIMDMathInput &r_input)
+{
+  BLI_assert(varray.type().size == sizeof(float) * Components);
+  if (varray.is_span()) {
+    r_input.span = static_cast<const float *>(varray.get_internal_span().data());
+    return true;
+  }
+  if (varray.is_single()) {
+    std::array<float, Components> value;
+    varray.get_internal_single(value.data());
+    for (const int i : IndexRange(SIMDMathInput::pattern_size)) {
+      r_input.pattern[i] = value[i % Components];
+    }
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Process the floats in the given range. The range has to start at the first component of an
+ * element, so that the pattern of single inputs is aligned.
+ */
+template<SIMDMathOperation Op>
+static void simd_math_range(const SIMDMathInput &a,
+                            const SIMDMathInput &b,
+                            const IndexRange range,
+                            float *__restrict dst)
+{
+  constexpr int pattern_size = SIMDMathInput::pattern_size;
+  std::array<__m128, 3> a_pattern;
+  std::array<__m128, 3> b_pattern;
+  for (const int i : IndexRange(3)) {
+    a_pattern[i] = _mm_loadu_ps(a.pattern.data() + i * 4);
+    b_pattern[i] = _mm_loadu_ps(b.pattern.data() + i * 4);
+  }
+
+  int64_t i = range.start();
+  for (; i + pattern_size <= range.one_after_last(); i += pattern_size) {
+    for (const int j : IndexRange(3)) {
+      const __m128 a_value = a.span ? _mm_loadu_ps(a.span + i + j * 4) : a_pattern[j];
+      const __m128 b_value = b.span ? _mm_loadu_ps(b.span + i + j * 4) : b_pattern[j];
+      _mm_storeu_ps(dst + i + j * 4, simd_math<Op>(a_value, b_value));
+    }
+  }
+  for (; i < range.one_after_last(); i++) {
+    const int64_t pattern_i = (i - range.start()) % pattern_size;
+    const float a_value = a.span ? a.span[i] : a.pattern[pattern_i];
+    const float b_value = b.span ? b.span[i] : b.pattern[pattern_i];
+    dst[i] = scalar_math<Op>(a_value, b_value);
+  }
+}
+
+template<SIMDMathOperation Op, int Components> class SIMDMathFunction : public mf::MultiFunction {
+ private:
+  /** Used when the inputs are not spans or single values. */
+  const mf::MultiFunction &fallback_fn_;
+
+ public:
+  SIMDMathFunction(const mf::MultiFunction &fallback_fn) : fallback_fn_(fallback_fn)
+  {
+    BLI_assert(fallback_fn.param_amount() == 3);
+    this->set_signature(&fallback_fn.signature());
+  }
+
+  void call(const IndexMask &mask, mf::Params params, mf::Context context) const override
+  {
+    SIMDMathInput a;
+    SIMDMathInput b;
+    if (!get_simd_math_input<Components>(params.readonly_single_input(0), a) ||
+        !get_simd_math_input<Components>(params.readonly_single_input(1), b))
+    {
+      fallback_fn_.call(mask, params, context);
+      return;
+    }
+    float *dst = static_cast<float *>(params.uninitialized_single_output(2).data());
+
+    mask.foreach_segment_optimized([&](const auto segment) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(segment)>, IndexRange>) {
+        const IndexRange float_range(segment.start() * Components, segment.size() * Components);
+        simd_math_range<Op>(a, b, float_range, dst);
+      }
+      else {
+        for (const int64_t i : segment) {
+          for (const int component : IndexRange(Components)) {
+            const int64_t float_i = i * Components + component;
+            const float a_value = a.span ? a.span[float_i] : a.pattern[component];
+            const float b_value = b.span ? b.span[float_i] : b.pattern[component];
+            dst[float_i] = scalar_math<Op>(a_value, b_value);
+          }
+        }
+      }
+    });
+  }
+};
+
+template<SIMDMathOperation Op, int Components>
+static const mf::MultiFunction &get_simd_math_function(const mf::MultiFunction &fallback_fn)
+{
+  static const SIMDMathFunction<Op, Components> fn{fallback_fn};
+  return fn;
+}
+
+#endif
+
+const mf::MultiFunction *get_float_math_simd_function(const int operation,
+                                                      const mf::MultiFunction &fallback_fn)
+{
+#if BLI_HAVE_SSE2
+  using Op = SIMDMathOperation;
+  switch (operation) {
+    case NODE_MATH_ADD:
+      return &get_simd_math_function<Op::Add, 1>(fallback_fn);
+    case NODE_MATH_SUBTRACT:
+      return &get_simd_math_function<Op::Subtract, 1>(fallback_fn);
+    case NODE_MATH_MULTIPLY:
+      return &get_simd_math_function<Op::Multiply, 1>(fallback_fn);
+    case NODE_MATH_DIVIDE:
+      return &get_simd_math_function<Op::Divide, 1>(fallback_fn);
+    case NODE_MATH_MINIMUM:
+      return &get_simd_math_function<Op::Minimum, 1>(fallback_fn);
+    case NODE_MATH_MAXIMUM:
+      return &get_simd_math_function<Op::Maximum, 1>(fallback_fn);
+  }
+#endif
+  UNUSED_VARS(operation, fallback_fn);
+  return nullptr;
+}
+
+const mf::MultiFunction *get_vector_math_simd_function(const int operation,
+                                                       const mf::MultiFunction &fallback_fn)
+{
+#if BLI_HAVE_SSE2
+  using Op = SIMDMathOperation;
+  switch (operation) {
+    case NODE_VECTOR_MATH_ADD:
+      return &get_simd_math_function<Op::Add, 3>(fallback_fn);
+    case NODE_VECTOR_MATH_SUBTRACT:
+      return &get_simd_math_function<Op::Subtract, 3>(fallback_fn);
+    case NODE_VECTOR_MATH_MULTIPLY:
+      return &get_simd_math_function<Op::Multiply, 3>(fallback_fn);
+    case NODE_VECTOR_MATH_DIVIDE:
+      return &get_simd_math_function<Op::Divide, 3>(fallback_fn);
+    case NODE_VECTOR_MATH_MINIMUM:
+      return &get_simd_math_function<Op::Minimum, 3>(fallback_fn);
+    case NODE_VECTOR_MATH_MAXIMUM:
+      return &get_simd_math_function<Op::Maximum, 3>(fallback_fn);
+  }
+#endif
+  UNUSED_VARS(operation, fallback_fn);
+  return nullptr;
+}
+
+/** \} */
+
 static const mf::MultiFunction *get_base_multi_function(const bNode &node)
 {
   const int mode = node.custom1;
@@ -28,6 +262,9 @@ static const mf::MultiFunction *get_base_multi_function(const bNode &node)
         base_fn = &fn;
       });
   if (base_fn != nullptr) {
+    if (const mf::MultiFunction *simd_fn = get_float_math_simd_function(mode, *base_fn)) {
+      return simd_fn;
+    }
     return base_fn;
   }
 
@@ -63,10 +300,33 @@ class ClampWrapperFunction : public mf::MultiFunction {
     /* This has actually been initialized in the call above. */
     MutableSpan<float> results = params.uninitialized_single_output<float>(output_param_index);
 
+#if BLI_HAVE_SSE2
+    mask.foreach_segment_optimized([&](const auto segment) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(segment)>, IndexRange>) {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        int64_t i = segment.start();
+        for (; i + 4 <= segment.one_after_last(); i += 4) {
+          /* The argument order keeps NaN values unchanged, like #CLAMP. */
+          const __m128 value = _mm_loadu_ps(&results[i]);
+          _mm_storeu_ps(&results[i], _mm_min_ps(one, _mm_max_ps(zero, value)));
+        }
+        for (; i < segment.one_after_last(); i++) {
+          CLAMP(results[i], 0.0f, 1.0f);
+        }
+      }
+      else {
+        for (const int64_t i : segment) {
+          CLAMP(results[i], 0.0f, 1.0f);
+        }
+      }
+    });
+#else
     mask.foreach_index_optimized<int>([&](const int i) {
       float &value = results[i];
       CLAMP(value, 0.0f, 1.0f);
     });
+#endif
   }
 };
 
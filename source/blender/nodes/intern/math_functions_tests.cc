@@ -0,0 +1,107 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
+
+#include "NOD_math_functions.hh"
+
+namespace blender::nodes::tests {
+
+static Array<float> random_floats(const int64_t size, const uint32_t seed)
+{
+  RandomNumberGenerator rng(seed);
+  Array<float> values(size);
+  for (float &value : values) {
+    value = rng.get_float() * 4.0f - 2.0f;
+  }
+  /* Make sure that division by zero is tested too. */
+  values[size / 2] = 0.0f;
+  return values;
+}
+
+static void call_float_math(const mf::MultiFunction &fn,
+                            const IndexMask &mask,
+                            const GVArray &a,
+                            const GVArray &b,
+                            MutableSpan<float> r_result)
+{
+  mf::ParamsBuilder params{fn, &mask};
+  mf::ContextBuilder context;
+  params.add_readonly_single_input(a);
+  params.add_readonly_single_input(b);
+  params.add_uninitialized_single_output(r_result);
+  fn.call(mask, params, context);
+}
+
+TEST(math_functions, SIMDFloatMathMatchesScalar)
+{
+  const int64_t size = 1003;
+  const Array<float> a = random_floats(size, 0);
+  const Array<float> b = random_floats(size, 1);
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      IndexRange(size), memory, [](const int64_t i) { return i % 7 != 3; });
+
+  for (const int operation : {NODE_MATH_ADD,
+                              NODE_MATH_SUBTRACT,
+                              NODE_MATH_MULTIPLY,
+                              NODE_MATH_DIVIDE,
+                              NODE_MATH_MINIMUM,
+                              NODE_MATH_MAXIMUM})
+  {
+    try_dispatch_float_math_fl_fl_to_fl(operation, [&](auto exec_preset, auto function, auto) {
+      const auto scalar_fn = mf::build::SI2_SO<float, float, float>(
+          "Scalar", function, exec_preset);
+      const mf::MultiFunction *simd_fn = get_float_math_simd_function(operation, scalar_fn);
+      if (simd_fn == nullptr) {
+        /* SIMD is not supported on this platform. */
+        return;
+      }
+      for (const GVArray &b_varray : {GVArray(VArray<float>::from_span(b)),
+                                      GVArray(VArray<float>::from_single(0.5f, size))})
+      {
+        const GVArray a_varray = VArray<float>::from_span(a);
+        Array<float> expected(size, 0.0f);
+        Array<float> result(size, 0.0f);
+        call_float_math(scalar_fn, mask, a_varray, b_varray, expected);
+        call_float_math(*simd_fn, mask, a_varray, b_varray, result);
+        EXPECT_EQ_SPAN<float>(expected, result);
+      }
+    });
+  }
+}
+
+TEST(math_functions_performance, SIMDFloatMath)
+{
+  const int64_t size = 10'000'000;
+  const Array<float> a = random_floats(size, 0);
+  const Array<float> b = random_floats(size, 1);
+  const IndexMask mask(size);
+  Array<float> result(size);
+
+  auto benchmark = [&](auto exec_preset, auto function, auto /*info*/) {
+    const auto scalar_fn = mf::build::SI2_SO<float, float, float>("Scalar", function, exec_preset);
+    const mf::MultiFunction *simd_fn = get_float_math_simd_function(NODE_MATH_MULTIPLY,
+                                                                     scalar_fn);
+    const GVArray a_varray = VArray<float>::from_span(a);
+    const GVArray b_varray = VArray<float>::from_span(b);
+    for ([[maybe_unused]] const int i : IndexRange(5)) {
+      {
+        SCOPED_TIMER("scalar");
+        call_float_math(scalar_fn, mask, a_varray, b_varray, result);
+      }
+      if (simd_fn != nullptr) {
+        SCOPED_TIMER("simd");
+        call_float_math(*simd_fn, mask, a_varray, b_varray, result);
+      }
+    }
+  };
+  try_dispatch_float_math_fl_fl_to_fl(NODE_MATH_MULTIPLY, benchmark);
+}
+
+}  // namespace blender::nodes::tests
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <array>
+
 #include "node_shader_util.hh"
 #include "node_util.hh"
 
@@ -369,6 +371,32 @@ class NoiseFunction : public mf::MultiFunction {
             }
           });
         }
+        else if (compute_factor && type_ == SHD_NOISE_FBM && detail.is_single() &&
+                 roughness.is_single() && lacunarity.is_single() && distortion.is_single() &&
+                 distortion.get_internal_single() == 0.0f)
+        {
+          /* Common case that can evaluate many positions at once, which is faster. */
+          const float detail_single = math::clamp(detail.get_internal_single(), 0.0f, 15.0f);
+          const float roughness_single = math::max(roughness.get_internal_single(), 0.0f);
+          const float lacunarity_single = lacunarity.get_internal_single();
+          constexpr int64_t chunk_size = 512;
+          std::array<float3, chunk_size> positions;
+          std::array<float, chunk_size> values;
+          for (int64_t start = 0; start < mask.size(); start += chunk_size) {
+            const IndexMask chunk = mask.slice(start, std::min(chunk_size, mask.size() - start));
+            chunk.foreach_index([&](const int64_t i, const int64_t pos) {
+              positions[pos] = vector[i] * scale[i];
+            });
+            noise::perlin_fbm(Span(positions.data(), chunk.size()),
+                              detail_single,
+                              roughness_single,
+                              lacunarity_single,
+                              normalize_,
+                              MutableSpan(values.data(), chunk.size()));
+            chunk.foreach_index(
+                [&](const int64_t i, const int64_t pos) { r_factor[i] = values[pos]; });
+          }
+        }
         else if (compute_factor) {
           mask.foreach_index([&](const int64_t i) {
             const float3 position = vector[i] * scale[i];
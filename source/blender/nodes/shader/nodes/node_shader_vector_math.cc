@@ -276,6 +276,9 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
         multi_fn = &fn;
       });
   if (multi_fn != nullptr) {
+    if (const mf::MultiFunction *simd_fn = get_vector_math_simd_function(operation, *multi_fn)) {
+      return simd_fn;
+    }
     return multi_fn;
   }
 
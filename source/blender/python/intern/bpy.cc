@@ -44,6 +44,7 @@
 #include "bpy_rna.hh"
 #include "bpy_rna_data.hh"
 #include "bpy_rna_gizmo.hh"
+#include "bpy_rna_id_collection.hh"
 #include "bpy_rna_types_capi.hh"
 #include "bpy_utils_previews.hh"
 #include "bpy_utils_units.hh"
@@ -774,6 +775,7 @@ void BPy_init_modules(bContext *C)
   BPY_library_load_type_ready();
 
   BPY_rna_data_context_type_ready();
+  BPY_rna_id_collection_batch_edit_type_ready();
 
   BPY_rna_gizmo_module(mod);
 
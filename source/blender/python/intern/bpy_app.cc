@@ -47,6 +47,8 @@
 #include "GPU_init_exit.hh"
 #include "GPU_shader.hh"
 
+#include "IMB_moviecache.hh"
+
 #include "UI_interface_icons.hh"
 
 #include "ED_undo.hh"
@@ -816,6 +818,44 @@ static PyObject *bpy_app_memory_usage_undo(PyObject * /*self*/, PyObject * /*arg
   return PyLong_FromSize_t(total_memory);
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_app_memory_usage_movie_cache_doc,
+    ".. staticmethod:: memory_usage_movie_cache()\n"
+    "\n"
+    "   Get memory usage of the cache shared by images, movie clips and display buffers.\n"
+    "\n"
+    "   :return: Memory usage of the cached image buffers in bytes.\n"
+    "   :rtype: int\n");
+
+static PyObject *bpy_app_memory_usage_movie_cache(PyObject * /*self*/, PyObject * /*args*/)
+{
+  return PyLong_FromSize_t(IMB_moviecache_get_memory_in_use());
+}
+
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_app_memory_usage_by_category_doc,
+    ".. staticmethod:: memory_usage_by_category()\n"
+    "\n"
+    "   Get the memory usage per category that allocations are tagged with, like \"Depsgraph\"\n"
+    "   or \"Image\". Allocations that are not tagged are counted as \"Other\".\n"
+    "   The values are approximate.\n"
+    "\n"
+    "   :return: Memory usage in bytes keyed by the category name.\n"
+    "   :rtype: dict[str, int]\n");
+
+static PyObject *bpy_app_memory_usage_by_category(PyObject * /*self*/, PyObject * /*args*/)
+{
+  PyObject *result = PyDict_New();
+  for (int category = 0; category < MEM_memory_categories_num(); category++) {
+    PyObject *value = PyLong_FromSize_t(MEM_memory_category_in_use(category));
+    PyDict_SetItemString(result, MEM_memory_category_name(category), value);
+    Py_DECREF(value);
+  }
+  return result;
+}
+
 static PyMethodDef bpy_app_methods[] = {
     {"is_job_running",
      reinterpret_cast<PyCFunction>(bpy_app_is_job_running),
@@ -829,6 +869,14 @@ static PyMethodDef bpy_app_methods[] = {
      static_cast<PyCFunction>(bpy_app_memory_usage_undo),
      METH_NOARGS | METH_STATIC,
      bpy_app_memory_usage_undo_doc},
+    {"memory_usage_movie_cache",
+     static_cast<PyCFunction>(bpy_app_memory_usage_movie_cache),
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memory_usage_movie_cache_doc},
+    {"memory_usage_by_category",
+     static_cast<PyCFunction>(bpy_app_memory_usage_by_category),
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memory_usage_by_category_doc},
     {nullptr, nullptr, 0, nullptr},
 };
 
@@ -5907,6 +5907,58 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return false;
 }
 
+/**
+ * Get the raw type matching the items of a buffer, to pass buffers with a type that doesn't match
+ * the property to the raw access functions directly. Those convert the values in bulk, which is
+ * much faster than going through the buffer as a Python sequence.
+ */
+static RawPropertyType foreach_raw_type_from_buffer(const Py_buffer &buf)
+{
+  const char f = buf.format ? *buf.format : 'B'; /* B is assumed when not set */
+  RawPropertyType raw_type;
+  switch (f) {
+    case 'b':
+      raw_type = PROP_RAW_INT8;
+      break;
+    case 'B':
+      raw_type = PROP_RAW_UINT8;
+      break;
+    case 'h':
+      raw_type = PROP_RAW_SHORT;
+      break;
+    case 'H':
+      raw_type = PROP_RAW_UINT16;
+      break;
+    case 'i':
+      raw_type = PROP_RAW_INT;
+      break;
+    case 'l':
+    case 'q':
+      raw_type = PROP_RAW_INT64;
+      break;
+    case 'L':
+    case 'Q':
+      raw_type = PROP_RAW_UINT64;
+      break;
+    case '?':
+      raw_type = PROP_RAW_BOOLEAN;
+      break;
+    case 'f':
+      raw_type = PROP_RAW_FLOAT;
+      break;
+    case 'd':
+      raw_type = PROP_RAW_DOUBLE;
+      break;
+    default:
+      return PROP_RAW_UNSET;
+  }
+  /* The size of `long` depends on the platform. */
+  if (buf.itemsize != Py_ssize_t(RNA_raw_type_sizeof(raw_type))) {
+    return PROP_RAW_UNSET;
+  }
+  return raw_type;
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = nullptr;
@@ -5958,6 +6010,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
           ok = RNA_property_collection_raw_set(
               nullptr, &self->ptr.value(), self->prop, attr, buf.buf, raw_type, tot);
         }
+        else {
+          const RawPropertyType buf_raw_type = foreach_raw_type_from_buffer(buf);
+          if (buf_raw_type != PROP_RAW_UNSET) {
+            buffer_is_compat = true;
+            ok = RNA_property_collection_raw_set(
+                nullptr, &self->ptr.value(), self->prop, attr, buf.buf, buf_raw_type, tot);
+          }
+        }
 
         PyBuffer_Release(&buf);
       }
@@ -6034,6 +6094,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
           ok = RNA_property_collection_raw_get(
               nullptr, &self->ptr.value(), self->prop, attr, buf.buf, raw_type, tot);
         }
+        else if (!buf.readonly) {
+          const RawPropertyType buf_raw_type = foreach_raw_type_from_buffer(buf);
+          if (buf_raw_type != PROP_RAW_UNSET) {
+            buffer_is_compat = true;
+            ok = RNA_property_collection_raw_get(
+                nullptr, &self->ptr.value(), self->prop, attr, buf.buf, buf_raw_type, tot);
+          }
+        }
 
         PyBuffer_Release(&buf);
       }
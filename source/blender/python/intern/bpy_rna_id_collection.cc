@@ -18,10 +18,13 @@
 
 #include "BKE_bpath.hh"
 #include "BKE_global.hh"
+#include "BKE_layer.hh"
 #include "BKE_lib_id.hh"
 #include "BKE_lib_query.hh"
 #include "BKE_main.hh"
 
+#include "DEG_depsgraph_build.hh"
+
 #include "DNA_ID.h"
 /* Those following are only to support hack of not listing some internal
  * 'backward' pointers in generated user_map. */
@@ -942,6 +945,170 @@ static PyObject *bpy_orphans_purge(PyObject *self, PyObject *args, PyObject *kwd
   return PyLong_FromSize_t(num_datablocks_deleted);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Batch Edit Context Manager
+ *
+ * Creating or linking many IDs from Python re-synchronizes the view layers of all scenes after
+ * every change. This context manager forbids that resync and does it only once on exit.
+ * \{ */
+
+struct BPy_BatchEditContext {
+  PyObject_HEAD /* Required Python macro. */
+  Main *bmain;
+  /** Whether #BKE_layer_collection_resync_forbid has been called by this context. */
+  bool is_active;
+};
+
+static PyObject *bpy_batch_edit_context_enter(BPy_BatchEditContext *self);
+static PyObject *bpy_batch_edit_context_exit(BPy_BatchEditContext *self, PyObject *args);
+
+#ifdef __GNUC__
+#  ifdef __clang__
+#    pragma clang diagnostic push
+#    pragma clang diagnostic ignored "-Wcast-function-type"
+#  else
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wcast-function-type"
+#  endif
+#endif
+
+static PyMethodDef bpy_batch_edit_context_methods[] = {
+    {"__enter__", reinterpret_cast<PyCFunction>(bpy_batch_edit_context_enter), METH_NOARGS},
+    {"__exit__", reinterpret_cast<PyCFunction>(bpy_batch_edit_context_exit), METH_VARARGS},
+    {nullptr} /* sentinel */
+};
+
+#ifdef __GNUC__
+#  ifdef __clang__
+#    pragma clang diagnostic pop
+#  else
+#    pragma GCC diagnostic pop
+#  endif
+#endif
+
+static void bpy_batch_edit_context_finish(BPy_BatchEditContext *self)
+{
+  if (!self->is_active) {
+    return;
+  }
+  self->is_active = false;
+  BKE_layer_collection_resync_allow();
+  /* Objects and collections may have been added, removed or remapped in the meantime, so the
+   * caches are rebuilt too. This does nothing when an outer batch edit is still active. */
+  BKE_main_collection_sync_remap(self->bmain);
+  DEG_relations_tag_update(self->bmain);
+  WM_main_add_notifier(NC_WINDOW, nullptr);
+}
+
+static void bpy_batch_edit_context_dealloc(BPy_BatchEditContext *self)
+{
+  bpy_batch_edit_context_finish(self);
+  PyObject_Del(self);
+}
+
+static PyTypeObject bpy_batch_edit_context_Type = {
+    /*ob_base*/ PyVarObject_HEAD_INIT(nullptr, 0)
+    /*tp_name*/ "bpy_batch_edit_context",
+    /*tp_basicsize*/ sizeof(BPy_BatchEditContext),
+    /*tp_itemsize*/ 0,
+    /*tp_dealloc*/ reinterpret_cast<destructor>(bpy_batch_edit_context_dealloc),
+    /*tp_vectorcall_offset*/ 0,
+    /*tp_getattr*/ nullptr,
+    /*tp_setattr*/ nullptr,
+    /*tp_as_async*/ nullptr,
+    /*tp_repr*/ nullptr,
+    /*tp_as_number*/ nullptr,
+    /*tp_as_sequence*/ nullptr,
+    /*tp_as_mapping*/ nullptr,
+    /*tp_hash*/ nullptr,
+    /*tp_call*/ nullptr,
+    /*tp_str*/ nullptr,
+    /*tp_getattro*/ nullptr,
+    /*tp_setattro*/ nullptr,
+    /*tp_as_buffer*/ nullptr,
+    /*tp_flags*/ Py_TPFLAGS_DEFAULT,
+    /*tp_doc*/ nullptr,
+    /*tp_traverse*/ nullptr,
+    /*tp_clear*/ nullptr,
+    /*tp_richcompare*/ nullptr,
+    /*tp_weaklistoffset*/ 0,
+    /*tp_iter*/ nullptr,
+    /*tp_iternext*/ nullptr,
+    /*tp_methods*/ bpy_batch_edit_context_methods,
+    /*tp_members*/ nullptr,
+    /*tp_getset*/ nullptr,
+    /*tp_base*/ nullptr,
+    /*tp_dict*/ nullptr,
+    /*tp_descr_get*/ nullptr,
+    /*tp_descr_set*/ nullptr,
+    /*tp_dictoffset*/ 0,
+    /*tp_init*/ nullptr,
+    /*tp_alloc*/ nullptr,
+    /*tp_new*/ nullptr,
+    /*tp_free*/ nullptr,
+    /*tp_is_gc*/ nullptr,
+    /*tp_bases*/ nullptr,
+    /*tp_mro*/ nullptr,
+    /*tp_cache*/ nullptr,
+    /*tp_subclasses*/ nullptr,
+    /*tp_weaklist*/ nullptr,
+    /*tp_del*/ nullptr,
+    /*tp_version_tag*/ 0,
+    /*tp_finalize*/ nullptr,
+    /*tp_vectorcall*/ nullptr,
+};
+
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_batch_edit_doc,
+    ".. method:: batch_edit()\n"
+    "\n"
+    "   A context manager to create, link or remove many IDs at once, e.g. ``objects.new`` and "
+    "``collection.objects.link`` in a loop.\n"
+    "\n"
+    "   The view layers of the scenes are only updated once the context exits, which is much "
+    "quicker than updating them after every change. Accessing the objects and bases of view "
+    "layers while the context is active is not supported.\n");
+static PyObject *bpy_batch_edit(PyObject *self, PyObject * /*args*/)
+{
+  Main *bmain = pyrna_bmain_FromPyObject(self);
+  if (!bmain) {
+    return nullptr;
+  }
+
+  BPy_BatchEditContext *ret = PyObject_New(BPy_BatchEditContext, &bpy_batch_edit_context_Type);
+  ret->bmain = bmain;
+  ret->is_active = false;
+  return reinterpret_cast<PyObject *>(ret);
+}
+
+static PyObject *bpy_batch_edit_context_enter(BPy_BatchEditContext *self)
+{
+  if (self->is_active) {
+    PyErr_SetString(PyExc_RuntimeError, "batch_edit: context is already active");
+    return nullptr;
+  }
+  self->is_active = true;
+  BKE_layer_collection_resync_forbid();
+  Py_RETURN_NONE;
+}
+
+static PyObject *bpy_batch_edit_context_exit(BPy_BatchEditContext *self, PyObject * /*args*/)
+{
+  bpy_batch_edit_context_finish(self);
+  Py_RETURN_NONE;
+}
+
+int BPY_rna_id_collection_batch_edit_type_ready()
+{
+  if (PyType_Ready(&bpy_batch_edit_context_Type) < 0) {
+    return -1;
+  }
+  return 0;
+}
+
+/** \} */
+
 #ifdef __GNUC__
 #  ifdef __clang__
 #    pragma clang diagnostic push
@@ -982,6 +1149,12 @@ PyMethodDef BPY_rna_id_collection_orphans_purge_method_def = {
     METH_VARARGS | METH_KEYWORDS,
     bpy_orphans_purge_doc,
 };
+PyMethodDef BPY_rna_id_collection_batch_edit_method_def = {
+    "batch_edit",
+    reinterpret_cast<PyCFunction>(bpy_batch_edit),
+    METH_NOARGS,
+    bpy_batch_edit_doc,
+};
 
 #ifdef __GNUC__
 #  ifdef __clang__
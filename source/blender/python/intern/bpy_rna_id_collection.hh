@@ -17,5 +17,8 @@ extern PyMethodDef BPY_rna_id_collection_file_path_map_method_def;
 extern PyMethodDef BPY_rna_id_collection_file_path_foreach_method_def;
 extern PyMethodDef BPY_rna_id_collection_batch_remove_method_def;
 extern PyMethodDef BPY_rna_id_collection_orphans_purge_method_def;
+extern PyMethodDef BPY_rna_id_collection_batch_edit_method_def;
+
+int BPY_rna_id_collection_batch_edit_type_ready();
 
 }  // namespace blender
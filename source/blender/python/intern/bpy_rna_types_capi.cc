@@ -51,6 +51,7 @@ static PyMethodDef pyrna_blenddata_methods[] = {
     {nullptr, nullptr, 0, nullptr}, /* #BPY_rna_id_collection_file_path_foreach_method_def */
     {nullptr, nullptr, 0, nullptr}, /* #BPY_rna_id_collection_batch_remove_method_def */
     {nullptr, nullptr, 0, nullptr}, /* #BPY_rna_id_collection_orphans_purge_method_def */
+    {nullptr, nullptr, 0, nullptr}, /* #BPY_rna_id_collection_batch_edit_method_def */
     {nullptr, nullptr, 0, nullptr}, /* #BPY_rna_data_context_method_def */
     {nullptr, nullptr, 0, nullptr},
 };
@@ -282,8 +283,9 @@ void BPY_rna_types_extend_capi()
                   BPY_rna_id_collection_file_path_foreach_method_def,
                   BPY_rna_id_collection_batch_remove_method_def,
                   BPY_rna_id_collection_orphans_purge_method_def,
+                  BPY_rna_id_collection_batch_edit_method_def,
                   BPY_rna_data_context_method_def);
-  BLI_STATIC_ASSERT(ARRAY_SIZE(pyrna_blenddata_methods) == 7, "Unexpected number of methods")
+  BLI_STATIC_ASSERT(ARRAY_SIZE(pyrna_blenddata_methods) == 8, "Unexpected number of methods")
   pyrna_struct_type_extend_capi(RNA_BlendData, pyrna_blenddata_methods, nullptr);
 
   /* BlendDataLibraries */
@@ -31,6 +31,7 @@
 #include "COM_conversion_operation.hh"
 #include "COM_domain.hh"
 #include "COM_node_group_operation.hh"
+#include "COM_profiler.hh"
 #include "COM_realize_on_domain_operation.hh"
 #include "COM_render_context.hh"
 #include "COM_result.hh"
@@ -40,14 +41,19 @@
 
 #include "WM_api.hh"
 
+#include "GPU_capabilities.hh"
 #include "GPU_context.hh"
 #include "GPU_state.hh"
 #include "GPU_texture_pool.hh"
 
 #include "render_types.h"
 
+#include "CLG_log.h"
+
 namespace blender {
 
+static CLG_LogRef LOG = {"render.compositor"};
+
 namespace render {
 
 /**
@@ -100,10 +106,15 @@ class Context : public compositor::Context {
   Vector<gpu::Texture *> cached_gpu_passes_;
   Vector<ImBuf *> cached_cpu_passes_;
 
+  /* Whether the GPU is used for evaluation, see compute_use_gpu. Computed once at construction,
+   * since it is queried for every allocated result. */
+  bool use_gpu_ = false;
+
  public:
   Context(compositor::StaticCacheManager &cache_manager, const ContextInputData &input_data)
       : compositor::Context(cache_manager), input_data_(input_data)
   {
+    use_gpu_ = this->compute_use_gpu();
   }
 
   virtual ~Context()
@@ -123,7 +134,37 @@ class Context : public compositor::Context {
 
   bool use_gpu() const override
   {
-    return this->get_render_data().compositor_device == SCE_COMPOSITOR_DEVICE_GPU;
+    return use_gpu_;
+  }
+
+  /* The GPU is used if it is the chosen device, unless the frame doesn't fit into a GPU texture.
+   * Every intermediate result of the frame size is stored in a single texture, so such frames
+   * can't be evaluated on the GPU at all. They are evaluated on the CPU instead, which has no
+   * such limit. */
+  bool compute_use_gpu() const
+  {
+    if (this->get_render_data().compositor_device != SCE_COMPOSITOR_DEVICE_GPU) {
+      return false;
+    }
+
+    /* The GPU capabilities are not known before the GPU backend is initialized. */
+    const int max_texture_size = GPU_max_texture_size();
+    if (max_texture_size == 0) {
+      return true;
+    }
+
+    const int2 render_size = this->get_render_size();
+    if (render_size.x > max_texture_size || render_size.y > max_texture_size) {
+      CLOG_WARN(&LOG,
+                "Frame of %dx%d exceeds the maximum GPU texture size of %d, compositing on the "
+                "CPU",
+                render_size.x,
+                render_size.y,
+                max_texture_size);
+      return false;
+    }
+
+    return true;
   }
 
   compositor::NodeGroupOutputTypes needed_outputs() const
@@ -609,6 +650,10 @@ class Context : public compositor::Context {
 
     node_group_operation.evaluate();
 
+    if (this->profiler()) {
+      this->profiler()->log_report(node_group, this->get_frame_number(), this->get_view_name());
+    }
+
     /* Write the outputs of the operation. */
     for (const bNodeTreeInterfaceSocket *output_socket : node_group.interface_outputs()) {
       Result &output_result = node_group_operation.get_result(output_socket->identifier);
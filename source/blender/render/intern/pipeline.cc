@@ -34,6 +34,8 @@
 #include "BLI_rect.h"
 #include "BLI_set.hh"
 #include "BLI_string_utf8.h"
+#include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_timecode.h"
@@ -2170,6 +2172,77 @@ bool RE_WriteRenderViewsMovie(ReportList *reports,
   return ok;
 }
 
+/** Get the output file path of the current frame, reporting errors in the path templates. */
+static bool render_frame_filepath_get(Render *re,
+                                      Main *bmain,
+                                      Scene *scene,
+                                      const char *filepath_override,
+                                      char filepath[FILE_MAX])
+{
+  if (filepath_override) {
+    BLI_strncpy(filepath, filepath_override, FILE_MAX);
+    return true;
+  }
+
+  const char *relbase = BKE_main_blendfile_path(bmain);
+  path_templates::VariableMap template_variables;
+  BKE_add_template_variables_general(template_variables, &scene->id);
+  BKE_add_template_variables_for_render_path(template_variables, *scene);
+
+  const Vector<path_templates::Error> errors = BKE_image_path_from_imformat(
+      filepath,
+      scene->r.pic,
+      relbase,
+      &template_variables,
+      scene->r.cfra,
+      &scene->r.im_format,
+      (scene->r.scemode & R_EXTENSION) != 0,
+      true,
+      nullptr);
+  if (!errors.is_empty()) {
+    BKE_report_path_template_errors(re->reports, RPT_ERROR, scene->r.pic, errors);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Print the time it took to render and save the current frame and pass it to the stats handlers.
+ * \param saved: Whether the frame was saved, the saving time is the time since the frame finished
+ * rendering.
+ */
+static void render_frame_stats_exec(Render *re, const bool saved)
+{
+  char time_str[FILE_MAX];
+
+  const double render_time = re->i.lastframetime;
+  re->i.lastframetime = BLI_time_now_seconds() - re->i.starttime;
+
+  BLI_timecode_string_from_time_simple(time_str, sizeof(time_str), re->i.lastframetime);
+  std::string message = fmt::format("Time: {}", time_str);
+
+  if (saved) {
+    BLI_timecode_string_from_time_simple(
+        time_str, sizeof(time_str), re->i.lastframetime - render_time);
+    message = fmt::format("{} (Saving: {})", message, time_str);
+  }
+
+  const bool show_info = CLOG_CHECK(&LOG, CLG_LEVEL_INFO);
+  if (show_info) {
+    CLOG_STR_INFO(&LOG, message.c_str());
+    /* Flush stdout to be sure python callbacks are printing stuff after blender. */
+    fflush(stdout);
+  }
+
+  /* NOTE: using G_MAIN seems valid here???
+   * Not sure it's actually even used anyway, we could as well pass nullptr? */
+  render_callback_exec_string(re, G_MAIN, BKE_CB_EVT_RENDER_STATS, message.c_str());
+
+  if (show_info) {
+    fflush(stdout);
+  }
+}
+
 static bool do_write_image_or_movie(Render *re,
                                     Main *bmain,
                                     Scene *scene,
@@ -2179,7 +2252,6 @@ static bool do_write_image_or_movie(Render *re,
 {
   char filepath[FILE_MAX];
   RenderResult rres;
-  double render_time;
   bool ok = true;
   RenderEngineType *re_type = RE_engines_find(re->r.engine);
 
@@ -2197,30 +2269,7 @@ static bool do_write_image_or_movie(Render *re,
           re->reports, &rres, scene, &re->r, re->movie_writers.data(), totvideos, false);
     }
     else {
-      if (filepath_override) {
-        STRNCPY(filepath, filepath_override);
-      }
-      else {
-        const char *relbase = BKE_main_blendfile_path(bmain);
-        path_templates::VariableMap template_variables;
-        BKE_add_template_variables_general(template_variables, &scene->id);
-        BKE_add_template_variables_for_render_path(template_variables, *scene);
-
-        const Vector<path_templates::Error> errors = BKE_image_path_from_imformat(
-            filepath,
-            scene->r.pic,
-            relbase,
-            &template_variables,
-            scene->r.cfra,
-            &scene->r.im_format,
-            (scene->r.scemode & R_EXTENSION) != 0,
-            true,
-            nullptr);
-        if (!errors.is_empty()) {
-          BKE_report_path_template_errors(re->reports, RPT_ERROR, scene->r.pic, errors);
-          ok = false;
-        }
-      }
+      ok = render_frame_filepath_get(re, bmain, scene, filepath_override, filepath);
 
       /* write images as individual images or stereo */
       if (ok) {
@@ -2231,34 +2280,99 @@ static bool do_write_image_or_movie(Render *re,
     RE_ReleaseResultImageViews(re, &rres);
   }
 
-  render_time = re->i.lastframetime;
-  re->i.lastframetime = BLI_time_now_seconds() - re->i.starttime;
+  render_frame_stats_exec(re, do_write_file && ok);
 
-  BLI_timecode_string_from_time_simple(filepath, sizeof(filepath), re->i.lastframetime);
-  std::string message = fmt::format("Time: {}", filepath);
+  return ok;
+}
 
-  if (do_write_file && ok) {
-    BLI_timecode_string_from_time_simple(
-        filepath, sizeof(filepath), re->i.lastframetime - render_time);
-    message = fmt::format("{} (Saving: {})", message, filepath);
+/**
+ * With #R_SAVE_BACKGROUND, image sequence frames are saved on a background thread while the next
+ * frame renders. At most one frame waits to be saved, limiting the memory used by copies of
+ * render results. Handlers still run on the main thread.
+ */
+struct RenderAnimWriteTask {
+  RenderResult *rr = nullptr;
+  Scene tmp_scene;
+  ReportList *reports = nullptr;
+  char filepath[FILE_MAX];
+  bool ok = false;
+};
+
+static void render_anim_write_task(TaskPool *__restrict /*pool*/, void *task_data_v)
+{
+  RenderAnimWriteTask *task_data = static_cast<RenderAnimWriteTask *>(task_data_v);
+  /* Isolate the task so that multi-threaded image operations don't make this thread work on
+   * unrelated tasks of the render. */
+  threading::isolate_task([&]() {
+    task_data->ok = BKE_image_render_write(
+        task_data->reports, task_data->rr, &task_data->tmp_scene, true, task_data->filepath);
+    RE_FreeRenderResult(task_data->rr);
+    task_data->rr = nullptr;
+  });
+}
+
+/**
+ * Wait until the previously scheduled frame is saved and run its write handlers.
+ * \return false when saving failed.
+ */
+static bool render_anim_write_wait(Render *re,
+                                   Scene *scene,
+                                   TaskPool *pool,
+                                   RenderAnimWriteTask *&task_data)
+{
+  if (task_data == nullptr) {
+    return true;
   }
+  BLI_task_pool_work_and_wait(pool);
+  const bool ok = task_data->ok;
+  MEM_delete(task_data);
+  task_data = nullptr;
 
-  const bool show_info = CLOG_CHECK(&LOG, CLG_LEVEL_INFO);
-  if (show_info) {
-    CLOG_STR_INFO(&LOG, message.c_str());
-    /* Flush stdout to be sure python callbacks are printing stuff after blender. */
-    fflush(stdout);
+  if (ok) {
+    render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
   }
+  return ok;
+}
 
-  /* NOTE: using G_MAIN seems valid here???
-   * Not sure it's actually even used anyway, we could as well pass nullptr? */
-  render_callback_exec_string(re, G_MAIN, BKE_CB_EVT_RENDER_STATS, message.c_str());
+/**
+ * Copy the render result of the current frame and save it in the background, after the previous
+ * frame was saved.
+ * \return false when the frame can't be saved.
+ */
+static bool render_anim_write_schedule(Render *re,
+                                       Main *bmain,
+                                       Scene *scene,
+                                       TaskPool *pool,
+                                       RenderAnimWriteTask *&task_data)
+{
+  char filepath[FILE_MAX];
+  const bool ok_path = render_frame_filepath_get(re, bmain, scene, nullptr, filepath);
 
-  if (show_info) {
-    fflush(stdout);
+  RenderResult *rr = nullptr;
+  if (ok_path) {
+    RenderResult rres;
+    RE_AcquireResultImageViews(re, &rres);
+    rr = RE_DuplicateRenderResult(&rres);
+    RE_ReleaseResultImageViews(re, &rres);
   }
 
-  return ok;
+  render_frame_stats_exec(re, false);
+
+  if (!render_anim_write_wait(re, scene, pool, task_data) || !ok_path) {
+    if (rr) {
+      RE_FreeRenderResult(rr);
+    }
+    return false;
+  }
+
+  task_data = MEM_new<RenderAnimWriteTask>(__func__);
+  task_data->rr = rr;
+  /* The scene settings may be animated, so they can change while the next frame renders. */
+  task_data->tmp_scene = dna::shallow_copy(*scene);
+  task_data->reports = re->reports;
+  STRNCPY(task_data->filepath, filepath);
+  BLI_task_pool_push(pool, render_anim_write_task, task_data, false, nullptr);
+  return true;
 }
 
 static void get_videos_dimensions(const Render *re,
@@ -2358,6 +2472,13 @@ void RE_RenderAnim(Render *re,
                               (re_type->flag & RE_USE_POSTPROCESS)) &&
                              write_anim;
 
+  /* Save image sequences in the background while the next frame renders. */
+  TaskPool *write_pool = nullptr;
+  RenderAnimWriteTask *write_task = nullptr;
+  if (do_write_file && !is_movie && (rd.mode & R_SAVE_BACKGROUND)) {
+    write_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_HIGH);
+  }
+
   render_init_depsgraph(re);
 
   if (is_movie && do_write_file) {
@@ -2529,7 +2650,12 @@ void RE_RenderAnim(Render *re,
     const bool should_write = !(re->flag & R_SKIP_WRITE);
     if (re->display->test_break() == 0) {
       if (!G.is_break && should_write) {
-        if (!do_write_image_or_movie(re, bmain, scene, totvideos, nullptr, write_anim)) {
+        if (write_pool) {
+          if (!render_anim_write_schedule(re, bmain, scene, write_pool, write_task)) {
+            G.is_break = true;
+          }
+        }
+        else if (!do_write_image_or_movie(re, bmain, scene, totvideos, nullptr, write_anim)) {
           G.is_break = true;
         }
       }
@@ -2573,12 +2699,21 @@ void RE_RenderAnim(Render *re,
     if (G.is_break == false) {
       /* keep after file save */
       render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_POST);
-      if (should_write) {
+      /* With background saving, the write handlers run once the frame is saved. */
+      if (should_write && write_pool == nullptr) {
         render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
       }
     }
   }
 
+  if (write_pool) {
+    /* Finish saving the last frame, also when the render was canceled. */
+    if (!render_anim_write_wait(re, scene, write_pool, write_task)) {
+      G.is_break = true;
+    }
+    BLI_task_pool_free(write_pool);
+  }
+
   /* end movie */
   if (is_movie && do_write_file) {
     re_movie_free_all(re);
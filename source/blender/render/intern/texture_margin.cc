@@ -10,6 +10,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
@@ -223,81 +224,117 @@ class TextureMarginMap {
   {
     float4 *ibuf_ptr_fl = reinterpret_cast<float4 *>(ibuf->float_buffer.data);
     uchar4 *ibuf_ptr_ch = reinterpret_cast<uchar4 *>(ibuf->byte_buffer.data);
-    size_t pixel_index = 0;
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        uint32_t dp = pixel_data_[pixel_index];
-        if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
-          int dist = DijkstraPixelGetDistance(dp);
-          int direction = DijkstraPixelGetDirection(dp);
-
-          int xx = x;
-          int yy = y;
-
-          /* Follow the dijkstra directions to find the face this margin pixels belongs to. */
-          while (dist > 0) {
-            xx -= directions[direction][0];
-            yy -= directions[direction][1];
-            dp = get_pixel(xx, yy);
-            dist -= distances[direction];
-            BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
-            direction = DijkstraPixelGetDirection(dp);
-          }
-
-          uint32_t face = get_pixel(xx, yy);
-
-          BLI_assert(!IsDijkstraPixel(face));
-
-          float destX, destY;
-
-          int other_poly;
-          bool found_pixel_in_polygon = false;
-          if (lookup_pixel_polygon_neighborhood(x, y, &face, &destX, &destY, &other_poly)) {
-
-            for (int i = 0; i < maxPolygonSteps; i++) {
-              /* Force to pixel grid. */
-              int nx = int(round(destX));
-              int ny = int(round(destY));
-              uint32_t polygon_from_map = get_pixel(nx, ny);
-              if (other_poly == polygon_from_map) {
-                found_pixel_in_polygon = true;
-                break;
-              }
 
-              float dist_to_edge;
-              /* Look up again, but starting from the face we were expected to land in. */
-              if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
-                found_pixel_in_polygon = false;
-                break;
-              }
-            }
-
-            if (found_pixel_in_polygon) {
+    /* Finding the source locations of the margin pixels is done in parallel for chunks of rows.
+     * The pixels are written afterwards in the same order as before, because the interpolation
+     * can read margin pixels that were written already. */
+    const int chunk_rows = std::min(h_, 256);
+    Array<float2> chunk_dest(size_t(w_) * chunk_rows);
+    Array<bool> chunk_found(size_t(w_) * chunk_rows);
+
+    for (int y_start = 0; y_start < h_; y_start += chunk_rows) {
+      const IndexRange rows(y_start, std::min(chunk_rows, h_ - y_start));
+      threading::parallel_for(rows, 8, [&](const IndexRange rows_range) {
+        for (const int y : rows_range) {
+          for (int x = 0; x < w_; x++) {
+            const size_t chunk_index = size_t(y - y_start) * w_ + x;
+            chunk_found[chunk_index] = lookup_margin_pixel(
+                x, y, maxPolygonSteps, chunk_dest[chunk_index]);
+          }
+        }
+      });
+
+      for (const int y : rows) {
+        for (int x = 0; x < w_; x++) {
+          const size_t pixel_index = size_t(y) * w_ + x;
+          const size_t chunk_index = size_t(y - y_start) * w_ + x;
+          uint32_t dp = pixel_data_[pixel_index];
+          if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
+            if (chunk_found[chunk_index]) {
+              const float2 dest = chunk_dest[chunk_index];
               if (ibuf_ptr_fl) {
                 ibuf_ptr_fl[pixel_index] = imbuf::interpolate_bilinear_border_fl(
-                    ibuf, destX, destY);
+                    ibuf, dest.x, dest.y);
               }
               if (ibuf_ptr_ch) {
                 ibuf_ptr_ch[pixel_index] = imbuf::interpolate_bilinear_border_byte(
-                    ibuf, destX, destY);
+                    ibuf, dest.x, dest.y);
               }
               /* Add our new pixels to the assigned pixel map. */
               mask[pixel_index] = 1;
             }
           }
+          else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
+            /* These are not margin pixels, make sure the extend filter which is run after this
+             * step leaves them alone.
+             */
+            mask[pixel_index] = 1;
+          }
         }
-        else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
-          /* These are not margin pixels, make sure the extend filter which is run after this step
-           * leaves them alone.
-           */
-          mask[pixel_index] = 1;
-        }
-        pixel_index++;
       }
     }
   }
 
  private:
+  /**
+   * For a margin pixel, find the location in the adjacent face to copy the pixel from.
+   * Returns false for pixels that are not margin pixels or when no location was found.
+   */
+  bool lookup_margin_pixel(const int x,
+                           const int y,
+                           const int maxPolygonSteps,
+                           float2 &r_dest) const
+  {
+    uint32_t dp = get_pixel(x, y);
+    if (!IsDijkstraPixel(dp) || DijkstraPixelIsUnset(dp)) {
+      return false;
+    }
+    int dist = DijkstraPixelGetDistance(dp);
+    int direction = DijkstraPixelGetDirection(dp);
+
+    int xx = x;
+    int yy = y;
+
+    /* Follow the dijkstra directions to find the face this margin pixels belongs to. */
+    while (dist > 0) {
+      xx -= directions[direction][0];
+      yy -= directions[direction][1];
+      dp = get_pixel(xx, yy);
+      dist -= distances[direction];
+      BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
+      direction = DijkstraPixelGetDirection(dp);
+    }
+
+    uint32_t face = get_pixel(xx, yy);
+
+    BLI_assert(!IsDijkstraPixel(face));
+
+    float destX, destY;
+
+    int other_poly;
+    if (!lookup_pixel_polygon_neighborhood(x, y, &face, &destX, &destY, &other_poly)) {
+      return false;
+    }
+
+    for (int i = 0; i < maxPolygonSteps; i++) {
+      /* Force to pixel grid. */
+      int nx = int(round(destX));
+      int ny = int(round(destY));
+      uint32_t polygon_from_map = get_pixel(nx, ny);
+      if (other_poly == polygon_from_map) {
+        r_dest = float2(destX, destY);
+        return true;
+      }
+
+      float dist_to_edge;
+      /* Look up again, but starting from the face we were expected to land in. */
+      if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
+        return false;
+      }
+    }
+    return false;
+  }
+
   float2 uv_to_xy(const float2 &uv_map) const
   {
     float2 ret;
@@ -335,8 +372,12 @@ class TextureMarginMap {
    * face we need can be the one next to the one the Dijkstra map provides. To prevent missing
    * pixels also check the neighboring polygons.
    */
-  bool lookup_pixel_polygon_neighborhood(
-      float x, float y, uint32_t *r_start_poly, float *r_destx, float *r_desty, int *r_other_poly)
+  bool lookup_pixel_polygon_neighborhood(float x,
+                                         float y,
+                                         uint32_t *r_start_poly,
+                                         float *r_destx,
+                                         float *r_desty,
+                                         int *r_other_poly) const
   {
     float found_dist;
     if (lookup_pixel(x, y, *r_start_poly, r_destx, r_desty, r_other_poly, &found_dist)) {
@@ -389,7 +430,7 @@ class TextureMarginMap {
                     float *r_destx,
                     float *r_desty,
                     int *r_other_poly,
-                    float *r_dist_to_edge)
+                    float *r_dist_to_edge) const
   {
     float2 point(x, y);
 
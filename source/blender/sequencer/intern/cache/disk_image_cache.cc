@@ -0,0 +1,304 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup sequencer
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#include "BLI_fileops.h"
+#include "BLI_path_utils.hh"
+#include "BLI_string.h"
+
+#include "DNA_userdef_types.h"
+
+#include "BKE_appdir.hh"
+
+#include "IMB_colormanagement.hh"
+#include "IMB_imbuf.hh"
+#include "IMB_imbuf_types.hh"
+
+#include "disk_image_cache.hh"
+
+namespace blender::seq {
+
+/* Bump when the file layout changes. The files only live as long as the session, so there is no
+ * need to read older versions. */
+static constexpr int DISK_IMAGE_CACHE_VERSION = 1;
+
+struct DiskImageHeader {
+  char magic[4];
+  int32_t version;
+  int32_t width;
+  int32_t height;
+  int32_t channels;
+  uint8_t planes;
+  uint8_t is_float;
+  uint8_t compression;
+  uint8_t _pad;
+  char colorspace[64];
+  uint64_t data_size;
+};
+
+static constexpr char DISK_IMAGE_MAGIC[4] = {'B', 'S', 'Q', 'C'};
+
+static int compression_level_get(const int compression)
+{
+  switch (compression) {
+    case USER_SEQ_DISK_CACHE_COMPRESSION_LOW:
+      return 1;
+    case USER_SEQ_DISK_CACHE_COMPRESSION_HIGH:
+      return 9;
+  }
+  return 0;
+}
+
+static bool image_write(const char *filepath, const ImBuf *ibuf, size_t &r_size_in_bytes)
+{
+  const bool is_float = ibuf->float_buffer.data != nullptr;
+  if (!is_float && ibuf->byte_buffer.data == nullptr) {
+    return false;
+  }
+
+  DiskImageHeader header = {};
+  memcpy(header.magic, DISK_IMAGE_MAGIC, sizeof(header.magic));
+  header.version = DISK_IMAGE_CACHE_VERSION;
+  header.width = ibuf->x;
+  header.height = ibuf->y;
+  header.channels = is_float ? ibuf->channels : 4;
+  header.planes = ibuf->planes;
+  header.is_float = is_float;
+  header.compression = U.sequencer_disk_cache_compression;
+
+  const ColorSpace *colorspace = is_float ? ibuf->float_buffer.colorspace :
+                                            ibuf->byte_buffer.colorspace;
+  if (colorspace != nullptr) {
+    STRNCPY(header.colorspace, IMB_colormanagement_colorspace_get_name(colorspace));
+  }
+
+  void *data = is_float ? static_cast<void *>(ibuf->float_buffer.data) :
+                          static_cast<void *>(ibuf->byte_buffer.data);
+  header.data_size = size_t(ibuf->x) * size_t(ibuf->y) * size_t(header.channels) *
+                     (is_float ? sizeof(float) : sizeof(uint8_t));
+
+  FILE *file = BLI_fopen(filepath, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  size_t data_written = 0;
+  if (ok) {
+    const int level = compression_level_get(header.compression);
+    if (level == 0) {
+      data_written = fwrite(data, 1, header.data_size, file);
+      ok = data_written == header.data_size;
+    }
+    else {
+      data_written = BLI_file_zstd_from_mem_at_pos(
+          data, header.data_size, file, sizeof(header), level);
+      ok = data_written != 0;
+    }
+  }
+  ok &= fclose(file) == 0;
+
+  if (!ok) {
+    BLI_delete(filepath, false, false);
+    return false;
+  }
+  r_size_in_bytes = sizeof(header) + data_written;
+  return true;
+}
+
+static ImBuf *image_read(const char *filepath)
+{
+  FILE *file = BLI_fopen(filepath, "rb");
+  if (file == nullptr) {
+    return nullptr;
+  }
+
+  DiskImageHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      memcmp(header.magic, DISK_IMAGE_MAGIC, sizeof(header.magic)) != 0 ||
+      header.version != DISK_IMAGE_CACHE_VERSION)
+  {
+    fclose(file);
+    return nullptr;
+  }
+  header.colorspace[sizeof(header.colorspace) - 1] = '\0';
+
+  ImBuf *ibuf = IMB_allocImBuf(header.width,
+                               header.height,
+                               header.planes,
+                               (header.is_float ? IB_float_data : IB_byte_data) |
+                                   IB_uninitialized_pixels);
+  if (ibuf == nullptr) {
+    fclose(file);
+    return nullptr;
+  }
+  void *data = nullptr;
+  if (header.is_float) {
+    ibuf->channels = header.channels;
+    data = ibuf->float_buffer.data;
+  }
+  else {
+    data = ibuf->byte_buffer.data;
+  }
+
+  bool ok = data != nullptr;
+  if (ok) {
+    if (compression_level_get(header.compression) == 0) {
+      ok = fread(data, 1, header.data_size, file) == header.data_size;
+    }
+    else {
+      ok = BLI_file_unzstd_to_mem_at_pos(data, header.data_size, file, sizeof(header)) ==
+           header.data_size;
+    }
+  }
+  fclose(file);
+
+  if (!ok) {
+    IMB_freeImBuf(ibuf);
+    return nullptr;
+  }
+
+  if (header.colorspace[0] != '\0') {
+    if (header.is_float) {
+      IMB_colormanagement_assign_float_colorspace(ibuf, header.colorspace);
+    }
+    else {
+      IMB_colormanagement_assign_byte_colorspace(ibuf, header.colorspace);
+    }
+  }
+  return ibuf;
+}
+
+DiskImageCache::~DiskImageCache()
+{
+  this->clear();
+  if (!directory_.empty()) {
+    BLI_delete(directory_.c_str(), true, false);
+  }
+}
+
+bool DiskImageCache::is_enabled()
+{
+  return (U.sequencer_editor_flag & USER_SEQ_ED_DISK_CACHE) != 0;
+}
+
+std::string DiskImageCache::file_path_get(const uint64_t file_id) const
+{
+  char filename[64];
+  SNPRINTF(filename, "%llu.bseq", (unsigned long long)file_id);
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), directory_.c_str(), filename);
+  return filepath;
+}
+
+bool DiskImageCache::contains(StringRef key) const
+{
+  return entries_.contains_as(key);
+}
+
+void DiskImageCache::put(StringRef key, const int timeline_frame, const ImBuf *ibuf)
+{
+  if (directory_.empty()) {
+    /* Each cache gets its own directory, so that caches of different scenes don't clash. */
+    static std::atomic<int> cache_counter = 0;
+    char dirname[64];
+    SNPRINTF(dirname, "sequencer_cache_%d", cache_counter++);
+    char dirpath[FILE_MAX];
+    BLI_path_join(dirpath, sizeof(dirpath), BKE_tempdir_session(), dirname);
+    if (!BLI_dir_create_recursive(dirpath)) {
+      return;
+    }
+    directory_ = dirpath;
+  }
+
+  this->remove(key);
+
+  const uint64_t file_id = next_file_id_++;
+  size_t size_in_bytes = 0;
+  if (!image_write(this->file_path_get(file_id).c_str(), ibuf, size_in_bytes)) {
+    return;
+  }
+
+  entries_.add_new(std::string(key),
+                   Entry{file_id, timeline_frame, size_in_bytes, use_counter_++});
+  size_in_bytes_ += size_in_bytes;
+  this->ensure_size_limit();
+}
+
+ImBuf *DiskImageCache::get(StringRef key)
+{
+  Entry *entry = entries_.lookup_ptr_as(key);
+  if (entry == nullptr) {
+    return nullptr;
+  }
+  ImBuf *ibuf = image_read(this->file_path_get(entry->file_id).c_str());
+  if (ibuf == nullptr) {
+    /* The file is corrupt or was removed from outside, don't try again. */
+    this->remove(key);
+    return nullptr;
+  }
+  entry->last_used = use_counter_++;
+  return ibuf;
+}
+
+void DiskImageCache::remove(StringRef key)
+{
+  const Entry *entry = entries_.lookup_ptr_as(key);
+  if (entry == nullptr) {
+    return;
+  }
+  BLI_delete(this->file_path_get(entry->file_id).c_str(), false, false);
+  size_in_bytes_ -= entry->size_in_bytes;
+  entries_.remove_as(key);
+}
+
+void DiskImageCache::ensure_size_limit()
+{
+  const size_t limit = size_t(U.sequencer_disk_cache_size_limit) * 1024 * 1024 * 1024;
+  while (size_in_bytes_ > limit && !entries_.is_empty()) {
+    const std::string *oldest_key = nullptr;
+    uint64_t oldest_use = UINT64_MAX;
+    for (const auto item : entries_.items()) {
+      if (item.value.last_used < oldest_use) {
+        oldest_use = item.value.last_used;
+        oldest_key = &item.key;
+      }
+    }
+    const std::string key = *oldest_key;
+    this->remove(key);
+  }
+}
+
+void DiskImageCache::invalidate_frame_range(const int timeline_frame_start,
+                                            const int timeline_frame_end)
+{
+  entries_.remove_if([&](const auto item) {
+    if (item.value.timeline_frame < timeline_frame_start ||
+        item.value.timeline_frame > timeline_frame_end)
+    {
+      return false;
+    }
+    BLI_delete(this->file_path_get(item.value.file_id).c_str(), false, false);
+    size_in_bytes_ -= item.value.size_in_bytes;
+    return true;
+  });
+}
+
+void DiskImageCache::clear()
+{
+  for (const Entry &entry : entries_.values()) {
+    BLI_delete(this->file_path_get(entry.file_id).c_str(), false, false);
+  }
+  entries_.clear();
+  size_in_bytes_ = 0;
+}
+
+}  // namespace blender::seq
@@ -0,0 +1,70 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup sequencer
+ *
+ * Disk tier for cached images.
+ * - Images evicted from a memory cache are written to compressed files in the
+ *   session temporary directory, and read back when they are needed again.
+ * - Keyed by a string that is unique within the owning cache, each entry also
+ *   stores its timeline frame so that frame ranges can be invalidated.
+ * - The total size is limited by the user preferences, the least recently
+ *   used files are removed first.
+ * - Not thread-safe, the owning cache is expected to guard all calls with its mutex.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "BLI_map.hh"
+#include "BLI_string_ref.hh"
+
+namespace blender {
+
+struct ImBuf;
+
+namespace seq {
+
+class DiskImageCache {
+  struct Entry {
+    uint64_t file_id;
+    int timeline_frame;
+    size_t size_in_bytes;
+    uint64_t last_used;
+  };
+
+  Map<std::string, Entry> entries_;
+  std::string directory_;
+  size_t size_in_bytes_ = 0;
+  uint64_t next_file_id_ = 0;
+  uint64_t use_counter_ = 0;
+
+ public:
+  DiskImageCache() = default;
+  DiskImageCache(const DiskImageCache &other) = delete;
+  DiskImageCache &operator=(const DiskImageCache &other) = delete;
+  ~DiskImageCache();
+
+  /** Whether evicted images should be written to disk, as set in the user preferences. */
+  static bool is_enabled();
+
+  bool contains(StringRef key) const;
+  /** Write the image to disk, replacing any previous image with the same key. */
+  void put(StringRef key, int timeline_frame, const ImBuf *ibuf);
+  /** Read image from disk, returns null if there is no image for the key or reading failed. */
+  ImBuf *get(StringRef key);
+
+  void invalidate_frame_range(int timeline_frame_start, int timeline_frame_end);
+  void clear();
+
+ private:
+  std::string file_path_get(uint64_t file_id) const;
+  void remove(StringRef key);
+  void ensure_size_limit();
+};
+
+}  // namespace seq
+}  // namespace blender
@@ -9,6 +9,7 @@
 #include "BLI_hash.hh"
 #include "BLI_map.hh"
 #include "BLI_mutex.hh"
+#include "BLI_string.h"
 
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
@@ -17,6 +18,7 @@
 
 #include "SEQ_relations.hh"
 
+#include "disk_image_cache.hh"
 #include "final_image_cache.hh"
 #include "prefetch.hh"
 
@@ -41,8 +43,23 @@ struct FinalImageCache {
       return timeline_frame == other.timeline_frame && view_id == other.view_id &&
              display_channel == other.display_channel && image_size == image_size;
     }
+
+    std::string disk_cache_key() const
+    {
+      char key[64];
+      SNPRINTF(key,
+               "%d_%d_%d_%dx%d",
+               timeline_frame,
+               view_id,
+               display_channel,
+               image_size.x,
+               image_size.y);
+      return key;
+    }
   };
   Map<Key, ImBuf *> map_;
+  /** Frames that were evicted from #map_. */
+  DiskImageCache disk_cache_;
 
   ~FinalImageCache()
   {
@@ -55,6 +72,7 @@ struct FinalImageCache {
       IMB_freeImBuf(item);
     }
     map_.clear();
+    disk_cache_.clear();
   }
 };
 
@@ -89,6 +107,14 @@ ImBuf *final_image_cache_get(
       return nullptr;
     }
     res = cache->map_.lookup_default(key, nullptr);
+    if (res == nullptr && DiskImageCache::is_enabled()) {
+      /* Move the frame back into memory, the file stays so that it doesn't have to be written
+       * again when it gets evicted. */
+      res = cache->disk_cache_.get(key.disk_cache_key());
+      if (res != nullptr) {
+        cache->map_.add_new(key, res);
+      }
+    }
   }
 
   if (res) {
@@ -143,6 +169,7 @@ void final_image_cache_invalidate_frame_range(Scene *scene,
       cache->map_.remove(it);
     }
   }
+  cache->disk_cache_.invalidate_frame_range(key_start, key_end);
 }
 
 void final_image_cache_clear(Scene *scene)
@@ -224,12 +251,15 @@ bool final_image_cache_evict(Scene *scene)
     seq_prefetch_get_time_range(scene, &cur_prefetch_start, &cur_prefetch_end);
   }
   const bool prefetch_loops_around = cur_prefetch_start > cur_prefetch_end;
+  /* Frames "behind" the current frame are the ones playback already went past. */
+  const int direction = seq_prefetch_direction_get(scene);
 
   const int timeline_start = PSFRA;
   const int timeline_end = PEFRA;
-  /* If we wrap around, treat the timeline start as the playback head position.
-   * This is to try to mitigate un-needed cache evictions. */
-  const int cur_frame = prefetch_loops_around ? timeline_start : scene->r.cfra;
+  /* If we wrap around, treat the timeline start (or end when going backward) as the playback
+   * head position. This is to try to mitigate un-needed cache evictions. */
+  const int cur_frame = prefetch_loops_around ? (direction > 0 ? timeline_start : timeline_end) :
+                                                scene->r.cfra;
 
   FinalImageCache::Key best_key = {};
   ImBuf *best_item = nullptr;
@@ -249,13 +279,8 @@ bool final_image_cache_evict(Scene *scene)
     }
 
     /* Score for removal is distance to current frame; 2x that if behind current frame. */
-    int score = 0;
-    if (item_frame < cur_frame) {
-      score = (cur_frame - item_frame) * 2;
-    }
-    else if (item_frame > cur_frame) {
-      score = item_frame - cur_frame;
-    }
+    const int distance = (item_frame - cur_frame) * direction;
+    const int score = distance < 0 ? -distance * 2 : distance;
     if (score > best_score) {
       best_key = item.key;
       best_item = item.value;
@@ -265,6 +290,12 @@ bool final_image_cache_evict(Scene *scene)
 
   /* Remove if we found one. */
   if (best_item != nullptr) {
+    if (DiskImageCache::is_enabled()) {
+      const std::string disk_key = best_key.disk_cache_key();
+      if (!cache->disk_cache_.contains(disk_key)) {
+        cache->disk_cache_.put(disk_key, best_key.timeline_frame, best_item);
+      }
+    }
     IMB_freeImBuf(best_item);
     cache->map_.remove(best_key);
     return true;
@@ -12,6 +12,8 @@
  *   frames behind the current-frame.
  * - Invalidated fairly often while editing, basically whenever any
  *   strip overlapping that frame changes.
+ * - Evicted frames are moved to a #DiskImageCache when the disk cache is
+ *   enabled in the user preferences.
  */
 
 #pragma once
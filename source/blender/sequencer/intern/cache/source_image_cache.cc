@@ -308,12 +308,15 @@ bool source_image_cache_evict(Scene *scene)
     seq_prefetch_get_time_range(scene, &cur_prefetch_start, &cur_prefetch_end);
   }
   const bool prefetch_loops_around = cur_prefetch_start > cur_prefetch_end;
+  /* Frames "behind" the current frame are the ones playback already went past. */
+  const int direction = seq_prefetch_direction_get(scene);
 
   const int timeline_start = PSFRA;
   const int timeline_end = PEFRA;
-  /* If we wrap around, treat the timeline start as the playback head position.
-   * This is to try to mitigate un-needed cache evictions. */
-  const int cur_frame = prefetch_loops_around ? timeline_start : scene->r.cfra;
+  /* If we wrap around, treat the timeline start (or end when going backward) as the playback
+   * head position. This is to try to mitigate un-needed cache evictions. */
+  const int cur_frame = prefetch_loops_around ? (direction > 0 ? timeline_start : timeline_end) :
+                                                scene->r.cfra;
 
   SourceImageCache::StripEntry *best_strip = nullptr;
   SourceImageCache::Key best_key;
@@ -334,13 +337,8 @@ bool source_image_cache_evict(Scene *scene)
       }
 
       /* Score for removal is distance to current frame; 2x that if behind current frame. */
-      int score = 0;
-      if (item_frame < cur_frame) {
-        score = (cur_frame - item_frame) * 2;
-      }
-      else if (item_frame > cur_frame) {
-        score = item_frame - cur_frame;
-      }
+      const int distance = (item_frame - cur_frame) * direction;
+      const int score = distance < 0 ? -distance * 2 : distance;
       if (score > best_score) {
         best_strip = &strip.value;
         best_key = entry.key;
@@ -80,6 +80,8 @@ struct PrefetchJob {
   int timeline_end = 0;
   int timeline_length = 0;
   int num_frames_prefetched = 0;
+  /** 1 when prefetching frames after #cfra, -1 when prefetching frames before it. */
+  int direction = 1;
   int cache_flags = 0; /* Only used to detect cache flag changes. */
 
   /* Control: */
@@ -192,19 +194,55 @@ static bool seq_prefetch_is_cache_full(Scene *scene)
   return evict_caches_if_full(scene);
 }
 
-static int seq_prefetch_cfra(PrefetchJob *pfjob)
+/**
+ * When prefetching backwards, frames are rendered in short runs that go forward in time. Movie
+ * decoders can only decode forward, so this way they only have to seek once per run instead of
+ * once per frame.
+ */
+static constexpr int PREFETCH_BACKWARD_RUN_LENGTH = 16;
+
+static int seq_prefetch_frame_at_offset(PrefetchJob *pfjob, const int offset)
 {
-  int new_frame = pfjob->cfra + pfjob->num_frames_prefetched;
   Scene *scene = pfjob->scene; /* For the start/end frame macros. */
   int timeline_start = PSFRA;
   int timeline_end = PEFRA;
-  if (new_frame >= timeline_end) {
-    /* Wrap around to where we will jump when we reach the end frame. */
-    new_frame = timeline_start + new_frame - timeline_end;
+  if (pfjob->direction > 0) {
+    int new_frame = pfjob->cfra + offset;
+    if (new_frame >= timeline_end) {
+      /* Wrap around to where we will jump when we reach the end frame. */
+      new_frame = timeline_start + new_frame - timeline_end;
+    }
+    return new_frame;
+  }
+
+  int new_frame = pfjob->cfra - offset;
+  if (new_frame < timeline_start) {
+    /* Wrap around to where we will jump when we reach the start frame. */
+    new_frame = timeline_end - (timeline_start - new_frame);
   }
   return new_frame;
 }
 
+/** Offset from #PrefetchJob.cfra of the furthest frame of the run that is being prefetched. */
+static int seq_prefetch_range_offset(PrefetchJob *pfjob)
+{
+  if (pfjob->direction > 0) {
+    return pfjob->num_frames_prefetched;
+  }
+  const int run = (pfjob->num_frames_prefetched - 1) / PREFETCH_BACKWARD_RUN_LENGTH;
+  return (run + 1) * PREFETCH_BACKWARD_RUN_LENGTH;
+}
+
+static int seq_prefetch_cfra(PrefetchJob *pfjob)
+{
+  if (pfjob->direction > 0) {
+    return seq_prefetch_frame_at_offset(pfjob, pfjob->num_frames_prefetched);
+  }
+  /* Go through each run front to back, starting with the run closest to the current frame. */
+  const int index_in_run = (pfjob->num_frames_prefetched - 1) % PREFETCH_BACKWARD_RUN_LENGTH;
+  return seq_prefetch_frame_at_offset(pfjob, seq_prefetch_range_offset(pfjob) - index_in_run);
+}
+
 static AnimationEvalContext seq_prefetch_anim_eval_context(PrefetchJob *pfjob)
 {
   return BKE_animsys_eval_context_construct(pfjob->depsgraph, seq_prefetch_cfra(pfjob));
@@ -224,8 +262,24 @@ void seq_prefetch_get_time_range(Scene *scene, int *r_start, int *r_end)
     return;
   }
 
-  *r_start = pfjob->cfra;
-  *r_end = seq_prefetch_cfra(pfjob);
+  const int range_frame = seq_prefetch_frame_at_offset(pfjob, seq_prefetch_range_offset(pfjob));
+  if (pfjob->direction > 0) {
+    *r_start = pfjob->cfra;
+    *r_end = range_frame;
+  }
+  else {
+    *r_start = range_frame;
+    *r_end = pfjob->cfra;
+  }
+}
+
+int seq_prefetch_direction_get(Scene *scene)
+{
+  PrefetchJob *pfjob = seq_prefetch_job_get(scene);
+  if (pfjob == nullptr || !pfjob->running) {
+    return 1;
+  }
+  return pfjob->direction;
 }
 
 static void seq_prefetch_free_depsgraph(PrefetchJob *pfjob)
@@ -267,19 +321,36 @@ static void seq_prefetch_update_area(PrefetchJob *pfjob)
 {
   int cfra = pfjob->scene->r.cfra;
 
-  /* rebase */
-  if (cfra > pfjob->cfra) {
-    int delta = cfra - pfjob->cfra;
-    pfjob->cfra = cfra;
-    pfjob->num_frames_prefetched -= delta;
-
-    pfjob->num_frames_prefetched = std::max(pfjob->num_frames_prefetched, 1);
-  }
+  if (cfra != pfjob->cfra) {
+    /* Distance moved in the prefetch direction, including wrapping around the timeline like
+     * playback does. */
+    int delta = (cfra - pfjob->cfra) * pfjob->direction;
+    if (delta < 0 && pfjob->timeline_length > 0) {
+      delta = (delta % pfjob->timeline_length + pfjob->timeline_length) %
+              pfjob->timeline_length;
+    }
 
-  /* reset */
-  if (cfra < pfjob->cfra) {
-    pfjob->cfra = cfra;
-    pfjob->num_frames_prefetched = 1;
+    if (delta > 0 && delta < pfjob->num_frames_prefetched) {
+      /* rebase, the frames between the current frame and the prefetched ones are still valid. */
+      pfjob->cfra = cfra;
+      pfjob->num_frames_prefetched = std::max(pfjob->num_frames_prefetched - delta, 1);
+      if (pfjob->direction < 0) {
+        /* Restart the run, as its frames moved. Frames that are cached already are skipped. */
+        pfjob->num_frames_prefetched -= (pfjob->num_frames_prefetched - 1) %
+                                        PREFETCH_BACKWARD_RUN_LENGTH;
+      }
+    }
+    else {
+      /* reset, following the direction the current frame moved in, so that stepping or playing
+       * backwards prefetches the frames that will be displayed next. Jumping to the other end of
+       * the timeline is what looping playback does, so that keeps the direction. */
+      const int loop_frame = pfjob->direction > 0 ? pfjob->timeline_start : pfjob->timeline_end;
+      if (cfra != loop_frame) {
+        pfjob->direction = cfra > pfjob->cfra ? 1 : -1;
+      }
+      pfjob->cfra = cfra;
+      pfjob->num_frames_prefetched = 1;
+    }
   }
 
   /* timeline span changes */
@@ -24,6 +24,11 @@ void seq_prefetch_start(const RenderData *context, float timeline_frame);
 void seq_prefetch_free(Scene *scene);
 bool seq_prefetch_job_is_running(Scene *scene);
 void seq_prefetch_get_time_range(Scene *scene, int *r_start, int *r_end);
+/**
+ * Direction in which frames are prefetched from the current frame: 1 for forward and -1 for
+ * backward.
+ */
+int seq_prefetch_direction_get(Scene *scene);
 
 Scene *prefetch_get_original_scene(const RenderData *context);
 Scene *prefetch_get_original_scene_and_strip(const RenderData *context, const Strip *&strip);
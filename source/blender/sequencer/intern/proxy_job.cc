@@ -8,12 +8,18 @@
  * \ingroup sequencer
  */
 
+#include <atomic>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
+#include "DNA_userdef_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
+#include "BLI_mutex.hh"
+#include "BLI_threads.h"
 
 #include "BKE_context.hh"
 
@@ -32,24 +38,80 @@ static void proxy_freejob(void *pjv)
   MEM_delete(pj);
 }
 
-/* Only this runs inside thread. */
-static void proxy_startjob(void *pjv, wmJobWorkerStatus *worker_status)
+/** State shared by the threads that build the proxies of one job. */
+struct ProxyJobThreadState {
+  ProxyJob *pj = nullptr;
+  wmJobWorkerStatus *worker_status = nullptr;
+
+  /** Index of the next context in the queue that has not been started. */
+  std::atomic<int> next_index = 0;
+
+  Mutex progress_mutex;
+  Array<float> progress;
+};
+
+static void *proxy_build_thread(void *data)
 {
-  ProxyJob *pj = static_cast<ProxyJob *>(pjv);
-  for (const int i : pj->queue.index_range()) {
+  ProxyJobThreadState &state = *static_cast<ProxyJobThreadState *>(data);
+  ProxyJob *pj = state.pj;
+  wmJobWorkerStatus *worker_status = state.worker_status;
+
+  while (!worker_status->stop) {
+    const int i = state.next_index++;
+    if (i >= pj->queue.size()) {
+      break;
+    }
     ProxyBuildContext *context = pj->queue[i];
+    /* Each thread has its own update flag, updates are forwarded together with the progress. */
+    bool has_updated = false;
     proxy_build_process(
-        context, &worker_status->stop, &worker_status->do_update, [&](const float new_progress) {
+        context, &worker_status->stop, &has_updated, [&](const float new_progress) {
           /* Remap the progress of the current proxy to the total progress. */
-          const float total_progress = (i + new_progress) / pj->queue.size();
-          worker_status->progress = total_progress;
+          std::lock_guard lock(state.progress_mutex);
+          state.progress[i] = new_progress;
+          float total_progress = 0.0f;
+          for (const float progress : state.progress) {
+            total_progress += progress;
+          }
+          worker_status->progress = total_progress / pj->queue.size();
+          worker_status->do_update = true;
         });
+  }
+  return nullptr;
+}
 
-    if (worker_status->stop) {
-      pj->stop = true;
-      fprintf(stderr, "Canceling proxy rebuild on users request...\n");
-      break;
+/* Only this runs inside thread. */
+static void proxy_startjob(void *pjv, wmJobWorkerStatus *worker_status)
+{
+  ProxyJob *pj = static_cast<ProxyJob *>(pjv);
+  if (pj->queue.is_empty()) {
+    return;
+  }
+
+  ProxyJobThreadState state;
+  state.pj = pj;
+  state.worker_status = worker_status;
+  state.progress.reinitialize(pj->queue.size());
+  state.progress.fill(0.0f);
+
+  /* Each proxy is built from its own copy of the strip with its own decoder and encoders, so
+   * multiple proxies can be built at the same time. */
+  const int threads_num = std::clamp<int>(U.sequencer_proxy_build_jobs, 1, pj->queue.size());
+  if (threads_num <= 1) {
+    proxy_build_thread(&state);
+  }
+  else {
+    ListBaseT<ThreadSlot> threads;
+    BLI_threadpool_init(&threads, proxy_build_thread, threads_num);
+    for (int i = 0; i < threads_num; i++) {
+      BLI_threadpool_insert(&threads, &state);
     }
+    BLI_threadpool_end(&threads);
+  }
+
+  if (worker_status->stop) {
+    pj->stop = true;
+    fprintf(stderr, "Canceling proxy rebuild on users request...\n");
   }
 }
 
@@ -24,6 +24,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_rect.h"
 #include "BLI_task.hh"
+#include "BLI_threads.h"
 
 #include "BKE_anim_data.hh"
 #include "BKE_animsys.h"
@@ -652,6 +653,9 @@ static ImBuf *input_preprocess(const RenderData *context,
     modifier_translation = mod_context.result_translation;
   }
 
+  bool flip_x = (strip->flag & SEQ_FLIPX) != 0;
+  bool flip_y = (strip->flag & SEQ_FLIPY) != 0;
+
   if (sequencer_use_crop(strip) || sequencer_use_transform(strip) || context->rectx != ibuf->x ||
       context->recty != ibuf->y || modifier_translation != float2(0, 0))
   {
@@ -671,6 +675,16 @@ static ImBuf *input_preprocess(const RenderData *context,
                                                   preview_scale_factor);
     matrix *= math::from_location<float3x3>(modifier_translation);
     matrix = math::invert(matrix);
+    if (flip_x || flip_y) {
+      /* Flip the transformed image as part of the transform, instead of in separate passes over
+       * all pixels afterwards. The matrix maps pixel centers of the output to the source image,
+       * so mirroring around the output center gives exactly the same result. */
+      matrix *= math::from_loc_scale<float3x3>(float2(flip_x ? x : 0, flip_y ? y : 0),
+                                               float2(flip_x ? -1.0f : 1.0f,
+                                                      flip_y ? -1.0f : 1.0f));
+      flip_x = false;
+      flip_y = false;
+    }
     sequencer_preprocess_transform_crop(ibuf,
                                         transformed_ibuf,
                                         context,
@@ -685,12 +699,12 @@ static ImBuf *input_preprocess(const RenderData *context,
     ibuf = transformed_ibuf;
   }
 
-  if (strip->flag & SEQ_FLIPX) {
+  if (flip_x) {
     ibuf = IMB_makeSingleUser(ibuf);
     IMB_flipx(ibuf);
   }
 
-  if (strip->flag & SEQ_FLIPY) {
+  if (flip_y) {
     ibuf = IMB_makeSingleUser(ibuf);
     IMB_flipy(ibuf);
   }
@@ -1840,6 +1854,107 @@ static bool is_opaque_alpha_over(const Strip *strip)
   return true;
 }
 
+/**
+ * Image and movie strips only depend on their own media, unless they have modifiers that read
+ * other strips or masks. So they can be rendered at the same time as other such strips.
+ */
+static bool strip_can_render_concurrently(const Strip *strip)
+{
+  if (!ELEM(strip->type, STRIP_TYPE_IMAGE, STRIP_TYPE_MOVIE)) {
+    return false;
+  }
+  for (const StripModifierData &smd : strip->modifiers) {
+    if (smd.flag & STRIP_MODIFIER_FLAG_MUTE) {
+      continue;
+    }
+    if (smd.type == eSeqModifierType_Compositor || smd.mask_strip != nullptr ||
+        smd.mask_id != nullptr)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Render strips in parallel, storing the results in the intra-frame cache where
+ * #seq_render_strip picks them up when the stack is blended. Strips that are already cached or
+ * that can't be rendered concurrently are skipped.
+ */
+static void seq_render_strips_concurrently(const RenderData *context,
+                                           const SeqRenderState *state,
+                                           Span<Strip *> strips,
+                                           float timeline_frame)
+{
+  Vector<Strip *> strips_to_render;
+  for (Strip *strip : strips) {
+    if (!strip_can_render_concurrently(strip)) {
+      continue;
+    }
+    ImBuf *cached = intra_frame_cache_get_preprocessed(context->scene, strip);
+    if (cached != nullptr) {
+      IMB_freeImBuf(cached);
+      continue;
+    }
+    strips_to_render.append(strip);
+  }
+  if (strips_to_render.size() < 2) {
+    return;
+  }
+
+  /* Isolate, so that waiting for the tasks does not pick up unrelated work that could try to
+   * render a frame while the render mutex is held. */
+  threading::isolate_task([&]() {
+    threading::parallel_for(strips_to_render.index_range(), 1, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        SeqRenderState local_state = *state;
+        ImBuf *ibuf = seq_render_strip(context, &local_state, strips_to_render[i], timeline_frame);
+        IMB_freeImBuf(ibuf);
+      }
+    });
+  });
+}
+
+/**
+ * Find the strips at the top of the stack downwards from #start that are likely to be rendered
+ * by the top-down pass of #seq_render_strip_stack: stop at the first strip that replaces
+ * everything below it, or that is already composited. Strips hidden behind known opaque strips
+ * are skipped. At most one strip per thread is returned, to limit the work wasted on strips that
+ * turn out to be hidden behind an opaque strip of the same batch.
+ */
+static Vector<Strip *> seq_render_stack_top_batch(const RenderData *context,
+                                                  Span<Strip *> strips,
+                                                  const int64_t start,
+                                                  const OpaqueQuadTracker &opaques,
+                                                  int64_t &r_batch_end)
+{
+  const int max_batch_size = BLI_system_thread_count();
+  Vector<Strip *> batch;
+  int64_t i = start;
+  for (; i >= 0 && batch.size() < max_batch_size; i--) {
+    Strip *strip = strips[i];
+    if (!strip_can_render_concurrently(strip)) {
+      break;
+    }
+    ImBuf *composite = intra_frame_cache_get_composite(context->scene, strip);
+    if (composite != nullptr) {
+      IMB_freeImBuf(composite);
+      break;
+    }
+    const StripEarlyOut early_out = strip_get_early_out_for_blend_mode(strip);
+    if (early_out == StripEarlyOut::UseInput1 || opaques.is_occluded(context, strip, i)) {
+      continue;
+    }
+    batch.append(strip);
+    if (strip->blend_mode == STRIP_BLEND_REPLACE || early_out != StripEarlyOut::DoEffect) {
+      i--;
+      break;
+    }
+  }
+  r_batch_end = i;
+  return batch;
+}
+
 static ImBuf *seq_render_strip_stack(const RenderData *context,
                                      SeqRenderState *state,
                                      ListBaseT<SeqTimelineChannel> *channels,
@@ -1857,9 +1972,18 @@ static ImBuf *seq_render_strip_stack(const RenderData *context,
 
   int64_t i;
   ImBuf *out = nullptr;
+  /* Strips from here downwards have not been considered for concurrent rendering yet. */
+  int64_t concurrent_batch_start = strips.size() - 1;
   for (i = strips.size() - 1; i >= 0; i--) {
     Strip *strip = strips[i];
 
+    if (i == concurrent_batch_start) {
+      const Vector<Strip *> batch = seq_render_stack_top_batch(
+          context, strips, i, opaques, concurrent_batch_start);
+      seq_render_strips_concurrently(context, state, batch, timeline_frame);
+      concurrent_batch_start = std::min(concurrent_batch_start, i - 1);
+    }
+
     out = intra_frame_cache_get_composite(context->scene, strip);
     if (out) {
       break;
@@ -1942,6 +2066,20 @@ static ImBuf *seq_render_strip_stack(const RenderData *context,
   }
 
   i++;
+
+  /* All strips above the bottom of the stack that are not hidden get blended, so their images can
+   * be rendered up front, in parallel. */
+  Vector<Strip *> strips_to_blend;
+  for (const int64_t j : IndexRange::from_begin_end(i, strips.size())) {
+    Strip *strip = strips[j];
+    if (!opaques.is_occluded(context, strip, j) &&
+        strip_get_early_out_for_blend_mode(strip) == StripEarlyOut::DoEffect)
+    {
+      strips_to_blend.append(strip);
+    }
+  }
+  seq_render_strips_concurrently(context, state, strips_to_blend, timeline_frame);
+
   for (; i < strips.size(); i++) {
     Strip *strip = strips[i];
 
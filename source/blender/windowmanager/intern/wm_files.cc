@@ -135,6 +135,7 @@
 #include "RE_engine.h"
 
 #ifdef WITH_PYTHON
+#  include "BPY_extern.hh"
 #  include "BPY_extern_python.hh"
 #  include "BPY_extern_run.hh"
 #endif
@@ -2220,7 +2221,17 @@ static bool wm_file_write(bContext *C,
   blend_write_params.use_save_as_copy = use_save_as_copy;
   blend_write_params.thumb = thumb;
 
-  const bool success = BLO_write_file(bmain, filepath, fileflags, &blend_write_params, reports);
+  bool success;
+#ifdef WITH_PYTHON
+  /* Writing large files can take a while, don't block other Python threads. */
+  BPy_BEGIN_ALLOW_THREADS;
+#endif
+
+  success = BLO_write_file(bmain, filepath, fileflags, &blend_write_params, reports);
+
+#ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#endif
 
   if (success) {
     const bool do_history_file_update = (G.background == false) &&
@@ -2325,6 +2336,48 @@ bool WM_autosave_is_scheduled(wmWindowManager *wm)
   return wm->autosave_scheduled;
 }
 
+static void wm_autosave_write_job_startjob(void *customdata, wmJobWorkerStatus * /*worker_status*/)
+{
+  const BlendFileMemoryWrite *memory_write = static_cast<const BlendFileMemoryWrite *>(
+      customdata);
+  /* Error reporting into console. */
+  BLO_write_file_from_memory(memory_write, nullptr);
+}
+
+static void wm_autosave_write_job_free(void *customdata)
+{
+  BLO_write_file_memory_free(static_cast<BlendFileMemoryWrite *>(customdata));
+}
+
+/**
+ * Only serialize the file on the main thread, writing it to disk (which may be slow network
+ * storage) happens in a job.
+ */
+static void wm_autosave_write_async(wmWindowManager *wm,
+                                    Main *bmain,
+                                    const char *filepath,
+                                    const int fileflags,
+                                    const BlendFileWriteParams &params)
+{
+  if (WM_jobs_test(wm, wm, WM_JOB_TYPE_AUTOSAVE)) {
+    /* The previous auto-save is still being written, skip this one. */
+    return;
+  }
+
+  BlendFileMemoryWrite *memory_write = BLO_write_file_to_memory(
+      bmain, filepath, fileflags, &params, nullptr);
+  if (memory_write == nullptr) {
+    return;
+  }
+
+  wmJob *wm_job = WM_jobs_get(
+      wm, nullptr, wm, "Auto-saving...", eWM_JobFlag(0), WM_JOB_TYPE_AUTOSAVE);
+  WM_jobs_customdata_set(wm_job, memory_write, wm_autosave_write_job_free);
+  WM_jobs_timer(wm_job, 0.1, 0, 0);
+  WM_jobs_callbacks(wm_job, wm_autosave_write_job_startjob, nullptr, nullptr, nullptr);
+  WM_jobs_start(wm, wm_job);
+}
+
 void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 {
   ED_editors_flush_edits(bmain);
@@ -2335,9 +2388,14 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
    */
   const int fileflags = G.fileflags | G_FILE_RECOVER_WRITE | G_FILE_COMPRESS;
 
-  /* Error reporting into console. */
   BlendFileWriteParams params{};
-  BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  if (USER_DEVELOPER_TOOL_TEST(&U, use_async_autosave)) {
+    wm_autosave_write_async(wm, bmain, filepath, fileflags, params);
+  }
+  else {
+    /* Error reporting into console. */
+    BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  }
 
   /* Restart auto-save timer. */
   wm_autosave_timer_end(wm);
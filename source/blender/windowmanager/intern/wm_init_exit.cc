@@ -27,7 +27,9 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 #include "BLI_timer.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BLO_undofile.hh"
@@ -125,6 +127,7 @@ CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_PUB, "msgbus.pub");
 CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_SUB, "msgbus.sub");
 
 static CLG_LogRef LOG_BLEND = {"blend"};
+static CLG_LogRef LOG_INIT = {"init"};
 
 static void wm_init_scripts_extensions_once(bContext *C);
 
@@ -197,8 +200,21 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
   }
 }
 
+/**
+ * Log the time spent in a phase of #WM_init, to find what slows down startup.
+ * Enabled with `--log "init" --log-level debug`.
+ */
+static void wm_init_phase_log(const char *phase, double &r_phase_start_time)
+{
+  const double time = BLI_time_now_seconds();
+  CLOG_DEBUG(&LOG_INIT, "%s took %f seconds.", phase, time - r_phase_start_time);
+  r_phase_start_time = time;
+}
+
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  const double init_start_time = BLI_time_now_seconds();
+  double phase_start_time = init_start_time;
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
@@ -230,6 +246,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   ED_node_init_butfuncs();
 
+  wm_init_phase_log("Registering types", phase_start_time);
+
   BLF_init();
 
   BLT_lang_init();
@@ -249,6 +267,8 @@ void WM_init(bContext *C, int argc, const char **argv)
    * otherwise the versioning cannot find the default studio-light. */
   BKE_studiolight_init();
 
+  wm_init_phase_log("Fonts, translations, icons and studio-lights", phase_start_time);
+
   BLI_assert((G.fileflags & G_FILE_NO_UI) == 0);
 
   /**
@@ -291,6 +311,8 @@ void WM_init(bContext *C, int argc, const char **argv)
   /* For file-system. Called here so can include user preference paths if needed. */
   ED_file_init();
 
+  wm_init_phase_log("Reading startup file and preferences", phase_start_time);
+
   if (!G.background) {
     GPU_render_begin();
 
@@ -308,6 +330,8 @@ void WM_init(bContext *C, int argc, const char **argv)
     ui::init();
     GPU_context_end_frame(GPU_context_active_get());
     GPU_render_end();
+
+    wm_init_phase_log("GPU and interface", phase_start_time);
   }
 
   bke::subdiv::init();
@@ -317,6 +341,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 #ifdef WITH_PYTHON
   BPY_python_start(C, argc, argv);
   BPY_python_reset(C);
+
+  wm_init_phase_log("Python", phase_start_time);
 #else
   UNUSED_VARS(argc, argv);
 #endif
@@ -356,7 +382,13 @@ void WM_init(bContext *C, int argc, const char **argv)
   WM_keyconfig_update_postpone_end();
   WM_keyconfig_update_on_startup(static_cast<wmWindowManager *>(G_MAIN->wm.first));
 
+  wm_init_phase_log("Key-maps, add-ons and extensions", phase_start_time);
+
   wm_homefile_read_post(C, params_file_read_post);
+
+  wm_init_phase_log("Startup file post-read handlers", phase_start_time);
+  CLOG_DEBUG(
+      &LOG_INIT, "Initialization took %f seconds.", BLI_time_now_seconds() - init_start_time);
 }
 
 static bool wm_init_splash_show_on_startup_check()
@@ -672,6 +704,9 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
+  /* Written after the worker threads exited, so that all their zones are recorded. */
+  blender::trace::write_output_file();
+
   /* No need to call this early, rather do it late so that other
    * pieces of Blender using sound may exit cleanly, see also #50676. */
   BKE_sound_exit_once();
@@ -29,6 +29,7 @@
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
 #  include "BLI_threads.h"
+#  include "BLI_trace.hh"
 #  include "BLI_utildefines.h"
 #  ifndef NDEBUG
 #    include "BLI_mempool.h"
@@ -768,6 +769,7 @@ static void print_help(bArgs *ba, bool all)
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-time");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-pretty");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-uid");
+  BLI_args_print_arg_doc(ba, "--debug-trace");
   BLI_args_print_arg_doc(ba, "--debug-ghost");
   BLI_args_print_arg_doc(ba, "--debug-wintab");
   BLI_args_print_arg_doc(ba, "--debug-gpu");
@@ -1528,6 +1530,21 @@ static int arg_handle_debug_value_set(int argc, const char **argv, void * /*data
   return 0;
 }
 
+static const char arg_handle_debug_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord the time spent in instrumented code and write it to <filepath> on exit.\n"
+    "\tThe file uses the Chrome trace event format, which can be opened in Perfetto.";
+static int arg_handle_debug_trace_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--debug-trace";
+  if (argc > 1) {
+    blender::trace::set_output_filepath(argv[1]);
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_debug_gpu_set_doc[] =
     "\n"
     "\tEnable GPU debug context and information for OpenGL 4.3+.";
@@ -3108,6 +3125,7 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
   BLI_args_add(ba, nullptr, "--debug-memory", CB(arg_handle_debug_mode_memory_set), nullptr);
 
   BLI_args_add(ba, nullptr, "--debug-value", CB(arg_handle_debug_value_set), nullptr);
+  BLI_args_add(ba, nullptr, "--debug-trace", CB(arg_handle_debug_trace_set), nullptr);
   BLI_args_add(ba,
                nullptr,
                "--debug-jobs",
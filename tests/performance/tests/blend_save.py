@@ -0,0 +1,52 @@
+# SPDX-FileCopyrightText: 2026 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    compress = args["compress"]
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filepath = os.path.join(temp_dir, "blend_save.blend")
+
+        # Save once so that the destination file exists, like when saving over an existing file.
+        bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True, compress=compress)
+
+        # Measure saving the second time.
+        start_time = time.time()
+        bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True, compress=compress)
+        elapsed_time = time.time() - start_time
+
+    result = {'time': elapsed_time}
+    return result
+
+
+class BlendSaveTest(api.Test):
+    def __init__(self, filepath, compress):
+        self.filepath = filepath
+        self.compress = compress
+
+    def name(self):
+        if self.compress:
+            return self.filepath.stem + "_compressed"
+        return self.filepath.stem
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id, gpu_backend):
+        args = {"compress": self.compress}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('*/*')
+    return [BlendSaveTest(filepath, compress) for filepath in filepaths for compress in (False, True)]
@@ -0,0 +1,52 @@
+# SPDX-FileCopyrightText: 2026 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    subdivisions = args["subdivisions"]
+    iterations = 5
+
+    bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+    bpy.ops.mesh.primitive_grid_add(x_subdivisions=subdivisions, y_subdivisions=subdivisions)
+
+    enter_time = 0.0
+    exit_time = 0.0
+    for _ in range(iterations):
+        start_time = time.time()
+        bpy.ops.object.mode_set(mode='EDIT')
+        enter_time += time.time() - start_time
+
+        start_time = time.time()
+        bpy.ops.object.mode_set(mode='OBJECT')
+        exit_time += time.time() - start_time
+
+    result = {'time': (enter_time + exit_time) / iterations,
+              'enter_time': enter_time / iterations,
+              'exit_time': exit_time / iterations}
+    return result
+
+
+class EditModeToggleTest(api.Test):
+    def __init__(self, subdivisions):
+        self.subdivisions = subdivisions
+
+    def name(self):
+        return "mesh_toggle_{}x{}".format(self.subdivisions, self.subdivisions)
+
+    def category(self):
+        return "edit_mode"
+
+    def run(self, env, device_id, gpu_backend):
+        args = {"subdivisions": self.subdivisions}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    return [EditModeToggleTest(subdivisions) for subdivisions in (100, 1000)]
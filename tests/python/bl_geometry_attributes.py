@@ -67,6 +67,24 @@ class TestCurves(unittest.TestCase):
         self.curves.attributes.new("a" * 100, 'FLOAT', 'POINT')
         self.assertTrue(self.curves.attributes["a" * 100].name == "a" * 100)
 
+    def test_foreach_getset_converted_buffer(self):
+        import numpy as np
+        a = self.curves.attributes.new("a", 'FLOAT', 'POINT')
+        # Buffers with a different type than the attribute are converted in bulk.
+        a.data.foreach_set("value", np.arange(50, dtype=np.float64))
+        values = np.zeros(50, dtype=np.float32)
+        a.data.foreach_get("value", values)
+        self.assertTrue(np.array_equal(values, np.arange(50, dtype=np.float32)))
+        values_int = np.zeros(50, dtype=np.int64)
+        a.data.foreach_get("value", values_int)
+        self.assertTrue(np.array_equal(values_int, np.arange(50, dtype=np.int64)))
+
+        b = self.curves.attributes.new("b", 'FLOAT_VECTOR', 'POINT')
+        b.data.foreach_set("vector", np.arange(150, dtype=np.float64))
+        vectors = np.zeros(150, dtype=np.float64)
+        b.data.foreach_get("vector", vectors)
+        self.assertTrue(np.array_equal(vectors, np.arange(150, dtype=np.float64)))
+
 
 if __name__ == '__main__':
     import sys
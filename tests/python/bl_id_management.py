@@ -259,6 +259,25 @@ class TestIdRename(TestHelper, unittest.TestCase):
         self.ensure_proper_order()
 
 
+class TestIdBatchEdit(unittest.TestCase):
+
+    def test_batch_edit_link_objects(self):
+        scene = bpy.data.scenes.new("BatchEdit")
+        collection = bpy.data.collections.new("BatchEdit")
+        scene.collection.children.link(collection)
+
+        with bpy.data.batch_edit():
+            objects = [bpy.data.objects.new("BatchEdit", None) for _ in range(100)]
+            for ob in objects:
+                collection.objects.link(ob)
+
+        self.assertEqual(len(collection.objects), 100)
+        self.assertEqual(len(scene.view_layers[0].objects), 100)
+        self.assertTrue(all(scene.view_layers[0].objects[ob.name] == ob for ob in objects))
+
+        bpy.data.batch_remove(objects + [collection, scene])
+
+
 if __name__ == '__main__':
     import sys
     sys.argv = [__file__] + (sys.argv[sys.argv.index("--") + 1:] if "--" in sys.argv else [])